@@ -11,6 +11,7 @@
 /* clang-format on */
 
 #include "fsl_device_registers.h"
+#include "nxp_xcvr_blob.h"
 
 /*!
  * @addtogroup configs Radio Configuration Files
@@ -360,6 +361,84 @@ typedef struct
     const xcvr_mode_datarate_config_t *mode_data_rate_cfg;
 } xcvr_config_t;
 
+/*! @brief Number of registers programmed by the radio register setup. */
+#define XCVR_REG_IMAGE_NUM_REGS (233U)
+/*! @brief Maximum size of a register image in words (one run header and one value per register, worst case). */
+#define XCVR_REG_IMAGE_MAX_WORDS (2U * XCVR_REG_IMAGE_NUM_REGS)
+/*! @brief Marker for a register descriptor that takes no value from one of the configuration structures. */
+#define XCVR_REG_NO_FIELD (0xFFFFU)
+
+/* Run header fields of a register image, index of the first register descriptor and number of registers in the run */
+#define XCVR_REG_IMAGE_RUN_IDX_MASK  (0xFFFF0000U)
+#define XCVR_REG_IMAGE_RUN_IDX_SHIFT (16U)
+#define XCVR_REG_IMAGE_RUN_CNT_MASK  (0x0000FFFFU)
+#define XCVR_REG_IMAGE_RUN_HDR(idx, cnt)                                                  \
+    ((((uint32_t)(idx) << XCVR_REG_IMAGE_RUN_IDX_SHIFT) & XCVR_REG_IMAGE_RUN_IDX_MASK) | \
+     ((uint32_t)(cnt) & XCVR_REG_IMAGE_RUN_CNT_MASK))
+
+/*!
+ * @brief XCVR register descriptor structure
+ * Describes one register programmed by the radio register setup and the configuration fields OR-ed into it.
+ */
+typedef struct
+{
+    volatile uint32_t *reg; /*!< Address of the register */
+    uint16_t common_ofst;   /*!< Byte offset of the field in ::xcvr_common_config_t or ::XCVR_REG_NO_FIELD */
+    uint16_t mode_ofst;     /*!< Byte offset of the field in ::xcvr_mode_datarate_config_t or ::XCVR_REG_NO_FIELD */
+} xcvr_reg_desc_t;
+
+/*!
+ * @brief XCVR register image structure
+ * Packed image of a complete radio configuration. The image is a sequence of runs of consecutive registers, each run
+ * is a header word (::XCVR_REG_IMAGE_RUN_HDR, descriptor index of the first register and register count) followed by
+ * the register values.
+ */
+typedef struct
+{
+    uint16_t num_words;                       /*!< Number of valid words in the image */
+    uint32_t words[XCVR_REG_IMAGE_MAX_WORDS]; /*!< Run headers and register values */
+} xcvr_reg_image_t;
+
+/*!
+ * @brief XCVR folded configuration structure
+ * Radio configuration with the common and mode dependent settings merged ahead of time (see tools/xcvr_reg_image_gen.c)
+ * so the register setup is a straight copy from flash.
+ */
+typedef struct
+{
+    const xcvr_config_t *config;                  /*!< Configuration the register values were folded from */
+    uint32_t reg_values[XCVR_REG_IMAGE_NUM_REGS]; /*!< Merged register values, in ::xcvr_reg_desc_table order */
+} xcvr_folded_config_t;
+
+/*! @brief Number of 32-bit words of ::xcvr_mode_datarate_config_t, the unit of the sparse delta encoding. */
+#define XCVR_MODE_DELTA_NUM_WORDS (sizeof(xcvr_mode_datarate_config_t) / sizeof(uint32_t))
+
+/*!
+ * @brief XCVR sparse mode and data rate configuration structure
+ * Mode and data rate settings stored as the words which differ from a base configuration shared by all modes. The
+ * xcvr_<mode>_<rate>_delta_config of every configuration are in nxp_xcvr_mode_deltas.h, generated from the
+ * configuration sources by tools/xcvr_mode_delta_gen.c. The full ::xcvr_mode_datarate_config_t is rebuilt in RAM by
+ * ::XCVR_RadioGenModeDeltaExpand() or streamed straight into the registers by ::XCVR_RadioGenRegSetupSparse().
+ */
+typedef struct
+{
+    const uint32_t *base_words; /*!< Shared base configuration, ::XCVR_MODE_DELTA_NUM_WORDS words */
+    const uint8_t *delta_idx;   /*!< Word indexes of the words differing from the base, strictly increasing */
+    const uint32_t *delta_val;  /*!< Values of the words differing from the base */
+    uint16_t num_deltas;        /*!< Number of words differing from the base */
+} xcvr_mode_delta_config_t;
+
+/*!
+ * @brief XCVR blob configuration structure
+ * Configurations found in a radio configuration blob by ::XCVR_RadioGenBlobLoad(). The pointers point into the blob
+ * itself, nothing is copied.
+ */
+typedef struct
+{
+    xcvr_config_t config; /*!< Common and mode and data rate configurations, NULLPTR for a section not in the blob */
+    const xcvr_coding_config_t *coding_cfg; /*!< Coding configuration, NULLPTR if not in the blob */
+} xcvr_blob_config_t;
+
 /*******************************************************************************
  * Prototypes
  ******************************************************************************/
@@ -384,9 +463,156 @@ xcvrStatus_t XCVR_RadioGenRegSetup(const xcvr_config_t *xcvr_config);
  */
 xcvrStatus_t XCVR_RadioGenRBMESetup(const xcvr_coding_config_t *rbme);
 
+/*!
+ * @brief Performs delta register setup for a mode change.
+ *
+ * This function programs only the XCVR registers whose merged (common and mode dependent) value for the target
+ * configuration differs from the value programmed by the currently active configuration.
+ *
+ * @param[in] curr_config  Pointer to the combined XCVR settings structure currently programmed in the radio.
+ * @param[in] xcvr_config  Pointer to the combined XCVR settings structure to be programmed.
+ * @param[out] skipped_writes  Pointer to storage for the number of register writes skipped. May be NULLPTR.
+ * @return Status of the call.
+ * @note GEN4PHY->DMD_CTRL1 is left to ::XCVR_RadioGenRBMESetupDelta() which must be called afterwards.
+ */
+xcvrStatus_t XCVR_RadioGenRegSetupDelta(const xcvr_config_t *curr_config,
+                                        const xcvr_config_t *xcvr_config,
+                                        uint32_t *skipped_writes);
+
+/*!
+ * @brief Performs delta RBME setup for a mode change.
+ *
+ * This function programs only the RBME registers whose value for the target coding configuration differs from the
+ * value programmed by the currently active coding configuration.
+ *
+ * @param[in] curr_rbme  Pointer to the RBME settings structure currently programmed in the radio.
+ * @param[in] rbme  Pointer to the RBME settings structure to be programmed.
+ * @param[out] skipped_writes  Pointer to storage for the number of register writes skipped. May be NULLPTR.
+ * @return Status of the call.
+ */
+xcvrStatus_t XCVR_RadioGenRBMESetupDelta(const xcvr_coding_config_t *curr_rbme,
+                                         const xcvr_coding_config_t *rbme,
+                                         uint32_t *skipped_writes);
+
+/*!
+ * @brief Performs all register setup using the register descriptor table.
+ *
+ * This function programs the same registers with the same values and in the same order as ::XCVR_RadioGenRegSetup()
+ * but loops over ::xcvr_reg_desc_table instead of using generated straight-line code.
+ *
+ * @param[in] xcvr_config  Pointer to the combined (common and mode dependent) XCVR settings structure.
+ * @return Status of the call.
+ */
+xcvrStatus_t XCVR_RadioGenRegSetupTable(const xcvr_config_t *xcvr_config);
+
+/*!
+ * @brief Builds a packed register image of a radio configuration.
+ *
+ * This function merges the common and mode dependent settings into a register image which can be programmed
+ * (repeatedly) with ::XCVR_RadioGenRegImageProgram().
+ *
+ * @param[in] xcvr_config  Pointer to the combined (common and mode dependent) XCVR settings structure.
+ * @param[out] image  Pointer to the register image to be filled.
+ * @return Status of the call.
+ */
+xcvrStatus_t XCVR_RadioGenRegImageBuild(const xcvr_config_t *xcvr_config, xcvr_reg_image_t *image);
+
+/*!
+ * @brief Programs a packed register image into the radio.
+ *
+ * This function writes each run of the image as one burst of consecutive addresses from the register of the first
+ * descriptor of the run. The result is identical to ::XCVR_RadioGenRegSetup() for the configuration the image was built
+ * from. A run which extends past the descriptor table or past the end of the image, or whose descriptors are not
+ * consecutive registers, is rejected before it is written.
+ * Building an image costs as much as ::XCVR_RadioGenRegSetupTable(), so the image pays off for a configuration which
+ * is programmed again and again, e.g. on every switch to a given mode.
+ *
+ * @param[in] image  Pointer to the register image built by ::XCVR_RadioGenRegImageBuild().
+ * @return Status of the call.
+ */
+xcvrStatus_t XCVR_RadioGenRegImageProgram(const xcvr_reg_image_t *image);
+
+/*!
+ * @brief Performs all register setup from a folded configuration.
+ *
+ * This function copies the pre-merged register values of a folded configuration into the registers described by
+ * ::xcvr_reg_desc_table. The result is identical to ::XCVR_RadioGenRegSetup() for the configuration it was folded from.
+ *
+ * @param[in] folded_config  Pointer to the folded configuration.
+ * @return Status of the call.
+ */
+xcvrStatus_t XCVR_RadioGenRegSetupFolded(const xcvr_folded_config_t *folded_config);
+
+/*!
+ * @brief Expands a sparse mode and data rate configuration.
+ *
+ * This function rebuilds the full mode and data rate configuration by copying the shared base configuration and
+ * patching the words which differ from it.
+ *
+ * @param[in] delta_config  Pointer to the sparse mode and data rate configuration.
+ * @param[out] mode_datarate_cfg  Pointer to the mode and data rate configuration to be filled (typically in RAM).
+ * @return Status of the call.
+ */
+xcvrStatus_t XCVR_RadioGenModeDeltaExpand(const xcvr_mode_delta_config_t *delta_config,
+                                          xcvr_mode_datarate_config_t *mode_datarate_cfg);
+
+/*!
+ * @brief Performs all register setup from a sparse mode and data rate configuration.
+ *
+ * This function programs the same registers with the same values and in the same order as ::XCVR_RadioGenRegSetup()
+ * but takes the mode dependent settings from a sparse configuration, without expanding it in RAM first.
+ *
+ * @param[in] common_cfg  Pointer to the common XCVR settings structure.
+ * @param[in] delta_config  Pointer to the sparse mode and data rate configuration.
+ * @return Status of the call.
+ */
+xcvrStatus_t XCVR_RadioGenRegSetupSparse(const xcvr_common_config_t *common_cfg,
+                                         const xcvr_mode_delta_config_t *delta_config);
+
+/*!
+ * @brief Encodes radio configurations as a radio configuration blob.
+ *
+ * This function copies any combination of a common, a mode and data rate and a coding configuration as raw memory
+ * images into the versioned blob format read by ::XCVR_RadioGenBlobLoad(). It does not access the radio, so it is
+ * also used on a host (see tools/xcvr_blob_gen.c) to convert the generated configurations into blobs.
+ *
+ * @param[in] common_cfg  Pointer to the common XCVR settings structure. May be NULLPTR.
+ * @param[in] mode_datarate_cfg  Pointer to the mode and data rate configuration. May be NULLPTR.
+ * @param[in] coding_cfg  Pointer to the coding configuration. May be NULLPTR.
+ * @param[out] blob  Pointer to the storage for the blob.
+ * @param[in] max_words  Number of words available at blob.
+ * @param[out] num_words  Pointer to storage for the number of words used.
+ * @return Status of the call, ::gXcvrInvalidParameters_c if no configuration is given or the blob does not fit.
+ */
+xcvrStatus_t XCVR_RadioGenBlobEncode(const xcvr_common_config_t *common_cfg,
+                                     const xcvr_mode_datarate_config_t *mode_datarate_cfg,
+                                     const xcvr_coding_config_t *coding_cfg,
+                                     uint32_t *blob,
+                                     uint32_t max_words,
+                                     uint32_t *num_words);
+
+/*!
+ * @brief Loads a radio configuration blob in place.
+ *
+ * This function checks the header (magic, major version, radio generation and reference clock, size and CRC) and the
+ * sections of a blob, then returns pointers to the configurations inside it. No copy is made, so a blob in flash or
+ * memory-mapped storage can be passed straight to ::XCVR_Configure() or ::XCVR_ChangeMode() through
+ * blob_config->config and blob_config->coding_cfg. A blob holding only some sections can be completed with compiled
+ * in configurations, e.g. common_cfg = &xcvr_common_config.
+ *
+ * @param[in] blob  Pointer to the blob, 32-bit aligned.
+ * @param[in] max_words  Number of words readable at blob, the blob size from the header must not exceed it.
+ * @param[out] blob_config  Pointer to the structure to fill with the configurations of the blob.
+ * @return Status of the call, ::gXcvrInvalidConfiguration_c if the blob is malformed, corrupted or was generated for
+ * another radio, ::gXcvrInvalidParameters_c for NULLPTR arguments. blob_config is only written on success.
+ * @note The blob must remain in place for as long as the radio uses any of its configurations.
+ */
+xcvrStatus_t XCVR_RadioGenBlobLoad(const uint32_t *blob, uint32_t max_words, xcvr_blob_config_t *blob_config);
+
 /*******************************************************************************
  * Variables
  ******************************************************************************/
+extern const xcvr_reg_desc_t xcvr_reg_desc_table[XCVR_REG_IMAGE_NUM_REGS]; /*!< Registers programmed by the setup */
 
 /*******************************************************************************
  * Code
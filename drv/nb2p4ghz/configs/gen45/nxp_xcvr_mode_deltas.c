@@ -0,0 +1,4964 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/* Generated by tools/xcvr_mode_delta_gen.c, do not edit */
+
+#include "nxp_xcvr_mode_deltas.h"
+
+/* clang-format off */
+const uint32_t xcvr_mode_delta_base_words[XCVR_MODE_DELTA_NUM_WORDS] = {
+    /* 0: .radio_mode */
+    FSK_H_0p5,
+    /* 1: .data_rate */
+    DR_1MBPS,
+    /* 2: .alt_data_rate */
+    DR_2MBPS,
+    /* 3: .demod_wave[0].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x14) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x10) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x0C) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x08) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+    /* 4: .demod_wave[0].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x34) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x30),
+    /* 5: .demod_wave[0].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x2C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x28) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x24),
+    /* 6: .demod_wave[1].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x14) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x10) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x0C) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x08) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+    /* 7: .demod_wave[1].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x34) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x38),
+    /* 8: .demod_wave[1].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x3C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x04),
+    /* 9: .demod_wave[2].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x0C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x08) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x04) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+    /* 10: .demod_wave[2].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0C) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x08),
+    /* 11: .demod_wave[2].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x04) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x3C),
+    /* 12: .demod_wave[3].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x0C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x08) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x04) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+    /* 13: .demod_wave[3].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0C) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x10),
+    /* 14: .demod_wave[3].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x14) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x18) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x1C),
+    /* 15: .demod_wave[4].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x34) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x38) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x3C) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+    /* 16: .demod_wave[4].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x34) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x30),
+    /* 17: .demod_wave[4].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x2C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x28) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x24),
+    /* 18: .demod_wave[5].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x34) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x38) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x3C) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+    /* 19: .demod_wave[5].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x34) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x38),
+    /* 20: .demod_wave[5].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x3C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x04),
+    /* 21: .demod_wave[6].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x2C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x30) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x34) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x38) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+    /* 22: .demod_wave[6].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0C) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x08),
+    /* 23: .demod_wave[6].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x04) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x3C),
+    /* 24: .demod_wave[7].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x2C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x30) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x34) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x38) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+    /* 25: .demod_wave[7].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0C) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x10),
+    /* 26: .demod_wave[7].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x14) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x18) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x1C),
+    /* 27: .fsk_cfg0 */
+    GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_1M(0x0F) | GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_2M(0x11) |
+        GEN4PHY_FSK_CFG0_MSK2FSK_SEED(0) | GEN4PHY_FSK_CFG0_MSK_EN(0),
+    /* 28: .fsk_cfg1 */
+    GEN4PHY_FSK_CFG1_OVERH(0x020) | GEN4PHY_FSK_CFG1_OVERH_INV(0x100) | GEN4PHY_FSK_CFG1_SYNCTSCALE(0xF),
+    /* 29: .fsk_pd_cfg0 */
+    GEN4PHY_FSK_PD_CFG0_PD_IIR_ALPHA(0xFF) | GEN4PHY_FSK_PD_CFG0_PREAMBLE_T_SCALE(0xC),
+    /* 30: .fsk_pd_cfg1 */
+    GEN4PHY_FSK_PD_CFG1_PREAMBLE_PATTERN(0x55),
+    /* 31: .fsk_pd_cfg2 */
+    GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_1M(0xF6) | GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_2M(0xEB),
+    /* 32: .fsk_pd_ph[0] */
+    GEN4PHY_FSK_PD_PH_REF0(0x02) | GEN4PHY_FSK_PD_PH_REF1(0x03) | GEN4PHY_FSK_PD_PH_REF2(0x02) |
+        GEN4PHY_FSK_PD_PH_REF3(0x00),
+    /* 33: .fsk_pd_ph[1] */
+    GEN4PHY_FSK_PD_PH_REF0(0x3E) | GEN4PHY_FSK_PD_PH_REF1(0x3D) | GEN4PHY_FSK_PD_PH_REF2(0x3E) |
+        GEN4PHY_FSK_PD_PH_REF3(0x00),
+    /* 34: .fsk_pt */
+    GEN4PHY_FSK_PT_AGC_TIMEOUT(0x0048),
+    /* 35: .lr_aa_cfg */
+    GEN4PHY_LR_AA_CFG_AA_COR_THRESH(0x00) | GEN4PHY_LR_AA_CFG_AA_HAM_THRESH(0x00) |
+        GEN4PHY_LR_AA_CFG_AA_LR_CORR_GAIN(0x00) | GEN4PHY_LR_AA_CFG_ACCESS_ADDR_HAM(0x00),
+    /* 36: .lr_pd_cfg */
+    GEN4PHY_LR_PD_CFG_CORR_TH(0x00) | GEN4PHY_LR_PD_CFG_FREQ_TH(0x00) | GEN4PHY_LR_PD_CFG_NO_PEAKS(0),
+    /* 37: .lr_pd_ph[0] */
+    GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+        GEN4PHY_LR_PD_PH_REF3(0x00),
+    /* 38: .lr_pd_ph[1] */
+    GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+        GEN4PHY_LR_PD_PH_REF3(0x00),
+    /* 39: .lr_pd_ph[2] */
+    GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+        GEN4PHY_LR_PD_PH_REF3(0x00),
+    /* 40: .lr_pd_ph[3] */
+    GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+        GEN4PHY_LR_PD_PH_REF3(0x00),
+    /* 41: .rtt_ref */
+    GEN4PHY_RTT_REF_FM_REF_010(0x48) | GEN4PHY_RTT_REF_FM_REF_110(0x63) | GEN4PHY_RTT_REF_FM_REF_111(0x80),
+    /* 42: .sm_cfg */
+    GEN4PHY_SM_CFG_AA_TIMEOUT_UNCODED(0x0A0),
+    /* 43: .ll_ctrl */
+    RADIO_CTRL_LL_CTRL_ACTIVE_LL(2),
+    /* 44: .tx_dac_pa */
+    XCVR_ANALOG_TX_DAC_PA_DAC_TRIM_CFBK_DRS(1),
+    /* 45: .ips_fo_addr[0] */
+    XCVR_MISC_IPS_FO_ADDR_ADDR(0x370) | XCVR_MISC_IPS_FO_ADDR_ENTRY_RX(0) | XCVR_MISC_IPS_FO_ADDR_ENTRY_TX(0),
+    /* 46: .ips_fo_addr[1] */
+    XCVR_MISC_IPS_FO_ADDR_ADDR(0x02C) | XCVR_MISC_IPS_FO_ADDR_ENTRY_RX(0) | XCVR_MISC_IPS_FO_ADDR_ENTRY_TX(0),
+    /* 47: .ips_fo_drs0_data[0] */
+    XCVR_MISC_IPS_FO_DRS0_DATA_DRS0_DATA(0x00000000),
+    /* 48: .ips_fo_drs0_data[1] */
+    XCVR_MISC_IPS_FO_DRS0_DATA_DRS0_DATA(0x00000000),
+    /* 49: .ips_fo_drs1_data[0] */
+    XCVR_MISC_IPS_FO_DRS1_DATA_DRS1_DATA(0x00000000),
+    /* 50: .ips_fo_drs1_data[1] */
+    XCVR_MISC_IPS_FO_DRS1_DATA_DRS1_DATA(0x00000000),
+    /* 51: .xcvr_ctrl */
+    XCVR_MISC_XCVR_CTRL_DATA_RATE_DRS(0) | XCVR_MISC_XCVR_CTRL_DEMOD_SEL(1) |
+        XCVR_MISC_XCVR_CTRL_LL_CFG_CAPT_DIS(0),
+    /* 52: .chan_map */
+    XCVR_PLL_DIG_CHAN_MAP_BAND_SELECT(0),
+    /* 53: .chan_map_ext */
+#if RF_OSC_26MHZ == 1
+    XCVR_PLL_DIG_CHAN_MAP_EXT_NUM_OFFSET(0x013B13B),
+#else
+    XCVR_PLL_DIG_CHAN_MAP_EXT_NUM_OFFSET(0x0100000),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 54: .data_rate_ovrd_ctrl2 */
+#if RF_OSC_26MHZ == 1
+    XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL2_NUM_OFFSET_CFG1(0x013B13B),
+#else
+    XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL2_NUM_OFFSET_CFG1(0x0100000),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 55: .delay_match */
+    XCVR_PLL_DIG_DELAY_MATCH_HPM_INTEGER_DELAY(0x04) |
+        XCVR_PLL_DIG_DELAY_MATCH_LPM_SDM_DELAY(0x03),
+    /* 56: .hpmcal_ctrl */
+    XCVR_PLL_DIG_HPMCAL_CTRL_HPM_CAL_ARRAY_SIZE(0),
+    /* 57: .hpm_bump */
+    XCVR_PLL_DIG_HPM_BUMP_HPM_VCM_CAL(2) | XCVR_PLL_DIG_HPM_BUMP_HPM_VCM_TX(2),
+    /* 58: .hpm_sdm_res */
+    XCVR_PLL_DIG_HPM_SDM_RES_HPM_COUNT_ADJUST(0x02),
+    /* 59: .acq_filt_0_3 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x03) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x00) |
+        XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x78) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x77),
+#else
+    XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x03) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x01) |
+        XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x76) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x03),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 60: .acq_filt_0_3_drs */
+    XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H0(0x00) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H1(0x00) |
+        XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H2(0x00) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H3(0x00),
+    /* 61: .acq_filt_10_11 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x066) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x0C9),
+#else
+    XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x3FA) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x140),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 62: .acq_filt_10_11_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x05B) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x0E8),
+#else
+    XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x3A8) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x164),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 63: .acq_filt_4_7 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x06) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x1A) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_H6(0x11) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0xE7),
+#else
+    XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x15) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x6D) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_H6(0xE2) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0x36),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 64: .acq_filt_4_7_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x7D) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x06) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0x12) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0xFD),
+#else
+    XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x7D) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x0A) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0xF9) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0xEB),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 65: .acq_filt_8_9 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x1CA) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x1F5),
+#else
+    XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x01F) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x18F),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 66: .acq_filt_8_9_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x1CF) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x1DD),
+#else
+    XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x03E) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x1CC),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 67: .agc_idx11_gain_cfg */
+    XCVR_RX_DIG_AGC_IDX11_GAIN_CFG_MAG_THR_11_DRS_OFS(0x00) |
+        XCVR_RX_DIG_AGC_IDX11_GAIN_CFG_MAG_THR_HI_11_DRS_OFS(0x00),
+    /* 68: .agc_idx11_gain_val */
+    XCVR_RX_DIG_AGC_IDX11_GAIN_VAL_MAG_THR_11(0x000) | XCVR_RX_DIG_AGC_IDX11_GAIN_VAL_MAG_THR_HI_11(0x000),
+    /* 69: .agc_timing0 */
+    XCVR_RX_DIG_AGC_TIMING0_AGC_GAIN_STEP_WAIT(0x10),
+    /* 70: .agc_timing0_drs */
+    XCVR_RX_DIG_AGC_TIMING0_DRS_AGC_GAIN_STEP_WAIT(0x10),
+    /* 71: .agc_timing1 */
+    XCVR_RX_DIG_AGC_TIMING1_AGC_FREEZE_TIMEOUT(0x0A) | XCVR_RX_DIG_AGC_TIMING1_AGC_HOLD_TIMEOUT(0x08),
+    /* 72: .agc_timing1_drs */
+    XCVR_RX_DIG_AGC_TIMING1_DRS_AGC_FREEZE_TIMEOUT(0x0A) | XCVR_RX_DIG_AGC_TIMING1_DRS_AGC_HOLD_TIMEOUT(0x08),
+    /* 73: .agc_timing2 */
+    XCVR_RX_DIG_AGC_TIMING2_AGC_UNFREEZE_FEAT_TIMEOUT(0x000) |
+        XCVR_RX_DIG_AGC_TIMING2_AGC_UNHOLD_FEAT_TIMEOUT(0x000),
+    /* 74: .agc_timing2_drs */
+    XCVR_RX_DIG_AGC_TIMING2_DRS_AGC_UNFREEZE_FEAT_TIMEOUT(0x000) |
+        XCVR_RX_DIG_AGC_TIMING2_DRS_AGC_UNHOLD_FEAT_TIMEOUT(0x000),
+    /* 75: .ctrl0 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(2) | XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x027) |
+        XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(0) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#else
+    XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(3) | XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x020) |
+        XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(0) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 76: .ctrl0_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(1) |
+        XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x03B),
+#else
+    XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(2) |
+        XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x030),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 77: .dcoc_ctrl0 */
+    XCVR_RX_DIG_DCOC_CTRL0_DCOC_DAC_ORDER(1) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFII(0x6) |
+        XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFIIP(1) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFQQ(0x5) |
+        XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFQQP(1),
+    /* 78: .dcoc_ctrl0_drs */
+    XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFII(6) | XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFIIP(1) |
+        XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFQQ(5) | XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFQQP(1),
+    /* 79: .demod_filt_0_1 */
+    XCVR_RX_DIG_DEMOD_FILT_0_1_H0(0x002) | XCVR_RX_DIG_DEMOD_FILT_0_1_H1(0x1F6),
+    /* 80: .demod_filt_0_1_drs */
+    XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H0(0x1FD) | XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H1(0x1FC),
+    /* 81: .demod_filt_2_4 */
+    XCVR_RX_DIG_DEMOD_FILT_2_4_H2(0x3F3) | XCVR_RX_DIG_DEMOD_FILT_2_4_H3(0x08A) |
+        XCVR_RX_DIG_DEMOD_FILT_2_4_H4(0x116),
+    /* 82: .demod_filt_2_4_drs */
+    XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H2(0x020) | XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H3(0x084) |
+        XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H4(0x0C2),
+    /* 83: .rccal_ctrl0 */
+    XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE(2) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE_DRS(1) |
+        XCVR_RX_DIG_RCCAL_CTRL0_CBPF_CCODE_OFFSET(0x00) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE(1) |
+        XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE_DRS(0) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CMPOUT_INV(0) |
+        XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CODE_OFFSET(0x0) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_SMPL_DLY(0),
+    /* 84: .rssi_global_ctrl */
+    XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_CCA1_ED_EN(0),
+    /* 85: .datarate_config_filter_ctrl */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(0) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(0) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(0) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(0) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(0) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(0) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(0),
+#else
+    XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(0) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(0) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(0) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(0) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(0) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(0),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 86: .datarate_config_fsk_ctrl */
+    XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV0(0x0000) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV1(0x0000),
+    /* 87: .datarate_config_gfsk_ctrl */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x09DE),
+#else
+    XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x0804),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 88: .data_padding_ctrl */
+    XCVR_TX_DIG_DATA_PADDING_CTRL_DATA_PADDING_SEL(0) | XCVR_TX_DIG_DATA_PADDING_CTRL_PAD_DLY(0) |
+        XCVR_TX_DIG_DATA_PADDING_CTRL_PAD_DLY_EN(1),
+    /* 89: .data_padding_ctrl_1 */
+    XCVR_TX_DIG_DATA_PADDING_CTRL_1_RAMP_UP_DLY(0x04) | XCVR_TX_DIG_DATA_PADDING_CTRL_1_TX_DATA_FLUSH_DLY(0x04),
+    /* 90: .data_padding_ctrl_2 */
+    XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_MFDEV(0x1800) | XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_PFDEV(0x0800),
+    /* 91: .fsk_ctrl */
+    XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_0(0x1800) | XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_1(0x0800),
+    /* 92: .gfsk_coeff_0_1 */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_0(0x017) | XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_1(0x029),
+#else
+    XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_0(0x001) | XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_1(0x004),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 93: .gfsk_coeff_2_3 */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_2(0x044) | XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_3(0x067),
+#else
+    XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_2(0x00D) | XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_3(0x028),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 94: .gfsk_coeff_4_5 */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_4(0x090) | XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_5(0x0BA),
+#else
+    XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_4(0x063) | XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_5(0x0C0),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 95: .gfsk_coeff_6_7 */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_6(0x0DC) | XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_7(0x0EF),
+#else
+    XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_6(0x12C) | XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_7(0x176),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 96: .gfsk_ctrl */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(0) |
+        XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x4E9),
+#else
+    XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(0) |
+        XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x3FD),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 97: .image_filter_ctrl */
+    XCVR_TX_DIG_IMAGE_FILTER_CTRL_IMAGE_FILTER_OVRD_EN(0),
+    /* 98: .pa_ctrl */
+    XCVR_TX_DIG_PA_CTRL_PA_RAMP_SEL(1),
+    /* 99: .txdig_ctrl */
+    XCVR_TX_DIG_TXDIG_CTRL_DATA_STREAM_SEL(0) | XCVR_TX_DIG_TXDIG_CTRL_MODULATOR_SEL(0) |
+        XCVR_TX_DIG_TXDIG_CTRL_PFC_EN(0),
+};
+
+static const uint8_t xcvr_fsk_h_0p5_1mbps_delta_idx[] = {
+     31,  44,  54,  60,  62,  64,  66,  75,  77,  78,  80,  82,  83,  85,  90,  91,
+     92,  93,  94,  95,  99,
+};
+static const uint32_t xcvr_fsk_h_0p5_1mbps_delta_val[] = {
+    /* 31: .fsk_pd_cfg2 */
+    GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_1M(0xF0) | GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_2M(0xF6),
+    /* 44: .tx_dac_pa */
+    XCVR_ANALOG_TX_DAC_PA_DAC_TRIM_CFBK_DRS(0),
+    /* 54: .data_rate_ovrd_ctrl2 */
+#if RF_OSC_26MHZ == 1
+    XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL2_NUM_OFFSET_CFG1(0x01D89D9),
+#else
+    XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL2_NUM_OFFSET_CFG1(0x0180000),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 60: .acq_filt_0_3_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H0(0x3F) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H1(0x03) |
+        XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H2(0x08) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H3(0x0A),
+#else
+    XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H0(0x02) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H1(0x03) |
+        XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H2(0x7C) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H3(0x75),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 62: .acq_filt_10_11_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x069) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x08E),
+#else
+    XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x065) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x0DD),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 64: .acq_filt_4_7_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x03) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x74) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0xE6) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0xE6),
+#else
+    XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x7E) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x15) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0x19) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0xF0),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 66: .acq_filt_8_9_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x1FF) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x031),
+#else
+    XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x1C5) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x1E7),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 75: .ctrl0 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(2) | XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x03B) |
+        XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(0) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#else
+    XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(3) | XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x030) |
+        XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(0) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 77: .dcoc_ctrl0 */
+    XCVR_RX_DIG_DCOC_CTRL0_DCOC_DAC_ORDER(0) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFII(0x8) |
+        XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFIIP(1) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFQQ(0x2) |
+        XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFQQP(0),
+    /* 78: .dcoc_ctrl0_drs */
+    XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFII(4) | XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFIIP(1) |
+        XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFQQ(1) | XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFQQP(0),
+    /* 80: .demod_filt_0_1_drs */
+    XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H0(0x1FE) | XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H1(0x1F5),
+    /* 82: .demod_filt_2_4_drs */
+    XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H2(0x00B) | XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H3(0x08C) |
+        XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H4(0x0EB),
+    /* 83: .rccal_ctrl0 */
+    XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE(2) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE_DRS(0) |
+        XCVR_RX_DIG_RCCAL_CTRL0_CBPF_CCODE_OFFSET(0x00) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE(0) |
+        XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE_DRS(0) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CMPOUT_INV(0) |
+        XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CODE_OFFSET(0x0) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_SMPL_DLY(0),
+    /* 85: .datarate_config_filter_ctrl */
+    XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(0) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(0) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(0) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(0) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(0) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(0),
+    /* 90: .data_padding_ctrl_2 */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_MFDEV(0x1B14) | XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_PFDEV(0x04EC),
+#else
+    XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_MFDEV(0x1C00) | XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_PFDEV(0x0400),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 91: .fsk_ctrl */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_0(0x1B14) | XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_1(0x04EC),
+#else
+    XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_0(0x1C00) | XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_1(0x0400),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 92: .gfsk_coeff_0_1 */
+    XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_0(0x0000) | XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_1(0x0000),
+    /* 93: .gfsk_coeff_2_3 */
+    XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_2(0x0000) | XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_3(0x0000),
+    /* 94: .gfsk_coeff_4_5 */
+    XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_4(0x0000) | XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_5(0x0000),
+    /* 95: .gfsk_coeff_6_7 */
+    XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_6(0x0000) | XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_7(0x0000),
+    /* 99: .txdig_ctrl */
+    XCVR_TX_DIG_TXDIG_CTRL_DATA_STREAM_SEL(0) | XCVR_TX_DIG_TXDIG_CTRL_MODULATOR_SEL(1) |
+        XCVR_TX_DIG_TXDIG_CTRL_PFC_EN(0),
+};
+const xcvr_mode_delta_config_t xcvr_fsk_h_0p5_1mbps_delta_config = {
+    .base_words = &xcvr_mode_delta_base_words[0],
+    .delta_idx  = &xcvr_fsk_h_0p5_1mbps_delta_idx[0],
+    .delta_val  = &xcvr_fsk_h_0p5_1mbps_delta_val[0],
+    .num_deltas = 21U,
+};
+
+static const uint8_t xcvr_fsk_h_0p5_500kbps_delta_idx[] = {
+      2,  31,  51,  62,  64,  66,  75,  76,  80,  82,  83,  85,  87,  90,  91,  92,
+     93,  94,  95,  99,
+};
+static const uint32_t xcvr_fsk_h_0p5_500kbps_delta_val[] = {
+    /* 2: .alt_data_rate */
+    DR_500KBPS,
+    /* 31: .fsk_pd_cfg2 */
+    GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_1M(0xF0) | GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_2M(0xEB),
+    /* 51: .xcvr_ctrl */
+    XCVR_MISC_XCVR_CTRL_DATA_RATE_DRS(2) | XCVR_MISC_XCVR_CTRL_DEMOD_SEL(1) |
+        XCVR_MISC_XCVR_CTRL_LL_CFG_CAPT_DIS(0),
+    /* 62: .acq_filt_10_11_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x053) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x0E5),
+#else
+    XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x3B2) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x167),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 64: .acq_filt_4_7_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x7C) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x05) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0x16) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0x05),
+#else
+    XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x01) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x0A) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0xE8) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0x00),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 66: .acq_filt_8_9_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x1D2) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x1D5),
+#else
+    XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x048) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x1AC),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 75: .ctrl0 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(2) | XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x03B) |
+        XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(1) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#else
+    XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(3) | XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x030) |
+        XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(1) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 76: .ctrl0_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(3) |
+        XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x027),
+#else
+    XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(4) |
+        XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x020),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 80: .demod_filt_0_1_drs */
+    XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H0(0x001) | XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H1(0x1F5),
+    /* 82: .demod_filt_2_4_drs */
+    XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H2(0x3F6) | XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H3(0x08B) |
+        XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H4(0x110),
+    /* 83: .rccal_ctrl0 */
+    XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE(2) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE_DRS(3) |
+        XCVR_RX_DIG_RCCAL_CTRL0_CBPF_CCODE_OFFSET(0x00) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE(0) |
+        XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE_DRS(1) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CMPOUT_INV(0) |
+        XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CODE_OFFSET(0x0) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_SMPL_DLY(0),
+    /* 85: .datarate_config_filter_ctrl */
+    XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(0) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(0) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(0) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(0) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(0) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(0),
+    /* 87: .datarate_config_gfsk_ctrl */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x0279),
+#else
+    XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x0203),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 90: .data_padding_ctrl_2 */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_MFDEV(0x1D8A) | XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_PFDEV(0x0276),
+#else
+    XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_MFDEV(0x1E00) | XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_PFDEV(0x0200),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 91: .fsk_ctrl */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_0(0x1D8A) | XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_1(0x0276),
+#else
+    XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_0(0x1E00) | XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_1(0x0200),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 92: .gfsk_coeff_0_1 */
+    XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_0(0x0000) | XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_1(0x0000),
+    /* 93: .gfsk_coeff_2_3 */
+    XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_2(0x0000) | XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_3(0x0000),
+    /* 94: .gfsk_coeff_4_5 */
+    XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_4(0x0000) | XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_5(0x0000),
+    /* 95: .gfsk_coeff_6_7 */
+    XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_6(0x0000) | XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_7(0x0000),
+    /* 99: .txdig_ctrl */
+    XCVR_TX_DIG_TXDIG_CTRL_DATA_STREAM_SEL(0) | XCVR_TX_DIG_TXDIG_CTRL_MODULATOR_SEL(1) |
+        XCVR_TX_DIG_TXDIG_CTRL_PFC_EN(0),
+};
+const xcvr_mode_delta_config_t xcvr_fsk_h_0p5_500kbps_delta_config = {
+    .base_words = &xcvr_mode_delta_base_words[0],
+    .delta_idx  = &xcvr_fsk_h_0p5_500kbps_delta_idx[0],
+    .delta_val  = &xcvr_fsk_h_0p5_500kbps_delta_val[0],
+    .num_deltas = 20U,
+};
+
+static const uint8_t xcvr_fsk_h_0p5_250kbps_delta_idx[] = {
+      2,  27,  31,  51,  75,  76,  80,  82,  83,  85,  87,  90,  91,  92,  93,  94,
+     95,  99,
+};
+static const uint32_t xcvr_fsk_h_0p5_250kbps_delta_val[] = {
+    /* 2: .alt_data_rate */
+    DR_250KBPS,
+    /* 27: .fsk_cfg0 */
+    GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_1M(0x11) | GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_2M(0x11) |
+        GEN4PHY_FSK_CFG0_MSK2FSK_SEED(0) | GEN4PHY_FSK_CFG0_MSK_EN(0),
+    /* 31: .fsk_pd_cfg2 */
+    GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_1M(0xB8) | GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_2M(0xEB),
+    /* 51: .xcvr_ctrl */
+    XCVR_MISC_XCVR_CTRL_DATA_RATE_DRS(3) | XCVR_MISC_XCVR_CTRL_DEMOD_SEL(1) |
+        XCVR_MISC_XCVR_CTRL_LL_CFG_CAPT_DIS(0),
+    /* 75: .ctrl0 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(2) | XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x03B) |
+        XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(1) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#else
+    XCVR_RX_DIG_CTRL0_CIC_ORDER(1) | XCVR_RX_DIG_CTRL0_CIC_RATE(3) | XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x030) |
+        XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(1) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 76: .ctrl0_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(4) |
+        XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x027),
+#else
+    XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(1) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(5) |
+        XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x020),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 80: .demod_filt_0_1_drs */
+    XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H0(0x002) | XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H1(0x1F5),
+    /* 82: .demod_filt_2_4_drs */
+    XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H2(0x3F5) | XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H3(0x08B) |
+        XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H4(0x112),
+    /* 83: .rccal_ctrl0 */
+    XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE(2) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE_DRS(4) |
+        XCVR_RX_DIG_RCCAL_CTRL0_CBPF_CCODE_OFFSET(0x00) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE(0) |
+        XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE_DRS(1) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CMPOUT_INV(0) |
+        XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CODE_OFFSET(0x0) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_SMPL_DLY(0),
+    /* 85: .datarate_config_filter_ctrl */
+    XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(0) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(0) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(0) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(0) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(0) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(0),
+    /* 87: .datarate_config_gfsk_ctrl */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x013D),
+#else
+    XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x0101),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 90: .data_padding_ctrl_2 */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_MFDEV(0x1EC5) | XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_PFDEV(0x013B),
+#else
+    XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_MFDEV(0x1F00) | XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_PFDEV(0x0100),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 91: .fsk_ctrl */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_0(0x1EC5) | XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_1(0x013B),
+#else
+    XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_0(0x1F00) | XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_1(0x0100),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 92: .gfsk_coeff_0_1 */
+    XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_0(0x0000) | XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_1(0x0000),
+    /* 93: .gfsk_coeff_2_3 */
+    XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_2(0x0000) | XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_3(0x0000),
+    /* 94: .gfsk_coeff_4_5 */
+    XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_4(0x0000) | XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_5(0x0000),
+    /* 95: .gfsk_coeff_6_7 */
+    XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_6(0x0000) | XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_7(0x0000),
+    /* 99: .txdig_ctrl */
+    XCVR_TX_DIG_TXDIG_CTRL_DATA_STREAM_SEL(0) | XCVR_TX_DIG_TXDIG_CTRL_MODULATOR_SEL(1) |
+        XCVR_TX_DIG_TXDIG_CTRL_PFC_EN(0),
+};
+const xcvr_mode_delta_config_t xcvr_fsk_h_0p5_250kbps_delta_config = {
+    .base_words = &xcvr_mode_delta_base_words[0],
+    .delta_idx  = &xcvr_fsk_h_0p5_250kbps_delta_idx[0],
+    .delta_val  = &xcvr_fsk_h_0p5_250kbps_delta_val[0],
+    .num_deltas = 18U,
+};
+
+static const uint8_t xcvr_gfsk_bt_0p3_h_0p5_1mbps_delta_idx[] = {
+      0,  31,  44,  54,  59,  60,  61,  62,  63,  64,  65,  66,  77,  78,  79,  80,
+     81,  82,  90,  91,  92,  93,  94,  95,  96,
+};
+static const uint32_t xcvr_gfsk_bt_0p3_h_0p5_1mbps_delta_val[] = {
+    /* 0: .radio_mode */
+    GFSK_BT_0p3_h_0p5,
+    /* 31: .fsk_pd_cfg2 */
+    GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_1M(0xF6) | GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_2M(0xF6),
+    /* 44: .tx_dac_pa */
+    XCVR_ANALOG_TX_DAC_PA_DAC_TRIM_CFBK_DRS(0),
+    /* 54: .data_rate_ovrd_ctrl2 */
+#if RF_OSC_26MHZ == 1
+    XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL2_NUM_OFFSET_CFG1(0x01D89D9),
+#else
+    XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL2_NUM_OFFSET_CFG1(0x0180000),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 59: .acq_filt_0_3 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x01) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x05) |
+        XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x08) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x07),
+#else
+    XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x02) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x00) |
+        XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x79) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x79),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 60: .acq_filt_0_3_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H0(0x04) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H1(0x06) |
+        XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H2(0x05) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H3(0x7E),
+#else
+    XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H0(0x3E) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H1(0x3B) |
+        XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H2(0x7C) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H3(0x07),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 61: .acq_filt_10_11 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x068) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x088),
+#else
+    XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x06B) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x0D1),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 62: .acq_filt_10_11_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x068) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x082),
+#else
+    XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x074) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x0C2),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 63: .acq_filt_4_7 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x7E) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x6F) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_H6(0xE5) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0xEA),
+#else
+    XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x07) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x18) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_H6(0x0E) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0xE3),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 64: .acq_filt_4_7_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x73) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x68) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0xE5) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0xF3),
+#else
+    XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x13) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x10) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0xF4) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0xD2),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 65: .acq_filt_8_9 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x006) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x036),
+#else
+    XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x1C8) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x1F7),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 66: .acq_filt_8_9_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x013) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x03E),
+#else
+    XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x1D3) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x010),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 77: .dcoc_ctrl0 */
+    XCVR_RX_DIG_DCOC_CTRL0_DCOC_DAC_ORDER(0) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFII(0x8) |
+        XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFIIP(1) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFQQ(0x2) |
+        XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFQQP(0),
+    /* 78: .dcoc_ctrl0_drs */
+    XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFII(4) | XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFIIP(1) |
+        XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFQQ(1) | XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFQQP(0),
+    /* 79: .demod_filt_0_1 */
+    XCVR_RX_DIG_DEMOD_FILT_0_1_H0(0x1FE) | XCVR_RX_DIG_DEMOD_FILT_0_1_H1(0x005),
+    /* 80: .demod_filt_0_1_drs */
+    XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H0(0x000) | XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H1(0x00B),
+    /* 81: .demod_filt_2_4 */
+    XCVR_RX_DIG_DEMOD_FILT_2_4_H2(0x02E) | XCVR_RX_DIG_DEMOD_FILT_2_4_H3(0x07C) |
+        XCVR_RX_DIG_DEMOD_FILT_2_4_H4(0x0A6),
+    /* 82: .demod_filt_2_4_drs */
+    XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H2(0x035) | XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H3(0x075) |
+        XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H4(0x096),
+    /* 90: .data_padding_ctrl_2 */
+    XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_MFDEV(0x0000) | XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_PFDEV(0x0000),
+    /* 91: .fsk_ctrl */
+    XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_0(0x0000) | XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_1(0x0000),
+    /* 92: .gfsk_coeff_0_1 */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_0(0x048) | XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_1(0x059),
+#else
+    XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_0(0x019) | XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_1(0x02C),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 93: .gfsk_coeff_2_3 */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_2(0x06B) | XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_3(0x07D),
+#else
+    XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_2(0x046) | XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_3(0x069),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 94: .gfsk_coeff_4_5 */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_4(0x08D) | XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_5(0x09A),
+#else
+    XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_4(0x091) | XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_5(0x0B8),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 95: .gfsk_coeff_6_7 */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_6(0x0A4) | XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_7(0x0A9),
+#else
+    XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_6(0x0D8) | XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_7(0x0EA),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 96: .gfsk_ctrl */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(1) |
+        XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x4E9),
+#else
+    XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(1) |
+        XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x3FD),
+#endif /* RF_OSC_26MHZ == 1 */
+};
+const xcvr_mode_delta_config_t xcvr_gfsk_bt_0p3_h_0p5_1mbps_delta_config = {
+    .base_words = &xcvr_mode_delta_base_words[0],
+    .delta_idx  = &xcvr_gfsk_bt_0p3_h_0p5_1mbps_delta_idx[0],
+    .delta_val  = &xcvr_gfsk_bt_0p3_h_0p5_1mbps_delta_val[0],
+    .num_deltas = 25U,
+};
+
+static const uint8_t xcvr_gfsk_bt_0p3_h_0p5_500kbps_delta_idx[] = {
+      0,   2,  51,  59,  61,  62,  63,  64,  65,  66,  75,  76,  79,  80,  81,  82,
+     83,  85,  87,  90,  91,  92,  93,  94,  95,  96,
+};
+static const uint32_t xcvr_gfsk_bt_0p3_h_0p5_500kbps_delta_val[] = {
+    /* 0: .radio_mode */
+    GFSK_BT_0p3_h_0p5,
+    /* 2: .alt_data_rate */
+    DR_500KBPS,
+    /* 51: .xcvr_ctrl */
+    XCVR_MISC_XCVR_CTRL_DATA_RATE_DRS(2) | XCVR_MISC_XCVR_CTRL_DEMOD_SEL(1) |
+        XCVR_MISC_XCVR_CTRL_LL_CFG_CAPT_DIS(0),
+    /* 59: .acq_filt_0_3 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x01) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x05) |
+        XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x08) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x07),
+#else
+    XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x02) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x00) |
+        XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x79) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x79),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 61: .acq_filt_10_11 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x068) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x088),
+#else
+    XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x06B) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x0D1),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 62: .acq_filt_10_11_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x065) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x096),
+#else
+    XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x051) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x0EA),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 63: .acq_filt_4_7 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x7E) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x6F) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_H6(0xE5) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0xEA),
+#else
+    XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x07) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x18) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_H6(0x0E) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0xE3),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 64: .acq_filt_4_7_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x03) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x00) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0xF5) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0xEB),
+#else
+    XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x7E) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x00) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0x0F) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0x07),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 65: .acq_filt_8_9 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x006) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x036),
+#else
+    XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x1C8) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x1F7),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 66: .acq_filt_8_9_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x1F6) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x023),
+#else
+    XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x1D9) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x1D6),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 75: .ctrl0 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(2) | XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x027) |
+        XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(1) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#else
+    XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(3) | XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x020) |
+        XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(1) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 76: .ctrl0_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(3) |
+        XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x027),
+#else
+    XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(4) |
+        XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x020),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 79: .demod_filt_0_1 */
+    XCVR_RX_DIG_DEMOD_FILT_0_1_H0(0x1FE) | XCVR_RX_DIG_DEMOD_FILT_0_1_H1(0x005),
+    /* 80: .demod_filt_0_1_drs */
+    XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H0(0x1FE) | XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H1(0x003),
+    /* 81: .demod_filt_2_4 */
+    XCVR_RX_DIG_DEMOD_FILT_2_4_H2(0x02E) | XCVR_RX_DIG_DEMOD_FILT_2_4_H3(0x07C) |
+        XCVR_RX_DIG_DEMOD_FILT_2_4_H4(0x0A6),
+    /* 82: .demod_filt_2_4_drs */
+    XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H2(0x02D) | XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H3(0x07C) |
+        XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H4(0x0A7),
+    /* 83: .rccal_ctrl0 */
+    XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE(2) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE_DRS(3) |
+        XCVR_RX_DIG_RCCAL_CTRL0_CBPF_CCODE_OFFSET(0x00) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE(1) |
+        XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE_DRS(1) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CMPOUT_INV(0) |
+        XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CODE_OFFSET(0x0) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_SMPL_DLY(0),
+    /* 85: .datarate_config_filter_ctrl */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(2) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(2) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(1),
+#else
+    XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(3) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(2) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(1),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 87: .datarate_config_gfsk_ctrl */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x0279),
+#else
+    XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x0203),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 90: .data_padding_ctrl_2 */
+    XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_MFDEV(0x0000) | XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_PFDEV(0x0000),
+    /* 91: .fsk_ctrl */
+    XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_0(0x0000) | XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_1(0x0000),
+    /* 92: .gfsk_coeff_0_1 */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_0(0x048) | XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_1(0x059),
+#else
+    XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_0(0x019) | XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_1(0x02C),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 93: .gfsk_coeff_2_3 */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_2(0x06B) | XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_3(0x07D),
+#else
+    XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_2(0x046) | XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_3(0x069),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 94: .gfsk_coeff_4_5 */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_4(0x08D) | XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_5(0x09A),
+#else
+    XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_4(0x091) | XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_5(0x0B8),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 95: .gfsk_coeff_6_7 */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_6(0x0A4) | XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_7(0x0A9),
+#else
+    XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_6(0x0D8) | XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_7(0x0EA),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 96: .gfsk_ctrl */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(1) |
+        XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x276),
+#else
+    XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(1) |
+        XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x200),
+#endif /* RF_OSC_26MHZ == 1 */
+};
+const xcvr_mode_delta_config_t xcvr_gfsk_bt_0p3_h_0p5_500kbps_delta_config = {
+    .base_words = &xcvr_mode_delta_base_words[0],
+    .delta_idx  = &xcvr_gfsk_bt_0p3_h_0p5_500kbps_delta_idx[0],
+    .delta_val  = &xcvr_gfsk_bt_0p3_h_0p5_500kbps_delta_val[0],
+    .num_deltas = 26U,
+};
+
+static const uint8_t xcvr_gfsk_bt_0p3_h_0p5_250kbps_delta_idx[] = {
+      0,   2,  51,  59,  61,  62,  63,  64,  65,  66,  75,  76,  79,  80,  81,  82,
+     83,  85,  87,  90,  91,  92,  93,  94,  95,  96,
+};
+static const uint32_t xcvr_gfsk_bt_0p3_h_0p5_250kbps_delta_val[] = {
+    /* 0: .radio_mode */
+    GFSK_BT_0p3_h_0p5,
+    /* 2: .alt_data_rate */
+    DR_250KBPS,
+    /* 51: .xcvr_ctrl */
+    XCVR_MISC_XCVR_CTRL_DATA_RATE_DRS(3) | XCVR_MISC_XCVR_CTRL_DEMOD_SEL(1) |
+        XCVR_MISC_XCVR_CTRL_LL_CFG_CAPT_DIS(0),
+    /* 59: .acq_filt_0_3 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x01) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x05) |
+        XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x08) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x07),
+#else
+    XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x02) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x00) |
+        XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x79) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x79),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 61: .acq_filt_10_11 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x068) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x088),
+#else
+    XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x06B) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x0D1),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 62: .acq_filt_10_11_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x06B) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x0A6),
+#else
+    XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x03B) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x104),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 63: .acq_filt_4_7 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x7E) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x6F) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_H6(0xE5) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0xEA),
+#else
+    XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x07) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x18) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_H6(0x0E) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0xE3),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 64: .acq_filt_4_7_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x03) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x01) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0xF6) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0xE7),
+#else
+    XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x7F) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x7A) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0x07) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0x16),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 65: .acq_filt_8_9 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x006) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x036),
+#else
+    XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x1C8) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x1F7),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 66: .acq_filt_8_9_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x1EF) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x01E),
+#else
+    XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x1E9) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x1C1),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 75: .ctrl0 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(2) | XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x027) |
+        XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(1) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#else
+    XCVR_RX_DIG_CTRL0_CIC_ORDER(1) | XCVR_RX_DIG_CTRL0_CIC_RATE(3) | XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x020) |
+        XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(1) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 76: .ctrl0_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(4) |
+        XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x027),
+#else
+    XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(1) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(5) |
+        XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x020),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 79: .demod_filt_0_1 */
+    XCVR_RX_DIG_DEMOD_FILT_0_1_H0(0x1FE) | XCVR_RX_DIG_DEMOD_FILT_0_1_H1(0x005),
+    /* 80: .demod_filt_0_1_drs */
+    XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H0(0x1FE) | XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H1(0x001),
+    /* 81: .demod_filt_2_4 */
+    XCVR_RX_DIG_DEMOD_FILT_2_4_H2(0x02E) | XCVR_RX_DIG_DEMOD_FILT_2_4_H3(0x07C) |
+        XCVR_RX_DIG_DEMOD_FILT_2_4_H4(0x0A6),
+    /* 82: .demod_filt_2_4_drs */
+    XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H2(0x02A) | XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H3(0x07E) |
+        XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H4(0x0AE),
+    /* 83: .rccal_ctrl0 */
+    XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE(2) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE_DRS(4) |
+        XCVR_RX_DIG_RCCAL_CTRL0_CBPF_CCODE_OFFSET(0x00) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE(1) |
+        XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE_DRS(1) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CMPOUT_INV(0) |
+        XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CODE_OFFSET(0x0) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_SMPL_DLY(0),
+    /* 85: .datarate_config_filter_ctrl */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(3) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(2) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(1),
+#else
+    XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(4) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(3) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(2) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(1),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 87: .datarate_config_gfsk_ctrl */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x013D),
+#else
+    XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x0101),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 90: .data_padding_ctrl_2 */
+    XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_MFDEV(0x0000) | XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_PFDEV(0x0000),
+    /* 91: .fsk_ctrl */
+    XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_0(0x0000) | XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_1(0x0000),
+    /* 92: .gfsk_coeff_0_1 */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_0(0x048) | XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_1(0x059),
+#else
+    XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_0(0x019) | XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_1(0x02C),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 93: .gfsk_coeff_2_3 */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_2(0x06B) | XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_3(0x07D),
+#else
+    XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_2(0x046) | XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_3(0x069),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 94: .gfsk_coeff_4_5 */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_4(0x08D) | XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_5(0x09A),
+#else
+    XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_4(0x091) | XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_5(0x0B8),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 95: .gfsk_coeff_6_7 */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_6(0x0A4) | XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_7(0x0A9),
+#else
+    XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_6(0x0D8) | XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_7(0x0EA),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 96: .gfsk_ctrl */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(1) |
+        XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x13B),
+#else
+    XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(1) |
+        XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x100),
+#endif /* RF_OSC_26MHZ == 1 */
+};
+const xcvr_mode_delta_config_t xcvr_gfsk_bt_0p3_h_0p5_250kbps_delta_config = {
+    .base_words = &xcvr_mode_delta_base_words[0],
+    .delta_idx  = &xcvr_gfsk_bt_0p3_h_0p5_250kbps_delta_idx[0],
+    .delta_val  = &xcvr_gfsk_bt_0p3_h_0p5_250kbps_delta_val[0],
+    .num_deltas = 26U,
+};
+
+static const uint8_t xcvr_gfsk_bt_0p5_h_0p32_1mbps_delta_idx[] = {
+      0,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,  16,  17,
+     18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  28,  31,  42,  44,  54,  59,
+     60,  61,  62,  63,  64,  65,  66,  78,  79,  80,  81,  82,  87,  96,
+};
+static const uint32_t xcvr_gfsk_bt_0p5_h_0p32_1mbps_delta_val[] = {
+    /* 0: .radio_mode */
+    GFSK_BT_0p5_h_0p32,
+    /* 3: .demod_wave[0].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x0D) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x0A) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x08) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x05) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x03),
+    /* 4: .demod_wave[0].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3D) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x3B) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x38) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x36),
+    /* 5: .demod_wave[0].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x33) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x31) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x2E),
+    /* 6: .demod_wave[1].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x0D) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x0A) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x08) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x05) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x03),
+    /* 7: .demod_wave[1].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3D) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x3B) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x38) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x3B),
+    /* 8: .demod_wave[1].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x3D) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x03),
+    /* 9: .demod_wave[2].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x08) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x05) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x03) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3D),
+    /* 10: .demod_wave[2].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x03) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x05) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x08) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x05),
+    /* 11: .demod_wave[2].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x03) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x3D),
+    /* 12: .demod_wave[3].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x08) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x05) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x03) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3D),
+    /* 13: .demod_wave[3].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x03) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x05) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x08) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x0A),
+    /* 14: .demod_wave[3].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x0D) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x0F) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x12),
+    /* 15: .demod_wave[4].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x38) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x3B) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x3D) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x03),
+    /* 16: .demod_wave[4].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3D) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x3B) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x38) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x36),
+    /* 17: .demod_wave[4].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x33) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x31) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x2E),
+    /* 18: .demod_wave[5].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x38) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x3B) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x3D) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x03),
+    /* 19: .demod_wave[5].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3D) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x3B) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x38) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x3B),
+    /* 20: .demod_wave[5].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x3D) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x03),
+    /* 21: .demod_wave[6].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x33) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x36) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x38) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x3B) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3D),
+    /* 22: .demod_wave[6].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x03) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x05) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x08) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x05),
+    /* 23: .demod_wave[6].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x03) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x3D),
+    /* 24: .demod_wave[7].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x33) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x36) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x38) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x3B) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3D),
+    /* 25: .demod_wave[7].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x03) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x05) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x08) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x0A),
+    /* 26: .demod_wave[7].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x0D) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x0F) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x12),
+    /* 27: .fsk_cfg0 */
+    GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_1M(0x14) | GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_2M(0x17) |
+        GEN4PHY_FSK_CFG0_MSK2FSK_SEED(0) | GEN4PHY_FSK_CFG0_MSK_EN(0),
+    /* 28: .fsk_cfg1 */
+    GEN4PHY_FSK_CFG1_OVERH(0x014) | GEN4PHY_FSK_CFG1_OVERH_INV(0x190) | GEN4PHY_FSK_CFG1_SYNCTSCALE(0xF),
+    /* 31: .fsk_pd_cfg2 */
+    GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_1M(0xF6) | GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_2M(0xF6),
+    /* 42: .sm_cfg */
+    GEN4PHY_SM_CFG_AA_TIMEOUT_UNCODED(0x060),
+    /* 44: .tx_dac_pa */
+    XCVR_ANALOG_TX_DAC_PA_DAC_TRIM_CFBK_DRS(0),
+    /* 54: .data_rate_ovrd_ctrl2 */
+#if RF_OSC_26MHZ == 1
+    XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL2_NUM_OFFSET_CFG1(0x01D89D9),
+#else
+    XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL2_NUM_OFFSET_CFG1(0x0180000),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 59: .acq_filt_0_3 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x02) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x06) |
+        XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x09) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x06),
+#else
+    XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x01) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x3D) |
+        XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x78) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x7C),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 60: .acq_filt_0_3_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H0(0x03) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H1(0x04) |
+        XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H2(0x01) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H3(0x7A),
+#else
+    XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H0(0x3E) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H1(0x3D) |
+        XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H2(0x01) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H3(0x0A),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 61: .acq_filt_10_11 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x06B) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x08C),
+#else
+    XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x06F) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x0D2),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 62: .acq_filt_10_11_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x061) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x075),
+#else
+    XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x073) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x0B1),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 63: .acq_filt_4_7 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x7B) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x6B) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_H6(0xE1) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0xE8),
+#else
+    XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x0D) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x19) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_H6(0x07) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0xDB),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 64: .acq_filt_4_7_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x71) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x6B) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0xED) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0xFD),
+#else
+    XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x10) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x05) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0xEB) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0xD6),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 65: .acq_filt_8_9 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x007) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x038),
+#else
+    XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x1C6) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x1FB),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 66: .acq_filt_8_9_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x01B) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x03F),
+#else
+    XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x1E2) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x01E),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 78: .dcoc_ctrl0_drs */
+    XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFII(4) | XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFIIP(1) |
+        XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFQQ(1) | XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFQQP(0),
+    /* 79: .demod_filt_0_1 */
+    XCVR_RX_DIG_DEMOD_FILT_0_1_H0(0x1FE) | XCVR_RX_DIG_DEMOD_FILT_0_1_H1(0x003),
+    /* 80: .demod_filt_0_1_drs */
+    XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H0(0x1FE) | XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H1(0x005),
+    /* 81: .demod_filt_2_4 */
+    XCVR_RX_DIG_DEMOD_FILT_2_4_H2(0x02D) | XCVR_RX_DIG_DEMOD_FILT_2_4_H3(0x07D) |
+        XCVR_RX_DIG_DEMOD_FILT_2_4_H4(0x0A9),
+    /* 82: .demod_filt_2_4_drs */
+    XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H2(0x030) | XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H3(0x07B) |
+        XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H4(0x0A3),
+    /* 87: .datarate_config_gfsk_ctrl */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x0676),
+#else
+    XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x0540),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 96: .gfsk_ctrl */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(0) |
+        XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x032B),
+#else
+    XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(0) |
+        XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x0293),
+#endif /* RF_OSC_26MHZ == 1 */
+};
+const xcvr_mode_delta_config_t xcvr_gfsk_bt_0p5_h_0p32_1mbps_delta_config = {
+    .base_words = &xcvr_mode_delta_base_words[0],
+    .delta_idx  = &xcvr_gfsk_bt_0p5_h_0p32_1mbps_delta_idx[0],
+    .delta_val  = &xcvr_gfsk_bt_0p5_h_0p32_1mbps_delta_val[0],
+    .num_deltas = 46U,
+};
+
+static const uint8_t xcvr_gfsk_bt_0p5_h_0p32_500kbps_delta_idx[] = {
+      0,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,  16,
+     17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  28,  51,  59,  61,  62,
+     63,  64,  65,  66,  75,  76,  79,  80,  81,  82,  83,  85,  87,  96,
+};
+static const uint32_t xcvr_gfsk_bt_0p5_h_0p32_500kbps_delta_val[] = {
+    /* 0: .radio_mode */
+    GFSK_BT_0p5_h_0p32,
+    /* 2: .alt_data_rate */
+    DR_500KBPS,
+    /* 3: .demod_wave[0].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x0D) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x0A) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x08) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x05) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x03),
+    /* 4: .demod_wave[0].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3D) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x3B) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x38) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x36),
+    /* 5: .demod_wave[0].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x33) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x31) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x2E),
+    /* 6: .demod_wave[1].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x0D) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x0A) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x08) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x05) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x03),
+    /* 7: .demod_wave[1].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3D) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x3B) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x38) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x3B),
+    /* 8: .demod_wave[1].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x3D) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x03),
+    /* 9: .demod_wave[2].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x08) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x05) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x03) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3D),
+    /* 10: .demod_wave[2].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x03) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x05) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x08) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x05),
+    /* 11: .demod_wave[2].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x03) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x3D),
+    /* 12: .demod_wave[3].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x08) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x05) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x03) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3D),
+    /* 13: .demod_wave[3].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x03) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x05) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x08) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x0A),
+    /* 14: .demod_wave[3].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x0D) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x0F) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x12),
+    /* 15: .demod_wave[4].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x38) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x3B) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x3D) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x03),
+    /* 16: .demod_wave[4].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3D) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x3B) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x38) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x36),
+    /* 17: .demod_wave[4].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x33) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x31) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x2E),
+    /* 18: .demod_wave[5].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x38) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x3B) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x3D) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x03),
+    /* 19: .demod_wave[5].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3D) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x3B) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x38) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x3B),
+    /* 20: .demod_wave[5].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x3D) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x03),
+    /* 21: .demod_wave[6].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x33) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x36) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x38) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x3B) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3D),
+    /* 22: .demod_wave[6].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x03) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x05) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x08) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x05),
+    /* 23: .demod_wave[6].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x03) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x3D),
+    /* 24: .demod_wave[7].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x33) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x36) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x38) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x3B) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3D),
+    /* 25: .demod_wave[7].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x03) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x05) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x08) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x0A),
+    /* 26: .demod_wave[7].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x0D) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x0F) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x12),
+    /* 27: .fsk_cfg0 */
+    GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_1M(0x14) | GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_2M(0x11) |
+        GEN4PHY_FSK_CFG0_MSK2FSK_SEED(0) | GEN4PHY_FSK_CFG0_MSK_EN(0),
+    /* 28: .fsk_cfg1 */
+    GEN4PHY_FSK_CFG1_OVERH(0x014) | GEN4PHY_FSK_CFG1_OVERH_INV(0x190) | GEN4PHY_FSK_CFG1_SYNCTSCALE(0xF),
+    /* 51: .xcvr_ctrl */
+    XCVR_MISC_XCVR_CTRL_DATA_RATE_DRS(2) | XCVR_MISC_XCVR_CTRL_DEMOD_SEL(1) |
+        XCVR_MISC_XCVR_CTRL_LL_CFG_CAPT_DIS(0),
+    /* 59: .acq_filt_0_3 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x02) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x06) |
+        XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x09) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x06),
+#else
+    XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x01) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x3D) |
+        XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x78) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x7C),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 61: .acq_filt_10_11 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x06B) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x08C),
+#else
+    XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x06F) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x0D2),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 62: .acq_filt_10_11_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x064) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x091),
+#else
+    XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x055) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x0E2),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 63: .acq_filt_4_7 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x7B) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x6B) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_H6(0xE1) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0xE8),
+#else
+    XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x0D) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x19) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_H6(0x07) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0xDB),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 64: .acq_filt_4_7_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x02) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x7F) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0xF4) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0xEC),
+#else
+    XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x7E) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x02) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0x0E) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0x02),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 65: .acq_filt_8_9 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x007) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x038),
+#else
+    XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x1C6) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x1FB),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 66: .acq_filt_8_9_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x1F9) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x026),
+#else
+    XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x1D8) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x1DE),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 75: .ctrl0 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(2) | XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x027) |
+        XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(1) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#else
+    XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(3) | XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x020) |
+        XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(1) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 76: .ctrl0_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(3) |
+        XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x027),
+#else
+    XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(4) |
+        XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x020),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 79: .demod_filt_0_1 */
+    XCVR_RX_DIG_DEMOD_FILT_0_1_H0(0x1FE) | XCVR_RX_DIG_DEMOD_FILT_0_1_H1(0x003),
+    /* 80: .demod_filt_0_1_drs */
+    XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H0(0x1FE) | XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H1(0x005),
+    /* 81: .demod_filt_2_4 */
+    XCVR_RX_DIG_DEMOD_FILT_2_4_H2(0x02D) | XCVR_RX_DIG_DEMOD_FILT_2_4_H3(0x07D) |
+        XCVR_RX_DIG_DEMOD_FILT_2_4_H4(0x0A9),
+    /* 82: .demod_filt_2_4_drs */
+    XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H2(0x02F) | XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H3(0x07B) |
+        XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H4(0x0A4),
+    /* 83: .rccal_ctrl0 */
+    XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE(2) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE_DRS(3) |
+        XCVR_RX_DIG_RCCAL_CTRL0_CBPF_CCODE_OFFSET(0x00) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE(1) |
+        XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE_DRS(1) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CMPOUT_INV(0) |
+        XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CODE_OFFSET(0x0) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_SMPL_DLY(0),
+    /* 85: .datarate_config_filter_ctrl */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(2) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(2) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(1),
+#else
+    XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(3) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(2) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(1),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 87: .datarate_config_gfsk_ctrl */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x0196),
+#else
+    XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x014A),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 96: .gfsk_ctrl */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(0) |
+        XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x032B),
+#else
+    XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(0) |
+        XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x0293),
+#endif /* RF_OSC_26MHZ == 1 */
+};
+const xcvr_mode_delta_config_t xcvr_gfsk_bt_0p5_h_0p32_500kbps_delta_config = {
+    .base_words = &xcvr_mode_delta_base_words[0],
+    .delta_idx  = &xcvr_gfsk_bt_0p5_h_0p32_500kbps_delta_idx[0],
+    .delta_val  = &xcvr_gfsk_bt_0p5_h_0p32_500kbps_delta_val[0],
+    .num_deltas = 46U,
+};
+
+static const uint8_t xcvr_gfsk_bt_0p5_h_0p32_250kbps_delta_idx[] = {
+      0,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,  16,
+     17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  28,  51,  59,  61,  62,
+     63,  64,  65,  66,  75,  76,  79,  80,  81,  82,  83,  85,  87,  96,
+};
+static const uint32_t xcvr_gfsk_bt_0p5_h_0p32_250kbps_delta_val[] = {
+    /* 0: .radio_mode */
+    GFSK_BT_0p5_h_0p32,
+    /* 2: .alt_data_rate */
+    DR_250KBPS,
+    /* 3: .demod_wave[0].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x0D) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x0A) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x08) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x05) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x03),
+    /* 4: .demod_wave[0].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3D) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x3B) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x38) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x36),
+    /* 5: .demod_wave[0].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x33) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x31) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x2E),
+    /* 6: .demod_wave[1].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x0D) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x0A) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x08) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x05) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x03),
+    /* 7: .demod_wave[1].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3D) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x3B) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x38) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x3B),
+    /* 8: .demod_wave[1].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x3D) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x03),
+    /* 9: .demod_wave[2].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x08) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x05) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x03) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3D),
+    /* 10: .demod_wave[2].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x03) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x05) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x08) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x05),
+    /* 11: .demod_wave[2].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x03) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x3D),
+    /* 12: .demod_wave[3].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x08) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x05) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x03) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3D),
+    /* 13: .demod_wave[3].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x03) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x05) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x08) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x0A),
+    /* 14: .demod_wave[3].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x0D) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x0F) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x12),
+    /* 15: .demod_wave[4].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x38) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x3B) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x3D) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x03),
+    /* 16: .demod_wave[4].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3D) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x3B) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x38) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x36),
+    /* 17: .demod_wave[4].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x33) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x31) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x2E),
+    /* 18: .demod_wave[5].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x38) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x3B) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x3D) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x03),
+    /* 19: .demod_wave[5].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3D) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x3B) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x38) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x3B),
+    /* 20: .demod_wave[5].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x3D) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x03),
+    /* 21: .demod_wave[6].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x33) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x36) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x38) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x3B) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3D),
+    /* 22: .demod_wave[6].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x03) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x05) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x08) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x05),
+    /* 23: .demod_wave[6].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x03) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x3D),
+    /* 24: .demod_wave[7].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x33) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x36) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x38) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x3B) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3D),
+    /* 25: .demod_wave[7].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x03) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x05) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x08) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x0A),
+    /* 26: .demod_wave[7].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x0D) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x0F) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x12),
+    /* 27: .fsk_cfg0 */
+    GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_1M(0x14) | GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_2M(0x11) |
+        GEN4PHY_FSK_CFG0_MSK2FSK_SEED(0) | GEN4PHY_FSK_CFG0_MSK_EN(0),
+    /* 28: .fsk_cfg1 */
+    GEN4PHY_FSK_CFG1_OVERH(0x014) | GEN4PHY_FSK_CFG1_OVERH_INV(0x190) | GEN4PHY_FSK_CFG1_SYNCTSCALE(0xF),
+    /* 51: .xcvr_ctrl */
+    XCVR_MISC_XCVR_CTRL_DATA_RATE_DRS(3) | XCVR_MISC_XCVR_CTRL_DEMOD_SEL(1) |
+        XCVR_MISC_XCVR_CTRL_LL_CFG_CAPT_DIS(0),
+    /* 59: .acq_filt_0_3 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x02) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x06) |
+        XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x09) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x06),
+#else
+    XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x01) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x3D) |
+        XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x78) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x7C),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 61: .acq_filt_10_11 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x06B) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x08C),
+#else
+    XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x06F) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x0D2),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 62: .acq_filt_10_11_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x06A) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x09F),
+#else
+    XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x046) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x0F7),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 63: .acq_filt_4_7 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x7B) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x6B) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_H6(0xE1) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0xE8),
+#else
+    XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x0D) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x19) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_H6(0x07) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0xDB),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 64: .acq_filt_4_7_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x02) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x00) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0xF4) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0xE9),
+#else
+    XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x7E) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x7D) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0x0B) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0x0F),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 65: .acq_filt_8_9 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x007) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x038),
+#else
+    XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x1C6) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x1FB),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 66: .acq_filt_8_9_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x1F4) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x023),
+#else
+    XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x1E1) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x1CC),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 75: .ctrl0 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(2) | XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x027) |
+        XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(1) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#else
+    XCVR_RX_DIG_CTRL0_CIC_ORDER(1) | XCVR_RX_DIG_CTRL0_CIC_RATE(3) | XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x020) |
+        XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(1) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 76: .ctrl0_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(4) |
+        XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x027),
+#else
+    XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(1) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(5) |
+        XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x020),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 79: .demod_filt_0_1 */
+    XCVR_RX_DIG_DEMOD_FILT_0_1_H0(0x1FE) | XCVR_RX_DIG_DEMOD_FILT_0_1_H1(0x003),
+    /* 80: .demod_filt_0_1_drs */
+    XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H0(0x1FE) | XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H1(0x005),
+    /* 81: .demod_filt_2_4 */
+    XCVR_RX_DIG_DEMOD_FILT_2_4_H2(0x02D) | XCVR_RX_DIG_DEMOD_FILT_2_4_H3(0x07D) |
+        XCVR_RX_DIG_DEMOD_FILT_2_4_H4(0x0A9),
+    /* 82: .demod_filt_2_4_drs */
+    XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H2(0x02F) | XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H3(0x07B) |
+        XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H4(0x0A4),
+    /* 83: .rccal_ctrl0 */
+    XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE(2) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE_DRS(4) |
+        XCVR_RX_DIG_RCCAL_CTRL0_CBPF_CCODE_OFFSET(0x00) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE(1) |
+        XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE_DRS(1) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CMPOUT_INV(0) |
+        XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CODE_OFFSET(0x0) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_SMPL_DLY(0),
+    /* 85: .datarate_config_filter_ctrl */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(3) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(2) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(1),
+#else
+    XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(4) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(3) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(2) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(1),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 87: .datarate_config_gfsk_ctrl */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x00CB),
+#else
+    XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x00A5),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 96: .gfsk_ctrl */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(0) |
+        XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x032B),
+#else
+    XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(0) |
+        XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x0293),
+#endif /* RF_OSC_26MHZ == 1 */
+};
+const xcvr_mode_delta_config_t xcvr_gfsk_bt_0p5_h_0p32_250kbps_delta_config = {
+    .base_words = &xcvr_mode_delta_base_words[0],
+    .delta_idx  = &xcvr_gfsk_bt_0p5_h_0p32_250kbps_delta_idx[0],
+    .delta_val  = &xcvr_gfsk_bt_0p5_h_0p32_250kbps_delta_val[0],
+    .num_deltas = 46U,
+};
+
+static const uint8_t xcvr_gfsk_bt_0p5_h_0p5_1mbps_delta_idx[] = {
+      0,   3,   4,   5,   6,   7,   9,  10,  12,  13,  14,  15,  16,  17,  18,  19,
+     21,  22,  24,  25,  26,  27,  31,  32,  33,  35,  36,  37,  38,  39,  40,  43,
+     44,  45,  46,  47,  49,  54,  55,  59,  60,  61,  62,  63,  64,  65,  66,  67,
+     68,  69,  70,  71,  72,  73,  74,  77,  78,  79,  80,  81,  82,  87,  90,  91,
+     96,
+};
+static const uint32_t xcvr_gfsk_bt_0p5_h_0p5_1mbps_delta_val[] = {
+    /* 0: .radio_mode */
+    GFSK_BT_0p5_h_0p5,
+    /* 3: .demod_wave[0].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x13) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x0F) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x0B) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x08) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+    /* 4: .demod_wave[0].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x35) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x31),
+    /* 5: .demod_wave[0].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x2D) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x29) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x25),
+    /* 6: .demod_wave[1].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x13) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x0F) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x0B) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x08) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+    /* 7: .demod_wave[1].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x35) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x38),
+    /* 9: .demod_wave[2].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x0B) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x08) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x04) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+    /* 10: .demod_wave[2].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0B) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x08),
+    /* 12: .demod_wave[3].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x0B) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x08) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x04) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+    /* 13: .demod_wave[3].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0B) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x0F),
+    /* 14: .demod_wave[3].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x13) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x17) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x1B),
+    /* 15: .demod_wave[4].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x35) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x38) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x3C) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+    /* 16: .demod_wave[4].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x35) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x31),
+    /* 17: .demod_wave[4].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x2D) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x29) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x25),
+    /* 18: .demod_wave[5].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x35) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x38) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x3C) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+    /* 19: .demod_wave[5].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x35) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x38),
+    /* 21: .demod_wave[6].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x2D) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x31) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x35) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x38) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+    /* 22: .demod_wave[6].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0B) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x08),
+    /* 24: .demod_wave[7].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x2D) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x31) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x35) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x38) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+    /* 25: .demod_wave[7].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0B) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x0F),
+    /* 26: .demod_wave[7].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x13) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x17) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x1B),
+    /* 27: .fsk_cfg0 */
+    GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_1M(0x15) | GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_2M(0x15) |
+        GEN4PHY_FSK_CFG0_MSK2FSK_SEED(0) | GEN4PHY_FSK_CFG0_MSK_EN(0),
+    /* 31: .fsk_pd_cfg2 */
+    GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_1M(0xF6) | GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_2M(0xF6),
+    /* 32: .fsk_pd_ph[0] */
+    GEN4PHY_FSK_PD_PH_REF0(0x03) | GEN4PHY_FSK_PD_PH_REF1(0x05) | GEN4PHY_FSK_PD_PH_REF2(0x03) |
+        GEN4PHY_FSK_PD_PH_REF3(0x00),
+    /* 33: .fsk_pd_ph[1] */
+    GEN4PHY_FSK_PD_PH_REF0(0x3D) | GEN4PHY_FSK_PD_PH_REF1(0x3B) | GEN4PHY_FSK_PD_PH_REF2(0x3D) |
+        GEN4PHY_FSK_PD_PH_REF3(0x00),
+    /* 35: .lr_aa_cfg */
+    GEN4PHY_LR_AA_CFG_AA_COR_THRESH(0x96) | GEN4PHY_LR_AA_CFG_AA_HAM_THRESH(0x06) |
+        GEN4PHY_LR_AA_CFG_AA_LR_CORR_GAIN(0x06) | GEN4PHY_LR_AA_CFG_ACCESS_ADDR_HAM(0x02),
+    /* 36: .lr_pd_cfg */
+    GEN4PHY_LR_PD_CFG_CORR_TH(0x9a) | GEN4PHY_LR_PD_CFG_FREQ_TH(0x01) | GEN4PHY_LR_PD_CFG_NO_PEAKS(1),
+    /* 37: .lr_pd_ph[0] */
+    GEN4PHY_LR_PD_PH_REF0(0x28) | GEN4PHY_LR_PD_PH_REF1(0x30) | GEN4PHY_LR_PD_PH_REF2(0x38) |
+        GEN4PHY_LR_PD_PH_REF3(0x3D),
+    /* 38: .lr_pd_ph[1] */
+    GEN4PHY_LR_PD_PH_REF0(0x38) | GEN4PHY_LR_PD_PH_REF1(0x30) | GEN4PHY_LR_PD_PH_REF2(0x28) |
+        GEN4PHY_LR_PD_PH_REF3(0x20),
+    /* 39: .lr_pd_ph[2] */
+    GEN4PHY_LR_PD_PH_REF0(0x18) | GEN4PHY_LR_PD_PH_REF1(0x10) | GEN4PHY_LR_PD_PH_REF2(0x08) |
+        GEN4PHY_LR_PD_PH_REF3(0x03),
+    /* 40: .lr_pd_ph[3] */
+    GEN4PHY_LR_PD_PH_REF0(0x08) | GEN4PHY_LR_PD_PH_REF1(0x10) | GEN4PHY_LR_PD_PH_REF2(0x18) |
+        GEN4PHY_LR_PD_PH_REF3(0x20),
+    /* 43: .ll_ctrl */
+    RADIO_CTRL_LL_CTRL_ACTIVE_LL(0),
+    /* 44: .tx_dac_pa */
+    XCVR_ANALOG_TX_DAC_PA_DAC_TRIM_CFBK_DRS(0),
+    /* 45: .ips_fo_addr[0] */
+    XCVR_MISC_IPS_FO_ADDR_ADDR(0x32C) | XCVR_MISC_IPS_FO_ADDR_ENTRY_RX(1) | XCVR_MISC_IPS_FO_ADDR_ENTRY_TX(1),
+    /* 46: .ips_fo_addr[1] */
+    XCVR_MISC_IPS_FO_ADDR_ADDR(0x034) | XCVR_MISC_IPS_FO_ADDR_ENTRY_RX(0) | XCVR_MISC_IPS_FO_ADDR_ENTRY_TX(0),
+    /* 47: .ips_fo_drs0_data[0] */
+    XCVR_MISC_IPS_FO_DRS0_DATA_DRS0_DATA(0x20FF0000),
+    /* 49: .ips_fo_drs1_data[0] */
+    XCVR_MISC_IPS_FO_DRS1_DATA_DRS1_DATA(0x10FF0000),
+    /* 54: .data_rate_ovrd_ctrl2 */
+#if RF_OSC_26MHZ == 1
+    XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL2_NUM_OFFSET_CFG1(0x01D89D9),
+#else
+    XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL2_NUM_OFFSET_CFG1(0x0180000),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 55: .delay_match */
+#if RF_OSC_26MHZ == 1
+    XCVR_PLL_DIG_DELAY_MATCH_HPM_INTEGER_DELAY(0x04) |
+        XCVR_PLL_DIG_DELAY_MATCH_LPM_SDM_DELAY(0x02),
+#else
+    XCVR_PLL_DIG_DELAY_MATCH_HPM_INTEGER_DELAY(0x04) |
+        XCVR_PLL_DIG_DELAY_MATCH_LPM_SDM_DELAY(0x03),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 59: .acq_filt_0_3 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x02) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x08) |
+        XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x0B) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x07),
+#else
+    XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x02) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x02) |
+        XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x7A) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x75),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 60: .acq_filt_0_3_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H0(0x01) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H1(0x3D) |
+        XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H2(0x77) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H3(0x72),
+#else
+    XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H0(0x3E) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H1(0x3E) |
+        XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H2(0x02) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H3(0x09),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 61: .acq_filt_10_11 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x067) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x084),
+#else
+    XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x068) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x0DE),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 62: .acq_filt_10_11_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x050) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x05A),
+#else
+    XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x06E) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x0A1),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 63: .acq_filt_4_7 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x7C) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x6C) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_H6(0xE3) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0xEB),
+#else
+    XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x01) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x18) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_H6(0x17) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0xEB),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 64: .acq_filt_4_7_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x71) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x75) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0x00) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0x12),
+#else
+    XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x0B) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x00) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0xEB) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0xDE),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 65: .acq_filt_8_9 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x009) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x037),
+#else
+    XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x1C2) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x1E9),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 66: .acq_filt_8_9_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x028) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x03E),
+#else
+    XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x1F0) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x026),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 67: .agc_idx11_gain_cfg */
+    XCVR_RX_DIG_AGC_IDX11_GAIN_CFG_MAG_THR_11_DRS_OFS(0x02) |
+        XCVR_RX_DIG_AGC_IDX11_GAIN_CFG_MAG_THR_HI_11_DRS_OFS(0x04),
+    /* 68: .agc_idx11_gain_val */
+    XCVR_RX_DIG_AGC_IDX11_GAIN_VAL_MAG_THR_11(0x003) | XCVR_RX_DIG_AGC_IDX11_GAIN_VAL_MAG_THR_HI_11(0x005),
+    /* 69: .agc_timing0 */
+    XCVR_RX_DIG_AGC_TIMING0_AGC_GAIN_STEP_WAIT(0x08),
+    /* 70: .agc_timing0_drs */
+    XCVR_RX_DIG_AGC_TIMING0_DRS_AGC_GAIN_STEP_WAIT(0x08),
+    /* 71: .agc_timing1 */
+    XCVR_RX_DIG_AGC_TIMING1_AGC_FREEZE_TIMEOUT(0x27) | XCVR_RX_DIG_AGC_TIMING1_AGC_HOLD_TIMEOUT(0x05),
+    /* 72: .agc_timing1_drs */
+    XCVR_RX_DIG_AGC_TIMING1_DRS_AGC_FREEZE_TIMEOUT(0x27) | XCVR_RX_DIG_AGC_TIMING1_DRS_AGC_HOLD_TIMEOUT(0x05),
+    /* 73: .agc_timing2 */
+    XCVR_RX_DIG_AGC_TIMING2_AGC_UNFREEZE_FEAT_TIMEOUT(0x07F) |
+        XCVR_RX_DIG_AGC_TIMING2_AGC_UNHOLD_FEAT_TIMEOUT(0x000),
+    /* 74: .agc_timing2_drs */
+    XCVR_RX_DIG_AGC_TIMING2_DRS_AGC_UNFREEZE_FEAT_TIMEOUT(0x07F) |
+        XCVR_RX_DIG_AGC_TIMING2_DRS_AGC_UNHOLD_FEAT_TIMEOUT(0x000),
+    /* 77: .dcoc_ctrl0 */
+    XCVR_RX_DIG_DCOC_CTRL0_DCOC_DAC_ORDER(0) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFII(0x8) |
+        XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFIIP(1) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFQQ(0x2) |
+        XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFQQP(0),
+    /* 78: .dcoc_ctrl0_drs */
+    XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFII(4) | XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFIIP(1) |
+        XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFQQ(1) | XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFQQP(0),
+    /* 79: .demod_filt_0_1 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_DEMOD_FILT_0_1_H0(0x1FD) | XCVR_RX_DIG_DEMOD_FILT_0_1_H1(0x1FC),
+#else
+    XCVR_RX_DIG_DEMOD_FILT_0_1_H0(0x1FD) | XCVR_RX_DIG_DEMOD_FILT_0_1_H1(0x1FE),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 80: .demod_filt_0_1_drs */
+    XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H0(0x1FD) | XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H1(0x1FE),
+    /* 81: .demod_filt_2_4 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_DEMOD_FILT_2_4_H2(0x01F) | XCVR_RX_DIG_DEMOD_FILT_2_4_H3(0x085) |
+        XCVR_RX_DIG_DEMOD_FILT_2_4_H4(0x0C4),
+#else
+    XCVR_RX_DIG_DEMOD_FILT_2_4_H2(0x024) | XCVR_RX_DIG_DEMOD_FILT_2_4_H3(0x083) |
+        XCVR_RX_DIG_DEMOD_FILT_2_4_H4(0x0BC),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 82: .demod_filt_2_4_drs */
+    XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H2(0x023) | XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H3(0x083) |
+        XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H4(0x0BC),
+    /* 87: .datarate_config_gfsk_ctrl */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x0A20),
+#else
+    XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x0830),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 90: .data_padding_ctrl_2 */
+    XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_MFDEV(0x1C00) | XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_PFDEV(0x0400),
+    /* 91: .fsk_ctrl */
+    XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_0(0x1C00) | XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_1(0x0400),
+    /* 96: .gfsk_ctrl */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(0) |
+        XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x4E4),
+#else
+    XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(0) |
+        XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x400),
+#endif /* RF_OSC_26MHZ == 1 */
+};
+const xcvr_mode_delta_config_t xcvr_gfsk_bt_0p5_h_0p5_1mbps_delta_config = {
+    .base_words = &xcvr_mode_delta_base_words[0],
+    .delta_idx  = &xcvr_gfsk_bt_0p5_h_0p5_1mbps_delta_idx[0],
+    .delta_val  = &xcvr_gfsk_bt_0p5_h_0p5_1mbps_delta_val[0],
+    .num_deltas = 65U,
+};
+
+static const uint8_t xcvr_gfsk_bt_0p5_h_0p5_500kbps_delta_idx[] = {
+      0,   2,  27,  32,  33,  51,  59,  61,  62,  63,  64,  65,  66,  70,  72,  74,
+     75,  76,  79,  80,  81,  82,  83,  85,  87,  90,  91,
+};
+static const uint32_t xcvr_gfsk_bt_0p5_h_0p5_500kbps_delta_val[] = {
+    /* 0: .radio_mode */
+    GFSK_BT_0p5_h_0p5,
+    /* 2: .alt_data_rate */
+    DR_500KBPS,
+    /* 27: .fsk_cfg0 */
+    GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_1M(0x15) | GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_2M(0x11) |
+        GEN4PHY_FSK_CFG0_MSK2FSK_SEED(0) | GEN4PHY_FSK_CFG0_MSK_EN(0),
+    /* 32: .fsk_pd_ph[0] */
+    GEN4PHY_FSK_PD_PH_REF0(0x03) | GEN4PHY_FSK_PD_PH_REF1(0x05) | GEN4PHY_FSK_PD_PH_REF2(0x03) |
+        GEN4PHY_FSK_PD_PH_REF3(0x00),
+    /* 33: .fsk_pd_ph[1] */
+    GEN4PHY_FSK_PD_PH_REF0(0x3D) | GEN4PHY_FSK_PD_PH_REF1(0x3B) | GEN4PHY_FSK_PD_PH_REF2(0x3D) |
+        GEN4PHY_FSK_PD_PH_REF3(0x00),
+    /* 51: .xcvr_ctrl */
+    XCVR_MISC_XCVR_CTRL_DATA_RATE_DRS(2) | XCVR_MISC_XCVR_CTRL_DEMOD_SEL(1) |
+        XCVR_MISC_XCVR_CTRL_LL_CFG_CAPT_DIS(0),
+    /* 59: .acq_filt_0_3 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x3E) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x01) |
+        XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x08) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x0D),
+#else
+    XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x02) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x05) |
+        XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x7F) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x73),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 61: .acq_filt_10_11 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x06F) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x09D),
+#else
+    XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x061) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x0EF),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 62: .acq_filt_10_11_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x066) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x0A6),
+#else
+    XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x03F) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x104),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 63: .acq_filt_4_7 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x09) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x77) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_H6(0xE2) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0xDB),
+#else
+    XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x78) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x14) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_H6(0x22) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0xF8),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 64: .acq_filt_4_7_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x04) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x05) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0xFA) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0xE8),
+#else
+    XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x7D) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x7A) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0x0D) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0x17),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 65: .acq_filt_8_9 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x1F4) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x02C),
+#else
+    XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x1BC) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x1D5),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 66: .acq_filt_8_9_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x1E9) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x016),
+#else
+    XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x1E2) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x1BE),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 70: .agc_timing0_drs */
+    XCVR_RX_DIG_AGC_TIMING0_DRS_AGC_GAIN_STEP_WAIT(0x08),
+    /* 72: .agc_timing1_drs */
+    XCVR_RX_DIG_AGC_TIMING1_DRS_AGC_FREEZE_TIMEOUT(0x27) | XCVR_RX_DIG_AGC_TIMING1_DRS_AGC_HOLD_TIMEOUT(0x0A),
+    /* 74: .agc_timing2_drs */
+    XCVR_RX_DIG_AGC_TIMING2_DRS_AGC_UNFREEZE_FEAT_TIMEOUT(0x07F) |
+        XCVR_RX_DIG_AGC_TIMING2_DRS_AGC_UNHOLD_FEAT_TIMEOUT(0x000),
+    /* 75: .ctrl0 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(2) | XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x027) |
+        XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(1) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#else
+    XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(3) | XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x020) |
+        XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(1) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 76: .ctrl0_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(3) |
+        XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x027),
+#else
+    XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(4) |
+        XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x020),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 79: .demod_filt_0_1 */
+    XCVR_RX_DIG_DEMOD_FILT_0_1_H0(0x1FD) | XCVR_RX_DIG_DEMOD_FILT_0_1_H1(0x1FE),
+    /* 80: .demod_filt_0_1_drs */
+    XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H0(0x1FD) | XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H1(0x1FE),
+    /* 81: .demod_filt_2_4 */
+    XCVR_RX_DIG_DEMOD_FILT_2_4_H2(0x024) | XCVR_RX_DIG_DEMOD_FILT_2_4_H3(0x082) |
+        XCVR_RX_DIG_DEMOD_FILT_2_4_H4(0x0BA),
+    /* 82: .demod_filt_2_4_drs */
+    XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H2(0x022) | XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H3(0x083) |
+        XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H4(0x0BE),
+    /* 83: .rccal_ctrl0 */
+    XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE(2) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE_DRS(3) |
+        XCVR_RX_DIG_RCCAL_CTRL0_CBPF_CCODE_OFFSET(0x00) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE(1) |
+        XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE_DRS(1) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CMPOUT_INV(0) |
+        XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CODE_OFFSET(0x0) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_SMPL_DLY(0),
+    /* 85: .datarate_config_filter_ctrl */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(2) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(2) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(1),
+#else
+    XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(3) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(2) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(1),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 87: .datarate_config_gfsk_ctrl */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x0279),
+#else
+    XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x0203),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 90: .data_padding_ctrl_2 */
+    XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_MFDEV(0x1C00) | XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_PFDEV(0x0400),
+    /* 91: .fsk_ctrl */
+    XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_0(0x1C00) | XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_1(0x0400),
+};
+const xcvr_mode_delta_config_t xcvr_gfsk_bt_0p5_h_0p5_500kbps_delta_config = {
+    .base_words = &xcvr_mode_delta_base_words[0],
+    .delta_idx  = &xcvr_gfsk_bt_0p5_h_0p5_500kbps_delta_idx[0],
+    .delta_val  = &xcvr_gfsk_bt_0p5_h_0p5_500kbps_delta_val[0],
+    .num_deltas = 27U,
+};
+
+static const uint8_t xcvr_gfsk_bt_0p5_h_0p5_250kbps_delta_idx[] = {
+      0,   2,  27,  31,  32,  33,  51,  59,  61,  62,  63,  64,  65,  66,  70,  72,
+     74,  75,  76,  79,  81,  83,  85,  87,  90,  91,
+};
+static const uint32_t xcvr_gfsk_bt_0p5_h_0p5_250kbps_delta_val[] = {
+    /* 0: .radio_mode */
+    GFSK_BT_0p5_h_0p5,
+    /* 2: .alt_data_rate */
+    DR_250KBPS,
+    /* 27: .fsk_cfg0 */
+    GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_1M(0x15) | GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_2M(0x11) |
+        GEN4PHY_FSK_CFG0_MSK2FSK_SEED(0) | GEN4PHY_FSK_CFG0_MSK_EN(0),
+    /* 31: .fsk_pd_cfg2 */
+    GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_1M(0xEB) | GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_2M(0xEB),
+    /* 32: .fsk_pd_ph[0] */
+    GEN4PHY_FSK_PD_PH_REF0(0x03) | GEN4PHY_FSK_PD_PH_REF1(0x05) | GEN4PHY_FSK_PD_PH_REF2(0x03) |
+        GEN4PHY_FSK_PD_PH_REF3(0x00),
+    /* 33: .fsk_pd_ph[1] */
+    GEN4PHY_FSK_PD_PH_REF0(0x3D) | GEN4PHY_FSK_PD_PH_REF1(0x3B) | GEN4PHY_FSK_PD_PH_REF2(0x3D) |
+        GEN4PHY_FSK_PD_PH_REF3(0x00),
+    /* 51: .xcvr_ctrl */
+    XCVR_MISC_XCVR_CTRL_DATA_RATE_DRS(3) | XCVR_MISC_XCVR_CTRL_DEMOD_SEL(1) |
+        XCVR_MISC_XCVR_CTRL_LL_CFG_CAPT_DIS(0),
+    /* 59: .acq_filt_0_3 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x3E) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x01) |
+        XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x08) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x0D),
+#else
+    XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x02) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x05) |
+        XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x7F) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x73),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 61: .acq_filt_10_11 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x06F) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x09D),
+#else
+    XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x061) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x0EF),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 62: .acq_filt_10_11_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x06B) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x0B3),
+#else
+    XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x024) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x119),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 63: .acq_filt_4_7 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x09) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x77) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_H6(0xE2) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0xDB),
+#else
+    XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x78) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x14) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_H6(0x22) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0xF8),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 64: .acq_filt_4_7_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x03) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x05) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0xFB) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0xE6),
+#else
+    XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x01) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x79) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0xFE) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0x1C),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 65: .acq_filt_8_9 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x1F4) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x02C),
+#else
+    XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x1BC) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x1D5),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 66: .acq_filt_8_9_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x1E5) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x013),
+#else
+    XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x1FC) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x1B3),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 70: .agc_timing0_drs */
+    XCVR_RX_DIG_AGC_TIMING0_DRS_AGC_GAIN_STEP_WAIT(0x08),
+    /* 72: .agc_timing1_drs */
+    XCVR_RX_DIG_AGC_TIMING1_DRS_AGC_FREEZE_TIMEOUT(0x27) | XCVR_RX_DIG_AGC_TIMING1_DRS_AGC_HOLD_TIMEOUT(0x14),
+    /* 74: .agc_timing2_drs */
+    XCVR_RX_DIG_AGC_TIMING2_DRS_AGC_UNFREEZE_FEAT_TIMEOUT(0x07F) |
+        XCVR_RX_DIG_AGC_TIMING2_DRS_AGC_UNHOLD_FEAT_TIMEOUT(0x000),
+    /* 75: .ctrl0 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(2) | XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x027) |
+        XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(1) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#else
+    XCVR_RX_DIG_CTRL0_CIC_ORDER(1) | XCVR_RX_DIG_CTRL0_CIC_RATE(3) | XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x020) |
+        XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(1) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 76: .ctrl0_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(4) |
+        XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x027),
+#else
+    XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(1) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(5) |
+        XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x020),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 79: .demod_filt_0_1 */
+    XCVR_RX_DIG_DEMOD_FILT_0_1_H0(0x1FD) | XCVR_RX_DIG_DEMOD_FILT_0_1_H1(0x1FE),
+    /* 81: .demod_filt_2_4 */
+    XCVR_RX_DIG_DEMOD_FILT_2_4_H2(0x024) | XCVR_RX_DIG_DEMOD_FILT_2_4_H3(0x082) |
+        XCVR_RX_DIG_DEMOD_FILT_2_4_H4(0x0BA),
+    /* 83: .rccal_ctrl0 */
+    XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE(2) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE_DRS(4) |
+        XCVR_RX_DIG_RCCAL_CTRL0_CBPF_CCODE_OFFSET(0x00) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE(1) |
+        XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE_DRS(1) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CMPOUT_INV(0) |
+        XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CODE_OFFSET(0x0) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_SMPL_DLY(0),
+    /* 85: .datarate_config_filter_ctrl */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(3) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(2) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(1),
+#else
+    XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(4) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(3) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(2) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(1),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 87: .datarate_config_gfsk_ctrl */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x013D),
+#else
+    XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x0101),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 90: .data_padding_ctrl_2 */
+    XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_MFDEV(0x1C00) | XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_PFDEV(0x0400),
+    /* 91: .fsk_ctrl */
+    XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_0(0x1C00) | XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_1(0x0400),
+};
+const xcvr_mode_delta_config_t xcvr_gfsk_bt_0p5_h_0p5_250kbps_delta_config = {
+    .base_words = &xcvr_mode_delta_base_words[0],
+    .delta_idx  = &xcvr_gfsk_bt_0p5_h_0p5_250kbps_delta_idx[0],
+    .delta_val  = &xcvr_gfsk_bt_0p5_h_0p5_250kbps_delta_val[0],
+    .num_deltas = 26U,
+};
+
+static const uint8_t xcvr_gfsk_bt_0p5_h_0p7_1mbps_delta_idx[] = {
+      0,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,  16,  17,
+     18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  28,  31,  32,  33,  44,  54,
+     59,  60,  61,  62,  63,  64,  65,  66,  77,  78,  79,  80,  81,  82,  87,  96,
+};
+static const uint32_t xcvr_gfsk_bt_0p5_h_0p7_1mbps_delta_val[] = {
+    /* 0: .radio_mode */
+    GFSK_BT_0p5_h_0p7,
+    /* 3: .demod_wave[0].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x1C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x16) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x11) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x0B) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x06),
+    /* 4: .demod_wave[0].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3A) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x35) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x2F) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x2A),
+    /* 5: .demod_wave[0].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x24) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x1E) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x19),
+    /* 6: .demod_wave[1].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x1C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x16) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x11) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x0B) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x06),
+    /* 7: .demod_wave[1].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3A) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x35) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x2F) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x35),
+    /* 8: .demod_wave[1].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x3A) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x06),
+    /* 9: .demod_wave[2].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x11) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x0B) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x06) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3A),
+    /* 10: .demod_wave[2].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x06) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x0B) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x11) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x0B),
+    /* 11: .demod_wave[2].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x06) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x3A),
+    /* 12: .demod_wave[3].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x11) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x0B) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x06) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3A),
+    /* 13: .demod_wave[3].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x06) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x0B) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x11) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x16),
+    /* 14: .demod_wave[3].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x1C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x22) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x27),
+    /* 15: .demod_wave[4].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x2F) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x35) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x3A) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x06),
+    /* 16: .demod_wave[4].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3A) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x35) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x2F) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x2A),
+    /* 17: .demod_wave[4].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x24) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x1E) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x19),
+    /* 18: .demod_wave[5].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x2F) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x35) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x3A) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x06),
+    /* 19: .demod_wave[5].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3A) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x35) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x2F) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x35),
+    /* 20: .demod_wave[5].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x3A) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x06),
+    /* 21: .demod_wave[6].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x24) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x2A) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x2F) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x35) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3A),
+    /* 22: .demod_wave[6].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x06) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x0B) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x11) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x0B),
+    /* 23: .demod_wave[6].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x06) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x3A),
+    /* 24: .demod_wave[7].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x24) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x2A) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x2F) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x35) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3A),
+    /* 25: .demod_wave[7].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x06) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x0B) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x11) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x16),
+    /* 26: .demod_wave[7].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x1C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x22) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x27),
+    /* 27: .fsk_cfg0 */
+    GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_1M(0x16) | GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_2M(0x18) |
+        GEN4PHY_FSK_CFG0_MSK2FSK_SEED(0) | GEN4PHY_FSK_CFG0_MSK_EN(0),
+    /* 28: .fsk_cfg1 */
+    GEN4PHY_FSK_CFG1_OVERH(0x02D) | GEN4PHY_FSK_CFG1_OVERH_INV(0x0B7) | GEN4PHY_FSK_CFG1_SYNCTSCALE(0xF),
+    /* 31: .fsk_pd_cfg2 */
+    GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_1M(0xD7) | GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_2M(0xF6),
+    /* 32: .fsk_pd_ph[0] */
+    GEN4PHY_FSK_PD_PH_REF0(0x05) | GEN4PHY_FSK_PD_PH_REF1(0x07) | GEN4PHY_FSK_PD_PH_REF2(0x05) |
+        GEN4PHY_FSK_PD_PH_REF3(0x00),
+    /* 33: .fsk_pd_ph[1] */
+    GEN4PHY_FSK_PD_PH_REF0(0x3B) | GEN4PHY_FSK_PD_PH_REF1(0x39) | GEN4PHY_FSK_PD_PH_REF2(0x3B) |
+        GEN4PHY_FSK_PD_PH_REF3(0x00),
+    /* 44: .tx_dac_pa */
+    XCVR_ANALOG_TX_DAC_PA_DAC_TRIM_CFBK_DRS(0),
+    /* 54: .data_rate_ovrd_ctrl2 */
+#if RF_OSC_26MHZ == 1
+    XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL2_NUM_OFFSET_CFG1(0x01D89D9),
+#else
+    XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL2_NUM_OFFSET_CFG1(0x0180000),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 59: .acq_filt_0_3 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x3E) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x00) |
+        XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x06) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x0C),
+#else
+    XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x00) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x05) |
+        XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x03) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x76),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 60: .acq_filt_0_3_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H0(0x01) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H1(0x05) |
+        XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H2(0x09) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H3(0x07),
+#else
+    XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H0(0x02) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H1(0x3E) |
+        XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H2(0x78) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H3(0x7A),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 61: .acq_filt_10_11 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x06B) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x099),
+#else
+    XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x05A) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x0EF),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 62: .acq_filt_10_11_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x06B) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x08C),
+#else
+    XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x06E) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x0D4),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 63: .acq_filt_4_7 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x0A) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x7C) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_H6(0xE7) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0xDE),
+#else
+    XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x72) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x0B) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_H6(0x23) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0x04),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 64: .acq_filt_4_7_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x7D) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x6D) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0xE2) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0xE7),
+#else
+    XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x0B) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x1A) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0x0C) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0xDF),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 65: .acq_filt_8_9 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x1F4) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x029),
+#else
+    XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x1C4) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x1D0),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 66: .acq_filt_8_9_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x005) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x037),
+#else
+    XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x1C5) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x1F7),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 77: .dcoc_ctrl0 */
+    XCVR_RX_DIG_DCOC_CTRL0_DCOC_DAC_ORDER(0) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFII(0x8) |
+        XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFIIP(1) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFQQ(0x2) |
+        XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFQQP(0),
+    /* 78: .dcoc_ctrl0_drs */
+    XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFII(4) | XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFIIP(1) |
+        XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFQQ(1) | XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFQQP(0),
+    /* 79: .demod_filt_0_1 */
+    XCVR_RX_DIG_DEMOD_FILT_0_1_H0(0x1FD) | XCVR_RX_DIG_DEMOD_FILT_0_1_H1(0x1FB),
+    /* 80: .demod_filt_0_1_drs */
+    XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H0(0x1FD) | XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H1(0x1FB),
+    /* 81: .demod_filt_2_4 */
+    XCVR_RX_DIG_DEMOD_FILT_2_4_H2(0x01E) | XCVR_RX_DIG_DEMOD_FILT_2_4_H3(0x085) |
+        XCVR_RX_DIG_DEMOD_FILT_2_4_H4(0x0C6),
+    /* 82: .demod_filt_2_4_drs */
+    XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H2(0x01F) | XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H3(0x086) |
+        XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H4(0x0C6),
+    /* 87: .datarate_config_gfsk_ctrl */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x0DF8),
+#else
+    XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x0B60),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 96: .gfsk_ctrl */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(0) |
+        XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x06EF),
+#else
+    XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(0) |
+        XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x05A2),
+#endif /* RF_OSC_26MHZ == 1 */
+};
+const xcvr_mode_delta_config_t xcvr_gfsk_bt_0p5_h_0p7_1mbps_delta_config = {
+    .base_words = &xcvr_mode_delta_base_words[0],
+    .delta_idx  = &xcvr_gfsk_bt_0p5_h_0p7_1mbps_delta_idx[0],
+    .delta_val  = &xcvr_gfsk_bt_0p5_h_0p7_1mbps_delta_val[0],
+    .num_deltas = 48U,
+};
+
+static const uint8_t xcvr_gfsk_bt_0p5_h_0p7_500kbps_delta_idx[] = {
+      0,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,  16,
+     17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  28,  31,  32,  33,  51,
+     59,  61,  62,  63,  64,  65,  66,  75,  76,  79,  81,  83,  85,  87,  96,
+};
+static const uint32_t xcvr_gfsk_bt_0p5_h_0p7_500kbps_delta_val[] = {
+    /* 0: .radio_mode */
+    GFSK_BT_0p5_h_0p7,
+    /* 2: .alt_data_rate */
+    DR_500KBPS,
+    /* 3: .demod_wave[0].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x1C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x16) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x11) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x0B) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x06),
+    /* 4: .demod_wave[0].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3A) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x35) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x2F) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x2A),
+    /* 5: .demod_wave[0].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x24) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x1E) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x19),
+    /* 6: .demod_wave[1].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x1C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x16) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x11) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x0B) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x06),
+    /* 7: .demod_wave[1].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3A) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x35) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x2F) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x35),
+    /* 8: .demod_wave[1].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x3A) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x06),
+    /* 9: .demod_wave[2].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x11) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x0B) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x06) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3A),
+    /* 10: .demod_wave[2].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x06) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x0B) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x11) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x0B),
+    /* 11: .demod_wave[2].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x06) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x3A),
+    /* 12: .demod_wave[3].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x11) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x0B) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x06) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3A),
+    /* 13: .demod_wave[3].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x06) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x0B) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x11) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x16),
+    /* 14: .demod_wave[3].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x1C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x22) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x27),
+    /* 15: .demod_wave[4].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x2F) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x35) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x3A) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x06),
+    /* 16: .demod_wave[4].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3A) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x35) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x2F) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x2A),
+    /* 17: .demod_wave[4].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x24) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x1E) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x19),
+    /* 18: .demod_wave[5].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x2F) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x35) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x3A) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x06),
+    /* 19: .demod_wave[5].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3A) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x35) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x2F) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x35),
+    /* 20: .demod_wave[5].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x3A) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x06),
+    /* 21: .demod_wave[6].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x24) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x2A) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x2F) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x35) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3A),
+    /* 22: .demod_wave[6].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x06) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x0B) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x11) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x0B),
+    /* 23: .demod_wave[6].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x06) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x3A),
+    /* 24: .demod_wave[7].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x24) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x2A) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x2F) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x35) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3A),
+    /* 25: .demod_wave[7].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x06) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x0B) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x11) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x16),
+    /* 26: .demod_wave[7].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x1C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x22) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x27),
+    /* 27: .fsk_cfg0 */
+    GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_1M(0x10) | GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_2M(0x11) |
+        GEN4PHY_FSK_CFG0_MSK2FSK_SEED(0) | GEN4PHY_FSK_CFG0_MSK_EN(0),
+    /* 28: .fsk_cfg1 */
+    GEN4PHY_FSK_CFG1_OVERH(0x02D) | GEN4PHY_FSK_CFG1_OVERH_INV(0x0B7) | GEN4PHY_FSK_CFG1_SYNCTSCALE(0xF),
+    /* 31: .fsk_pd_cfg2 */
+    GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_1M(0xD7) | GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_2M(0xEB),
+    /* 32: .fsk_pd_ph[0] */
+    GEN4PHY_FSK_PD_PH_REF0(0x05) | GEN4PHY_FSK_PD_PH_REF1(0x07) | GEN4PHY_FSK_PD_PH_REF2(0x05) |
+        GEN4PHY_FSK_PD_PH_REF3(0x00),
+    /* 33: .fsk_pd_ph[1] */
+    GEN4PHY_FSK_PD_PH_REF0(0x3B) | GEN4PHY_FSK_PD_PH_REF1(0x39) | GEN4PHY_FSK_PD_PH_REF2(0x3B) |
+        GEN4PHY_FSK_PD_PH_REF3(0x00),
+    /* 51: .xcvr_ctrl */
+    XCVR_MISC_XCVR_CTRL_DATA_RATE_DRS(2) | XCVR_MISC_XCVR_CTRL_DEMOD_SEL(1) |
+        XCVR_MISC_XCVR_CTRL_LL_CFG_CAPT_DIS(0),
+    /* 59: .acq_filt_0_3 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x3E) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x00) |
+        XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x06) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x0C),
+#else
+    XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x00) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x05) |
+        XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x03) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x76),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 61: .acq_filt_10_11 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x06B) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x099),
+#else
+    XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x05A) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x0EF),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 62: .acq_filt_10_11_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x066) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x0A9),
+#else
+    XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x039) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x10B),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 63: .acq_filt_4_7 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x0A) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x7C) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_H6(0xE7) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0xDE),
+#else
+    XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x72) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x0B) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_H6(0x23) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0x04),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 64: .acq_filt_4_7_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x04) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x06) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0xFB) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0xE8),
+#else
+    XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x7E) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x79) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0x0B) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0x1B),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 65: .acq_filt_8_9 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x1F4) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x029),
+#else
+    XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x1C4) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x1D0),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 66: .acq_filt_8_9_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x1E7) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x014),
+#else
+    XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x1E6) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x1B9),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 75: .ctrl0 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(2) | XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x027) |
+        XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(1) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#else
+    XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(3) | XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x020) |
+        XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(1) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 76: .ctrl0_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(3) |
+        XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x027),
+#else
+    XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(4) |
+        XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x020),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 79: .demod_filt_0_1 */
+    XCVR_RX_DIG_DEMOD_FILT_0_1_H0(0x1FD) | XCVR_RX_DIG_DEMOD_FILT_0_1_H1(0x1FB),
+    /* 81: .demod_filt_2_4 */
+    XCVR_RX_DIG_DEMOD_FILT_2_4_H2(0x01E) | XCVR_RX_DIG_DEMOD_FILT_2_4_H3(0x085) |
+        XCVR_RX_DIG_DEMOD_FILT_2_4_H4(0x0C6),
+    /* 83: .rccal_ctrl0 */
+    XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE(2) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE_DRS(3) |
+        XCVR_RX_DIG_RCCAL_CTRL0_CBPF_CCODE_OFFSET(0x00) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE(1) |
+        XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE_DRS(1) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CMPOUT_INV(0) |
+        XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CODE_OFFSET(0x0) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_SMPL_DLY(0),
+    /* 85: .datarate_config_filter_ctrl */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(2) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(2) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(1),
+#else
+    XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(3) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(2) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(1),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 87: .datarate_config_gfsk_ctrl */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x37E),
+#else
+    XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x2D8),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 96: .gfsk_ctrl */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(0) |
+        XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x06EF),
+#else
+    XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(0) |
+        XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x05A2),
+#endif /* RF_OSC_26MHZ == 1 */
+};
+const xcvr_mode_delta_config_t xcvr_gfsk_bt_0p5_h_0p7_500kbps_delta_config = {
+    .base_words = &xcvr_mode_delta_base_words[0],
+    .delta_idx  = &xcvr_gfsk_bt_0p5_h_0p7_500kbps_delta_idx[0],
+    .delta_val  = &xcvr_gfsk_bt_0p5_h_0p7_500kbps_delta_val[0],
+    .num_deltas = 47U,
+};
+
+static const uint8_t xcvr_gfsk_bt_0p5_h_0p7_250kbps_delta_idx[] = {
+      0,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,  16,
+     17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  28,  31,  32,  33,  51,
+     59,  61,  62,  63,  64,  65,  66,  75,  76,  79,  81,  83,  85,  87,  96,
+};
+static const uint32_t xcvr_gfsk_bt_0p5_h_0p7_250kbps_delta_val[] = {
+    /* 0: .radio_mode */
+    GFSK_BT_0p5_h_0p7,
+    /* 2: .alt_data_rate */
+    DR_250KBPS,
+    /* 3: .demod_wave[0].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x1C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x16) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x11) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x0B) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x06),
+    /* 4: .demod_wave[0].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3A) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x35) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x2F) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x2A),
+    /* 5: .demod_wave[0].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x24) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x1E) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x19),
+    /* 6: .demod_wave[1].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x1C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x16) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x11) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x0B) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x06),
+    /* 7: .demod_wave[1].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3A) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x35) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x2F) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x35),
+    /* 8: .demod_wave[1].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x3A) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x06),
+    /* 9: .demod_wave[2].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x11) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x0B) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x06) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3A),
+    /* 10: .demod_wave[2].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x06) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x0B) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x11) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x0B),
+    /* 11: .demod_wave[2].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x06) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x3A),
+    /* 12: .demod_wave[3].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x11) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x0B) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x06) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3A),
+    /* 13: .demod_wave[3].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x06) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x0B) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x11) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x16),
+    /* 14: .demod_wave[3].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x1C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x22) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x27),
+    /* 15: .demod_wave[4].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x2F) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x35) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x3A) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x06),
+    /* 16: .demod_wave[4].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3A) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x35) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x2F) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x2A),
+    /* 17: .demod_wave[4].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x24) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x1E) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x19),
+    /* 18: .demod_wave[5].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x2F) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x35) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x3A) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x06),
+    /* 19: .demod_wave[5].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3A) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x35) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x2F) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x35),
+    /* 20: .demod_wave[5].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x3A) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x06),
+    /* 21: .demod_wave[6].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x24) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x2A) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x2F) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x35) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3A),
+    /* 22: .demod_wave[6].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x06) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x0B) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x11) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x0B),
+    /* 23: .demod_wave[6].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x06) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x3A),
+    /* 24: .demod_wave[7].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x24) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x2A) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x2F) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x35) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3A),
+    /* 25: .demod_wave[7].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x06) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x0B) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x11) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x16),
+    /* 26: .demod_wave[7].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x1C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x22) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x27),
+    /* 27: .fsk_cfg0 */
+    GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_1M(0x10) | GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_2M(0x11) |
+        GEN4PHY_FSK_CFG0_MSK2FSK_SEED(0) | GEN4PHY_FSK_CFG0_MSK_EN(0),
+    /* 28: .fsk_cfg1 */
+    GEN4PHY_FSK_CFG1_OVERH(0x02D) | GEN4PHY_FSK_CFG1_OVERH_INV(0x0B7) | GEN4PHY_FSK_CFG1_SYNCTSCALE(0xF),
+    /* 31: .fsk_pd_cfg2 */
+    GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_1M(0xD7) | GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_2M(0xEB),
+    /* 32: .fsk_pd_ph[0] */
+    GEN4PHY_FSK_PD_PH_REF0(0x05) | GEN4PHY_FSK_PD_PH_REF1(0x07) | GEN4PHY_FSK_PD_PH_REF2(0x05) |
+        GEN4PHY_FSK_PD_PH_REF3(0x00),
+    /* 33: .fsk_pd_ph[1] */
+    GEN4PHY_FSK_PD_PH_REF0(0x3B) | GEN4PHY_FSK_PD_PH_REF1(0x39) | GEN4PHY_FSK_PD_PH_REF2(0x3B) |
+        GEN4PHY_FSK_PD_PH_REF3(0x00),
+    /* 51: .xcvr_ctrl */
+    XCVR_MISC_XCVR_CTRL_DATA_RATE_DRS(3) | XCVR_MISC_XCVR_CTRL_DEMOD_SEL(1) |
+        XCVR_MISC_XCVR_CTRL_LL_CFG_CAPT_DIS(0),
+    /* 59: .acq_filt_0_3 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x3E) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x00) |
+        XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x06) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x0C),
+#else
+    XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x00) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x05) |
+        XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x03) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x76),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 61: .acq_filt_10_11 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x06B) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x099),
+#else
+    XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x05A) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x0EF),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 62: .acq_filt_10_11_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x06B) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x0B3),
+#else
+    XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x024) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x119),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 63: .acq_filt_4_7 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x0A) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x7C) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_H6(0xE7) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0xDE),
+#else
+    XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x72) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x0B) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_H6(0x23) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0x04),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 64: .acq_filt_4_7_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x03) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x05) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0xFB) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0xE6),
+#else
+    XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x01) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x79) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0xFE) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0x1C),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 65: .acq_filt_8_9 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x1F4) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x029),
+#else
+    XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x1C4) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x1D0),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 66: .acq_filt_8_9_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x1E5) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x013),
+#else
+    XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x1FC) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x1B3),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 75: .ctrl0 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(2) | XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x027) |
+        XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(1) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#else
+    XCVR_RX_DIG_CTRL0_CIC_ORDER(1) | XCVR_RX_DIG_CTRL0_CIC_RATE(3) | XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x020) |
+        XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(1) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 76: .ctrl0_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(4) |
+        XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x027),
+#else
+    XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(1) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(5) |
+        XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x020),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 79: .demod_filt_0_1 */
+    XCVR_RX_DIG_DEMOD_FILT_0_1_H0(0x1FD) | XCVR_RX_DIG_DEMOD_FILT_0_1_H1(0x1FB),
+    /* 81: .demod_filt_2_4 */
+    XCVR_RX_DIG_DEMOD_FILT_2_4_H2(0x01E) | XCVR_RX_DIG_DEMOD_FILT_2_4_H3(0x085) |
+        XCVR_RX_DIG_DEMOD_FILT_2_4_H4(0x0C6),
+    /* 83: .rccal_ctrl0 */
+    XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE(2) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE_DRS(4) |
+        XCVR_RX_DIG_RCCAL_CTRL0_CBPF_CCODE_OFFSET(0x00) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE(1) |
+        XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE_DRS(1) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CMPOUT_INV(0) |
+        XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CODE_OFFSET(0x0) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_SMPL_DLY(0),
+    /* 85: .datarate_config_filter_ctrl */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(3) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(2) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(1),
+#else
+    XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(4) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(3) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(2) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(1),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 87: .datarate_config_gfsk_ctrl */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x1BF),
+#else
+    XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x16D),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 96: .gfsk_ctrl */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(0) |
+        XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x06EF),
+#else
+    XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(0) |
+        XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x05A2),
+#endif /* RF_OSC_26MHZ == 1 */
+};
+const xcvr_mode_delta_config_t xcvr_gfsk_bt_0p5_h_0p7_250kbps_delta_config = {
+    .base_words = &xcvr_mode_delta_base_words[0],
+    .delta_idx  = &xcvr_gfsk_bt_0p5_h_0p7_250kbps_delta_idx[0],
+    .delta_val  = &xcvr_gfsk_bt_0p5_h_0p7_250kbps_delta_val[0],
+    .num_deltas = 47U,
+};
+
+static const uint8_t xcvr_gfsk_bt_0p5_h_1p0_1mbps_delta_idx[] = {
+      0,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,  16,  17,
+     18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  28,  31,  32,  33,  44,  54,
+     62,  64,  66,  75,  77,  78,  80,  82,  83,  87,  96,
+};
+static const uint32_t xcvr_gfsk_bt_0p5_h_1p0_1mbps_delta_val[] = {
+    /* 0: .radio_mode */
+    GFSK_BT_0p5_h_1p0,
+    /* 3: .demod_wave[0].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x28) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x20) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x18) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x10) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x08),
+    /* 4: .demod_wave[0].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x38) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x30) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x28) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x20),
+    /* 5: .demod_wave[0].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x18) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x10) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x08),
+    /* 6: .demod_wave[1].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x28) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x20) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x18) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x10) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x08),
+    /* 7: .demod_wave[1].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x38) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x30) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x28) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x30),
+    /* 8: .demod_wave[1].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x38) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x08),
+    /* 9: .demod_wave[2].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x18) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x10) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x08) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x38),
+    /* 10: .demod_wave[2].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x08) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x10) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x18) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x10),
+    /* 11: .demod_wave[2].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x08) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x38),
+    /* 12: .demod_wave[3].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x18) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x10) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x08) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x38),
+    /* 13: .demod_wave[3].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x08) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x10) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x18) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x20),
+    /* 14: .demod_wave[3].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x28) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x30) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x38),
+    /* 15: .demod_wave[4].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x28) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x30) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x38) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x08),
+    /* 16: .demod_wave[4].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x38) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x30) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x28) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x20),
+    /* 17: .demod_wave[4].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x18) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x10) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x08),
+    /* 18: .demod_wave[5].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x28) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x30) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x38) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x08),
+    /* 19: .demod_wave[5].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x38) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x30) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x28) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x30),
+    /* 20: .demod_wave[5].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x38) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x08),
+    /* 21: .demod_wave[6].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x18) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x20) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x28) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x30) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x38),
+    /* 22: .demod_wave[6].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x08) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x10) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x18) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x10),
+    /* 23: .demod_wave[6].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x08) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x38),
+    /* 24: .demod_wave[7].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x18) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x20) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x28) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x30) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x38),
+    /* 25: .demod_wave[7].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x08) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x10) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x18) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x20),
+    /* 26: .demod_wave[7].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x28) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x30) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x38),
+    /* 27: .fsk_cfg0 */
+    GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_1M(0x14) | GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_2M(0x11) |
+        GEN4PHY_FSK_CFG0_MSK2FSK_SEED(0) | GEN4PHY_FSK_CFG0_MSK_EN(0),
+    /* 28: .fsk_cfg1 */
+    GEN4PHY_FSK_CFG1_OVERH(0x040) | GEN4PHY_FSK_CFG1_OVERH_INV(0x080) | GEN4PHY_FSK_CFG1_SYNCTSCALE(0xF),
+    /* 31: .fsk_pd_cfg2 */
+    GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_1M(0xD7) | GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_2M(0xF6),
+    /* 32: .fsk_pd_ph[0] */
+    GEN4PHY_FSK_PD_PH_REF0(0x07) | GEN4PHY_FSK_PD_PH_REF1(0x0A) | GEN4PHY_FSK_PD_PH_REF2(0x07) |
+        GEN4PHY_FSK_PD_PH_REF3(0x00),
+    /* 33: .fsk_pd_ph[1] */
+    GEN4PHY_FSK_PD_PH_REF0(0x39) | GEN4PHY_FSK_PD_PH_REF1(0x36) | GEN4PHY_FSK_PD_PH_REF2(0x39) |
+        GEN4PHY_FSK_PD_PH_REF3(0x00),
+    /* 44: .tx_dac_pa */
+    XCVR_ANALOG_TX_DAC_PA_DAC_TRIM_CFBK_DRS(0),
+    /* 54: .data_rate_ovrd_ctrl2 */
+#if RF_OSC_26MHZ == 1
+    XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL2_NUM_OFFSET_CFG1(0x01D89D9),
+#else
+    XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL2_NUM_OFFSET_CFG1(0x0180000),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 62: .acq_filt_10_11_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x054) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x0E4),
+#else
+    XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x3B2) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x167),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 64: .acq_filt_4_7_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x7C) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x05) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0x15) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0x04),
+#else
+    XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x01) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x0A) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0xE8) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0x00),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 66: .acq_filt_8_9_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x1D2) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x1D7),
+#else
+    XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x048) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x1AC),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 75: .ctrl0 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(2) | XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x03B) |
+        XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(0) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#else
+    XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(3) | XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x030) |
+        XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(0) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 77: .dcoc_ctrl0 */
+    XCVR_RX_DIG_DCOC_CTRL0_DCOC_DAC_ORDER(0) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFII(0x8) |
+        XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFIIP(1) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFQQ(0x2) |
+        XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFQQP(0),
+    /* 78: .dcoc_ctrl0_drs */
+    XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFII(4) | XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFIIP(1) |
+        XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFQQ(1) | XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFQQP(0),
+    /* 80: .demod_filt_0_1_drs */
+    XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H0(0x001) | XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H1(0x1F5),
+    /* 82: .demod_filt_2_4_drs */
+    XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H2(0x3F6) | XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H3(0x08B) |
+        XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H4(0x110),
+    /* 83: .rccal_ctrl0 */
+    XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE(2) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE_DRS(0) |
+        XCVR_RX_DIG_RCCAL_CTRL0_CBPF_CCODE_OFFSET(0x00) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE(0) |
+        XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE_DRS(0) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CMPOUT_INV(0) |
+        XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CODE_OFFSET(0x0) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_SMPL_DLY(0),
+    /* 87: .datarate_config_gfsk_ctrl */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x13D0),
+#else
+    XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x1018),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 96: .gfsk_ctrl */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(0) |
+        XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x09E8),
+#else
+    XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(0) |
+        XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x080C),
+#endif /* RF_OSC_26MHZ == 1 */
+};
+const xcvr_mode_delta_config_t xcvr_gfsk_bt_0p5_h_1p0_1mbps_delta_config = {
+    .base_words = &xcvr_mode_delta_base_words[0],
+    .delta_idx  = &xcvr_gfsk_bt_0p5_h_1p0_1mbps_delta_idx[0],
+    .delta_val  = &xcvr_gfsk_bt_0p5_h_1p0_1mbps_delta_val[0],
+    .num_deltas = 43U,
+};
+
+static const uint8_t xcvr_gfsk_bt_0p5_h_1p0_500kbps_delta_idx[] = {
+      0,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,  16,
+     17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  28,  31,  32,  33,  51,
+     62,  64,  66,  75,  76,  80,  82,  83,  85,  87,  96,
+};
+static const uint32_t xcvr_gfsk_bt_0p5_h_1p0_500kbps_delta_val[] = {
+    /* 0: .radio_mode */
+    GFSK_BT_0p5_h_1p0,
+    /* 2: .alt_data_rate */
+    DR_500KBPS,
+    /* 3: .demod_wave[0].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x28) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x20) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x18) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x10) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x08),
+    /* 4: .demod_wave[0].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x38) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x30) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x28) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x20),
+    /* 5: .demod_wave[0].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x18) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x10) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x08),
+    /* 6: .demod_wave[1].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x28) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x20) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x18) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x10) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x08),
+    /* 7: .demod_wave[1].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x38) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x30) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x28) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x30),
+    /* 8: .demod_wave[1].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x38) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x08),
+    /* 9: .demod_wave[2].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x18) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x10) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x08) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x38),
+    /* 10: .demod_wave[2].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x08) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x10) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x18) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x10),
+    /* 11: .demod_wave[2].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x08) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x38),
+    /* 12: .demod_wave[3].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x18) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x10) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x08) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x38),
+    /* 13: .demod_wave[3].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x08) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x10) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x18) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x20),
+    /* 14: .demod_wave[3].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x28) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x30) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x38),
+    /* 15: .demod_wave[4].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x28) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x30) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x38) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x08),
+    /* 16: .demod_wave[4].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x38) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x30) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x28) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x20),
+    /* 17: .demod_wave[4].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x18) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x10) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x08),
+    /* 18: .demod_wave[5].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x28) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x30) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x38) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x08),
+    /* 19: .demod_wave[5].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x38) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x30) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x28) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x30),
+    /* 20: .demod_wave[5].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x38) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x08),
+    /* 21: .demod_wave[6].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x18) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x20) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x28) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x30) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x38),
+    /* 22: .demod_wave[6].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x08) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x10) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x18) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x10),
+    /* 23: .demod_wave[6].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x08) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x38),
+    /* 24: .demod_wave[7].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x18) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x20) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x28) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x30) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x38),
+    /* 25: .demod_wave[7].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x08) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x10) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x18) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x20),
+    /* 26: .demod_wave[7].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x28) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x30) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x38),
+    /* 27: .fsk_cfg0 */
+    GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_1M(0x13) | GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_2M(0x11) |
+        GEN4PHY_FSK_CFG0_MSK2FSK_SEED(0) | GEN4PHY_FSK_CFG0_MSK_EN(0),
+    /* 28: .fsk_cfg1 */
+    GEN4PHY_FSK_CFG1_OVERH(0x040) | GEN4PHY_FSK_CFG1_OVERH_INV(0x080) | GEN4PHY_FSK_CFG1_SYNCTSCALE(0xF),
+    /* 31: .fsk_pd_cfg2 */
+    GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_1M(0xD7) | GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_2M(0xEB),
+    /* 32: .fsk_pd_ph[0] */
+    GEN4PHY_FSK_PD_PH_REF0(0x07) | GEN4PHY_FSK_PD_PH_REF1(0x0A) | GEN4PHY_FSK_PD_PH_REF2(0x07) |
+        GEN4PHY_FSK_PD_PH_REF3(0x00),
+    /* 33: .fsk_pd_ph[1] */
+    GEN4PHY_FSK_PD_PH_REF0(0x39) | GEN4PHY_FSK_PD_PH_REF1(0x36) | GEN4PHY_FSK_PD_PH_REF2(0x39) |
+        GEN4PHY_FSK_PD_PH_REF3(0x00),
+    /* 51: .xcvr_ctrl */
+    XCVR_MISC_XCVR_CTRL_DATA_RATE_DRS(2) | XCVR_MISC_XCVR_CTRL_DEMOD_SEL(1) |
+        XCVR_MISC_XCVR_CTRL_LL_CFG_CAPT_DIS(0),
+    /* 62: .acq_filt_10_11_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x054) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x0E4),
+#else
+    XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x3B2) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x167),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 64: .acq_filt_4_7_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x7C) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x05) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0x15) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0x04),
+#else
+    XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x01) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x0A) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0xE8) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0x00),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 66: .acq_filt_8_9_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x1D2) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x1D7),
+#else
+    XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x048) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x1AC),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 75: .ctrl0 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(2) | XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x03B) |
+        XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(1) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#else
+    XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(3) | XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x030) |
+        XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(1) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 76: .ctrl0_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(3) |
+        XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x027),
+#else
+    XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(4) |
+        XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x020),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 80: .demod_filt_0_1_drs */
+    XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H0(0x001) | XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H1(0x1F5),
+    /* 82: .demod_filt_2_4_drs */
+    XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H2(0x3F6) | XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H3(0x08B) |
+        XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H4(0x110),
+    /* 83: .rccal_ctrl0 */
+    XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE(2) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE_DRS(3) |
+        XCVR_RX_DIG_RCCAL_CTRL0_CBPF_CCODE_OFFSET(0x00) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE(0) |
+        XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE_DRS(1) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CMPOUT_INV(0) |
+        XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CODE_OFFSET(0x0) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_SMPL_DLY(0),
+    /* 85: .datarate_config_filter_ctrl */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(2) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(2) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(1),
+#else
+    XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(3) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(2) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(1),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 87: .datarate_config_gfsk_ctrl */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x04F2),
+#else
+    XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x0406),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 96: .gfsk_ctrl */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(0) |
+        XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x09E8),
+#else
+    XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(0) |
+        XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x080C),
+#endif /* RF_OSC_26MHZ == 1 */
+};
+const xcvr_mode_delta_config_t xcvr_gfsk_bt_0p5_h_1p0_500kbps_delta_config = {
+    .base_words = &xcvr_mode_delta_base_words[0],
+    .delta_idx  = &xcvr_gfsk_bt_0p5_h_1p0_500kbps_delta_idx[0],
+    .delta_val  = &xcvr_gfsk_bt_0p5_h_1p0_500kbps_delta_val[0],
+    .num_deltas = 43U,
+};
+
+static const uint8_t xcvr_gfsk_bt_0p5_h_1p0_250kbps_delta_idx[] = {
+      0,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,  16,
+     17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  28,  31,  32,  33,  51,
+     75,  76,  80,  82,  83,  85,  87,  96,
+};
+static const uint32_t xcvr_gfsk_bt_0p5_h_1p0_250kbps_delta_val[] = {
+    /* 0: .radio_mode */
+    GFSK_BT_0p5_h_1p0,
+    /* 2: .alt_data_rate */
+    DR_250KBPS,
+    /* 3: .demod_wave[0].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x28) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x20) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x18) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x10) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x08),
+    /* 4: .demod_wave[0].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x38) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x30) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x28) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x20),
+    /* 5: .demod_wave[0].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x18) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x10) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x08),
+    /* 6: .demod_wave[1].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x28) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x20) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x18) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x10) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x08),
+    /* 7: .demod_wave[1].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x38) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x30) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x28) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x30),
+    /* 8: .demod_wave[1].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x38) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x08),
+    /* 9: .demod_wave[2].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x18) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x10) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x08) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x38),
+    /* 10: .demod_wave[2].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x08) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x10) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x18) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x10),
+    /* 11: .demod_wave[2].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x08) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x38),
+    /* 12: .demod_wave[3].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x18) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x10) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x08) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x38),
+    /* 13: .demod_wave[3].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x08) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x10) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x18) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x20),
+    /* 14: .demod_wave[3].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x28) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x30) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x38),
+    /* 15: .demod_wave[4].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x28) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x30) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x38) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x08),
+    /* 16: .demod_wave[4].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x38) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x30) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x28) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x20),
+    /* 17: .demod_wave[4].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x18) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x10) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x08),
+    /* 18: .demod_wave[5].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x28) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x30) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x38) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x08),
+    /* 19: .demod_wave[5].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x38) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x30) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x28) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x30),
+    /* 20: .demod_wave[5].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x38) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x08),
+    /* 21: .demod_wave[6].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x18) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x20) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x28) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x30) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x38),
+    /* 22: .demod_wave[6].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x08) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x10) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x18) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x10),
+    /* 23: .demod_wave[6].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x08) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x38),
+    /* 24: .demod_wave[7].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x18) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x20) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x28) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x30) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x38),
+    /* 25: .demod_wave[7].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x08) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x10) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x18) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x20),
+    /* 26: .demod_wave[7].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x28) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x30) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x38),
+    /* 27: .fsk_cfg0 */
+    GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_1M(0x13) | GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_2M(0x11) |
+        GEN4PHY_FSK_CFG0_MSK2FSK_SEED(0) | GEN4PHY_FSK_CFG0_MSK_EN(0),
+    /* 28: .fsk_cfg1 */
+    GEN4PHY_FSK_CFG1_OVERH(0x040) | GEN4PHY_FSK_CFG1_OVERH_INV(0x080) | GEN4PHY_FSK_CFG1_SYNCTSCALE(0xF),
+    /* 31: .fsk_pd_cfg2 */
+    GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_1M(0xD7) | GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_2M(0xEB),
+    /* 32: .fsk_pd_ph[0] */
+    GEN4PHY_FSK_PD_PH_REF0(0x07) | GEN4PHY_FSK_PD_PH_REF1(0x0A) | GEN4PHY_FSK_PD_PH_REF2(0x07) |
+        GEN4PHY_FSK_PD_PH_REF3(0x00),
+    /* 33: .fsk_pd_ph[1] */
+    GEN4PHY_FSK_PD_PH_REF0(0x39) | GEN4PHY_FSK_PD_PH_REF1(0x36) | GEN4PHY_FSK_PD_PH_REF2(0x39) |
+        GEN4PHY_FSK_PD_PH_REF3(0x00),
+    /* 51: .xcvr_ctrl */
+    XCVR_MISC_XCVR_CTRL_DATA_RATE_DRS(3) | XCVR_MISC_XCVR_CTRL_DEMOD_SEL(1) |
+        XCVR_MISC_XCVR_CTRL_LL_CFG_CAPT_DIS(0),
+    /* 75: .ctrl0 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(2) | XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x03B) |
+        XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(1) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#else
+    XCVR_RX_DIG_CTRL0_CIC_ORDER(1) | XCVR_RX_DIG_CTRL0_CIC_RATE(3) | XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x030) |
+        XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(1) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 76: .ctrl0_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(4) |
+        XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x027),
+#else
+    XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(1) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(5) |
+        XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x020),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 80: .demod_filt_0_1_drs */
+    XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H0(0x002) | XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H1(0x1F5),
+    /* 82: .demod_filt_2_4_drs */
+    XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H2(0x3F5) | XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H3(0x08B) |
+        XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H4(0x112),
+    /* 83: .rccal_ctrl0 */
+    XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE(2) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE_DRS(4) |
+        XCVR_RX_DIG_RCCAL_CTRL0_CBPF_CCODE_OFFSET(0x00) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE(0) |
+        XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE_DRS(1) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CMPOUT_INV(0) |
+        XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CODE_OFFSET(0x0) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_SMPL_DLY(0),
+    /* 85: .datarate_config_filter_ctrl */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(3) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(2) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(1),
+#else
+    XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(4) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(3) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(2) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(1),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 87: .datarate_config_gfsk_ctrl */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x279),
+#else
+    XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x203),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 96: .gfsk_ctrl */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(0) |
+        XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x09E8),
+#else
+    XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(0) |
+        XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x080C),
+#endif /* RF_OSC_26MHZ == 1 */
+};
+const xcvr_mode_delta_config_t xcvr_gfsk_bt_0p5_h_1p0_250kbps_delta_config = {
+    .base_words = &xcvr_mode_delta_base_words[0],
+    .delta_idx  = &xcvr_gfsk_bt_0p5_h_1p0_250kbps_delta_idx[0],
+    .delta_val  = &xcvr_gfsk_bt_0p5_h_1p0_250kbps_delta_val[0],
+    .num_deltas = 40U,
+};
+
+static const uint8_t xcvr_gfsk_bt_0p7_h_0p5_1mbps_delta_idx[] = {
+      0,  31,  32,  33,  44,  54,  59,  60,  61,  62,  63,  64,  65,  66,  77,  78,
+     79,  80,  81,  82,  90,  91,  92,  93,  94,  95,  96,
+};
+static const uint32_t xcvr_gfsk_bt_0p7_h_0p5_1mbps_delta_val[] = {
+    /* 0: .radio_mode */
+    GFSK_BT_0p7_h_0p5,
+    /* 31: .fsk_pd_cfg2 */
+    GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_1M(0xEB) | GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_2M(0xF6),
+    /* 32: .fsk_pd_ph[0] */
+    GEN4PHY_FSK_PD_PH_REF0(0x04) | GEN4PHY_FSK_PD_PH_REF1(0x06) | GEN4PHY_FSK_PD_PH_REF2(0x04) |
+        GEN4PHY_FSK_PD_PH_REF3(0x00),
+    /* 33: .fsk_pd_ph[1] */
+    GEN4PHY_FSK_PD_PH_REF0(0x3C) | GEN4PHY_FSK_PD_PH_REF1(0x3A) | GEN4PHY_FSK_PD_PH_REF2(0x3C) |
+        GEN4PHY_FSK_PD_PH_REF3(0x00),
+    /* 44: .tx_dac_pa */
+    XCVR_ANALOG_TX_DAC_PA_DAC_TRIM_CFBK_DRS(0),
+    /* 54: .data_rate_ovrd_ctrl2 */
+#if RF_OSC_26MHZ == 1
+    XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL2_NUM_OFFSET_CFG1(0x01D89D9),
+#else
+    XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL2_NUM_OFFSET_CFG1(0x0180000),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 59: .acq_filt_0_3 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x3F) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x01) |
+        XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x07) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x0B),
+#else
+    XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x01) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x04) |
+        XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x7F) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x75),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 60: .acq_filt_0_3_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H0(0x01) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H1(0x05) |
+        XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H2(0x09) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H3(0x08),
+#else
+    XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H0(0x02) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H1(0x00) |
+        XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H2(0x78) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H3(0x77),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 61: .acq_filt_10_11 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x069) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x090),
+#else
+    XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x061) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x0E1),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 62: .acq_filt_10_11_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x06C) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x090),
+#else
+    XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x06C) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x0DB),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 63: .acq_filt_4_7 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x06) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x77) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_H6(0xE7) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0xE4),
+#else
+    XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x79) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x12) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_H6(0x1C) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0xF7),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 64: .acq_filt_4_7_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x7E) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x6E) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0xE1) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0xE5),
+#else
+    XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x08) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x1B) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0x11) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0xE2),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 65: .acq_filt_8_9 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x1FC) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x02E),
+#else
+    XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x1C6) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x1E1),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 66: .acq_filt_8_9_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x002) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x035),
+#else
+    XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x1C0) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x1EF),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 77: .dcoc_ctrl0 */
+    XCVR_RX_DIG_DCOC_CTRL0_DCOC_DAC_ORDER(0) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFII(0x8) |
+        XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFIIP(1) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFQQ(0x2) |
+        XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFQQP(0),
+    /* 78: .dcoc_ctrl0_drs */
+    XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFII(4) | XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFIIP(1) |
+        XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFQQ(1) | XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFQQP(0),
+    /* 79: .demod_filt_0_1 */
+    XCVR_RX_DIG_DEMOD_FILT_0_1_H0(0x1FD) | XCVR_RX_DIG_DEMOD_FILT_0_1_H1(0x1FD),
+    /* 80: .demod_filt_0_1_drs */
+    XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H0(0x1FD) | XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H1(0x1FB),
+    /* 81: .demod_filt_2_4 */
+    XCVR_RX_DIG_DEMOD_FILT_2_4_H2(0x021) | XCVR_RX_DIG_DEMOD_FILT_2_4_H3(0x084) |
+        XCVR_RX_DIG_DEMOD_FILT_2_4_H4(0x0C0),
+    /* 82: .demod_filt_2_4_drs */
+    XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H2(0x01D) | XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H3(0x086) |
+        XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H4(0x0C8),
+    /* 90: .data_padding_ctrl_2 */
+    XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_MFDEV(0x0000) | XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_PFDEV(0x0000),
+    /* 91: .fsk_ctrl */
+    XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_0(0x0000) | XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_1(0x0000),
+    /* 92: .gfsk_coeff_0_1 */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_0(0x003) | XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_1(0x00A),
+#else
+    XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_0(0x000) | XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_1(0x000),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 93: .gfsk_coeff_2_3 */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_2(0x01B) | XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_3(0x03E),
+#else
+    XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_2(0x001) | XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_3(0x007),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 94: .gfsk_coeff_4_5 */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_4(0x079) | XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_5(0x0C6),
+#else
+    XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_4(0x025) | XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_5(0x08A),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 95: .gfsk_coeff_6_7 */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_6(0x114) | XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_7(0x145),
+#else
+    XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_6(0x14A) | XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_7(0x1FE),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 96: .gfsk_ctrl */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(1) |
+        XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x4E9),
+#else
+    XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(1) |
+        XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x3FD),
+#endif /* RF_OSC_26MHZ == 1 */
+};
+const xcvr_mode_delta_config_t xcvr_gfsk_bt_0p7_h_0p5_1mbps_delta_config = {
+    .base_words = &xcvr_mode_delta_base_words[0],
+    .delta_idx  = &xcvr_gfsk_bt_0p7_h_0p5_1mbps_delta_idx[0],
+    .delta_val  = &xcvr_gfsk_bt_0p7_h_0p5_1mbps_delta_val[0],
+    .num_deltas = 27U,
+};
+
+static const uint8_t xcvr_gfsk_bt_0p7_h_0p5_500kbps_delta_idx[] = {
+      0,   2,  31,  32,  33,  51,  59,  61,  62,  63,  64,  65,  66,  75,  76,  79,
+     81,  83,  85,  87,  90,  91,  92,  93,  94,  95,  96,
+};
+static const uint32_t xcvr_gfsk_bt_0p7_h_0p5_500kbps_delta_val[] = {
+    /* 0: .radio_mode */
+    GFSK_BT_0p7_h_0p5,
+    /* 2: .alt_data_rate */
+    DR_500KBPS,
+    /* 31: .fsk_pd_cfg2 */
+    GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_1M(0xEB) | GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_2M(0xEB),
+    /* 32: .fsk_pd_ph[0] */
+    GEN4PHY_FSK_PD_PH_REF0(0x04) | GEN4PHY_FSK_PD_PH_REF1(0x06) | GEN4PHY_FSK_PD_PH_REF2(0x04) |
+        GEN4PHY_FSK_PD_PH_REF3(0x00),
+    /* 33: .fsk_pd_ph[1] */
+    GEN4PHY_FSK_PD_PH_REF0(0x3C) | GEN4PHY_FSK_PD_PH_REF1(0x3A) | GEN4PHY_FSK_PD_PH_REF2(0x3C) |
+        GEN4PHY_FSK_PD_PH_REF3(0x00),
+    /* 51: .xcvr_ctrl */
+    XCVR_MISC_XCVR_CTRL_DATA_RATE_DRS(2) | XCVR_MISC_XCVR_CTRL_DEMOD_SEL(1) |
+        XCVR_MISC_XCVR_CTRL_LL_CFG_CAPT_DIS(0),
+    /* 59: .acq_filt_0_3 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x3F) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x01) |
+        XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x07) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x0B),
+#else
+    XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x01) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x04) |
+        XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x7F) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x75),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 61: .acq_filt_10_11 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x069) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x090),
+#else
+    XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x061) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x0E1),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 62: .acq_filt_10_11_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x066) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x0AD),
+#else
+    XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x039) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x10B),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 63: .acq_filt_4_7 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x06) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x77) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_H6(0xE7) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0xE4),
+#else
+    XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x79) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x12) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_H6(0x1C) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0xF7),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 64: .acq_filt_4_7_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x04) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x07) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0xFD) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0xE8),
+#else
+    XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x7E) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x79) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0x0B) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0x1B),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 65: .acq_filt_8_9 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x1FC) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x02E),
+#else
+    XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x1C6) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x1E1),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 66: .acq_filt_8_9_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x1E4) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x011),
+#else
+    XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x1E6) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x1B9),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 75: .ctrl0 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(2) | XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x027) |
+        XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(1) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#else
+    XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(3) | XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x020) |
+        XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(1) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 76: .ctrl0_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(3) |
+        XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x027),
+#else
+    XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(4) |
+        XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x020),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 79: .demod_filt_0_1 */
+    XCVR_RX_DIG_DEMOD_FILT_0_1_H0(0x1FD) | XCVR_RX_DIG_DEMOD_FILT_0_1_H1(0x1FD),
+    /* 81: .demod_filt_2_4 */
+    XCVR_RX_DIG_DEMOD_FILT_2_4_H2(0x021) | XCVR_RX_DIG_DEMOD_FILT_2_4_H3(0x084) |
+        XCVR_RX_DIG_DEMOD_FILT_2_4_H4(0x0C0),
+    /* 83: .rccal_ctrl0 */
+    XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE(2) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE_DRS(3) |
+        XCVR_RX_DIG_RCCAL_CTRL0_CBPF_CCODE_OFFSET(0x00) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE(1) |
+        XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE_DRS(1) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CMPOUT_INV(0) |
+        XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CODE_OFFSET(0x0) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_SMPL_DLY(0),
+    /* 85: .datarate_config_filter_ctrl */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(2) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(2) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(1),
+#else
+    XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(3) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(2) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(1),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 87: .datarate_config_gfsk_ctrl */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x0279),
+#else
+    XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x0203),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 90: .data_padding_ctrl_2 */
+    XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_MFDEV(0x0000) | XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_PFDEV(0x0000),
+    /* 91: .fsk_ctrl */
+    XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_0(0x0000) | XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_1(0x0000),
+    /* 92: .gfsk_coeff_0_1 */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_0(0x003) | XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_1(0x00A),
+#else
+    XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_0(0x000) | XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_1(0x000),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 93: .gfsk_coeff_2_3 */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_2(0x01B) | XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_3(0x03E),
+#else
+    XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_2(0x001) | XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_3(0x007),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 94: .gfsk_coeff_4_5 */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_4(0x079) | XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_5(0x0C6),
+#else
+    XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_4(0x025) | XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_5(0x08A),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 95: .gfsk_coeff_6_7 */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_6(0x114) | XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_7(0x145),
+#else
+    XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_6(0x14A) | XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_7(0x1FE),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 96: .gfsk_ctrl */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(1) |
+        XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x276),
+#else
+    XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(1) |
+        XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x200),
+#endif /* RF_OSC_26MHZ == 1 */
+};
+const xcvr_mode_delta_config_t xcvr_gfsk_bt_0p7_h_0p5_500kbps_delta_config = {
+    .base_words = &xcvr_mode_delta_base_words[0],
+    .delta_idx  = &xcvr_gfsk_bt_0p7_h_0p5_500kbps_delta_idx[0],
+    .delta_val  = &xcvr_gfsk_bt_0p7_h_0p5_500kbps_delta_val[0],
+    .num_deltas = 27U,
+};
+
+static const uint8_t xcvr_gfsk_bt_0p7_h_0p5_250kbps_delta_idx[] = {
+      0,   2,  31,  32,  33,  51,  59,  61,  62,  63,  64,  65,  66,  75,  76,  79,
+     81,  83,  85,  87,  90,  91,  92,  93,  94,  95,  96,
+};
+static const uint32_t xcvr_gfsk_bt_0p7_h_0p5_250kbps_delta_val[] = {
+    /* 0: .radio_mode */
+    GFSK_BT_0p7_h_0p5,
+    /* 2: .alt_data_rate */
+    DR_250KBPS,
+    /* 31: .fsk_pd_cfg2 */
+    GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_1M(0xEB) | GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_2M(0xEB),
+    /* 32: .fsk_pd_ph[0] */
+    GEN4PHY_FSK_PD_PH_REF0(0x04) | GEN4PHY_FSK_PD_PH_REF1(0x06) | GEN4PHY_FSK_PD_PH_REF2(0x04) |
+        GEN4PHY_FSK_PD_PH_REF3(0x00),
+    /* 33: .fsk_pd_ph[1] */
+    GEN4PHY_FSK_PD_PH_REF0(0x3C) | GEN4PHY_FSK_PD_PH_REF1(0x3A) | GEN4PHY_FSK_PD_PH_REF2(0x3C) |
+        GEN4PHY_FSK_PD_PH_REF3(0x00),
+    /* 51: .xcvr_ctrl */
+    XCVR_MISC_XCVR_CTRL_DATA_RATE_DRS(3) | XCVR_MISC_XCVR_CTRL_DEMOD_SEL(1) |
+        XCVR_MISC_XCVR_CTRL_LL_CFG_CAPT_DIS(0),
+    /* 59: .acq_filt_0_3 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x3F) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x01) |
+        XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x07) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x0B),
+#else
+    XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x01) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x04) |
+        XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x7F) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x75),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 61: .acq_filt_10_11 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x069) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x090),
+#else
+    XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x061) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x0E1),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 62: .acq_filt_10_11_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x06B) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x0B3),
+#else
+    XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x024) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x119),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 63: .acq_filt_4_7 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x06) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x77) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_H6(0xE7) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0xE4),
+#else
+    XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x79) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x12) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_H6(0x1C) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0xF7),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 64: .acq_filt_4_7_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x03) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x05) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0xFB) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0xE6),
+#else
+    XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x01) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x79) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0xFE) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0x1C),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 65: .acq_filt_8_9 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x1FC) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x02E),
+#else
+    XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x1C6) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x1E1),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 66: .acq_filt_8_9_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x1E5) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x013),
+#else
+    XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x1FC) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x1B3),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 75: .ctrl0 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(2) | XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x027) |
+        XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(1) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#else
+    XCVR_RX_DIG_CTRL0_CIC_ORDER(1) | XCVR_RX_DIG_CTRL0_CIC_RATE(3) | XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x020) |
+        XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(1) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 76: .ctrl0_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(4) |
+        XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x027),
+#else
+    XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(1) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(5) |
+        XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x020),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 79: .demod_filt_0_1 */
+    XCVR_RX_DIG_DEMOD_FILT_0_1_H0(0x1FD) | XCVR_RX_DIG_DEMOD_FILT_0_1_H1(0x1FD),
+    /* 81: .demod_filt_2_4 */
+    XCVR_RX_DIG_DEMOD_FILT_2_4_H2(0x021) | XCVR_RX_DIG_DEMOD_FILT_2_4_H3(0x084) |
+        XCVR_RX_DIG_DEMOD_FILT_2_4_H4(0x0C0),
+    /* 83: .rccal_ctrl0 */
+    XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE(2) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE_DRS(4) |
+        XCVR_RX_DIG_RCCAL_CTRL0_CBPF_CCODE_OFFSET(0x00) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE(1) |
+        XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE_DRS(1) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CMPOUT_INV(0) |
+        XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CODE_OFFSET(0x0) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_SMPL_DLY(0),
+    /* 85: .datarate_config_filter_ctrl */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(3) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(2) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(1),
+#else
+    XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(4) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(3) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(2) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(1),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 87: .datarate_config_gfsk_ctrl */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x013D),
+#else
+    XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x0101),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 90: .data_padding_ctrl_2 */
+    XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_MFDEV(0x0000) | XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_PFDEV(0x0000),
+    /* 91: .fsk_ctrl */
+    XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_0(0x0000) | XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_1(0x0000),
+    /* 92: .gfsk_coeff_0_1 */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_0(0x003) | XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_1(0x00A),
+#else
+    XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_0(0x000) | XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_1(0x000),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 93: .gfsk_coeff_2_3 */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_2(0x01B) | XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_3(0x03E),
+#else
+    XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_2(0x001) | XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_3(0x007),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 94: .gfsk_coeff_4_5 */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_4(0x079) | XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_5(0x0C6),
+#else
+    XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_4(0x025) | XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_5(0x08A),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 95: .gfsk_coeff_6_7 */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_6(0x114) | XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_7(0x145),
+#else
+    XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_6(0x14A) | XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_7(0x1FE),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 96: .gfsk_ctrl */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(1) |
+        XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x13B),
+#else
+    XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(1) |
+        XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x100),
+#endif /* RF_OSC_26MHZ == 1 */
+};
+const xcvr_mode_delta_config_t xcvr_gfsk_bt_0p7_h_0p5_250kbps_delta_config = {
+    .base_words = &xcvr_mode_delta_base_words[0],
+    .delta_idx  = &xcvr_gfsk_bt_0p7_h_0p5_250kbps_delta_idx[0],
+    .delta_val  = &xcvr_gfsk_bt_0p7_h_0p5_250kbps_delta_val[0],
+    .num_deltas = 27U,
+};
+
+static const uint8_t xcvr_gfsk_bt_1p0_h_0p5_1mbps_delta_idx[] = {
+      0,  31,  32,  33,  41,  44,  54,  55,  59,  60,  61,  62,  63,  64,  65,  66,
+     77,  78,  79,  80,  81,  82,  87,  90,  91,  92,  93,  94,  95,  96,
+};
+static const uint32_t xcvr_gfsk_bt_1p0_h_0p5_1mbps_delta_val[] = {
+    /* 0: .radio_mode */
+    GFSK_BT_1p0_h_0p5,
+    /* 31: .fsk_pd_cfg2 */
+    GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_1M(0xEB) | GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_2M(0xF6),
+    /* 32: .fsk_pd_ph[0] */
+    GEN4PHY_FSK_PD_PH_REF0(0x04) | GEN4PHY_FSK_PD_PH_REF1(0x06) | GEN4PHY_FSK_PD_PH_REF2(0x04) |
+        GEN4PHY_FSK_PD_PH_REF3(0x00),
+    /* 33: .fsk_pd_ph[1] */
+    GEN4PHY_FSK_PD_PH_REF0(0x3C) | GEN4PHY_FSK_PD_PH_REF1(0x3A) | GEN4PHY_FSK_PD_PH_REF2(0x3C) |
+        GEN4PHY_FSK_PD_PH_REF3(0x00),
+    /* 41: .rtt_ref */
+    GEN4PHY_RTT_REF_FM_REF_010(0x5e) | GEN4PHY_RTT_REF_FM_REF_110(0x6e) | GEN4PHY_RTT_REF_FM_REF_111(0x80),
+    /* 44: .tx_dac_pa */
+    XCVR_ANALOG_TX_DAC_PA_DAC_TRIM_CFBK_DRS(0),
+    /* 54: .data_rate_ovrd_ctrl2 */
+#if RF_OSC_26MHZ == 1
+    XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL2_NUM_OFFSET_CFG1(0x01D89D9),
+#else
+    XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL2_NUM_OFFSET_CFG1(0x0180000),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 55: .delay_match */
+#if RF_OSC_26MHZ == 1
+    XCVR_PLL_DIG_DELAY_MATCH_HPM_INTEGER_DELAY(0x04) |
+        XCVR_PLL_DIG_DELAY_MATCH_LPM_SDM_DELAY(0x02),
+#else
+    XCVR_PLL_DIG_DELAY_MATCH_HPM_INTEGER_DELAY(0x04) |
+        XCVR_PLL_DIG_DELAY_MATCH_LPM_SDM_DELAY(0x03),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 59: .acq_filt_0_3 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x3E) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x04) |
+        XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x0D) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x10),
+#else
+    XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x01) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x04) |
+        XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x7F) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x73),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 60: .acq_filt_0_3_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H0(0x06) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H1(0x0A) |
+        XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H2(0x0A) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H3(0x03),
+#else
+    XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H0(0x01) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H1(0x3E) |
+        XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H2(0x78) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H3(0x7B),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 61: .acq_filt_10_11 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x06C) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x094),
+#else
+    XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x061) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x0EC),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 62: .acq_filt_10_11_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x067) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x081),
+#else
+    XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x06E) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x0D1),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 63: .acq_filt_4_7 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x06) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x73) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_H6(0xDF) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0xDE),
+#else
+    XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x79) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x14) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_H6(0x21) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0xF7),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 64: .acq_filt_4_7_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x75) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x68) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0xE3) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0xF0),
+#else
+    XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x0C) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x19) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0x09) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0xDD),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 65: .acq_filt_8_9 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x1FA) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x030),
+#else
+    XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x1BD) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x1D7),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 66: .acq_filt_8_9_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x00F) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x03C),
+#else
+    XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x1C7) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x1FA),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 77: .dcoc_ctrl0 */
+    XCVR_RX_DIG_DCOC_CTRL0_DCOC_DAC_ORDER(0) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFII(0x8) |
+        XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFIIP(1) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFQQ(0x2) |
+        XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFQQP(0),
+    /* 78: .dcoc_ctrl0_drs */
+    XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFII(4) | XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFIIP(1) |
+        XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFQQ(1) | XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFQQP(0),
+    /* 79: .demod_filt_0_1 */
+    XCVR_RX_DIG_DEMOD_FILT_0_1_H0(0x1FD) | XCVR_RX_DIG_DEMOD_FILT_0_1_H1(0x1FB),
+    /* 80: .demod_filt_0_1_drs */
+    XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H0(0x1FD) | XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H1(0x1FB),
+    /* 81: .demod_filt_2_4 */
+    XCVR_RX_DIG_DEMOD_FILT_2_4_H2(0x01E) | XCVR_RX_DIG_DEMOD_FILT_2_4_H3(0x085) |
+        XCVR_RX_DIG_DEMOD_FILT_2_4_H4(0x0C6),
+    /* 82: .demod_filt_2_4_drs */
+    XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H2(0x01E) | XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H3(0x086) |
+        XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H4(0x0C8),
+    /* 87: .datarate_config_gfsk_ctrl */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x09FD),
+#else
+    XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x080D),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 90: .data_padding_ctrl_2 */
+    XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_MFDEV(0x1C00) | XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_PFDEV(0x0400),
+    /* 91: .fsk_ctrl */
+    XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_0(0x0000) | XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_1(0x0000),
+    /* 92: .gfsk_coeff_0_1 */
+    XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_0(0x000) | XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_1(0x000),
+    /* 93: .gfsk_coeff_2_3 */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_2(0x001) | XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_3(0x008),
+#else
+    XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_2(0x000) | XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_3(0x000),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 94: .gfsk_coeff_4_5 */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_4(0x01E) | XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_5(0x052),
+#else
+    XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_4(0x001) | XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_5(0x018),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 95: .gfsk_coeff_6_7 */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_6(0x0A2) | XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_7(0x0E3),
+#else
+    XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_6(0x08D) | XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_7(0x158),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 96: .gfsk_ctrl */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(1) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(1) |
+        XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x4E4),
+#else
+    XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(1) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(1) |
+        XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x400),
+#endif /* RF_OSC_26MHZ == 1 */
+};
+const xcvr_mode_delta_config_t xcvr_gfsk_bt_1p0_h_0p5_1mbps_delta_config = {
+    .base_words = &xcvr_mode_delta_base_words[0],
+    .delta_idx  = &xcvr_gfsk_bt_1p0_h_0p5_1mbps_delta_idx[0],
+    .delta_val  = &xcvr_gfsk_bt_1p0_h_0p5_1mbps_delta_val[0],
+    .num_deltas = 30U,
+};
+
+static const uint8_t xcvr_gfsk_bt_2p0_h_0p5_1mbps_delta_idx[] = {
+      0,  31,  32,  33,  41,  44,  54,  55,  59,  60,  61,  62,  63,  64,  65,  66,
+     77,  78,  79,  80,  81,  82,  87,  90,  91,  92,  93,  94,  95,  96,
+};
+static const uint32_t xcvr_gfsk_bt_2p0_h_0p5_1mbps_delta_val[] = {
+    /* 0: .radio_mode */
+    GFSK_BT_2p0_h_0p5,
+    /* 31: .fsk_pd_cfg2 */
+    GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_1M(0xEB) | GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_2M(0xF6),
+    /* 32: .fsk_pd_ph[0] */
+    GEN4PHY_FSK_PD_PH_REF0(0x04) | GEN4PHY_FSK_PD_PH_REF1(0x06) | GEN4PHY_FSK_PD_PH_REF2(0x04) |
+        GEN4PHY_FSK_PD_PH_REF3(0x00),
+    /* 33: .fsk_pd_ph[1] */
+    GEN4PHY_FSK_PD_PH_REF0(0x3C) | GEN4PHY_FSK_PD_PH_REF1(0x3A) | GEN4PHY_FSK_PD_PH_REF2(0x3C) |
+        GEN4PHY_FSK_PD_PH_REF3(0x00),
+    /* 41: .rtt_ref */
+    GEN4PHY_RTT_REF_FM_REF_010(0x5e) | GEN4PHY_RTT_REF_FM_REF_110(0x6e) | GEN4PHY_RTT_REF_FM_REF_111(0x80),
+    /* 44: .tx_dac_pa */
+    XCVR_ANALOG_TX_DAC_PA_DAC_TRIM_CFBK_DRS(0),
+    /* 54: .data_rate_ovrd_ctrl2 */
+#if RF_OSC_26MHZ == 1
+    XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL2_NUM_OFFSET_CFG1(0x01D89D9),
+#else
+    XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL2_NUM_OFFSET_CFG1(0x0180000),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 55: .delay_match */
+#if RF_OSC_26MHZ == 1
+    XCVR_PLL_DIG_DELAY_MATCH_HPM_INTEGER_DELAY(0x04) |
+        XCVR_PLL_DIG_DELAY_MATCH_LPM_SDM_DELAY(0x02),
+#else
+    XCVR_PLL_DIG_DELAY_MATCH_HPM_INTEGER_DELAY(0x04) |
+        XCVR_PLL_DIG_DELAY_MATCH_LPM_SDM_DELAY(0x03),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 59: .acq_filt_0_3 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x3B) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x01) |
+        XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x0C) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x13),
+#else
+    XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x01) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x05) |
+        XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x02) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x74),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 60: .acq_filt_0_3_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H0(0x03) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H1(0x0A) |
+        XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H2(0x0C) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H3(0x07),
+#else
+    XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H0(0x02) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H1(0x00) |
+        XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H2(0x78) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H3(0x77),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 61: .acq_filt_10_11 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x06F) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x09C),
+#else
+    XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x05B) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x0FB),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 62: .acq_filt_10_11_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x069) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x088),
+#else
+    XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x06C) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x0DB),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 63: .acq_filt_4_7 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x0C) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x77) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_H6(0xDF) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0xD8),
+#else
+    XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x71) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x0F) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_H6(0x28) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0x03),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 64: .acq_filt_4_7_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x7A) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x69) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0xE0) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0xE9),
+#else
+    XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x08) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x1B) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0x11) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0xE2),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 65: .acq_filt_8_9 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x1F2) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x02B),
+#else
+    XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x1BB) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x1C7),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 66: .acq_filt_8_9_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x008) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x039),
+#else
+    XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x1C0) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x1EF),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 77: .dcoc_ctrl0 */
+    XCVR_RX_DIG_DCOC_CTRL0_DCOC_DAC_ORDER(0) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFII(0x8) |
+        XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFIIP(1) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFQQ(0x2) |
+        XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFQQP(0),
+    /* 78: .dcoc_ctrl0_drs */
+    XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFII(4) | XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFIIP(1) |
+        XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFQQ(1) | XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFQQP(0),
+    /* 79: .demod_filt_0_1 */
+    XCVR_RX_DIG_DEMOD_FILT_0_1_H0(0x1FD) | XCVR_RX_DIG_DEMOD_FILT_0_1_H1(0x1FA),
+    /* 80: .demod_filt_0_1_drs */
+    XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H0(0x1FD) | XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H1(0x1FA),
+    /* 81: .demod_filt_2_4 */
+    XCVR_RX_DIG_DEMOD_FILT_2_4_H2(0x01C) | XCVR_RX_DIG_DEMOD_FILT_2_4_H3(0x086) |
+        XCVR_RX_DIG_DEMOD_FILT_2_4_H4(0x0CA),
+    /* 82: .demod_filt_2_4_drs */
+    XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H2(0x01A) | XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H3(0x087) |
+        XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H4(0x0CE),
+    /* 87: .datarate_config_gfsk_ctrl */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x09FD),
+#else
+    XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x080D),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 90: .data_padding_ctrl_2 */
+    XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_MFDEV(0x1C00) | XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_PFDEV(0x0400),
+    /* 91: .fsk_ctrl */
+    XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_0(0x0000) | XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_1(0x0000),
+    /* 92: .gfsk_coeff_0_1 */
+    XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_0(0x000) | XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_1(0x000),
+    /* 93: .gfsk_coeff_2_3 */
+    XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_2(0x000) | XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_3(0x000),
+    /* 94: .gfsk_coeff_4_5 */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_4(0x000) | XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_5(0x007),
+#else
+    XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_4(0x000) | XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_5(0x000),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 95: .gfsk_coeff_6_7 */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_6(0x068) | XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_7(0x191),
+#else
+    XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_6(0x00E) | XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_7(0x1F1),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 96: .gfsk_ctrl */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(1) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(1) |
+        XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x4E4),
+#else
+    XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(1) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(1) |
+        XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x400),
+#endif /* RF_OSC_26MHZ == 1 */
+};
+const xcvr_mode_delta_config_t xcvr_gfsk_bt_2p0_h_0p5_1mbps_delta_config = {
+    .base_words = &xcvr_mode_delta_base_words[0],
+    .delta_idx  = &xcvr_gfsk_bt_2p0_h_0p5_1mbps_delta_idx[0],
+    .delta_val  = &xcvr_gfsk_bt_2p0_h_0p5_1mbps_delta_val[0],
+    .num_deltas = 30U,
+};
+
+static const uint8_t xcvr_msk_1mbps_delta_idx[] = {
+      0,  27,  31,  32,  33,  44,  54,  59,  60,  61,  62,  63,  64,  65,  66,  69,
+     70,  71,  73,  75,  77,  78,  80,  81,  82,  83,  85,  86,  90,  91,  92,  93,
+     94,  95,  97,  99,
+};
+static const uint32_t xcvr_msk_1mbps_delta_val[] = {
+    /* 0: .radio_mode */
+    MSK,
+    /* 27: .fsk_cfg0 */
+    GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_1M(0x1A) | GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_2M(0x1C) |
+        GEN4PHY_FSK_CFG0_MSK2FSK_SEED(1) | GEN4PHY_FSK_CFG0_MSK_EN(1),
+    /* 31: .fsk_pd_cfg2 */
+    GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_1M(0xE6) | GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_2M(0xF6),
+    /* 32: .fsk_pd_ph[0] */
+    GEN4PHY_FSK_PD_PH_REF0(0x03) | GEN4PHY_FSK_PD_PH_REF1(0x05) | GEN4PHY_FSK_PD_PH_REF2(0x03) |
+        GEN4PHY_FSK_PD_PH_REF3(0x00),
+    /* 33: .fsk_pd_ph[1] */
+    GEN4PHY_FSK_PD_PH_REF0(0x3D) | GEN4PHY_FSK_PD_PH_REF1(0x3B) | GEN4PHY_FSK_PD_PH_REF2(0x3D) |
+        GEN4PHY_FSK_PD_PH_REF3(0x00),
+    /* 44: .tx_dac_pa */
+    XCVR_ANALOG_TX_DAC_PA_DAC_TRIM_CFBK_DRS(0),
+    /* 54: .data_rate_ovrd_ctrl2 */
+#if RF_OSC_26MHZ == 1
+    XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL2_NUM_OFFSET_CFG1(0x01D89D9),
+#else
+    XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL2_NUM_OFFSET_CFG1(0x0180000),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 59: .acq_filt_0_3 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x03) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x00) |
+        XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x78) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x77),
+#else
+    XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x02) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x05) |
+        XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x7F) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x73),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 60: .acq_filt_0_3_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H0(0x3F) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H1(0x03) |
+        XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H2(0x08) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H3(0x0A),
+#else
+    XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H0(0x02) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H1(0x3E) |
+        XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H2(0x78) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H3(0x7A),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 61: .acq_filt_10_11 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x066) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x0C9),
+#else
+    XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x061) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x0EF),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 62: .acq_filt_10_11_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x069) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x08E),
+#else
+    XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x06E) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x0D4),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 63: .acq_filt_4_7 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x06) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x1A) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_H6(0x11) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0xE7),
+#else
+    XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x78) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x14) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_H6(0x22) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0xF8),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 64: .acq_filt_4_7_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x03) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x74) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0xE6) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0xE6),
+#else
+    XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x0B) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x1A) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0x0C) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0xDF),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 65: .acq_filt_8_9 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x1CA) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x1F5),
+#else
+    XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x1BC) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x1D5),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 66: .acq_filt_8_9_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x1FF) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x031),
+#else
+    XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x1C5) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x1F7),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 69: .agc_timing0 */
+    XCVR_RX_DIG_AGC_TIMING0_AGC_GAIN_STEP_WAIT(0x08),
+    /* 70: .agc_timing0_drs */
+    XCVR_RX_DIG_AGC_TIMING0_DRS_AGC_GAIN_STEP_WAIT(0x08),
+    /* 71: .agc_timing1 */
+    XCVR_RX_DIG_AGC_TIMING1_AGC_FREEZE_TIMEOUT(0x27) | XCVR_RX_DIG_AGC_TIMING1_AGC_HOLD_TIMEOUT(0x05),
+    /* 73: .agc_timing2 */
+    XCVR_RX_DIG_AGC_TIMING2_AGC_UNFREEZE_FEAT_TIMEOUT(0x07F) |
+        XCVR_RX_DIG_AGC_TIMING2_AGC_UNHOLD_FEAT_TIMEOUT(0x000),
+    /* 75: .ctrl0 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(2) | XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x03B) |
+        XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(0) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#else
+    XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(3) | XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x020) |
+        XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(0) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 77: .dcoc_ctrl0 */
+    XCVR_RX_DIG_DCOC_CTRL0_DCOC_DAC_ORDER(0) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFII(0x8) |
+        XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFIIP(1) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFQQ(0x2) |
+        XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFQQP(0),
+    /* 78: .dcoc_ctrl0_drs */
+    XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFII(4) | XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFIIP(1) |
+        XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFQQ(1) | XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFQQP(0),
+    /* 80: .demod_filt_0_1_drs */
+    XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H0(0x1FD) | XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H1(0x1FB),
+    /* 81: .demod_filt_2_4 */
+    XCVR_RX_DIG_DEMOD_FILT_2_4_H2(0x024) | XCVR_RX_DIG_DEMOD_FILT_2_4_H3(0x082) |
+        XCVR_RX_DIG_DEMOD_FILT_2_4_H4(0x0BA),
+    /* 82: .demod_filt_2_4_drs */
+    XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H2(0x01F) | XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H3(0x086) |
+        XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H4(0x0C6),
+    /* 83: .rccal_ctrl0 */
+    XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE(2) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE_DRS(0) |
+        XCVR_RX_DIG_RCCAL_CTRL0_CBPF_CCODE_OFFSET(0x00) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE(1) |
+        XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE_DRS(0) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CMPOUT_INV(0) |
+        XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CODE_OFFSET(0x0) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_SMPL_DLY(0),
+    /* 85: .datarate_config_filter_ctrl */
+    XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(0) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(0) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(0) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(0) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(0) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(0),
+    /* 86: .datarate_config_fsk_ctrl */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV0(0x1610) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV1(0x09f0),
+#else
+    XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV0(0x1800) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV1(0x0800),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 90: .data_padding_ctrl_2 */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_MFDEV(0x1B0D) | XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_PFDEV(0x04F2),
+#else
+    XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_MFDEV(0x1BF9) | XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_PFDEV(0x0406),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 91: .fsk_ctrl */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_0(0x1B0D) | XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_1(0x04F2),
+#else
+    XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_0(0x1BF9) | XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_1(0x0406),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 92: .gfsk_coeff_0_1 */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_0(0x0048) | XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_1(0x0059),
+#else
+    XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_0(0x0019) | XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_1(0x002C),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 93: .gfsk_coeff_2_3 */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_2(0x006B) | XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_3(0x007D),
+#else
+    XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_2(0x0046) | XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_3(0x0069),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 94: .gfsk_coeff_4_5 */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_4(0x008D) | XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_5(0x009A),
+#else
+    XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_4(0x0091) | XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_5(0x00B8),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 95: .gfsk_coeff_6_7 */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_6(0x00A4) | XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_7(0x00A9),
+#else
+    XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_6(0x00D8) | XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_7(0x00EA),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 97: .image_filter_ctrl */
+    XCVR_TX_DIG_IMAGE_FILTER_CTRL_IMAGE_FILTER_OVRD_EN(1),
+    /* 99: .txdig_ctrl */
+    XCVR_TX_DIG_TXDIG_CTRL_DATA_STREAM_SEL(0) | XCVR_TX_DIG_TXDIG_CTRL_MODULATOR_SEL(1) |
+        XCVR_TX_DIG_TXDIG_CTRL_PFC_EN(1),
+};
+const xcvr_mode_delta_config_t xcvr_msk_1mbps_delta_config = {
+    .base_words = &xcvr_mode_delta_base_words[0],
+    .delta_idx  = &xcvr_msk_1mbps_delta_idx[0],
+    .delta_val  = &xcvr_msk_1mbps_delta_val[0],
+    .num_deltas = 36U,
+};
+
+static const uint8_t xcvr_msk_500kbps_delta_idx[] = {
+      0,   2,  27,  31,  34,  51,  62,  64,  66,  75,  76,  80,  82,  83,  85,  86,
+     87,  90,  91,  92,  93,  94,  95,  97,  99,
+};
+static const uint32_t xcvr_msk_500kbps_delta_val[] = {
+    /* 0: .radio_mode */
+    MSK,
+    /* 2: .alt_data_rate */
+    DR_500KBPS,
+    /* 27: .fsk_cfg0 */
+    GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_1M(0x12) | GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_2M(0x11) |
+        GEN4PHY_FSK_CFG0_MSK2FSK_SEED(1) | GEN4PHY_FSK_CFG0_MSK_EN(1),
+    /* 31: .fsk_pd_cfg2 */
+    GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_1M(0xF0) | GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_2M(0xEB),
+    /* 34: .fsk_pt */
+    GEN4PHY_FSK_PT_AGC_TIMEOUT(0x0160),
+    /* 51: .xcvr_ctrl */
+    XCVR_MISC_XCVR_CTRL_DATA_RATE_DRS(2) | XCVR_MISC_XCVR_CTRL_DEMOD_SEL(1) |
+        XCVR_MISC_XCVR_CTRL_LL_CFG_CAPT_DIS(0),
+    /* 62: .acq_filt_10_11_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x053) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x0E5),
+#else
+    XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x3B2) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x167),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 64: .acq_filt_4_7_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x7C) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x05) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0x16) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0x05),
+#else
+    XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x01) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x0A) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0xE8) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0x00),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 66: .acq_filt_8_9_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x1D2) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x1D5),
+#else
+    XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x048) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x1AC),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 75: .ctrl0 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(2) | XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x03B) |
+        XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(1) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#else
+    XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(3) | XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x030) |
+        XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(1) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 76: .ctrl0_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(3) |
+        XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x027),
+#else
+    XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(4) |
+        XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x020),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 80: .demod_filt_0_1_drs */
+    XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H0(0x001) | XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H1(0x1F5),
+    /* 82: .demod_filt_2_4_drs */
+    XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H2(0x3F6) | XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H3(0x08B) |
+        XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H4(0x110),
+    /* 83: .rccal_ctrl0 */
+    XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE(2) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE_DRS(3) |
+        XCVR_RX_DIG_RCCAL_CTRL0_CBPF_CCODE_OFFSET(0x00) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE(0) |
+        XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE_DRS(1) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CMPOUT_INV(0) |
+        XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CODE_OFFSET(0x0) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_SMPL_DLY(0),
+    /* 85: .datarate_config_filter_ctrl */
+    XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(0) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(0) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(0) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(0) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(0) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(0),
+    /* 86: .datarate_config_fsk_ctrl */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV0(0x1D80) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV1(0x0240),
+#else
+    XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV0(0x1DE0) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV1(0x0200),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 87: .datarate_config_gfsk_ctrl */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x0279),
+#else
+    XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x0203),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 90: .data_padding_ctrl_2 */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_MFDEV(0x1B0D) | XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_PFDEV(0x04F2),
+#else
+    XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_MFDEV(0x1BF9) | XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_PFDEV(0x0406),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 91: .fsk_ctrl */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_0(0x1B0D) | XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_1(0x04F2),
+#else
+    XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_0(0x1BF9) | XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_1(0x0406),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 92: .gfsk_coeff_0_1 */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_0(0x0048) | XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_1(0x0059),
+#else
+    XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_0(0x0019) | XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_1(0x002C),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 93: .gfsk_coeff_2_3 */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_2(0x006B) | XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_3(0x007D),
+#else
+    XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_2(0x0046) | XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_3(0x0069),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 94: .gfsk_coeff_4_5 */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_4(0x008D) | XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_5(0x009A),
+#else
+    XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_4(0x0091) | XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_5(0x00B8),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 95: .gfsk_coeff_6_7 */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_6(0x00A4) | XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_7(0x00A9),
+#else
+    XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_6(0x00D8) | XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_7(0x00EA),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 97: .image_filter_ctrl */
+    XCVR_TX_DIG_IMAGE_FILTER_CTRL_IMAGE_FILTER_OVRD_EN(1),
+    /* 99: .txdig_ctrl */
+    XCVR_TX_DIG_TXDIG_CTRL_DATA_STREAM_SEL(0) | XCVR_TX_DIG_TXDIG_CTRL_MODULATOR_SEL(1) |
+        XCVR_TX_DIG_TXDIG_CTRL_PFC_EN(1),
+};
+const xcvr_mode_delta_config_t xcvr_msk_500kbps_delta_config = {
+    .base_words = &xcvr_mode_delta_base_words[0],
+    .delta_idx  = &xcvr_msk_500kbps_delta_idx[0],
+    .delta_val  = &xcvr_msk_500kbps_delta_val[0],
+    .num_deltas = 25U,
+};
+
+static const uint8_t xcvr_msk_250kbps_delta_idx[] = {
+      0,   2,  27,  31,  34,  51,  75,  76,  80,  82,  83,  85,  86,  87,  90,  91,
+     92,  93,  94,  95,  97,  99,
+};
+static const uint32_t xcvr_msk_250kbps_delta_val[] = {
+    /* 0: .radio_mode */
+    MSK,
+    /* 2: .alt_data_rate */
+    DR_250KBPS,
+    /* 27: .fsk_cfg0 */
+    GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_1M(0x11) | GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_2M(0x11) |
+        GEN4PHY_FSK_CFG0_MSK2FSK_SEED(1) | GEN4PHY_FSK_CFG0_MSK_EN(1),
+    /* 31: .fsk_pd_cfg2 */
+    GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_1M(0xB8) | GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_2M(0xEB),
+    /* 34: .fsk_pt */
+    GEN4PHY_FSK_PT_AGC_TIMEOUT(0x0100),
+    /* 51: .xcvr_ctrl */
+    XCVR_MISC_XCVR_CTRL_DATA_RATE_DRS(3) | XCVR_MISC_XCVR_CTRL_DEMOD_SEL(1) |
+        XCVR_MISC_XCVR_CTRL_LL_CFG_CAPT_DIS(0),
+    /* 75: .ctrl0 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(2) | XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x03B) |
+        XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(1) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#else
+    XCVR_RX_DIG_CTRL0_CIC_ORDER(1) | XCVR_RX_DIG_CTRL0_CIC_RATE(3) | XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x030) |
+        XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(1) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 76: .ctrl0_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(4) |
+        XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x027),
+#else
+    XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(1) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(5) |
+        XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x020),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 80: .demod_filt_0_1_drs */
+    XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H0(0x002) | XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H1(0x1F5),
+    /* 82: .demod_filt_2_4_drs */
+    XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H2(0x3F5) | XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H3(0x08B) |
+        XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H4(0x112),
+    /* 83: .rccal_ctrl0 */
+    XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE(2) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE_DRS(4) |
+        XCVR_RX_DIG_RCCAL_CTRL0_CBPF_CCODE_OFFSET(0x00) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE(0) |
+        XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE_DRS(1) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CMPOUT_INV(0) |
+        XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CODE_OFFSET(0x0) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_SMPL_DLY(0),
+    /* 85: .datarate_config_filter_ctrl */
+    XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(0) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(1) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(0) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(0) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(0) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(0) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(0),
+    /* 86: .datarate_config_fsk_ctrl */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV0(0x1EA0) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV1(0x0120),
+#else
+    XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV0(0x1EE0) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV1(0x0100),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 87: .datarate_config_gfsk_ctrl */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x013D),
+#else
+    XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x0101),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 90: .data_padding_ctrl_2 */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_MFDEV(0x1B0D) | XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_PFDEV(0x04F2),
+#else
+    XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_MFDEV(0x1BF9) | XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_PFDEV(0x0406),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 91: .fsk_ctrl */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_0(0x1B0D) | XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_1(0x04F2),
+#else
+    XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_0(0x1BF9) | XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_1(0x0406),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 92: .gfsk_coeff_0_1 */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_0(0x0048) | XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_1(0x0059),
+#else
+    XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_0(0x0019) | XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_1(0x002C),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 93: .gfsk_coeff_2_3 */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_2(0x006B) | XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_3(0x007D),
+#else
+    XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_2(0x0046) | XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_3(0x0069),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 94: .gfsk_coeff_4_5 */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_4(0x008D) | XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_5(0x009A),
+#else
+    XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_4(0x0091) | XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_5(0x00B8),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 95: .gfsk_coeff_6_7 */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_6(0x00A4) | XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_7(0x00A9),
+#else
+    XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_6(0x00D8) | XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_7(0x00EA),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 97: .image_filter_ctrl */
+    XCVR_TX_DIG_IMAGE_FILTER_CTRL_IMAGE_FILTER_OVRD_EN(1),
+    /* 99: .txdig_ctrl */
+    XCVR_TX_DIG_TXDIG_CTRL_DATA_STREAM_SEL(0) | XCVR_TX_DIG_TXDIG_CTRL_MODULATOR_SEL(1) |
+        XCVR_TX_DIG_TXDIG_CTRL_PFC_EN(1),
+};
+const xcvr_mode_delta_config_t xcvr_msk_250kbps_delta_config = {
+    .base_words = &xcvr_mode_delta_base_words[0],
+    .delta_idx  = &xcvr_msk_250kbps_delta_idx[0],
+    .delta_val  = &xcvr_msk_250kbps_delta_val[0],
+    .num_deltas = 22U,
+};
+
+static const uint8_t xcvr_oqpsk_802p15p4_250kbps_delta_idx[] = {
+      0,   2,   3,   4,   5,   6,   7,   9,  10,  12,  13,  14,  15,  16,  17,  18,
+     19,  21,  22,  24,  25,  26,  27,  31,  32,  33,  35,  36,  37,  38,  39,  40,
+     43,  44,  51,  52,  54,  55,  56,  57,  58,  59,  60,  61,  62,  63,  64,  65,
+     66,  69,  70,  71,  72,  73,  74,  75,  76,  77,  78,  79,  80,  81,  82,  83,
+     84,  86,  88,  89,  91,  98,  99,
+};
+static const uint32_t xcvr_oqpsk_802p15p4_250kbps_delta_val[] = {
+    /* 0: .radio_mode */
+    OQPSK_802P15P4,
+    /* 2: .alt_data_rate */
+    DR_250KBPS,
+    /* 3: .demod_wave[0].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x13) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x0F) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x0B) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x08) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+    /* 4: .demod_wave[0].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x35) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x31),
+    /* 5: .demod_wave[0].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x2D) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x29) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x25),
+    /* 6: .demod_wave[1].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x13) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x0F) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x0B) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x08) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+    /* 7: .demod_wave[1].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x35) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x38),
+    /* 9: .demod_wave[2].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x0B) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x08) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x04) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+    /* 10: .demod_wave[2].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0B) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x08),
+    /* 12: .demod_wave[3].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x0B) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x08) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x04) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+    /* 13: .demod_wave[3].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0B) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x0F),
+    /* 14: .demod_wave[3].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x13) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x17) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x1B),
+    /* 15: .demod_wave[4].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x35) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x38) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x3C) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+    /* 16: .demod_wave[4].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x35) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x31),
+    /* 17: .demod_wave[4].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x2D) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x29) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x25),
+    /* 18: .demod_wave[5].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x35) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x38) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x3C) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+    /* 19: .demod_wave[5].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x35) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x38),
+    /* 21: .demod_wave[6].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x2D) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x31) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x35) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x38) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+    /* 22: .demod_wave[6].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0B) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x08),
+    /* 24: .demod_wave[7].dmd_wave_reg0 */
+    GEN4PHY_DMD_WAVE_REG0_SMPL0(0x2D) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x31) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL2(0x35) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x38) |
+        GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+    /* 25: .demod_wave[7].dmd_wave_reg1 */
+    GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0B) |
+        GEN4PHY_DMD_WAVE_REG1_SMPL9(0x0F),
+    /* 26: .demod_wave[7].dmd_wave_reg2 */
+    GEN4PHY_DMD_WAVE_REG2_SMPL10(0x13) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x17) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x1B),
+    /* 27: .fsk_cfg0 */
+    GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_1M(0x15) | GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_2M(0x15) |
+        GEN4PHY_FSK_CFG0_MSK2FSK_SEED(0) | GEN4PHY_FSK_CFG0_MSK_EN(0),
+    /* 31: .fsk_pd_cfg2 */
+    GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_1M(0xF6) | GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_2M(0xF6),
+    /* 32: .fsk_pd_ph[0] */
+    GEN4PHY_FSK_PD_PH_REF0(0x03) | GEN4PHY_FSK_PD_PH_REF1(0x05) | GEN4PHY_FSK_PD_PH_REF2(0x03) |
+        GEN4PHY_FSK_PD_PH_REF3(0x00),
+    /* 33: .fsk_pd_ph[1] */
+    GEN4PHY_FSK_PD_PH_REF0(0x3D) | GEN4PHY_FSK_PD_PH_REF1(0x3B) | GEN4PHY_FSK_PD_PH_REF2(0x3D) |
+        GEN4PHY_FSK_PD_PH_REF3(0x00),
+    /* 35: .lr_aa_cfg */
+    GEN4PHY_LR_AA_CFG_AA_COR_THRESH(0x96) | GEN4PHY_LR_AA_CFG_AA_HAM_THRESH(0x06) |
+        GEN4PHY_LR_AA_CFG_AA_LR_CORR_GAIN(0x06) | GEN4PHY_LR_AA_CFG_ACCESS_ADDR_HAM(0x02),
+    /* 36: .lr_pd_cfg */
+    GEN4PHY_LR_PD_CFG_CORR_TH(0x9A) | GEN4PHY_LR_PD_CFG_FREQ_TH(0x01) | GEN4PHY_LR_PD_CFG_NO_PEAKS(1),
+    /* 37: .lr_pd_ph[0] */
+    GEN4PHY_LR_PD_PH_REF0(0x28) | GEN4PHY_LR_PD_PH_REF1(0x30) | GEN4PHY_LR_PD_PH_REF2(0x38) |
+        GEN4PHY_LR_PD_PH_REF3(0x3D),
+    /* 38: .lr_pd_ph[1] */
+    GEN4PHY_LR_PD_PH_REF0(0x38) | GEN4PHY_LR_PD_PH_REF1(0x30) | GEN4PHY_LR_PD_PH_REF2(0x28) |
+        GEN4PHY_LR_PD_PH_REF3(0x20),
+    /* 39: .lr_pd_ph[2] */
+    GEN4PHY_LR_PD_PH_REF0(0x18) | GEN4PHY_LR_PD_PH_REF1(0x10) | GEN4PHY_LR_PD_PH_REF2(0x08) |
+        GEN4PHY_LR_PD_PH_REF3(0x03),
+    /* 40: .lr_pd_ph[3] */
+    GEN4PHY_LR_PD_PH_REF0(0x08) | GEN4PHY_LR_PD_PH_REF1(0x10) | GEN4PHY_LR_PD_PH_REF2(0x18) |
+        GEN4PHY_LR_PD_PH_REF3(0x20),
+    /* 43: .ll_ctrl */
+    RADIO_CTRL_LL_CTRL_ACTIVE_LL(1),
+    /* 44: .tx_dac_pa */
+    XCVR_ANALOG_TX_DAC_PA_DAC_TRIM_CFBK_DRS(0),
+    /* 51: .xcvr_ctrl */
+    XCVR_MISC_XCVR_CTRL_DATA_RATE_DRS(0) | XCVR_MISC_XCVR_CTRL_DEMOD_SEL(2) |
+        XCVR_MISC_XCVR_CTRL_LL_CFG_CAPT_DIS(1),
+    /* 52: .chan_map */
+    XCVR_PLL_DIG_CHAN_MAP_BAND_SELECT(4),
+    /* 54: .data_rate_ovrd_ctrl2 */
+#if RF_OSC_26MHZ == 1
+    XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL2_NUM_OFFSET_CFG1(0x01D89D9),
+#else
+    XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL2_NUM_OFFSET_CFG1(0x0180000),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 55: .delay_match */
+    XCVR_PLL_DIG_DELAY_MATCH_HPM_INTEGER_DELAY(0x05) |
+        XCVR_PLL_DIG_DELAY_MATCH_LPM_SDM_DELAY(0x02),
+    /* 56: .hpmcal_ctrl */
+    XCVR_PLL_DIG_HPMCAL_CTRL_HPM_CAL_ARRAY_SIZE(1),
+    /* 57: .hpm_bump */
+    XCVR_PLL_DIG_HPM_BUMP_HPM_VCM_CAL(4) | XCVR_PLL_DIG_HPM_BUMP_HPM_VCM_TX(4),
+    /* 58: .hpm_sdm_res */
+    XCVR_PLL_DIG_HPM_SDM_RES_HPM_COUNT_ADJUST(0x00),
+    /* 59: .acq_filt_0_3 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x3E) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x01) |
+        XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x08) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x0D),
+#else
+    XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x02) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x05) |
+        XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x7F) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x73),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 60: .acq_filt_0_3_drs */
+    XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H0(0x01) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H1(0x3A) |
+        XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H2(0x7F) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H3(0x0F),
+    /* 61: .acq_filt_10_11 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x06F) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x09D),
+#else
+    XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x061) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x0EF),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 62: .acq_filt_10_11_drs */
+    XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x021) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x12B),
+    /* 63: .acq_filt_4_7 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x09) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x77) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_H6(0xE2) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0xDB),
+#else
+    XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x78) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x14) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_H6(0x22) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0xF8),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 64: .acq_filt_4_7_drs */
+    XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x7F) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x61) |
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0x06) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0x3C),
+    /* 65: .acq_filt_8_9 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x1F4) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x02C),
+#else
+    XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x1BC) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x1D5),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 66: .acq_filt_8_9_drs */
+    XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x1F3) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x194),
+    /* 69: .agc_timing0 */
+    XCVR_RX_DIG_AGC_TIMING0_AGC_GAIN_STEP_WAIT(0x08),
+    /* 70: .agc_timing0_drs */
+    XCVR_RX_DIG_AGC_TIMING0_DRS_AGC_GAIN_STEP_WAIT(0x08),
+    /* 71: .agc_timing1 */
+    XCVR_RX_DIG_AGC_TIMING1_AGC_FREEZE_TIMEOUT(0x27) | XCVR_RX_DIG_AGC_TIMING1_AGC_HOLD_TIMEOUT(0x05),
+    /* 72: .agc_timing1_drs */
+    XCVR_RX_DIG_AGC_TIMING1_DRS_AGC_FREEZE_TIMEOUT(0x27) | XCVR_RX_DIG_AGC_TIMING1_DRS_AGC_HOLD_TIMEOUT(0x05),
+    /* 73: .agc_timing2 */
+    XCVR_RX_DIG_AGC_TIMING2_AGC_UNFREEZE_FEAT_TIMEOUT(0x07F) |
+        XCVR_RX_DIG_AGC_TIMING2_AGC_UNHOLD_FEAT_TIMEOUT(0x000),
+    /* 74: .agc_timing2_drs */
+    XCVR_RX_DIG_AGC_TIMING2_DRS_AGC_UNFREEZE_FEAT_TIMEOUT(0x07F) |
+        XCVR_RX_DIG_AGC_TIMING2_DRS_AGC_UNHOLD_FEAT_TIMEOUT(0x000),
+    /* 75: .ctrl0 */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(2) | XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x027) |
+        XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(0) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(1),
+#else
+    XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(3) | XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x020) |
+        XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(0) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(1),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 76: .ctrl0_drs */
+#if RF_OSC_26MHZ == 1
+    XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(3) |
+        XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x03B),
+#else
+    XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(3) |
+        XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x030),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 77: .dcoc_ctrl0 */
+    XCVR_RX_DIG_DCOC_CTRL0_DCOC_DAC_ORDER(0) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFII(0x8) |
+        XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFIIP(1) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFQQ(0x2) |
+        XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFQQP(0),
+    /* 78: .dcoc_ctrl0_drs */
+    XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFII(4) | XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFIIP(1) |
+        XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFQQ(1) | XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFQQP(0),
+    /* 79: .demod_filt_0_1 */
+    XCVR_RX_DIG_DEMOD_FILT_0_1_H0(0x1FD) | XCVR_RX_DIG_DEMOD_FILT_0_1_H1(0x1FE),
+    /* 80: .demod_filt_0_1_drs */
+    XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H0(0x003) | XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H1(0x0FF),
+    /* 81: .demod_filt_2_4 */
+    XCVR_RX_DIG_DEMOD_FILT_2_4_H2(0x024) | XCVR_RX_DIG_DEMOD_FILT_2_4_H3(0x082) |
+        XCVR_RX_DIG_DEMOD_FILT_2_4_H4(0x0BA),
+    /* 82: .demod_filt_2_4_drs */
+    XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H2(0x1FF) | XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H3(0x088) |
+        XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H4(0x124),
+    /* 83: .rccal_ctrl0 */
+    XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE(2) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE_DRS(3) |
+        XCVR_RX_DIG_RCCAL_CTRL0_CBPF_CCODE_OFFSET(0x00) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE(1) |
+        XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE_DRS(0) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CMPOUT_INV(0) |
+        XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CODE_OFFSET(0x0) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_SMPL_DLY(0),
+    /* 84: .rssi_global_ctrl */
+    XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_CCA1_ED_EN(1),
+    /* 86: .datarate_config_fsk_ctrl */
+#if RF_OSC_26MHZ == 1
+    XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV0(0x0000) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV1(0x0000),
+#else
+    XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV0(0x1800) |
+        XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV1(0x0800),
+#endif /* RF_OSC_26MHZ == 1 */
+    /* 88: .data_padding_ctrl */
+    XCVR_TX_DIG_DATA_PADDING_CTRL_DATA_PADDING_SEL(2) | XCVR_TX_DIG_DATA_PADDING_CTRL_PAD_DLY(0) |
+        XCVR_TX_DIG_DATA_PADDING_CTRL_PAD_DLY_EN(1),
+    /* 89: .data_padding_ctrl_1 */
+    XCVR_TX_DIG_DATA_PADDING_CTRL_1_RAMP_UP_DLY(0x00) | XCVR_TX_DIG_DATA_PADDING_CTRL_1_TX_DATA_FLUSH_DLY(0x06),
+    /* 91: .fsk_ctrl */
+    XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_0(0x1C00) | XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_1(0x0400),
+    /* 98: .pa_ctrl */
+    XCVR_TX_DIG_PA_CTRL_PA_RAMP_SEL(2),
+    /* 99: .txdig_ctrl */
+    XCVR_TX_DIG_TXDIG_CTRL_DATA_STREAM_SEL(1) | XCVR_TX_DIG_TXDIG_CTRL_MODULATOR_SEL(1) |
+        XCVR_TX_DIG_TXDIG_CTRL_PFC_EN(1),
+};
+const xcvr_mode_delta_config_t xcvr_oqpsk_802p15p4_250kbps_delta_config = {
+    .base_words = &xcvr_mode_delta_base_words[0],
+    .delta_idx  = &xcvr_oqpsk_802p15p4_250kbps_delta_idx[0],
+    .delta_val  = &xcvr_oqpsk_802p15p4_250kbps_delta_val[0],
+    .num_deltas = 71U,
+};
+/* clang-format on */
@@ -0,0 +1,138 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+
+ */
+
+#include "nxp_xcvr_mode_registry.h"
+#include "nxp_xcvr_coding_config.h"
+#include "nxp_xcvr_fsk_h_0p5_config.h"
+#include "nxp_xcvr_gfsk_bt_0p3_h_0p5_config.h"
+#include "nxp_xcvr_gfsk_bt_0p5_h_0p32_config.h"
+#include "nxp_xcvr_gfsk_bt_0p5_h_0p5_config.h"
+#include "nxp_xcvr_gfsk_bt_0p5_h_0p7_config.h"
+#include "nxp_xcvr_gfsk_bt_0p5_h_1p0_config.h"
+#include "nxp_xcvr_gfsk_bt_0p7_h_0p5_config.h"
+#include "nxp_xcvr_gfsk_bt_1p0_h_0p5_config.h"
+#include "nxp_xcvr_gfsk_bt_2p0_h_0p5_config.h"
+#include "nxp_xcvr_msk_config.h"
+#include "nxp_xcvr_oqpsk_802p15p4_config.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/* Data rates of a mode with 1mbps, 500kbps and 250kbps configurations, the 1mbps one also covers 2Mbps */
+#define XCVR_REGISTRY_RATES(name)                          \
+    {                                                      \
+        [DR_1MBPS]   = &xcvr_##name##_1mbps_full_config,   \
+        [DR_500KBPS] = &xcvr_##name##_500kbps_full_config, \
+        [DR_250KBPS] = &xcvr_##name##_250kbps_full_config, \
+        [DR_2MBPS]   = &xcvr_##name##_1mbps_full_config,   \
+    }
+
+/* Data rates of a mode with only a 1mbps configuration, which also covers 2Mbps */
+#define XCVR_REGISTRY_1MBPS(name)                      \
+    {                                                  \
+        [DR_1MBPS] = &xcvr_##name##_1mbps_full_config, \
+        [DR_2MBPS] = &xcvr_##name##_1mbps_full_config, \
+    }
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+/* Only the configurations referenced here are kept by the linker for a registry based application */
+const xcvr_mode_registry_t xcvr_mode_registry = {
+    .config =
+        {
+#if (gXcvrRegistryBle_d == 1)
+            [BLE_MODE] = XCVR_REGISTRY_1MBPS(gfsk_bt_0p5_h_0p5),
+            /* Coded PHY runs on the 1Mbps configuration */
+            [BLE_LR] = {[DR_1MBPS] = &xcvr_gfsk_bt_0p5_h_0p5_1mbps_full_config},
+#endif
+#if defined(NXP_RADIO_GEN) && (NXP_RADIO_GEN >= 450) && (gXcvrRegistryOqpsk_d == 1)
+            [OQPSK_802P15P4] = {[DR_250KBPS] = &xcvr_oqpsk_802p15p4_250kbps_full_config},
+#endif
+#if (gXcvrRegistryGfskBt0p5H0p5_d == 1)
+            [GFSK_BT_0p5_h_0p5] = XCVR_REGISTRY_RATES(gfsk_bt_0p5_h_0p5),
+#endif
+#if (gXcvrRegistryGfskBt0p5H0p32_d == 1)
+            [GFSK_BT_0p5_h_0p32] = XCVR_REGISTRY_RATES(gfsk_bt_0p5_h_0p32),
+#endif
+#if (gXcvrRegistryGfskBt0p5H0p7_d == 1)
+            [GFSK_BT_0p5_h_0p7] = XCVR_REGISTRY_RATES(gfsk_bt_0p5_h_0p7),
+#endif
+#if (gXcvrRegistryGfskBt0p5H1p0_d == 1)
+            [GFSK_BT_0p5_h_1p0] = XCVR_REGISTRY_RATES(gfsk_bt_0p5_h_1p0),
+#endif
+#if (gXcvrRegistryGfskBt0p3H0p5_d == 1)
+            [GFSK_BT_0p3_h_0p5] = XCVR_REGISTRY_RATES(gfsk_bt_0p3_h_0p5),
+#endif
+#if (gXcvrRegistryGfskBt0p7H0p5_d == 1)
+            [GFSK_BT_0p7_h_0p5] = XCVR_REGISTRY_RATES(gfsk_bt_0p7_h_0p5),
+#endif
+#if (gXcvrRegistryMsk_d == 1)
+            [MSK] = XCVR_REGISTRY_RATES(msk),
+#endif
+#if (gXcvrRegistryFskH0p5_d == 1)
+            [FSK_H_0p5] = XCVR_REGISTRY_RATES(fsk_h_0p5),
+#endif
+#if (gXcvrRegistryGfskBt1p0H0p5_d == 1)
+            [GFSK_BT_1p0_h_0p5] = XCVR_REGISTRY_1MBPS(gfsk_bt_1p0_h_0p5),
+#endif
+#if (gXcvrRegistryGfskBt2p0H0p5_d == 1)
+            [GFSK_BT_2p0_h_0p5] = XCVR_REGISTRY_1MBPS(gfsk_bt_2p0_h_0p5),
+#endif
+        },
+    .coding =
+        {
+            [BLE_UNCODED] = &xcvr_ble_uncoded_config,
+#if (gXcvrRegistryBle_d == 1)
+            [BLE_CODED_S2] = &xcvr_ble_coded_s2_config,
+            [BLE_CODED_S8] = &xcvr_ble_coded_s8_config,
+#endif
+#if (gXcvrRegistryAnt_d == 1)
+            [ANT_UNCODED] = &xcvr_ant_uncoded_config,
+#endif
+        },
+};
+
+/*******************************************************************************
+ * Code
+ *******************************************************************************/
+xcvrStatus_t XCVR_GetModeConfig(radio_mode_t radio_mode,
+                                data_rate_t data_rate,
+                                coding_t coding,
+                                const xcvr_config_t **xcvr_config,
+                                const xcvr_coding_config_t **rbme_config)
+{
+    xcvrStatus_t status = gXcvrSuccess_c;
+    const xcvr_config_t *config;
+    const xcvr_coding_config_t *coding_config;
+
+    if ((xcvr_config == NULLPTR) || (rbme_config == NULLPTR) || ((uint32_t)radio_mode >= (uint32_t)NUM_RADIO_MODES) ||
+        ((uint32_t)data_rate >= XCVR_MODE_REGISTRY_NUM_RATES) || ((uint32_t)coding >= XCVR_MODE_REGISTRY_NUM_CODINGS))
+    {
+        status = gXcvrInvalidParameters_c;
+    }
+    else
+    {
+        config        = xcvr_mode_registry.config[radio_mode][data_rate];
+        coding_config = xcvr_mode_registry.coding[coding];
+        if ((config == NULLPTR) || (coding_config == NULLPTR))
+        {
+            status = gXcvrUnsupportedOperation_c; /* Combination not registered in this build */
+        }
+        else
+        {
+            *xcvr_config = config;
+            *rbme_config = coding_config;
+        }
+    }
+
+    return status;
+}
@@ -0,0 +1,18148 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/* Generated by tools/xcvr_reg_image_gen.c, do not edit */
+
+#include "nxp_xcvr_reg_images.h"
+#include "nxp_xcvr_fsk_h_0p5_config.h"
+#include "nxp_xcvr_gfsk_bt_0p3_h_0p5_config.h"
+#include "nxp_xcvr_gfsk_bt_0p5_h_0p32_config.h"
+#include "nxp_xcvr_gfsk_bt_0p5_h_0p5_config.h"
+#include "nxp_xcvr_gfsk_bt_0p5_h_0p7_config.h"
+#include "nxp_xcvr_gfsk_bt_0p5_h_1p0_config.h"
+#include "nxp_xcvr_gfsk_bt_0p7_h_0p5_config.h"
+#include "nxp_xcvr_gfsk_bt_1p0_h_0p5_config.h"
+#include "nxp_xcvr_gfsk_bt_2p0_h_0p5_config.h"
+#include "nxp_xcvr_msk_config.h"
+#include "nxp_xcvr_oqpsk_802p15p4_config.h"
+
+/* clang-format off */
+/* Common settings of the registers, from xcvr_common_config */
+/* GEN4PHY->DMD_CTRL0 */
+#define XCVR_FOLDED_DMD_CTRL0 \
+    (GEN4PHY_DMD_CTRL0_DEMOD_MOD(3) | GEN4PHY_DMD_CTRL0_DREP_SCALE_FREQ(0x04) | GEN4PHY_DMD_CTRL0_DREP_SINE_EN(0) | \
+        GEN4PHY_DMD_CTRL0_FED_ACT_WIN(1) | GEN4PHY_DMD_CTRL0_FED_ERR_SCALE(3) | GEN4PHY_DMD_CTRL0_FERR_TRK_EN(1) | \
+        GEN4PHY_DMD_CTRL0_REPEAT_FACTOR(1) | GEN4PHY_DMD_CTRL0_TED_ACT_WIN(1) | GEN4PHY_DMD_CTRL0_TERR_TRK_EN(1))
+/* GEN4PHY->DMD_CTRL1 */
+#define XCVR_FOLDED_DMD_CTRL1 \
+    (GEN4PHY_DMD_CTRL1_FED_IDLE_WIN(0x008) | GEN4PHY_DMD_CTRL1_FED_IMM_MEAS_EN(1) | \
+        GEN4PHY_DMD_CTRL1_TED_ERR_SCALE(0x04) | GEN4PHY_DMD_CTRL1_TED_IDLE_WIN(0x004) | \
+        GEN4PHY_DMD_CTRL1_TED_IMM_MEAS_EN(1) | GEN4PHY_DMD_CTRL1_TTRK_INT_RANGE(0x0A))
+/* GEN4PHY->FSK_CFG0 */
+#define XCVR_FOLDED_FSK_CFG0 \
+    (GEN4PHY_FSK_CFG0_AA_OUT_SEL(1) | GEN4PHY_FSK_CFG0_BLE_NTW_ADR_THR(0) | \
+        GEN4PHY_FSK_CFG0_FSK_BIT_INVERT(0) | GEN4PHY_FSK_CFG0_HAMMING_AA_LOW_PWR(0))
+/* GEN4PHY->FSK_CFG2 */
+#define XCVR_FOLDED_FSK_CFG2 \
+    (GEN4PHY_FSK_CFG2_MAG_WIN(0x04))
+/* GEN4PHY->FSK_FAD_CFG */
+#define XCVR_FOLDED_FSK_FAD_CFG \
+    (GEN4PHY_FSK_FAD_CFG_WIN_FAD_SEARCH_PD(0x00) | GEN4PHY_FSK_FAD_CFG_WIN_FAD_WAIT_PD(0x00) | \
+        GEN4PHY_FSK_FAD_CFG_WIN_FAD_WAIT_SYNCH(0x00) | GEN4PHY_FSK_FAD_CFG_WIN_SEARCH_PD(0x00))
+/* GEN4PHY->FSK_FAD_CTRL */
+#define XCVR_FOLDED_FSK_FAD_CTRL \
+    (GEN4PHY_FSK_FAD_CTRL_FAD_EN(0))
+/* GEN4PHY->FSK_PT */
+#define XCVR_FOLDED_FSK_PT \
+    (GEN4PHY_FSK_PT_BYPASS_WITH_RSSI(0) | GEN4PHY_FSK_PT_COND_AA_BUFF_EN(0) | GEN4PHY_FSK_PT_COND_SIG_PRST_EN(0))
+/* GEN4PHY->MISC */
+#define XCVR_FOLDED_MISC \
+    (GEN4PHY_MISC_DMA_PAGE_SEL(0) | GEN4PHY_MISC_DTEST_MUX_EN(0) | GEN4PHY_MISC_ECO1_RSVD(0x00) | \
+        GEN4PHY_MISC_ECO2_RSVD(0x0) | GEN4PHY_MISC_PHY_CLK_CTRL(0x03FF) | GEN4PHY_MISC_PHY_CLK_ON(0) | \
+        GEN4PHY_MISC_RSSI_CORR_TH(0xA0))
+/* GEN4PHY->PREPHY_MISC */
+#define XCVR_FOLDED_PREPHY_MISC \
+    (GEN4PHY_PREPHY_MISC_BUFF_PTR_GFSK(0x0C) | GEN4PHY_PREPHY_MISC_BUFF_PTR_LR(0x10))
+/* GEN4PHY->RTT_CTRL */
+#define XCVR_FOLDED_RTT_CTRL \
+    (GEN4PHY_RTT_CTRL_EN_HIGH_ACC_RTT(0) | GEN4PHY_RTT_CTRL_FIRST_PDU_BIT(0) | \
+        GEN4PHY_RTT_CTRL_HA_RTT_THRESHOLD(0x166) | GEN4PHY_RTT_CTRL_OVERRD_PROGR_AA(1) | \
+        GEN4PHY_RTT_CTRL_RTT_SEQ_LEN(0))
+/* GEN4PHY->SM_CFG */
+#if RF_OSC_26MHZ == 1
+#define XCVR_FOLDED_SM_CFG \
+    (GEN4PHY_SM_CFG_ACQ_MODE(2) | GEN4PHY_SM_CFG_AGC_FRZ_ON_PD_FOUND_ACQ1_LR(0) | \
+        GEN4PHY_SM_CFG_EARLY_PD_TIMEOUT(0x24) | GEN4PHY_SM_CFG_EN_PHY_SM_EXT_RST(0) | \
+        GEN4PHY_SM_CFG_PH_BUFF_PTR_SYM(5))
+#else
+#define XCVR_FOLDED_SM_CFG \
+    (GEN4PHY_SM_CFG_ACQ_MODE(2) | GEN4PHY_SM_CFG_AGC_FRZ_ON_PD_FOUND_ACQ1_LR(0) | \
+        GEN4PHY_SM_CFG_EARLY_PD_TIMEOUT(0x24) | GEN4PHY_SM_CFG_EN_PHY_SM_EXT_RST(0) | \
+        GEN4PHY_SM_CFG_PH_BUFF_PTR_SYM(3))
+#endif /* RF_OSC_26MHZ == 1 */
+/* XCVR_ANALOG->LDO_0 */
+#define XCVR_FOLDED_LDO_0 \
+    (XCVR_ANALOG_LDO_0_BG_FORCE(0) | XCVR_ANALOG_LDO_0_LDOTRIM_TRIM_VREF(0) | \
+        XCVR_ANALOG_LDO_0_LDO_CAL_BYPASS(0) | XCVR_ANALOG_LDO_0_LDO_CAL_FORCE(0) | \
+        XCVR_ANALOG_LDO_0_LDO_CAL_PTAT_BUMP(2) | XCVR_ANALOG_LDO_0_LDO_LV_BYPASS(0) | \
+        XCVR_ANALOG_LDO_0_LDO_LV_TRIM(0) | XCVR_ANALOG_LDO_0_LDO_PLL_BYPASS(0) | \
+        XCVR_ANALOG_LDO_0_LDO_PLL_FORCE(0) | XCVR_ANALOG_LDO_0_LDO_PLL_PTAT_BUMP(2) | \
+        XCVR_ANALOG_LDO_0_LDO_RXTXHF_BYPASS(0) | XCVR_ANALOG_LDO_0_LDO_RXTXHF_FORCE(0) | \
+        XCVR_ANALOG_LDO_0_LDO_RXTXHF_PTAT_BUMP(2) | XCVR_ANALOG_LDO_0_LDO_RXTXLF_BYPASS(0) | \
+        XCVR_ANALOG_LDO_0_LDO_RXTXLF_FORCE(0) | XCVR_ANALOG_LDO_0_LDO_RXTXLF_PTAT_BUMP(0) | \
+        XCVR_ANALOG_LDO_0_LDO_VCO_BYPASS(0) | XCVR_ANALOG_LDO_0_LDO_VCO_FORCE(0) | \
+        XCVR_ANALOG_LDO_0_LDO_VCO_PTAT_BUMP(2))
+/* XCVR_ANALOG->LDO_1 */
+#define XCVR_FOLDED_LDO_1 \
+    (XCVR_ANALOG_LDO_1_LDO_ANT_BYPASS(0) | XCVR_ANALOG_LDO_1_LDO_ANT_HIZ(0) | \
+        XCVR_ANALOG_LDO_1_LDO_ANT_REF_SEL(0) | XCVR_ANALOG_LDO_1_LDO_ANT_TRIM(5))
+/* XCVR_ANALOG->PLL */
+#if RF_OSC_26MHZ == 1
+#define XCVR_FOLDED_PLL \
+    (XCVR_ANALOG_PLL_PLL_FCAL_EN_STATIC_RES(0) | XCVR_ANALOG_PLL_PLL_PD_EN_VPD_PULLDN(0) | \
+        XCVR_ANALOG_PLL_PLL_PD_EN_VPD_PULLUP(0) | XCVR_ANALOG_PLL_PLL_PD_TRIM_FCAL_BIAS(0) | \
+        XCVR_ANALOG_PLL_PLL_VCO_EN_PKDET(0) | \
+        XCVR_ANALOG_PLL_PLL_VCO_TRIM_KVT(7))
+#else
+#define XCVR_FOLDED_PLL \
+    (XCVR_ANALOG_PLL_PLL_FCAL_EN_STATIC_RES(0) | XCVR_ANALOG_PLL_PLL_PD_EN_VPD_PULLDN(0) | \
+        XCVR_ANALOG_PLL_PLL_PD_EN_VPD_PULLUP(0) | XCVR_ANALOG_PLL_PLL_PD_TRIM_FCAL_BIAS(0) | \
+        XCVR_ANALOG_PLL_PLL_VCO_EN_PKDET(0) | \
+        XCVR_ANALOG_PLL_PLL_VCO_TRIM_KVT(4))
+#endif /* RF_OSC_26MHZ == 1 */
+/* XCVR_ANALOG->RX_0 */
+#define XCVR_FOLDED_RX_0 \
+    (XCVR_ANALOG_RX_0_ADC_INVERT_CLK(0) | XCVR_ANALOG_RX_0_ADC_TRIM(1) | XCVR_ANALOG_RX_0_RX_LNA_ITRIM(2) | \
+        XCVR_ANALOG_RX_0_RX_LNA_PTAT_FORCE_START(0) | XCVR_ANALOG_RX_0_RX_MIX_VBIAS(0))
+/* XCVR_ANALOG->RX_1 */
+#define XCVR_FOLDED_RX_1 \
+    (XCVR_ANALOG_RX_1_CBPF_TRIM_I(0) | XCVR_ANALOG_RX_1_CBPF_TRIM_Q(0) | \
+        XCVR_ANALOG_RX_1_CBPF_TRIM_SHORT_DCBIAS(2) | XCVR_ANALOG_RX_1_CBPF_TYPE(1) | \
+        XCVR_ANALOG_RX_1_CBPF_VCM_TRIM(2))
+/* XCVR_ANALOG->TX_DAC_PA */
+#define XCVR_FOLDED_TX_DAC_PA \
+    (XCVR_ANALOG_TX_DAC_PA_DAC_INVERT_CLK(0) | XCVR_ANALOG_TX_DAC_PA_DAC_TRIM_CFBK(1) | \
+        XCVR_ANALOG_TX_DAC_PA_DAC_TRIM_IBIAS(0) | XCVR_ANALOG_TX_DAC_PA_DAC_TRIM_RLOAD(0) | \
+        XCVR_ANALOG_TX_DAC_PA_TX_PA_VBIAS(0))
+/* XCVR_ANALOG->XO_DIST */
+#define XCVR_FOLDED_XO_DIST \
+    (XCVR_ANALOG_XO_DIST_XO_DIST_BYPASS(0) | XCVR_ANALOG_XO_DIST_XO_DIST_FLIP(0) | \
+        XCVR_ANALOG_XO_DIST_XO_DIST_TRIM(0))
+/* XCVR_MISC->LDO_TRIM_0 */
+#define XCVR_FOLDED_LDO_TRIM_0 \
+    (XCVR_MISC_LDO_TRIM_0_LDO_CAL_TRIMSEL_OVRD(0) | XCVR_MISC_LDO_TRIM_0_LDO_PLL_TRIMSEL_OVRD(0) | \
+        XCVR_MISC_LDO_TRIM_0_LDO_PLL_TRIM_OFFSET(0) | XCVR_MISC_LDO_TRIM_0_LDO_RXTXHF_TRIMSEL_OVRD(0) | \
+        XCVR_MISC_LDO_TRIM_0_LDO_RXTXHF_TRIM_OFFSET(0) | XCVR_MISC_LDO_TRIM_0_LDO_RXTXLF_TRIM_OFFSET(0) | \
+        XCVR_MISC_LDO_TRIM_0_LDO_SAMPLE_TRIMSEL_OVRD_EN(0) | XCVR_MISC_LDO_TRIM_0_LDO_TRIM_CMPOUT_INV(0) | \
+        XCVR_MISC_LDO_TRIM_0_LDO_TRIM_SAMPLE_OVRD(0) | XCVR_MISC_LDO_TRIM_0_LDO_TRIM_SMPL_DLY(2) | \
+        XCVR_MISC_LDO_TRIM_0_LDO_VCO_TRIMSEL_OVRD(0) | XCVR_MISC_LDO_TRIM_0_LDO_VCO_TRIM_OFFSET(0))
+/* XCVR_MISC->LDO_TRIM_1 */
+#define XCVR_FOLDED_LDO_TRIM_1 \
+    (XCVR_MISC_LDO_TRIM_1_LDO_PLL_TRIM_OVRD(0) | XCVR_MISC_LDO_TRIM_1_LDO_PLL_TRIM_OVRD_EN(0) | \
+        XCVR_MISC_LDO_TRIM_1_LDO_RXTXHF_TRIM_OVRD(0) | XCVR_MISC_LDO_TRIM_1_LDO_RXTXHF_TRIM_OVRD_EN(0) | \
+        XCVR_MISC_LDO_TRIM_1_LDO_RXTXLF_TRIM_OVRD(0) | XCVR_MISC_LDO_TRIM_1_LDO_RXTXLF_TRIM_OVRD_EN(0) | \
+        XCVR_MISC_LDO_TRIM_1_LDO_VCO_TRIM_OVRD(0) | XCVR_MISC_LDO_TRIM_1_LDO_VCO_TRIM_OVRD_EN(0))
+/* XCVR_MISC->XCVR_CTRL */
+#if RF_OSC_26MHZ == 1
+#define XCVR_FOLDED_XCVR_CTRL \
+    (XCVR_MISC_XCVR_CTRL_DATA_RATE(1) | XCVR_MISC_XCVR_CTRL_FO_RX_EN(1) | XCVR_MISC_XCVR_CTRL_FO_TX_EN(1) | \
+        XCVR_MISC_XCVR_CTRL_LPPS_ENABLE(0) | XCVR_MISC_XCVR_CTRL_SDCLK_OUT_EN(0) | \
+        XCVR_MISC_XCVR_CTRL_TOF_RX_SEL(0) | XCVR_MISC_XCVR_CTRL_TOF_TX_SEL(0) | \
+        XCVR_MISC_XCVR_CTRL_REF_CLK_FREQ(1) | \
+        XCVR_MISC_XCVR_CTRL_XCVR_SOFT_RESET(0))
+#else
+#define XCVR_FOLDED_XCVR_CTRL \
+    (XCVR_MISC_XCVR_CTRL_DATA_RATE(1) | XCVR_MISC_XCVR_CTRL_FO_RX_EN(1) | XCVR_MISC_XCVR_CTRL_FO_TX_EN(1) | \
+        XCVR_MISC_XCVR_CTRL_LPPS_ENABLE(0) | XCVR_MISC_XCVR_CTRL_SDCLK_OUT_EN(0) | \
+        XCVR_MISC_XCVR_CTRL_TOF_RX_SEL(0) | XCVR_MISC_XCVR_CTRL_TOF_TX_SEL(0) | \
+        XCVR_MISC_XCVR_CTRL_REF_CLK_FREQ(0) | \
+        XCVR_MISC_XCVR_CTRL_XCVR_SOFT_RESET(0))
+#endif /* RF_OSC_26MHZ == 1 */
+/* XCVR_PLL_DIG->CHAN_MAP */
+#define XCVR_FOLDED_CHAN_MAP \
+    (XCVR_PLL_DIG_CHAN_MAP_BMR(0) | XCVR_PLL_DIG_CHAN_MAP_CHANNEL_NUM_OVRD(0x0000) | \
+        XCVR_PLL_DIG_CHAN_MAP_HOP_TBL_CFG_OVRD(0) | XCVR_PLL_DIG_CHAN_MAP_HOP_TBL_CFG_OVRD_EN(0))
+/* XCVR_PLL_DIG->CHAN_MAP_EXT */
+#define XCVR_FOLDED_CHAN_MAP_EXT \
+    (XCVR_PLL_DIG_CHAN_MAP_EXT_CTUNE_TGT_OFFSET(0))
+/* XCVR_PLL_DIG->DATA_RATE_OVRD_CTRL1 */
+#define XCVR_FOLDED_DATA_RATE_OVRD_CTRL1 \
+    (XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL1_HPM_CAL_SCALE_CFG1(0x9) | \
+        XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL1_HPM_FDB_RES_CAL_CFG1(0) | \
+        XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL1_HPM_FDB_RES_TX_CFG1(0) | \
+        XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL1_LPM_SCALE_CFG1(0x8))
+/* XCVR_PLL_DIG->DELAY_MATCH */
+#define XCVR_FOLDED_DELAY_MATCH \
+    (XCVR_PLL_DIG_DELAY_MATCH_HPM_SDM_DELAY(0x01))
+/* XCVR_PLL_DIG->HPMCAL_CTRL */
+#define XCVR_FOLDED_HPMCAL_CTRL \
+    (XCVR_PLL_DIG_HPMCAL_CTRL_HPM_CAL_BUMPED(0) | XCVR_PLL_DIG_HPMCAL_CTRL_HPM_CAL_COUNT_SCALE(0) | \
+        XCVR_PLL_DIG_HPMCAL_CTRL_HPM_CAL_FACTOR_MANUAL(0x0000) | XCVR_PLL_DIG_HPMCAL_CTRL_HPM_CAL_SKIP(0) | \
+        XCVR_PLL_DIG_HPMCAL_CTRL_HP_CAL_DISABLE(0))
+/* XCVR_PLL_DIG->HPM_BUMP */
+#define XCVR_FOLDED_HPM_BUMP \
+    (XCVR_PLL_DIG_HPM_BUMP_HPM_FDB_RES_CAL(0) | XCVR_PLL_DIG_HPM_BUMP_HPM_FDB_RES_TX(1) | \
+        XCVR_PLL_DIG_HPM_BUMP_PLL_VCO_TRIM_KVM_CAL(0x4) | XCVR_PLL_DIG_HPM_BUMP_PLL_VCO_TRIM_KVM_TX(0x4))
+/* XCVR_PLL_DIG->HPM_CAL_TIMING */
+#define XCVR_FOLDED_HPM_CAL_TIMING \
+    (XCVR_PLL_DIG_HPM_CAL_TIMING_HPM_CAL1_SETTLE_TIME(0x0) | XCVR_PLL_DIG_HPM_CAL_TIMING_HPM_CAL2_SETTLE_TIME(0x0) | \
+        XCVR_PLL_DIG_HPM_CAL_TIMING_HPM_CTUNE_SETTLE_TIME(0x0) | XCVR_PLL_DIG_HPM_CAL_TIMING_HPM_VCO_MOD_DELAY(0x0))
+/* XCVR_PLL_DIG->HPM_CTRL */
+#define XCVR_FOLDED_HPM_CTRL \
+    (XCVR_PLL_DIG_HPM_CTRL_HPM_CAL_INVERT(0) | XCVR_PLL_DIG_HPM_CTRL_HPM_CAL_TIME(0) | \
+        XCVR_PLL_DIG_HPM_CTRL_HPM_CLK_CONFIG(0) | XCVR_PLL_DIG_HPM_CTRL_HPM_DTH_EN(1) | \
+        XCVR_PLL_DIG_HPM_CTRL_HPM_DTH_SCL(0) | XCVR_PLL_DIG_HPM_CTRL_HPM_INTEGER_INVERT(0) | \
+        XCVR_PLL_DIG_HPM_CTRL_HPM_LFSR_SIZE(4) | XCVR_PLL_DIG_HPM_CTRL_HPM_MOD_IN_INVERT(0) | \
+        XCVR_PLL_DIG_HPM_CTRL_HPM_SCALE(0) | XCVR_PLL_DIG_HPM_CTRL_HPM_SDM_IN_DISABLE(0) | \
+        XCVR_PLL_DIG_HPM_CTRL_HPM_SDM_IN_MANUAL(0x0000) | XCVR_PLL_DIG_HPM_CTRL_HPM_SDM_OUT_INVERT(0) | \
+        XCVR_PLL_DIG_HPM_CTRL_RX_HPM_CAL_EN(0))
+/* XCVR_PLL_DIG->HPM_SDM_RES */
+#define XCVR_FOLDED_HPM_SDM_RES \
+    (XCVR_PLL_DIG_HPM_SDM_RES_HPM_DENOM(0x00FF))
+/* XCVR_PLL_DIG->LOCK_DETECT */
+#define XCVR_FOLDED_LOCK_DETECT \
+    (XCVR_PLL_DIG_LOCK_DETECT_CTUNE_LDF_LEV(0x08) | XCVR_PLL_DIG_LOCK_DETECT_FCAL_HOLD_EN(0) | \
+        XCVR_PLL_DIG_LOCK_DETECT_FREQ_COUNT_GO(0) | XCVR_PLL_DIG_LOCK_DETECT_FREQ_COUNT_TIME(0) | \
+        XCVR_PLL_DIG_LOCK_DETECT_FTF_RX_THRSH(0x21) | XCVR_PLL_DIG_LOCK_DETECT_FTF_TX_THRSH(0x06) | \
+        XCVR_PLL_DIG_LOCK_DETECT_FTW_TXRX(7))
+/* XCVR_PLL_DIG->LPM_CTRL */
+#define XCVR_FOLDED_LPM_CTRL \
+    (XCVR_PLL_DIG_LPM_CTRL_HPM_CAL_SCALE(0x0A) | XCVR_PLL_DIG_LPM_CTRL_LPM_DISABLE(0) | \
+        XCVR_PLL_DIG_LPM_CTRL_LPM_DTH_SCL(0x08) | XCVR_PLL_DIG_LPM_CTRL_LPM_D_CTRL(0) | \
+        XCVR_PLL_DIG_LPM_CTRL_LPM_D_OVRD(1) | XCVR_PLL_DIG_LPM_CTRL_LPM_SCALE(0x08) | \
+        XCVR_PLL_DIG_LPM_CTRL_LPM_SDM_INV(0) | XCVR_PLL_DIG_LPM_CTRL_LPM_SDM_USE_NEG(1) | \
+        XCVR_PLL_DIG_LPM_CTRL_PLL_LD_DISABLE(0) | XCVR_PLL_DIG_LPM_CTRL_PLL_LD_MANUAL(0x00))
+/* XCVR_PLL_DIG->LPM_SDM_CTRL1 */
+#define XCVR_FOLDED_LPM_SDM_CTRL1 \
+    (XCVR_PLL_DIG_LPM_SDM_CTRL1_HPM_ARRAY_BIAS(0x00) | XCVR_PLL_DIG_LPM_SDM_CTRL1_LPM_INTG(0x26) | \
+        XCVR_PLL_DIG_LPM_SDM_CTRL1_SDM_MAP_DISABLE(0))
+/* XCVR_PLL_DIG->MOD_CTRL */
+#define XCVR_FOLDED_MOD_CTRL \
+    (XCVR_PLL_DIG_MOD_CTRL_HPM_MOD_DISABLE(0) | XCVR_PLL_DIG_MOD_CTRL_HPM_MOD_MANUAL(0x00) | \
+        XCVR_PLL_DIG_MOD_CTRL_HPM_SDM_OUT_DISABLE(1) | XCVR_PLL_DIG_MOD_CTRL_HPM_SDM_OUT_MANUAL(0) | \
+        XCVR_PLL_DIG_MOD_CTRL_MODULATION_WORD_MANUAL(0x0000) | XCVR_PLL_DIG_MOD_CTRL_MOD_DISABLE(0))
+/* XCVR_PLL_DIG->PLL_DATARATE_CTRL */
+#define XCVR_FOLDED_PLL_DATARATE_CTRL \
+    (XCVR_PLL_DIG_PLL_DATARATE_CTRL_HPM_INTEGER_DELAY_DRS(0x04) | \
+        XCVR_PLL_DIG_PLL_DATARATE_CTRL_HPM_SDM_DELAY_DRS(0x01) | XCVR_PLL_DIG_PLL_DATARATE_CTRL_HPM_VCM_CAL_DRS(4) | \
+        XCVR_PLL_DIG_PLL_DATARATE_CTRL_HPM_VCM_TX_DRS(4) | XCVR_PLL_DIG_PLL_DATARATE_CTRL_LPM_SDM_DELAY_DRS(0x02) | \
+        XCVR_PLL_DIG_PLL_DATARATE_CTRL_PLL_VCO_TRIM_KVM_CAL_DRS(6) | \
+        XCVR_PLL_DIG_PLL_DATARATE_CTRL_PLL_VCO_TRIM_KVM_TX_DRS(6))
+/* XCVR_PLL_DIG->TUNING_CAP_RX_CTRL */
+#define XCVR_FOLDED_TUNING_CAP_RX_CTRL \
+    (XCVR_PLL_DIG_TUNING_CAP_RX_CTRL_TUNING_RANGE_0(0) | XCVR_PLL_DIG_TUNING_CAP_RX_CTRL_TUNING_RANGE_1(0) | \
+        XCVR_PLL_DIG_TUNING_CAP_RX_CTRL_TUNING_RANGE_2(0) | XCVR_PLL_DIG_TUNING_CAP_RX_CTRL_TUNING_RANGE_3(0) | \
+        XCVR_PLL_DIG_TUNING_CAP_RX_CTRL_TUNING_RANGE_4(0) | XCVR_PLL_DIG_TUNING_CAP_RX_CTRL_TUNING_RANGE_5(0) | \
+        XCVR_PLL_DIG_TUNING_CAP_RX_CTRL_TUNING_RANGE_6(0) | XCVR_PLL_DIG_TUNING_CAP_RX_CTRL_TUNING_RANGE_7(0))
+/* XCVR_PLL_DIG->TUNING_CAP_TX_CTRL */
+#define XCVR_FOLDED_TUNING_CAP_TX_CTRL \
+    (XCVR_PLL_DIG_TUNING_CAP_TX_CTRL_TUNING_RANGE_0(3) | XCVR_PLL_DIG_TUNING_CAP_TX_CTRL_TUNING_RANGE_1(4) | \
+        XCVR_PLL_DIG_TUNING_CAP_TX_CTRL_TUNING_RANGE_2(6) | XCVR_PLL_DIG_TUNING_CAP_TX_CTRL_TUNING_RANGE_3(7) | \
+        XCVR_PLL_DIG_TUNING_CAP_TX_CTRL_TUNING_RANGE_4(7) | XCVR_PLL_DIG_TUNING_CAP_TX_CTRL_TUNING_RANGE_5(7) | \
+        XCVR_PLL_DIG_TUNING_CAP_TX_CTRL_TUNING_RANGE_6(7) | XCVR_PLL_DIG_TUNING_CAP_TX_CTRL_TUNING_RANGE_7(7))
+/* XCVR_RX_DIG->AGC_CTRL */
+#define XCVR_FOLDED_AGC_CTRL \
+    (XCVR_RX_DIG_AGC_CTRL_AGC_DELTA_SLOW_EN(0) | XCVR_RX_DIG_AGC_CTRL_AGC_DELTA_SLOW_STEP(1) | \
+        XCVR_RX_DIG_AGC_CTRL_AGC_FAST_EN(1) | XCVR_RX_DIG_AGC_CTRL_AGC_FAST_STEP_UP_EN(0) | \
+        XCVR_RX_DIG_AGC_CTRL_AGC_HOLD_EN(2) | XCVR_RX_DIG_AGC_CTRL_AGC_SLOW_EN(1) | \
+        XCVR_RX_DIG_AGC_CTRL_AGC_UNHOLD_FEAT_EN(1) | XCVR_RX_DIG_AGC_CTRL_AGC_WBD_AUTO_DIS_CFG(1) | \
+        XCVR_RX_DIG_AGC_CTRL_AGC_WBD_EN(1) | XCVR_RX_DIG_AGC_CTRL_AGC_WBD_GAIN_LIMIT_EN(1) | \
+        XCVR_RX_DIG_AGC_CTRL_AGC_WBD_STEP1_DUAL_CLIP_EN(0) | XCVR_RX_DIG_AGC_CTRL_AGC_WBD_STEP1_SZ(2) | \
+        XCVR_RX_DIG_AGC_CTRL_AGC_WBD_STEP2_DUAL_CLIP_EN(0) | XCVR_RX_DIG_AGC_CTRL_AGC_WBD_STEP2_SZ(1) | \
+        XCVR_RX_DIG_AGC_CTRL_AGC_WBD_THR1(0x3) | XCVR_RX_DIG_AGC_CTRL_AGC_WBD_THR2(0xE))
+/* XCVR_RX_DIG->AGC_CTRL_STAT */
+#define XCVR_FOLDED_AGC_CTRL_STAT \
+    (XCVR_RX_DIG_AGC_CTRL_STAT_AGC_CALC_MAG_IN_FRZ(1) | XCVR_RX_DIG_AGC_CTRL_STAT_AGC_FREEZE_EN(1) | \
+        XCVR_RX_DIG_AGC_CTRL_STAT_AGC_GAIN_IDX_STORE(0) | XCVR_RX_DIG_AGC_CTRL_STAT_AGC_INIT_IDX(0xB) | \
+        XCVR_RX_DIG_AGC_CTRL_STAT_AGC_MAX_IDX(0) | XCVR_RX_DIG_AGC_CTRL_STAT_AGC_PHY_FREEZE_TRIG_SEL(0) | \
+        XCVR_RX_DIG_AGC_CTRL_STAT_AGC_PHY_HOLD_TRIG_SEL(0) | XCVR_RX_DIG_AGC_CTRL_STAT_AGC_SOFT_RST_GAIN_SEL(0) | \
+        XCVR_RX_DIG_AGC_CTRL_STAT_AGC_SOFT_RST_SRC_SEL(1) | XCVR_RX_DIG_AGC_CTRL_STAT_AGC_UNFREEZE_FEAT_EN(1))
+/* XCVR_RX_DIG->AGC_IDX0_GAIN_CFG */
+#define XCVR_FOLDED_AGC_IDX0_GAIN_CFG \
+    (XCVR_RX_DIG_AGC_IDX0_GAIN_CFG_ANT_EN_RLOAD_0(0) | XCVR_RX_DIG_AGC_IDX0_GAIN_CFG_CBPF_GAIN_0(0) | \
+        XCVR_RX_DIG_AGC_IDX0_GAIN_CFG_LNA_ATTN_0(3) | XCVR_RX_DIG_AGC_IDX0_GAIN_CFG_LNA_HATTN_0(1) | \
+        XCVR_RX_DIG_AGC_IDX0_GAIN_CFG_LNA_HGAIN_0(0x00) | XCVR_RX_DIG_AGC_IDX0_GAIN_CFG_LNA_LGAIN_0(1) | \
+        XCVR_RX_DIG_AGC_IDX0_GAIN_CFG_LNA_RTRIM_0(1) | XCVR_RX_DIG_AGC_IDX0_GAIN_CFG_MAG_THR_0_DRS_OFS(0x00) | \
+        XCVR_RX_DIG_AGC_IDX0_GAIN_CFG_MAG_THR_HI_0_DRS_OFS(0x00))
+/* XCVR_RX_DIG->AGC_IDX0_GAIN_VAL */
+#define XCVR_FOLDED_AGC_IDX0_GAIN_VAL \
+    (XCVR_RX_DIG_AGC_IDX0_GAIN_VAL_LOG_GAIN_0(0x3FD) | \
+        XCVR_RX_DIG_AGC_IDX0_GAIN_VAL_MAG_THR_0(0x000) | \
+        XCVR_RX_DIG_AGC_IDX0_GAIN_VAL_MAG_THR_HI_0(0x000))
+/* XCVR_RX_DIG->AGC_IDX0_THR */
+#define XCVR_FOLDED_AGC_IDX0_THR \
+    (XCVR_RX_DIG_AGC_IDX0_THR_STEP_UP_THR_0(0x01E))
+/* XCVR_RX_DIG->AGC_IDX10_GAIN_CFG */
+#define XCVR_FOLDED_AGC_IDX10_GAIN_CFG \
+    (XCVR_RX_DIG_AGC_IDX10_GAIN_CFG_ANT_EN_RLOAD_10(0) | XCVR_RX_DIG_AGC_IDX10_GAIN_CFG_CBPF_GAIN_10(1) | \
+        XCVR_RX_DIG_AGC_IDX10_GAIN_CFG_LNA_ATTN_10(0) | XCVR_RX_DIG_AGC_IDX10_GAIN_CFG_LNA_HATTN_10(0) | \
+        XCVR_RX_DIG_AGC_IDX10_GAIN_CFG_LNA_HGAIN_10(0x25) | XCVR_RX_DIG_AGC_IDX10_GAIN_CFG_LNA_LGAIN_10(0) | \
+        XCVR_RX_DIG_AGC_IDX10_GAIN_CFG_LNA_RTRIM_10(1) | XCVR_RX_DIG_AGC_IDX10_GAIN_CFG_MAG_THR_10_DRS_OFS(0x00) | \
+        XCVR_RX_DIG_AGC_IDX10_GAIN_CFG_MAG_THR_HI_10_DRS_OFS(0x00))
+/* XCVR_RX_DIG->AGC_IDX10_GAIN_VAL */
+#define XCVR_FOLDED_AGC_IDX10_GAIN_VAL \
+    (XCVR_RX_DIG_AGC_IDX10_GAIN_VAL_LOG_GAIN_10(0x0EB) | \
+        XCVR_RX_DIG_AGC_IDX10_GAIN_VAL_MAG_THR_10(0x000) | \
+        XCVR_RX_DIG_AGC_IDX10_GAIN_VAL_MAG_THR_HI_10(0x000))
+/* XCVR_RX_DIG->AGC_IDX10_THR */
+#define XCVR_FOLDED_AGC_IDX10_THR \
+    (XCVR_RX_DIG_AGC_IDX10_THR_STEP_DOWN_THR_10(0x096) | \
+        XCVR_RX_DIG_AGC_IDX10_THR_STEP_DOWN_THR_10_DRS_OFS(0x00) | \
+        XCVR_RX_DIG_AGC_IDX10_THR_STEP_UP_THR_10(0x01E))
+/* XCVR_RX_DIG->AGC_IDX11_GAIN_CFG */
+#define XCVR_FOLDED_AGC_IDX11_GAIN_CFG \
+    (XCVR_RX_DIG_AGC_IDX11_GAIN_CFG_ANT_EN_RLOAD_11(0) | XCVR_RX_DIG_AGC_IDX11_GAIN_CFG_CBPF_GAIN_11(1) | \
+        XCVR_RX_DIG_AGC_IDX11_GAIN_CFG_LNA_ATTN_11(0) | XCVR_RX_DIG_AGC_IDX11_GAIN_CFG_LNA_HATTN_11(0) | \
+        XCVR_RX_DIG_AGC_IDX11_GAIN_CFG_LNA_HGAIN_11(0x3F) | XCVR_RX_DIG_AGC_IDX11_GAIN_CFG_LNA_LGAIN_11(0) | \
+        XCVR_RX_DIG_AGC_IDX11_GAIN_CFG_LNA_RTRIM_11(1))
+/* XCVR_RX_DIG->AGC_IDX11_GAIN_VAL */
+#define XCVR_FOLDED_AGC_IDX11_GAIN_VAL \
+    (XCVR_RX_DIG_AGC_IDX11_GAIN_VAL_LOG_GAIN_11(0x0FA))
+/* XCVR_RX_DIG->AGC_IDX11_THR */
+#define XCVR_FOLDED_AGC_IDX11_THR \
+    (XCVR_RX_DIG_AGC_IDX11_THR_STEP_DOWN_THR_11(0x078) | XCVR_RX_DIG_AGC_IDX11_THR_STEP_DOWN_THR_11_DRS_OFS(0x00))
+/* XCVR_RX_DIG->AGC_IDX1_GAIN_CFG */
+#define XCVR_FOLDED_AGC_IDX1_GAIN_CFG \
+    (XCVR_RX_DIG_AGC_IDX1_GAIN_CFG_ANT_EN_RLOAD_1(0) | XCVR_RX_DIG_AGC_IDX1_GAIN_CFG_CBPF_GAIN_1(0) | \
+        XCVR_RX_DIG_AGC_IDX1_GAIN_CFG_LNA_ATTN_1(3) | XCVR_RX_DIG_AGC_IDX1_GAIN_CFG_LNA_HATTN_1(0) | \
+        XCVR_RX_DIG_AGC_IDX1_GAIN_CFG_LNA_HGAIN_1(0x00) | XCVR_RX_DIG_AGC_IDX1_GAIN_CFG_LNA_LGAIN_1(3) | \
+        XCVR_RX_DIG_AGC_IDX1_GAIN_CFG_LNA_RTRIM_1(1) | XCVR_RX_DIG_AGC_IDX1_GAIN_CFG_MAG_THR_1_DRS_OFS(0x00) | \
+        XCVR_RX_DIG_AGC_IDX1_GAIN_CFG_MAG_THR_HI_1_DRS_OFS(0x00))
+/* XCVR_RX_DIG->AGC_IDX1_GAIN_VAL */
+#define XCVR_FOLDED_AGC_IDX1_GAIN_VAL \
+    (XCVR_RX_DIG_AGC_IDX1_GAIN_VAL_LOG_GAIN_1(0x00B) | \
+        XCVR_RX_DIG_AGC_IDX1_GAIN_VAL_MAG_THR_1(0x000) | \
+        XCVR_RX_DIG_AGC_IDX1_GAIN_VAL_MAG_THR_HI_1(0x000))
+/* XCVR_RX_DIG->AGC_IDX1_THR */
+#define XCVR_FOLDED_AGC_IDX1_THR \
+    (XCVR_RX_DIG_AGC_IDX1_THR_STEP_DOWN_THR_1(0x15E) | \
+        XCVR_RX_DIG_AGC_IDX1_THR_STEP_DOWN_THR_1_DRS_OFS(0x00) | \
+        XCVR_RX_DIG_AGC_IDX1_THR_STEP_UP_THR_1(0x01E))
+/* XCVR_RX_DIG->AGC_IDX2_GAIN_CFG */
+#define XCVR_FOLDED_AGC_IDX2_GAIN_CFG \
+    (XCVR_RX_DIG_AGC_IDX2_GAIN_CFG_ANT_EN_RLOAD_2(0) | XCVR_RX_DIG_AGC_IDX2_GAIN_CFG_CBPF_GAIN_2(1) | \
+        XCVR_RX_DIG_AGC_IDX2_GAIN_CFG_LNA_ATTN_2(2) | XCVR_RX_DIG_AGC_IDX2_GAIN_CFG_LNA_HATTN_2(0) | \
+        XCVR_RX_DIG_AGC_IDX2_GAIN_CFG_LNA_HGAIN_2(0x00) | XCVR_RX_DIG_AGC_IDX2_GAIN_CFG_LNA_LGAIN_2(2) | \
+        XCVR_RX_DIG_AGC_IDX2_GAIN_CFG_LNA_RTRIM_2(1) | XCVR_RX_DIG_AGC_IDX2_GAIN_CFG_MAG_THR_2_DRS_OFS(0x00) | \
+        XCVR_RX_DIG_AGC_IDX2_GAIN_CFG_MAG_THR_HI_2_DRS_OFS(0x00))
+/* XCVR_RX_DIG->AGC_IDX2_GAIN_VAL */
+#define XCVR_FOLDED_AGC_IDX2_GAIN_VAL \
+    (XCVR_RX_DIG_AGC_IDX2_GAIN_VAL_LOG_GAIN_2(0x026) | \
+        XCVR_RX_DIG_AGC_IDX2_GAIN_VAL_MAG_THR_2(0x000) | \
+        XCVR_RX_DIG_AGC_IDX2_GAIN_VAL_MAG_THR_HI_2(0x000))
+/* XCVR_RX_DIG->AGC_IDX2_THR */
+#define XCVR_FOLDED_AGC_IDX2_THR \
+    (XCVR_RX_DIG_AGC_IDX2_THR_STEP_DOWN_THR_2(0x0C8) | \
+        XCVR_RX_DIG_AGC_IDX2_THR_STEP_DOWN_THR_2_DRS_OFS(0x00) | \
+        XCVR_RX_DIG_AGC_IDX2_THR_STEP_UP_THR_2(0x01E))
+/* XCVR_RX_DIG->AGC_IDX3_GAIN_CFG */
+#define XCVR_FOLDED_AGC_IDX3_GAIN_CFG \
+    (XCVR_RX_DIG_AGC_IDX3_GAIN_CFG_ANT_EN_RLOAD_3(0) | XCVR_RX_DIG_AGC_IDX3_GAIN_CFG_CBPF_GAIN_3(1) | \
+        XCVR_RX_DIG_AGC_IDX3_GAIN_CFG_LNA_ATTN_3(1) | XCVR_RX_DIG_AGC_IDX3_GAIN_CFG_LNA_HATTN_3(0) | \
+        XCVR_RX_DIG_AGC_IDX3_GAIN_CFG_LNA_HGAIN_3(0x00) | XCVR_RX_DIG_AGC_IDX3_GAIN_CFG_LNA_LGAIN_3(2) | \
+        XCVR_RX_DIG_AGC_IDX3_GAIN_CFG_LNA_RTRIM_3(1) | XCVR_RX_DIG_AGC_IDX3_GAIN_CFG_MAG_THR_3_DRS_OFS(0x00) | \
+        XCVR_RX_DIG_AGC_IDX3_GAIN_CFG_MAG_THR_HI_3_DRS_OFS(0x00))
+/* XCVR_RX_DIG->AGC_IDX3_GAIN_VAL */
+#define XCVR_FOLDED_AGC_IDX3_GAIN_VAL \
+    (XCVR_RX_DIG_AGC_IDX3_GAIN_VAL_LOG_GAIN_3(0x03C) | \
+        XCVR_RX_DIG_AGC_IDX3_GAIN_VAL_MAG_THR_3(0x000) | \
+        XCVR_RX_DIG_AGC_IDX3_GAIN_VAL_MAG_THR_HI_3(0x000))
+/* XCVR_RX_DIG->AGC_IDX3_THR */
+#define XCVR_FOLDED_AGC_IDX3_THR \
+    (XCVR_RX_DIG_AGC_IDX3_THR_STEP_DOWN_THR_3(0x0C8) | \
+        XCVR_RX_DIG_AGC_IDX3_THR_STEP_DOWN_THR_3_DRS_OFS(0x00) | \
+        XCVR_RX_DIG_AGC_IDX3_THR_STEP_UP_THR_3(0x01E))
+/* XCVR_RX_DIG->AGC_IDX4_GAIN_CFG */
+#define XCVR_FOLDED_AGC_IDX4_GAIN_CFG \
+    (XCVR_RX_DIG_AGC_IDX4_GAIN_CFG_ANT_EN_RLOAD_4(0) | XCVR_RX_DIG_AGC_IDX4_GAIN_CFG_CBPF_GAIN_4(1) | \
+        XCVR_RX_DIG_AGC_IDX4_GAIN_CFG_LNA_ATTN_4(0) | XCVR_RX_DIG_AGC_IDX4_GAIN_CFG_LNA_HATTN_4(0) | \
+        XCVR_RX_DIG_AGC_IDX4_GAIN_CFG_LNA_HGAIN_4(0x00) | XCVR_RX_DIG_AGC_IDX4_GAIN_CFG_LNA_LGAIN_4(1) | \
+        XCVR_RX_DIG_AGC_IDX4_GAIN_CFG_LNA_RTRIM_4(1) | XCVR_RX_DIG_AGC_IDX4_GAIN_CFG_MAG_THR_4_DRS_OFS(0x00) | \
+        XCVR_RX_DIG_AGC_IDX4_GAIN_CFG_MAG_THR_HI_4_DRS_OFS(0x00))
+/* XCVR_RX_DIG->AGC_IDX4_GAIN_VAL */
+#define XCVR_FOLDED_AGC_IDX4_GAIN_VAL \
+    (XCVR_RX_DIG_AGC_IDX4_GAIN_VAL_LOG_GAIN_4(0x057) | \
+        XCVR_RX_DIG_AGC_IDX4_GAIN_VAL_MAG_THR_4(0x000) | \
+        XCVR_RX_DIG_AGC_IDX4_GAIN_VAL_MAG_THR_HI_4(0x000))
+/* XCVR_RX_DIG->AGC_IDX4_THR */
+#define XCVR_FOLDED_AGC_IDX4_THR \
+    (XCVR_RX_DIG_AGC_IDX4_THR_STEP_DOWN_THR_4(0x0C8) | \
+        XCVR_RX_DIG_AGC_IDX4_THR_STEP_DOWN_THR_4_DRS_OFS(0x00) | \
+        XCVR_RX_DIG_AGC_IDX4_THR_STEP_UP_THR_4(0x01E))
+/* XCVR_RX_DIG->AGC_IDX5_GAIN_CFG */
+#define XCVR_FOLDED_AGC_IDX5_GAIN_CFG \
+    (XCVR_RX_DIG_AGC_IDX5_GAIN_CFG_ANT_EN_RLOAD_5(0) | XCVR_RX_DIG_AGC_IDX5_GAIN_CFG_CBPF_GAIN_5(1) | \
+        XCVR_RX_DIG_AGC_IDX5_GAIN_CFG_LNA_ATTN_5(0) | XCVR_RX_DIG_AGC_IDX5_GAIN_CFG_LNA_HATTN_5(0) | \
+        XCVR_RX_DIG_AGC_IDX5_GAIN_CFG_LNA_HGAIN_5(0x00) | XCVR_RX_DIG_AGC_IDX5_GAIN_CFG_LNA_LGAIN_5(3) | \
+        XCVR_RX_DIG_AGC_IDX5_GAIN_CFG_LNA_RTRIM_5(1) | XCVR_RX_DIG_AGC_IDX5_GAIN_CFG_MAG_THR_5_DRS_OFS(0x00) | \
+        XCVR_RX_DIG_AGC_IDX5_GAIN_CFG_MAG_THR_HI_5_DRS_OFS(0x00))
+/* XCVR_RX_DIG->AGC_IDX5_GAIN_VAL */
+#define XCVR_FOLDED_AGC_IDX5_GAIN_VAL \
+    (XCVR_RX_DIG_AGC_IDX5_GAIN_VAL_LOG_GAIN_5(0x06D) | \
+        XCVR_RX_DIG_AGC_IDX5_GAIN_VAL_MAG_THR_5(0x000) | \
+        XCVR_RX_DIG_AGC_IDX5_GAIN_VAL_MAG_THR_HI_5(0x000))
+/* XCVR_RX_DIG->AGC_IDX5_THR */
+#define XCVR_FOLDED_AGC_IDX5_THR \
+    (XCVR_RX_DIG_AGC_IDX5_THR_STEP_DOWN_THR_5(0x0FA) | \
+        XCVR_RX_DIG_AGC_IDX5_THR_STEP_DOWN_THR_5_DRS_OFS(0x00) | \
+        XCVR_RX_DIG_AGC_IDX5_THR_STEP_UP_THR_5(0x01E))
+/* XCVR_RX_DIG->AGC_IDX6_GAIN_CFG */
+#define XCVR_FOLDED_AGC_IDX6_GAIN_CFG \
+    (XCVR_RX_DIG_AGC_IDX6_GAIN_CFG_ANT_EN_RLOAD_6(0) | XCVR_RX_DIG_AGC_IDX6_GAIN_CFG_CBPF_GAIN_6(1) | \
+        XCVR_RX_DIG_AGC_IDX6_GAIN_CFG_LNA_ATTN_6(0) | XCVR_RX_DIG_AGC_IDX6_GAIN_CFG_LNA_HATTN_6(0) | \
+        XCVR_RX_DIG_AGC_IDX6_GAIN_CFG_LNA_HGAIN_6(0x01) | XCVR_RX_DIG_AGC_IDX6_GAIN_CFG_LNA_LGAIN_6(0) | \
+        XCVR_RX_DIG_AGC_IDX6_GAIN_CFG_LNA_RTRIM_6(1) | XCVR_RX_DIG_AGC_IDX6_GAIN_CFG_MAG_THR_6_DRS_OFS(0x00) | \
+        XCVR_RX_DIG_AGC_IDX6_GAIN_CFG_MAG_THR_HI_6_DRS_OFS(0x00))
+/* XCVR_RX_DIG->AGC_IDX6_GAIN_VAL */
+#define XCVR_FOLDED_AGC_IDX6_GAIN_VAL \
+    (XCVR_RX_DIG_AGC_IDX6_GAIN_VAL_LOG_GAIN_6(0x087) | \
+        XCVR_RX_DIG_AGC_IDX6_GAIN_VAL_MAG_THR_6(0x000) | \
+        XCVR_RX_DIG_AGC_IDX6_GAIN_VAL_MAG_THR_HI_6(0x000))
+/* XCVR_RX_DIG->AGC_IDX6_THR */
+#define XCVR_FOLDED_AGC_IDX6_THR \
+    (XCVR_RX_DIG_AGC_IDX6_THR_STEP_DOWN_THR_6(0x12C) | \
+        XCVR_RX_DIG_AGC_IDX6_THR_STEP_DOWN_THR_6_DRS_OFS(0x00) | \
+        XCVR_RX_DIG_AGC_IDX6_THR_STEP_UP_THR_6(0x01E))
+/* XCVR_RX_DIG->AGC_IDX7_GAIN_CFG */
+#define XCVR_FOLDED_AGC_IDX7_GAIN_CFG \
+    (XCVR_RX_DIG_AGC_IDX7_GAIN_CFG_ANT_EN_RLOAD_7(0) | XCVR_RX_DIG_AGC_IDX7_GAIN_CFG_CBPF_GAIN_7(1) | \
+        XCVR_RX_DIG_AGC_IDX7_GAIN_CFG_LNA_ATTN_7(0) | XCVR_RX_DIG_AGC_IDX7_GAIN_CFG_LNA_HATTN_7(0) | \
+        XCVR_RX_DIG_AGC_IDX7_GAIN_CFG_LNA_HGAIN_7(0x03) | XCVR_RX_DIG_AGC_IDX7_GAIN_CFG_LNA_LGAIN_7(0) | \
+        XCVR_RX_DIG_AGC_IDX7_GAIN_CFG_LNA_RTRIM_7(1) | XCVR_RX_DIG_AGC_IDX7_GAIN_CFG_MAG_THR_7_DRS_OFS(0x00) | \
+        XCVR_RX_DIG_AGC_IDX7_GAIN_CFG_MAG_THR_HI_7_DRS_OFS(0x00))
+/* XCVR_RX_DIG->AGC_IDX7_GAIN_VAL */
+#define XCVR_FOLDED_AGC_IDX7_GAIN_VAL \
+    (XCVR_RX_DIG_AGC_IDX7_GAIN_VAL_LOG_GAIN_7(0x0A0) | \
+        XCVR_RX_DIG_AGC_IDX7_GAIN_VAL_MAG_THR_7(0x000) | \
+        XCVR_RX_DIG_AGC_IDX7_GAIN_VAL_MAG_THR_HI_7(0x000))
+/* XCVR_RX_DIG->AGC_IDX7_THR */
+#define XCVR_FOLDED_AGC_IDX7_THR \
+    (XCVR_RX_DIG_AGC_IDX7_THR_STEP_DOWN_THR_7(0x12C) | \
+        XCVR_RX_DIG_AGC_IDX7_THR_STEP_DOWN_THR_7_DRS_OFS(0x00) | \
+        XCVR_RX_DIG_AGC_IDX7_THR_STEP_UP_THR_7(0x01E))
+/* XCVR_RX_DIG->AGC_IDX8_GAIN_CFG */
+#define XCVR_FOLDED_AGC_IDX8_GAIN_CFG \
+    (XCVR_RX_DIG_AGC_IDX8_GAIN_CFG_ANT_EN_RLOAD_8(0) | XCVR_RX_DIG_AGC_IDX8_GAIN_CFG_CBPF_GAIN_8(1) | \
+        XCVR_RX_DIG_AGC_IDX8_GAIN_CFG_LNA_ATTN_8(0) | XCVR_RX_DIG_AGC_IDX8_GAIN_CFG_LNA_HATTN_8(0) | \
+        XCVR_RX_DIG_AGC_IDX8_GAIN_CFG_LNA_HGAIN_8(0x07) | XCVR_RX_DIG_AGC_IDX8_GAIN_CFG_LNA_LGAIN_8(0) | \
+        XCVR_RX_DIG_AGC_IDX8_GAIN_CFG_LNA_RTRIM_8(1) | XCVR_RX_DIG_AGC_IDX8_GAIN_CFG_MAG_THR_8_DRS_OFS(0x00) | \
+        XCVR_RX_DIG_AGC_IDX8_GAIN_CFG_MAG_THR_HI_8_DRS_OFS(0x00))
+/* XCVR_RX_DIG->AGC_IDX8_GAIN_VAL */
+#define XCVR_FOLDED_AGC_IDX8_GAIN_VAL \
+    (XCVR_RX_DIG_AGC_IDX8_GAIN_VAL_LOG_GAIN_8(0x0B7) | \
+        XCVR_RX_DIG_AGC_IDX8_GAIN_VAL_MAG_THR_8(0x000) | \
+        XCVR_RX_DIG_AGC_IDX8_GAIN_VAL_MAG_THR_HI_8(0x000))
+/* XCVR_RX_DIG->AGC_IDX8_THR */
+#define XCVR_FOLDED_AGC_IDX8_THR \
+    (XCVR_RX_DIG_AGC_IDX8_THR_STEP_DOWN_THR_8(0x12C) | \
+        XCVR_RX_DIG_AGC_IDX8_THR_STEP_DOWN_THR_8_DRS_OFS(0x00) | \
+        XCVR_RX_DIG_AGC_IDX8_THR_STEP_UP_THR_8(0x01E))
+/* XCVR_RX_DIG->AGC_IDX9_GAIN_CFG */
+#define XCVR_FOLDED_AGC_IDX9_GAIN_CFG \
+    (XCVR_RX_DIG_AGC_IDX9_GAIN_CFG_ANT_EN_RLOAD_9(0) | XCVR_RX_DIG_AGC_IDX9_GAIN_CFG_CBPF_GAIN_9(1) | \
+        XCVR_RX_DIG_AGC_IDX9_GAIN_CFG_LNA_ATTN_9(0) | XCVR_RX_DIG_AGC_IDX9_GAIN_CFG_LNA_HATTN_9(0) | \
+        XCVR_RX_DIG_AGC_IDX9_GAIN_CFG_LNA_HGAIN_9(0x11) | XCVR_RX_DIG_AGC_IDX9_GAIN_CFG_LNA_LGAIN_9(0) | \
+        XCVR_RX_DIG_AGC_IDX9_GAIN_CFG_LNA_RTRIM_9(1) | XCVR_RX_DIG_AGC_IDX9_GAIN_CFG_MAG_THR_9_DRS_OFS(0x00) | \
+        XCVR_RX_DIG_AGC_IDX9_GAIN_CFG_MAG_THR_HI_9_DRS_OFS(0x00))
+/* XCVR_RX_DIG->AGC_IDX9_GAIN_VAL */
+#define XCVR_FOLDED_AGC_IDX9_GAIN_VAL \
+    (XCVR_RX_DIG_AGC_IDX9_GAIN_VAL_LOG_GAIN_9(0x0D2) | \
+        XCVR_RX_DIG_AGC_IDX9_GAIN_VAL_MAG_THR_9(0x000) | \
+        XCVR_RX_DIG_AGC_IDX9_GAIN_VAL_MAG_THR_HI_9(0x000))
+/* XCVR_RX_DIG->AGC_IDX9_THR */
+#define XCVR_FOLDED_AGC_IDX9_THR \
+    (XCVR_RX_DIG_AGC_IDX9_THR_STEP_DOWN_THR_9(0x096) | \
+        XCVR_RX_DIG_AGC_IDX9_THR_STEP_DOWN_THR_9_DRS_OFS(0x00) | \
+        XCVR_RX_DIG_AGC_IDX9_THR_STEP_UP_THR_9(0x01E))
+/* XCVR_RX_DIG->AGC_MIS_GAIN_CFG */
+#define XCVR_FOLDED_AGC_MIS_GAIN_CFG \
+    (XCVR_RX_DIG_AGC_MIS_GAIN_CFG_LNA_HATTN_IN_TX_MODE(0) | \
+        XCVR_RX_DIG_AGC_MIS_GAIN_CFG_LNA_RTRIM_IN_DCOC_CAL(1) | \
+        XCVR_RX_DIG_AGC_MIS_GAIN_CFG_LNA_RTRIM_IN_TX_MODE(0))
+/* XCVR_RX_DIG->AGC_THR_FAST */
+#define XCVR_FOLDED_AGC_THR_FAST \
+    (XCVR_RX_DIG_AGC_THR_FAST_STEP_DOWN_THR_FAST(0x190) | XCVR_RX_DIG_AGC_THR_FAST_STEP_UP_THR_FAST(0x00F))
+/* XCVR_RX_DIG->AGC_THR_FAST_DRS */
+#define XCVR_FOLDED_AGC_THR_FAST_DRS \
+    (XCVR_RX_DIG_AGC_THR_FAST_DRS_STEP_DOWN_THR_FAST(0x190) | XCVR_RX_DIG_AGC_THR_FAST_DRS_STEP_UP_THR_FAST(0x01E))
+/* XCVR_RX_DIG->AGC_THR_MIS */
+#define XCVR_FOLDED_AGC_THR_MIS \
+    (XCVR_RX_DIG_AGC_THR_MIS_DELTA_SLOW_THR(0x028) | XCVR_RX_DIG_AGC_THR_MIS_HOLD_MARGIN_THR(0x096))
+/* XCVR_RX_DIG->AGC_TIMING0 */
+#define XCVR_FOLDED_AGC_TIMING0 \
+    (XCVR_RX_DIG_AGC_TIMING0_AGC_DELTA_SLOW_WAIT(0) | XCVR_RX_DIG_AGC_TIMING0_AGC_MAG_INIT_WAIT(0x10) | \
+        XCVR_RX_DIG_AGC_TIMING0_AGC_WBD_INIT_WAIT(0x04) | XCVR_RX_DIG_AGC_TIMING0_AGC_WBD_STEP1_TIMEOUT(7) | \
+        XCVR_RX_DIG_AGC_TIMING0_AGC_WBD_STEP2_TIMEOUT(0x06))
+/* XCVR_RX_DIG->AGC_TIMING0_DRS */
+#define XCVR_FOLDED_AGC_TIMING0_DRS \
+    (XCVR_RX_DIG_AGC_TIMING0_DRS_AGC_WBD_EN_DRS(1))
+/* XCVR_RX_DIG->AGC_TIMING1 */
+#define XCVR_FOLDED_AGC_TIMING1 \
+    (XCVR_RX_DIG_AGC_TIMING1_AGC_WBD_DUAL_CLIP_TIMEOUT(0x6) | \
+        XCVR_RX_DIG_AGC_TIMING1_AGC_WBD_STEP1_DUAL_CLIP_WAIT(1) | \
+        XCVR_RX_DIG_AGC_TIMING1_AGC_WBD_STEP2_DUAL_CLIP_WAIT(1) | \
+        XCVR_RX_DIG_AGC_TIMING1_AGC_WBD_STEP2_WAIT(0x10))
+/* XCVR_RX_DIG->AGC_TIMING2 */
+#define XCVR_FOLDED_AGC_TIMING2 \
+    (XCVR_RX_DIG_AGC_TIMING2_AGC_UNHOLD_GAIN_CHG(1) | XCVR_RX_DIG_AGC_TIMING2_AGC_UNHOLD_MAG_CNT(1) | \
+        XCVR_RX_DIG_AGC_TIMING2_AGC_UNHOLD_MAG_SRC(1))
+/* XCVR_RX_DIG->CTRL0 */
+#if RF_OSC_26MHZ == 1
+#define XCVR_FOLDED_CTRL0 \
+    (XCVR_RX_DIG_CTRL0_ADC_CLIP_EN(1) | XCVR_RX_DIG_CTRL0_CIC_CNTR_FREE_RUN_EN(1) | \
+        XCVR_RX_DIG_CTRL0_DR_OVRD_IN_CTE(0) | XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_BYPASS(0) | \
+        XCVR_RX_DIG_CTRL0_RX_AGC_EN(1) | XCVR_RX_DIG_CTRL0_RX_DIG_GAIN(6) | XCVR_RX_DIG_CTRL0_RX_IQMC_EN(1) | \
+        XCVR_RX_DIG_CTRL0_RX_IQ_8B_OUT_MODE(0) | \
+        XCVR_RX_DIG_CTRL0_RX_SRC_EN(1))
+#else
+#define XCVR_FOLDED_CTRL0 \
+    (XCVR_RX_DIG_CTRL0_ADC_CLIP_EN(1) | XCVR_RX_DIG_CTRL0_CIC_CNTR_FREE_RUN_EN(1) | \
+        XCVR_RX_DIG_CTRL0_DR_OVRD_IN_CTE(0) | XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_BYPASS(0) | \
+        XCVR_RX_DIG_CTRL0_RX_AGC_EN(1) | XCVR_RX_DIG_CTRL0_RX_DIG_GAIN(6) | XCVR_RX_DIG_CTRL0_RX_IQMC_EN(1) | \
+        XCVR_RX_DIG_CTRL0_RX_IQ_8B_OUT_MODE(0) | \
+        XCVR_RX_DIG_CTRL0_RX_SRC_EN(0))
+#endif /* RF_OSC_26MHZ == 1 */
+/* XCVR_RX_DIG->CTRL1 */
+#define XCVR_FOLDED_CTRL1 \
+    (XCVR_RX_DIG_CTRL1_DC_RESID_EN(0) | XCVR_RX_DIG_CTRL1_DIS_WB_NORM_AA_FOUND(1) | \
+        XCVR_RX_DIG_CTRL1_RX_CFO_EST_OVRD(0x000) | XCVR_RX_DIG_CTRL1_RX_CFO_EST_OVRD_EN(0) | \
+        XCVR_RX_DIG_CTRL1_RX_DEMOD_FILT_BYPASS(0) | XCVR_RX_DIG_CTRL1_RX_FRAC_CORR_OVRD(0) | \
+        XCVR_RX_DIG_CTRL1_RX_FRAC_CORR_OVRD_EN(0) | XCVR_RX_DIG_CTRL1_RX_HIGH_RES_NORM_SEL(0) | \
+        XCVR_RX_DIG_CTRL1_RX_IQ_PH_AVG_WIN(0) | XCVR_RX_DIG_CTRL1_RX_IQ_PH_OUTPUT_COND(0) | \
+        XCVR_RX_DIG_CTRL1_RX_MIXER_IDX_OUT_MODE(0) | XCVR_RX_DIG_CTRL1_RX_NB_NORM_EN(1) | \
+        XCVR_RX_DIG_CTRL1_RX_SAMPLE_BUF_AUTO_GATE(0) | XCVR_RX_DIG_CTRL1_RX_SAMPLE_BUF_BYPASS(0) | \
+        XCVR_RX_DIG_CTRL1_RX_SAMPLE_BUF_BYPASS_IN_CTE(0))
+/* XCVR_RX_DIG->DCOC_CTRL0 */
+#define XCVR_FOLDED_DCOC_CTRL0 \
+    (XCVR_RX_DIG_DCOC_CTRL0_DCOC_ADC_OFFSET_OVRD_EN(0) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_AVG_WIN(0) | \
+        XCVR_RX_DIG_DCOC_CTRL0_DCOC_CAL_USE_OFFSET(0) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_CBPF_HIZ_OVRD(0) | \
+        XCVR_RX_DIG_DCOC_CTRL0_DCOC_CBPF_HIZ_SHORT_OVRD_EN(0) | \
+        XCVR_RX_DIG_DCOC_CTRL0_DCOC_CBPF_SHORT_OVRD(0) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_CBPF_STL_TIME(3) | \
+        XCVR_RX_DIG_DCOC_CTRL0_DCOC_DAC_OVRD_EN(0) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_DIG_CORR_EN(1) | \
+        XCVR_RX_DIG_DCOC_CTRL0_DCOC_I_CAL_POL(0) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_PULSE_CAPCODE(0) | \
+        XCVR_RX_DIG_DCOC_CTRL0_DCOC_Q_CAL_POL(1) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_SAR_STL_TIME(3) | \
+        XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFIQ(1) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFQI(1))
+/* XCVR_RX_DIG->DCOC_CTRL1 */
+#define XCVR_FOLDED_DCOC_CTRL1 \
+    (XCVR_RX_DIG_DCOC_CTRL1_DCOC_ICBPF_OFFSET(0x00) | XCVR_RX_DIG_DCOC_CTRL1_DCOC_ILNA_OFFSET(0x00) | \
+        XCVR_RX_DIG_DCOC_CTRL1_DCOC_QCBPF_OFFSET(0x00) | XCVR_RX_DIG_DCOC_CTRL1_DCOC_QLNA_OFFSET(0x00))
+/* XCVR_RX_DIG->NB_RSSI_CTRL0 */
+#define XCVR_FOLDED_NB_RSSI_CTRL0 \
+    (XCVR_RX_DIG_NB_RSSI_CTRL0_KEEP_RSSI_RESULT_NB(1) | XCVR_RX_DIG_NB_RSSI_CTRL0_RSSI_ADJ_NB(0xED) | \
+        XCVR_RX_DIG_NB_RSSI_CTRL0_RSSI_IIR_WAIT_NB(2) | XCVR_RX_DIG_NB_RSSI_CTRL0_RSSI_IIR_WT_NB(2) | \
+        XCVR_RX_DIG_NB_RSSI_CTRL0_RSSI_M_WINDOW_NB(0x3) | XCVR_RX_DIG_NB_RSSI_CTRL0_RSSI_N_WINDOW_NB(0x4) | \
+        XCVR_RX_DIG_NB_RSSI_CTRL0_SNR_ADJ_NB(0x07))
+/* XCVR_RX_DIG->NB_RSSI_CTRL1 */
+#define XCVR_FOLDED_NB_RSSI_CTRL1 \
+    (XCVR_RX_DIG_NB_RSSI_CTRL1_LQI_BIAS(0x0) | XCVR_RX_DIG_NB_RSSI_CTRL1_LQI_RSSI_SENS_ADJ(0x0) | \
+        XCVR_RX_DIG_NB_RSSI_CTRL1_LQI_RSSI_WEIGHT(0) | XCVR_RX_DIG_NB_RSSI_CTRL1_LQI_SNR_WEIGHT(0x0))
+/* XCVR_RX_DIG->RSSI_GLOBAL_CTRL */
+#define XCVR_FOLDED_RSSI_GLOBAL_CTRL \
+    (XCVR_RX_DIG_RSSI_GLOBAL_CTRL_CCA1_ED_FROM_NB(1) | XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_CONT_MEAS_OVRD(0) | \
+        XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_CONT_MEAS_OVRD_EN(0) | XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_RSSI_AA_MATCH_OVRD(0) | \
+        XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_RSSI_AA_MATCH_OVRD_EN(0) | XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_RSSI_EN(1) | \
+        XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_RSSI_INPUT_SEL(0) | XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_RSSI_PA_AA_MATCH_SEL(1) | \
+        XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_SNR_LQI_ENABLE(1) | XCVR_RX_DIG_RSSI_GLOBAL_CTRL_WB_CCA1_ED_EN(0) | \
+        XCVR_RX_DIG_RSSI_GLOBAL_CTRL_WB_CONT_MEAS_OVRD(0) | XCVR_RX_DIG_RSSI_GLOBAL_CTRL_WB_CONT_MEAS_OVRD_EN(0) | \
+        XCVR_RX_DIG_RSSI_GLOBAL_CTRL_WB_RSSI_EN(1) | XCVR_RX_DIG_RSSI_GLOBAL_CTRL_WB_RSSI_INPUT_SEL(0))
+/* XCVR_RX_DIG->WB_RSSI_CTRL */
+#define XCVR_FOLDED_WB_RSSI_CTRL \
+    (XCVR_RX_DIG_WB_RSSI_CTRL_KEEP_RSSI_RESULT_WB(1) | XCVR_RX_DIG_WB_RSSI_CTRL_RSSI_ADJ_WB(0x00) | \
+        XCVR_RX_DIG_WB_RSSI_CTRL_RSSI_DB_EN_WB(1) | XCVR_RX_DIG_WB_RSSI_CTRL_RSSI_F_WINDOW_WB(3) | \
+        XCVR_RX_DIG_WB_RSSI_CTRL_RSSI_F_WINDOW_WB_DRS(2) | XCVR_RX_DIG_WB_RSSI_CTRL_RSSI_M_WINDOW_WB(4) | \
+        XCVR_RX_DIG_WB_RSSI_CTRL_RSSI_N_WINDOW_WB(2) | XCVR_RX_DIG_WB_RSSI_CTRL_RSSI_N_WINDOW_WB_DRS(2))
+/* XCVR_TSM->CTRL */
+#define XCVR_FOLDED_CTRL \
+    (XCVR_TSM_CTRL_ABORT_ON_CTUNE(0) | XCVR_TSM_CTRL_ABORT_ON_FREQ_TARG(0) | XCVR_TSM_CTRL_BKPT(0xFF) | \
+        XCVR_TSM_CTRL_FORCE_RX_EN(0) | XCVR_TSM_CTRL_FORCE_TX_EN(0) | XCVR_TSM_CTRL_PLL_UNLOCK_IRQ_EN(0) | \
+        XCVR_TSM_CTRL_RX_ABORT_DIS(0) | XCVR_TSM_CTRL_TSM_IRQ0_EN(0) | XCVR_TSM_CTRL_TSM_IRQ1_EN(0) | \
+        XCVR_TSM_CTRL_TSM_LL_INHIBIT(0) | XCVR_TSM_CTRL_TSM_SOFT_RESET(0) | XCVR_TSM_CTRL_TSM_SPARE1_EXTEND(0x00) | \
+        XCVR_TSM_CTRL_TX_ABORT_DIS(0))
+/* XCVR_TSM->END_OF_SEQ */
+#if RF_OSC_26MHZ == 1
+#define XCVR_FOLDED_END_OF_SEQ \
+    (XCVR_TSM_END_OF_SEQ_END_OF_RX_WD(0x5D) | XCVR_TSM_END_OF_SEQ_END_OF_RX_WU(0x5B) | \
+        XCVR_TSM_END_OF_SEQ_END_OF_TX_WD(0x72) | XCVR_TSM_END_OF_SEQ_END_OF_TX_WU(0x70))
+#else
+#define XCVR_FOLDED_END_OF_SEQ \
+    (XCVR_TSM_END_OF_SEQ_END_OF_RX_WD(0x5C) | XCVR_TSM_END_OF_SEQ_END_OF_RX_WU(0x5A) | \
+        XCVR_TSM_END_OF_SEQ_END_OF_TX_WD(0x72) | XCVR_TSM_END_OF_SEQ_END_OF_TX_WU(0x70))
+#endif /* RF_OSC_26MHZ == 1 */
+/* XCVR_TSM->FAST_CTRL1 */
+#define XCVR_FOLDED_FAST_CTRL1 \
+    (XCVR_TSM_FAST_CTRL1_FAST_RX2TX_EN(0) | XCVR_TSM_FAST_CTRL1_FAST_RX2TX_START(0x6F) | \
+        XCVR_TSM_FAST_CTRL1_FAST_RX_WU_EN(0) | XCVR_TSM_FAST_CTRL1_FAST_TX2RX_EN(0) | \
+        XCVR_TSM_FAST_CTRL1_FAST_TX2RX_START(0x24) | XCVR_TSM_FAST_CTRL1_FAST_TX_WU_EN(0) | \
+        XCVR_TSM_FAST_CTRL1_PWRSAVE_RX_WU_EN(0) | XCVR_TSM_FAST_CTRL1_PWRSAVE_TX_WU_EN(0) | \
+        XCVR_TSM_FAST_CTRL1_PWRSAVE_WU_CLEAR(0))
+/* XCVR_TSM->FAST_CTRL2 */
+#define XCVR_FOLDED_FAST_CTRL2 \
+    (XCVR_TSM_FAST_CTRL2_FAST_DEST_RX(0x66) | XCVR_TSM_FAST_CTRL2_FAST_DEST_TX(0x42) | \
+        XCVR_TSM_FAST_CTRL2_FAST_START_RX(0x28) | XCVR_TSM_FAST_CTRL2_FAST_START_TX(0x08))
+/* XCVR_TSM->FAST_CTRL3 */
+#define XCVR_FOLDED_FAST_CTRL3 \
+    (XCVR_TSM_FAST_CTRL3_FAST_RX2TX_START_FC(0x18) | XCVR_TSM_FAST_CTRL3_FAST_TX2RX_START_FC(0x18))
+/* XCVR_TSM->RECYCLE_COUNT */
+#if RF_OSC_26MHZ == 1
+#define XCVR_FOLDED_RECYCLE_COUNT \
+    (XCVR_TSM_RECYCLE_COUNT_RECYCLE_COUNT0(0x59) | XCVR_TSM_RECYCLE_COUNT_RECYCLE_COUNT1(0x12))
+#else
+#define XCVR_FOLDED_RECYCLE_COUNT \
+    (XCVR_TSM_RECYCLE_COUNT_RECYCLE_COUNT0(0x58) | XCVR_TSM_RECYCLE_COUNT_RECYCLE_COUNT1(0x12))
+#endif /* RF_OSC_26MHZ == 1 */
+/* XCVR_TSM->TIMING00 */
+#define XCVR_FOLDED_TIMING00 \
+    (XCVR_TSM_TIMING00_RF_ACTIVE_RX_HI(0xFF) | XCVR_TSM_TIMING00_RF_ACTIVE_RX_LO(0xFF) | \
+        XCVR_TSM_TIMING00_RF_ACTIVE_TX_HI(0xFF) | XCVR_TSM_TIMING00_RF_ACTIVE_TX_LO(0xFF))
+/* XCVR_TSM->TIMING01 */
+#define XCVR_FOLDED_TIMING01 \
+    (XCVR_TSM_TIMING01_RF_STATUS_RX_HI(0xFF) | XCVR_TSM_TIMING01_RF_STATUS_RX_LO(0xFF) | \
+        XCVR_TSM_TIMING01_RF_STATUS_TX_HI(0xFF) | XCVR_TSM_TIMING01_RF_STATUS_TX_LO(0xFF))
+/* XCVR_TSM->TIMING02 */
+#define XCVR_FOLDED_TIMING02 \
+    (XCVR_TSM_TIMING02_RF_PRIORITY_RX_HI(0xFF) | XCVR_TSM_TIMING02_RF_PRIORITY_RX_LO(0xFF) | \
+        XCVR_TSM_TIMING02_RF_PRIORITY_TX_HI(0xFF) | XCVR_TSM_TIMING02_RF_PRIORITY_TX_LO(0xFF))
+/* XCVR_TSM->TIMING03 */
+#define XCVR_FOLDED_TIMING03 \
+    (XCVR_TSM_TIMING03_IRQ0_START_TRIG_RX_HI(0xFF) | XCVR_TSM_TIMING03_IRQ0_START_TRIG_RX_LO(0xFF) | \
+        XCVR_TSM_TIMING03_IRQ0_START_TRIG_TX_HI(0xFF) | XCVR_TSM_TIMING03_IRQ0_START_TRIG_TX_LO(0xFF))
+/* XCVR_TSM->TIMING04 */
+#define XCVR_FOLDED_TIMING04 \
+    (XCVR_TSM_TIMING04_IRQ1_STOP_TRIG_RX_HI(0xFF) | XCVR_TSM_TIMING04_IRQ1_STOP_TRIG_RX_LO(0xFF) | \
+        XCVR_TSM_TIMING04_IRQ1_STOP_TRIG_TX_HI(0xFF) | XCVR_TSM_TIMING04_IRQ1_STOP_TRIG_TX_LO(0xFF))
+/* XCVR_TSM->TIMING05 */
+#define XCVR_FOLDED_TIMING05 \
+    (XCVR_TSM_TIMING05_GPIO0_TRIG_EN_RX_HI(0xFF) | XCVR_TSM_TIMING05_GPIO0_TRIG_EN_RX_LO(0xFF) | \
+        XCVR_TSM_TIMING05_GPIO0_TRIG_EN_TX_HI(0xFF) | XCVR_TSM_TIMING05_GPIO0_TRIG_EN_TX_LO(0xFF))
+/* XCVR_TSM->TIMING06 */
+#define XCVR_FOLDED_TIMING06 \
+    (XCVR_TSM_TIMING06_GPIO1_TRIG_EN_RX_HI(0xFF) | XCVR_TSM_TIMING06_GPIO1_TRIG_EN_RX_LO(0xFF) | \
+        XCVR_TSM_TIMING06_GPIO1_TRIG_EN_TX_HI(0xFF) | XCVR_TSM_TIMING06_GPIO1_TRIG_EN_TX_LO(0xFF))
+/* XCVR_TSM->TIMING07 */
+#define XCVR_FOLDED_TIMING07 \
+    (XCVR_TSM_TIMING07_GPIO2_TRIG_EN_RX_HI(0xFF) | XCVR_TSM_TIMING07_GPIO2_TRIG_EN_RX_LO(0xFF) | \
+        XCVR_TSM_TIMING07_GPIO2_TRIG_EN_TX_HI(0xFF) | XCVR_TSM_TIMING07_GPIO2_TRIG_EN_TX_LO(0xFF))
+/* XCVR_TSM->TIMING08 */
+#define XCVR_FOLDED_TIMING08 \
+    (XCVR_TSM_TIMING08_GPIO3_TRIG_EN_RX_HI(0xFF) | XCVR_TSM_TIMING08_GPIO3_TRIG_EN_RX_LO(0xFF) | \
+        XCVR_TSM_TIMING08_GPIO3_TRIG_EN_TX_HI(0xFF) | XCVR_TSM_TIMING08_GPIO3_TRIG_EN_TX_LO(0xFF))
+/* XCVR_TSM->TIMING09 */
+#if RF_OSC_26MHZ == 1
+#define XCVR_FOLDED_TIMING09 \
+    (XCVR_TSM_TIMING09_DCOC_GAIN_CFG_EN_RX_HI(0x00) | XCVR_TSM_TIMING09_DCOC_GAIN_CFG_EN_RX_LO(0x58) | \
+        XCVR_TSM_TIMING09_DCOC_GAIN_CFG_EN_TX_HI(0xFF) | XCVR_TSM_TIMING09_DCOC_GAIN_CFG_EN_TX_LO(0xFF))
+#else
+#define XCVR_FOLDED_TIMING09 \
+    (XCVR_TSM_TIMING09_DCOC_GAIN_CFG_EN_RX_HI(0x00) | XCVR_TSM_TIMING09_DCOC_GAIN_CFG_EN_RX_LO(0x57) | \
+        XCVR_TSM_TIMING09_DCOC_GAIN_CFG_EN_TX_HI(0xFF) | XCVR_TSM_TIMING09_DCOC_GAIN_CFG_EN_TX_LO(0xFF))
+#endif /* RF_OSC_26MHZ == 1 */
+/* XCVR_TSM->TIMING10 */
+#define XCVR_FOLDED_TIMING10 \
+    (XCVR_TSM_TIMING10_LDO_CAL_EN_RX_HI(0x08) | XCVR_TSM_TIMING10_LDO_CAL_EN_RX_LO(0x11) | \
+        XCVR_TSM_TIMING10_LDO_CAL_EN_TX_HI(0x08) | XCVR_TSM_TIMING10_LDO_CAL_EN_TX_LO(0x11))
+/* XCVR_TSM->TIMING11 */
+#if RF_OSC_26MHZ == 1
+#define XCVR_FOLDED_TIMING11 \
+    (XCVR_TSM_TIMING11_PLL_DIG_EN_RX_HI(0x13) | XCVR_TSM_TIMING11_PLL_DIG_EN_RX_LO(0x5C) | \
+        XCVR_TSM_TIMING11_PLL_DIG_EN_TX_HI(0x13) | XCVR_TSM_TIMING11_PLL_DIG_EN_TX_LO(0x71))
+#else
+#define XCVR_FOLDED_TIMING11 \
+    (XCVR_TSM_TIMING11_PLL_DIG_EN_RX_HI(0x13) | XCVR_TSM_TIMING11_PLL_DIG_EN_RX_LO(0x5B) | \
+        XCVR_TSM_TIMING11_PLL_DIG_EN_TX_HI(0x13) | XCVR_TSM_TIMING11_PLL_DIG_EN_TX_LO(0x71))
+#endif /* RF_OSC_26MHZ == 1 */
+/* XCVR_TSM->TIMING12 */
+#if RF_OSC_26MHZ == 1
+#define XCVR_FOLDED_TIMING12 \
+    (XCVR_TSM_TIMING12_SIGMA_DELTA_EN_RX_HI(0x19) | XCVR_TSM_TIMING12_SIGMA_DELTA_EN_RX_LO(0x5C) | \
+        XCVR_TSM_TIMING12_SIGMA_DELTA_EN_TX_HI(0x4F) | XCVR_TSM_TIMING12_SIGMA_DELTA_EN_TX_LO(0x71))
+#else
+#define XCVR_FOLDED_TIMING12 \
+    (XCVR_TSM_TIMING12_SIGMA_DELTA_EN_RX_HI(0x19) | XCVR_TSM_TIMING12_SIGMA_DELTA_EN_RX_LO(0x5B) | \
+        XCVR_TSM_TIMING12_SIGMA_DELTA_EN_TX_HI(0x4F) | XCVR_TSM_TIMING12_SIGMA_DELTA_EN_TX_LO(0x71))
+#endif /* RF_OSC_26MHZ == 1 */
+/* XCVR_TSM->TIMING13 */
+#if RF_OSC_26MHZ == 1
+#define XCVR_FOLDED_TIMING13 \
+    (XCVR_TSM_TIMING13_DCOC_CAL_EN_RX_HI(0x2D) | XCVR_TSM_TIMING13_DCOC_CAL_EN_RX_LO(0x58) | \
+        XCVR_TSM_TIMING13_DCOC_CAL_EN_TX_HI(0xFF) | XCVR_TSM_TIMING13_DCOC_CAL_EN_TX_LO(0xFF))
+#else
+#define XCVR_FOLDED_TIMING13 \
+    (XCVR_TSM_TIMING13_DCOC_CAL_EN_RX_HI(0x2D) | XCVR_TSM_TIMING13_DCOC_CAL_EN_RX_LO(0x57) | \
+        XCVR_TSM_TIMING13_DCOC_CAL_EN_TX_HI(0xFF) | XCVR_TSM_TIMING13_DCOC_CAL_EN_TX_LO(0xFF))
+#endif /* RF_OSC_26MHZ == 1 */
+/* XCVR_TSM->TIMING14 */
+#define XCVR_FOLDED_TIMING14 \
+    (XCVR_TSM_TIMING14_TX_DIG_EN_TX_HI(0x6F) | XCVR_TSM_TIMING14_TX_DIG_EN_TX_LO(0x71))
+/* XCVR_TSM->TIMING15 */
+#if RF_OSC_26MHZ == 1
+#define XCVR_FOLDED_TIMING15 \
+    (XCVR_TSM_TIMING15_FREQ_TARG_LD_EN_RX_HI(0x59) | XCVR_TSM_TIMING15_FREQ_TARG_LD_EN_RX_LO(0x5C) | \
+        XCVR_TSM_TIMING15_FREQ_TARG_LD_EN_TX_HI(0x6F) | XCVR_TSM_TIMING15_FREQ_TARG_LD_EN_TX_LO(0x71))
+#else
+#define XCVR_FOLDED_TIMING15 \
+    (XCVR_TSM_TIMING15_FREQ_TARG_LD_EN_RX_HI(0x58) | XCVR_TSM_TIMING15_FREQ_TARG_LD_EN_RX_LO(0x5B) | \
+        XCVR_TSM_TIMING15_FREQ_TARG_LD_EN_TX_HI(0x6F) | XCVR_TSM_TIMING15_FREQ_TARG_LD_EN_TX_LO(0x71))
+#endif /* RF_OSC_26MHZ == 1 */
+/* XCVR_TSM->TIMING16 */
+#if RF_OSC_26MHZ == 1
+#define XCVR_FOLDED_TIMING16 \
+    (XCVR_TSM_TIMING16_RX_INIT_RX_HI(0x59) | XCVR_TSM_TIMING16_RX_INIT_RX_LO(0x5A))
+#else
+#define XCVR_FOLDED_TIMING16 \
+    (XCVR_TSM_TIMING16_RX_INIT_RX_HI(0x58) | XCVR_TSM_TIMING16_RX_INIT_RX_LO(0x59))
+#endif /* RF_OSC_26MHZ == 1 */
+/* XCVR_TSM->TIMING17 */
+#if RF_OSC_26MHZ == 1
+#define XCVR_FOLDED_TIMING17 \
+    (XCVR_TSM_TIMING17_RX_DIG_EN_RX_HI(0x59) | XCVR_TSM_TIMING17_RX_DIG_EN_RX_LO(0x5C))
+#else
+#define XCVR_FOLDED_TIMING17 \
+    (XCVR_TSM_TIMING17_RX_DIG_EN_RX_HI(0x58) | XCVR_TSM_TIMING17_RX_DIG_EN_RX_LO(0x5B))
+#endif /* RF_OSC_26MHZ == 1 */
+/* XCVR_TSM->TIMING18 */
+#if RF_OSC_26MHZ == 1
+#define XCVR_FOLDED_TIMING18 \
+    (XCVR_TSM_TIMING18_RX_PHY_EN_RX_HI(0x59) | XCVR_TSM_TIMING18_RX_PHY_EN_RX_LO(0x5C))
+#else
+#define XCVR_FOLDED_TIMING18 \
+    (XCVR_TSM_TIMING18_RX_PHY_EN_RX_HI(0x58) | XCVR_TSM_TIMING18_RX_PHY_EN_RX_LO(0x5B))
+#endif /* RF_OSC_26MHZ == 1 */
+/* XCVR_TSM->TIMING19 */
+#define XCVR_FOLDED_TIMING19 \
+    (XCVR_TSM_TIMING19_SEQ_BG_PUP_IBG_CAL_RX_HI(0x06) | XCVR_TSM_TIMING19_SEQ_BG_PUP_IBG_CAL_RX_LO(0x11) | \
+        XCVR_TSM_TIMING19_SEQ_BG_PUP_IBG_CAL_TX_HI(0x06) | XCVR_TSM_TIMING19_SEQ_BG_PUP_IBG_CAL_TX_LO(0x11))
+/* XCVR_TSM->TIMING20 */
+#define XCVR_FOLDED_TIMING20 \
+    (XCVR_TSM_TIMING20_SEQ_LDOTRIM_PUP_RX_HI(0x00) | XCVR_TSM_TIMING20_SEQ_LDOTRIM_PUP_RX_LO(0x11) | \
+        XCVR_TSM_TIMING20_SEQ_LDOTRIM_PUP_TX_HI(0x00) | XCVR_TSM_TIMING20_SEQ_LDOTRIM_PUP_TX_LO(0x11))
+/* XCVR_TSM->TIMING21 */
+#define XCVR_FOLDED_TIMING21 \
+    (XCVR_TSM_TIMING21_SEQ_LDO_CAL_PUP_RX_HI(0x00) | XCVR_TSM_TIMING21_SEQ_LDO_CAL_PUP_RX_LO(0x19) | \
+        XCVR_TSM_TIMING21_SEQ_LDO_CAL_PUP_TX_HI(0x00) | XCVR_TSM_TIMING21_SEQ_LDO_CAL_PUP_TX_LO(0x11))
+/* XCVR_TSM->TIMING22 */
+#if RF_OSC_26MHZ == 1
+#define XCVR_FOLDED_TIMING22 \
+    (XCVR_TSM_TIMING22_SEQ_BG_FC_RX_HI(0x00) | XCVR_TSM_TIMING22_SEQ_BG_FC_RX_LO(0x59) | \
+        XCVR_TSM_TIMING22_SEQ_BG_FC_TX_HI(0x00) | XCVR_TSM_TIMING22_SEQ_BG_FC_TX_LO(0x6F))
+#else
+#define XCVR_FOLDED_TIMING22 \
+    (XCVR_TSM_TIMING22_SEQ_BG_FC_RX_HI(0x00) | XCVR_TSM_TIMING22_SEQ_BG_FC_RX_LO(0x58) | \
+        XCVR_TSM_TIMING22_SEQ_BG_FC_TX_HI(0x00) | XCVR_TSM_TIMING22_SEQ_BG_FC_TX_LO(0x6F))
+#endif /* RF_OSC_26MHZ == 1 */
+/* XCVR_TSM->TIMING23 */
+#if RF_OSC_26MHZ == 1
+#define XCVR_FOLDED_TIMING23 \
+    (XCVR_TSM_TIMING23_SEQ_LDO_GANG_FC_RX_HI(0x00) | XCVR_TSM_TIMING23_SEQ_LDO_GANG_FC_RX_LO(0x59) | \
+        XCVR_TSM_TIMING23_SEQ_LDO_GANG_FC_TX_HI(0x00) | XCVR_TSM_TIMING23_SEQ_LDO_GANG_FC_TX_LO(0x6F))
+#else
+#define XCVR_FOLDED_TIMING23 \
+    (XCVR_TSM_TIMING23_SEQ_LDO_GANG_FC_RX_HI(0x00) | XCVR_TSM_TIMING23_SEQ_LDO_GANG_FC_RX_LO(0x58) | \
+        XCVR_TSM_TIMING23_SEQ_LDO_GANG_FC_TX_HI(0x00) | XCVR_TSM_TIMING23_SEQ_LDO_GANG_FC_TX_LO(0x6F))
+#endif /* RF_OSC_26MHZ == 1 */
+/* XCVR_TSM->TIMING24 */
+#if RF_OSC_26MHZ == 1
+#define XCVR_FOLDED_TIMING24 \
+    (XCVR_TSM_TIMING24_SEQ_LDO_GANG_PUP_RX_HI(0x00) | XCVR_TSM_TIMING24_SEQ_LDO_GANG_PUP_RX_LO(0x5C) | \
+        XCVR_TSM_TIMING24_SEQ_LDO_GANG_PUP_TX_HI(0x00) | XCVR_TSM_TIMING24_SEQ_LDO_GANG_PUP_TX_LO(0x71))
+#else
+#define XCVR_FOLDED_TIMING24 \
+    (XCVR_TSM_TIMING24_SEQ_LDO_GANG_PUP_RX_HI(0x00) | XCVR_TSM_TIMING24_SEQ_LDO_GANG_PUP_RX_LO(0x5B) | \
+        XCVR_TSM_TIMING24_SEQ_LDO_GANG_PUP_TX_HI(0x00) | XCVR_TSM_TIMING24_SEQ_LDO_GANG_PUP_TX_LO(0x71))
+#endif /* RF_OSC_26MHZ == 1 */
+/* XCVR_TSM->TIMING25 */
+#if RF_OSC_26MHZ == 1
+#define XCVR_FOLDED_TIMING25 \
+    (XCVR_TSM_TIMING25_SEQ_LDO_LV_PUP_RX_HI(0x00) | XCVR_TSM_TIMING25_SEQ_LDO_LV_PUP_RX_LO(0x5D) | \
+        XCVR_TSM_TIMING25_SEQ_LDO_LV_PUP_TX_HI(0x00) | XCVR_TSM_TIMING25_SEQ_LDO_LV_PUP_TX_LO(0x72))
+#else
+#define XCVR_FOLDED_TIMING25 \
+    (XCVR_TSM_TIMING25_SEQ_LDO_LV_PUP_RX_HI(0x00) | XCVR_TSM_TIMING25_SEQ_LDO_LV_PUP_RX_LO(0x5C) | \
+        XCVR_TSM_TIMING25_SEQ_LDO_LV_PUP_TX_HI(0x00) | XCVR_TSM_TIMING25_SEQ_LDO_LV_PUP_TX_LO(0x72))
+#endif /* RF_OSC_26MHZ == 1 */
+/* XCVR_TSM->TIMING26 */
+#if RF_OSC_26MHZ == 1
+#define XCVR_FOLDED_TIMING26 \
+    (XCVR_TSM_TIMING26_SEQ_BG_PUP_RX_HI(0x00) | XCVR_TSM_TIMING26_SEQ_BG_PUP_RX_LO(0x5D) | \
+        XCVR_TSM_TIMING26_SEQ_BG_PUP_TX_HI(0x00) | XCVR_TSM_TIMING26_SEQ_BG_PUP_TX_LO(0x72))
+#else
+#define XCVR_FOLDED_TIMING26 \
+    (XCVR_TSM_TIMING26_SEQ_BG_PUP_RX_HI(0x00) | XCVR_TSM_TIMING26_SEQ_BG_PUP_RX_LO(0x5C) | \
+        XCVR_TSM_TIMING26_SEQ_BG_PUP_TX_HI(0x00) | XCVR_TSM_TIMING26_SEQ_BG_PUP_TX_LO(0x72))
+#endif /* RF_OSC_26MHZ == 1 */
+/* XCVR_TSM->TIMING27 */
+#if RF_OSC_26MHZ == 1
+#define XCVR_FOLDED_TIMING27 \
+    (XCVR_TSM_TIMING27_SEQ_BG_PUP_IBG_ANT_RX_HI(0x00) | XCVR_TSM_TIMING27_SEQ_BG_PUP_IBG_ANT_RX_LO(0x5D) | \
+        XCVR_TSM_TIMING27_SEQ_BG_PUP_IBG_ANT_TX_HI(0x00) | XCVR_TSM_TIMING27_SEQ_BG_PUP_IBG_ANT_TX_LO(0x72))
+#else
+#define XCVR_FOLDED_TIMING27 \
+    (XCVR_TSM_TIMING27_SEQ_BG_PUP_IBG_ANT_RX_HI(0x00) | XCVR_TSM_TIMING27_SEQ_BG_PUP_IBG_ANT_RX_LO(0x5C) | \
+        XCVR_TSM_TIMING27_SEQ_BG_PUP_IBG_ANT_TX_HI(0x00) | XCVR_TSM_TIMING27_SEQ_BG_PUP_IBG_ANT_TX_LO(0x72))
+#endif /* RF_OSC_26MHZ == 1 */
+/* XCVR_TSM->TIMING28 */
+#if RF_OSC_26MHZ == 1
+#define XCVR_FOLDED_TIMING28 \
+    (XCVR_TSM_TIMING28_SEQ_BG_PUP_IBG_XO_DIST_RX_HI(0x00) | XCVR_TSM_TIMING28_SEQ_BG_PUP_IBG_XO_DIST_RX_LO(0x5D) | \
+        XCVR_TSM_TIMING28_SEQ_BG_PUP_IBG_XO_DIST_TX_HI(0x00) | XCVR_TSM_TIMING28_SEQ_BG_PUP_IBG_XO_DIST_TX_LO(0x72))
+#else
+#define XCVR_FOLDED_TIMING28 \
+    (XCVR_TSM_TIMING28_SEQ_BG_PUP_IBG_XO_DIST_RX_HI(0x00) | XCVR_TSM_TIMING28_SEQ_BG_PUP_IBG_XO_DIST_RX_LO(0x5C) | \
+        XCVR_TSM_TIMING28_SEQ_BG_PUP_IBG_XO_DIST_TX_HI(0x00) | XCVR_TSM_TIMING28_SEQ_BG_PUP_IBG_XO_DIST_TX_LO(0x72))
+#endif /* RF_OSC_26MHZ == 1 */
+/* XCVR_TSM->TIMING29 */
+#define XCVR_FOLDED_TIMING29 \
+    (XCVR_TSM_TIMING29_SEQ_BG_PUP_IBG_TX_RX_HI(0xFF) | XCVR_TSM_TIMING29_SEQ_BG_PUP_IBG_TX_RX_LO(0xFF) | \
+        XCVR_TSM_TIMING29_SEQ_BG_PUP_IBG_TX_TX_HI(0x00) | XCVR_TSM_TIMING29_SEQ_BG_PUP_IBG_TX_TX_LO(0x72))
+/* XCVR_TSM->TIMING30 */
+#if RF_OSC_26MHZ == 1
+#define XCVR_FOLDED_TIMING30 \
+    (XCVR_TSM_TIMING30_SEQ_BG_PUP_IBG_RX_RX_HI(0x00) | XCVR_TSM_TIMING30_SEQ_BG_PUP_IBG_RX_RX_LO(0x5D) | \
+        XCVR_TSM_TIMING30_SEQ_BG_PUP_IBG_RX_TX_HI(0xFF) | XCVR_TSM_TIMING30_SEQ_BG_PUP_IBG_RX_TX_LO(0xFF))
+#else
+#define XCVR_FOLDED_TIMING30 \
+    (XCVR_TSM_TIMING30_SEQ_BG_PUP_IBG_RX_RX_HI(0x00) | XCVR_TSM_TIMING30_SEQ_BG_PUP_IBG_RX_RX_LO(0x5C) | \
+        XCVR_TSM_TIMING30_SEQ_BG_PUP_IBG_RX_TX_HI(0xFF) | XCVR_TSM_TIMING30_SEQ_BG_PUP_IBG_RX_TX_LO(0xFF))
+#endif /* RF_OSC_26MHZ == 1 */
+/* XCVR_TSM->TIMING31 */
+#if RF_OSC_26MHZ == 1
+#define XCVR_FOLDED_TIMING31 \
+    (XCVR_TSM_TIMING31_SEQ_TSM_ISO_B_2P4GHZ_RX_HI(0x08) | \
+        XCVR_TSM_TIMING31_SEQ_TSM_ISO_B_2P4GHZ_RX_LO(0x5C) | \
+        XCVR_TSM_TIMING31_SEQ_TSM_ISO_B_2P4GHZ_TX_HI(0x08) | XCVR_TSM_TIMING31_SEQ_TSM_ISO_B_2P4GHZ_TX_LO(0x71))
+#else
+#define XCVR_FOLDED_TIMING31 \
+    (XCVR_TSM_TIMING31_SEQ_TSM_ISO_B_2P4GHZ_RX_HI(0x08) | \
+        XCVR_TSM_TIMING31_SEQ_TSM_ISO_B_2P4GHZ_RX_LO(0x5B) | \
+        XCVR_TSM_TIMING31_SEQ_TSM_ISO_B_2P4GHZ_TX_HI(0x08) | XCVR_TSM_TIMING31_SEQ_TSM_ISO_B_2P4GHZ_TX_LO(0x71))
+#endif /* RF_OSC_26MHZ == 1 */
+/* XCVR_TSM->TIMING32 */
+#define XCVR_FOLDED_TIMING32 \
+    (XCVR_TSM_TIMING32_SEQ_RCCAL_PUP_RX_HI(0x11) | XCVR_TSM_TIMING32_SEQ_RCCAL_PUP_RX_LO(0x19) | \
+        XCVR_TSM_TIMING32_SEQ_RCCAL_PUP_TX_HI(0xFF) | XCVR_TSM_TIMING32_SEQ_RCCAL_PUP_TX_LO(0xFF))
+/* XCVR_TSM->TIMING33 */
+#define XCVR_FOLDED_TIMING33 \
+    (XCVR_TSM_TIMING33_SEQ_PD_EN_FCAL_BIAS_RX_HI(0x11) | XCVR_TSM_TIMING33_SEQ_PD_EN_FCAL_BIAS_RX_LO(0x23) | \
+        XCVR_TSM_TIMING33_SEQ_PD_EN_FCAL_BIAS_TX_HI(0x11) | XCVR_TSM_TIMING33_SEQ_PD_EN_FCAL_BIAS_TX_LO(0x5A))
+/* XCVR_TSM->TIMING34 */
+#if RF_OSC_26MHZ == 1
+#define XCVR_FOLDED_TIMING34 \
+    (XCVR_TSM_TIMING34_SEQ_PD_PUP_RX_HI(0x11) | XCVR_TSM_TIMING34_SEQ_PD_PUP_RX_LO(0x5C) | \
+        XCVR_TSM_TIMING34_SEQ_PD_PUP_TX_HI(0x11) | XCVR_TSM_TIMING34_SEQ_PD_PUP_TX_LO(0x71))
+#else
+#define XCVR_FOLDED_TIMING34 \
+    (XCVR_TSM_TIMING34_SEQ_PD_PUP_RX_HI(0x11) | XCVR_TSM_TIMING34_SEQ_PD_PUP_RX_LO(0x5B) | \
+        XCVR_TSM_TIMING34_SEQ_PD_PUP_TX_HI(0x11) | XCVR_TSM_TIMING34_SEQ_PD_PUP_TX_LO(0x71))
+#endif /* RF_OSC_26MHZ == 1 */
+/* XCVR_TSM->TIMING35 */
+#if RF_OSC_26MHZ == 1
+#define XCVR_FOLDED_TIMING35 \
+    (XCVR_TSM_TIMING35_SEQ_VCO_PUP_RX_HI(0x11) | XCVR_TSM_TIMING35_SEQ_VCO_PUP_RX_LO(0x5C) | \
+        XCVR_TSM_TIMING35_SEQ_VCO_PUP_TX_HI(0x11) | XCVR_TSM_TIMING35_SEQ_VCO_PUP_TX_LO(0x71))
+#else
+#define XCVR_FOLDED_TIMING35 \
+    (XCVR_TSM_TIMING35_SEQ_VCO_PUP_RX_HI(0x11) | XCVR_TSM_TIMING35_SEQ_VCO_PUP_RX_LO(0x5B) | \
+        XCVR_TSM_TIMING35_SEQ_VCO_PUP_TX_HI(0x11) | XCVR_TSM_TIMING35_SEQ_VCO_PUP_TX_LO(0x71))
+#endif /* RF_OSC_26MHZ == 1 */
+/* XCVR_TSM->TIMING36 */
+#if RF_OSC_26MHZ == 1
+#define XCVR_FOLDED_TIMING36 \
+    (XCVR_TSM_TIMING36_SEQ_XO_DIST_EN_RX_HI(0x11) | XCVR_TSM_TIMING36_SEQ_XO_DIST_EN_RX_LO(0x5C) | \
+        XCVR_TSM_TIMING36_SEQ_XO_DIST_EN_TX_HI(0x11) | XCVR_TSM_TIMING36_SEQ_XO_DIST_EN_TX_LO(0x71))
+#else
+#define XCVR_FOLDED_TIMING36 \
+    (XCVR_TSM_TIMING36_SEQ_XO_DIST_EN_RX_HI(0x11) | XCVR_TSM_TIMING36_SEQ_XO_DIST_EN_RX_LO(0x5B) | \
+        XCVR_TSM_TIMING36_SEQ_XO_DIST_EN_TX_HI(0x11) | XCVR_TSM_TIMING36_SEQ_XO_DIST_EN_TX_LO(0x71))
+#endif /* RF_OSC_26MHZ == 1 */
+/* XCVR_TSM->TIMING37 */
+#if RF_OSC_26MHZ == 1
+#define XCVR_FOLDED_TIMING37 \
+    (XCVR_TSM_TIMING37_SEQ_XO_DIST_EN_CLK_REF_RX_HI(0x11) | XCVR_TSM_TIMING37_SEQ_XO_DIST_EN_CLK_REF_RX_LO(0x5C) | \
+        XCVR_TSM_TIMING37_SEQ_XO_DIST_EN_CLK_REF_TX_HI(0x11) | XCVR_TSM_TIMING37_SEQ_XO_DIST_EN_CLK_REF_TX_LO(0x71))
+#else
+#define XCVR_FOLDED_TIMING37 \
+    (XCVR_TSM_TIMING37_SEQ_XO_DIST_EN_CLK_REF_RX_HI(0x11) | XCVR_TSM_TIMING37_SEQ_XO_DIST_EN_CLK_REF_RX_LO(0x5B) | \
+        XCVR_TSM_TIMING37_SEQ_XO_DIST_EN_CLK_REF_TX_HI(0x11) | XCVR_TSM_TIMING37_SEQ_XO_DIST_EN_CLK_REF_TX_LO(0x71))
+#endif /* RF_OSC_26MHZ == 1 */
+/* XCVR_TSM->TIMING38 */
+#if RF_OSC_26MHZ == 1
+#define XCVR_FOLDED_TIMING38 \
+    (XCVR_TSM_TIMING38_SEQ_XO_EN_CLK_2P4G_RX_HI(0x11) | XCVR_TSM_TIMING38_SEQ_XO_EN_CLK_2P4G_RX_LO(0x5C) | \
+        XCVR_TSM_TIMING38_SEQ_XO_EN_CLK_2P4G_TX_HI(0x11) | XCVR_TSM_TIMING38_SEQ_XO_EN_CLK_2P4G_TX_LO(0x71))
+#else
+#define XCVR_FOLDED_TIMING38 \
+    (XCVR_TSM_TIMING38_SEQ_XO_EN_CLK_2P4G_RX_HI(0x11) | XCVR_TSM_TIMING38_SEQ_XO_EN_CLK_2P4G_RX_LO(0x5B) | \
+        XCVR_TSM_TIMING38_SEQ_XO_EN_CLK_2P4G_TX_HI(0x11) | XCVR_TSM_TIMING38_SEQ_XO_EN_CLK_2P4G_TX_LO(0x71))
+#endif /* RF_OSC_26MHZ == 1 */
+/* XCVR_TSM->TIMING39 */
+#if RF_OSC_26MHZ == 1
+#define XCVR_FOLDED_TIMING39 \
+    (XCVR_TSM_TIMING39_SEQ_XO_DIST_EN_CLK_ADCDAC_RX_HI(0x2B) | \
+        XCVR_TSM_TIMING39_SEQ_XO_DIST_EN_CLK_ADCDAC_RX_LO(0x5C) | \
+        XCVR_TSM_TIMING39_SEQ_XO_DIST_EN_CLK_ADCDAC_TX_HI(0x11) | \
+        XCVR_TSM_TIMING39_SEQ_XO_DIST_EN_CLK_ADCDAC_TX_LO(0x71))
+#else
+#define XCVR_FOLDED_TIMING39 \
+    (XCVR_TSM_TIMING39_SEQ_XO_DIST_EN_CLK_ADCDAC_RX_HI(0x2B) | \
+        XCVR_TSM_TIMING39_SEQ_XO_DIST_EN_CLK_ADCDAC_RX_LO(0x5B) | \
+        XCVR_TSM_TIMING39_SEQ_XO_DIST_EN_CLK_ADCDAC_TX_HI(0x11) | \
+        XCVR_TSM_TIMING39_SEQ_XO_DIST_EN_CLK_ADCDAC_TX_LO(0x71))
+#endif /* RF_OSC_26MHZ == 1 */
+/* XCVR_TSM->TIMING40 */
+#define XCVR_FOLDED_TIMING40 \
+    (XCVR_TSM_TIMING40_SEQ_DAC_PUP_RX_HI(0xFF) | XCVR_TSM_TIMING40_SEQ_DAC_PUP_RX_LO(0xFF) | \
+        XCVR_TSM_TIMING40_SEQ_DAC_PUP_TX_HI(0x11) | XCVR_TSM_TIMING40_SEQ_DAC_PUP_TX_LO(0x71))
+/* XCVR_TSM->TIMING41 */
+#define XCVR_FOLDED_TIMING41 \
+    (XCVR_TSM_TIMING41_SEQ_VCO_EN_HPM_RX_HI(0xFF) | XCVR_TSM_TIMING41_SEQ_VCO_EN_HPM_RX_LO(0xFF) | \
+        XCVR_TSM_TIMING41_SEQ_VCO_EN_HPM_TX_HI(0x11) | XCVR_TSM_TIMING41_SEQ_VCO_EN_HPM_TX_LO(0x71))
+/* XCVR_TSM->TIMING42 */
+#if RF_OSC_26MHZ == 1
+#define XCVR_FOLDED_TIMING42 \
+    (XCVR_TSM_TIMING42_SEQ_LO_PUP_VLO_FBK_RX_HI(0x12) | XCVR_TSM_TIMING42_SEQ_LO_PUP_VLO_FBK_RX_LO(0x5C) | \
+        XCVR_TSM_TIMING42_SEQ_LO_PUP_VLO_FBK_TX_HI(0x12) | XCVR_TSM_TIMING42_SEQ_LO_PUP_VLO_FBK_TX_LO(0x71))
+#else
+#define XCVR_FOLDED_TIMING42 \
+    (XCVR_TSM_TIMING42_SEQ_LO_PUP_VLO_FBK_RX_HI(0x12) | XCVR_TSM_TIMING42_SEQ_LO_PUP_VLO_FBK_RX_LO(0x5B) | \
+        XCVR_TSM_TIMING42_SEQ_LO_PUP_VLO_FBK_TX_HI(0x12) | XCVR_TSM_TIMING42_SEQ_LO_PUP_VLO_FBK_TX_LO(0x71))
+#endif /* RF_OSC_26MHZ == 1 */
+/* XCVR_TSM->TIMING43 */
+#if RF_OSC_26MHZ == 1
+#define XCVR_FOLDED_TIMING43 \
+    (XCVR_TSM_TIMING43_SEQ_LO_PUP_VLO_RX_RX_HI(0x12) | XCVR_TSM_TIMING43_SEQ_LO_PUP_VLO_RX_RX_LO(0x5C) | \
+        XCVR_TSM_TIMING43_SEQ_LO_PUP_VLO_RX_TX_HI(0xFF) | XCVR_TSM_TIMING43_SEQ_LO_PUP_VLO_RX_TX_LO(0xFF))
+#else
+#define XCVR_FOLDED_TIMING43 \
+    (XCVR_TSM_TIMING43_SEQ_LO_PUP_VLO_RX_RX_HI(0x12) | XCVR_TSM_TIMING43_SEQ_LO_PUP_VLO_RX_RX_LO(0x5B) | \
+        XCVR_TSM_TIMING43_SEQ_LO_PUP_VLO_RX_TX_HI(0xFF) | XCVR_TSM_TIMING43_SEQ_LO_PUP_VLO_RX_TX_LO(0xFF))
+#endif /* RF_OSC_26MHZ == 1 */
+/* XCVR_TSM->TIMING44 */
+#if RF_OSC_26MHZ == 1
+#define XCVR_FOLDED_TIMING44 \
+    (XCVR_TSM_TIMING44_SEQ_LO_PUP_VLO_RXDRV_RX_HI(0x12) | \
+        XCVR_TSM_TIMING44_SEQ_LO_PUP_VLO_RXDRV_RX_LO(0x5C) | \
+        XCVR_TSM_TIMING44_SEQ_LO_PUP_VLO_RXDRV_TX_HI(0xFF) | XCVR_TSM_TIMING44_SEQ_LO_PUP_VLO_RXDRV_TX_LO(0xFF))
+#else
+#define XCVR_FOLDED_TIMING44 \
+    (XCVR_TSM_TIMING44_SEQ_LO_PUP_VLO_RXDRV_RX_HI(0x12) | \
+        XCVR_TSM_TIMING44_SEQ_LO_PUP_VLO_RXDRV_RX_LO(0x5B) | \
+        XCVR_TSM_TIMING44_SEQ_LO_PUP_VLO_RXDRV_TX_HI(0xFF) | XCVR_TSM_TIMING44_SEQ_LO_PUP_VLO_RXDRV_TX_LO(0xFF))
+#endif /* RF_OSC_26MHZ == 1 */
+/* XCVR_TSM->TIMING45 */
+#define XCVR_FOLDED_TIMING45 \
+    (XCVR_TSM_TIMING45_SEQ_LO_PUP_VLO_TX_RX_HI(0xFF) | XCVR_TSM_TIMING45_SEQ_LO_PUP_VLO_TX_RX_LO(0xFF) | \
+        XCVR_TSM_TIMING45_SEQ_LO_PUP_VLO_TX_TX_HI(0x12) | XCVR_TSM_TIMING45_SEQ_LO_PUP_VLO_TX_TX_LO(0x71))
+/* XCVR_TSM->TIMING46 */
+#define XCVR_FOLDED_TIMING46 \
+    (XCVR_TSM_TIMING46_SEQ_LO_PUP_VLO_TXDRV_RX_HI(0xFF) | \
+        XCVR_TSM_TIMING46_SEQ_LO_PUP_VLO_TXDRV_RX_LO(0xFF) | \
+        XCVR_TSM_TIMING46_SEQ_LO_PUP_VLO_TXDRV_TX_HI(0x6F) | XCVR_TSM_TIMING46_SEQ_LO_PUP_VLO_TXDRV_TX_LO(0x71))
+/* XCVR_TSM->TIMING47 */
+#if RF_OSC_26MHZ == 1
+#define XCVR_FOLDED_TIMING47 \
+    (XCVR_TSM_TIMING47_SEQ_DIVN_PUP_RX_HI(0x13) | XCVR_TSM_TIMING47_SEQ_DIVN_PUP_RX_LO(0x5C) | \
+        XCVR_TSM_TIMING47_SEQ_DIVN_PUP_TX_HI(0x57) | XCVR_TSM_TIMING47_SEQ_DIVN_PUP_TX_LO(0x71))
+#else
+#define XCVR_FOLDED_TIMING47 \
+    (XCVR_TSM_TIMING47_SEQ_DIVN_PUP_RX_HI(0x13) | XCVR_TSM_TIMING47_SEQ_DIVN_PUP_RX_LO(0x5B) | \
+        XCVR_TSM_TIMING47_SEQ_DIVN_PUP_TX_HI(0x57) | XCVR_TSM_TIMING47_SEQ_DIVN_PUP_TX_LO(0x71))
+#endif /* RF_OSC_26MHZ == 1 */
+/* XCVR_TSM->TIMING48 */
+#if RF_OSC_26MHZ == 1
+#define XCVR_FOLDED_TIMING48 \
+    (XCVR_TSM_TIMING48_SEQ_DIVN_CLOSEDLOOP_RX_HI(0x23) | XCVR_TSM_TIMING48_SEQ_DIVN_CLOSEDLOOP_RX_LO(0x5C) | \
+        XCVR_TSM_TIMING48_SEQ_DIVN_CLOSEDLOOP_TX_HI(0x5A) | XCVR_TSM_TIMING48_SEQ_DIVN_CLOSEDLOOP_TX_LO(0x71))
+#else
+#define XCVR_FOLDED_TIMING48 \
+    (XCVR_TSM_TIMING48_SEQ_DIVN_CLOSEDLOOP_RX_HI(0x23) | XCVR_TSM_TIMING48_SEQ_DIVN_CLOSEDLOOP_RX_LO(0x5B) | \
+        XCVR_TSM_TIMING48_SEQ_DIVN_CLOSEDLOOP_TX_HI(0x5A) | XCVR_TSM_TIMING48_SEQ_DIVN_CLOSEDLOOP_TX_LO(0x71))
+#endif /* RF_OSC_26MHZ == 1 */
+/* XCVR_TSM->TIMING49 */
+#if RF_OSC_26MHZ == 1
+#define XCVR_FOLDED_TIMING49 \
+    (XCVR_TSM_TIMING49_SEQ_PD_EN_PD_DRV_RX_HI(0x23) | XCVR_TSM_TIMING49_SEQ_PD_EN_PD_DRV_RX_LO(0x5C) | \
+        XCVR_TSM_TIMING49_SEQ_PD_EN_PD_DRV_TX_HI(0x5A) | XCVR_TSM_TIMING49_SEQ_PD_EN_PD_DRV_TX_LO(0x71))
+#else
+#define XCVR_FOLDED_TIMING49 \
+    (XCVR_TSM_TIMING49_SEQ_PD_EN_PD_DRV_RX_HI(0x23) | XCVR_TSM_TIMING49_SEQ_PD_EN_PD_DRV_RX_LO(0x5B) | \
+        XCVR_TSM_TIMING49_SEQ_PD_EN_PD_DRV_TX_HI(0x5A) | XCVR_TSM_TIMING49_SEQ_PD_EN_PD_DRV_TX_LO(0x71))
+#endif /* RF_OSC_26MHZ == 1 */
+/* XCVR_TSM->TIMING50 */
+#if RF_OSC_26MHZ == 1
+#define XCVR_FOLDED_TIMING50 \
+    (XCVR_TSM_TIMING50_SEQ_CBPF_EN_DCOC_RX_HI(0x2B) | XCVR_TSM_TIMING50_SEQ_CBPF_EN_DCOC_RX_LO(0x5C) | \
+        XCVR_TSM_TIMING50_SEQ_CBPF_EN_DCOC_TX_HI(0xFF) | XCVR_TSM_TIMING50_SEQ_CBPF_EN_DCOC_TX_LO(0xFF))
+#else
+#define XCVR_FOLDED_TIMING50 \
+    (XCVR_TSM_TIMING50_SEQ_CBPF_EN_DCOC_RX_HI(0x2B) | XCVR_TSM_TIMING50_SEQ_CBPF_EN_DCOC_RX_LO(0x5B) | \
+        XCVR_TSM_TIMING50_SEQ_CBPF_EN_DCOC_TX_HI(0xFF) | XCVR_TSM_TIMING50_SEQ_CBPF_EN_DCOC_TX_LO(0xFF))
+#endif /* RF_OSC_26MHZ == 1 */
+/* XCVR_TSM->TIMING51 */
+#if RF_OSC_26MHZ == 1
+#define XCVR_FOLDED_TIMING51 \
+    (XCVR_TSM_TIMING51_SEQ_RX_GANG_PUP_RX_HI(0x2B) | XCVR_TSM_TIMING51_SEQ_RX_GANG_PUP_RX_LO(0x5C) | \
+        XCVR_TSM_TIMING51_SEQ_RX_GANG_PUP_TX_HI(0xFF) | XCVR_TSM_TIMING51_SEQ_RX_GANG_PUP_TX_LO(0xFF))
+#else
+#define XCVR_FOLDED_TIMING51 \
+    (XCVR_TSM_TIMING51_SEQ_RX_GANG_PUP_RX_HI(0x2B) | XCVR_TSM_TIMING51_SEQ_RX_GANG_PUP_RX_LO(0x5B) | \
+        XCVR_TSM_TIMING51_SEQ_RX_GANG_PUP_TX_HI(0xFF) | XCVR_TSM_TIMING51_SEQ_RX_GANG_PUP_TX_LO(0xFF))
+#endif /* RF_OSC_26MHZ == 1 */
+/* XCVR_TSM->TIMING52 */
+#define XCVR_FOLDED_TIMING52 \
+    (XCVR_TSM_TIMING52_SEQ_SPARE3_RX_HI(0xFF) | XCVR_TSM_TIMING52_SEQ_SPARE3_RX_LO(0xFF) | \
+        XCVR_TSM_TIMING52_SEQ_SPARE3_TX_HI(0xFF) | XCVR_TSM_TIMING52_SEQ_SPARE3_TX_LO(0xFF))
+/* XCVR_TSM->WU_LATENCY */
+#define XCVR_FOLDED_WU_LATENCY \
+    (XCVR_TSM_WU_LATENCY_RX_SETTLING_LATENCY(0x06) | \
+        XCVR_TSM_WU_LATENCY_TX_DATAPATH_LATENCY(0x06))
+/* XCVR_TX_DIG->DATA_PADDING_CTRL */
+#define XCVR_FOLDED_DATA_PADDING_CTRL \
+    (XCVR_TX_DIG_DATA_PADDING_CTRL_CTE_DATA(1) | XCVR_TX_DIG_DATA_PADDING_CTRL_RAMP_DN_PAD_EN(0) | \
+        XCVR_TX_DIG_DATA_PADDING_CTRL_TX_CAPTURE_POL(0))
+/* XCVR_TX_DIG->DATA_PADDING_CTRL_1 */
+#define XCVR_FOLDED_DATA_PADDING_CTRL_1 \
+    (XCVR_TX_DIG_DATA_PADDING_CTRL_1_PA_PUP_ADJ(0x1))
+/* XCVR_TX_DIG->IMAGE_FILTER_CTRL */
+#define XCVR_FOLDED_IMAGE_FILTER_CTRL \
+    (XCVR_TX_DIG_IMAGE_FILTER_CTRL_FREQ_WORD_ADJ(0x0000) | \
+        XCVR_TX_DIG_IMAGE_FILTER_CTRL_IMAGE_FIR_FILTER_OVRD(0) | \
+        XCVR_TX_DIG_IMAGE_FILTER_CTRL_IMAGE_FIR_FILTER_SEL(0) | \
+        XCVR_TX_DIG_IMAGE_FILTER_CTRL_IMAGE_SYNC0_FILTER_OVRD(0) | \
+        XCVR_TX_DIG_IMAGE_FILTER_CTRL_IMAGE_SYNC1_FILTER_OVRD(0))
+/* XCVR_TX_DIG->PA_CTRL */
+#define XCVR_FOLDED_PA_CTRL \
+    (XCVR_TX_DIG_PA_CTRL_EARLY_WU_COMPLETE(0) | XCVR_TX_DIG_PA_CTRL_PA_TGT_POWER(0x26) | \
+        XCVR_TX_DIG_PA_CTRL_TGT_PWR_SRC(1) | XCVR_TX_DIG_PA_CTRL_TX_PA_PUP_OVRD(0) | \
+        XCVR_TX_DIG_PA_CTRL_TX_PA_PUP_OVRD_EN(0))
+/* XCVR_TX_DIG->PA_RAMP_TBL0 */
+#define XCVR_FOLDED_PA_RAMP_TBL0 \
+    (XCVR_TX_DIG_PA_RAMP_TBL0_PA_RAMP0(0x01) | XCVR_TX_DIG_PA_RAMP_TBL0_PA_RAMP1(0x02) | \
+        XCVR_TX_DIG_PA_RAMP_TBL0_PA_RAMP2(0x04) | XCVR_TX_DIG_PA_RAMP_TBL0_PA_RAMP3(0x06))
+/* XCVR_TX_DIG->PA_RAMP_TBL1 */
+#define XCVR_FOLDED_PA_RAMP_TBL1 \
+    (XCVR_TX_DIG_PA_RAMP_TBL1_PA_RAMP4(0x09) | XCVR_TX_DIG_PA_RAMP_TBL1_PA_RAMP5(0x0C) | \
+        XCVR_TX_DIG_PA_RAMP_TBL1_PA_RAMP6(0x10) | XCVR_TX_DIG_PA_RAMP_TBL1_PA_RAMP7(0x14))
+/* XCVR_TX_DIG->PA_RAMP_TBL2 */
+#define XCVR_FOLDED_PA_RAMP_TBL2 \
+    (XCVR_TX_DIG_PA_RAMP_TBL2_PA_RAMP10(0x21) | XCVR_TX_DIG_PA_RAMP_TBL2_PA_RAMP11(0x26) | \
+        XCVR_TX_DIG_PA_RAMP_TBL2_PA_RAMP8(0x18) | XCVR_TX_DIG_PA_RAMP_TBL2_PA_RAMP9(0x1C))
+/* XCVR_TX_DIG->PA_RAMP_TBL3 */
+#define XCVR_FOLDED_PA_RAMP_TBL3 \
+    (XCVR_TX_DIG_PA_RAMP_TBL3_PA_RAMP12(0x2C) | XCVR_TX_DIG_PA_RAMP_TBL3_PA_RAMP13(0x32) | \
+        XCVR_TX_DIG_PA_RAMP_TBL3_PA_RAMP14(0x38) | XCVR_TX_DIG_PA_RAMP_TBL3_PA_RAMP15(0x3C))
+/* XCVR_TX_DIG->SWITCH_TX_CTRL */
+#define XCVR_FOLDED_SWITCH_TX_CTRL \
+    (XCVR_TX_DIG_SWITCH_TX_CTRL_SWITCH_FIR_SEL(0) | XCVR_TX_DIG_SWITCH_TX_CTRL_SWITCH_GFSK_COEFF(0) | \
+        XCVR_TX_DIG_SWITCH_TX_CTRL_SWITCH_MOD(0) | XCVR_TX_DIG_SWITCH_TX_CTRL_SWITCH_TGT_PWR(0x00))
+/* XCVR_TX_DIG->TXDIG_CTRL */
+#define XCVR_FOLDED_TXDIG_CTRL \
+    (XCVR_TX_DIG_TXDIG_CTRL_INV_DATA_OUT(0))
+
+const xcvr_folded_config_t xcvr_fsk_h_0p5_1mbps_folded_config = {
+    .config     = &xcvr_fsk_h_0p5_1mbps_full_config,
+    .reg_values = {
+        /* 0: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x14) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x10) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x0C) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x08) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+        /* 1: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x34) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x30),
+        /* 2: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x2C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x28) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x24),
+        /* 3: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x14) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x10) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x0C) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x08) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+        /* 4: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x34) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x38),
+        /* 5: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x3C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x04),
+        /* 6: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x0C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x08) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x04) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+        /* 7: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x08),
+        /* 8: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x04) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x3C),
+        /* 9: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x0C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x08) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x04) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+        /* 10: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x10),
+        /* 11: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x14) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x18) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x1C),
+        /* 12: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x34) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x38) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x3C) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+        /* 13: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x34) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x30),
+        /* 14: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x2C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x28) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x24),
+        /* 15: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x34) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x38) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x3C) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+        /* 16: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x34) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x38),
+        /* 17: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x3C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x04),
+        /* 18: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x2C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x30) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x34) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x38) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+        /* 19: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x08),
+        /* 20: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x04) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x3C),
+        /* 21: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x2C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x30) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x34) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x38) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+        /* 22: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x10),
+        /* 23: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x14) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x18) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x1C),
+        /* 24: GEN4PHY->DMD_CTRL0 */
+        XCVR_FOLDED_DMD_CTRL0,
+        /* 25: GEN4PHY->DMD_CTRL1 */
+        XCVR_FOLDED_DMD_CTRL1,
+        /* 26: GEN4PHY->FSK_CFG0 */
+        XCVR_FOLDED_FSK_CFG0 | GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_1M(0x0F) |
+            GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_2M(0x11) |
+            GEN4PHY_FSK_CFG0_MSK2FSK_SEED(0) | GEN4PHY_FSK_CFG0_MSK_EN(0),
+        /* 27: GEN4PHY->FSK_CFG1 */
+        GEN4PHY_FSK_CFG1_OVERH(0x020) | GEN4PHY_FSK_CFG1_OVERH_INV(0x100) | GEN4PHY_FSK_CFG1_SYNCTSCALE(0xF),
+        /* 28: GEN4PHY->FSK_CFG2 */
+        XCVR_FOLDED_FSK_CFG2,
+        /* 29: GEN4PHY->FSK_FAD_CFG */
+        XCVR_FOLDED_FSK_FAD_CFG,
+        /* 30: GEN4PHY->FSK_FAD_CTRL */
+        XCVR_FOLDED_FSK_FAD_CTRL,
+        /* 31: GEN4PHY->FSK_PD_CFG0 */
+        GEN4PHY_FSK_PD_CFG0_PD_IIR_ALPHA(0xFF) | GEN4PHY_FSK_PD_CFG0_PREAMBLE_T_SCALE(0xC),
+        /* 32: GEN4PHY->FSK_PD_CFG1 */
+        GEN4PHY_FSK_PD_CFG1_PREAMBLE_PATTERN(0x55),
+        /* 33: GEN4PHY->FSK_PD_CFG2 */
+        GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_1M(0xF0) | GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_2M(0xF6),
+        /* 34: GEN4PHY->FSK_PD_PH[0] */
+        GEN4PHY_FSK_PD_PH_REF0(0x02) | GEN4PHY_FSK_PD_PH_REF1(0x03) | GEN4PHY_FSK_PD_PH_REF2(0x02) |
+            GEN4PHY_FSK_PD_PH_REF3(0x00),
+        /* 35: GEN4PHY->FSK_PD_PH[1] */
+        GEN4PHY_FSK_PD_PH_REF0(0x3E) | GEN4PHY_FSK_PD_PH_REF1(0x3D) | GEN4PHY_FSK_PD_PH_REF2(0x3E) |
+            GEN4PHY_FSK_PD_PH_REF3(0x00),
+        /* 36: GEN4PHY->FSK_PT */
+        XCVR_FOLDED_FSK_PT | GEN4PHY_FSK_PT_AGC_TIMEOUT(0x0048),
+        /* 37: GEN4PHY->LR_AA_CFG */
+        GEN4PHY_LR_AA_CFG_AA_COR_THRESH(0x00) | GEN4PHY_LR_AA_CFG_AA_HAM_THRESH(0x00) |
+            GEN4PHY_LR_AA_CFG_AA_LR_CORR_GAIN(0x00) | GEN4PHY_LR_AA_CFG_ACCESS_ADDR_HAM(0x00),
+        /* 38: GEN4PHY->LR_PD_CFG */
+        GEN4PHY_LR_PD_CFG_CORR_TH(0x00) | GEN4PHY_LR_PD_CFG_FREQ_TH(0x00) | GEN4PHY_LR_PD_CFG_NO_PEAKS(0),
+        /* 39: GEN4PHY->LR_PD_PH[0] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 40: GEN4PHY->LR_PD_PH[1] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 41: GEN4PHY->LR_PD_PH[2] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 42: GEN4PHY->LR_PD_PH[3] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 43: GEN4PHY->MISC */
+        XCVR_FOLDED_MISC,
+        /* 44: GEN4PHY->PREPHY_MISC */
+        XCVR_FOLDED_PREPHY_MISC,
+        /* 45: GEN4PHY->RTT_CTRL */
+        XCVR_FOLDED_RTT_CTRL,
+        /* 46: GEN4PHY->RTT_REF */
+        GEN4PHY_RTT_REF_FM_REF_010(0x48) | GEN4PHY_RTT_REF_FM_REF_110(0x63) | GEN4PHY_RTT_REF_FM_REF_111(0x80),
+        /* 47: GEN4PHY->SM_CFG */
+        XCVR_FOLDED_SM_CFG | GEN4PHY_SM_CFG_AA_TIMEOUT_UNCODED(0x0A0),
+        /* 48: RADIO_CTRL->LL_CTRL */
+        RADIO_CTRL_LL_CTRL_ACTIVE_LL(2),
+        /* 49: XCVR_ANALOG->LDO_0 */
+        XCVR_FOLDED_LDO_0,
+        /* 50: XCVR_ANALOG->LDO_1 */
+        XCVR_FOLDED_LDO_1,
+        /* 51: XCVR_ANALOG->PLL */
+        XCVR_FOLDED_PLL,
+        /* 52: XCVR_ANALOG->RX_0 */
+        XCVR_FOLDED_RX_0,
+        /* 53: XCVR_ANALOG->RX_1 */
+        XCVR_FOLDED_RX_1,
+        /* 54: XCVR_ANALOG->TX_DAC_PA */
+        XCVR_FOLDED_TX_DAC_PA | XCVR_ANALOG_TX_DAC_PA_DAC_TRIM_CFBK_DRS(0),
+        /* 55: XCVR_ANALOG->XO_DIST */
+        XCVR_FOLDED_XO_DIST,
+        /* 56: XCVR_MISC->IPS_FO_ADDR[0] */
+        XCVR_MISC_IPS_FO_ADDR_ADDR(0x370) | XCVR_MISC_IPS_FO_ADDR_ENTRY_RX(0) | XCVR_MISC_IPS_FO_ADDR_ENTRY_TX(0),
+        /* 57: XCVR_MISC->IPS_FO_ADDR[1] */
+        XCVR_MISC_IPS_FO_ADDR_ADDR(0x02C) | XCVR_MISC_IPS_FO_ADDR_ENTRY_RX(0) | XCVR_MISC_IPS_FO_ADDR_ENTRY_TX(0),
+        /* 58: XCVR_MISC->IPS_FO_DRS0_DATA[0] */
+        XCVR_MISC_IPS_FO_DRS0_DATA_DRS0_DATA(0x00000000),
+        /* 59: XCVR_MISC->IPS_FO_DRS0_DATA[1] */
+        XCVR_MISC_IPS_FO_DRS0_DATA_DRS0_DATA(0x00000000),
+        /* 60: XCVR_MISC->IPS_FO_DRS1_DATA[0] */
+        XCVR_MISC_IPS_FO_DRS1_DATA_DRS1_DATA(0x00000000),
+        /* 61: XCVR_MISC->IPS_FO_DRS1_DATA[1] */
+        XCVR_MISC_IPS_FO_DRS1_DATA_DRS1_DATA(0x00000000),
+        /* 62: XCVR_MISC->LDO_TRIM_0 */
+        XCVR_FOLDED_LDO_TRIM_0,
+        /* 63: XCVR_MISC->LDO_TRIM_1 */
+        XCVR_FOLDED_LDO_TRIM_1,
+        /* 64: XCVR_MISC->XCVR_CTRL */
+        XCVR_FOLDED_XCVR_CTRL | XCVR_MISC_XCVR_CTRL_DATA_RATE_DRS(0) | XCVR_MISC_XCVR_CTRL_DEMOD_SEL(1) |
+            XCVR_MISC_XCVR_CTRL_LL_CFG_CAPT_DIS(0),
+        /* 65: XCVR_PLL_DIG->CHAN_MAP */
+        XCVR_FOLDED_CHAN_MAP | XCVR_PLL_DIG_CHAN_MAP_BAND_SELECT(0),
+        /* 66: XCVR_PLL_DIG->CHAN_MAP_EXT */
+#if RF_OSC_26MHZ == 1
+        XCVR_FOLDED_CHAN_MAP_EXT | XCVR_PLL_DIG_CHAN_MAP_EXT_NUM_OFFSET(0x013B13B),
+#else
+        XCVR_FOLDED_CHAN_MAP_EXT | XCVR_PLL_DIG_CHAN_MAP_EXT_NUM_OFFSET(0x0100000),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 67: XCVR_PLL_DIG->DATA_RATE_OVRD_CTRL1 */
+        XCVR_FOLDED_DATA_RATE_OVRD_CTRL1,
+        /* 68: XCVR_PLL_DIG->DATA_RATE_OVRD_CTRL2 */
+#if RF_OSC_26MHZ == 1
+        XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL2_NUM_OFFSET_CFG1(0x01D89D9),
+#else
+        XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL2_NUM_OFFSET_CFG1(0x0180000),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 69: XCVR_PLL_DIG->DELAY_MATCH */
+        XCVR_FOLDED_DELAY_MATCH | XCVR_PLL_DIG_DELAY_MATCH_HPM_INTEGER_DELAY(0x04) |
+            XCVR_PLL_DIG_DELAY_MATCH_LPM_SDM_DELAY(0x03),
+        /* 70: XCVR_PLL_DIG->HPMCAL_CTRL */
+        XCVR_FOLDED_HPMCAL_CTRL | XCVR_PLL_DIG_HPMCAL_CTRL_HPM_CAL_ARRAY_SIZE(0),
+        /* 71: XCVR_PLL_DIG->HPM_BUMP */
+        XCVR_FOLDED_HPM_BUMP | XCVR_PLL_DIG_HPM_BUMP_HPM_VCM_CAL(2) | XCVR_PLL_DIG_HPM_BUMP_HPM_VCM_TX(2),
+        /* 72: XCVR_PLL_DIG->HPM_CAL_TIMING */
+        XCVR_FOLDED_HPM_CAL_TIMING,
+        /* 73: XCVR_PLL_DIG->HPM_CTRL */
+        XCVR_FOLDED_HPM_CTRL,
+        /* 74: XCVR_PLL_DIG->HPM_SDM_RES */
+        XCVR_FOLDED_HPM_SDM_RES | XCVR_PLL_DIG_HPM_SDM_RES_HPM_COUNT_ADJUST(0x02),
+        /* 75: XCVR_PLL_DIG->LOCK_DETECT */
+        XCVR_FOLDED_LOCK_DETECT,
+        /* 76: XCVR_PLL_DIG->LPM_CTRL */
+        XCVR_FOLDED_LPM_CTRL,
+        /* 77: XCVR_PLL_DIG->LPM_SDM_CTRL1 */
+        XCVR_FOLDED_LPM_SDM_CTRL1,
+        /* 78: XCVR_PLL_DIG->MOD_CTRL */
+        XCVR_FOLDED_MOD_CTRL,
+        /* 79: XCVR_PLL_DIG->PLL_DATARATE_CTRL */
+        XCVR_FOLDED_PLL_DATARATE_CTRL,
+        /* 80: XCVR_PLL_DIG->TUNING_CAP_RX_CTRL */
+        XCVR_FOLDED_TUNING_CAP_RX_CTRL,
+        /* 81: XCVR_PLL_DIG->TUNING_CAP_TX_CTRL */
+        XCVR_FOLDED_TUNING_CAP_TX_CTRL,
+        /* 82: XCVR_RX_DIG->ACQ_FILT_0_3 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x03) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x00) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x78) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x77),
+#else
+        XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x03) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x01) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x76) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x03),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 83: XCVR_RX_DIG->ACQ_FILT_0_3_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H0(0x3F) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H1(0x03) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H2(0x08) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H3(0x0A),
+#else
+        XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H0(0x02) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H1(0x03) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H2(0x7C) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H3(0x75),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 84: XCVR_RX_DIG->ACQ_FILT_10_11 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x066) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x0C9),
+#else
+        XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x3FA) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x140),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 85: XCVR_RX_DIG->ACQ_FILT_10_11_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x069) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x08E),
+#else
+        XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x065) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x0DD),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 86: XCVR_RX_DIG->ACQ_FILT_4_7 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x06) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x1A) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_H6(0x11) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0xE7),
+#else
+        XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x15) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x6D) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_H6(0xE2) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0x36),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 87: XCVR_RX_DIG->ACQ_FILT_4_7_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x03) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x74) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0xE6) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0xE6),
+#else
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x7E) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x15) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0x19) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0xF0),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 88: XCVR_RX_DIG->ACQ_FILT_8_9 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x1CA) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x1F5),
+#else
+        XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x01F) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x18F),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 89: XCVR_RX_DIG->ACQ_FILT_8_9_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x1FF) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x031),
+#else
+        XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x1C5) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x1E7),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 90: XCVR_RX_DIG->AGC_CTRL */
+        XCVR_FOLDED_AGC_CTRL,
+        /* 91: XCVR_RX_DIG->AGC_CTRL_STAT */
+        XCVR_FOLDED_AGC_CTRL_STAT,
+        /* 92: XCVR_RX_DIG->AGC_IDX0_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX0_GAIN_CFG,
+        /* 93: XCVR_RX_DIG->AGC_IDX0_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX0_GAIN_VAL,
+        /* 94: XCVR_RX_DIG->AGC_IDX0_THR */
+        XCVR_FOLDED_AGC_IDX0_THR,
+        /* 95: XCVR_RX_DIG->AGC_IDX10_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX10_GAIN_CFG,
+        /* 96: XCVR_RX_DIG->AGC_IDX10_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX10_GAIN_VAL,
+        /* 97: XCVR_RX_DIG->AGC_IDX10_THR */
+        XCVR_FOLDED_AGC_IDX10_THR,
+        /* 98: XCVR_RX_DIG->AGC_IDX11_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX11_GAIN_CFG | XCVR_RX_DIG_AGC_IDX11_GAIN_CFG_MAG_THR_11_DRS_OFS(0x00) |
+            XCVR_RX_DIG_AGC_IDX11_GAIN_CFG_MAG_THR_HI_11_DRS_OFS(0x00),
+        /* 99: XCVR_RX_DIG->AGC_IDX11_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX11_GAIN_VAL | XCVR_RX_DIG_AGC_IDX11_GAIN_VAL_MAG_THR_11(0x000) |
+            XCVR_RX_DIG_AGC_IDX11_GAIN_VAL_MAG_THR_HI_11(0x000),
+        /* 100: XCVR_RX_DIG->AGC_IDX11_THR */
+        XCVR_FOLDED_AGC_IDX11_THR,
+        /* 101: XCVR_RX_DIG->AGC_IDX1_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX1_GAIN_CFG,
+        /* 102: XCVR_RX_DIG->AGC_IDX1_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX1_GAIN_VAL,
+        /* 103: XCVR_RX_DIG->AGC_IDX1_THR */
+        XCVR_FOLDED_AGC_IDX1_THR,
+        /* 104: XCVR_RX_DIG->AGC_IDX2_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX2_GAIN_CFG,
+        /* 105: XCVR_RX_DIG->AGC_IDX2_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX2_GAIN_VAL,
+        /* 106: XCVR_RX_DIG->AGC_IDX2_THR */
+        XCVR_FOLDED_AGC_IDX2_THR,
+        /* 107: XCVR_RX_DIG->AGC_IDX3_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX3_GAIN_CFG,
+        /* 108: XCVR_RX_DIG->AGC_IDX3_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX3_GAIN_VAL,
+        /* 109: XCVR_RX_DIG->AGC_IDX3_THR */
+        XCVR_FOLDED_AGC_IDX3_THR,
+        /* 110: XCVR_RX_DIG->AGC_IDX4_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX4_GAIN_CFG,
+        /* 111: XCVR_RX_DIG->AGC_IDX4_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX4_GAIN_VAL,
+        /* 112: XCVR_RX_DIG->AGC_IDX4_THR */
+        XCVR_FOLDED_AGC_IDX4_THR,
+        /* 113: XCVR_RX_DIG->AGC_IDX5_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX5_GAIN_CFG,
+        /* 114: XCVR_RX_DIG->AGC_IDX5_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX5_GAIN_VAL,
+        /* 115: XCVR_RX_DIG->AGC_IDX5_THR */
+        XCVR_FOLDED_AGC_IDX5_THR,
+        /* 116: XCVR_RX_DIG->AGC_IDX6_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX6_GAIN_CFG,
+        /* 117: XCVR_RX_DIG->AGC_IDX6_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX6_GAIN_VAL,
+        /* 118: XCVR_RX_DIG->AGC_IDX6_THR */
+        XCVR_FOLDED_AGC_IDX6_THR,
+        /* 119: XCVR_RX_DIG->AGC_IDX7_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX7_GAIN_CFG,
+        /* 120: XCVR_RX_DIG->AGC_IDX7_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX7_GAIN_VAL,
+        /* 121: XCVR_RX_DIG->AGC_IDX7_THR */
+        XCVR_FOLDED_AGC_IDX7_THR,
+        /* 122: XCVR_RX_DIG->AGC_IDX8_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX8_GAIN_CFG,
+        /* 123: XCVR_RX_DIG->AGC_IDX8_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX8_GAIN_VAL,
+        /* 124: XCVR_RX_DIG->AGC_IDX8_THR */
+        XCVR_FOLDED_AGC_IDX8_THR,
+        /* 125: XCVR_RX_DIG->AGC_IDX9_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX9_GAIN_CFG,
+        /* 126: XCVR_RX_DIG->AGC_IDX9_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX9_GAIN_VAL,
+        /* 127: XCVR_RX_DIG->AGC_IDX9_THR */
+        XCVR_FOLDED_AGC_IDX9_THR,
+        /* 128: XCVR_RX_DIG->AGC_MIS_GAIN_CFG */
+        XCVR_FOLDED_AGC_MIS_GAIN_CFG,
+        /* 129: XCVR_RX_DIG->AGC_THR_FAST */
+        XCVR_FOLDED_AGC_THR_FAST,
+        /* 130: XCVR_RX_DIG->AGC_THR_FAST_DRS */
+        XCVR_FOLDED_AGC_THR_FAST_DRS,
+        /* 131: XCVR_RX_DIG->AGC_THR_MIS */
+        XCVR_FOLDED_AGC_THR_MIS,
+        /* 132: XCVR_RX_DIG->AGC_TIMING0 */
+        XCVR_FOLDED_AGC_TIMING0 | XCVR_RX_DIG_AGC_TIMING0_AGC_GAIN_STEP_WAIT(0x10),
+        /* 133: XCVR_RX_DIG->AGC_TIMING0_DRS */
+        XCVR_FOLDED_AGC_TIMING0_DRS | XCVR_RX_DIG_AGC_TIMING0_DRS_AGC_GAIN_STEP_WAIT(0x10),
+        /* 134: XCVR_RX_DIG->AGC_TIMING1 */
+        XCVR_FOLDED_AGC_TIMING1 | XCVR_RX_DIG_AGC_TIMING1_AGC_FREEZE_TIMEOUT(0x0A) |
+            XCVR_RX_DIG_AGC_TIMING1_AGC_HOLD_TIMEOUT(0x08),
+        /* 135: XCVR_RX_DIG->AGC_TIMING1_DRS */
+        XCVR_RX_DIG_AGC_TIMING1_DRS_AGC_FREEZE_TIMEOUT(0x0A) | XCVR_RX_DIG_AGC_TIMING1_DRS_AGC_HOLD_TIMEOUT(0x08),
+        /* 136: XCVR_RX_DIG->AGC_TIMING2 */
+        XCVR_FOLDED_AGC_TIMING2 | XCVR_RX_DIG_AGC_TIMING2_AGC_UNFREEZE_FEAT_TIMEOUT(0x000) |
+            XCVR_RX_DIG_AGC_TIMING2_AGC_UNHOLD_FEAT_TIMEOUT(0x000),
+        /* 137: XCVR_RX_DIG->AGC_TIMING2_DRS */
+        XCVR_RX_DIG_AGC_TIMING2_DRS_AGC_UNFREEZE_FEAT_TIMEOUT(0x000) |
+            XCVR_RX_DIG_AGC_TIMING2_DRS_AGC_UNHOLD_FEAT_TIMEOUT(0x000),
+        /* 138: XCVR_RX_DIG->CTRL0 */
+#if RF_OSC_26MHZ == 1
+        XCVR_FOLDED_CTRL0 | XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(2) |
+            XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x03B) |
+            XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(0) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#else
+        XCVR_FOLDED_CTRL0 | XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(3) |
+            XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x030) |
+            XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(0) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 139: XCVR_RX_DIG->CTRL0_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(1) |
+            XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x03B),
+#else
+        XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(2) |
+            XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x030),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 140: XCVR_RX_DIG->CTRL1 */
+        XCVR_FOLDED_CTRL1,
+        /* 141: XCVR_RX_DIG->DCOC_CTRL0 */
+        XCVR_FOLDED_DCOC_CTRL0 | XCVR_RX_DIG_DCOC_CTRL0_DCOC_DAC_ORDER(0) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFII(0x8) |
+            XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFIIP(1) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFQQ(0x2) |
+            XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFQQP(0),
+        /* 142: XCVR_RX_DIG->DCOC_CTRL0_DRS */
+        XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFII(4) | XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFIIP(1) |
+            XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFQQ(1) | XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFQQP(0),
+        /* 143: XCVR_RX_DIG->DCOC_CTRL1 */
+        XCVR_FOLDED_DCOC_CTRL1,
+        /* 144: XCVR_RX_DIG->DEMOD_FILT_0_1 */
+        XCVR_RX_DIG_DEMOD_FILT_0_1_H0(0x002) | XCVR_RX_DIG_DEMOD_FILT_0_1_H1(0x1F6),
+        /* 145: XCVR_RX_DIG->DEMOD_FILT_0_1_DRS */
+        XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H0(0x1FE) | XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H1(0x1F5),
+        /* 146: XCVR_RX_DIG->DEMOD_FILT_2_4 */
+        XCVR_RX_DIG_DEMOD_FILT_2_4_H2(0x3F3) | XCVR_RX_DIG_DEMOD_FILT_2_4_H3(0x08A) |
+            XCVR_RX_DIG_DEMOD_FILT_2_4_H4(0x116),
+        /* 147: XCVR_RX_DIG->DEMOD_FILT_2_4_DRS */
+        XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H2(0x00B) | XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H3(0x08C) |
+            XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H4(0x0EB),
+        /* 148: XCVR_RX_DIG->NB_RSSI_CTRL0 */
+        XCVR_FOLDED_NB_RSSI_CTRL0,
+        /* 149: XCVR_RX_DIG->NB_RSSI_CTRL1 */
+        XCVR_FOLDED_NB_RSSI_CTRL1,
+        /* 150: XCVR_RX_DIG->RCCAL_CTRL0 */
+        XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE(2) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE_DRS(0) |
+            XCVR_RX_DIG_RCCAL_CTRL0_CBPF_CCODE_OFFSET(0x00) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE(0) |
+            XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE_DRS(0) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CMPOUT_INV(0) |
+            XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CODE_OFFSET(0x0) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_SMPL_DLY(0),
+        /* 151: XCVR_RX_DIG->RSSI_GLOBAL_CTRL */
+        XCVR_FOLDED_RSSI_GLOBAL_CTRL | XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_CCA1_ED_EN(0),
+        /* 152: XCVR_RX_DIG->WB_RSSI_CTRL */
+        XCVR_FOLDED_WB_RSSI_CTRL,
+        /* 153: XCVR_TSM->CTRL */
+        XCVR_FOLDED_CTRL,
+        /* 154: XCVR_TSM->END_OF_SEQ */
+        XCVR_FOLDED_END_OF_SEQ,
+        /* 155: XCVR_TSM->FAST_CTRL1 */
+        XCVR_FOLDED_FAST_CTRL1,
+        /* 156: XCVR_TSM->FAST_CTRL2 */
+        XCVR_FOLDED_FAST_CTRL2,
+        /* 157: XCVR_TSM->FAST_CTRL3 */
+        XCVR_FOLDED_FAST_CTRL3,
+        /* 158: XCVR_TSM->RECYCLE_COUNT */
+        XCVR_FOLDED_RECYCLE_COUNT,
+        /* 159: XCVR_TSM->TIMING00 */
+        XCVR_FOLDED_TIMING00,
+        /* 160: XCVR_TSM->TIMING01 */
+        XCVR_FOLDED_TIMING01,
+        /* 161: XCVR_TSM->TIMING02 */
+        XCVR_FOLDED_TIMING02,
+        /* 162: XCVR_TSM->TIMING03 */
+        XCVR_FOLDED_TIMING03,
+        /* 163: XCVR_TSM->TIMING04 */
+        XCVR_FOLDED_TIMING04,
+        /* 164: XCVR_TSM->TIMING05 */
+        XCVR_FOLDED_TIMING05,
+        /* 165: XCVR_TSM->TIMING06 */
+        XCVR_FOLDED_TIMING06,
+        /* 166: XCVR_TSM->TIMING07 */
+        XCVR_FOLDED_TIMING07,
+        /* 167: XCVR_TSM->TIMING08 */
+        XCVR_FOLDED_TIMING08,
+        /* 168: XCVR_TSM->TIMING09 */
+        XCVR_FOLDED_TIMING09,
+        /* 169: XCVR_TSM->TIMING10 */
+        XCVR_FOLDED_TIMING10,
+        /* 170: XCVR_TSM->TIMING11 */
+        XCVR_FOLDED_TIMING11,
+        /* 171: XCVR_TSM->TIMING12 */
+        XCVR_FOLDED_TIMING12,
+        /* 172: XCVR_TSM->TIMING13 */
+        XCVR_FOLDED_TIMING13,
+        /* 173: XCVR_TSM->TIMING14 */
+        XCVR_FOLDED_TIMING14,
+        /* 174: XCVR_TSM->TIMING15 */
+        XCVR_FOLDED_TIMING15,
+        /* 175: XCVR_TSM->TIMING16 */
+        XCVR_FOLDED_TIMING16,
+        /* 176: XCVR_TSM->TIMING17 */
+        XCVR_FOLDED_TIMING17,
+        /* 177: XCVR_TSM->TIMING18 */
+        XCVR_FOLDED_TIMING18,
+        /* 178: XCVR_TSM->TIMING19 */
+        XCVR_FOLDED_TIMING19,
+        /* 179: XCVR_TSM->TIMING20 */
+        XCVR_FOLDED_TIMING20,
+        /* 180: XCVR_TSM->TIMING21 */
+        XCVR_FOLDED_TIMING21,
+        /* 181: XCVR_TSM->TIMING22 */
+        XCVR_FOLDED_TIMING22,
+        /* 182: XCVR_TSM->TIMING23 */
+        XCVR_FOLDED_TIMING23,
+        /* 183: XCVR_TSM->TIMING24 */
+        XCVR_FOLDED_TIMING24,
+        /* 184: XCVR_TSM->TIMING25 */
+        XCVR_FOLDED_TIMING25,
+        /* 185: XCVR_TSM->TIMING26 */
+        XCVR_FOLDED_TIMING26,
+        /* 186: XCVR_TSM->TIMING27 */
+        XCVR_FOLDED_TIMING27,
+        /* 187: XCVR_TSM->TIMING28 */
+        XCVR_FOLDED_TIMING28,
+        /* 188: XCVR_TSM->TIMING29 */
+        XCVR_FOLDED_TIMING29,
+        /* 189: XCVR_TSM->TIMING30 */
+        XCVR_FOLDED_TIMING30,
+        /* 190: XCVR_TSM->TIMING31 */
+        XCVR_FOLDED_TIMING31,
+        /* 191: XCVR_TSM->TIMING32 */
+        XCVR_FOLDED_TIMING32,
+        /* 192: XCVR_TSM->TIMING33 */
+        XCVR_FOLDED_TIMING33,
+        /* 193: XCVR_TSM->TIMING34 */
+        XCVR_FOLDED_TIMING34,
+        /* 194: XCVR_TSM->TIMING35 */
+        XCVR_FOLDED_TIMING35,
+        /* 195: XCVR_TSM->TIMING36 */
+        XCVR_FOLDED_TIMING36,
+        /* 196: XCVR_TSM->TIMING37 */
+        XCVR_FOLDED_TIMING37,
+        /* 197: XCVR_TSM->TIMING38 */
+        XCVR_FOLDED_TIMING38,
+        /* 198: XCVR_TSM->TIMING39 */
+        XCVR_FOLDED_TIMING39,
+        /* 199: XCVR_TSM->TIMING40 */
+        XCVR_FOLDED_TIMING40,
+        /* 200: XCVR_TSM->TIMING41 */
+        XCVR_FOLDED_TIMING41,
+        /* 201: XCVR_TSM->TIMING42 */
+        XCVR_FOLDED_TIMING42,
+        /* 202: XCVR_TSM->TIMING43 */
+        XCVR_FOLDED_TIMING43,
+        /* 203: XCVR_TSM->TIMING44 */
+        XCVR_FOLDED_TIMING44,
+        /* 204: XCVR_TSM->TIMING45 */
+        XCVR_FOLDED_TIMING45,
+        /* 205: XCVR_TSM->TIMING46 */
+        XCVR_FOLDED_TIMING46,
+        /* 206: XCVR_TSM->TIMING47 */
+        XCVR_FOLDED_TIMING47,
+        /* 207: XCVR_TSM->TIMING48 */
+        XCVR_FOLDED_TIMING48,
+        /* 208: XCVR_TSM->TIMING49 */
+        XCVR_FOLDED_TIMING49,
+        /* 209: XCVR_TSM->TIMING50 */
+        XCVR_FOLDED_TIMING50,
+        /* 210: XCVR_TSM->TIMING51 */
+        XCVR_FOLDED_TIMING51,
+        /* 211: XCVR_TSM->TIMING52 */
+        XCVR_FOLDED_TIMING52,
+        /* 212: XCVR_TSM->WU_LATENCY */
+        XCVR_FOLDED_WU_LATENCY,
+        /* 213: XCVR_TX_DIG->DATARATE_CONFIG_FILTER_CTRL */
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(0),
+        /* 214: XCVR_TX_DIG->DATARATE_CONFIG_FSK_CTRL */
+        XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV0(0x0000) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV1(0x0000),
+        /* 215: XCVR_TX_DIG->DATARATE_CONFIG_GFSK_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x09DE),
+#else
+        XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x0804),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 216: XCVR_TX_DIG->DATA_PADDING_CTRL */
+        XCVR_FOLDED_DATA_PADDING_CTRL | XCVR_TX_DIG_DATA_PADDING_CTRL_DATA_PADDING_SEL(0) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_PAD_DLY(0) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_PAD_DLY_EN(1),
+        /* 217: XCVR_TX_DIG->DATA_PADDING_CTRL_1 */
+        XCVR_FOLDED_DATA_PADDING_CTRL_1 | XCVR_TX_DIG_DATA_PADDING_CTRL_1_RAMP_UP_DLY(0x04) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_1_TX_DATA_FLUSH_DLY(0x04),
+        /* 218: XCVR_TX_DIG->DATA_PADDING_CTRL_2 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_MFDEV(0x1B14) | XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_PFDEV(0x04EC),
+#else
+        XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_MFDEV(0x1C00) | XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_PFDEV(0x0400),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 219: XCVR_TX_DIG->FSK_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_0(0x1B14) | XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_1(0x04EC),
+#else
+        XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_0(0x1C00) | XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_1(0x0400),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 220: XCVR_TX_DIG->GFSK_COEFF_0_1 */
+        XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_0(0x0000) | XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_1(0x0000),
+        /* 221: XCVR_TX_DIG->GFSK_COEFF_2_3 */
+        XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_2(0x0000) | XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_3(0x0000),
+        /* 222: XCVR_TX_DIG->GFSK_COEFF_4_5 */
+        XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_4(0x0000) | XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_5(0x0000),
+        /* 223: XCVR_TX_DIG->GFSK_COEFF_6_7 */
+        XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_6(0x0000) | XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_7(0x0000),
+        /* 224: XCVR_TX_DIG->GFSK_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(0) |
+            XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x4E9),
+#else
+        XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(0) |
+            XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x3FD),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 225: XCVR_TX_DIG->IMAGE_FILTER_CTRL */
+        XCVR_FOLDED_IMAGE_FILTER_CTRL | XCVR_TX_DIG_IMAGE_FILTER_CTRL_IMAGE_FILTER_OVRD_EN(0),
+        /* 226: XCVR_TX_DIG->PA_CTRL */
+        XCVR_FOLDED_PA_CTRL | XCVR_TX_DIG_PA_CTRL_PA_RAMP_SEL(1),
+        /* 227: XCVR_TX_DIG->PA_RAMP_TBL0 */
+        XCVR_FOLDED_PA_RAMP_TBL0,
+        /* 228: XCVR_TX_DIG->PA_RAMP_TBL1 */
+        XCVR_FOLDED_PA_RAMP_TBL1,
+        /* 229: XCVR_TX_DIG->PA_RAMP_TBL2 */
+        XCVR_FOLDED_PA_RAMP_TBL2,
+        /* 230: XCVR_TX_DIG->PA_RAMP_TBL3 */
+        XCVR_FOLDED_PA_RAMP_TBL3,
+        /* 231: XCVR_TX_DIG->SWITCH_TX_CTRL */
+        XCVR_FOLDED_SWITCH_TX_CTRL,
+        /* 232: XCVR_TX_DIG->TXDIG_CTRL */
+        XCVR_FOLDED_TXDIG_CTRL | XCVR_TX_DIG_TXDIG_CTRL_DATA_STREAM_SEL(0) | XCVR_TX_DIG_TXDIG_CTRL_MODULATOR_SEL(1) |
+            XCVR_TX_DIG_TXDIG_CTRL_PFC_EN(0),
+    },
+};
+
+const xcvr_folded_config_t xcvr_fsk_h_0p5_500kbps_folded_config = {
+    .config     = &xcvr_fsk_h_0p5_500kbps_full_config,
+    .reg_values = {
+        /* 0: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x14) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x10) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x0C) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x08) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+        /* 1: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x34) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x30),
+        /* 2: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x2C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x28) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x24),
+        /* 3: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x14) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x10) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x0C) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x08) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+        /* 4: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x34) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x38),
+        /* 5: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x3C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x04),
+        /* 6: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x0C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x08) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x04) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+        /* 7: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x08),
+        /* 8: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x04) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x3C),
+        /* 9: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x0C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x08) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x04) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+        /* 10: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x10),
+        /* 11: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x14) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x18) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x1C),
+        /* 12: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x34) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x38) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x3C) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+        /* 13: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x34) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x30),
+        /* 14: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x2C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x28) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x24),
+        /* 15: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x34) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x38) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x3C) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+        /* 16: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x34) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x38),
+        /* 17: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x3C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x04),
+        /* 18: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x2C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x30) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x34) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x38) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+        /* 19: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x08),
+        /* 20: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x04) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x3C),
+        /* 21: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x2C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x30) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x34) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x38) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+        /* 22: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x10),
+        /* 23: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x14) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x18) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x1C),
+        /* 24: GEN4PHY->DMD_CTRL0 */
+        XCVR_FOLDED_DMD_CTRL0,
+        /* 25: GEN4PHY->DMD_CTRL1 */
+        XCVR_FOLDED_DMD_CTRL1,
+        /* 26: GEN4PHY->FSK_CFG0 */
+        XCVR_FOLDED_FSK_CFG0 | GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_1M(0x0F) |
+            GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_2M(0x11) |
+            GEN4PHY_FSK_CFG0_MSK2FSK_SEED(0) | GEN4PHY_FSK_CFG0_MSK_EN(0),
+        /* 27: GEN4PHY->FSK_CFG1 */
+        GEN4PHY_FSK_CFG1_OVERH(0x020) | GEN4PHY_FSK_CFG1_OVERH_INV(0x100) | GEN4PHY_FSK_CFG1_SYNCTSCALE(0xF),
+        /* 28: GEN4PHY->FSK_CFG2 */
+        XCVR_FOLDED_FSK_CFG2,
+        /* 29: GEN4PHY->FSK_FAD_CFG */
+        XCVR_FOLDED_FSK_FAD_CFG,
+        /* 30: GEN4PHY->FSK_FAD_CTRL */
+        XCVR_FOLDED_FSK_FAD_CTRL,
+        /* 31: GEN4PHY->FSK_PD_CFG0 */
+        GEN4PHY_FSK_PD_CFG0_PD_IIR_ALPHA(0xFF) | GEN4PHY_FSK_PD_CFG0_PREAMBLE_T_SCALE(0xC),
+        /* 32: GEN4PHY->FSK_PD_CFG1 */
+        GEN4PHY_FSK_PD_CFG1_PREAMBLE_PATTERN(0x55),
+        /* 33: GEN4PHY->FSK_PD_CFG2 */
+        GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_1M(0xF0) | GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_2M(0xEB),
+        /* 34: GEN4PHY->FSK_PD_PH[0] */
+        GEN4PHY_FSK_PD_PH_REF0(0x02) | GEN4PHY_FSK_PD_PH_REF1(0x03) | GEN4PHY_FSK_PD_PH_REF2(0x02) |
+            GEN4PHY_FSK_PD_PH_REF3(0x00),
+        /* 35: GEN4PHY->FSK_PD_PH[1] */
+        GEN4PHY_FSK_PD_PH_REF0(0x3E) | GEN4PHY_FSK_PD_PH_REF1(0x3D) | GEN4PHY_FSK_PD_PH_REF2(0x3E) |
+            GEN4PHY_FSK_PD_PH_REF3(0x00),
+        /* 36: GEN4PHY->FSK_PT */
+        XCVR_FOLDED_FSK_PT | GEN4PHY_FSK_PT_AGC_TIMEOUT(0x0048),
+        /* 37: GEN4PHY->LR_AA_CFG */
+        GEN4PHY_LR_AA_CFG_AA_COR_THRESH(0x00) | GEN4PHY_LR_AA_CFG_AA_HAM_THRESH(0x00) |
+            GEN4PHY_LR_AA_CFG_AA_LR_CORR_GAIN(0x00) | GEN4PHY_LR_AA_CFG_ACCESS_ADDR_HAM(0x00),
+        /* 38: GEN4PHY->LR_PD_CFG */
+        GEN4PHY_LR_PD_CFG_CORR_TH(0x00) | GEN4PHY_LR_PD_CFG_FREQ_TH(0x00) | GEN4PHY_LR_PD_CFG_NO_PEAKS(0),
+        /* 39: GEN4PHY->LR_PD_PH[0] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 40: GEN4PHY->LR_PD_PH[1] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 41: GEN4PHY->LR_PD_PH[2] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 42: GEN4PHY->LR_PD_PH[3] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 43: GEN4PHY->MISC */
+        XCVR_FOLDED_MISC,
+        /* 44: GEN4PHY->PREPHY_MISC */
+        XCVR_FOLDED_PREPHY_MISC,
+        /* 45: GEN4PHY->RTT_CTRL */
+        XCVR_FOLDED_RTT_CTRL,
+        /* 46: GEN4PHY->RTT_REF */
+        GEN4PHY_RTT_REF_FM_REF_010(0x48) | GEN4PHY_RTT_REF_FM_REF_110(0x63) | GEN4PHY_RTT_REF_FM_REF_111(0x80),
+        /* 47: GEN4PHY->SM_CFG */
+        XCVR_FOLDED_SM_CFG | GEN4PHY_SM_CFG_AA_TIMEOUT_UNCODED(0x0A0),
+        /* 48: RADIO_CTRL->LL_CTRL */
+        RADIO_CTRL_LL_CTRL_ACTIVE_LL(2),
+        /* 49: XCVR_ANALOG->LDO_0 */
+        XCVR_FOLDED_LDO_0,
+        /* 50: XCVR_ANALOG->LDO_1 */
+        XCVR_FOLDED_LDO_1,
+        /* 51: XCVR_ANALOG->PLL */
+        XCVR_FOLDED_PLL,
+        /* 52: XCVR_ANALOG->RX_0 */
+        XCVR_FOLDED_RX_0,
+        /* 53: XCVR_ANALOG->RX_1 */
+        XCVR_FOLDED_RX_1,
+        /* 54: XCVR_ANALOG->TX_DAC_PA */
+        XCVR_FOLDED_TX_DAC_PA | XCVR_ANALOG_TX_DAC_PA_DAC_TRIM_CFBK_DRS(1),
+        /* 55: XCVR_ANALOG->XO_DIST */
+        XCVR_FOLDED_XO_DIST,
+        /* 56: XCVR_MISC->IPS_FO_ADDR[0] */
+        XCVR_MISC_IPS_FO_ADDR_ADDR(0x370) | XCVR_MISC_IPS_FO_ADDR_ENTRY_RX(0) | XCVR_MISC_IPS_FO_ADDR_ENTRY_TX(0),
+        /* 57: XCVR_MISC->IPS_FO_ADDR[1] */
+        XCVR_MISC_IPS_FO_ADDR_ADDR(0x02C) | XCVR_MISC_IPS_FO_ADDR_ENTRY_RX(0) | XCVR_MISC_IPS_FO_ADDR_ENTRY_TX(0),
+        /* 58: XCVR_MISC->IPS_FO_DRS0_DATA[0] */
+        XCVR_MISC_IPS_FO_DRS0_DATA_DRS0_DATA(0x00000000),
+        /* 59: XCVR_MISC->IPS_FO_DRS0_DATA[1] */
+        XCVR_MISC_IPS_FO_DRS0_DATA_DRS0_DATA(0x00000000),
+        /* 60: XCVR_MISC->IPS_FO_DRS1_DATA[0] */
+        XCVR_MISC_IPS_FO_DRS1_DATA_DRS1_DATA(0x00000000),
+        /* 61: XCVR_MISC->IPS_FO_DRS1_DATA[1] */
+        XCVR_MISC_IPS_FO_DRS1_DATA_DRS1_DATA(0x00000000),
+        /* 62: XCVR_MISC->LDO_TRIM_0 */
+        XCVR_FOLDED_LDO_TRIM_0,
+        /* 63: XCVR_MISC->LDO_TRIM_1 */
+        XCVR_FOLDED_LDO_TRIM_1,
+        /* 64: XCVR_MISC->XCVR_CTRL */
+        XCVR_FOLDED_XCVR_CTRL | XCVR_MISC_XCVR_CTRL_DATA_RATE_DRS(2) | XCVR_MISC_XCVR_CTRL_DEMOD_SEL(1) |
+            XCVR_MISC_XCVR_CTRL_LL_CFG_CAPT_DIS(0),
+        /* 65: XCVR_PLL_DIG->CHAN_MAP */
+        XCVR_FOLDED_CHAN_MAP | XCVR_PLL_DIG_CHAN_MAP_BAND_SELECT(0),
+        /* 66: XCVR_PLL_DIG->CHAN_MAP_EXT */
+#if RF_OSC_26MHZ == 1
+        XCVR_FOLDED_CHAN_MAP_EXT | XCVR_PLL_DIG_CHAN_MAP_EXT_NUM_OFFSET(0x013B13B),
+#else
+        XCVR_FOLDED_CHAN_MAP_EXT | XCVR_PLL_DIG_CHAN_MAP_EXT_NUM_OFFSET(0x0100000),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 67: XCVR_PLL_DIG->DATA_RATE_OVRD_CTRL1 */
+        XCVR_FOLDED_DATA_RATE_OVRD_CTRL1,
+        /* 68: XCVR_PLL_DIG->DATA_RATE_OVRD_CTRL2 */
+#if RF_OSC_26MHZ == 1
+        XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL2_NUM_OFFSET_CFG1(0x013B13B),
+#else
+        XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL2_NUM_OFFSET_CFG1(0x0100000),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 69: XCVR_PLL_DIG->DELAY_MATCH */
+        XCVR_FOLDED_DELAY_MATCH | XCVR_PLL_DIG_DELAY_MATCH_HPM_INTEGER_DELAY(0x04) |
+            XCVR_PLL_DIG_DELAY_MATCH_LPM_SDM_DELAY(0x03),
+        /* 70: XCVR_PLL_DIG->HPMCAL_CTRL */
+        XCVR_FOLDED_HPMCAL_CTRL | XCVR_PLL_DIG_HPMCAL_CTRL_HPM_CAL_ARRAY_SIZE(0),
+        /* 71: XCVR_PLL_DIG->HPM_BUMP */
+        XCVR_FOLDED_HPM_BUMP | XCVR_PLL_DIG_HPM_BUMP_HPM_VCM_CAL(2) | XCVR_PLL_DIG_HPM_BUMP_HPM_VCM_TX(2),
+        /* 72: XCVR_PLL_DIG->HPM_CAL_TIMING */
+        XCVR_FOLDED_HPM_CAL_TIMING,
+        /* 73: XCVR_PLL_DIG->HPM_CTRL */
+        XCVR_FOLDED_HPM_CTRL,
+        /* 74: XCVR_PLL_DIG->HPM_SDM_RES */
+        XCVR_FOLDED_HPM_SDM_RES | XCVR_PLL_DIG_HPM_SDM_RES_HPM_COUNT_ADJUST(0x02),
+        /* 75: XCVR_PLL_DIG->LOCK_DETECT */
+        XCVR_FOLDED_LOCK_DETECT,
+        /* 76: XCVR_PLL_DIG->LPM_CTRL */
+        XCVR_FOLDED_LPM_CTRL,
+        /* 77: XCVR_PLL_DIG->LPM_SDM_CTRL1 */
+        XCVR_FOLDED_LPM_SDM_CTRL1,
+        /* 78: XCVR_PLL_DIG->MOD_CTRL */
+        XCVR_FOLDED_MOD_CTRL,
+        /* 79: XCVR_PLL_DIG->PLL_DATARATE_CTRL */
+        XCVR_FOLDED_PLL_DATARATE_CTRL,
+        /* 80: XCVR_PLL_DIG->TUNING_CAP_RX_CTRL */
+        XCVR_FOLDED_TUNING_CAP_RX_CTRL,
+        /* 81: XCVR_PLL_DIG->TUNING_CAP_TX_CTRL */
+        XCVR_FOLDED_TUNING_CAP_TX_CTRL,
+        /* 82: XCVR_RX_DIG->ACQ_FILT_0_3 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x03) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x00) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x78) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x77),
+#else
+        XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x03) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x01) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x76) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x03),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 83: XCVR_RX_DIG->ACQ_FILT_0_3_DRS */
+        XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H0(0x00) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H1(0x00) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H2(0x00) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H3(0x00),
+        /* 84: XCVR_RX_DIG->ACQ_FILT_10_11 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x066) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x0C9),
+#else
+        XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x3FA) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x140),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 85: XCVR_RX_DIG->ACQ_FILT_10_11_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x053) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x0E5),
+#else
+        XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x3B2) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x167),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 86: XCVR_RX_DIG->ACQ_FILT_4_7 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x06) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x1A) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_H6(0x11) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0xE7),
+#else
+        XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x15) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x6D) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_H6(0xE2) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0x36),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 87: XCVR_RX_DIG->ACQ_FILT_4_7_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x7C) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x05) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0x16) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0x05),
+#else
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x01) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x0A) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0xE8) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0x00),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 88: XCVR_RX_DIG->ACQ_FILT_8_9 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x1CA) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x1F5),
+#else
+        XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x01F) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x18F),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 89: XCVR_RX_DIG->ACQ_FILT_8_9_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x1D2) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x1D5),
+#else
+        XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x048) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x1AC),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 90: XCVR_RX_DIG->AGC_CTRL */
+        XCVR_FOLDED_AGC_CTRL,
+        /* 91: XCVR_RX_DIG->AGC_CTRL_STAT */
+        XCVR_FOLDED_AGC_CTRL_STAT,
+        /* 92: XCVR_RX_DIG->AGC_IDX0_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX0_GAIN_CFG,
+        /* 93: XCVR_RX_DIG->AGC_IDX0_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX0_GAIN_VAL,
+        /* 94: XCVR_RX_DIG->AGC_IDX0_THR */
+        XCVR_FOLDED_AGC_IDX0_THR,
+        /* 95: XCVR_RX_DIG->AGC_IDX10_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX10_GAIN_CFG,
+        /* 96: XCVR_RX_DIG->AGC_IDX10_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX10_GAIN_VAL,
+        /* 97: XCVR_RX_DIG->AGC_IDX10_THR */
+        XCVR_FOLDED_AGC_IDX10_THR,
+        /* 98: XCVR_RX_DIG->AGC_IDX11_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX11_GAIN_CFG | XCVR_RX_DIG_AGC_IDX11_GAIN_CFG_MAG_THR_11_DRS_OFS(0x00) |
+            XCVR_RX_DIG_AGC_IDX11_GAIN_CFG_MAG_THR_HI_11_DRS_OFS(0x00),
+        /* 99: XCVR_RX_DIG->AGC_IDX11_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX11_GAIN_VAL | XCVR_RX_DIG_AGC_IDX11_GAIN_VAL_MAG_THR_11(0x000) |
+            XCVR_RX_DIG_AGC_IDX11_GAIN_VAL_MAG_THR_HI_11(0x000),
+        /* 100: XCVR_RX_DIG->AGC_IDX11_THR */
+        XCVR_FOLDED_AGC_IDX11_THR,
+        /* 101: XCVR_RX_DIG->AGC_IDX1_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX1_GAIN_CFG,
+        /* 102: XCVR_RX_DIG->AGC_IDX1_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX1_GAIN_VAL,
+        /* 103: XCVR_RX_DIG->AGC_IDX1_THR */
+        XCVR_FOLDED_AGC_IDX1_THR,
+        /* 104: XCVR_RX_DIG->AGC_IDX2_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX2_GAIN_CFG,
+        /* 105: XCVR_RX_DIG->AGC_IDX2_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX2_GAIN_VAL,
+        /* 106: XCVR_RX_DIG->AGC_IDX2_THR */
+        XCVR_FOLDED_AGC_IDX2_THR,
+        /* 107: XCVR_RX_DIG->AGC_IDX3_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX3_GAIN_CFG,
+        /* 108: XCVR_RX_DIG->AGC_IDX3_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX3_GAIN_VAL,
+        /* 109: XCVR_RX_DIG->AGC_IDX3_THR */
+        XCVR_FOLDED_AGC_IDX3_THR,
+        /* 110: XCVR_RX_DIG->AGC_IDX4_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX4_GAIN_CFG,
+        /* 111: XCVR_RX_DIG->AGC_IDX4_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX4_GAIN_VAL,
+        /* 112: XCVR_RX_DIG->AGC_IDX4_THR */
+        XCVR_FOLDED_AGC_IDX4_THR,
+        /* 113: XCVR_RX_DIG->AGC_IDX5_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX5_GAIN_CFG,
+        /* 114: XCVR_RX_DIG->AGC_IDX5_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX5_GAIN_VAL,
+        /* 115: XCVR_RX_DIG->AGC_IDX5_THR */
+        XCVR_FOLDED_AGC_IDX5_THR,
+        /* 116: XCVR_RX_DIG->AGC_IDX6_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX6_GAIN_CFG,
+        /* 117: XCVR_RX_DIG->AGC_IDX6_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX6_GAIN_VAL,
+        /* 118: XCVR_RX_DIG->AGC_IDX6_THR */
+        XCVR_FOLDED_AGC_IDX6_THR,
+        /* 119: XCVR_RX_DIG->AGC_IDX7_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX7_GAIN_CFG,
+        /* 120: XCVR_RX_DIG->AGC_IDX7_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX7_GAIN_VAL,
+        /* 121: XCVR_RX_DIG->AGC_IDX7_THR */
+        XCVR_FOLDED_AGC_IDX7_THR,
+        /* 122: XCVR_RX_DIG->AGC_IDX8_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX8_GAIN_CFG,
+        /* 123: XCVR_RX_DIG->AGC_IDX8_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX8_GAIN_VAL,
+        /* 124: XCVR_RX_DIG->AGC_IDX8_THR */
+        XCVR_FOLDED_AGC_IDX8_THR,
+        /* 125: XCVR_RX_DIG->AGC_IDX9_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX9_GAIN_CFG,
+        /* 126: XCVR_RX_DIG->AGC_IDX9_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX9_GAIN_VAL,
+        /* 127: XCVR_RX_DIG->AGC_IDX9_THR */
+        XCVR_FOLDED_AGC_IDX9_THR,
+        /* 128: XCVR_RX_DIG->AGC_MIS_GAIN_CFG */
+        XCVR_FOLDED_AGC_MIS_GAIN_CFG,
+        /* 129: XCVR_RX_DIG->AGC_THR_FAST */
+        XCVR_FOLDED_AGC_THR_FAST,
+        /* 130: XCVR_RX_DIG->AGC_THR_FAST_DRS */
+        XCVR_FOLDED_AGC_THR_FAST_DRS,
+        /* 131: XCVR_RX_DIG->AGC_THR_MIS */
+        XCVR_FOLDED_AGC_THR_MIS,
+        /* 132: XCVR_RX_DIG->AGC_TIMING0 */
+        XCVR_FOLDED_AGC_TIMING0 | XCVR_RX_DIG_AGC_TIMING0_AGC_GAIN_STEP_WAIT(0x10),
+        /* 133: XCVR_RX_DIG->AGC_TIMING0_DRS */
+        XCVR_FOLDED_AGC_TIMING0_DRS | XCVR_RX_DIG_AGC_TIMING0_DRS_AGC_GAIN_STEP_WAIT(0x10),
+        /* 134: XCVR_RX_DIG->AGC_TIMING1 */
+        XCVR_FOLDED_AGC_TIMING1 | XCVR_RX_DIG_AGC_TIMING1_AGC_FREEZE_TIMEOUT(0x0A) |
+            XCVR_RX_DIG_AGC_TIMING1_AGC_HOLD_TIMEOUT(0x08),
+        /* 135: XCVR_RX_DIG->AGC_TIMING1_DRS */
+        XCVR_RX_DIG_AGC_TIMING1_DRS_AGC_FREEZE_TIMEOUT(0x0A) | XCVR_RX_DIG_AGC_TIMING1_DRS_AGC_HOLD_TIMEOUT(0x08),
+        /* 136: XCVR_RX_DIG->AGC_TIMING2 */
+        XCVR_FOLDED_AGC_TIMING2 | XCVR_RX_DIG_AGC_TIMING2_AGC_UNFREEZE_FEAT_TIMEOUT(0x000) |
+            XCVR_RX_DIG_AGC_TIMING2_AGC_UNHOLD_FEAT_TIMEOUT(0x000),
+        /* 137: XCVR_RX_DIG->AGC_TIMING2_DRS */
+        XCVR_RX_DIG_AGC_TIMING2_DRS_AGC_UNFREEZE_FEAT_TIMEOUT(0x000) |
+            XCVR_RX_DIG_AGC_TIMING2_DRS_AGC_UNHOLD_FEAT_TIMEOUT(0x000),
+        /* 138: XCVR_RX_DIG->CTRL0 */
+#if RF_OSC_26MHZ == 1
+        XCVR_FOLDED_CTRL0 | XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(2) |
+            XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x03B) |
+            XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(1) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#else
+        XCVR_FOLDED_CTRL0 | XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(3) |
+            XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x030) |
+            XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(1) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 139: XCVR_RX_DIG->CTRL0_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(3) |
+            XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x027),
+#else
+        XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(4) |
+            XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x020),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 140: XCVR_RX_DIG->CTRL1 */
+        XCVR_FOLDED_CTRL1,
+        /* 141: XCVR_RX_DIG->DCOC_CTRL0 */
+        XCVR_FOLDED_DCOC_CTRL0 | XCVR_RX_DIG_DCOC_CTRL0_DCOC_DAC_ORDER(1) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFII(0x6) |
+            XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFIIP(1) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFQQ(0x5) |
+            XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFQQP(1),
+        /* 142: XCVR_RX_DIG->DCOC_CTRL0_DRS */
+        XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFII(6) | XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFIIP(1) |
+            XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFQQ(5) | XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFQQP(1),
+        /* 143: XCVR_RX_DIG->DCOC_CTRL1 */
+        XCVR_FOLDED_DCOC_CTRL1,
+        /* 144: XCVR_RX_DIG->DEMOD_FILT_0_1 */
+        XCVR_RX_DIG_DEMOD_FILT_0_1_H0(0x002) | XCVR_RX_DIG_DEMOD_FILT_0_1_H1(0x1F6),
+        /* 145: XCVR_RX_DIG->DEMOD_FILT_0_1_DRS */
+        XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H0(0x001) | XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H1(0x1F5),
+        /* 146: XCVR_RX_DIG->DEMOD_FILT_2_4 */
+        XCVR_RX_DIG_DEMOD_FILT_2_4_H2(0x3F3) | XCVR_RX_DIG_DEMOD_FILT_2_4_H3(0x08A) |
+            XCVR_RX_DIG_DEMOD_FILT_2_4_H4(0x116),
+        /* 147: XCVR_RX_DIG->DEMOD_FILT_2_4_DRS */
+        XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H2(0x3F6) | XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H3(0x08B) |
+            XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H4(0x110),
+        /* 148: XCVR_RX_DIG->NB_RSSI_CTRL0 */
+        XCVR_FOLDED_NB_RSSI_CTRL0,
+        /* 149: XCVR_RX_DIG->NB_RSSI_CTRL1 */
+        XCVR_FOLDED_NB_RSSI_CTRL1,
+        /* 150: XCVR_RX_DIG->RCCAL_CTRL0 */
+        XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE(2) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE_DRS(3) |
+            XCVR_RX_DIG_RCCAL_CTRL0_CBPF_CCODE_OFFSET(0x00) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE(0) |
+            XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE_DRS(1) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CMPOUT_INV(0) |
+            XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CODE_OFFSET(0x0) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_SMPL_DLY(0),
+        /* 151: XCVR_RX_DIG->RSSI_GLOBAL_CTRL */
+        XCVR_FOLDED_RSSI_GLOBAL_CTRL | XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_CCA1_ED_EN(0),
+        /* 152: XCVR_RX_DIG->WB_RSSI_CTRL */
+        XCVR_FOLDED_WB_RSSI_CTRL,
+        /* 153: XCVR_TSM->CTRL */
+        XCVR_FOLDED_CTRL,
+        /* 154: XCVR_TSM->END_OF_SEQ */
+        XCVR_FOLDED_END_OF_SEQ,
+        /* 155: XCVR_TSM->FAST_CTRL1 */
+        XCVR_FOLDED_FAST_CTRL1,
+        /* 156: XCVR_TSM->FAST_CTRL2 */
+        XCVR_FOLDED_FAST_CTRL2,
+        /* 157: XCVR_TSM->FAST_CTRL3 */
+        XCVR_FOLDED_FAST_CTRL3,
+        /* 158: XCVR_TSM->RECYCLE_COUNT */
+        XCVR_FOLDED_RECYCLE_COUNT,
+        /* 159: XCVR_TSM->TIMING00 */
+        XCVR_FOLDED_TIMING00,
+        /* 160: XCVR_TSM->TIMING01 */
+        XCVR_FOLDED_TIMING01,
+        /* 161: XCVR_TSM->TIMING02 */
+        XCVR_FOLDED_TIMING02,
+        /* 162: XCVR_TSM->TIMING03 */
+        XCVR_FOLDED_TIMING03,
+        /* 163: XCVR_TSM->TIMING04 */
+        XCVR_FOLDED_TIMING04,
+        /* 164: XCVR_TSM->TIMING05 */
+        XCVR_FOLDED_TIMING05,
+        /* 165: XCVR_TSM->TIMING06 */
+        XCVR_FOLDED_TIMING06,
+        /* 166: XCVR_TSM->TIMING07 */
+        XCVR_FOLDED_TIMING07,
+        /* 167: XCVR_TSM->TIMING08 */
+        XCVR_FOLDED_TIMING08,
+        /* 168: XCVR_TSM->TIMING09 */
+        XCVR_FOLDED_TIMING09,
+        /* 169: XCVR_TSM->TIMING10 */
+        XCVR_FOLDED_TIMING10,
+        /* 170: XCVR_TSM->TIMING11 */
+        XCVR_FOLDED_TIMING11,
+        /* 171: XCVR_TSM->TIMING12 */
+        XCVR_FOLDED_TIMING12,
+        /* 172: XCVR_TSM->TIMING13 */
+        XCVR_FOLDED_TIMING13,
+        /* 173: XCVR_TSM->TIMING14 */
+        XCVR_FOLDED_TIMING14,
+        /* 174: XCVR_TSM->TIMING15 */
+        XCVR_FOLDED_TIMING15,
+        /* 175: XCVR_TSM->TIMING16 */
+        XCVR_FOLDED_TIMING16,
+        /* 176: XCVR_TSM->TIMING17 */
+        XCVR_FOLDED_TIMING17,
+        /* 177: XCVR_TSM->TIMING18 */
+        XCVR_FOLDED_TIMING18,
+        /* 178: XCVR_TSM->TIMING19 */
+        XCVR_FOLDED_TIMING19,
+        /* 179: XCVR_TSM->TIMING20 */
+        XCVR_FOLDED_TIMING20,
+        /* 180: XCVR_TSM->TIMING21 */
+        XCVR_FOLDED_TIMING21,
+        /* 181: XCVR_TSM->TIMING22 */
+        XCVR_FOLDED_TIMING22,
+        /* 182: XCVR_TSM->TIMING23 */
+        XCVR_FOLDED_TIMING23,
+        /* 183: XCVR_TSM->TIMING24 */
+        XCVR_FOLDED_TIMING24,
+        /* 184: XCVR_TSM->TIMING25 */
+        XCVR_FOLDED_TIMING25,
+        /* 185: XCVR_TSM->TIMING26 */
+        XCVR_FOLDED_TIMING26,
+        /* 186: XCVR_TSM->TIMING27 */
+        XCVR_FOLDED_TIMING27,
+        /* 187: XCVR_TSM->TIMING28 */
+        XCVR_FOLDED_TIMING28,
+        /* 188: XCVR_TSM->TIMING29 */
+        XCVR_FOLDED_TIMING29,
+        /* 189: XCVR_TSM->TIMING30 */
+        XCVR_FOLDED_TIMING30,
+        /* 190: XCVR_TSM->TIMING31 */
+        XCVR_FOLDED_TIMING31,
+        /* 191: XCVR_TSM->TIMING32 */
+        XCVR_FOLDED_TIMING32,
+        /* 192: XCVR_TSM->TIMING33 */
+        XCVR_FOLDED_TIMING33,
+        /* 193: XCVR_TSM->TIMING34 */
+        XCVR_FOLDED_TIMING34,
+        /* 194: XCVR_TSM->TIMING35 */
+        XCVR_FOLDED_TIMING35,
+        /* 195: XCVR_TSM->TIMING36 */
+        XCVR_FOLDED_TIMING36,
+        /* 196: XCVR_TSM->TIMING37 */
+        XCVR_FOLDED_TIMING37,
+        /* 197: XCVR_TSM->TIMING38 */
+        XCVR_FOLDED_TIMING38,
+        /* 198: XCVR_TSM->TIMING39 */
+        XCVR_FOLDED_TIMING39,
+        /* 199: XCVR_TSM->TIMING40 */
+        XCVR_FOLDED_TIMING40,
+        /* 200: XCVR_TSM->TIMING41 */
+        XCVR_FOLDED_TIMING41,
+        /* 201: XCVR_TSM->TIMING42 */
+        XCVR_FOLDED_TIMING42,
+        /* 202: XCVR_TSM->TIMING43 */
+        XCVR_FOLDED_TIMING43,
+        /* 203: XCVR_TSM->TIMING44 */
+        XCVR_FOLDED_TIMING44,
+        /* 204: XCVR_TSM->TIMING45 */
+        XCVR_FOLDED_TIMING45,
+        /* 205: XCVR_TSM->TIMING46 */
+        XCVR_FOLDED_TIMING46,
+        /* 206: XCVR_TSM->TIMING47 */
+        XCVR_FOLDED_TIMING47,
+        /* 207: XCVR_TSM->TIMING48 */
+        XCVR_FOLDED_TIMING48,
+        /* 208: XCVR_TSM->TIMING49 */
+        XCVR_FOLDED_TIMING49,
+        /* 209: XCVR_TSM->TIMING50 */
+        XCVR_FOLDED_TIMING50,
+        /* 210: XCVR_TSM->TIMING51 */
+        XCVR_FOLDED_TIMING51,
+        /* 211: XCVR_TSM->TIMING52 */
+        XCVR_FOLDED_TIMING52,
+        /* 212: XCVR_TSM->WU_LATENCY */
+        XCVR_FOLDED_WU_LATENCY,
+        /* 213: XCVR_TX_DIG->DATARATE_CONFIG_FILTER_CTRL */
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(0),
+        /* 214: XCVR_TX_DIG->DATARATE_CONFIG_FSK_CTRL */
+        XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV0(0x0000) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV1(0x0000),
+        /* 215: XCVR_TX_DIG->DATARATE_CONFIG_GFSK_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x0279),
+#else
+        XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x0203),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 216: XCVR_TX_DIG->DATA_PADDING_CTRL */
+        XCVR_FOLDED_DATA_PADDING_CTRL | XCVR_TX_DIG_DATA_PADDING_CTRL_DATA_PADDING_SEL(0) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_PAD_DLY(0) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_PAD_DLY_EN(1),
+        /* 217: XCVR_TX_DIG->DATA_PADDING_CTRL_1 */
+        XCVR_FOLDED_DATA_PADDING_CTRL_1 | XCVR_TX_DIG_DATA_PADDING_CTRL_1_RAMP_UP_DLY(0x04) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_1_TX_DATA_FLUSH_DLY(0x04),
+        /* 218: XCVR_TX_DIG->DATA_PADDING_CTRL_2 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_MFDEV(0x1D8A) | XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_PFDEV(0x0276),
+#else
+        XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_MFDEV(0x1E00) | XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_PFDEV(0x0200),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 219: XCVR_TX_DIG->FSK_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_0(0x1D8A) | XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_1(0x0276),
+#else
+        XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_0(0x1E00) | XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_1(0x0200),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 220: XCVR_TX_DIG->GFSK_COEFF_0_1 */
+        XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_0(0x0000) | XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_1(0x0000),
+        /* 221: XCVR_TX_DIG->GFSK_COEFF_2_3 */
+        XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_2(0x0000) | XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_3(0x0000),
+        /* 222: XCVR_TX_DIG->GFSK_COEFF_4_5 */
+        XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_4(0x0000) | XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_5(0x0000),
+        /* 223: XCVR_TX_DIG->GFSK_COEFF_6_7 */
+        XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_6(0x0000) | XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_7(0x0000),
+        /* 224: XCVR_TX_DIG->GFSK_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(0) |
+            XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x4E9),
+#else
+        XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(0) |
+            XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x3FD),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 225: XCVR_TX_DIG->IMAGE_FILTER_CTRL */
+        XCVR_FOLDED_IMAGE_FILTER_CTRL | XCVR_TX_DIG_IMAGE_FILTER_CTRL_IMAGE_FILTER_OVRD_EN(0),
+        /* 226: XCVR_TX_DIG->PA_CTRL */
+        XCVR_FOLDED_PA_CTRL | XCVR_TX_DIG_PA_CTRL_PA_RAMP_SEL(1),
+        /* 227: XCVR_TX_DIG->PA_RAMP_TBL0 */
+        XCVR_FOLDED_PA_RAMP_TBL0,
+        /* 228: XCVR_TX_DIG->PA_RAMP_TBL1 */
+        XCVR_FOLDED_PA_RAMP_TBL1,
+        /* 229: XCVR_TX_DIG->PA_RAMP_TBL2 */
+        XCVR_FOLDED_PA_RAMP_TBL2,
+        /* 230: XCVR_TX_DIG->PA_RAMP_TBL3 */
+        XCVR_FOLDED_PA_RAMP_TBL3,
+        /* 231: XCVR_TX_DIG->SWITCH_TX_CTRL */
+        XCVR_FOLDED_SWITCH_TX_CTRL,
+        /* 232: XCVR_TX_DIG->TXDIG_CTRL */
+        XCVR_FOLDED_TXDIG_CTRL | XCVR_TX_DIG_TXDIG_CTRL_DATA_STREAM_SEL(0) | XCVR_TX_DIG_TXDIG_CTRL_MODULATOR_SEL(1) |
+            XCVR_TX_DIG_TXDIG_CTRL_PFC_EN(0),
+    },
+};
+
+const xcvr_folded_config_t xcvr_fsk_h_0p5_250kbps_folded_config = {
+    .config     = &xcvr_fsk_h_0p5_250kbps_full_config,
+    .reg_values = {
+        /* 0: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x14) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x10) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x0C) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x08) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+        /* 1: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x34) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x30),
+        /* 2: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x2C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x28) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x24),
+        /* 3: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x14) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x10) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x0C) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x08) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+        /* 4: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x34) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x38),
+        /* 5: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x3C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x04),
+        /* 6: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x0C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x08) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x04) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+        /* 7: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x08),
+        /* 8: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x04) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x3C),
+        /* 9: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x0C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x08) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x04) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+        /* 10: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x10),
+        /* 11: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x14) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x18) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x1C),
+        /* 12: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x34) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x38) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x3C) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+        /* 13: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x34) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x30),
+        /* 14: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x2C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x28) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x24),
+        /* 15: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x34) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x38) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x3C) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+        /* 16: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x34) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x38),
+        /* 17: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x3C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x04),
+        /* 18: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x2C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x30) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x34) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x38) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+        /* 19: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x08),
+        /* 20: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x04) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x3C),
+        /* 21: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x2C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x30) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x34) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x38) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+        /* 22: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x10),
+        /* 23: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x14) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x18) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x1C),
+        /* 24: GEN4PHY->DMD_CTRL0 */
+        XCVR_FOLDED_DMD_CTRL0,
+        /* 25: GEN4PHY->DMD_CTRL1 */
+        XCVR_FOLDED_DMD_CTRL1,
+        /* 26: GEN4PHY->FSK_CFG0 */
+        XCVR_FOLDED_FSK_CFG0 | GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_1M(0x11) |
+            GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_2M(0x11) |
+            GEN4PHY_FSK_CFG0_MSK2FSK_SEED(0) | GEN4PHY_FSK_CFG0_MSK_EN(0),
+        /* 27: GEN4PHY->FSK_CFG1 */
+        GEN4PHY_FSK_CFG1_OVERH(0x020) | GEN4PHY_FSK_CFG1_OVERH_INV(0x100) | GEN4PHY_FSK_CFG1_SYNCTSCALE(0xF),
+        /* 28: GEN4PHY->FSK_CFG2 */
+        XCVR_FOLDED_FSK_CFG2,
+        /* 29: GEN4PHY->FSK_FAD_CFG */
+        XCVR_FOLDED_FSK_FAD_CFG,
+        /* 30: GEN4PHY->FSK_FAD_CTRL */
+        XCVR_FOLDED_FSK_FAD_CTRL,
+        /* 31: GEN4PHY->FSK_PD_CFG0 */
+        GEN4PHY_FSK_PD_CFG0_PD_IIR_ALPHA(0xFF) | GEN4PHY_FSK_PD_CFG0_PREAMBLE_T_SCALE(0xC),
+        /* 32: GEN4PHY->FSK_PD_CFG1 */
+        GEN4PHY_FSK_PD_CFG1_PREAMBLE_PATTERN(0x55),
+        /* 33: GEN4PHY->FSK_PD_CFG2 */
+        GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_1M(0xB8) | GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_2M(0xEB),
+        /* 34: GEN4PHY->FSK_PD_PH[0] */
+        GEN4PHY_FSK_PD_PH_REF0(0x02) | GEN4PHY_FSK_PD_PH_REF1(0x03) | GEN4PHY_FSK_PD_PH_REF2(0x02) |
+            GEN4PHY_FSK_PD_PH_REF3(0x00),
+        /* 35: GEN4PHY->FSK_PD_PH[1] */
+        GEN4PHY_FSK_PD_PH_REF0(0x3E) | GEN4PHY_FSK_PD_PH_REF1(0x3D) | GEN4PHY_FSK_PD_PH_REF2(0x3E) |
+            GEN4PHY_FSK_PD_PH_REF3(0x00),
+        /* 36: GEN4PHY->FSK_PT */
+        XCVR_FOLDED_FSK_PT | GEN4PHY_FSK_PT_AGC_TIMEOUT(0x0048),
+        /* 37: GEN4PHY->LR_AA_CFG */
+        GEN4PHY_LR_AA_CFG_AA_COR_THRESH(0x00) | GEN4PHY_LR_AA_CFG_AA_HAM_THRESH(0x00) |
+            GEN4PHY_LR_AA_CFG_AA_LR_CORR_GAIN(0x00) | GEN4PHY_LR_AA_CFG_ACCESS_ADDR_HAM(0x00),
+        /* 38: GEN4PHY->LR_PD_CFG */
+        GEN4PHY_LR_PD_CFG_CORR_TH(0x00) | GEN4PHY_LR_PD_CFG_FREQ_TH(0x00) | GEN4PHY_LR_PD_CFG_NO_PEAKS(0),
+        /* 39: GEN4PHY->LR_PD_PH[0] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 40: GEN4PHY->LR_PD_PH[1] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 41: GEN4PHY->LR_PD_PH[2] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 42: GEN4PHY->LR_PD_PH[3] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 43: GEN4PHY->MISC */
+        XCVR_FOLDED_MISC,
+        /* 44: GEN4PHY->PREPHY_MISC */
+        XCVR_FOLDED_PREPHY_MISC,
+        /* 45: GEN4PHY->RTT_CTRL */
+        XCVR_FOLDED_RTT_CTRL,
+        /* 46: GEN4PHY->RTT_REF */
+        GEN4PHY_RTT_REF_FM_REF_010(0x48) | GEN4PHY_RTT_REF_FM_REF_110(0x63) | GEN4PHY_RTT_REF_FM_REF_111(0x80),
+        /* 47: GEN4PHY->SM_CFG */
+        XCVR_FOLDED_SM_CFG | GEN4PHY_SM_CFG_AA_TIMEOUT_UNCODED(0x0A0),
+        /* 48: RADIO_CTRL->LL_CTRL */
+        RADIO_CTRL_LL_CTRL_ACTIVE_LL(2),
+        /* 49: XCVR_ANALOG->LDO_0 */
+        XCVR_FOLDED_LDO_0,
+        /* 50: XCVR_ANALOG->LDO_1 */
+        XCVR_FOLDED_LDO_1,
+        /* 51: XCVR_ANALOG->PLL */
+        XCVR_FOLDED_PLL,
+        /* 52: XCVR_ANALOG->RX_0 */
+        XCVR_FOLDED_RX_0,
+        /* 53: XCVR_ANALOG->RX_1 */
+        XCVR_FOLDED_RX_1,
+        /* 54: XCVR_ANALOG->TX_DAC_PA */
+        XCVR_FOLDED_TX_DAC_PA | XCVR_ANALOG_TX_DAC_PA_DAC_TRIM_CFBK_DRS(1),
+        /* 55: XCVR_ANALOG->XO_DIST */
+        XCVR_FOLDED_XO_DIST,
+        /* 56: XCVR_MISC->IPS_FO_ADDR[0] */
+        XCVR_MISC_IPS_FO_ADDR_ADDR(0x370) | XCVR_MISC_IPS_FO_ADDR_ENTRY_RX(0) | XCVR_MISC_IPS_FO_ADDR_ENTRY_TX(0),
+        /* 57: XCVR_MISC->IPS_FO_ADDR[1] */
+        XCVR_MISC_IPS_FO_ADDR_ADDR(0x02C) | XCVR_MISC_IPS_FO_ADDR_ENTRY_RX(0) | XCVR_MISC_IPS_FO_ADDR_ENTRY_TX(0),
+        /* 58: XCVR_MISC->IPS_FO_DRS0_DATA[0] */
+        XCVR_MISC_IPS_FO_DRS0_DATA_DRS0_DATA(0x00000000),
+        /* 59: XCVR_MISC->IPS_FO_DRS0_DATA[1] */
+        XCVR_MISC_IPS_FO_DRS0_DATA_DRS0_DATA(0x00000000),
+        /* 60: XCVR_MISC->IPS_FO_DRS1_DATA[0] */
+        XCVR_MISC_IPS_FO_DRS1_DATA_DRS1_DATA(0x00000000),
+        /* 61: XCVR_MISC->IPS_FO_DRS1_DATA[1] */
+        XCVR_MISC_IPS_FO_DRS1_DATA_DRS1_DATA(0x00000000),
+        /* 62: XCVR_MISC->LDO_TRIM_0 */
+        XCVR_FOLDED_LDO_TRIM_0,
+        /* 63: XCVR_MISC->LDO_TRIM_1 */
+        XCVR_FOLDED_LDO_TRIM_1,
+        /* 64: XCVR_MISC->XCVR_CTRL */
+        XCVR_FOLDED_XCVR_CTRL | XCVR_MISC_XCVR_CTRL_DATA_RATE_DRS(3) | XCVR_MISC_XCVR_CTRL_DEMOD_SEL(1) |
+            XCVR_MISC_XCVR_CTRL_LL_CFG_CAPT_DIS(0),
+        /* 65: XCVR_PLL_DIG->CHAN_MAP */
+        XCVR_FOLDED_CHAN_MAP | XCVR_PLL_DIG_CHAN_MAP_BAND_SELECT(0),
+        /* 66: XCVR_PLL_DIG->CHAN_MAP_EXT */
+#if RF_OSC_26MHZ == 1
+        XCVR_FOLDED_CHAN_MAP_EXT | XCVR_PLL_DIG_CHAN_MAP_EXT_NUM_OFFSET(0x013B13B),
+#else
+        XCVR_FOLDED_CHAN_MAP_EXT | XCVR_PLL_DIG_CHAN_MAP_EXT_NUM_OFFSET(0x0100000),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 67: XCVR_PLL_DIG->DATA_RATE_OVRD_CTRL1 */
+        XCVR_FOLDED_DATA_RATE_OVRD_CTRL1,
+        /* 68: XCVR_PLL_DIG->DATA_RATE_OVRD_CTRL2 */
+#if RF_OSC_26MHZ == 1
+        XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL2_NUM_OFFSET_CFG1(0x013B13B),
+#else
+        XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL2_NUM_OFFSET_CFG1(0x0100000),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 69: XCVR_PLL_DIG->DELAY_MATCH */
+        XCVR_FOLDED_DELAY_MATCH | XCVR_PLL_DIG_DELAY_MATCH_HPM_INTEGER_DELAY(0x04) |
+            XCVR_PLL_DIG_DELAY_MATCH_LPM_SDM_DELAY(0x03),
+        /* 70: XCVR_PLL_DIG->HPMCAL_CTRL */
+        XCVR_FOLDED_HPMCAL_CTRL | XCVR_PLL_DIG_HPMCAL_CTRL_HPM_CAL_ARRAY_SIZE(0),
+        /* 71: XCVR_PLL_DIG->HPM_BUMP */
+        XCVR_FOLDED_HPM_BUMP | XCVR_PLL_DIG_HPM_BUMP_HPM_VCM_CAL(2) | XCVR_PLL_DIG_HPM_BUMP_HPM_VCM_TX(2),
+        /* 72: XCVR_PLL_DIG->HPM_CAL_TIMING */
+        XCVR_FOLDED_HPM_CAL_TIMING,
+        /* 73: XCVR_PLL_DIG->HPM_CTRL */
+        XCVR_FOLDED_HPM_CTRL,
+        /* 74: XCVR_PLL_DIG->HPM_SDM_RES */
+        XCVR_FOLDED_HPM_SDM_RES | XCVR_PLL_DIG_HPM_SDM_RES_HPM_COUNT_ADJUST(0x02),
+        /* 75: XCVR_PLL_DIG->LOCK_DETECT */
+        XCVR_FOLDED_LOCK_DETECT,
+        /* 76: XCVR_PLL_DIG->LPM_CTRL */
+        XCVR_FOLDED_LPM_CTRL,
+        /* 77: XCVR_PLL_DIG->LPM_SDM_CTRL1 */
+        XCVR_FOLDED_LPM_SDM_CTRL1,
+        /* 78: XCVR_PLL_DIG->MOD_CTRL */
+        XCVR_FOLDED_MOD_CTRL,
+        /* 79: XCVR_PLL_DIG->PLL_DATARATE_CTRL */
+        XCVR_FOLDED_PLL_DATARATE_CTRL,
+        /* 80: XCVR_PLL_DIG->TUNING_CAP_RX_CTRL */
+        XCVR_FOLDED_TUNING_CAP_RX_CTRL,
+        /* 81: XCVR_PLL_DIG->TUNING_CAP_TX_CTRL */
+        XCVR_FOLDED_TUNING_CAP_TX_CTRL,
+        /* 82: XCVR_RX_DIG->ACQ_FILT_0_3 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x03) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x00) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x78) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x77),
+#else
+        XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x03) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x01) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x76) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x03),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 83: XCVR_RX_DIG->ACQ_FILT_0_3_DRS */
+        XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H0(0x00) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H1(0x00) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H2(0x00) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H3(0x00),
+        /* 84: XCVR_RX_DIG->ACQ_FILT_10_11 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x066) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x0C9),
+#else
+        XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x3FA) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x140),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 85: XCVR_RX_DIG->ACQ_FILT_10_11_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x05B) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x0E8),
+#else
+        XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x3A8) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x164),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 86: XCVR_RX_DIG->ACQ_FILT_4_7 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x06) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x1A) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_H6(0x11) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0xE7),
+#else
+        XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x15) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x6D) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_H6(0xE2) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0x36),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 87: XCVR_RX_DIG->ACQ_FILT_4_7_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x7D) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x06) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0x12) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0xFD),
+#else
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x7D) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x0A) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0xF9) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0xEB),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 88: XCVR_RX_DIG->ACQ_FILT_8_9 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x1CA) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x1F5),
+#else
+        XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x01F) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x18F),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 89: XCVR_RX_DIG->ACQ_FILT_8_9_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x1CF) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x1DD),
+#else
+        XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x03E) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x1CC),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 90: XCVR_RX_DIG->AGC_CTRL */
+        XCVR_FOLDED_AGC_CTRL,
+        /* 91: XCVR_RX_DIG->AGC_CTRL_STAT */
+        XCVR_FOLDED_AGC_CTRL_STAT,
+        /* 92: XCVR_RX_DIG->AGC_IDX0_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX0_GAIN_CFG,
+        /* 93: XCVR_RX_DIG->AGC_IDX0_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX0_GAIN_VAL,
+        /* 94: XCVR_RX_DIG->AGC_IDX0_THR */
+        XCVR_FOLDED_AGC_IDX0_THR,
+        /* 95: XCVR_RX_DIG->AGC_IDX10_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX10_GAIN_CFG,
+        /* 96: XCVR_RX_DIG->AGC_IDX10_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX10_GAIN_VAL,
+        /* 97: XCVR_RX_DIG->AGC_IDX10_THR */
+        XCVR_FOLDED_AGC_IDX10_THR,
+        /* 98: XCVR_RX_DIG->AGC_IDX11_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX11_GAIN_CFG | XCVR_RX_DIG_AGC_IDX11_GAIN_CFG_MAG_THR_11_DRS_OFS(0x00) |
+            XCVR_RX_DIG_AGC_IDX11_GAIN_CFG_MAG_THR_HI_11_DRS_OFS(0x00),
+        /* 99: XCVR_RX_DIG->AGC_IDX11_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX11_GAIN_VAL | XCVR_RX_DIG_AGC_IDX11_GAIN_VAL_MAG_THR_11(0x000) |
+            XCVR_RX_DIG_AGC_IDX11_GAIN_VAL_MAG_THR_HI_11(0x000),
+        /* 100: XCVR_RX_DIG->AGC_IDX11_THR */
+        XCVR_FOLDED_AGC_IDX11_THR,
+        /* 101: XCVR_RX_DIG->AGC_IDX1_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX1_GAIN_CFG,
+        /* 102: XCVR_RX_DIG->AGC_IDX1_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX1_GAIN_VAL,
+        /* 103: XCVR_RX_DIG->AGC_IDX1_THR */
+        XCVR_FOLDED_AGC_IDX1_THR,
+        /* 104: XCVR_RX_DIG->AGC_IDX2_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX2_GAIN_CFG,
+        /* 105: XCVR_RX_DIG->AGC_IDX2_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX2_GAIN_VAL,
+        /* 106: XCVR_RX_DIG->AGC_IDX2_THR */
+        XCVR_FOLDED_AGC_IDX2_THR,
+        /* 107: XCVR_RX_DIG->AGC_IDX3_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX3_GAIN_CFG,
+        /* 108: XCVR_RX_DIG->AGC_IDX3_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX3_GAIN_VAL,
+        /* 109: XCVR_RX_DIG->AGC_IDX3_THR */
+        XCVR_FOLDED_AGC_IDX3_THR,
+        /* 110: XCVR_RX_DIG->AGC_IDX4_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX4_GAIN_CFG,
+        /* 111: XCVR_RX_DIG->AGC_IDX4_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX4_GAIN_VAL,
+        /* 112: XCVR_RX_DIG->AGC_IDX4_THR */
+        XCVR_FOLDED_AGC_IDX4_THR,
+        /* 113: XCVR_RX_DIG->AGC_IDX5_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX5_GAIN_CFG,
+        /* 114: XCVR_RX_DIG->AGC_IDX5_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX5_GAIN_VAL,
+        /* 115: XCVR_RX_DIG->AGC_IDX5_THR */
+        XCVR_FOLDED_AGC_IDX5_THR,
+        /* 116: XCVR_RX_DIG->AGC_IDX6_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX6_GAIN_CFG,
+        /* 117: XCVR_RX_DIG->AGC_IDX6_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX6_GAIN_VAL,
+        /* 118: XCVR_RX_DIG->AGC_IDX6_THR */
+        XCVR_FOLDED_AGC_IDX6_THR,
+        /* 119: XCVR_RX_DIG->AGC_IDX7_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX7_GAIN_CFG,
+        /* 120: XCVR_RX_DIG->AGC_IDX7_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX7_GAIN_VAL,
+        /* 121: XCVR_RX_DIG->AGC_IDX7_THR */
+        XCVR_FOLDED_AGC_IDX7_THR,
+        /* 122: XCVR_RX_DIG->AGC_IDX8_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX8_GAIN_CFG,
+        /* 123: XCVR_RX_DIG->AGC_IDX8_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX8_GAIN_VAL,
+        /* 124: XCVR_RX_DIG->AGC_IDX8_THR */
+        XCVR_FOLDED_AGC_IDX8_THR,
+        /* 125: XCVR_RX_DIG->AGC_IDX9_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX9_GAIN_CFG,
+        /* 126: XCVR_RX_DIG->AGC_IDX9_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX9_GAIN_VAL,
+        /* 127: XCVR_RX_DIG->AGC_IDX9_THR */
+        XCVR_FOLDED_AGC_IDX9_THR,
+        /* 128: XCVR_RX_DIG->AGC_MIS_GAIN_CFG */
+        XCVR_FOLDED_AGC_MIS_GAIN_CFG,
+        /* 129: XCVR_RX_DIG->AGC_THR_FAST */
+        XCVR_FOLDED_AGC_THR_FAST,
+        /* 130: XCVR_RX_DIG->AGC_THR_FAST_DRS */
+        XCVR_FOLDED_AGC_THR_FAST_DRS,
+        /* 131: XCVR_RX_DIG->AGC_THR_MIS */
+        XCVR_FOLDED_AGC_THR_MIS,
+        /* 132: XCVR_RX_DIG->AGC_TIMING0 */
+        XCVR_FOLDED_AGC_TIMING0 | XCVR_RX_DIG_AGC_TIMING0_AGC_GAIN_STEP_WAIT(0x10),
+        /* 133: XCVR_RX_DIG->AGC_TIMING0_DRS */
+        XCVR_FOLDED_AGC_TIMING0_DRS | XCVR_RX_DIG_AGC_TIMING0_DRS_AGC_GAIN_STEP_WAIT(0x10),
+        /* 134: XCVR_RX_DIG->AGC_TIMING1 */
+        XCVR_FOLDED_AGC_TIMING1 | XCVR_RX_DIG_AGC_TIMING1_AGC_FREEZE_TIMEOUT(0x0A) |
+            XCVR_RX_DIG_AGC_TIMING1_AGC_HOLD_TIMEOUT(0x08),
+        /* 135: XCVR_RX_DIG->AGC_TIMING1_DRS */
+        XCVR_RX_DIG_AGC_TIMING1_DRS_AGC_FREEZE_TIMEOUT(0x0A) | XCVR_RX_DIG_AGC_TIMING1_DRS_AGC_HOLD_TIMEOUT(0x08),
+        /* 136: XCVR_RX_DIG->AGC_TIMING2 */
+        XCVR_FOLDED_AGC_TIMING2 | XCVR_RX_DIG_AGC_TIMING2_AGC_UNFREEZE_FEAT_TIMEOUT(0x000) |
+            XCVR_RX_DIG_AGC_TIMING2_AGC_UNHOLD_FEAT_TIMEOUT(0x000),
+        /* 137: XCVR_RX_DIG->AGC_TIMING2_DRS */
+        XCVR_RX_DIG_AGC_TIMING2_DRS_AGC_UNFREEZE_FEAT_TIMEOUT(0x000) |
+            XCVR_RX_DIG_AGC_TIMING2_DRS_AGC_UNHOLD_FEAT_TIMEOUT(0x000),
+        /* 138: XCVR_RX_DIG->CTRL0 */
+#if RF_OSC_26MHZ == 1
+        XCVR_FOLDED_CTRL0 | XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(2) |
+            XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x03B) |
+            XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(1) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#else
+        XCVR_FOLDED_CTRL0 | XCVR_RX_DIG_CTRL0_CIC_ORDER(1) | XCVR_RX_DIG_CTRL0_CIC_RATE(3) |
+            XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x030) |
+            XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(1) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 139: XCVR_RX_DIG->CTRL0_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(4) |
+            XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x027),
+#else
+        XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(1) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(5) |
+            XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x020),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 140: XCVR_RX_DIG->CTRL1 */
+        XCVR_FOLDED_CTRL1,
+        /* 141: XCVR_RX_DIG->DCOC_CTRL0 */
+        XCVR_FOLDED_DCOC_CTRL0 | XCVR_RX_DIG_DCOC_CTRL0_DCOC_DAC_ORDER(1) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFII(0x6) |
+            XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFIIP(1) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFQQ(0x5) |
+            XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFQQP(1),
+        /* 142: XCVR_RX_DIG->DCOC_CTRL0_DRS */
+        XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFII(6) | XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFIIP(1) |
+            XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFQQ(5) | XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFQQP(1),
+        /* 143: XCVR_RX_DIG->DCOC_CTRL1 */
+        XCVR_FOLDED_DCOC_CTRL1,
+        /* 144: XCVR_RX_DIG->DEMOD_FILT_0_1 */
+        XCVR_RX_DIG_DEMOD_FILT_0_1_H0(0x002) | XCVR_RX_DIG_DEMOD_FILT_0_1_H1(0x1F6),
+        /* 145: XCVR_RX_DIG->DEMOD_FILT_0_1_DRS */
+        XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H0(0x002) | XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H1(0x1F5),
+        /* 146: XCVR_RX_DIG->DEMOD_FILT_2_4 */
+        XCVR_RX_DIG_DEMOD_FILT_2_4_H2(0x3F3) | XCVR_RX_DIG_DEMOD_FILT_2_4_H3(0x08A) |
+            XCVR_RX_DIG_DEMOD_FILT_2_4_H4(0x116),
+        /* 147: XCVR_RX_DIG->DEMOD_FILT_2_4_DRS */
+        XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H2(0x3F5) | XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H3(0x08B) |
+            XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H4(0x112),
+        /* 148: XCVR_RX_DIG->NB_RSSI_CTRL0 */
+        XCVR_FOLDED_NB_RSSI_CTRL0,
+        /* 149: XCVR_RX_DIG->NB_RSSI_CTRL1 */
+        XCVR_FOLDED_NB_RSSI_CTRL1,
+        /* 150: XCVR_RX_DIG->RCCAL_CTRL0 */
+        XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE(2) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE_DRS(4) |
+            XCVR_RX_DIG_RCCAL_CTRL0_CBPF_CCODE_OFFSET(0x00) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE(0) |
+            XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE_DRS(1) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CMPOUT_INV(0) |
+            XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CODE_OFFSET(0x0) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_SMPL_DLY(0),
+        /* 151: XCVR_RX_DIG->RSSI_GLOBAL_CTRL */
+        XCVR_FOLDED_RSSI_GLOBAL_CTRL | XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_CCA1_ED_EN(0),
+        /* 152: XCVR_RX_DIG->WB_RSSI_CTRL */
+        XCVR_FOLDED_WB_RSSI_CTRL,
+        /* 153: XCVR_TSM->CTRL */
+        XCVR_FOLDED_CTRL,
+        /* 154: XCVR_TSM->END_OF_SEQ */
+        XCVR_FOLDED_END_OF_SEQ,
+        /* 155: XCVR_TSM->FAST_CTRL1 */
+        XCVR_FOLDED_FAST_CTRL1,
+        /* 156: XCVR_TSM->FAST_CTRL2 */
+        XCVR_FOLDED_FAST_CTRL2,
+        /* 157: XCVR_TSM->FAST_CTRL3 */
+        XCVR_FOLDED_FAST_CTRL3,
+        /* 158: XCVR_TSM->RECYCLE_COUNT */
+        XCVR_FOLDED_RECYCLE_COUNT,
+        /* 159: XCVR_TSM->TIMING00 */
+        XCVR_FOLDED_TIMING00,
+        /* 160: XCVR_TSM->TIMING01 */
+        XCVR_FOLDED_TIMING01,
+        /* 161: XCVR_TSM->TIMING02 */
+        XCVR_FOLDED_TIMING02,
+        /* 162: XCVR_TSM->TIMING03 */
+        XCVR_FOLDED_TIMING03,
+        /* 163: XCVR_TSM->TIMING04 */
+        XCVR_FOLDED_TIMING04,
+        /* 164: XCVR_TSM->TIMING05 */
+        XCVR_FOLDED_TIMING05,
+        /* 165: XCVR_TSM->TIMING06 */
+        XCVR_FOLDED_TIMING06,
+        /* 166: XCVR_TSM->TIMING07 */
+        XCVR_FOLDED_TIMING07,
+        /* 167: XCVR_TSM->TIMING08 */
+        XCVR_FOLDED_TIMING08,
+        /* 168: XCVR_TSM->TIMING09 */
+        XCVR_FOLDED_TIMING09,
+        /* 169: XCVR_TSM->TIMING10 */
+        XCVR_FOLDED_TIMING10,
+        /* 170: XCVR_TSM->TIMING11 */
+        XCVR_FOLDED_TIMING11,
+        /* 171: XCVR_TSM->TIMING12 */
+        XCVR_FOLDED_TIMING12,
+        /* 172: XCVR_TSM->TIMING13 */
+        XCVR_FOLDED_TIMING13,
+        /* 173: XCVR_TSM->TIMING14 */
+        XCVR_FOLDED_TIMING14,
+        /* 174: XCVR_TSM->TIMING15 */
+        XCVR_FOLDED_TIMING15,
+        /* 175: XCVR_TSM->TIMING16 */
+        XCVR_FOLDED_TIMING16,
+        /* 176: XCVR_TSM->TIMING17 */
+        XCVR_FOLDED_TIMING17,
+        /* 177: XCVR_TSM->TIMING18 */
+        XCVR_FOLDED_TIMING18,
+        /* 178: XCVR_TSM->TIMING19 */
+        XCVR_FOLDED_TIMING19,
+        /* 179: XCVR_TSM->TIMING20 */
+        XCVR_FOLDED_TIMING20,
+        /* 180: XCVR_TSM->TIMING21 */
+        XCVR_FOLDED_TIMING21,
+        /* 181: XCVR_TSM->TIMING22 */
+        XCVR_FOLDED_TIMING22,
+        /* 182: XCVR_TSM->TIMING23 */
+        XCVR_FOLDED_TIMING23,
+        /* 183: XCVR_TSM->TIMING24 */
+        XCVR_FOLDED_TIMING24,
+        /* 184: XCVR_TSM->TIMING25 */
+        XCVR_FOLDED_TIMING25,
+        /* 185: XCVR_TSM->TIMING26 */
+        XCVR_FOLDED_TIMING26,
+        /* 186: XCVR_TSM->TIMING27 */
+        XCVR_FOLDED_TIMING27,
+        /* 187: XCVR_TSM->TIMING28 */
+        XCVR_FOLDED_TIMING28,
+        /* 188: XCVR_TSM->TIMING29 */
+        XCVR_FOLDED_TIMING29,
+        /* 189: XCVR_TSM->TIMING30 */
+        XCVR_FOLDED_TIMING30,
+        /* 190: XCVR_TSM->TIMING31 */
+        XCVR_FOLDED_TIMING31,
+        /* 191: XCVR_TSM->TIMING32 */
+        XCVR_FOLDED_TIMING32,
+        /* 192: XCVR_TSM->TIMING33 */
+        XCVR_FOLDED_TIMING33,
+        /* 193: XCVR_TSM->TIMING34 */
+        XCVR_FOLDED_TIMING34,
+        /* 194: XCVR_TSM->TIMING35 */
+        XCVR_FOLDED_TIMING35,
+        /* 195: XCVR_TSM->TIMING36 */
+        XCVR_FOLDED_TIMING36,
+        /* 196: XCVR_TSM->TIMING37 */
+        XCVR_FOLDED_TIMING37,
+        /* 197: XCVR_TSM->TIMING38 */
+        XCVR_FOLDED_TIMING38,
+        /* 198: XCVR_TSM->TIMING39 */
+        XCVR_FOLDED_TIMING39,
+        /* 199: XCVR_TSM->TIMING40 */
+        XCVR_FOLDED_TIMING40,
+        /* 200: XCVR_TSM->TIMING41 */
+        XCVR_FOLDED_TIMING41,
+        /* 201: XCVR_TSM->TIMING42 */
+        XCVR_FOLDED_TIMING42,
+        /* 202: XCVR_TSM->TIMING43 */
+        XCVR_FOLDED_TIMING43,
+        /* 203: XCVR_TSM->TIMING44 */
+        XCVR_FOLDED_TIMING44,
+        /* 204: XCVR_TSM->TIMING45 */
+        XCVR_FOLDED_TIMING45,
+        /* 205: XCVR_TSM->TIMING46 */
+        XCVR_FOLDED_TIMING46,
+        /* 206: XCVR_TSM->TIMING47 */
+        XCVR_FOLDED_TIMING47,
+        /* 207: XCVR_TSM->TIMING48 */
+        XCVR_FOLDED_TIMING48,
+        /* 208: XCVR_TSM->TIMING49 */
+        XCVR_FOLDED_TIMING49,
+        /* 209: XCVR_TSM->TIMING50 */
+        XCVR_FOLDED_TIMING50,
+        /* 210: XCVR_TSM->TIMING51 */
+        XCVR_FOLDED_TIMING51,
+        /* 211: XCVR_TSM->TIMING52 */
+        XCVR_FOLDED_TIMING52,
+        /* 212: XCVR_TSM->WU_LATENCY */
+        XCVR_FOLDED_WU_LATENCY,
+        /* 213: XCVR_TX_DIG->DATARATE_CONFIG_FILTER_CTRL */
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(0),
+        /* 214: XCVR_TX_DIG->DATARATE_CONFIG_FSK_CTRL */
+        XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV0(0x0000) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV1(0x0000),
+        /* 215: XCVR_TX_DIG->DATARATE_CONFIG_GFSK_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x013D),
+#else
+        XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x0101),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 216: XCVR_TX_DIG->DATA_PADDING_CTRL */
+        XCVR_FOLDED_DATA_PADDING_CTRL | XCVR_TX_DIG_DATA_PADDING_CTRL_DATA_PADDING_SEL(0) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_PAD_DLY(0) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_PAD_DLY_EN(1),
+        /* 217: XCVR_TX_DIG->DATA_PADDING_CTRL_1 */
+        XCVR_FOLDED_DATA_PADDING_CTRL_1 | XCVR_TX_DIG_DATA_PADDING_CTRL_1_RAMP_UP_DLY(0x04) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_1_TX_DATA_FLUSH_DLY(0x04),
+        /* 218: XCVR_TX_DIG->DATA_PADDING_CTRL_2 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_MFDEV(0x1EC5) | XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_PFDEV(0x013B),
+#else
+        XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_MFDEV(0x1F00) | XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_PFDEV(0x0100),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 219: XCVR_TX_DIG->FSK_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_0(0x1EC5) | XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_1(0x013B),
+#else
+        XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_0(0x1F00) | XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_1(0x0100),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 220: XCVR_TX_DIG->GFSK_COEFF_0_1 */
+        XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_0(0x0000) | XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_1(0x0000),
+        /* 221: XCVR_TX_DIG->GFSK_COEFF_2_3 */
+        XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_2(0x0000) | XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_3(0x0000),
+        /* 222: XCVR_TX_DIG->GFSK_COEFF_4_5 */
+        XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_4(0x0000) | XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_5(0x0000),
+        /* 223: XCVR_TX_DIG->GFSK_COEFF_6_7 */
+        XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_6(0x0000) | XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_7(0x0000),
+        /* 224: XCVR_TX_DIG->GFSK_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(0) |
+            XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x4E9),
+#else
+        XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(0) |
+            XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x3FD),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 225: XCVR_TX_DIG->IMAGE_FILTER_CTRL */
+        XCVR_FOLDED_IMAGE_FILTER_CTRL | XCVR_TX_DIG_IMAGE_FILTER_CTRL_IMAGE_FILTER_OVRD_EN(0),
+        /* 226: XCVR_TX_DIG->PA_CTRL */
+        XCVR_FOLDED_PA_CTRL | XCVR_TX_DIG_PA_CTRL_PA_RAMP_SEL(1),
+        /* 227: XCVR_TX_DIG->PA_RAMP_TBL0 */
+        XCVR_FOLDED_PA_RAMP_TBL0,
+        /* 228: XCVR_TX_DIG->PA_RAMP_TBL1 */
+        XCVR_FOLDED_PA_RAMP_TBL1,
+        /* 229: XCVR_TX_DIG->PA_RAMP_TBL2 */
+        XCVR_FOLDED_PA_RAMP_TBL2,
+        /* 230: XCVR_TX_DIG->PA_RAMP_TBL3 */
+        XCVR_FOLDED_PA_RAMP_TBL3,
+        /* 231: XCVR_TX_DIG->SWITCH_TX_CTRL */
+        XCVR_FOLDED_SWITCH_TX_CTRL,
+        /* 232: XCVR_TX_DIG->TXDIG_CTRL */
+        XCVR_FOLDED_TXDIG_CTRL | XCVR_TX_DIG_TXDIG_CTRL_DATA_STREAM_SEL(0) | XCVR_TX_DIG_TXDIG_CTRL_MODULATOR_SEL(1) |
+            XCVR_TX_DIG_TXDIG_CTRL_PFC_EN(0),
+    },
+};
+
+const xcvr_folded_config_t xcvr_gfsk_bt_0p3_h_0p5_1mbps_folded_config = {
+    .config     = &xcvr_gfsk_bt_0p3_h_0p5_1mbps_full_config,
+    .reg_values = {
+        /* 0: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x14) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x10) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x0C) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x08) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+        /* 1: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x34) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x30),
+        /* 2: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x2C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x28) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x24),
+        /* 3: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x14) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x10) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x0C) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x08) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+        /* 4: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x34) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x38),
+        /* 5: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x3C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x04),
+        /* 6: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x0C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x08) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x04) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+        /* 7: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x08),
+        /* 8: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x04) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x3C),
+        /* 9: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x0C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x08) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x04) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+        /* 10: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x10),
+        /* 11: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x14) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x18) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x1C),
+        /* 12: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x34) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x38) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x3C) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+        /* 13: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x34) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x30),
+        /* 14: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x2C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x28) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x24),
+        /* 15: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x34) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x38) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x3C) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+        /* 16: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x34) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x38),
+        /* 17: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x3C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x04),
+        /* 18: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x2C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x30) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x34) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x38) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+        /* 19: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x08),
+        /* 20: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x04) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x3C),
+        /* 21: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x2C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x30) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x34) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x38) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+        /* 22: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x10),
+        /* 23: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x14) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x18) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x1C),
+        /* 24: GEN4PHY->DMD_CTRL0 */
+        XCVR_FOLDED_DMD_CTRL0,
+        /* 25: GEN4PHY->DMD_CTRL1 */
+        XCVR_FOLDED_DMD_CTRL1,
+        /* 26: GEN4PHY->FSK_CFG0 */
+        XCVR_FOLDED_FSK_CFG0 | GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_1M(0x0F) |
+            GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_2M(0x11) |
+            GEN4PHY_FSK_CFG0_MSK2FSK_SEED(0) | GEN4PHY_FSK_CFG0_MSK_EN(0),
+        /* 27: GEN4PHY->FSK_CFG1 */
+        GEN4PHY_FSK_CFG1_OVERH(0x020) | GEN4PHY_FSK_CFG1_OVERH_INV(0x100) | GEN4PHY_FSK_CFG1_SYNCTSCALE(0xF),
+        /* 28: GEN4PHY->FSK_CFG2 */
+        XCVR_FOLDED_FSK_CFG2,
+        /* 29: GEN4PHY->FSK_FAD_CFG */
+        XCVR_FOLDED_FSK_FAD_CFG,
+        /* 30: GEN4PHY->FSK_FAD_CTRL */
+        XCVR_FOLDED_FSK_FAD_CTRL,
+        /* 31: GEN4PHY->FSK_PD_CFG0 */
+        GEN4PHY_FSK_PD_CFG0_PD_IIR_ALPHA(0xFF) | GEN4PHY_FSK_PD_CFG0_PREAMBLE_T_SCALE(0xC),
+        /* 32: GEN4PHY->FSK_PD_CFG1 */
+        GEN4PHY_FSK_PD_CFG1_PREAMBLE_PATTERN(0x55),
+        /* 33: GEN4PHY->FSK_PD_CFG2 */
+        GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_1M(0xF6) | GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_2M(0xF6),
+        /* 34: GEN4PHY->FSK_PD_PH[0] */
+        GEN4PHY_FSK_PD_PH_REF0(0x02) | GEN4PHY_FSK_PD_PH_REF1(0x03) | GEN4PHY_FSK_PD_PH_REF2(0x02) |
+            GEN4PHY_FSK_PD_PH_REF3(0x00),
+        /* 35: GEN4PHY->FSK_PD_PH[1] */
+        GEN4PHY_FSK_PD_PH_REF0(0x3E) | GEN4PHY_FSK_PD_PH_REF1(0x3D) | GEN4PHY_FSK_PD_PH_REF2(0x3E) |
+            GEN4PHY_FSK_PD_PH_REF3(0x00),
+        /* 36: GEN4PHY->FSK_PT */
+        XCVR_FOLDED_FSK_PT | GEN4PHY_FSK_PT_AGC_TIMEOUT(0x0048),
+        /* 37: GEN4PHY->LR_AA_CFG */
+        GEN4PHY_LR_AA_CFG_AA_COR_THRESH(0x00) | GEN4PHY_LR_AA_CFG_AA_HAM_THRESH(0x00) |
+            GEN4PHY_LR_AA_CFG_AA_LR_CORR_GAIN(0x00) | GEN4PHY_LR_AA_CFG_ACCESS_ADDR_HAM(0x00),
+        /* 38: GEN4PHY->LR_PD_CFG */
+        GEN4PHY_LR_PD_CFG_CORR_TH(0x00) | GEN4PHY_LR_PD_CFG_FREQ_TH(0x00) | GEN4PHY_LR_PD_CFG_NO_PEAKS(0),
+        /* 39: GEN4PHY->LR_PD_PH[0] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 40: GEN4PHY->LR_PD_PH[1] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 41: GEN4PHY->LR_PD_PH[2] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 42: GEN4PHY->LR_PD_PH[3] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 43: GEN4PHY->MISC */
+        XCVR_FOLDED_MISC,
+        /* 44: GEN4PHY->PREPHY_MISC */
+        XCVR_FOLDED_PREPHY_MISC,
+        /* 45: GEN4PHY->RTT_CTRL */
+        XCVR_FOLDED_RTT_CTRL,
+        /* 46: GEN4PHY->RTT_REF */
+        GEN4PHY_RTT_REF_FM_REF_010(0x48) | GEN4PHY_RTT_REF_FM_REF_110(0x63) | GEN4PHY_RTT_REF_FM_REF_111(0x80),
+        /* 47: GEN4PHY->SM_CFG */
+        XCVR_FOLDED_SM_CFG | GEN4PHY_SM_CFG_AA_TIMEOUT_UNCODED(0x0A0),
+        /* 48: RADIO_CTRL->LL_CTRL */
+        RADIO_CTRL_LL_CTRL_ACTIVE_LL(2),
+        /* 49: XCVR_ANALOG->LDO_0 */
+        XCVR_FOLDED_LDO_0,
+        /* 50: XCVR_ANALOG->LDO_1 */
+        XCVR_FOLDED_LDO_1,
+        /* 51: XCVR_ANALOG->PLL */
+        XCVR_FOLDED_PLL,
+        /* 52: XCVR_ANALOG->RX_0 */
+        XCVR_FOLDED_RX_0,
+        /* 53: XCVR_ANALOG->RX_1 */
+        XCVR_FOLDED_RX_1,
+        /* 54: XCVR_ANALOG->TX_DAC_PA */
+        XCVR_FOLDED_TX_DAC_PA | XCVR_ANALOG_TX_DAC_PA_DAC_TRIM_CFBK_DRS(0),
+        /* 55: XCVR_ANALOG->XO_DIST */
+        XCVR_FOLDED_XO_DIST,
+        /* 56: XCVR_MISC->IPS_FO_ADDR[0] */
+        XCVR_MISC_IPS_FO_ADDR_ADDR(0x370) | XCVR_MISC_IPS_FO_ADDR_ENTRY_RX(0) | XCVR_MISC_IPS_FO_ADDR_ENTRY_TX(0),
+        /* 57: XCVR_MISC->IPS_FO_ADDR[1] */
+        XCVR_MISC_IPS_FO_ADDR_ADDR(0x02C) | XCVR_MISC_IPS_FO_ADDR_ENTRY_RX(0) | XCVR_MISC_IPS_FO_ADDR_ENTRY_TX(0),
+        /* 58: XCVR_MISC->IPS_FO_DRS0_DATA[0] */
+        XCVR_MISC_IPS_FO_DRS0_DATA_DRS0_DATA(0x00000000),
+        /* 59: XCVR_MISC->IPS_FO_DRS0_DATA[1] */
+        XCVR_MISC_IPS_FO_DRS0_DATA_DRS0_DATA(0x00000000),
+        /* 60: XCVR_MISC->IPS_FO_DRS1_DATA[0] */
+        XCVR_MISC_IPS_FO_DRS1_DATA_DRS1_DATA(0x00000000),
+        /* 61: XCVR_MISC->IPS_FO_DRS1_DATA[1] */
+        XCVR_MISC_IPS_FO_DRS1_DATA_DRS1_DATA(0x00000000),
+        /* 62: XCVR_MISC->LDO_TRIM_0 */
+        XCVR_FOLDED_LDO_TRIM_0,
+        /* 63: XCVR_MISC->LDO_TRIM_1 */
+        XCVR_FOLDED_LDO_TRIM_1,
+        /* 64: XCVR_MISC->XCVR_CTRL */
+        XCVR_FOLDED_XCVR_CTRL | XCVR_MISC_XCVR_CTRL_DATA_RATE_DRS(0) | XCVR_MISC_XCVR_CTRL_DEMOD_SEL(1) |
+            XCVR_MISC_XCVR_CTRL_LL_CFG_CAPT_DIS(0),
+        /* 65: XCVR_PLL_DIG->CHAN_MAP */
+        XCVR_FOLDED_CHAN_MAP | XCVR_PLL_DIG_CHAN_MAP_BAND_SELECT(0),
+        /* 66: XCVR_PLL_DIG->CHAN_MAP_EXT */
+#if RF_OSC_26MHZ == 1
+        XCVR_FOLDED_CHAN_MAP_EXT | XCVR_PLL_DIG_CHAN_MAP_EXT_NUM_OFFSET(0x013B13B),
+#else
+        XCVR_FOLDED_CHAN_MAP_EXT | XCVR_PLL_DIG_CHAN_MAP_EXT_NUM_OFFSET(0x0100000),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 67: XCVR_PLL_DIG->DATA_RATE_OVRD_CTRL1 */
+        XCVR_FOLDED_DATA_RATE_OVRD_CTRL1,
+        /* 68: XCVR_PLL_DIG->DATA_RATE_OVRD_CTRL2 */
+#if RF_OSC_26MHZ == 1
+        XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL2_NUM_OFFSET_CFG1(0x01D89D9),
+#else
+        XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL2_NUM_OFFSET_CFG1(0x0180000),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 69: XCVR_PLL_DIG->DELAY_MATCH */
+        XCVR_FOLDED_DELAY_MATCH | XCVR_PLL_DIG_DELAY_MATCH_HPM_INTEGER_DELAY(0x04) |
+            XCVR_PLL_DIG_DELAY_MATCH_LPM_SDM_DELAY(0x03),
+        /* 70: XCVR_PLL_DIG->HPMCAL_CTRL */
+        XCVR_FOLDED_HPMCAL_CTRL | XCVR_PLL_DIG_HPMCAL_CTRL_HPM_CAL_ARRAY_SIZE(0),
+        /* 71: XCVR_PLL_DIG->HPM_BUMP */
+        XCVR_FOLDED_HPM_BUMP | XCVR_PLL_DIG_HPM_BUMP_HPM_VCM_CAL(2) | XCVR_PLL_DIG_HPM_BUMP_HPM_VCM_TX(2),
+        /* 72: XCVR_PLL_DIG->HPM_CAL_TIMING */
+        XCVR_FOLDED_HPM_CAL_TIMING,
+        /* 73: XCVR_PLL_DIG->HPM_CTRL */
+        XCVR_FOLDED_HPM_CTRL,
+        /* 74: XCVR_PLL_DIG->HPM_SDM_RES */
+        XCVR_FOLDED_HPM_SDM_RES | XCVR_PLL_DIG_HPM_SDM_RES_HPM_COUNT_ADJUST(0x02),
+        /* 75: XCVR_PLL_DIG->LOCK_DETECT */
+        XCVR_FOLDED_LOCK_DETECT,
+        /* 76: XCVR_PLL_DIG->LPM_CTRL */
+        XCVR_FOLDED_LPM_CTRL,
+        /* 77: XCVR_PLL_DIG->LPM_SDM_CTRL1 */
+        XCVR_FOLDED_LPM_SDM_CTRL1,
+        /* 78: XCVR_PLL_DIG->MOD_CTRL */
+        XCVR_FOLDED_MOD_CTRL,
+        /* 79: XCVR_PLL_DIG->PLL_DATARATE_CTRL */
+        XCVR_FOLDED_PLL_DATARATE_CTRL,
+        /* 80: XCVR_PLL_DIG->TUNING_CAP_RX_CTRL */
+        XCVR_FOLDED_TUNING_CAP_RX_CTRL,
+        /* 81: XCVR_PLL_DIG->TUNING_CAP_TX_CTRL */
+        XCVR_FOLDED_TUNING_CAP_TX_CTRL,
+        /* 82: XCVR_RX_DIG->ACQ_FILT_0_3 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x01) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x05) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x08) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x07),
+#else
+        XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x02) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x00) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x79) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x79),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 83: XCVR_RX_DIG->ACQ_FILT_0_3_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H0(0x04) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H1(0x06) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H2(0x05) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H3(0x7E),
+#else
+        XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H0(0x3E) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H1(0x3B) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H2(0x7C) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H3(0x07),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 84: XCVR_RX_DIG->ACQ_FILT_10_11 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x068) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x088),
+#else
+        XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x06B) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x0D1),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 85: XCVR_RX_DIG->ACQ_FILT_10_11_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x068) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x082),
+#else
+        XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x074) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x0C2),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 86: XCVR_RX_DIG->ACQ_FILT_4_7 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x7E) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x6F) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_H6(0xE5) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0xEA),
+#else
+        XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x07) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x18) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_H6(0x0E) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0xE3),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 87: XCVR_RX_DIG->ACQ_FILT_4_7_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x73) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x68) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0xE5) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0xF3),
+#else
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x13) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x10) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0xF4) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0xD2),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 88: XCVR_RX_DIG->ACQ_FILT_8_9 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x006) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x036),
+#else
+        XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x1C8) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x1F7),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 89: XCVR_RX_DIG->ACQ_FILT_8_9_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x013) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x03E),
+#else
+        XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x1D3) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x010),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 90: XCVR_RX_DIG->AGC_CTRL */
+        XCVR_FOLDED_AGC_CTRL,
+        /* 91: XCVR_RX_DIG->AGC_CTRL_STAT */
+        XCVR_FOLDED_AGC_CTRL_STAT,
+        /* 92: XCVR_RX_DIG->AGC_IDX0_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX0_GAIN_CFG,
+        /* 93: XCVR_RX_DIG->AGC_IDX0_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX0_GAIN_VAL,
+        /* 94: XCVR_RX_DIG->AGC_IDX0_THR */
+        XCVR_FOLDED_AGC_IDX0_THR,
+        /* 95: XCVR_RX_DIG->AGC_IDX10_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX10_GAIN_CFG,
+        /* 96: XCVR_RX_DIG->AGC_IDX10_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX10_GAIN_VAL,
+        /* 97: XCVR_RX_DIG->AGC_IDX10_THR */
+        XCVR_FOLDED_AGC_IDX10_THR,
+        /* 98: XCVR_RX_DIG->AGC_IDX11_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX11_GAIN_CFG | XCVR_RX_DIG_AGC_IDX11_GAIN_CFG_MAG_THR_11_DRS_OFS(0x00) |
+            XCVR_RX_DIG_AGC_IDX11_GAIN_CFG_MAG_THR_HI_11_DRS_OFS(0x00),
+        /* 99: XCVR_RX_DIG->AGC_IDX11_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX11_GAIN_VAL | XCVR_RX_DIG_AGC_IDX11_GAIN_VAL_MAG_THR_11(0x000) |
+            XCVR_RX_DIG_AGC_IDX11_GAIN_VAL_MAG_THR_HI_11(0x000),
+        /* 100: XCVR_RX_DIG->AGC_IDX11_THR */
+        XCVR_FOLDED_AGC_IDX11_THR,
+        /* 101: XCVR_RX_DIG->AGC_IDX1_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX1_GAIN_CFG,
+        /* 102: XCVR_RX_DIG->AGC_IDX1_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX1_GAIN_VAL,
+        /* 103: XCVR_RX_DIG->AGC_IDX1_THR */
+        XCVR_FOLDED_AGC_IDX1_THR,
+        /* 104: XCVR_RX_DIG->AGC_IDX2_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX2_GAIN_CFG,
+        /* 105: XCVR_RX_DIG->AGC_IDX2_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX2_GAIN_VAL,
+        /* 106: XCVR_RX_DIG->AGC_IDX2_THR */
+        XCVR_FOLDED_AGC_IDX2_THR,
+        /* 107: XCVR_RX_DIG->AGC_IDX3_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX3_GAIN_CFG,
+        /* 108: XCVR_RX_DIG->AGC_IDX3_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX3_GAIN_VAL,
+        /* 109: XCVR_RX_DIG->AGC_IDX3_THR */
+        XCVR_FOLDED_AGC_IDX3_THR,
+        /* 110: XCVR_RX_DIG->AGC_IDX4_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX4_GAIN_CFG,
+        /* 111: XCVR_RX_DIG->AGC_IDX4_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX4_GAIN_VAL,
+        /* 112: XCVR_RX_DIG->AGC_IDX4_THR */
+        XCVR_FOLDED_AGC_IDX4_THR,
+        /* 113: XCVR_RX_DIG->AGC_IDX5_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX5_GAIN_CFG,
+        /* 114: XCVR_RX_DIG->AGC_IDX5_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX5_GAIN_VAL,
+        /* 115: XCVR_RX_DIG->AGC_IDX5_THR */
+        XCVR_FOLDED_AGC_IDX5_THR,
+        /* 116: XCVR_RX_DIG->AGC_IDX6_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX6_GAIN_CFG,
+        /* 117: XCVR_RX_DIG->AGC_IDX6_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX6_GAIN_VAL,
+        /* 118: XCVR_RX_DIG->AGC_IDX6_THR */
+        XCVR_FOLDED_AGC_IDX6_THR,
+        /* 119: XCVR_RX_DIG->AGC_IDX7_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX7_GAIN_CFG,
+        /* 120: XCVR_RX_DIG->AGC_IDX7_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX7_GAIN_VAL,
+        /* 121: XCVR_RX_DIG->AGC_IDX7_THR */
+        XCVR_FOLDED_AGC_IDX7_THR,
+        /* 122: XCVR_RX_DIG->AGC_IDX8_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX8_GAIN_CFG,
+        /* 123: XCVR_RX_DIG->AGC_IDX8_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX8_GAIN_VAL,
+        /* 124: XCVR_RX_DIG->AGC_IDX8_THR */
+        XCVR_FOLDED_AGC_IDX8_THR,
+        /* 125: XCVR_RX_DIG->AGC_IDX9_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX9_GAIN_CFG,
+        /* 126: XCVR_RX_DIG->AGC_IDX9_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX9_GAIN_VAL,
+        /* 127: XCVR_RX_DIG->AGC_IDX9_THR */
+        XCVR_FOLDED_AGC_IDX9_THR,
+        /* 128: XCVR_RX_DIG->AGC_MIS_GAIN_CFG */
+        XCVR_FOLDED_AGC_MIS_GAIN_CFG,
+        /* 129: XCVR_RX_DIG->AGC_THR_FAST */
+        XCVR_FOLDED_AGC_THR_FAST,
+        /* 130: XCVR_RX_DIG->AGC_THR_FAST_DRS */
+        XCVR_FOLDED_AGC_THR_FAST_DRS,
+        /* 131: XCVR_RX_DIG->AGC_THR_MIS */
+        XCVR_FOLDED_AGC_THR_MIS,
+        /* 132: XCVR_RX_DIG->AGC_TIMING0 */
+        XCVR_FOLDED_AGC_TIMING0 | XCVR_RX_DIG_AGC_TIMING0_AGC_GAIN_STEP_WAIT(0x10),
+        /* 133: XCVR_RX_DIG->AGC_TIMING0_DRS */
+        XCVR_FOLDED_AGC_TIMING0_DRS | XCVR_RX_DIG_AGC_TIMING0_DRS_AGC_GAIN_STEP_WAIT(0x10),
+        /* 134: XCVR_RX_DIG->AGC_TIMING1 */
+        XCVR_FOLDED_AGC_TIMING1 | XCVR_RX_DIG_AGC_TIMING1_AGC_FREEZE_TIMEOUT(0x0A) |
+            XCVR_RX_DIG_AGC_TIMING1_AGC_HOLD_TIMEOUT(0x08),
+        /* 135: XCVR_RX_DIG->AGC_TIMING1_DRS */
+        XCVR_RX_DIG_AGC_TIMING1_DRS_AGC_FREEZE_TIMEOUT(0x0A) | XCVR_RX_DIG_AGC_TIMING1_DRS_AGC_HOLD_TIMEOUT(0x08),
+        /* 136: XCVR_RX_DIG->AGC_TIMING2 */
+        XCVR_FOLDED_AGC_TIMING2 | XCVR_RX_DIG_AGC_TIMING2_AGC_UNFREEZE_FEAT_TIMEOUT(0x000) |
+            XCVR_RX_DIG_AGC_TIMING2_AGC_UNHOLD_FEAT_TIMEOUT(0x000),
+        /* 137: XCVR_RX_DIG->AGC_TIMING2_DRS */
+        XCVR_RX_DIG_AGC_TIMING2_DRS_AGC_UNFREEZE_FEAT_TIMEOUT(0x000) |
+            XCVR_RX_DIG_AGC_TIMING2_DRS_AGC_UNHOLD_FEAT_TIMEOUT(0x000),
+        /* 138: XCVR_RX_DIG->CTRL0 */
+#if RF_OSC_26MHZ == 1
+        XCVR_FOLDED_CTRL0 | XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(2) |
+            XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x027) |
+            XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(0) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#else
+        XCVR_FOLDED_CTRL0 | XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(3) |
+            XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x020) |
+            XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(0) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 139: XCVR_RX_DIG->CTRL0_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(1) |
+            XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x03B),
+#else
+        XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(2) |
+            XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x030),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 140: XCVR_RX_DIG->CTRL1 */
+        XCVR_FOLDED_CTRL1,
+        /* 141: XCVR_RX_DIG->DCOC_CTRL0 */
+        XCVR_FOLDED_DCOC_CTRL0 | XCVR_RX_DIG_DCOC_CTRL0_DCOC_DAC_ORDER(0) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFII(0x8) |
+            XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFIIP(1) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFQQ(0x2) |
+            XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFQQP(0),
+        /* 142: XCVR_RX_DIG->DCOC_CTRL0_DRS */
+        XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFII(4) | XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFIIP(1) |
+            XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFQQ(1) | XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFQQP(0),
+        /* 143: XCVR_RX_DIG->DCOC_CTRL1 */
+        XCVR_FOLDED_DCOC_CTRL1,
+        /* 144: XCVR_RX_DIG->DEMOD_FILT_0_1 */
+        XCVR_RX_DIG_DEMOD_FILT_0_1_H0(0x1FE) | XCVR_RX_DIG_DEMOD_FILT_0_1_H1(0x005),
+        /* 145: XCVR_RX_DIG->DEMOD_FILT_0_1_DRS */
+        XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H0(0x000) | XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H1(0x00B),
+        /* 146: XCVR_RX_DIG->DEMOD_FILT_2_4 */
+        XCVR_RX_DIG_DEMOD_FILT_2_4_H2(0x02E) | XCVR_RX_DIG_DEMOD_FILT_2_4_H3(0x07C) |
+            XCVR_RX_DIG_DEMOD_FILT_2_4_H4(0x0A6),
+        /* 147: XCVR_RX_DIG->DEMOD_FILT_2_4_DRS */
+        XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H2(0x035) | XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H3(0x075) |
+            XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H4(0x096),
+        /* 148: XCVR_RX_DIG->NB_RSSI_CTRL0 */
+        XCVR_FOLDED_NB_RSSI_CTRL0,
+        /* 149: XCVR_RX_DIG->NB_RSSI_CTRL1 */
+        XCVR_FOLDED_NB_RSSI_CTRL1,
+        /* 150: XCVR_RX_DIG->RCCAL_CTRL0 */
+        XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE(2) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE_DRS(1) |
+            XCVR_RX_DIG_RCCAL_CTRL0_CBPF_CCODE_OFFSET(0x00) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE(1) |
+            XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE_DRS(0) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CMPOUT_INV(0) |
+            XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CODE_OFFSET(0x0) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_SMPL_DLY(0),
+        /* 151: XCVR_RX_DIG->RSSI_GLOBAL_CTRL */
+        XCVR_FOLDED_RSSI_GLOBAL_CTRL | XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_CCA1_ED_EN(0),
+        /* 152: XCVR_RX_DIG->WB_RSSI_CTRL */
+        XCVR_FOLDED_WB_RSSI_CTRL,
+        /* 153: XCVR_TSM->CTRL */
+        XCVR_FOLDED_CTRL,
+        /* 154: XCVR_TSM->END_OF_SEQ */
+        XCVR_FOLDED_END_OF_SEQ,
+        /* 155: XCVR_TSM->FAST_CTRL1 */
+        XCVR_FOLDED_FAST_CTRL1,
+        /* 156: XCVR_TSM->FAST_CTRL2 */
+        XCVR_FOLDED_FAST_CTRL2,
+        /* 157: XCVR_TSM->FAST_CTRL3 */
+        XCVR_FOLDED_FAST_CTRL3,
+        /* 158: XCVR_TSM->RECYCLE_COUNT */
+        XCVR_FOLDED_RECYCLE_COUNT,
+        /* 159: XCVR_TSM->TIMING00 */
+        XCVR_FOLDED_TIMING00,
+        /* 160: XCVR_TSM->TIMING01 */
+        XCVR_FOLDED_TIMING01,
+        /* 161: XCVR_TSM->TIMING02 */
+        XCVR_FOLDED_TIMING02,
+        /* 162: XCVR_TSM->TIMING03 */
+        XCVR_FOLDED_TIMING03,
+        /* 163: XCVR_TSM->TIMING04 */
+        XCVR_FOLDED_TIMING04,
+        /* 164: XCVR_TSM->TIMING05 */
+        XCVR_FOLDED_TIMING05,
+        /* 165: XCVR_TSM->TIMING06 */
+        XCVR_FOLDED_TIMING06,
+        /* 166: XCVR_TSM->TIMING07 */
+        XCVR_FOLDED_TIMING07,
+        /* 167: XCVR_TSM->TIMING08 */
+        XCVR_FOLDED_TIMING08,
+        /* 168: XCVR_TSM->TIMING09 */
+        XCVR_FOLDED_TIMING09,
+        /* 169: XCVR_TSM->TIMING10 */
+        XCVR_FOLDED_TIMING10,
+        /* 170: XCVR_TSM->TIMING11 */
+        XCVR_FOLDED_TIMING11,
+        /* 171: XCVR_TSM->TIMING12 */
+        XCVR_FOLDED_TIMING12,
+        /* 172: XCVR_TSM->TIMING13 */
+        XCVR_FOLDED_TIMING13,
+        /* 173: XCVR_TSM->TIMING14 */
+        XCVR_FOLDED_TIMING14,
+        /* 174: XCVR_TSM->TIMING15 */
+        XCVR_FOLDED_TIMING15,
+        /* 175: XCVR_TSM->TIMING16 */
+        XCVR_FOLDED_TIMING16,
+        /* 176: XCVR_TSM->TIMING17 */
+        XCVR_FOLDED_TIMING17,
+        /* 177: XCVR_TSM->TIMING18 */
+        XCVR_FOLDED_TIMING18,
+        /* 178: XCVR_TSM->TIMING19 */
+        XCVR_FOLDED_TIMING19,
+        /* 179: XCVR_TSM->TIMING20 */
+        XCVR_FOLDED_TIMING20,
+        /* 180: XCVR_TSM->TIMING21 */
+        XCVR_FOLDED_TIMING21,
+        /* 181: XCVR_TSM->TIMING22 */
+        XCVR_FOLDED_TIMING22,
+        /* 182: XCVR_TSM->TIMING23 */
+        XCVR_FOLDED_TIMING23,
+        /* 183: XCVR_TSM->TIMING24 */
+        XCVR_FOLDED_TIMING24,
+        /* 184: XCVR_TSM->TIMING25 */
+        XCVR_FOLDED_TIMING25,
+        /* 185: XCVR_TSM->TIMING26 */
+        XCVR_FOLDED_TIMING26,
+        /* 186: XCVR_TSM->TIMING27 */
+        XCVR_FOLDED_TIMING27,
+        /* 187: XCVR_TSM->TIMING28 */
+        XCVR_FOLDED_TIMING28,
+        /* 188: XCVR_TSM->TIMING29 */
+        XCVR_FOLDED_TIMING29,
+        /* 189: XCVR_TSM->TIMING30 */
+        XCVR_FOLDED_TIMING30,
+        /* 190: XCVR_TSM->TIMING31 */
+        XCVR_FOLDED_TIMING31,
+        /* 191: XCVR_TSM->TIMING32 */
+        XCVR_FOLDED_TIMING32,
+        /* 192: XCVR_TSM->TIMING33 */
+        XCVR_FOLDED_TIMING33,
+        /* 193: XCVR_TSM->TIMING34 */
+        XCVR_FOLDED_TIMING34,
+        /* 194: XCVR_TSM->TIMING35 */
+        XCVR_FOLDED_TIMING35,
+        /* 195: XCVR_TSM->TIMING36 */
+        XCVR_FOLDED_TIMING36,
+        /* 196: XCVR_TSM->TIMING37 */
+        XCVR_FOLDED_TIMING37,
+        /* 197: XCVR_TSM->TIMING38 */
+        XCVR_FOLDED_TIMING38,
+        /* 198: XCVR_TSM->TIMING39 */
+        XCVR_FOLDED_TIMING39,
+        /* 199: XCVR_TSM->TIMING40 */
+        XCVR_FOLDED_TIMING40,
+        /* 200: XCVR_TSM->TIMING41 */
+        XCVR_FOLDED_TIMING41,
+        /* 201: XCVR_TSM->TIMING42 */
+        XCVR_FOLDED_TIMING42,
+        /* 202: XCVR_TSM->TIMING43 */
+        XCVR_FOLDED_TIMING43,
+        /* 203: XCVR_TSM->TIMING44 */
+        XCVR_FOLDED_TIMING44,
+        /* 204: XCVR_TSM->TIMING45 */
+        XCVR_FOLDED_TIMING45,
+        /* 205: XCVR_TSM->TIMING46 */
+        XCVR_FOLDED_TIMING46,
+        /* 206: XCVR_TSM->TIMING47 */
+        XCVR_FOLDED_TIMING47,
+        /* 207: XCVR_TSM->TIMING48 */
+        XCVR_FOLDED_TIMING48,
+        /* 208: XCVR_TSM->TIMING49 */
+        XCVR_FOLDED_TIMING49,
+        /* 209: XCVR_TSM->TIMING50 */
+        XCVR_FOLDED_TIMING50,
+        /* 210: XCVR_TSM->TIMING51 */
+        XCVR_FOLDED_TIMING51,
+        /* 211: XCVR_TSM->TIMING52 */
+        XCVR_FOLDED_TIMING52,
+        /* 212: XCVR_TSM->WU_LATENCY */
+        XCVR_FOLDED_WU_LATENCY,
+        /* 213: XCVR_TX_DIG->DATARATE_CONFIG_FILTER_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(0),
+#else
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(0),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 214: XCVR_TX_DIG->DATARATE_CONFIG_FSK_CTRL */
+        XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV0(0x0000) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV1(0x0000),
+        /* 215: XCVR_TX_DIG->DATARATE_CONFIG_GFSK_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x09DE),
+#else
+        XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x0804),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 216: XCVR_TX_DIG->DATA_PADDING_CTRL */
+        XCVR_FOLDED_DATA_PADDING_CTRL | XCVR_TX_DIG_DATA_PADDING_CTRL_DATA_PADDING_SEL(0) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_PAD_DLY(0) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_PAD_DLY_EN(1),
+        /* 217: XCVR_TX_DIG->DATA_PADDING_CTRL_1 */
+        XCVR_FOLDED_DATA_PADDING_CTRL_1 | XCVR_TX_DIG_DATA_PADDING_CTRL_1_RAMP_UP_DLY(0x04) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_1_TX_DATA_FLUSH_DLY(0x04),
+        /* 218: XCVR_TX_DIG->DATA_PADDING_CTRL_2 */
+        XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_MFDEV(0x0000) | XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_PFDEV(0x0000),
+        /* 219: XCVR_TX_DIG->FSK_CTRL */
+        XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_0(0x0000) | XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_1(0x0000),
+        /* 220: XCVR_TX_DIG->GFSK_COEFF_0_1 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_0(0x048) | XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_1(0x059),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_0(0x019) | XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_1(0x02C),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 221: XCVR_TX_DIG->GFSK_COEFF_2_3 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_2(0x06B) | XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_3(0x07D),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_2(0x046) | XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_3(0x069),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 222: XCVR_TX_DIG->GFSK_COEFF_4_5 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_4(0x08D) | XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_5(0x09A),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_4(0x091) | XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_5(0x0B8),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 223: XCVR_TX_DIG->GFSK_COEFF_6_7 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_6(0x0A4) | XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_7(0x0A9),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_6(0x0D8) | XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_7(0x0EA),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 224: XCVR_TX_DIG->GFSK_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(1) |
+            XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x4E9),
+#else
+        XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(1) |
+            XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x3FD),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 225: XCVR_TX_DIG->IMAGE_FILTER_CTRL */
+        XCVR_FOLDED_IMAGE_FILTER_CTRL | XCVR_TX_DIG_IMAGE_FILTER_CTRL_IMAGE_FILTER_OVRD_EN(0),
+        /* 226: XCVR_TX_DIG->PA_CTRL */
+        XCVR_FOLDED_PA_CTRL | XCVR_TX_DIG_PA_CTRL_PA_RAMP_SEL(1),
+        /* 227: XCVR_TX_DIG->PA_RAMP_TBL0 */
+        XCVR_FOLDED_PA_RAMP_TBL0,
+        /* 228: XCVR_TX_DIG->PA_RAMP_TBL1 */
+        XCVR_FOLDED_PA_RAMP_TBL1,
+        /* 229: XCVR_TX_DIG->PA_RAMP_TBL2 */
+        XCVR_FOLDED_PA_RAMP_TBL2,
+        /* 230: XCVR_TX_DIG->PA_RAMP_TBL3 */
+        XCVR_FOLDED_PA_RAMP_TBL3,
+        /* 231: XCVR_TX_DIG->SWITCH_TX_CTRL */
+        XCVR_FOLDED_SWITCH_TX_CTRL,
+        /* 232: XCVR_TX_DIG->TXDIG_CTRL */
+        XCVR_FOLDED_TXDIG_CTRL | XCVR_TX_DIG_TXDIG_CTRL_DATA_STREAM_SEL(0) | XCVR_TX_DIG_TXDIG_CTRL_MODULATOR_SEL(0) |
+            XCVR_TX_DIG_TXDIG_CTRL_PFC_EN(0),
+    },
+};
+
+const xcvr_folded_config_t xcvr_gfsk_bt_0p3_h_0p5_500kbps_folded_config = {
+    .config     = &xcvr_gfsk_bt_0p3_h_0p5_500kbps_full_config,
+    .reg_values = {
+        /* 0: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x14) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x10) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x0C) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x08) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+        /* 1: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x34) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x30),
+        /* 2: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x2C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x28) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x24),
+        /* 3: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x14) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x10) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x0C) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x08) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+        /* 4: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x34) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x38),
+        /* 5: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x3C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x04),
+        /* 6: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x0C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x08) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x04) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+        /* 7: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x08),
+        /* 8: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x04) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x3C),
+        /* 9: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x0C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x08) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x04) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+        /* 10: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x10),
+        /* 11: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x14) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x18) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x1C),
+        /* 12: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x34) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x38) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x3C) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+        /* 13: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x34) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x30),
+        /* 14: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x2C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x28) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x24),
+        /* 15: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x34) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x38) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x3C) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+        /* 16: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x34) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x38),
+        /* 17: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x3C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x04),
+        /* 18: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x2C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x30) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x34) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x38) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+        /* 19: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x08),
+        /* 20: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x04) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x3C),
+        /* 21: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x2C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x30) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x34) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x38) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+        /* 22: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x10),
+        /* 23: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x14) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x18) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x1C),
+        /* 24: GEN4PHY->DMD_CTRL0 */
+        XCVR_FOLDED_DMD_CTRL0,
+        /* 25: GEN4PHY->DMD_CTRL1 */
+        XCVR_FOLDED_DMD_CTRL1,
+        /* 26: GEN4PHY->FSK_CFG0 */
+        XCVR_FOLDED_FSK_CFG0 | GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_1M(0x0F) |
+            GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_2M(0x11) |
+            GEN4PHY_FSK_CFG0_MSK2FSK_SEED(0) | GEN4PHY_FSK_CFG0_MSK_EN(0),
+        /* 27: GEN4PHY->FSK_CFG1 */
+        GEN4PHY_FSK_CFG1_OVERH(0x020) | GEN4PHY_FSK_CFG1_OVERH_INV(0x100) | GEN4PHY_FSK_CFG1_SYNCTSCALE(0xF),
+        /* 28: GEN4PHY->FSK_CFG2 */
+        XCVR_FOLDED_FSK_CFG2,
+        /* 29: GEN4PHY->FSK_FAD_CFG */
+        XCVR_FOLDED_FSK_FAD_CFG,
+        /* 30: GEN4PHY->FSK_FAD_CTRL */
+        XCVR_FOLDED_FSK_FAD_CTRL,
+        /* 31: GEN4PHY->FSK_PD_CFG0 */
+        GEN4PHY_FSK_PD_CFG0_PD_IIR_ALPHA(0xFF) | GEN4PHY_FSK_PD_CFG0_PREAMBLE_T_SCALE(0xC),
+        /* 32: GEN4PHY->FSK_PD_CFG1 */
+        GEN4PHY_FSK_PD_CFG1_PREAMBLE_PATTERN(0x55),
+        /* 33: GEN4PHY->FSK_PD_CFG2 */
+        GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_1M(0xF6) | GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_2M(0xEB),
+        /* 34: GEN4PHY->FSK_PD_PH[0] */
+        GEN4PHY_FSK_PD_PH_REF0(0x02) | GEN4PHY_FSK_PD_PH_REF1(0x03) | GEN4PHY_FSK_PD_PH_REF2(0x02) |
+            GEN4PHY_FSK_PD_PH_REF3(0x00),
+        /* 35: GEN4PHY->FSK_PD_PH[1] */
+        GEN4PHY_FSK_PD_PH_REF0(0x3E) | GEN4PHY_FSK_PD_PH_REF1(0x3D) | GEN4PHY_FSK_PD_PH_REF2(0x3E) |
+            GEN4PHY_FSK_PD_PH_REF3(0x00),
+        /* 36: GEN4PHY->FSK_PT */
+        XCVR_FOLDED_FSK_PT | GEN4PHY_FSK_PT_AGC_TIMEOUT(0x0048),
+        /* 37: GEN4PHY->LR_AA_CFG */
+        GEN4PHY_LR_AA_CFG_AA_COR_THRESH(0x00) | GEN4PHY_LR_AA_CFG_AA_HAM_THRESH(0x00) |
+            GEN4PHY_LR_AA_CFG_AA_LR_CORR_GAIN(0x00) | GEN4PHY_LR_AA_CFG_ACCESS_ADDR_HAM(0x00),
+        /* 38: GEN4PHY->LR_PD_CFG */
+        GEN4PHY_LR_PD_CFG_CORR_TH(0x00) | GEN4PHY_LR_PD_CFG_FREQ_TH(0x00) | GEN4PHY_LR_PD_CFG_NO_PEAKS(0),
+        /* 39: GEN4PHY->LR_PD_PH[0] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 40: GEN4PHY->LR_PD_PH[1] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 41: GEN4PHY->LR_PD_PH[2] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 42: GEN4PHY->LR_PD_PH[3] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 43: GEN4PHY->MISC */
+        XCVR_FOLDED_MISC,
+        /* 44: GEN4PHY->PREPHY_MISC */
+        XCVR_FOLDED_PREPHY_MISC,
+        /* 45: GEN4PHY->RTT_CTRL */
+        XCVR_FOLDED_RTT_CTRL,
+        /* 46: GEN4PHY->RTT_REF */
+        GEN4PHY_RTT_REF_FM_REF_010(0x48) | GEN4PHY_RTT_REF_FM_REF_110(0x63) | GEN4PHY_RTT_REF_FM_REF_111(0x80),
+        /* 47: GEN4PHY->SM_CFG */
+        XCVR_FOLDED_SM_CFG | GEN4PHY_SM_CFG_AA_TIMEOUT_UNCODED(0x0A0),
+        /* 48: RADIO_CTRL->LL_CTRL */
+        RADIO_CTRL_LL_CTRL_ACTIVE_LL(2),
+        /* 49: XCVR_ANALOG->LDO_0 */
+        XCVR_FOLDED_LDO_0,
+        /* 50: XCVR_ANALOG->LDO_1 */
+        XCVR_FOLDED_LDO_1,
+        /* 51: XCVR_ANALOG->PLL */
+        XCVR_FOLDED_PLL,
+        /* 52: XCVR_ANALOG->RX_0 */
+        XCVR_FOLDED_RX_0,
+        /* 53: XCVR_ANALOG->RX_1 */
+        XCVR_FOLDED_RX_1,
+        /* 54: XCVR_ANALOG->TX_DAC_PA */
+        XCVR_FOLDED_TX_DAC_PA | XCVR_ANALOG_TX_DAC_PA_DAC_TRIM_CFBK_DRS(1),
+        /* 55: XCVR_ANALOG->XO_DIST */
+        XCVR_FOLDED_XO_DIST,
+        /* 56: XCVR_MISC->IPS_FO_ADDR[0] */
+        XCVR_MISC_IPS_FO_ADDR_ADDR(0x370) | XCVR_MISC_IPS_FO_ADDR_ENTRY_RX(0) | XCVR_MISC_IPS_FO_ADDR_ENTRY_TX(0),
+        /* 57: XCVR_MISC->IPS_FO_ADDR[1] */
+        XCVR_MISC_IPS_FO_ADDR_ADDR(0x02C) | XCVR_MISC_IPS_FO_ADDR_ENTRY_RX(0) | XCVR_MISC_IPS_FO_ADDR_ENTRY_TX(0),
+        /* 58: XCVR_MISC->IPS_FO_DRS0_DATA[0] */
+        XCVR_MISC_IPS_FO_DRS0_DATA_DRS0_DATA(0x00000000),
+        /* 59: XCVR_MISC->IPS_FO_DRS0_DATA[1] */
+        XCVR_MISC_IPS_FO_DRS0_DATA_DRS0_DATA(0x00000000),
+        /* 60: XCVR_MISC->IPS_FO_DRS1_DATA[0] */
+        XCVR_MISC_IPS_FO_DRS1_DATA_DRS1_DATA(0x00000000),
+        /* 61: XCVR_MISC->IPS_FO_DRS1_DATA[1] */
+        XCVR_MISC_IPS_FO_DRS1_DATA_DRS1_DATA(0x00000000),
+        /* 62: XCVR_MISC->LDO_TRIM_0 */
+        XCVR_FOLDED_LDO_TRIM_0,
+        /* 63: XCVR_MISC->LDO_TRIM_1 */
+        XCVR_FOLDED_LDO_TRIM_1,
+        /* 64: XCVR_MISC->XCVR_CTRL */
+        XCVR_FOLDED_XCVR_CTRL | XCVR_MISC_XCVR_CTRL_DATA_RATE_DRS(2) | XCVR_MISC_XCVR_CTRL_DEMOD_SEL(1) |
+            XCVR_MISC_XCVR_CTRL_LL_CFG_CAPT_DIS(0),
+        /* 65: XCVR_PLL_DIG->CHAN_MAP */
+        XCVR_FOLDED_CHAN_MAP | XCVR_PLL_DIG_CHAN_MAP_BAND_SELECT(0),
+        /* 66: XCVR_PLL_DIG->CHAN_MAP_EXT */
+#if RF_OSC_26MHZ == 1
+        XCVR_FOLDED_CHAN_MAP_EXT | XCVR_PLL_DIG_CHAN_MAP_EXT_NUM_OFFSET(0x013B13B),
+#else
+        XCVR_FOLDED_CHAN_MAP_EXT | XCVR_PLL_DIG_CHAN_MAP_EXT_NUM_OFFSET(0x0100000),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 67: XCVR_PLL_DIG->DATA_RATE_OVRD_CTRL1 */
+        XCVR_FOLDED_DATA_RATE_OVRD_CTRL1,
+        /* 68: XCVR_PLL_DIG->DATA_RATE_OVRD_CTRL2 */
+#if RF_OSC_26MHZ == 1
+        XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL2_NUM_OFFSET_CFG1(0x013B13B),
+#else
+        XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL2_NUM_OFFSET_CFG1(0x0100000),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 69: XCVR_PLL_DIG->DELAY_MATCH */
+        XCVR_FOLDED_DELAY_MATCH | XCVR_PLL_DIG_DELAY_MATCH_HPM_INTEGER_DELAY(0x04) |
+            XCVR_PLL_DIG_DELAY_MATCH_LPM_SDM_DELAY(0x03),
+        /* 70: XCVR_PLL_DIG->HPMCAL_CTRL */
+        XCVR_FOLDED_HPMCAL_CTRL | XCVR_PLL_DIG_HPMCAL_CTRL_HPM_CAL_ARRAY_SIZE(0),
+        /* 71: XCVR_PLL_DIG->HPM_BUMP */
+        XCVR_FOLDED_HPM_BUMP | XCVR_PLL_DIG_HPM_BUMP_HPM_VCM_CAL(2) | XCVR_PLL_DIG_HPM_BUMP_HPM_VCM_TX(2),
+        /* 72: XCVR_PLL_DIG->HPM_CAL_TIMING */
+        XCVR_FOLDED_HPM_CAL_TIMING,
+        /* 73: XCVR_PLL_DIG->HPM_CTRL */
+        XCVR_FOLDED_HPM_CTRL,
+        /* 74: XCVR_PLL_DIG->HPM_SDM_RES */
+        XCVR_FOLDED_HPM_SDM_RES | XCVR_PLL_DIG_HPM_SDM_RES_HPM_COUNT_ADJUST(0x02),
+        /* 75: XCVR_PLL_DIG->LOCK_DETECT */
+        XCVR_FOLDED_LOCK_DETECT,
+        /* 76: XCVR_PLL_DIG->LPM_CTRL */
+        XCVR_FOLDED_LPM_CTRL,
+        /* 77: XCVR_PLL_DIG->LPM_SDM_CTRL1 */
+        XCVR_FOLDED_LPM_SDM_CTRL1,
+        /* 78: XCVR_PLL_DIG->MOD_CTRL */
+        XCVR_FOLDED_MOD_CTRL,
+        /* 79: XCVR_PLL_DIG->PLL_DATARATE_CTRL */
+        XCVR_FOLDED_PLL_DATARATE_CTRL,
+        /* 80: XCVR_PLL_DIG->TUNING_CAP_RX_CTRL */
+        XCVR_FOLDED_TUNING_CAP_RX_CTRL,
+        /* 81: XCVR_PLL_DIG->TUNING_CAP_TX_CTRL */
+        XCVR_FOLDED_TUNING_CAP_TX_CTRL,
+        /* 82: XCVR_RX_DIG->ACQ_FILT_0_3 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x01) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x05) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x08) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x07),
+#else
+        XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x02) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x00) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x79) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x79),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 83: XCVR_RX_DIG->ACQ_FILT_0_3_DRS */
+        XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H0(0x00) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H1(0x00) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H2(0x00) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H3(0x00),
+        /* 84: XCVR_RX_DIG->ACQ_FILT_10_11 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x068) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x088),
+#else
+        XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x06B) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x0D1),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 85: XCVR_RX_DIG->ACQ_FILT_10_11_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x065) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x096),
+#else
+        XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x051) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x0EA),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 86: XCVR_RX_DIG->ACQ_FILT_4_7 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x7E) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x6F) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_H6(0xE5) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0xEA),
+#else
+        XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x07) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x18) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_H6(0x0E) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0xE3),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 87: XCVR_RX_DIG->ACQ_FILT_4_7_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x03) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x00) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0xF5) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0xEB),
+#else
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x7E) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x00) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0x0F) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0x07),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 88: XCVR_RX_DIG->ACQ_FILT_8_9 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x006) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x036),
+#else
+        XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x1C8) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x1F7),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 89: XCVR_RX_DIG->ACQ_FILT_8_9_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x1F6) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x023),
+#else
+        XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x1D9) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x1D6),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 90: XCVR_RX_DIG->AGC_CTRL */
+        XCVR_FOLDED_AGC_CTRL,
+        /* 91: XCVR_RX_DIG->AGC_CTRL_STAT */
+        XCVR_FOLDED_AGC_CTRL_STAT,
+        /* 92: XCVR_RX_DIG->AGC_IDX0_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX0_GAIN_CFG,
+        /* 93: XCVR_RX_DIG->AGC_IDX0_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX0_GAIN_VAL,
+        /* 94: XCVR_RX_DIG->AGC_IDX0_THR */
+        XCVR_FOLDED_AGC_IDX0_THR,
+        /* 95: XCVR_RX_DIG->AGC_IDX10_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX10_GAIN_CFG,
+        /* 96: XCVR_RX_DIG->AGC_IDX10_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX10_GAIN_VAL,
+        /* 97: XCVR_RX_DIG->AGC_IDX10_THR */
+        XCVR_FOLDED_AGC_IDX10_THR,
+        /* 98: XCVR_RX_DIG->AGC_IDX11_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX11_GAIN_CFG | XCVR_RX_DIG_AGC_IDX11_GAIN_CFG_MAG_THR_11_DRS_OFS(0x00) |
+            XCVR_RX_DIG_AGC_IDX11_GAIN_CFG_MAG_THR_HI_11_DRS_OFS(0x00),
+        /* 99: XCVR_RX_DIG->AGC_IDX11_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX11_GAIN_VAL | XCVR_RX_DIG_AGC_IDX11_GAIN_VAL_MAG_THR_11(0x000) |
+            XCVR_RX_DIG_AGC_IDX11_GAIN_VAL_MAG_THR_HI_11(0x000),
+        /* 100: XCVR_RX_DIG->AGC_IDX11_THR */
+        XCVR_FOLDED_AGC_IDX11_THR,
+        /* 101: XCVR_RX_DIG->AGC_IDX1_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX1_GAIN_CFG,
+        /* 102: XCVR_RX_DIG->AGC_IDX1_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX1_GAIN_VAL,
+        /* 103: XCVR_RX_DIG->AGC_IDX1_THR */
+        XCVR_FOLDED_AGC_IDX1_THR,
+        /* 104: XCVR_RX_DIG->AGC_IDX2_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX2_GAIN_CFG,
+        /* 105: XCVR_RX_DIG->AGC_IDX2_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX2_GAIN_VAL,
+        /* 106: XCVR_RX_DIG->AGC_IDX2_THR */
+        XCVR_FOLDED_AGC_IDX2_THR,
+        /* 107: XCVR_RX_DIG->AGC_IDX3_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX3_GAIN_CFG,
+        /* 108: XCVR_RX_DIG->AGC_IDX3_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX3_GAIN_VAL,
+        /* 109: XCVR_RX_DIG->AGC_IDX3_THR */
+        XCVR_FOLDED_AGC_IDX3_THR,
+        /* 110: XCVR_RX_DIG->AGC_IDX4_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX4_GAIN_CFG,
+        /* 111: XCVR_RX_DIG->AGC_IDX4_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX4_GAIN_VAL,
+        /* 112: XCVR_RX_DIG->AGC_IDX4_THR */
+        XCVR_FOLDED_AGC_IDX4_THR,
+        /* 113: XCVR_RX_DIG->AGC_IDX5_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX5_GAIN_CFG,
+        /* 114: XCVR_RX_DIG->AGC_IDX5_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX5_GAIN_VAL,
+        /* 115: XCVR_RX_DIG->AGC_IDX5_THR */
+        XCVR_FOLDED_AGC_IDX5_THR,
+        /* 116: XCVR_RX_DIG->AGC_IDX6_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX6_GAIN_CFG,
+        /* 117: XCVR_RX_DIG->AGC_IDX6_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX6_GAIN_VAL,
+        /* 118: XCVR_RX_DIG->AGC_IDX6_THR */
+        XCVR_FOLDED_AGC_IDX6_THR,
+        /* 119: XCVR_RX_DIG->AGC_IDX7_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX7_GAIN_CFG,
+        /* 120: XCVR_RX_DIG->AGC_IDX7_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX7_GAIN_VAL,
+        /* 121: XCVR_RX_DIG->AGC_IDX7_THR */
+        XCVR_FOLDED_AGC_IDX7_THR,
+        /* 122: XCVR_RX_DIG->AGC_IDX8_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX8_GAIN_CFG,
+        /* 123: XCVR_RX_DIG->AGC_IDX8_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX8_GAIN_VAL,
+        /* 124: XCVR_RX_DIG->AGC_IDX8_THR */
+        XCVR_FOLDED_AGC_IDX8_THR,
+        /* 125: XCVR_RX_DIG->AGC_IDX9_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX9_GAIN_CFG,
+        /* 126: XCVR_RX_DIG->AGC_IDX9_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX9_GAIN_VAL,
+        /* 127: XCVR_RX_DIG->AGC_IDX9_THR */
+        XCVR_FOLDED_AGC_IDX9_THR,
+        /* 128: XCVR_RX_DIG->AGC_MIS_GAIN_CFG */
+        XCVR_FOLDED_AGC_MIS_GAIN_CFG,
+        /* 129: XCVR_RX_DIG->AGC_THR_FAST */
+        XCVR_FOLDED_AGC_THR_FAST,
+        /* 130: XCVR_RX_DIG->AGC_THR_FAST_DRS */
+        XCVR_FOLDED_AGC_THR_FAST_DRS,
+        /* 131: XCVR_RX_DIG->AGC_THR_MIS */
+        XCVR_FOLDED_AGC_THR_MIS,
+        /* 132: XCVR_RX_DIG->AGC_TIMING0 */
+        XCVR_FOLDED_AGC_TIMING0 | XCVR_RX_DIG_AGC_TIMING0_AGC_GAIN_STEP_WAIT(0x10),
+        /* 133: XCVR_RX_DIG->AGC_TIMING0_DRS */
+        XCVR_FOLDED_AGC_TIMING0_DRS | XCVR_RX_DIG_AGC_TIMING0_DRS_AGC_GAIN_STEP_WAIT(0x10),
+        /* 134: XCVR_RX_DIG->AGC_TIMING1 */
+        XCVR_FOLDED_AGC_TIMING1 | XCVR_RX_DIG_AGC_TIMING1_AGC_FREEZE_TIMEOUT(0x0A) |
+            XCVR_RX_DIG_AGC_TIMING1_AGC_HOLD_TIMEOUT(0x08),
+        /* 135: XCVR_RX_DIG->AGC_TIMING1_DRS */
+        XCVR_RX_DIG_AGC_TIMING1_DRS_AGC_FREEZE_TIMEOUT(0x0A) | XCVR_RX_DIG_AGC_TIMING1_DRS_AGC_HOLD_TIMEOUT(0x08),
+        /* 136: XCVR_RX_DIG->AGC_TIMING2 */
+        XCVR_FOLDED_AGC_TIMING2 | XCVR_RX_DIG_AGC_TIMING2_AGC_UNFREEZE_FEAT_TIMEOUT(0x000) |
+            XCVR_RX_DIG_AGC_TIMING2_AGC_UNHOLD_FEAT_TIMEOUT(0x000),
+        /* 137: XCVR_RX_DIG->AGC_TIMING2_DRS */
+        XCVR_RX_DIG_AGC_TIMING2_DRS_AGC_UNFREEZE_FEAT_TIMEOUT(0x000) |
+            XCVR_RX_DIG_AGC_TIMING2_DRS_AGC_UNHOLD_FEAT_TIMEOUT(0x000),
+        /* 138: XCVR_RX_DIG->CTRL0 */
+#if RF_OSC_26MHZ == 1
+        XCVR_FOLDED_CTRL0 | XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(2) |
+            XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x027) |
+            XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(1) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#else
+        XCVR_FOLDED_CTRL0 | XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(3) |
+            XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x020) |
+            XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(1) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 139: XCVR_RX_DIG->CTRL0_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(3) |
+            XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x027),
+#else
+        XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(4) |
+            XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x020),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 140: XCVR_RX_DIG->CTRL1 */
+        XCVR_FOLDED_CTRL1,
+        /* 141: XCVR_RX_DIG->DCOC_CTRL0 */
+        XCVR_FOLDED_DCOC_CTRL0 | XCVR_RX_DIG_DCOC_CTRL0_DCOC_DAC_ORDER(1) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFII(0x6) |
+            XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFIIP(1) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFQQ(0x5) |
+            XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFQQP(1),
+        /* 142: XCVR_RX_DIG->DCOC_CTRL0_DRS */
+        XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFII(6) | XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFIIP(1) |
+            XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFQQ(5) | XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFQQP(1),
+        /* 143: XCVR_RX_DIG->DCOC_CTRL1 */
+        XCVR_FOLDED_DCOC_CTRL1,
+        /* 144: XCVR_RX_DIG->DEMOD_FILT_0_1 */
+        XCVR_RX_DIG_DEMOD_FILT_0_1_H0(0x1FE) | XCVR_RX_DIG_DEMOD_FILT_0_1_H1(0x005),
+        /* 145: XCVR_RX_DIG->DEMOD_FILT_0_1_DRS */
+        XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H0(0x1FE) | XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H1(0x003),
+        /* 146: XCVR_RX_DIG->DEMOD_FILT_2_4 */
+        XCVR_RX_DIG_DEMOD_FILT_2_4_H2(0x02E) | XCVR_RX_DIG_DEMOD_FILT_2_4_H3(0x07C) |
+            XCVR_RX_DIG_DEMOD_FILT_2_4_H4(0x0A6),
+        /* 147: XCVR_RX_DIG->DEMOD_FILT_2_4_DRS */
+        XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H2(0x02D) | XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H3(0x07C) |
+            XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H4(0x0A7),
+        /* 148: XCVR_RX_DIG->NB_RSSI_CTRL0 */
+        XCVR_FOLDED_NB_RSSI_CTRL0,
+        /* 149: XCVR_RX_DIG->NB_RSSI_CTRL1 */
+        XCVR_FOLDED_NB_RSSI_CTRL1,
+        /* 150: XCVR_RX_DIG->RCCAL_CTRL0 */
+        XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE(2) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE_DRS(3) |
+            XCVR_RX_DIG_RCCAL_CTRL0_CBPF_CCODE_OFFSET(0x00) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE(1) |
+            XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE_DRS(1) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CMPOUT_INV(0) |
+            XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CODE_OFFSET(0x0) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_SMPL_DLY(0),
+        /* 151: XCVR_RX_DIG->RSSI_GLOBAL_CTRL */
+        XCVR_FOLDED_RSSI_GLOBAL_CTRL | XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_CCA1_ED_EN(0),
+        /* 152: XCVR_RX_DIG->WB_RSSI_CTRL */
+        XCVR_FOLDED_WB_RSSI_CTRL,
+        /* 153: XCVR_TSM->CTRL */
+        XCVR_FOLDED_CTRL,
+        /* 154: XCVR_TSM->END_OF_SEQ */
+        XCVR_FOLDED_END_OF_SEQ,
+        /* 155: XCVR_TSM->FAST_CTRL1 */
+        XCVR_FOLDED_FAST_CTRL1,
+        /* 156: XCVR_TSM->FAST_CTRL2 */
+        XCVR_FOLDED_FAST_CTRL2,
+        /* 157: XCVR_TSM->FAST_CTRL3 */
+        XCVR_FOLDED_FAST_CTRL3,
+        /* 158: XCVR_TSM->RECYCLE_COUNT */
+        XCVR_FOLDED_RECYCLE_COUNT,
+        /* 159: XCVR_TSM->TIMING00 */
+        XCVR_FOLDED_TIMING00,
+        /* 160: XCVR_TSM->TIMING01 */
+        XCVR_FOLDED_TIMING01,
+        /* 161: XCVR_TSM->TIMING02 */
+        XCVR_FOLDED_TIMING02,
+        /* 162: XCVR_TSM->TIMING03 */
+        XCVR_FOLDED_TIMING03,
+        /* 163: XCVR_TSM->TIMING04 */
+        XCVR_FOLDED_TIMING04,
+        /* 164: XCVR_TSM->TIMING05 */
+        XCVR_FOLDED_TIMING05,
+        /* 165: XCVR_TSM->TIMING06 */
+        XCVR_FOLDED_TIMING06,
+        /* 166: XCVR_TSM->TIMING07 */
+        XCVR_FOLDED_TIMING07,
+        /* 167: XCVR_TSM->TIMING08 */
+        XCVR_FOLDED_TIMING08,
+        /* 168: XCVR_TSM->TIMING09 */
+        XCVR_FOLDED_TIMING09,
+        /* 169: XCVR_TSM->TIMING10 */
+        XCVR_FOLDED_TIMING10,
+        /* 170: XCVR_TSM->TIMING11 */
+        XCVR_FOLDED_TIMING11,
+        /* 171: XCVR_TSM->TIMING12 */
+        XCVR_FOLDED_TIMING12,
+        /* 172: XCVR_TSM->TIMING13 */
+        XCVR_FOLDED_TIMING13,
+        /* 173: XCVR_TSM->TIMING14 */
+        XCVR_FOLDED_TIMING14,
+        /* 174: XCVR_TSM->TIMING15 */
+        XCVR_FOLDED_TIMING15,
+        /* 175: XCVR_TSM->TIMING16 */
+        XCVR_FOLDED_TIMING16,
+        /* 176: XCVR_TSM->TIMING17 */
+        XCVR_FOLDED_TIMING17,
+        /* 177: XCVR_TSM->TIMING18 */
+        XCVR_FOLDED_TIMING18,
+        /* 178: XCVR_TSM->TIMING19 */
+        XCVR_FOLDED_TIMING19,
+        /* 179: XCVR_TSM->TIMING20 */
+        XCVR_FOLDED_TIMING20,
+        /* 180: XCVR_TSM->TIMING21 */
+        XCVR_FOLDED_TIMING21,
+        /* 181: XCVR_TSM->TIMING22 */
+        XCVR_FOLDED_TIMING22,
+        /* 182: XCVR_TSM->TIMING23 */
+        XCVR_FOLDED_TIMING23,
+        /* 183: XCVR_TSM->TIMING24 */
+        XCVR_FOLDED_TIMING24,
+        /* 184: XCVR_TSM->TIMING25 */
+        XCVR_FOLDED_TIMING25,
+        /* 185: XCVR_TSM->TIMING26 */
+        XCVR_FOLDED_TIMING26,
+        /* 186: XCVR_TSM->TIMING27 */
+        XCVR_FOLDED_TIMING27,
+        /* 187: XCVR_TSM->TIMING28 */
+        XCVR_FOLDED_TIMING28,
+        /* 188: XCVR_TSM->TIMING29 */
+        XCVR_FOLDED_TIMING29,
+        /* 189: XCVR_TSM->TIMING30 */
+        XCVR_FOLDED_TIMING30,
+        /* 190: XCVR_TSM->TIMING31 */
+        XCVR_FOLDED_TIMING31,
+        /* 191: XCVR_TSM->TIMING32 */
+        XCVR_FOLDED_TIMING32,
+        /* 192: XCVR_TSM->TIMING33 */
+        XCVR_FOLDED_TIMING33,
+        /* 193: XCVR_TSM->TIMING34 */
+        XCVR_FOLDED_TIMING34,
+        /* 194: XCVR_TSM->TIMING35 */
+        XCVR_FOLDED_TIMING35,
+        /* 195: XCVR_TSM->TIMING36 */
+        XCVR_FOLDED_TIMING36,
+        /* 196: XCVR_TSM->TIMING37 */
+        XCVR_FOLDED_TIMING37,
+        /* 197: XCVR_TSM->TIMING38 */
+        XCVR_FOLDED_TIMING38,
+        /* 198: XCVR_TSM->TIMING39 */
+        XCVR_FOLDED_TIMING39,
+        /* 199: XCVR_TSM->TIMING40 */
+        XCVR_FOLDED_TIMING40,
+        /* 200: XCVR_TSM->TIMING41 */
+        XCVR_FOLDED_TIMING41,
+        /* 201: XCVR_TSM->TIMING42 */
+        XCVR_FOLDED_TIMING42,
+        /* 202: XCVR_TSM->TIMING43 */
+        XCVR_FOLDED_TIMING43,
+        /* 203: XCVR_TSM->TIMING44 */
+        XCVR_FOLDED_TIMING44,
+        /* 204: XCVR_TSM->TIMING45 */
+        XCVR_FOLDED_TIMING45,
+        /* 205: XCVR_TSM->TIMING46 */
+        XCVR_FOLDED_TIMING46,
+        /* 206: XCVR_TSM->TIMING47 */
+        XCVR_FOLDED_TIMING47,
+        /* 207: XCVR_TSM->TIMING48 */
+        XCVR_FOLDED_TIMING48,
+        /* 208: XCVR_TSM->TIMING49 */
+        XCVR_FOLDED_TIMING49,
+        /* 209: XCVR_TSM->TIMING50 */
+        XCVR_FOLDED_TIMING50,
+        /* 210: XCVR_TSM->TIMING51 */
+        XCVR_FOLDED_TIMING51,
+        /* 211: XCVR_TSM->TIMING52 */
+        XCVR_FOLDED_TIMING52,
+        /* 212: XCVR_TSM->WU_LATENCY */
+        XCVR_FOLDED_WU_LATENCY,
+        /* 213: XCVR_TX_DIG->DATARATE_CONFIG_FILTER_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(2) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(2) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(1),
+#else
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(3) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(2) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(1),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 214: XCVR_TX_DIG->DATARATE_CONFIG_FSK_CTRL */
+        XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV0(0x0000) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV1(0x0000),
+        /* 215: XCVR_TX_DIG->DATARATE_CONFIG_GFSK_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x0279),
+#else
+        XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x0203),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 216: XCVR_TX_DIG->DATA_PADDING_CTRL */
+        XCVR_FOLDED_DATA_PADDING_CTRL | XCVR_TX_DIG_DATA_PADDING_CTRL_DATA_PADDING_SEL(0) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_PAD_DLY(0) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_PAD_DLY_EN(1),
+        /* 217: XCVR_TX_DIG->DATA_PADDING_CTRL_1 */
+        XCVR_FOLDED_DATA_PADDING_CTRL_1 | XCVR_TX_DIG_DATA_PADDING_CTRL_1_RAMP_UP_DLY(0x04) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_1_TX_DATA_FLUSH_DLY(0x04),
+        /* 218: XCVR_TX_DIG->DATA_PADDING_CTRL_2 */
+        XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_MFDEV(0x0000) | XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_PFDEV(0x0000),
+        /* 219: XCVR_TX_DIG->FSK_CTRL */
+        XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_0(0x0000) | XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_1(0x0000),
+        /* 220: XCVR_TX_DIG->GFSK_COEFF_0_1 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_0(0x048) | XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_1(0x059),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_0(0x019) | XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_1(0x02C),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 221: XCVR_TX_DIG->GFSK_COEFF_2_3 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_2(0x06B) | XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_3(0x07D),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_2(0x046) | XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_3(0x069),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 222: XCVR_TX_DIG->GFSK_COEFF_4_5 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_4(0x08D) | XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_5(0x09A),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_4(0x091) | XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_5(0x0B8),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 223: XCVR_TX_DIG->GFSK_COEFF_6_7 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_6(0x0A4) | XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_7(0x0A9),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_6(0x0D8) | XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_7(0x0EA),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 224: XCVR_TX_DIG->GFSK_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(1) |
+            XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x276),
+#else
+        XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(1) |
+            XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x200),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 225: XCVR_TX_DIG->IMAGE_FILTER_CTRL */
+        XCVR_FOLDED_IMAGE_FILTER_CTRL | XCVR_TX_DIG_IMAGE_FILTER_CTRL_IMAGE_FILTER_OVRD_EN(0),
+        /* 226: XCVR_TX_DIG->PA_CTRL */
+        XCVR_FOLDED_PA_CTRL | XCVR_TX_DIG_PA_CTRL_PA_RAMP_SEL(1),
+        /* 227: XCVR_TX_DIG->PA_RAMP_TBL0 */
+        XCVR_FOLDED_PA_RAMP_TBL0,
+        /* 228: XCVR_TX_DIG->PA_RAMP_TBL1 */
+        XCVR_FOLDED_PA_RAMP_TBL1,
+        /* 229: XCVR_TX_DIG->PA_RAMP_TBL2 */
+        XCVR_FOLDED_PA_RAMP_TBL2,
+        /* 230: XCVR_TX_DIG->PA_RAMP_TBL3 */
+        XCVR_FOLDED_PA_RAMP_TBL3,
+        /* 231: XCVR_TX_DIG->SWITCH_TX_CTRL */
+        XCVR_FOLDED_SWITCH_TX_CTRL,
+        /* 232: XCVR_TX_DIG->TXDIG_CTRL */
+        XCVR_FOLDED_TXDIG_CTRL | XCVR_TX_DIG_TXDIG_CTRL_DATA_STREAM_SEL(0) | XCVR_TX_DIG_TXDIG_CTRL_MODULATOR_SEL(0) |
+            XCVR_TX_DIG_TXDIG_CTRL_PFC_EN(0),
+    },
+};
+
+const xcvr_folded_config_t xcvr_gfsk_bt_0p3_h_0p5_250kbps_folded_config = {
+    .config     = &xcvr_gfsk_bt_0p3_h_0p5_250kbps_full_config,
+    .reg_values = {
+        /* 0: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x14) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x10) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x0C) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x08) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+        /* 1: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x34) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x30),
+        /* 2: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x2C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x28) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x24),
+        /* 3: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x14) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x10) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x0C) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x08) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+        /* 4: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x34) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x38),
+        /* 5: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x3C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x04),
+        /* 6: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x0C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x08) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x04) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+        /* 7: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x08),
+        /* 8: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x04) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x3C),
+        /* 9: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x0C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x08) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x04) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+        /* 10: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x10),
+        /* 11: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x14) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x18) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x1C),
+        /* 12: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x34) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x38) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x3C) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+        /* 13: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x34) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x30),
+        /* 14: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x2C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x28) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x24),
+        /* 15: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x34) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x38) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x3C) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+        /* 16: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x34) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x38),
+        /* 17: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x3C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x04),
+        /* 18: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x2C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x30) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x34) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x38) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+        /* 19: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x08),
+        /* 20: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x04) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x3C),
+        /* 21: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x2C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x30) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x34) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x38) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+        /* 22: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x10),
+        /* 23: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x14) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x18) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x1C),
+        /* 24: GEN4PHY->DMD_CTRL0 */
+        XCVR_FOLDED_DMD_CTRL0,
+        /* 25: GEN4PHY->DMD_CTRL1 */
+        XCVR_FOLDED_DMD_CTRL1,
+        /* 26: GEN4PHY->FSK_CFG0 */
+        XCVR_FOLDED_FSK_CFG0 | GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_1M(0x0F) |
+            GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_2M(0x11) |
+            GEN4PHY_FSK_CFG0_MSK2FSK_SEED(0) | GEN4PHY_FSK_CFG0_MSK_EN(0),
+        /* 27: GEN4PHY->FSK_CFG1 */
+        GEN4PHY_FSK_CFG1_OVERH(0x020) | GEN4PHY_FSK_CFG1_OVERH_INV(0x100) | GEN4PHY_FSK_CFG1_SYNCTSCALE(0xF),
+        /* 28: GEN4PHY->FSK_CFG2 */
+        XCVR_FOLDED_FSK_CFG2,
+        /* 29: GEN4PHY->FSK_FAD_CFG */
+        XCVR_FOLDED_FSK_FAD_CFG,
+        /* 30: GEN4PHY->FSK_FAD_CTRL */
+        XCVR_FOLDED_FSK_FAD_CTRL,
+        /* 31: GEN4PHY->FSK_PD_CFG0 */
+        GEN4PHY_FSK_PD_CFG0_PD_IIR_ALPHA(0xFF) | GEN4PHY_FSK_PD_CFG0_PREAMBLE_T_SCALE(0xC),
+        /* 32: GEN4PHY->FSK_PD_CFG1 */
+        GEN4PHY_FSK_PD_CFG1_PREAMBLE_PATTERN(0x55),
+        /* 33: GEN4PHY->FSK_PD_CFG2 */
+        GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_1M(0xF6) | GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_2M(0xEB),
+        /* 34: GEN4PHY->FSK_PD_PH[0] */
+        GEN4PHY_FSK_PD_PH_REF0(0x02) | GEN4PHY_FSK_PD_PH_REF1(0x03) | GEN4PHY_FSK_PD_PH_REF2(0x02) |
+            GEN4PHY_FSK_PD_PH_REF3(0x00),
+        /* 35: GEN4PHY->FSK_PD_PH[1] */
+        GEN4PHY_FSK_PD_PH_REF0(0x3E) | GEN4PHY_FSK_PD_PH_REF1(0x3D) | GEN4PHY_FSK_PD_PH_REF2(0x3E) |
+            GEN4PHY_FSK_PD_PH_REF3(0x00),
+        /* 36: GEN4PHY->FSK_PT */
+        XCVR_FOLDED_FSK_PT | GEN4PHY_FSK_PT_AGC_TIMEOUT(0x0048),
+        /* 37: GEN4PHY->LR_AA_CFG */
+        GEN4PHY_LR_AA_CFG_AA_COR_THRESH(0x00) | GEN4PHY_LR_AA_CFG_AA_HAM_THRESH(0x00) |
+            GEN4PHY_LR_AA_CFG_AA_LR_CORR_GAIN(0x00) | GEN4PHY_LR_AA_CFG_ACCESS_ADDR_HAM(0x00),
+        /* 38: GEN4PHY->LR_PD_CFG */
+        GEN4PHY_LR_PD_CFG_CORR_TH(0x00) | GEN4PHY_LR_PD_CFG_FREQ_TH(0x00) | GEN4PHY_LR_PD_CFG_NO_PEAKS(0),
+        /* 39: GEN4PHY->LR_PD_PH[0] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 40: GEN4PHY->LR_PD_PH[1] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 41: GEN4PHY->LR_PD_PH[2] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 42: GEN4PHY->LR_PD_PH[3] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 43: GEN4PHY->MISC */
+        XCVR_FOLDED_MISC,
+        /* 44: GEN4PHY->PREPHY_MISC */
+        XCVR_FOLDED_PREPHY_MISC,
+        /* 45: GEN4PHY->RTT_CTRL */
+        XCVR_FOLDED_RTT_CTRL,
+        /* 46: GEN4PHY->RTT_REF */
+        GEN4PHY_RTT_REF_FM_REF_010(0x48) | GEN4PHY_RTT_REF_FM_REF_110(0x63) | GEN4PHY_RTT_REF_FM_REF_111(0x80),
+        /* 47: GEN4PHY->SM_CFG */
+        XCVR_FOLDED_SM_CFG | GEN4PHY_SM_CFG_AA_TIMEOUT_UNCODED(0x0A0),
+        /* 48: RADIO_CTRL->LL_CTRL */
+        RADIO_CTRL_LL_CTRL_ACTIVE_LL(2),
+        /* 49: XCVR_ANALOG->LDO_0 */
+        XCVR_FOLDED_LDO_0,
+        /* 50: XCVR_ANALOG->LDO_1 */
+        XCVR_FOLDED_LDO_1,
+        /* 51: XCVR_ANALOG->PLL */
+        XCVR_FOLDED_PLL,
+        /* 52: XCVR_ANALOG->RX_0 */
+        XCVR_FOLDED_RX_0,
+        /* 53: XCVR_ANALOG->RX_1 */
+        XCVR_FOLDED_RX_1,
+        /* 54: XCVR_ANALOG->TX_DAC_PA */
+        XCVR_FOLDED_TX_DAC_PA | XCVR_ANALOG_TX_DAC_PA_DAC_TRIM_CFBK_DRS(1),
+        /* 55: XCVR_ANALOG->XO_DIST */
+        XCVR_FOLDED_XO_DIST,
+        /* 56: XCVR_MISC->IPS_FO_ADDR[0] */
+        XCVR_MISC_IPS_FO_ADDR_ADDR(0x370) | XCVR_MISC_IPS_FO_ADDR_ENTRY_RX(0) | XCVR_MISC_IPS_FO_ADDR_ENTRY_TX(0),
+        /* 57: XCVR_MISC->IPS_FO_ADDR[1] */
+        XCVR_MISC_IPS_FO_ADDR_ADDR(0x02C) | XCVR_MISC_IPS_FO_ADDR_ENTRY_RX(0) | XCVR_MISC_IPS_FO_ADDR_ENTRY_TX(0),
+        /* 58: XCVR_MISC->IPS_FO_DRS0_DATA[0] */
+        XCVR_MISC_IPS_FO_DRS0_DATA_DRS0_DATA(0x00000000),
+        /* 59: XCVR_MISC->IPS_FO_DRS0_DATA[1] */
+        XCVR_MISC_IPS_FO_DRS0_DATA_DRS0_DATA(0x00000000),
+        /* 60: XCVR_MISC->IPS_FO_DRS1_DATA[0] */
+        XCVR_MISC_IPS_FO_DRS1_DATA_DRS1_DATA(0x00000000),
+        /* 61: XCVR_MISC->IPS_FO_DRS1_DATA[1] */
+        XCVR_MISC_IPS_FO_DRS1_DATA_DRS1_DATA(0x00000000),
+        /* 62: XCVR_MISC->LDO_TRIM_0 */
+        XCVR_FOLDED_LDO_TRIM_0,
+        /* 63: XCVR_MISC->LDO_TRIM_1 */
+        XCVR_FOLDED_LDO_TRIM_1,
+        /* 64: XCVR_MISC->XCVR_CTRL */
+        XCVR_FOLDED_XCVR_CTRL | XCVR_MISC_XCVR_CTRL_DATA_RATE_DRS(3) | XCVR_MISC_XCVR_CTRL_DEMOD_SEL(1) |
+            XCVR_MISC_XCVR_CTRL_LL_CFG_CAPT_DIS(0),
+        /* 65: XCVR_PLL_DIG->CHAN_MAP */
+        XCVR_FOLDED_CHAN_MAP | XCVR_PLL_DIG_CHAN_MAP_BAND_SELECT(0),
+        /* 66: XCVR_PLL_DIG->CHAN_MAP_EXT */
+#if RF_OSC_26MHZ == 1
+        XCVR_FOLDED_CHAN_MAP_EXT | XCVR_PLL_DIG_CHAN_MAP_EXT_NUM_OFFSET(0x013B13B),
+#else
+        XCVR_FOLDED_CHAN_MAP_EXT | XCVR_PLL_DIG_CHAN_MAP_EXT_NUM_OFFSET(0x0100000),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 67: XCVR_PLL_DIG->DATA_RATE_OVRD_CTRL1 */
+        XCVR_FOLDED_DATA_RATE_OVRD_CTRL1,
+        /* 68: XCVR_PLL_DIG->DATA_RATE_OVRD_CTRL2 */
+#if RF_OSC_26MHZ == 1
+        XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL2_NUM_OFFSET_CFG1(0x013B13B),
+#else
+        XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL2_NUM_OFFSET_CFG1(0x0100000),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 69: XCVR_PLL_DIG->DELAY_MATCH */
+        XCVR_FOLDED_DELAY_MATCH | XCVR_PLL_DIG_DELAY_MATCH_HPM_INTEGER_DELAY(0x04) |
+            XCVR_PLL_DIG_DELAY_MATCH_LPM_SDM_DELAY(0x03),
+        /* 70: XCVR_PLL_DIG->HPMCAL_CTRL */
+        XCVR_FOLDED_HPMCAL_CTRL | XCVR_PLL_DIG_HPMCAL_CTRL_HPM_CAL_ARRAY_SIZE(0),
+        /* 71: XCVR_PLL_DIG->HPM_BUMP */
+        XCVR_FOLDED_HPM_BUMP | XCVR_PLL_DIG_HPM_BUMP_HPM_VCM_CAL(2) | XCVR_PLL_DIG_HPM_BUMP_HPM_VCM_TX(2),
+        /* 72: XCVR_PLL_DIG->HPM_CAL_TIMING */
+        XCVR_FOLDED_HPM_CAL_TIMING,
+        /* 73: XCVR_PLL_DIG->HPM_CTRL */
+        XCVR_FOLDED_HPM_CTRL,
+        /* 74: XCVR_PLL_DIG->HPM_SDM_RES */
+        XCVR_FOLDED_HPM_SDM_RES | XCVR_PLL_DIG_HPM_SDM_RES_HPM_COUNT_ADJUST(0x02),
+        /* 75: XCVR_PLL_DIG->LOCK_DETECT */
+        XCVR_FOLDED_LOCK_DETECT,
+        /* 76: XCVR_PLL_DIG->LPM_CTRL */
+        XCVR_FOLDED_LPM_CTRL,
+        /* 77: XCVR_PLL_DIG->LPM_SDM_CTRL1 */
+        XCVR_FOLDED_LPM_SDM_CTRL1,
+        /* 78: XCVR_PLL_DIG->MOD_CTRL */
+        XCVR_FOLDED_MOD_CTRL,
+        /* 79: XCVR_PLL_DIG->PLL_DATARATE_CTRL */
+        XCVR_FOLDED_PLL_DATARATE_CTRL,
+        /* 80: XCVR_PLL_DIG->TUNING_CAP_RX_CTRL */
+        XCVR_FOLDED_TUNING_CAP_RX_CTRL,
+        /* 81: XCVR_PLL_DIG->TUNING_CAP_TX_CTRL */
+        XCVR_FOLDED_TUNING_CAP_TX_CTRL,
+        /* 82: XCVR_RX_DIG->ACQ_FILT_0_3 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x01) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x05) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x08) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x07),
+#else
+        XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x02) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x00) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x79) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x79),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 83: XCVR_RX_DIG->ACQ_FILT_0_3_DRS */
+        XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H0(0x00) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H1(0x00) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H2(0x00) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H3(0x00),
+        /* 84: XCVR_RX_DIG->ACQ_FILT_10_11 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x068) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x088),
+#else
+        XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x06B) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x0D1),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 85: XCVR_RX_DIG->ACQ_FILT_10_11_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x06B) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x0A6),
+#else
+        XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x03B) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x104),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 86: XCVR_RX_DIG->ACQ_FILT_4_7 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x7E) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x6F) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_H6(0xE5) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0xEA),
+#else
+        XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x07) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x18) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_H6(0x0E) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0xE3),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 87: XCVR_RX_DIG->ACQ_FILT_4_7_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x03) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x01) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0xF6) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0xE7),
+#else
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x7F) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x7A) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0x07) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0x16),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 88: XCVR_RX_DIG->ACQ_FILT_8_9 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x006) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x036),
+#else
+        XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x1C8) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x1F7),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 89: XCVR_RX_DIG->ACQ_FILT_8_9_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x1EF) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x01E),
+#else
+        XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x1E9) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x1C1),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 90: XCVR_RX_DIG->AGC_CTRL */
+        XCVR_FOLDED_AGC_CTRL,
+        /* 91: XCVR_RX_DIG->AGC_CTRL_STAT */
+        XCVR_FOLDED_AGC_CTRL_STAT,
+        /* 92: XCVR_RX_DIG->AGC_IDX0_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX0_GAIN_CFG,
+        /* 93: XCVR_RX_DIG->AGC_IDX0_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX0_GAIN_VAL,
+        /* 94: XCVR_RX_DIG->AGC_IDX0_THR */
+        XCVR_FOLDED_AGC_IDX0_THR,
+        /* 95: XCVR_RX_DIG->AGC_IDX10_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX10_GAIN_CFG,
+        /* 96: XCVR_RX_DIG->AGC_IDX10_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX10_GAIN_VAL,
+        /* 97: XCVR_RX_DIG->AGC_IDX10_THR */
+        XCVR_FOLDED_AGC_IDX10_THR,
+        /* 98: XCVR_RX_DIG->AGC_IDX11_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX11_GAIN_CFG | XCVR_RX_DIG_AGC_IDX11_GAIN_CFG_MAG_THR_11_DRS_OFS(0x00) |
+            XCVR_RX_DIG_AGC_IDX11_GAIN_CFG_MAG_THR_HI_11_DRS_OFS(0x00),
+        /* 99: XCVR_RX_DIG->AGC_IDX11_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX11_GAIN_VAL | XCVR_RX_DIG_AGC_IDX11_GAIN_VAL_MAG_THR_11(0x000) |
+            XCVR_RX_DIG_AGC_IDX11_GAIN_VAL_MAG_THR_HI_11(0x000),
+        /* 100: XCVR_RX_DIG->AGC_IDX11_THR */
+        XCVR_FOLDED_AGC_IDX11_THR,
+        /* 101: XCVR_RX_DIG->AGC_IDX1_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX1_GAIN_CFG,
+        /* 102: XCVR_RX_DIG->AGC_IDX1_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX1_GAIN_VAL,
+        /* 103: XCVR_RX_DIG->AGC_IDX1_THR */
+        XCVR_FOLDED_AGC_IDX1_THR,
+        /* 104: XCVR_RX_DIG->AGC_IDX2_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX2_GAIN_CFG,
+        /* 105: XCVR_RX_DIG->AGC_IDX2_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX2_GAIN_VAL,
+        /* 106: XCVR_RX_DIG->AGC_IDX2_THR */
+        XCVR_FOLDED_AGC_IDX2_THR,
+        /* 107: XCVR_RX_DIG->AGC_IDX3_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX3_GAIN_CFG,
+        /* 108: XCVR_RX_DIG->AGC_IDX3_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX3_GAIN_VAL,
+        /* 109: XCVR_RX_DIG->AGC_IDX3_THR */
+        XCVR_FOLDED_AGC_IDX3_THR,
+        /* 110: XCVR_RX_DIG->AGC_IDX4_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX4_GAIN_CFG,
+        /* 111: XCVR_RX_DIG->AGC_IDX4_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX4_GAIN_VAL,
+        /* 112: XCVR_RX_DIG->AGC_IDX4_THR */
+        XCVR_FOLDED_AGC_IDX4_THR,
+        /* 113: XCVR_RX_DIG->AGC_IDX5_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX5_GAIN_CFG,
+        /* 114: XCVR_RX_DIG->AGC_IDX5_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX5_GAIN_VAL,
+        /* 115: XCVR_RX_DIG->AGC_IDX5_THR */
+        XCVR_FOLDED_AGC_IDX5_THR,
+        /* 116: XCVR_RX_DIG->AGC_IDX6_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX6_GAIN_CFG,
+        /* 117: XCVR_RX_DIG->AGC_IDX6_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX6_GAIN_VAL,
+        /* 118: XCVR_RX_DIG->AGC_IDX6_THR */
+        XCVR_FOLDED_AGC_IDX6_THR,
+        /* 119: XCVR_RX_DIG->AGC_IDX7_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX7_GAIN_CFG,
+        /* 120: XCVR_RX_DIG->AGC_IDX7_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX7_GAIN_VAL,
+        /* 121: XCVR_RX_DIG->AGC_IDX7_THR */
+        XCVR_FOLDED_AGC_IDX7_THR,
+        /* 122: XCVR_RX_DIG->AGC_IDX8_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX8_GAIN_CFG,
+        /* 123: XCVR_RX_DIG->AGC_IDX8_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX8_GAIN_VAL,
+        /* 124: XCVR_RX_DIG->AGC_IDX8_THR */
+        XCVR_FOLDED_AGC_IDX8_THR,
+        /* 125: XCVR_RX_DIG->AGC_IDX9_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX9_GAIN_CFG,
+        /* 126: XCVR_RX_DIG->AGC_IDX9_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX9_GAIN_VAL,
+        /* 127: XCVR_RX_DIG->AGC_IDX9_THR */
+        XCVR_FOLDED_AGC_IDX9_THR,
+        /* 128: XCVR_RX_DIG->AGC_MIS_GAIN_CFG */
+        XCVR_FOLDED_AGC_MIS_GAIN_CFG,
+        /* 129: XCVR_RX_DIG->AGC_THR_FAST */
+        XCVR_FOLDED_AGC_THR_FAST,
+        /* 130: XCVR_RX_DIG->AGC_THR_FAST_DRS */
+        XCVR_FOLDED_AGC_THR_FAST_DRS,
+        /* 131: XCVR_RX_DIG->AGC_THR_MIS */
+        XCVR_FOLDED_AGC_THR_MIS,
+        /* 132: XCVR_RX_DIG->AGC_TIMING0 */
+        XCVR_FOLDED_AGC_TIMING0 | XCVR_RX_DIG_AGC_TIMING0_AGC_GAIN_STEP_WAIT(0x10),
+        /* 133: XCVR_RX_DIG->AGC_TIMING0_DRS */
+        XCVR_FOLDED_AGC_TIMING0_DRS | XCVR_RX_DIG_AGC_TIMING0_DRS_AGC_GAIN_STEP_WAIT(0x10),
+        /* 134: XCVR_RX_DIG->AGC_TIMING1 */
+        XCVR_FOLDED_AGC_TIMING1 | XCVR_RX_DIG_AGC_TIMING1_AGC_FREEZE_TIMEOUT(0x0A) |
+            XCVR_RX_DIG_AGC_TIMING1_AGC_HOLD_TIMEOUT(0x08),
+        /* 135: XCVR_RX_DIG->AGC_TIMING1_DRS */
+        XCVR_RX_DIG_AGC_TIMING1_DRS_AGC_FREEZE_TIMEOUT(0x0A) | XCVR_RX_DIG_AGC_TIMING1_DRS_AGC_HOLD_TIMEOUT(0x08),
+        /* 136: XCVR_RX_DIG->AGC_TIMING2 */
+        XCVR_FOLDED_AGC_TIMING2 | XCVR_RX_DIG_AGC_TIMING2_AGC_UNFREEZE_FEAT_TIMEOUT(0x000) |
+            XCVR_RX_DIG_AGC_TIMING2_AGC_UNHOLD_FEAT_TIMEOUT(0x000),
+        /* 137: XCVR_RX_DIG->AGC_TIMING2_DRS */
+        XCVR_RX_DIG_AGC_TIMING2_DRS_AGC_UNFREEZE_FEAT_TIMEOUT(0x000) |
+            XCVR_RX_DIG_AGC_TIMING2_DRS_AGC_UNHOLD_FEAT_TIMEOUT(0x000),
+        /* 138: XCVR_RX_DIG->CTRL0 */
+#if RF_OSC_26MHZ == 1
+        XCVR_FOLDED_CTRL0 | XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(2) |
+            XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x027) |
+            XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(1) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#else
+        XCVR_FOLDED_CTRL0 | XCVR_RX_DIG_CTRL0_CIC_ORDER(1) | XCVR_RX_DIG_CTRL0_CIC_RATE(3) |
+            XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x020) |
+            XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(1) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 139: XCVR_RX_DIG->CTRL0_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(4) |
+            XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x027),
+#else
+        XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(1) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(5) |
+            XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x020),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 140: XCVR_RX_DIG->CTRL1 */
+        XCVR_FOLDED_CTRL1,
+        /* 141: XCVR_RX_DIG->DCOC_CTRL0 */
+        XCVR_FOLDED_DCOC_CTRL0 | XCVR_RX_DIG_DCOC_CTRL0_DCOC_DAC_ORDER(1) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFII(0x6) |
+            XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFIIP(1) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFQQ(0x5) |
+            XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFQQP(1),
+        /* 142: XCVR_RX_DIG->DCOC_CTRL0_DRS */
+        XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFII(6) | XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFIIP(1) |
+            XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFQQ(5) | XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFQQP(1),
+        /* 143: XCVR_RX_DIG->DCOC_CTRL1 */
+        XCVR_FOLDED_DCOC_CTRL1,
+        /* 144: XCVR_RX_DIG->DEMOD_FILT_0_1 */
+        XCVR_RX_DIG_DEMOD_FILT_0_1_H0(0x1FE) | XCVR_RX_DIG_DEMOD_FILT_0_1_H1(0x005),
+        /* 145: XCVR_RX_DIG->DEMOD_FILT_0_1_DRS */
+        XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H0(0x1FE) | XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H1(0x001),
+        /* 146: XCVR_RX_DIG->DEMOD_FILT_2_4 */
+        XCVR_RX_DIG_DEMOD_FILT_2_4_H2(0x02E) | XCVR_RX_DIG_DEMOD_FILT_2_4_H3(0x07C) |
+            XCVR_RX_DIG_DEMOD_FILT_2_4_H4(0x0A6),
+        /* 147: XCVR_RX_DIG->DEMOD_FILT_2_4_DRS */
+        XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H2(0x02A) | XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H3(0x07E) |
+            XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H4(0x0AE),
+        /* 148: XCVR_RX_DIG->NB_RSSI_CTRL0 */
+        XCVR_FOLDED_NB_RSSI_CTRL0,
+        /* 149: XCVR_RX_DIG->NB_RSSI_CTRL1 */
+        XCVR_FOLDED_NB_RSSI_CTRL1,
+        /* 150: XCVR_RX_DIG->RCCAL_CTRL0 */
+        XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE(2) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE_DRS(4) |
+            XCVR_RX_DIG_RCCAL_CTRL0_CBPF_CCODE_OFFSET(0x00) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE(1) |
+            XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE_DRS(1) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CMPOUT_INV(0) |
+            XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CODE_OFFSET(0x0) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_SMPL_DLY(0),
+        /* 151: XCVR_RX_DIG->RSSI_GLOBAL_CTRL */
+        XCVR_FOLDED_RSSI_GLOBAL_CTRL | XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_CCA1_ED_EN(0),
+        /* 152: XCVR_RX_DIG->WB_RSSI_CTRL */
+        XCVR_FOLDED_WB_RSSI_CTRL,
+        /* 153: XCVR_TSM->CTRL */
+        XCVR_FOLDED_CTRL,
+        /* 154: XCVR_TSM->END_OF_SEQ */
+        XCVR_FOLDED_END_OF_SEQ,
+        /* 155: XCVR_TSM->FAST_CTRL1 */
+        XCVR_FOLDED_FAST_CTRL1,
+        /* 156: XCVR_TSM->FAST_CTRL2 */
+        XCVR_FOLDED_FAST_CTRL2,
+        /* 157: XCVR_TSM->FAST_CTRL3 */
+        XCVR_FOLDED_FAST_CTRL3,
+        /* 158: XCVR_TSM->RECYCLE_COUNT */
+        XCVR_FOLDED_RECYCLE_COUNT,
+        /* 159: XCVR_TSM->TIMING00 */
+        XCVR_FOLDED_TIMING00,
+        /* 160: XCVR_TSM->TIMING01 */
+        XCVR_FOLDED_TIMING01,
+        /* 161: XCVR_TSM->TIMING02 */
+        XCVR_FOLDED_TIMING02,
+        /* 162: XCVR_TSM->TIMING03 */
+        XCVR_FOLDED_TIMING03,
+        /* 163: XCVR_TSM->TIMING04 */
+        XCVR_FOLDED_TIMING04,
+        /* 164: XCVR_TSM->TIMING05 */
+        XCVR_FOLDED_TIMING05,
+        /* 165: XCVR_TSM->TIMING06 */
+        XCVR_FOLDED_TIMING06,
+        /* 166: XCVR_TSM->TIMING07 */
+        XCVR_FOLDED_TIMING07,
+        /* 167: XCVR_TSM->TIMING08 */
+        XCVR_FOLDED_TIMING08,
+        /* 168: XCVR_TSM->TIMING09 */
+        XCVR_FOLDED_TIMING09,
+        /* 169: XCVR_TSM->TIMING10 */
+        XCVR_FOLDED_TIMING10,
+        /* 170: XCVR_TSM->TIMING11 */
+        XCVR_FOLDED_TIMING11,
+        /* 171: XCVR_TSM->TIMING12 */
+        XCVR_FOLDED_TIMING12,
+        /* 172: XCVR_TSM->TIMING13 */
+        XCVR_FOLDED_TIMING13,
+        /* 173: XCVR_TSM->TIMING14 */
+        XCVR_FOLDED_TIMING14,
+        /* 174: XCVR_TSM->TIMING15 */
+        XCVR_FOLDED_TIMING15,
+        /* 175: XCVR_TSM->TIMING16 */
+        XCVR_FOLDED_TIMING16,
+        /* 176: XCVR_TSM->TIMING17 */
+        XCVR_FOLDED_TIMING17,
+        /* 177: XCVR_TSM->TIMING18 */
+        XCVR_FOLDED_TIMING18,
+        /* 178: XCVR_TSM->TIMING19 */
+        XCVR_FOLDED_TIMING19,
+        /* 179: XCVR_TSM->TIMING20 */
+        XCVR_FOLDED_TIMING20,
+        /* 180: XCVR_TSM->TIMING21 */
+        XCVR_FOLDED_TIMING21,
+        /* 181: XCVR_TSM->TIMING22 */
+        XCVR_FOLDED_TIMING22,
+        /* 182: XCVR_TSM->TIMING23 */
+        XCVR_FOLDED_TIMING23,
+        /* 183: XCVR_TSM->TIMING24 */
+        XCVR_FOLDED_TIMING24,
+        /* 184: XCVR_TSM->TIMING25 */
+        XCVR_FOLDED_TIMING25,
+        /* 185: XCVR_TSM->TIMING26 */
+        XCVR_FOLDED_TIMING26,
+        /* 186: XCVR_TSM->TIMING27 */
+        XCVR_FOLDED_TIMING27,
+        /* 187: XCVR_TSM->TIMING28 */
+        XCVR_FOLDED_TIMING28,
+        /* 188: XCVR_TSM->TIMING29 */
+        XCVR_FOLDED_TIMING29,
+        /* 189: XCVR_TSM->TIMING30 */
+        XCVR_FOLDED_TIMING30,
+        /* 190: XCVR_TSM->TIMING31 */
+        XCVR_FOLDED_TIMING31,
+        /* 191: XCVR_TSM->TIMING32 */
+        XCVR_FOLDED_TIMING32,
+        /* 192: XCVR_TSM->TIMING33 */
+        XCVR_FOLDED_TIMING33,
+        /* 193: XCVR_TSM->TIMING34 */
+        XCVR_FOLDED_TIMING34,
+        /* 194: XCVR_TSM->TIMING35 */
+        XCVR_FOLDED_TIMING35,
+        /* 195: XCVR_TSM->TIMING36 */
+        XCVR_FOLDED_TIMING36,
+        /* 196: XCVR_TSM->TIMING37 */
+        XCVR_FOLDED_TIMING37,
+        /* 197: XCVR_TSM->TIMING38 */
+        XCVR_FOLDED_TIMING38,
+        /* 198: XCVR_TSM->TIMING39 */
+        XCVR_FOLDED_TIMING39,
+        /* 199: XCVR_TSM->TIMING40 */
+        XCVR_FOLDED_TIMING40,
+        /* 200: XCVR_TSM->TIMING41 */
+        XCVR_FOLDED_TIMING41,
+        /* 201: XCVR_TSM->TIMING42 */
+        XCVR_FOLDED_TIMING42,
+        /* 202: XCVR_TSM->TIMING43 */
+        XCVR_FOLDED_TIMING43,
+        /* 203: XCVR_TSM->TIMING44 */
+        XCVR_FOLDED_TIMING44,
+        /* 204: XCVR_TSM->TIMING45 */
+        XCVR_FOLDED_TIMING45,
+        /* 205: XCVR_TSM->TIMING46 */
+        XCVR_FOLDED_TIMING46,
+        /* 206: XCVR_TSM->TIMING47 */
+        XCVR_FOLDED_TIMING47,
+        /* 207: XCVR_TSM->TIMING48 */
+        XCVR_FOLDED_TIMING48,
+        /* 208: XCVR_TSM->TIMING49 */
+        XCVR_FOLDED_TIMING49,
+        /* 209: XCVR_TSM->TIMING50 */
+        XCVR_FOLDED_TIMING50,
+        /* 210: XCVR_TSM->TIMING51 */
+        XCVR_FOLDED_TIMING51,
+        /* 211: XCVR_TSM->TIMING52 */
+        XCVR_FOLDED_TIMING52,
+        /* 212: XCVR_TSM->WU_LATENCY */
+        XCVR_FOLDED_WU_LATENCY,
+        /* 213: XCVR_TX_DIG->DATARATE_CONFIG_FILTER_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(3) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(2) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(1),
+#else
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(4) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(3) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(2) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(1),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 214: XCVR_TX_DIG->DATARATE_CONFIG_FSK_CTRL */
+        XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV0(0x0000) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV1(0x0000),
+        /* 215: XCVR_TX_DIG->DATARATE_CONFIG_GFSK_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x013D),
+#else
+        XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x0101),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 216: XCVR_TX_DIG->DATA_PADDING_CTRL */
+        XCVR_FOLDED_DATA_PADDING_CTRL | XCVR_TX_DIG_DATA_PADDING_CTRL_DATA_PADDING_SEL(0) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_PAD_DLY(0) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_PAD_DLY_EN(1),
+        /* 217: XCVR_TX_DIG->DATA_PADDING_CTRL_1 */
+        XCVR_FOLDED_DATA_PADDING_CTRL_1 | XCVR_TX_DIG_DATA_PADDING_CTRL_1_RAMP_UP_DLY(0x04) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_1_TX_DATA_FLUSH_DLY(0x04),
+        /* 218: XCVR_TX_DIG->DATA_PADDING_CTRL_2 */
+        XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_MFDEV(0x0000) | XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_PFDEV(0x0000),
+        /* 219: XCVR_TX_DIG->FSK_CTRL */
+        XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_0(0x0000) | XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_1(0x0000),
+        /* 220: XCVR_TX_DIG->GFSK_COEFF_0_1 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_0(0x048) | XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_1(0x059),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_0(0x019) | XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_1(0x02C),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 221: XCVR_TX_DIG->GFSK_COEFF_2_3 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_2(0x06B) | XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_3(0x07D),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_2(0x046) | XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_3(0x069),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 222: XCVR_TX_DIG->GFSK_COEFF_4_5 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_4(0x08D) | XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_5(0x09A),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_4(0x091) | XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_5(0x0B8),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 223: XCVR_TX_DIG->GFSK_COEFF_6_7 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_6(0x0A4) | XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_7(0x0A9),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_6(0x0D8) | XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_7(0x0EA),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 224: XCVR_TX_DIG->GFSK_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(1) |
+            XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x13B),
+#else
+        XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(1) |
+            XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x100),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 225: XCVR_TX_DIG->IMAGE_FILTER_CTRL */
+        XCVR_FOLDED_IMAGE_FILTER_CTRL | XCVR_TX_DIG_IMAGE_FILTER_CTRL_IMAGE_FILTER_OVRD_EN(0),
+        /* 226: XCVR_TX_DIG->PA_CTRL */
+        XCVR_FOLDED_PA_CTRL | XCVR_TX_DIG_PA_CTRL_PA_RAMP_SEL(1),
+        /* 227: XCVR_TX_DIG->PA_RAMP_TBL0 */
+        XCVR_FOLDED_PA_RAMP_TBL0,
+        /* 228: XCVR_TX_DIG->PA_RAMP_TBL1 */
+        XCVR_FOLDED_PA_RAMP_TBL1,
+        /* 229: XCVR_TX_DIG->PA_RAMP_TBL2 */
+        XCVR_FOLDED_PA_RAMP_TBL2,
+        /* 230: XCVR_TX_DIG->PA_RAMP_TBL3 */
+        XCVR_FOLDED_PA_RAMP_TBL3,
+        /* 231: XCVR_TX_DIG->SWITCH_TX_CTRL */
+        XCVR_FOLDED_SWITCH_TX_CTRL,
+        /* 232: XCVR_TX_DIG->TXDIG_CTRL */
+        XCVR_FOLDED_TXDIG_CTRL | XCVR_TX_DIG_TXDIG_CTRL_DATA_STREAM_SEL(0) | XCVR_TX_DIG_TXDIG_CTRL_MODULATOR_SEL(0) |
+            XCVR_TX_DIG_TXDIG_CTRL_PFC_EN(0),
+    },
+};
+
+const xcvr_folded_config_t xcvr_gfsk_bt_0p5_h_0p32_1mbps_folded_config = {
+    .config     = &xcvr_gfsk_bt_0p5_h_0p32_1mbps_full_config,
+    .reg_values = {
+        /* 0: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x0D) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x0A) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x08) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x05) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x03),
+        /* 1: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3D) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x3B) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x38) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x36),
+        /* 2: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x33) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x31) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x2E),
+        /* 3: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x0D) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x0A) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x08) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x05) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x03),
+        /* 4: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3D) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x3B) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x38) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x3B),
+        /* 5: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x3D) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x03),
+        /* 6: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x08) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x05) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x03) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3D),
+        /* 7: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x03) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x05) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x08) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x05),
+        /* 8: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x03) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x3D),
+        /* 9: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x08) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x05) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x03) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3D),
+        /* 10: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x03) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x05) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x08) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x0A),
+        /* 11: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x0D) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x0F) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x12),
+        /* 12: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x38) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x3B) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x3D) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x03),
+        /* 13: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3D) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x3B) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x38) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x36),
+        /* 14: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x33) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x31) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x2E),
+        /* 15: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x38) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x3B) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x3D) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x03),
+        /* 16: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3D) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x3B) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x38) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x3B),
+        /* 17: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x3D) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x03),
+        /* 18: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x33) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x36) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x38) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x3B) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3D),
+        /* 19: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x03) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x05) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x08) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x05),
+        /* 20: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x03) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x3D),
+        /* 21: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x33) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x36) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x38) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x3B) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3D),
+        /* 22: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x03) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x05) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x08) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x0A),
+        /* 23: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x0D) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x0F) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x12),
+        /* 24: GEN4PHY->DMD_CTRL0 */
+        XCVR_FOLDED_DMD_CTRL0,
+        /* 25: GEN4PHY->DMD_CTRL1 */
+        XCVR_FOLDED_DMD_CTRL1,
+        /* 26: GEN4PHY->FSK_CFG0 */
+        XCVR_FOLDED_FSK_CFG0 | GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_1M(0x14) |
+            GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_2M(0x17) |
+            GEN4PHY_FSK_CFG0_MSK2FSK_SEED(0) | GEN4PHY_FSK_CFG0_MSK_EN(0),
+        /* 27: GEN4PHY->FSK_CFG1 */
+        GEN4PHY_FSK_CFG1_OVERH(0x014) | GEN4PHY_FSK_CFG1_OVERH_INV(0x190) | GEN4PHY_FSK_CFG1_SYNCTSCALE(0xF),
+        /* 28: GEN4PHY->FSK_CFG2 */
+        XCVR_FOLDED_FSK_CFG2,
+        /* 29: GEN4PHY->FSK_FAD_CFG */
+        XCVR_FOLDED_FSK_FAD_CFG,
+        /* 30: GEN4PHY->FSK_FAD_CTRL */
+        XCVR_FOLDED_FSK_FAD_CTRL,
+        /* 31: GEN4PHY->FSK_PD_CFG0 */
+        GEN4PHY_FSK_PD_CFG0_PD_IIR_ALPHA(0xFF) | GEN4PHY_FSK_PD_CFG0_PREAMBLE_T_SCALE(0xC),
+        /* 32: GEN4PHY->FSK_PD_CFG1 */
+        GEN4PHY_FSK_PD_CFG1_PREAMBLE_PATTERN(0x55),
+        /* 33: GEN4PHY->FSK_PD_CFG2 */
+        GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_1M(0xF6) | GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_2M(0xF6),
+        /* 34: GEN4PHY->FSK_PD_PH[0] */
+        GEN4PHY_FSK_PD_PH_REF0(0x02) | GEN4PHY_FSK_PD_PH_REF1(0x03) | GEN4PHY_FSK_PD_PH_REF2(0x02) |
+            GEN4PHY_FSK_PD_PH_REF3(0x00),
+        /* 35: GEN4PHY->FSK_PD_PH[1] */
+        GEN4PHY_FSK_PD_PH_REF0(0x3E) | GEN4PHY_FSK_PD_PH_REF1(0x3D) | GEN4PHY_FSK_PD_PH_REF2(0x3E) |
+            GEN4PHY_FSK_PD_PH_REF3(0x00),
+        /* 36: GEN4PHY->FSK_PT */
+        XCVR_FOLDED_FSK_PT | GEN4PHY_FSK_PT_AGC_TIMEOUT(0x0048),
+        /* 37: GEN4PHY->LR_AA_CFG */
+        GEN4PHY_LR_AA_CFG_AA_COR_THRESH(0x00) | GEN4PHY_LR_AA_CFG_AA_HAM_THRESH(0x00) |
+            GEN4PHY_LR_AA_CFG_AA_LR_CORR_GAIN(0x00) | GEN4PHY_LR_AA_CFG_ACCESS_ADDR_HAM(0x00),
+        /* 38: GEN4PHY->LR_PD_CFG */
+        GEN4PHY_LR_PD_CFG_CORR_TH(0x00) | GEN4PHY_LR_PD_CFG_FREQ_TH(0x00) | GEN4PHY_LR_PD_CFG_NO_PEAKS(0),
+        /* 39: GEN4PHY->LR_PD_PH[0] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 40: GEN4PHY->LR_PD_PH[1] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 41: GEN4PHY->LR_PD_PH[2] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 42: GEN4PHY->LR_PD_PH[3] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 43: GEN4PHY->MISC */
+        XCVR_FOLDED_MISC,
+        /* 44: GEN4PHY->PREPHY_MISC */
+        XCVR_FOLDED_PREPHY_MISC,
+        /* 45: GEN4PHY->RTT_CTRL */
+        XCVR_FOLDED_RTT_CTRL,
+        /* 46: GEN4PHY->RTT_REF */
+        GEN4PHY_RTT_REF_FM_REF_010(0x48) | GEN4PHY_RTT_REF_FM_REF_110(0x63) | GEN4PHY_RTT_REF_FM_REF_111(0x80),
+        /* 47: GEN4PHY->SM_CFG */
+        XCVR_FOLDED_SM_CFG | GEN4PHY_SM_CFG_AA_TIMEOUT_UNCODED(0x060),
+        /* 48: RADIO_CTRL->LL_CTRL */
+        RADIO_CTRL_LL_CTRL_ACTIVE_LL(2),
+        /* 49: XCVR_ANALOG->LDO_0 */
+        XCVR_FOLDED_LDO_0,
+        /* 50: XCVR_ANALOG->LDO_1 */
+        XCVR_FOLDED_LDO_1,
+        /* 51: XCVR_ANALOG->PLL */
+        XCVR_FOLDED_PLL,
+        /* 52: XCVR_ANALOG->RX_0 */
+        XCVR_FOLDED_RX_0,
+        /* 53: XCVR_ANALOG->RX_1 */
+        XCVR_FOLDED_RX_1,
+        /* 54: XCVR_ANALOG->TX_DAC_PA */
+        XCVR_FOLDED_TX_DAC_PA | XCVR_ANALOG_TX_DAC_PA_DAC_TRIM_CFBK_DRS(0),
+        /* 55: XCVR_ANALOG->XO_DIST */
+        XCVR_FOLDED_XO_DIST,
+        /* 56: XCVR_MISC->IPS_FO_ADDR[0] */
+        XCVR_MISC_IPS_FO_ADDR_ADDR(0x370) | XCVR_MISC_IPS_FO_ADDR_ENTRY_RX(0) | XCVR_MISC_IPS_FO_ADDR_ENTRY_TX(0),
+        /* 57: XCVR_MISC->IPS_FO_ADDR[1] */
+        XCVR_MISC_IPS_FO_ADDR_ADDR(0x02C) | XCVR_MISC_IPS_FO_ADDR_ENTRY_RX(0) | XCVR_MISC_IPS_FO_ADDR_ENTRY_TX(0),
+        /* 58: XCVR_MISC->IPS_FO_DRS0_DATA[0] */
+        XCVR_MISC_IPS_FO_DRS0_DATA_DRS0_DATA(0x00000000),
+        /* 59: XCVR_MISC->IPS_FO_DRS0_DATA[1] */
+        XCVR_MISC_IPS_FO_DRS0_DATA_DRS0_DATA(0x00000000),
+        /* 60: XCVR_MISC->IPS_FO_DRS1_DATA[0] */
+        XCVR_MISC_IPS_FO_DRS1_DATA_DRS1_DATA(0x00000000),
+        /* 61: XCVR_MISC->IPS_FO_DRS1_DATA[1] */
+        XCVR_MISC_IPS_FO_DRS1_DATA_DRS1_DATA(0x00000000),
+        /* 62: XCVR_MISC->LDO_TRIM_0 */
+        XCVR_FOLDED_LDO_TRIM_0,
+        /* 63: XCVR_MISC->LDO_TRIM_1 */
+        XCVR_FOLDED_LDO_TRIM_1,
+        /* 64: XCVR_MISC->XCVR_CTRL */
+        XCVR_FOLDED_XCVR_CTRL | XCVR_MISC_XCVR_CTRL_DATA_RATE_DRS(0) | XCVR_MISC_XCVR_CTRL_DEMOD_SEL(1) |
+            XCVR_MISC_XCVR_CTRL_LL_CFG_CAPT_DIS(0),
+        /* 65: XCVR_PLL_DIG->CHAN_MAP */
+        XCVR_FOLDED_CHAN_MAP | XCVR_PLL_DIG_CHAN_MAP_BAND_SELECT(0),
+        /* 66: XCVR_PLL_DIG->CHAN_MAP_EXT */
+#if RF_OSC_26MHZ == 1
+        XCVR_FOLDED_CHAN_MAP_EXT | XCVR_PLL_DIG_CHAN_MAP_EXT_NUM_OFFSET(0x013B13B),
+#else
+        XCVR_FOLDED_CHAN_MAP_EXT | XCVR_PLL_DIG_CHAN_MAP_EXT_NUM_OFFSET(0x0100000),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 67: XCVR_PLL_DIG->DATA_RATE_OVRD_CTRL1 */
+        XCVR_FOLDED_DATA_RATE_OVRD_CTRL1,
+        /* 68: XCVR_PLL_DIG->DATA_RATE_OVRD_CTRL2 */
+#if RF_OSC_26MHZ == 1
+        XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL2_NUM_OFFSET_CFG1(0x01D89D9),
+#else
+        XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL2_NUM_OFFSET_CFG1(0x0180000),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 69: XCVR_PLL_DIG->DELAY_MATCH */
+        XCVR_FOLDED_DELAY_MATCH | XCVR_PLL_DIG_DELAY_MATCH_HPM_INTEGER_DELAY(0x04) |
+            XCVR_PLL_DIG_DELAY_MATCH_LPM_SDM_DELAY(0x03),
+        /* 70: XCVR_PLL_DIG->HPMCAL_CTRL */
+        XCVR_FOLDED_HPMCAL_CTRL | XCVR_PLL_DIG_HPMCAL_CTRL_HPM_CAL_ARRAY_SIZE(0),
+        /* 71: XCVR_PLL_DIG->HPM_BUMP */
+        XCVR_FOLDED_HPM_BUMP | XCVR_PLL_DIG_HPM_BUMP_HPM_VCM_CAL(2) | XCVR_PLL_DIG_HPM_BUMP_HPM_VCM_TX(2),
+        /* 72: XCVR_PLL_DIG->HPM_CAL_TIMING */
+        XCVR_FOLDED_HPM_CAL_TIMING,
+        /* 73: XCVR_PLL_DIG->HPM_CTRL */
+        XCVR_FOLDED_HPM_CTRL,
+        /* 74: XCVR_PLL_DIG->HPM_SDM_RES */
+        XCVR_FOLDED_HPM_SDM_RES | XCVR_PLL_DIG_HPM_SDM_RES_HPM_COUNT_ADJUST(0x02),
+        /* 75: XCVR_PLL_DIG->LOCK_DETECT */
+        XCVR_FOLDED_LOCK_DETECT,
+        /* 76: XCVR_PLL_DIG->LPM_CTRL */
+        XCVR_FOLDED_LPM_CTRL,
+        /* 77: XCVR_PLL_DIG->LPM_SDM_CTRL1 */
+        XCVR_FOLDED_LPM_SDM_CTRL1,
+        /* 78: XCVR_PLL_DIG->MOD_CTRL */
+        XCVR_FOLDED_MOD_CTRL,
+        /* 79: XCVR_PLL_DIG->PLL_DATARATE_CTRL */
+        XCVR_FOLDED_PLL_DATARATE_CTRL,
+        /* 80: XCVR_PLL_DIG->TUNING_CAP_RX_CTRL */
+        XCVR_FOLDED_TUNING_CAP_RX_CTRL,
+        /* 81: XCVR_PLL_DIG->TUNING_CAP_TX_CTRL */
+        XCVR_FOLDED_TUNING_CAP_TX_CTRL,
+        /* 82: XCVR_RX_DIG->ACQ_FILT_0_3 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x02) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x06) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x09) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x06),
+#else
+        XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x01) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x3D) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x78) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x7C),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 83: XCVR_RX_DIG->ACQ_FILT_0_3_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H0(0x03) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H1(0x04) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H2(0x01) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H3(0x7A),
+#else
+        XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H0(0x3E) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H1(0x3D) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H2(0x01) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H3(0x0A),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 84: XCVR_RX_DIG->ACQ_FILT_10_11 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x06B) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x08C),
+#else
+        XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x06F) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x0D2),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 85: XCVR_RX_DIG->ACQ_FILT_10_11_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x061) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x075),
+#else
+        XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x073) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x0B1),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 86: XCVR_RX_DIG->ACQ_FILT_4_7 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x7B) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x6B) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_H6(0xE1) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0xE8),
+#else
+        XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x0D) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x19) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_H6(0x07) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0xDB),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 87: XCVR_RX_DIG->ACQ_FILT_4_7_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x71) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x6B) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0xED) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0xFD),
+#else
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x10) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x05) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0xEB) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0xD6),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 88: XCVR_RX_DIG->ACQ_FILT_8_9 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x007) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x038),
+#else
+        XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x1C6) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x1FB),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 89: XCVR_RX_DIG->ACQ_FILT_8_9_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x01B) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x03F),
+#else
+        XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x1E2) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x01E),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 90: XCVR_RX_DIG->AGC_CTRL */
+        XCVR_FOLDED_AGC_CTRL,
+        /* 91: XCVR_RX_DIG->AGC_CTRL_STAT */
+        XCVR_FOLDED_AGC_CTRL_STAT,
+        /* 92: XCVR_RX_DIG->AGC_IDX0_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX0_GAIN_CFG,
+        /* 93: XCVR_RX_DIG->AGC_IDX0_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX0_GAIN_VAL,
+        /* 94: XCVR_RX_DIG->AGC_IDX0_THR */
+        XCVR_FOLDED_AGC_IDX0_THR,
+        /* 95: XCVR_RX_DIG->AGC_IDX10_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX10_GAIN_CFG,
+        /* 96: XCVR_RX_DIG->AGC_IDX10_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX10_GAIN_VAL,
+        /* 97: XCVR_RX_DIG->AGC_IDX10_THR */
+        XCVR_FOLDED_AGC_IDX10_THR,
+        /* 98: XCVR_RX_DIG->AGC_IDX11_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX11_GAIN_CFG | XCVR_RX_DIG_AGC_IDX11_GAIN_CFG_MAG_THR_11_DRS_OFS(0x00) |
+            XCVR_RX_DIG_AGC_IDX11_GAIN_CFG_MAG_THR_HI_11_DRS_OFS(0x00),
+        /* 99: XCVR_RX_DIG->AGC_IDX11_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX11_GAIN_VAL | XCVR_RX_DIG_AGC_IDX11_GAIN_VAL_MAG_THR_11(0x000) |
+            XCVR_RX_DIG_AGC_IDX11_GAIN_VAL_MAG_THR_HI_11(0x000),
+        /* 100: XCVR_RX_DIG->AGC_IDX11_THR */
+        XCVR_FOLDED_AGC_IDX11_THR,
+        /* 101: XCVR_RX_DIG->AGC_IDX1_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX1_GAIN_CFG,
+        /* 102: XCVR_RX_DIG->AGC_IDX1_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX1_GAIN_VAL,
+        /* 103: XCVR_RX_DIG->AGC_IDX1_THR */
+        XCVR_FOLDED_AGC_IDX1_THR,
+        /* 104: XCVR_RX_DIG->AGC_IDX2_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX2_GAIN_CFG,
+        /* 105: XCVR_RX_DIG->AGC_IDX2_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX2_GAIN_VAL,
+        /* 106: XCVR_RX_DIG->AGC_IDX2_THR */
+        XCVR_FOLDED_AGC_IDX2_THR,
+        /* 107: XCVR_RX_DIG->AGC_IDX3_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX3_GAIN_CFG,
+        /* 108: XCVR_RX_DIG->AGC_IDX3_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX3_GAIN_VAL,
+        /* 109: XCVR_RX_DIG->AGC_IDX3_THR */
+        XCVR_FOLDED_AGC_IDX3_THR,
+        /* 110: XCVR_RX_DIG->AGC_IDX4_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX4_GAIN_CFG,
+        /* 111: XCVR_RX_DIG->AGC_IDX4_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX4_GAIN_VAL,
+        /* 112: XCVR_RX_DIG->AGC_IDX4_THR */
+        XCVR_FOLDED_AGC_IDX4_THR,
+        /* 113: XCVR_RX_DIG->AGC_IDX5_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX5_GAIN_CFG,
+        /* 114: XCVR_RX_DIG->AGC_IDX5_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX5_GAIN_VAL,
+        /* 115: XCVR_RX_DIG->AGC_IDX5_THR */
+        XCVR_FOLDED_AGC_IDX5_THR,
+        /* 116: XCVR_RX_DIG->AGC_IDX6_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX6_GAIN_CFG,
+        /* 117: XCVR_RX_DIG->AGC_IDX6_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX6_GAIN_VAL,
+        /* 118: XCVR_RX_DIG->AGC_IDX6_THR */
+        XCVR_FOLDED_AGC_IDX6_THR,
+        /* 119: XCVR_RX_DIG->AGC_IDX7_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX7_GAIN_CFG,
+        /* 120: XCVR_RX_DIG->AGC_IDX7_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX7_GAIN_VAL,
+        /* 121: XCVR_RX_DIG->AGC_IDX7_THR */
+        XCVR_FOLDED_AGC_IDX7_THR,
+        /* 122: XCVR_RX_DIG->AGC_IDX8_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX8_GAIN_CFG,
+        /* 123: XCVR_RX_DIG->AGC_IDX8_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX8_GAIN_VAL,
+        /* 124: XCVR_RX_DIG->AGC_IDX8_THR */
+        XCVR_FOLDED_AGC_IDX8_THR,
+        /* 125: XCVR_RX_DIG->AGC_IDX9_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX9_GAIN_CFG,
+        /* 126: XCVR_RX_DIG->AGC_IDX9_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX9_GAIN_VAL,
+        /* 127: XCVR_RX_DIG->AGC_IDX9_THR */
+        XCVR_FOLDED_AGC_IDX9_THR,
+        /* 128: XCVR_RX_DIG->AGC_MIS_GAIN_CFG */
+        XCVR_FOLDED_AGC_MIS_GAIN_CFG,
+        /* 129: XCVR_RX_DIG->AGC_THR_FAST */
+        XCVR_FOLDED_AGC_THR_FAST,
+        /* 130: XCVR_RX_DIG->AGC_THR_FAST_DRS */
+        XCVR_FOLDED_AGC_THR_FAST_DRS,
+        /* 131: XCVR_RX_DIG->AGC_THR_MIS */
+        XCVR_FOLDED_AGC_THR_MIS,
+        /* 132: XCVR_RX_DIG->AGC_TIMING0 */
+        XCVR_FOLDED_AGC_TIMING0 | XCVR_RX_DIG_AGC_TIMING0_AGC_GAIN_STEP_WAIT(0x10),
+        /* 133: XCVR_RX_DIG->AGC_TIMING0_DRS */
+        XCVR_FOLDED_AGC_TIMING0_DRS | XCVR_RX_DIG_AGC_TIMING0_DRS_AGC_GAIN_STEP_WAIT(0x10),
+        /* 134: XCVR_RX_DIG->AGC_TIMING1 */
+        XCVR_FOLDED_AGC_TIMING1 | XCVR_RX_DIG_AGC_TIMING1_AGC_FREEZE_TIMEOUT(0x0A) |
+            XCVR_RX_DIG_AGC_TIMING1_AGC_HOLD_TIMEOUT(0x08),
+        /* 135: XCVR_RX_DIG->AGC_TIMING1_DRS */
+        XCVR_RX_DIG_AGC_TIMING1_DRS_AGC_FREEZE_TIMEOUT(0x0A) | XCVR_RX_DIG_AGC_TIMING1_DRS_AGC_HOLD_TIMEOUT(0x08),
+        /* 136: XCVR_RX_DIG->AGC_TIMING2 */
+        XCVR_FOLDED_AGC_TIMING2 | XCVR_RX_DIG_AGC_TIMING2_AGC_UNFREEZE_FEAT_TIMEOUT(0x000) |
+            XCVR_RX_DIG_AGC_TIMING2_AGC_UNHOLD_FEAT_TIMEOUT(0x000),
+        /* 137: XCVR_RX_DIG->AGC_TIMING2_DRS */
+        XCVR_RX_DIG_AGC_TIMING2_DRS_AGC_UNFREEZE_FEAT_TIMEOUT(0x000) |
+            XCVR_RX_DIG_AGC_TIMING2_DRS_AGC_UNHOLD_FEAT_TIMEOUT(0x000),
+        /* 138: XCVR_RX_DIG->CTRL0 */
+#if RF_OSC_26MHZ == 1
+        XCVR_FOLDED_CTRL0 | XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(2) |
+            XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x027) |
+            XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(0) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#else
+        XCVR_FOLDED_CTRL0 | XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(3) |
+            XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x020) |
+            XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(0) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 139: XCVR_RX_DIG->CTRL0_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(1) |
+            XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x03B),
+#else
+        XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(2) |
+            XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x030),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 140: XCVR_RX_DIG->CTRL1 */
+        XCVR_FOLDED_CTRL1,
+        /* 141: XCVR_RX_DIG->DCOC_CTRL0 */
+        XCVR_FOLDED_DCOC_CTRL0 | XCVR_RX_DIG_DCOC_CTRL0_DCOC_DAC_ORDER(1) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFII(0x6) |
+            XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFIIP(1) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFQQ(0x5) |
+            XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFQQP(1),
+        /* 142: XCVR_RX_DIG->DCOC_CTRL0_DRS */
+        XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFII(4) | XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFIIP(1) |
+            XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFQQ(1) | XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFQQP(0),
+        /* 143: XCVR_RX_DIG->DCOC_CTRL1 */
+        XCVR_FOLDED_DCOC_CTRL1,
+        /* 144: XCVR_RX_DIG->DEMOD_FILT_0_1 */
+        XCVR_RX_DIG_DEMOD_FILT_0_1_H0(0x1FE) | XCVR_RX_DIG_DEMOD_FILT_0_1_H1(0x003),
+        /* 145: XCVR_RX_DIG->DEMOD_FILT_0_1_DRS */
+        XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H0(0x1FE) | XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H1(0x005),
+        /* 146: XCVR_RX_DIG->DEMOD_FILT_2_4 */
+        XCVR_RX_DIG_DEMOD_FILT_2_4_H2(0x02D) | XCVR_RX_DIG_DEMOD_FILT_2_4_H3(0x07D) |
+            XCVR_RX_DIG_DEMOD_FILT_2_4_H4(0x0A9),
+        /* 147: XCVR_RX_DIG->DEMOD_FILT_2_4_DRS */
+        XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H2(0x030) | XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H3(0x07B) |
+            XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H4(0x0A3),
+        /* 148: XCVR_RX_DIG->NB_RSSI_CTRL0 */
+        XCVR_FOLDED_NB_RSSI_CTRL0,
+        /* 149: XCVR_RX_DIG->NB_RSSI_CTRL1 */
+        XCVR_FOLDED_NB_RSSI_CTRL1,
+        /* 150: XCVR_RX_DIG->RCCAL_CTRL0 */
+        XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE(2) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE_DRS(1) |
+            XCVR_RX_DIG_RCCAL_CTRL0_CBPF_CCODE_OFFSET(0x00) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE(1) |
+            XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE_DRS(0) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CMPOUT_INV(0) |
+            XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CODE_OFFSET(0x0) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_SMPL_DLY(0),
+        /* 151: XCVR_RX_DIG->RSSI_GLOBAL_CTRL */
+        XCVR_FOLDED_RSSI_GLOBAL_CTRL | XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_CCA1_ED_EN(0),
+        /* 152: XCVR_RX_DIG->WB_RSSI_CTRL */
+        XCVR_FOLDED_WB_RSSI_CTRL,
+        /* 153: XCVR_TSM->CTRL */
+        XCVR_FOLDED_CTRL,
+        /* 154: XCVR_TSM->END_OF_SEQ */
+        XCVR_FOLDED_END_OF_SEQ,
+        /* 155: XCVR_TSM->FAST_CTRL1 */
+        XCVR_FOLDED_FAST_CTRL1,
+        /* 156: XCVR_TSM->FAST_CTRL2 */
+        XCVR_FOLDED_FAST_CTRL2,
+        /* 157: XCVR_TSM->FAST_CTRL3 */
+        XCVR_FOLDED_FAST_CTRL3,
+        /* 158: XCVR_TSM->RECYCLE_COUNT */
+        XCVR_FOLDED_RECYCLE_COUNT,
+        /* 159: XCVR_TSM->TIMING00 */
+        XCVR_FOLDED_TIMING00,
+        /* 160: XCVR_TSM->TIMING01 */
+        XCVR_FOLDED_TIMING01,
+        /* 161: XCVR_TSM->TIMING02 */
+        XCVR_FOLDED_TIMING02,
+        /* 162: XCVR_TSM->TIMING03 */
+        XCVR_FOLDED_TIMING03,
+        /* 163: XCVR_TSM->TIMING04 */
+        XCVR_FOLDED_TIMING04,
+        /* 164: XCVR_TSM->TIMING05 */
+        XCVR_FOLDED_TIMING05,
+        /* 165: XCVR_TSM->TIMING06 */
+        XCVR_FOLDED_TIMING06,
+        /* 166: XCVR_TSM->TIMING07 */
+        XCVR_FOLDED_TIMING07,
+        /* 167: XCVR_TSM->TIMING08 */
+        XCVR_FOLDED_TIMING08,
+        /* 168: XCVR_TSM->TIMING09 */
+        XCVR_FOLDED_TIMING09,
+        /* 169: XCVR_TSM->TIMING10 */
+        XCVR_FOLDED_TIMING10,
+        /* 170: XCVR_TSM->TIMING11 */
+        XCVR_FOLDED_TIMING11,
+        /* 171: XCVR_TSM->TIMING12 */
+        XCVR_FOLDED_TIMING12,
+        /* 172: XCVR_TSM->TIMING13 */
+        XCVR_FOLDED_TIMING13,
+        /* 173: XCVR_TSM->TIMING14 */
+        XCVR_FOLDED_TIMING14,
+        /* 174: XCVR_TSM->TIMING15 */
+        XCVR_FOLDED_TIMING15,
+        /* 175: XCVR_TSM->TIMING16 */
+        XCVR_FOLDED_TIMING16,
+        /* 176: XCVR_TSM->TIMING17 */
+        XCVR_FOLDED_TIMING17,
+        /* 177: XCVR_TSM->TIMING18 */
+        XCVR_FOLDED_TIMING18,
+        /* 178: XCVR_TSM->TIMING19 */
+        XCVR_FOLDED_TIMING19,
+        /* 179: XCVR_TSM->TIMING20 */
+        XCVR_FOLDED_TIMING20,
+        /* 180: XCVR_TSM->TIMING21 */
+        XCVR_FOLDED_TIMING21,
+        /* 181: XCVR_TSM->TIMING22 */
+        XCVR_FOLDED_TIMING22,
+        /* 182: XCVR_TSM->TIMING23 */
+        XCVR_FOLDED_TIMING23,
+        /* 183: XCVR_TSM->TIMING24 */
+        XCVR_FOLDED_TIMING24,
+        /* 184: XCVR_TSM->TIMING25 */
+        XCVR_FOLDED_TIMING25,
+        /* 185: XCVR_TSM->TIMING26 */
+        XCVR_FOLDED_TIMING26,
+        /* 186: XCVR_TSM->TIMING27 */
+        XCVR_FOLDED_TIMING27,
+        /* 187: XCVR_TSM->TIMING28 */
+        XCVR_FOLDED_TIMING28,
+        /* 188: XCVR_TSM->TIMING29 */
+        XCVR_FOLDED_TIMING29,
+        /* 189: XCVR_TSM->TIMING30 */
+        XCVR_FOLDED_TIMING30,
+        /* 190: XCVR_TSM->TIMING31 */
+        XCVR_FOLDED_TIMING31,
+        /* 191: XCVR_TSM->TIMING32 */
+        XCVR_FOLDED_TIMING32,
+        /* 192: XCVR_TSM->TIMING33 */
+        XCVR_FOLDED_TIMING33,
+        /* 193: XCVR_TSM->TIMING34 */
+        XCVR_FOLDED_TIMING34,
+        /* 194: XCVR_TSM->TIMING35 */
+        XCVR_FOLDED_TIMING35,
+        /* 195: XCVR_TSM->TIMING36 */
+        XCVR_FOLDED_TIMING36,
+        /* 196: XCVR_TSM->TIMING37 */
+        XCVR_FOLDED_TIMING37,
+        /* 197: XCVR_TSM->TIMING38 */
+        XCVR_FOLDED_TIMING38,
+        /* 198: XCVR_TSM->TIMING39 */
+        XCVR_FOLDED_TIMING39,
+        /* 199: XCVR_TSM->TIMING40 */
+        XCVR_FOLDED_TIMING40,
+        /* 200: XCVR_TSM->TIMING41 */
+        XCVR_FOLDED_TIMING41,
+        /* 201: XCVR_TSM->TIMING42 */
+        XCVR_FOLDED_TIMING42,
+        /* 202: XCVR_TSM->TIMING43 */
+        XCVR_FOLDED_TIMING43,
+        /* 203: XCVR_TSM->TIMING44 */
+        XCVR_FOLDED_TIMING44,
+        /* 204: XCVR_TSM->TIMING45 */
+        XCVR_FOLDED_TIMING45,
+        /* 205: XCVR_TSM->TIMING46 */
+        XCVR_FOLDED_TIMING46,
+        /* 206: XCVR_TSM->TIMING47 */
+        XCVR_FOLDED_TIMING47,
+        /* 207: XCVR_TSM->TIMING48 */
+        XCVR_FOLDED_TIMING48,
+        /* 208: XCVR_TSM->TIMING49 */
+        XCVR_FOLDED_TIMING49,
+        /* 209: XCVR_TSM->TIMING50 */
+        XCVR_FOLDED_TIMING50,
+        /* 210: XCVR_TSM->TIMING51 */
+        XCVR_FOLDED_TIMING51,
+        /* 211: XCVR_TSM->TIMING52 */
+        XCVR_FOLDED_TIMING52,
+        /* 212: XCVR_TSM->WU_LATENCY */
+        XCVR_FOLDED_WU_LATENCY,
+        /* 213: XCVR_TX_DIG->DATARATE_CONFIG_FILTER_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(0),
+#else
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(0),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 214: XCVR_TX_DIG->DATARATE_CONFIG_FSK_CTRL */
+        XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV0(0x0000) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV1(0x0000),
+        /* 215: XCVR_TX_DIG->DATARATE_CONFIG_GFSK_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x0676),
+#else
+        XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x0540),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 216: XCVR_TX_DIG->DATA_PADDING_CTRL */
+        XCVR_FOLDED_DATA_PADDING_CTRL | XCVR_TX_DIG_DATA_PADDING_CTRL_DATA_PADDING_SEL(0) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_PAD_DLY(0) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_PAD_DLY_EN(1),
+        /* 217: XCVR_TX_DIG->DATA_PADDING_CTRL_1 */
+        XCVR_FOLDED_DATA_PADDING_CTRL_1 | XCVR_TX_DIG_DATA_PADDING_CTRL_1_RAMP_UP_DLY(0x04) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_1_TX_DATA_FLUSH_DLY(0x04),
+        /* 218: XCVR_TX_DIG->DATA_PADDING_CTRL_2 */
+        XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_MFDEV(0x1800) | XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_PFDEV(0x0800),
+        /* 219: XCVR_TX_DIG->FSK_CTRL */
+        XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_0(0x1800) | XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_1(0x0800),
+        /* 220: XCVR_TX_DIG->GFSK_COEFF_0_1 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_0(0x017) | XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_1(0x029),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_0(0x001) | XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_1(0x004),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 221: XCVR_TX_DIG->GFSK_COEFF_2_3 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_2(0x044) | XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_3(0x067),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_2(0x00D) | XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_3(0x028),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 222: XCVR_TX_DIG->GFSK_COEFF_4_5 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_4(0x090) | XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_5(0x0BA),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_4(0x063) | XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_5(0x0C0),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 223: XCVR_TX_DIG->GFSK_COEFF_6_7 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_6(0x0DC) | XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_7(0x0EF),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_6(0x12C) | XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_7(0x176),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 224: XCVR_TX_DIG->GFSK_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(0) |
+            XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x032B),
+#else
+        XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(0) |
+            XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x0293),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 225: XCVR_TX_DIG->IMAGE_FILTER_CTRL */
+        XCVR_FOLDED_IMAGE_FILTER_CTRL | XCVR_TX_DIG_IMAGE_FILTER_CTRL_IMAGE_FILTER_OVRD_EN(0),
+        /* 226: XCVR_TX_DIG->PA_CTRL */
+        XCVR_FOLDED_PA_CTRL | XCVR_TX_DIG_PA_CTRL_PA_RAMP_SEL(1),
+        /* 227: XCVR_TX_DIG->PA_RAMP_TBL0 */
+        XCVR_FOLDED_PA_RAMP_TBL0,
+        /* 228: XCVR_TX_DIG->PA_RAMP_TBL1 */
+        XCVR_FOLDED_PA_RAMP_TBL1,
+        /* 229: XCVR_TX_DIG->PA_RAMP_TBL2 */
+        XCVR_FOLDED_PA_RAMP_TBL2,
+        /* 230: XCVR_TX_DIG->PA_RAMP_TBL3 */
+        XCVR_FOLDED_PA_RAMP_TBL3,
+        /* 231: XCVR_TX_DIG->SWITCH_TX_CTRL */
+        XCVR_FOLDED_SWITCH_TX_CTRL,
+        /* 232: XCVR_TX_DIG->TXDIG_CTRL */
+        XCVR_FOLDED_TXDIG_CTRL | XCVR_TX_DIG_TXDIG_CTRL_DATA_STREAM_SEL(0) | XCVR_TX_DIG_TXDIG_CTRL_MODULATOR_SEL(0) |
+            XCVR_TX_DIG_TXDIG_CTRL_PFC_EN(0),
+    },
+};
+
+const xcvr_folded_config_t xcvr_gfsk_bt_0p5_h_0p32_500kbps_folded_config = {
+    .config     = &xcvr_gfsk_bt_0p5_h_0p32_500kbps_full_config,
+    .reg_values = {
+        /* 0: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x0D) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x0A) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x08) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x05) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x03),
+        /* 1: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3D) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x3B) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x38) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x36),
+        /* 2: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x33) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x31) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x2E),
+        /* 3: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x0D) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x0A) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x08) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x05) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x03),
+        /* 4: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3D) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x3B) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x38) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x3B),
+        /* 5: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x3D) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x03),
+        /* 6: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x08) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x05) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x03) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3D),
+        /* 7: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x03) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x05) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x08) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x05),
+        /* 8: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x03) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x3D),
+        /* 9: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x08) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x05) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x03) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3D),
+        /* 10: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x03) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x05) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x08) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x0A),
+        /* 11: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x0D) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x0F) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x12),
+        /* 12: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x38) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x3B) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x3D) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x03),
+        /* 13: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3D) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x3B) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x38) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x36),
+        /* 14: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x33) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x31) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x2E),
+        /* 15: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x38) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x3B) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x3D) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x03),
+        /* 16: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3D) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x3B) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x38) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x3B),
+        /* 17: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x3D) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x03),
+        /* 18: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x33) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x36) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x38) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x3B) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3D),
+        /* 19: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x03) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x05) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x08) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x05),
+        /* 20: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x03) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x3D),
+        /* 21: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x33) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x36) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x38) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x3B) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3D),
+        /* 22: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x03) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x05) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x08) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x0A),
+        /* 23: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x0D) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x0F) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x12),
+        /* 24: GEN4PHY->DMD_CTRL0 */
+        XCVR_FOLDED_DMD_CTRL0,
+        /* 25: GEN4PHY->DMD_CTRL1 */
+        XCVR_FOLDED_DMD_CTRL1,
+        /* 26: GEN4PHY->FSK_CFG0 */
+        XCVR_FOLDED_FSK_CFG0 | GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_1M(0x14) |
+            GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_2M(0x11) |
+            GEN4PHY_FSK_CFG0_MSK2FSK_SEED(0) | GEN4PHY_FSK_CFG0_MSK_EN(0),
+        /* 27: GEN4PHY->FSK_CFG1 */
+        GEN4PHY_FSK_CFG1_OVERH(0x014) | GEN4PHY_FSK_CFG1_OVERH_INV(0x190) | GEN4PHY_FSK_CFG1_SYNCTSCALE(0xF),
+        /* 28: GEN4PHY->FSK_CFG2 */
+        XCVR_FOLDED_FSK_CFG2,
+        /* 29: GEN4PHY->FSK_FAD_CFG */
+        XCVR_FOLDED_FSK_FAD_CFG,
+        /* 30: GEN4PHY->FSK_FAD_CTRL */
+        XCVR_FOLDED_FSK_FAD_CTRL,
+        /* 31: GEN4PHY->FSK_PD_CFG0 */
+        GEN4PHY_FSK_PD_CFG0_PD_IIR_ALPHA(0xFF) | GEN4PHY_FSK_PD_CFG0_PREAMBLE_T_SCALE(0xC),
+        /* 32: GEN4PHY->FSK_PD_CFG1 */
+        GEN4PHY_FSK_PD_CFG1_PREAMBLE_PATTERN(0x55),
+        /* 33: GEN4PHY->FSK_PD_CFG2 */
+        GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_1M(0xF6) | GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_2M(0xEB),
+        /* 34: GEN4PHY->FSK_PD_PH[0] */
+        GEN4PHY_FSK_PD_PH_REF0(0x02) | GEN4PHY_FSK_PD_PH_REF1(0x03) | GEN4PHY_FSK_PD_PH_REF2(0x02) |
+            GEN4PHY_FSK_PD_PH_REF3(0x00),
+        /* 35: GEN4PHY->FSK_PD_PH[1] */
+        GEN4PHY_FSK_PD_PH_REF0(0x3E) | GEN4PHY_FSK_PD_PH_REF1(0x3D) | GEN4PHY_FSK_PD_PH_REF2(0x3E) |
+            GEN4PHY_FSK_PD_PH_REF3(0x00),
+        /* 36: GEN4PHY->FSK_PT */
+        XCVR_FOLDED_FSK_PT | GEN4PHY_FSK_PT_AGC_TIMEOUT(0x0048),
+        /* 37: GEN4PHY->LR_AA_CFG */
+        GEN4PHY_LR_AA_CFG_AA_COR_THRESH(0x00) | GEN4PHY_LR_AA_CFG_AA_HAM_THRESH(0x00) |
+            GEN4PHY_LR_AA_CFG_AA_LR_CORR_GAIN(0x00) | GEN4PHY_LR_AA_CFG_ACCESS_ADDR_HAM(0x00),
+        /* 38: GEN4PHY->LR_PD_CFG */
+        GEN4PHY_LR_PD_CFG_CORR_TH(0x00) | GEN4PHY_LR_PD_CFG_FREQ_TH(0x00) | GEN4PHY_LR_PD_CFG_NO_PEAKS(0),
+        /* 39: GEN4PHY->LR_PD_PH[0] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 40: GEN4PHY->LR_PD_PH[1] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 41: GEN4PHY->LR_PD_PH[2] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 42: GEN4PHY->LR_PD_PH[3] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 43: GEN4PHY->MISC */
+        XCVR_FOLDED_MISC,
+        /* 44: GEN4PHY->PREPHY_MISC */
+        XCVR_FOLDED_PREPHY_MISC,
+        /* 45: GEN4PHY->RTT_CTRL */
+        XCVR_FOLDED_RTT_CTRL,
+        /* 46: GEN4PHY->RTT_REF */
+        GEN4PHY_RTT_REF_FM_REF_010(0x48) | GEN4PHY_RTT_REF_FM_REF_110(0x63) | GEN4PHY_RTT_REF_FM_REF_111(0x80),
+        /* 47: GEN4PHY->SM_CFG */
+        XCVR_FOLDED_SM_CFG | GEN4PHY_SM_CFG_AA_TIMEOUT_UNCODED(0x0A0),
+        /* 48: RADIO_CTRL->LL_CTRL */
+        RADIO_CTRL_LL_CTRL_ACTIVE_LL(2),
+        /* 49: XCVR_ANALOG->LDO_0 */
+        XCVR_FOLDED_LDO_0,
+        /* 50: XCVR_ANALOG->LDO_1 */
+        XCVR_FOLDED_LDO_1,
+        /* 51: XCVR_ANALOG->PLL */
+        XCVR_FOLDED_PLL,
+        /* 52: XCVR_ANALOG->RX_0 */
+        XCVR_FOLDED_RX_0,
+        /* 53: XCVR_ANALOG->RX_1 */
+        XCVR_FOLDED_RX_1,
+        /* 54: XCVR_ANALOG->TX_DAC_PA */
+        XCVR_FOLDED_TX_DAC_PA | XCVR_ANALOG_TX_DAC_PA_DAC_TRIM_CFBK_DRS(1),
+        /* 55: XCVR_ANALOG->XO_DIST */
+        XCVR_FOLDED_XO_DIST,
+        /* 56: XCVR_MISC->IPS_FO_ADDR[0] */
+        XCVR_MISC_IPS_FO_ADDR_ADDR(0x370) | XCVR_MISC_IPS_FO_ADDR_ENTRY_RX(0) | XCVR_MISC_IPS_FO_ADDR_ENTRY_TX(0),
+        /* 57: XCVR_MISC->IPS_FO_ADDR[1] */
+        XCVR_MISC_IPS_FO_ADDR_ADDR(0x02C) | XCVR_MISC_IPS_FO_ADDR_ENTRY_RX(0) | XCVR_MISC_IPS_FO_ADDR_ENTRY_TX(0),
+        /* 58: XCVR_MISC->IPS_FO_DRS0_DATA[0] */
+        XCVR_MISC_IPS_FO_DRS0_DATA_DRS0_DATA(0x00000000),
+        /* 59: XCVR_MISC->IPS_FO_DRS0_DATA[1] */
+        XCVR_MISC_IPS_FO_DRS0_DATA_DRS0_DATA(0x00000000),
+        /* 60: XCVR_MISC->IPS_FO_DRS1_DATA[0] */
+        XCVR_MISC_IPS_FO_DRS1_DATA_DRS1_DATA(0x00000000),
+        /* 61: XCVR_MISC->IPS_FO_DRS1_DATA[1] */
+        XCVR_MISC_IPS_FO_DRS1_DATA_DRS1_DATA(0x00000000),
+        /* 62: XCVR_MISC->LDO_TRIM_0 */
+        XCVR_FOLDED_LDO_TRIM_0,
+        /* 63: XCVR_MISC->LDO_TRIM_1 */
+        XCVR_FOLDED_LDO_TRIM_1,
+        /* 64: XCVR_MISC->XCVR_CTRL */
+        XCVR_FOLDED_XCVR_CTRL | XCVR_MISC_XCVR_CTRL_DATA_RATE_DRS(2) | XCVR_MISC_XCVR_CTRL_DEMOD_SEL(1) |
+            XCVR_MISC_XCVR_CTRL_LL_CFG_CAPT_DIS(0),
+        /* 65: XCVR_PLL_DIG->CHAN_MAP */
+        XCVR_FOLDED_CHAN_MAP | XCVR_PLL_DIG_CHAN_MAP_BAND_SELECT(0),
+        /* 66: XCVR_PLL_DIG->CHAN_MAP_EXT */
+#if RF_OSC_26MHZ == 1
+        XCVR_FOLDED_CHAN_MAP_EXT | XCVR_PLL_DIG_CHAN_MAP_EXT_NUM_OFFSET(0x013B13B),
+#else
+        XCVR_FOLDED_CHAN_MAP_EXT | XCVR_PLL_DIG_CHAN_MAP_EXT_NUM_OFFSET(0x0100000),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 67: XCVR_PLL_DIG->DATA_RATE_OVRD_CTRL1 */
+        XCVR_FOLDED_DATA_RATE_OVRD_CTRL1,
+        /* 68: XCVR_PLL_DIG->DATA_RATE_OVRD_CTRL2 */
+#if RF_OSC_26MHZ == 1
+        XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL2_NUM_OFFSET_CFG1(0x013B13B),
+#else
+        XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL2_NUM_OFFSET_CFG1(0x0100000),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 69: XCVR_PLL_DIG->DELAY_MATCH */
+        XCVR_FOLDED_DELAY_MATCH | XCVR_PLL_DIG_DELAY_MATCH_HPM_INTEGER_DELAY(0x04) |
+            XCVR_PLL_DIG_DELAY_MATCH_LPM_SDM_DELAY(0x03),
+        /* 70: XCVR_PLL_DIG->HPMCAL_CTRL */
+        XCVR_FOLDED_HPMCAL_CTRL | XCVR_PLL_DIG_HPMCAL_CTRL_HPM_CAL_ARRAY_SIZE(0),
+        /* 71: XCVR_PLL_DIG->HPM_BUMP */
+        XCVR_FOLDED_HPM_BUMP | XCVR_PLL_DIG_HPM_BUMP_HPM_VCM_CAL(2) | XCVR_PLL_DIG_HPM_BUMP_HPM_VCM_TX(2),
+        /* 72: XCVR_PLL_DIG->HPM_CAL_TIMING */
+        XCVR_FOLDED_HPM_CAL_TIMING,
+        /* 73: XCVR_PLL_DIG->HPM_CTRL */
+        XCVR_FOLDED_HPM_CTRL,
+        /* 74: XCVR_PLL_DIG->HPM_SDM_RES */
+        XCVR_FOLDED_HPM_SDM_RES | XCVR_PLL_DIG_HPM_SDM_RES_HPM_COUNT_ADJUST(0x02),
+        /* 75: XCVR_PLL_DIG->LOCK_DETECT */
+        XCVR_FOLDED_LOCK_DETECT,
+        /* 76: XCVR_PLL_DIG->LPM_CTRL */
+        XCVR_FOLDED_LPM_CTRL,
+        /* 77: XCVR_PLL_DIG->LPM_SDM_CTRL1 */
+        XCVR_FOLDED_LPM_SDM_CTRL1,
+        /* 78: XCVR_PLL_DIG->MOD_CTRL */
+        XCVR_FOLDED_MOD_CTRL,
+        /* 79: XCVR_PLL_DIG->PLL_DATARATE_CTRL */
+        XCVR_FOLDED_PLL_DATARATE_CTRL,
+        /* 80: XCVR_PLL_DIG->TUNING_CAP_RX_CTRL */
+        XCVR_FOLDED_TUNING_CAP_RX_CTRL,
+        /* 81: XCVR_PLL_DIG->TUNING_CAP_TX_CTRL */
+        XCVR_FOLDED_TUNING_CAP_TX_CTRL,
+        /* 82: XCVR_RX_DIG->ACQ_FILT_0_3 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x02) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x06) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x09) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x06),
+#else
+        XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x01) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x3D) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x78) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x7C),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 83: XCVR_RX_DIG->ACQ_FILT_0_3_DRS */
+        XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H0(0x00) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H1(0x00) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H2(0x00) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H3(0x00),
+        /* 84: XCVR_RX_DIG->ACQ_FILT_10_11 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x06B) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x08C),
+#else
+        XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x06F) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x0D2),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 85: XCVR_RX_DIG->ACQ_FILT_10_11_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x064) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x091),
+#else
+        XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x055) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x0E2),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 86: XCVR_RX_DIG->ACQ_FILT_4_7 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x7B) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x6B) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_H6(0xE1) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0xE8),
+#else
+        XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x0D) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x19) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_H6(0x07) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0xDB),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 87: XCVR_RX_DIG->ACQ_FILT_4_7_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x02) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x7F) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0xF4) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0xEC),
+#else
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x7E) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x02) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0x0E) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0x02),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 88: XCVR_RX_DIG->ACQ_FILT_8_9 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x007) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x038),
+#else
+        XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x1C6) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x1FB),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 89: XCVR_RX_DIG->ACQ_FILT_8_9_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x1F9) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x026),
+#else
+        XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x1D8) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x1DE),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 90: XCVR_RX_DIG->AGC_CTRL */
+        XCVR_FOLDED_AGC_CTRL,
+        /* 91: XCVR_RX_DIG->AGC_CTRL_STAT */
+        XCVR_FOLDED_AGC_CTRL_STAT,
+        /* 92: XCVR_RX_DIG->AGC_IDX0_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX0_GAIN_CFG,
+        /* 93: XCVR_RX_DIG->AGC_IDX0_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX0_GAIN_VAL,
+        /* 94: XCVR_RX_DIG->AGC_IDX0_THR */
+        XCVR_FOLDED_AGC_IDX0_THR,
+        /* 95: XCVR_RX_DIG->AGC_IDX10_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX10_GAIN_CFG,
+        /* 96: XCVR_RX_DIG->AGC_IDX10_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX10_GAIN_VAL,
+        /* 97: XCVR_RX_DIG->AGC_IDX10_THR */
+        XCVR_FOLDED_AGC_IDX10_THR,
+        /* 98: XCVR_RX_DIG->AGC_IDX11_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX11_GAIN_CFG | XCVR_RX_DIG_AGC_IDX11_GAIN_CFG_MAG_THR_11_DRS_OFS(0x00) |
+            XCVR_RX_DIG_AGC_IDX11_GAIN_CFG_MAG_THR_HI_11_DRS_OFS(0x00),
+        /* 99: XCVR_RX_DIG->AGC_IDX11_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX11_GAIN_VAL | XCVR_RX_DIG_AGC_IDX11_GAIN_VAL_MAG_THR_11(0x000) |
+            XCVR_RX_DIG_AGC_IDX11_GAIN_VAL_MAG_THR_HI_11(0x000),
+        /* 100: XCVR_RX_DIG->AGC_IDX11_THR */
+        XCVR_FOLDED_AGC_IDX11_THR,
+        /* 101: XCVR_RX_DIG->AGC_IDX1_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX1_GAIN_CFG,
+        /* 102: XCVR_RX_DIG->AGC_IDX1_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX1_GAIN_VAL,
+        /* 103: XCVR_RX_DIG->AGC_IDX1_THR */
+        XCVR_FOLDED_AGC_IDX1_THR,
+        /* 104: XCVR_RX_DIG->AGC_IDX2_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX2_GAIN_CFG,
+        /* 105: XCVR_RX_DIG->AGC_IDX2_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX2_GAIN_VAL,
+        /* 106: XCVR_RX_DIG->AGC_IDX2_THR */
+        XCVR_FOLDED_AGC_IDX2_THR,
+        /* 107: XCVR_RX_DIG->AGC_IDX3_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX3_GAIN_CFG,
+        /* 108: XCVR_RX_DIG->AGC_IDX3_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX3_GAIN_VAL,
+        /* 109: XCVR_RX_DIG->AGC_IDX3_THR */
+        XCVR_FOLDED_AGC_IDX3_THR,
+        /* 110: XCVR_RX_DIG->AGC_IDX4_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX4_GAIN_CFG,
+        /* 111: XCVR_RX_DIG->AGC_IDX4_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX4_GAIN_VAL,
+        /* 112: XCVR_RX_DIG->AGC_IDX4_THR */
+        XCVR_FOLDED_AGC_IDX4_THR,
+        /* 113: XCVR_RX_DIG->AGC_IDX5_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX5_GAIN_CFG,
+        /* 114: XCVR_RX_DIG->AGC_IDX5_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX5_GAIN_VAL,
+        /* 115: XCVR_RX_DIG->AGC_IDX5_THR */
+        XCVR_FOLDED_AGC_IDX5_THR,
+        /* 116: XCVR_RX_DIG->AGC_IDX6_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX6_GAIN_CFG,
+        /* 117: XCVR_RX_DIG->AGC_IDX6_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX6_GAIN_VAL,
+        /* 118: XCVR_RX_DIG->AGC_IDX6_THR */
+        XCVR_FOLDED_AGC_IDX6_THR,
+        /* 119: XCVR_RX_DIG->AGC_IDX7_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX7_GAIN_CFG,
+        /* 120: XCVR_RX_DIG->AGC_IDX7_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX7_GAIN_VAL,
+        /* 121: XCVR_RX_DIG->AGC_IDX7_THR */
+        XCVR_FOLDED_AGC_IDX7_THR,
+        /* 122: XCVR_RX_DIG->AGC_IDX8_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX8_GAIN_CFG,
+        /* 123: XCVR_RX_DIG->AGC_IDX8_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX8_GAIN_VAL,
+        /* 124: XCVR_RX_DIG->AGC_IDX8_THR */
+        XCVR_FOLDED_AGC_IDX8_THR,
+        /* 125: XCVR_RX_DIG->AGC_IDX9_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX9_GAIN_CFG,
+        /* 126: XCVR_RX_DIG->AGC_IDX9_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX9_GAIN_VAL,
+        /* 127: XCVR_RX_DIG->AGC_IDX9_THR */
+        XCVR_FOLDED_AGC_IDX9_THR,
+        /* 128: XCVR_RX_DIG->AGC_MIS_GAIN_CFG */
+        XCVR_FOLDED_AGC_MIS_GAIN_CFG,
+        /* 129: XCVR_RX_DIG->AGC_THR_FAST */
+        XCVR_FOLDED_AGC_THR_FAST,
+        /* 130: XCVR_RX_DIG->AGC_THR_FAST_DRS */
+        XCVR_FOLDED_AGC_THR_FAST_DRS,
+        /* 131: XCVR_RX_DIG->AGC_THR_MIS */
+        XCVR_FOLDED_AGC_THR_MIS,
+        /* 132: XCVR_RX_DIG->AGC_TIMING0 */
+        XCVR_FOLDED_AGC_TIMING0 | XCVR_RX_DIG_AGC_TIMING0_AGC_GAIN_STEP_WAIT(0x10),
+        /* 133: XCVR_RX_DIG->AGC_TIMING0_DRS */
+        XCVR_FOLDED_AGC_TIMING0_DRS | XCVR_RX_DIG_AGC_TIMING0_DRS_AGC_GAIN_STEP_WAIT(0x10),
+        /* 134: XCVR_RX_DIG->AGC_TIMING1 */
+        XCVR_FOLDED_AGC_TIMING1 | XCVR_RX_DIG_AGC_TIMING1_AGC_FREEZE_TIMEOUT(0x0A) |
+            XCVR_RX_DIG_AGC_TIMING1_AGC_HOLD_TIMEOUT(0x08),
+        /* 135: XCVR_RX_DIG->AGC_TIMING1_DRS */
+        XCVR_RX_DIG_AGC_TIMING1_DRS_AGC_FREEZE_TIMEOUT(0x0A) | XCVR_RX_DIG_AGC_TIMING1_DRS_AGC_HOLD_TIMEOUT(0x08),
+        /* 136: XCVR_RX_DIG->AGC_TIMING2 */
+        XCVR_FOLDED_AGC_TIMING2 | XCVR_RX_DIG_AGC_TIMING2_AGC_UNFREEZE_FEAT_TIMEOUT(0x000) |
+            XCVR_RX_DIG_AGC_TIMING2_AGC_UNHOLD_FEAT_TIMEOUT(0x000),
+        /* 137: XCVR_RX_DIG->AGC_TIMING2_DRS */
+        XCVR_RX_DIG_AGC_TIMING2_DRS_AGC_UNFREEZE_FEAT_TIMEOUT(0x000) |
+            XCVR_RX_DIG_AGC_TIMING2_DRS_AGC_UNHOLD_FEAT_TIMEOUT(0x000),
+        /* 138: XCVR_RX_DIG->CTRL0 */
+#if RF_OSC_26MHZ == 1
+        XCVR_FOLDED_CTRL0 | XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(2) |
+            XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x027) |
+            XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(1) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#else
+        XCVR_FOLDED_CTRL0 | XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(3) |
+            XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x020) |
+            XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(1) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 139: XCVR_RX_DIG->CTRL0_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(3) |
+            XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x027),
+#else
+        XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(4) |
+            XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x020),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 140: XCVR_RX_DIG->CTRL1 */
+        XCVR_FOLDED_CTRL1,
+        /* 141: XCVR_RX_DIG->DCOC_CTRL0 */
+        XCVR_FOLDED_DCOC_CTRL0 | XCVR_RX_DIG_DCOC_CTRL0_DCOC_DAC_ORDER(1) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFII(0x6) |
+            XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFIIP(1) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFQQ(0x5) |
+            XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFQQP(1),
+        /* 142: XCVR_RX_DIG->DCOC_CTRL0_DRS */
+        XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFII(6) | XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFIIP(1) |
+            XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFQQ(5) | XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFQQP(1),
+        /* 143: XCVR_RX_DIG->DCOC_CTRL1 */
+        XCVR_FOLDED_DCOC_CTRL1,
+        /* 144: XCVR_RX_DIG->DEMOD_FILT_0_1 */
+        XCVR_RX_DIG_DEMOD_FILT_0_1_H0(0x1FE) | XCVR_RX_DIG_DEMOD_FILT_0_1_H1(0x003),
+        /* 145: XCVR_RX_DIG->DEMOD_FILT_0_1_DRS */
+        XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H0(0x1FE) | XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H1(0x005),
+        /* 146: XCVR_RX_DIG->DEMOD_FILT_2_4 */
+        XCVR_RX_DIG_DEMOD_FILT_2_4_H2(0x02D) | XCVR_RX_DIG_DEMOD_FILT_2_4_H3(0x07D) |
+            XCVR_RX_DIG_DEMOD_FILT_2_4_H4(0x0A9),
+        /* 147: XCVR_RX_DIG->DEMOD_FILT_2_4_DRS */
+        XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H2(0x02F) | XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H3(0x07B) |
+            XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H4(0x0A4),
+        /* 148: XCVR_RX_DIG->NB_RSSI_CTRL0 */
+        XCVR_FOLDED_NB_RSSI_CTRL0,
+        /* 149: XCVR_RX_DIG->NB_RSSI_CTRL1 */
+        XCVR_FOLDED_NB_RSSI_CTRL1,
+        /* 150: XCVR_RX_DIG->RCCAL_CTRL0 */
+        XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE(2) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE_DRS(3) |
+            XCVR_RX_DIG_RCCAL_CTRL0_CBPF_CCODE_OFFSET(0x00) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE(1) |
+            XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE_DRS(1) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CMPOUT_INV(0) |
+            XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CODE_OFFSET(0x0) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_SMPL_DLY(0),
+        /* 151: XCVR_RX_DIG->RSSI_GLOBAL_CTRL */
+        XCVR_FOLDED_RSSI_GLOBAL_CTRL | XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_CCA1_ED_EN(0),
+        /* 152: XCVR_RX_DIG->WB_RSSI_CTRL */
+        XCVR_FOLDED_WB_RSSI_CTRL,
+        /* 153: XCVR_TSM->CTRL */
+        XCVR_FOLDED_CTRL,
+        /* 154: XCVR_TSM->END_OF_SEQ */
+        XCVR_FOLDED_END_OF_SEQ,
+        /* 155: XCVR_TSM->FAST_CTRL1 */
+        XCVR_FOLDED_FAST_CTRL1,
+        /* 156: XCVR_TSM->FAST_CTRL2 */
+        XCVR_FOLDED_FAST_CTRL2,
+        /* 157: XCVR_TSM->FAST_CTRL3 */
+        XCVR_FOLDED_FAST_CTRL3,
+        /* 158: XCVR_TSM->RECYCLE_COUNT */
+        XCVR_FOLDED_RECYCLE_COUNT,
+        /* 159: XCVR_TSM->TIMING00 */
+        XCVR_FOLDED_TIMING00,
+        /* 160: XCVR_TSM->TIMING01 */
+        XCVR_FOLDED_TIMING01,
+        /* 161: XCVR_TSM->TIMING02 */
+        XCVR_FOLDED_TIMING02,
+        /* 162: XCVR_TSM->TIMING03 */
+        XCVR_FOLDED_TIMING03,
+        /* 163: XCVR_TSM->TIMING04 */
+        XCVR_FOLDED_TIMING04,
+        /* 164: XCVR_TSM->TIMING05 */
+        XCVR_FOLDED_TIMING05,
+        /* 165: XCVR_TSM->TIMING06 */
+        XCVR_FOLDED_TIMING06,
+        /* 166: XCVR_TSM->TIMING07 */
+        XCVR_FOLDED_TIMING07,
+        /* 167: XCVR_TSM->TIMING08 */
+        XCVR_FOLDED_TIMING08,
+        /* 168: XCVR_TSM->TIMING09 */
+        XCVR_FOLDED_TIMING09,
+        /* 169: XCVR_TSM->TIMING10 */
+        XCVR_FOLDED_TIMING10,
+        /* 170: XCVR_TSM->TIMING11 */
+        XCVR_FOLDED_TIMING11,
+        /* 171: XCVR_TSM->TIMING12 */
+        XCVR_FOLDED_TIMING12,
+        /* 172: XCVR_TSM->TIMING13 */
+        XCVR_FOLDED_TIMING13,
+        /* 173: XCVR_TSM->TIMING14 */
+        XCVR_FOLDED_TIMING14,
+        /* 174: XCVR_TSM->TIMING15 */
+        XCVR_FOLDED_TIMING15,
+        /* 175: XCVR_TSM->TIMING16 */
+        XCVR_FOLDED_TIMING16,
+        /* 176: XCVR_TSM->TIMING17 */
+        XCVR_FOLDED_TIMING17,
+        /* 177: XCVR_TSM->TIMING18 */
+        XCVR_FOLDED_TIMING18,
+        /* 178: XCVR_TSM->TIMING19 */
+        XCVR_FOLDED_TIMING19,
+        /* 179: XCVR_TSM->TIMING20 */
+        XCVR_FOLDED_TIMING20,
+        /* 180: XCVR_TSM->TIMING21 */
+        XCVR_FOLDED_TIMING21,
+        /* 181: XCVR_TSM->TIMING22 */
+        XCVR_FOLDED_TIMING22,
+        /* 182: XCVR_TSM->TIMING23 */
+        XCVR_FOLDED_TIMING23,
+        /* 183: XCVR_TSM->TIMING24 */
+        XCVR_FOLDED_TIMING24,
+        /* 184: XCVR_TSM->TIMING25 */
+        XCVR_FOLDED_TIMING25,
+        /* 185: XCVR_TSM->TIMING26 */
+        XCVR_FOLDED_TIMING26,
+        /* 186: XCVR_TSM->TIMING27 */
+        XCVR_FOLDED_TIMING27,
+        /* 187: XCVR_TSM->TIMING28 */
+        XCVR_FOLDED_TIMING28,
+        /* 188: XCVR_TSM->TIMING29 */
+        XCVR_FOLDED_TIMING29,
+        /* 189: XCVR_TSM->TIMING30 */
+        XCVR_FOLDED_TIMING30,
+        /* 190: XCVR_TSM->TIMING31 */
+        XCVR_FOLDED_TIMING31,
+        /* 191: XCVR_TSM->TIMING32 */
+        XCVR_FOLDED_TIMING32,
+        /* 192: XCVR_TSM->TIMING33 */
+        XCVR_FOLDED_TIMING33,
+        /* 193: XCVR_TSM->TIMING34 */
+        XCVR_FOLDED_TIMING34,
+        /* 194: XCVR_TSM->TIMING35 */
+        XCVR_FOLDED_TIMING35,
+        /* 195: XCVR_TSM->TIMING36 */
+        XCVR_FOLDED_TIMING36,
+        /* 196: XCVR_TSM->TIMING37 */
+        XCVR_FOLDED_TIMING37,
+        /* 197: XCVR_TSM->TIMING38 */
+        XCVR_FOLDED_TIMING38,
+        /* 198: XCVR_TSM->TIMING39 */
+        XCVR_FOLDED_TIMING39,
+        /* 199: XCVR_TSM->TIMING40 */
+        XCVR_FOLDED_TIMING40,
+        /* 200: XCVR_TSM->TIMING41 */
+        XCVR_FOLDED_TIMING41,
+        /* 201: XCVR_TSM->TIMING42 */
+        XCVR_FOLDED_TIMING42,
+        /* 202: XCVR_TSM->TIMING43 */
+        XCVR_FOLDED_TIMING43,
+        /* 203: XCVR_TSM->TIMING44 */
+        XCVR_FOLDED_TIMING44,
+        /* 204: XCVR_TSM->TIMING45 */
+        XCVR_FOLDED_TIMING45,
+        /* 205: XCVR_TSM->TIMING46 */
+        XCVR_FOLDED_TIMING46,
+        /* 206: XCVR_TSM->TIMING47 */
+        XCVR_FOLDED_TIMING47,
+        /* 207: XCVR_TSM->TIMING48 */
+        XCVR_FOLDED_TIMING48,
+        /* 208: XCVR_TSM->TIMING49 */
+        XCVR_FOLDED_TIMING49,
+        /* 209: XCVR_TSM->TIMING50 */
+        XCVR_FOLDED_TIMING50,
+        /* 210: XCVR_TSM->TIMING51 */
+        XCVR_FOLDED_TIMING51,
+        /* 211: XCVR_TSM->TIMING52 */
+        XCVR_FOLDED_TIMING52,
+        /* 212: XCVR_TSM->WU_LATENCY */
+        XCVR_FOLDED_WU_LATENCY,
+        /* 213: XCVR_TX_DIG->DATARATE_CONFIG_FILTER_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(2) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(2) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(1),
+#else
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(3) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(2) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(1),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 214: XCVR_TX_DIG->DATARATE_CONFIG_FSK_CTRL */
+        XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV0(0x0000) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV1(0x0000),
+        /* 215: XCVR_TX_DIG->DATARATE_CONFIG_GFSK_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x0196),
+#else
+        XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x014A),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 216: XCVR_TX_DIG->DATA_PADDING_CTRL */
+        XCVR_FOLDED_DATA_PADDING_CTRL | XCVR_TX_DIG_DATA_PADDING_CTRL_DATA_PADDING_SEL(0) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_PAD_DLY(0) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_PAD_DLY_EN(1),
+        /* 217: XCVR_TX_DIG->DATA_PADDING_CTRL_1 */
+        XCVR_FOLDED_DATA_PADDING_CTRL_1 | XCVR_TX_DIG_DATA_PADDING_CTRL_1_RAMP_UP_DLY(0x04) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_1_TX_DATA_FLUSH_DLY(0x04),
+        /* 218: XCVR_TX_DIG->DATA_PADDING_CTRL_2 */
+        XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_MFDEV(0x1800) | XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_PFDEV(0x0800),
+        /* 219: XCVR_TX_DIG->FSK_CTRL */
+        XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_0(0x1800) | XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_1(0x0800),
+        /* 220: XCVR_TX_DIG->GFSK_COEFF_0_1 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_0(0x017) | XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_1(0x029),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_0(0x001) | XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_1(0x004),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 221: XCVR_TX_DIG->GFSK_COEFF_2_3 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_2(0x044) | XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_3(0x067),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_2(0x00D) | XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_3(0x028),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 222: XCVR_TX_DIG->GFSK_COEFF_4_5 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_4(0x090) | XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_5(0x0BA),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_4(0x063) | XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_5(0x0C0),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 223: XCVR_TX_DIG->GFSK_COEFF_6_7 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_6(0x0DC) | XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_7(0x0EF),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_6(0x12C) | XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_7(0x176),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 224: XCVR_TX_DIG->GFSK_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(0) |
+            XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x032B),
+#else
+        XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(0) |
+            XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x0293),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 225: XCVR_TX_DIG->IMAGE_FILTER_CTRL */
+        XCVR_FOLDED_IMAGE_FILTER_CTRL | XCVR_TX_DIG_IMAGE_FILTER_CTRL_IMAGE_FILTER_OVRD_EN(0),
+        /* 226: XCVR_TX_DIG->PA_CTRL */
+        XCVR_FOLDED_PA_CTRL | XCVR_TX_DIG_PA_CTRL_PA_RAMP_SEL(1),
+        /* 227: XCVR_TX_DIG->PA_RAMP_TBL0 */
+        XCVR_FOLDED_PA_RAMP_TBL0,
+        /* 228: XCVR_TX_DIG->PA_RAMP_TBL1 */
+        XCVR_FOLDED_PA_RAMP_TBL1,
+        /* 229: XCVR_TX_DIG->PA_RAMP_TBL2 */
+        XCVR_FOLDED_PA_RAMP_TBL2,
+        /* 230: XCVR_TX_DIG->PA_RAMP_TBL3 */
+        XCVR_FOLDED_PA_RAMP_TBL3,
+        /* 231: XCVR_TX_DIG->SWITCH_TX_CTRL */
+        XCVR_FOLDED_SWITCH_TX_CTRL,
+        /* 232: XCVR_TX_DIG->TXDIG_CTRL */
+        XCVR_FOLDED_TXDIG_CTRL | XCVR_TX_DIG_TXDIG_CTRL_DATA_STREAM_SEL(0) | XCVR_TX_DIG_TXDIG_CTRL_MODULATOR_SEL(0) |
+            XCVR_TX_DIG_TXDIG_CTRL_PFC_EN(0),
+    },
+};
+
+const xcvr_folded_config_t xcvr_gfsk_bt_0p5_h_0p32_250kbps_folded_config = {
+    .config     = &xcvr_gfsk_bt_0p5_h_0p32_250kbps_full_config,
+    .reg_values = {
+        /* 0: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x0D) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x0A) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x08) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x05) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x03),
+        /* 1: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3D) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x3B) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x38) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x36),
+        /* 2: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x33) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x31) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x2E),
+        /* 3: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x0D) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x0A) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x08) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x05) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x03),
+        /* 4: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3D) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x3B) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x38) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x3B),
+        /* 5: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x3D) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x03),
+        /* 6: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x08) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x05) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x03) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3D),
+        /* 7: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x03) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x05) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x08) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x05),
+        /* 8: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x03) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x3D),
+        /* 9: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x08) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x05) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x03) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3D),
+        /* 10: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x03) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x05) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x08) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x0A),
+        /* 11: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x0D) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x0F) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x12),
+        /* 12: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x38) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x3B) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x3D) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x03),
+        /* 13: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3D) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x3B) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x38) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x36),
+        /* 14: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x33) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x31) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x2E),
+        /* 15: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x38) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x3B) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x3D) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x03),
+        /* 16: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3D) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x3B) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x38) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x3B),
+        /* 17: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x3D) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x03),
+        /* 18: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x33) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x36) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x38) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x3B) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3D),
+        /* 19: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x03) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x05) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x08) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x05),
+        /* 20: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x03) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x3D),
+        /* 21: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x33) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x36) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x38) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x3B) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3D),
+        /* 22: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x03) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x05) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x08) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x0A),
+        /* 23: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x0D) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x0F) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x12),
+        /* 24: GEN4PHY->DMD_CTRL0 */
+        XCVR_FOLDED_DMD_CTRL0,
+        /* 25: GEN4PHY->DMD_CTRL1 */
+        XCVR_FOLDED_DMD_CTRL1,
+        /* 26: GEN4PHY->FSK_CFG0 */
+        XCVR_FOLDED_FSK_CFG0 | GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_1M(0x14) |
+            GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_2M(0x11) |
+            GEN4PHY_FSK_CFG0_MSK2FSK_SEED(0) | GEN4PHY_FSK_CFG0_MSK_EN(0),
+        /* 27: GEN4PHY->FSK_CFG1 */
+        GEN4PHY_FSK_CFG1_OVERH(0x014) | GEN4PHY_FSK_CFG1_OVERH_INV(0x190) | GEN4PHY_FSK_CFG1_SYNCTSCALE(0xF),
+        /* 28: GEN4PHY->FSK_CFG2 */
+        XCVR_FOLDED_FSK_CFG2,
+        /* 29: GEN4PHY->FSK_FAD_CFG */
+        XCVR_FOLDED_FSK_FAD_CFG,
+        /* 30: GEN4PHY->FSK_FAD_CTRL */
+        XCVR_FOLDED_FSK_FAD_CTRL,
+        /* 31: GEN4PHY->FSK_PD_CFG0 */
+        GEN4PHY_FSK_PD_CFG0_PD_IIR_ALPHA(0xFF) | GEN4PHY_FSK_PD_CFG0_PREAMBLE_T_SCALE(0xC),
+        /* 32: GEN4PHY->FSK_PD_CFG1 */
+        GEN4PHY_FSK_PD_CFG1_PREAMBLE_PATTERN(0x55),
+        /* 33: GEN4PHY->FSK_PD_CFG2 */
+        GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_1M(0xF6) | GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_2M(0xEB),
+        /* 34: GEN4PHY->FSK_PD_PH[0] */
+        GEN4PHY_FSK_PD_PH_REF0(0x02) | GEN4PHY_FSK_PD_PH_REF1(0x03) | GEN4PHY_FSK_PD_PH_REF2(0x02) |
+            GEN4PHY_FSK_PD_PH_REF3(0x00),
+        /* 35: GEN4PHY->FSK_PD_PH[1] */
+        GEN4PHY_FSK_PD_PH_REF0(0x3E) | GEN4PHY_FSK_PD_PH_REF1(0x3D) | GEN4PHY_FSK_PD_PH_REF2(0x3E) |
+            GEN4PHY_FSK_PD_PH_REF3(0x00),
+        /* 36: GEN4PHY->FSK_PT */
+        XCVR_FOLDED_FSK_PT | GEN4PHY_FSK_PT_AGC_TIMEOUT(0x0048),
+        /* 37: GEN4PHY->LR_AA_CFG */
+        GEN4PHY_LR_AA_CFG_AA_COR_THRESH(0x00) | GEN4PHY_LR_AA_CFG_AA_HAM_THRESH(0x00) |
+            GEN4PHY_LR_AA_CFG_AA_LR_CORR_GAIN(0x00) | GEN4PHY_LR_AA_CFG_ACCESS_ADDR_HAM(0x00),
+        /* 38: GEN4PHY->LR_PD_CFG */
+        GEN4PHY_LR_PD_CFG_CORR_TH(0x00) | GEN4PHY_LR_PD_CFG_FREQ_TH(0x00) | GEN4PHY_LR_PD_CFG_NO_PEAKS(0),
+        /* 39: GEN4PHY->LR_PD_PH[0] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 40: GEN4PHY->LR_PD_PH[1] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 41: GEN4PHY->LR_PD_PH[2] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 42: GEN4PHY->LR_PD_PH[3] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 43: GEN4PHY->MISC */
+        XCVR_FOLDED_MISC,
+        /* 44: GEN4PHY->PREPHY_MISC */
+        XCVR_FOLDED_PREPHY_MISC,
+        /* 45: GEN4PHY->RTT_CTRL */
+        XCVR_FOLDED_RTT_CTRL,
+        /* 46: GEN4PHY->RTT_REF */
+        GEN4PHY_RTT_REF_FM_REF_010(0x48) | GEN4PHY_RTT_REF_FM_REF_110(0x63) | GEN4PHY_RTT_REF_FM_REF_111(0x80),
+        /* 47: GEN4PHY->SM_CFG */
+        XCVR_FOLDED_SM_CFG | GEN4PHY_SM_CFG_AA_TIMEOUT_UNCODED(0x0A0),
+        /* 48: RADIO_CTRL->LL_CTRL */
+        RADIO_CTRL_LL_CTRL_ACTIVE_LL(2),
+        /* 49: XCVR_ANALOG->LDO_0 */
+        XCVR_FOLDED_LDO_0,
+        /* 50: XCVR_ANALOG->LDO_1 */
+        XCVR_FOLDED_LDO_1,
+        /* 51: XCVR_ANALOG->PLL */
+        XCVR_FOLDED_PLL,
+        /* 52: XCVR_ANALOG->RX_0 */
+        XCVR_FOLDED_RX_0,
+        /* 53: XCVR_ANALOG->RX_1 */
+        XCVR_FOLDED_RX_1,
+        /* 54: XCVR_ANALOG->TX_DAC_PA */
+        XCVR_FOLDED_TX_DAC_PA | XCVR_ANALOG_TX_DAC_PA_DAC_TRIM_CFBK_DRS(1),
+        /* 55: XCVR_ANALOG->XO_DIST */
+        XCVR_FOLDED_XO_DIST,
+        /* 56: XCVR_MISC->IPS_FO_ADDR[0] */
+        XCVR_MISC_IPS_FO_ADDR_ADDR(0x370) | XCVR_MISC_IPS_FO_ADDR_ENTRY_RX(0) | XCVR_MISC_IPS_FO_ADDR_ENTRY_TX(0),
+        /* 57: XCVR_MISC->IPS_FO_ADDR[1] */
+        XCVR_MISC_IPS_FO_ADDR_ADDR(0x02C) | XCVR_MISC_IPS_FO_ADDR_ENTRY_RX(0) | XCVR_MISC_IPS_FO_ADDR_ENTRY_TX(0),
+        /* 58: XCVR_MISC->IPS_FO_DRS0_DATA[0] */
+        XCVR_MISC_IPS_FO_DRS0_DATA_DRS0_DATA(0x00000000),
+        /* 59: XCVR_MISC->IPS_FO_DRS0_DATA[1] */
+        XCVR_MISC_IPS_FO_DRS0_DATA_DRS0_DATA(0x00000000),
+        /* 60: XCVR_MISC->IPS_FO_DRS1_DATA[0] */
+        XCVR_MISC_IPS_FO_DRS1_DATA_DRS1_DATA(0x00000000),
+        /* 61: XCVR_MISC->IPS_FO_DRS1_DATA[1] */
+        XCVR_MISC_IPS_FO_DRS1_DATA_DRS1_DATA(0x00000000),
+        /* 62: XCVR_MISC->LDO_TRIM_0 */
+        XCVR_FOLDED_LDO_TRIM_0,
+        /* 63: XCVR_MISC->LDO_TRIM_1 */
+        XCVR_FOLDED_LDO_TRIM_1,
+        /* 64: XCVR_MISC->XCVR_CTRL */
+        XCVR_FOLDED_XCVR_CTRL | XCVR_MISC_XCVR_CTRL_DATA_RATE_DRS(3) | XCVR_MISC_XCVR_CTRL_DEMOD_SEL(1) |
+            XCVR_MISC_XCVR_CTRL_LL_CFG_CAPT_DIS(0),
+        /* 65: XCVR_PLL_DIG->CHAN_MAP */
+        XCVR_FOLDED_CHAN_MAP | XCVR_PLL_DIG_CHAN_MAP_BAND_SELECT(0),
+        /* 66: XCVR_PLL_DIG->CHAN_MAP_EXT */
+#if RF_OSC_26MHZ == 1
+        XCVR_FOLDED_CHAN_MAP_EXT | XCVR_PLL_DIG_CHAN_MAP_EXT_NUM_OFFSET(0x013B13B),
+#else
+        XCVR_FOLDED_CHAN_MAP_EXT | XCVR_PLL_DIG_CHAN_MAP_EXT_NUM_OFFSET(0x0100000),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 67: XCVR_PLL_DIG->DATA_RATE_OVRD_CTRL1 */
+        XCVR_FOLDED_DATA_RATE_OVRD_CTRL1,
+        /* 68: XCVR_PLL_DIG->DATA_RATE_OVRD_CTRL2 */
+#if RF_OSC_26MHZ == 1
+        XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL2_NUM_OFFSET_CFG1(0x013B13B),
+#else
+        XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL2_NUM_OFFSET_CFG1(0x0100000),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 69: XCVR_PLL_DIG->DELAY_MATCH */
+        XCVR_FOLDED_DELAY_MATCH | XCVR_PLL_DIG_DELAY_MATCH_HPM_INTEGER_DELAY(0x04) |
+            XCVR_PLL_DIG_DELAY_MATCH_LPM_SDM_DELAY(0x03),
+        /* 70: XCVR_PLL_DIG->HPMCAL_CTRL */
+        XCVR_FOLDED_HPMCAL_CTRL | XCVR_PLL_DIG_HPMCAL_CTRL_HPM_CAL_ARRAY_SIZE(0),
+        /* 71: XCVR_PLL_DIG->HPM_BUMP */
+        XCVR_FOLDED_HPM_BUMP | XCVR_PLL_DIG_HPM_BUMP_HPM_VCM_CAL(2) | XCVR_PLL_DIG_HPM_BUMP_HPM_VCM_TX(2),
+        /* 72: XCVR_PLL_DIG->HPM_CAL_TIMING */
+        XCVR_FOLDED_HPM_CAL_TIMING,
+        /* 73: XCVR_PLL_DIG->HPM_CTRL */
+        XCVR_FOLDED_HPM_CTRL,
+        /* 74: XCVR_PLL_DIG->HPM_SDM_RES */
+        XCVR_FOLDED_HPM_SDM_RES | XCVR_PLL_DIG_HPM_SDM_RES_HPM_COUNT_ADJUST(0x02),
+        /* 75: XCVR_PLL_DIG->LOCK_DETECT */
+        XCVR_FOLDED_LOCK_DETECT,
+        /* 76: XCVR_PLL_DIG->LPM_CTRL */
+        XCVR_FOLDED_LPM_CTRL,
+        /* 77: XCVR_PLL_DIG->LPM_SDM_CTRL1 */
+        XCVR_FOLDED_LPM_SDM_CTRL1,
+        /* 78: XCVR_PLL_DIG->MOD_CTRL */
+        XCVR_FOLDED_MOD_CTRL,
+        /* 79: XCVR_PLL_DIG->PLL_DATARATE_CTRL */
+        XCVR_FOLDED_PLL_DATARATE_CTRL,
+        /* 80: XCVR_PLL_DIG->TUNING_CAP_RX_CTRL */
+        XCVR_FOLDED_TUNING_CAP_RX_CTRL,
+        /* 81: XCVR_PLL_DIG->TUNING_CAP_TX_CTRL */
+        XCVR_FOLDED_TUNING_CAP_TX_CTRL,
+        /* 82: XCVR_RX_DIG->ACQ_FILT_0_3 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x02) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x06) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x09) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x06),
+#else
+        XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x01) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x3D) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x78) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x7C),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 83: XCVR_RX_DIG->ACQ_FILT_0_3_DRS */
+        XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H0(0x00) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H1(0x00) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H2(0x00) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H3(0x00),
+        /* 84: XCVR_RX_DIG->ACQ_FILT_10_11 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x06B) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x08C),
+#else
+        XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x06F) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x0D2),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 85: XCVR_RX_DIG->ACQ_FILT_10_11_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x06A) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x09F),
+#else
+        XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x046) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x0F7),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 86: XCVR_RX_DIG->ACQ_FILT_4_7 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x7B) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x6B) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_H6(0xE1) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0xE8),
+#else
+        XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x0D) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x19) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_H6(0x07) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0xDB),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 87: XCVR_RX_DIG->ACQ_FILT_4_7_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x02) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x00) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0xF4) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0xE9),
+#else
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x7E) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x7D) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0x0B) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0x0F),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 88: XCVR_RX_DIG->ACQ_FILT_8_9 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x007) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x038),
+#else
+        XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x1C6) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x1FB),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 89: XCVR_RX_DIG->ACQ_FILT_8_9_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x1F4) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x023),
+#else
+        XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x1E1) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x1CC),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 90: XCVR_RX_DIG->AGC_CTRL */
+        XCVR_FOLDED_AGC_CTRL,
+        /* 91: XCVR_RX_DIG->AGC_CTRL_STAT */
+        XCVR_FOLDED_AGC_CTRL_STAT,
+        /* 92: XCVR_RX_DIG->AGC_IDX0_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX0_GAIN_CFG,
+        /* 93: XCVR_RX_DIG->AGC_IDX0_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX0_GAIN_VAL,
+        /* 94: XCVR_RX_DIG->AGC_IDX0_THR */
+        XCVR_FOLDED_AGC_IDX0_THR,
+        /* 95: XCVR_RX_DIG->AGC_IDX10_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX10_GAIN_CFG,
+        /* 96: XCVR_RX_DIG->AGC_IDX10_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX10_GAIN_VAL,
+        /* 97: XCVR_RX_DIG->AGC_IDX10_THR */
+        XCVR_FOLDED_AGC_IDX10_THR,
+        /* 98: XCVR_RX_DIG->AGC_IDX11_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX11_GAIN_CFG | XCVR_RX_DIG_AGC_IDX11_GAIN_CFG_MAG_THR_11_DRS_OFS(0x00) |
+            XCVR_RX_DIG_AGC_IDX11_GAIN_CFG_MAG_THR_HI_11_DRS_OFS(0x00),
+        /* 99: XCVR_RX_DIG->AGC_IDX11_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX11_GAIN_VAL | XCVR_RX_DIG_AGC_IDX11_GAIN_VAL_MAG_THR_11(0x000) |
+            XCVR_RX_DIG_AGC_IDX11_GAIN_VAL_MAG_THR_HI_11(0x000),
+        /* 100: XCVR_RX_DIG->AGC_IDX11_THR */
+        XCVR_FOLDED_AGC_IDX11_THR,
+        /* 101: XCVR_RX_DIG->AGC_IDX1_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX1_GAIN_CFG,
+        /* 102: XCVR_RX_DIG->AGC_IDX1_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX1_GAIN_VAL,
+        /* 103: XCVR_RX_DIG->AGC_IDX1_THR */
+        XCVR_FOLDED_AGC_IDX1_THR,
+        /* 104: XCVR_RX_DIG->AGC_IDX2_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX2_GAIN_CFG,
+        /* 105: XCVR_RX_DIG->AGC_IDX2_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX2_GAIN_VAL,
+        /* 106: XCVR_RX_DIG->AGC_IDX2_THR */
+        XCVR_FOLDED_AGC_IDX2_THR,
+        /* 107: XCVR_RX_DIG->AGC_IDX3_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX3_GAIN_CFG,
+        /* 108: XCVR_RX_DIG->AGC_IDX3_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX3_GAIN_VAL,
+        /* 109: XCVR_RX_DIG->AGC_IDX3_THR */
+        XCVR_FOLDED_AGC_IDX3_THR,
+        /* 110: XCVR_RX_DIG->AGC_IDX4_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX4_GAIN_CFG,
+        /* 111: XCVR_RX_DIG->AGC_IDX4_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX4_GAIN_VAL,
+        /* 112: XCVR_RX_DIG->AGC_IDX4_THR */
+        XCVR_FOLDED_AGC_IDX4_THR,
+        /* 113: XCVR_RX_DIG->AGC_IDX5_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX5_GAIN_CFG,
+        /* 114: XCVR_RX_DIG->AGC_IDX5_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX5_GAIN_VAL,
+        /* 115: XCVR_RX_DIG->AGC_IDX5_THR */
+        XCVR_FOLDED_AGC_IDX5_THR,
+        /* 116: XCVR_RX_DIG->AGC_IDX6_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX6_GAIN_CFG,
+        /* 117: XCVR_RX_DIG->AGC_IDX6_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX6_GAIN_VAL,
+        /* 118: XCVR_RX_DIG->AGC_IDX6_THR */
+        XCVR_FOLDED_AGC_IDX6_THR,
+        /* 119: XCVR_RX_DIG->AGC_IDX7_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX7_GAIN_CFG,
+        /* 120: XCVR_RX_DIG->AGC_IDX7_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX7_GAIN_VAL,
+        /* 121: XCVR_RX_DIG->AGC_IDX7_THR */
+        XCVR_FOLDED_AGC_IDX7_THR,
+        /* 122: XCVR_RX_DIG->AGC_IDX8_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX8_GAIN_CFG,
+        /* 123: XCVR_RX_DIG->AGC_IDX8_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX8_GAIN_VAL,
+        /* 124: XCVR_RX_DIG->AGC_IDX8_THR */
+        XCVR_FOLDED_AGC_IDX8_THR,
+        /* 125: XCVR_RX_DIG->AGC_IDX9_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX9_GAIN_CFG,
+        /* 126: XCVR_RX_DIG->AGC_IDX9_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX9_GAIN_VAL,
+        /* 127: XCVR_RX_DIG->AGC_IDX9_THR */
+        XCVR_FOLDED_AGC_IDX9_THR,
+        /* 128: XCVR_RX_DIG->AGC_MIS_GAIN_CFG */
+        XCVR_FOLDED_AGC_MIS_GAIN_CFG,
+        /* 129: XCVR_RX_DIG->AGC_THR_FAST */
+        XCVR_FOLDED_AGC_THR_FAST,
+        /* 130: XCVR_RX_DIG->AGC_THR_FAST_DRS */
+        XCVR_FOLDED_AGC_THR_FAST_DRS,
+        /* 131: XCVR_RX_DIG->AGC_THR_MIS */
+        XCVR_FOLDED_AGC_THR_MIS,
+        /* 132: XCVR_RX_DIG->AGC_TIMING0 */
+        XCVR_FOLDED_AGC_TIMING0 | XCVR_RX_DIG_AGC_TIMING0_AGC_GAIN_STEP_WAIT(0x10),
+        /* 133: XCVR_RX_DIG->AGC_TIMING0_DRS */
+        XCVR_FOLDED_AGC_TIMING0_DRS | XCVR_RX_DIG_AGC_TIMING0_DRS_AGC_GAIN_STEP_WAIT(0x10),
+        /* 134: XCVR_RX_DIG->AGC_TIMING1 */
+        XCVR_FOLDED_AGC_TIMING1 | XCVR_RX_DIG_AGC_TIMING1_AGC_FREEZE_TIMEOUT(0x0A) |
+            XCVR_RX_DIG_AGC_TIMING1_AGC_HOLD_TIMEOUT(0x08),
+        /* 135: XCVR_RX_DIG->AGC_TIMING1_DRS */
+        XCVR_RX_DIG_AGC_TIMING1_DRS_AGC_FREEZE_TIMEOUT(0x0A) | XCVR_RX_DIG_AGC_TIMING1_DRS_AGC_HOLD_TIMEOUT(0x08),
+        /* 136: XCVR_RX_DIG->AGC_TIMING2 */
+        XCVR_FOLDED_AGC_TIMING2 | XCVR_RX_DIG_AGC_TIMING2_AGC_UNFREEZE_FEAT_TIMEOUT(0x000) |
+            XCVR_RX_DIG_AGC_TIMING2_AGC_UNHOLD_FEAT_TIMEOUT(0x000),
+        /* 137: XCVR_RX_DIG->AGC_TIMING2_DRS */
+        XCVR_RX_DIG_AGC_TIMING2_DRS_AGC_UNFREEZE_FEAT_TIMEOUT(0x000) |
+            XCVR_RX_DIG_AGC_TIMING2_DRS_AGC_UNHOLD_FEAT_TIMEOUT(0x000),
+        /* 138: XCVR_RX_DIG->CTRL0 */
+#if RF_OSC_26MHZ == 1
+        XCVR_FOLDED_CTRL0 | XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(2) |
+            XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x027) |
+            XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(1) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#else
+        XCVR_FOLDED_CTRL0 | XCVR_RX_DIG_CTRL0_CIC_ORDER(1) | XCVR_RX_DIG_CTRL0_CIC_RATE(3) |
+            XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x020) |
+            XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(1) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 139: XCVR_RX_DIG->CTRL0_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(4) |
+            XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x027),
+#else
+        XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(1) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(5) |
+            XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x020),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 140: XCVR_RX_DIG->CTRL1 */
+        XCVR_FOLDED_CTRL1,
+        /* 141: XCVR_RX_DIG->DCOC_CTRL0 */
+        XCVR_FOLDED_DCOC_CTRL0 | XCVR_RX_DIG_DCOC_CTRL0_DCOC_DAC_ORDER(1) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFII(0x6) |
+            XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFIIP(1) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFQQ(0x5) |
+            XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFQQP(1),
+        /* 142: XCVR_RX_DIG->DCOC_CTRL0_DRS */
+        XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFII(6) | XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFIIP(1) |
+            XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFQQ(5) | XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFQQP(1),
+        /* 143: XCVR_RX_DIG->DCOC_CTRL1 */
+        XCVR_FOLDED_DCOC_CTRL1,
+        /* 144: XCVR_RX_DIG->DEMOD_FILT_0_1 */
+        XCVR_RX_DIG_DEMOD_FILT_0_1_H0(0x1FE) | XCVR_RX_DIG_DEMOD_FILT_0_1_H1(0x003),
+        /* 145: XCVR_RX_DIG->DEMOD_FILT_0_1_DRS */
+        XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H0(0x1FE) | XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H1(0x005),
+        /* 146: XCVR_RX_DIG->DEMOD_FILT_2_4 */
+        XCVR_RX_DIG_DEMOD_FILT_2_4_H2(0x02D) | XCVR_RX_DIG_DEMOD_FILT_2_4_H3(0x07D) |
+            XCVR_RX_DIG_DEMOD_FILT_2_4_H4(0x0A9),
+        /* 147: XCVR_RX_DIG->DEMOD_FILT_2_4_DRS */
+        XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H2(0x02F) | XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H3(0x07B) |
+            XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H4(0x0A4),
+        /* 148: XCVR_RX_DIG->NB_RSSI_CTRL0 */
+        XCVR_FOLDED_NB_RSSI_CTRL0,
+        /* 149: XCVR_RX_DIG->NB_RSSI_CTRL1 */
+        XCVR_FOLDED_NB_RSSI_CTRL1,
+        /* 150: XCVR_RX_DIG->RCCAL_CTRL0 */
+        XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE(2) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE_DRS(4) |
+            XCVR_RX_DIG_RCCAL_CTRL0_CBPF_CCODE_OFFSET(0x00) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE(1) |
+            XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE_DRS(1) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CMPOUT_INV(0) |
+            XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CODE_OFFSET(0x0) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_SMPL_DLY(0),
+        /* 151: XCVR_RX_DIG->RSSI_GLOBAL_CTRL */
+        XCVR_FOLDED_RSSI_GLOBAL_CTRL | XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_CCA1_ED_EN(0),
+        /* 152: XCVR_RX_DIG->WB_RSSI_CTRL */
+        XCVR_FOLDED_WB_RSSI_CTRL,
+        /* 153: XCVR_TSM->CTRL */
+        XCVR_FOLDED_CTRL,
+        /* 154: XCVR_TSM->END_OF_SEQ */
+        XCVR_FOLDED_END_OF_SEQ,
+        /* 155: XCVR_TSM->FAST_CTRL1 */
+        XCVR_FOLDED_FAST_CTRL1,
+        /* 156: XCVR_TSM->FAST_CTRL2 */
+        XCVR_FOLDED_FAST_CTRL2,
+        /* 157: XCVR_TSM->FAST_CTRL3 */
+        XCVR_FOLDED_FAST_CTRL3,
+        /* 158: XCVR_TSM->RECYCLE_COUNT */
+        XCVR_FOLDED_RECYCLE_COUNT,
+        /* 159: XCVR_TSM->TIMING00 */
+        XCVR_FOLDED_TIMING00,
+        /* 160: XCVR_TSM->TIMING01 */
+        XCVR_FOLDED_TIMING01,
+        /* 161: XCVR_TSM->TIMING02 */
+        XCVR_FOLDED_TIMING02,
+        /* 162: XCVR_TSM->TIMING03 */
+        XCVR_FOLDED_TIMING03,
+        /* 163: XCVR_TSM->TIMING04 */
+        XCVR_FOLDED_TIMING04,
+        /* 164: XCVR_TSM->TIMING05 */
+        XCVR_FOLDED_TIMING05,
+        /* 165: XCVR_TSM->TIMING06 */
+        XCVR_FOLDED_TIMING06,
+        /* 166: XCVR_TSM->TIMING07 */
+        XCVR_FOLDED_TIMING07,
+        /* 167: XCVR_TSM->TIMING08 */
+        XCVR_FOLDED_TIMING08,
+        /* 168: XCVR_TSM->TIMING09 */
+        XCVR_FOLDED_TIMING09,
+        /* 169: XCVR_TSM->TIMING10 */
+        XCVR_FOLDED_TIMING10,
+        /* 170: XCVR_TSM->TIMING11 */
+        XCVR_FOLDED_TIMING11,
+        /* 171: XCVR_TSM->TIMING12 */
+        XCVR_FOLDED_TIMING12,
+        /* 172: XCVR_TSM->TIMING13 */
+        XCVR_FOLDED_TIMING13,
+        /* 173: XCVR_TSM->TIMING14 */
+        XCVR_FOLDED_TIMING14,
+        /* 174: XCVR_TSM->TIMING15 */
+        XCVR_FOLDED_TIMING15,
+        /* 175: XCVR_TSM->TIMING16 */
+        XCVR_FOLDED_TIMING16,
+        /* 176: XCVR_TSM->TIMING17 */
+        XCVR_FOLDED_TIMING17,
+        /* 177: XCVR_TSM->TIMING18 */
+        XCVR_FOLDED_TIMING18,
+        /* 178: XCVR_TSM->TIMING19 */
+        XCVR_FOLDED_TIMING19,
+        /* 179: XCVR_TSM->TIMING20 */
+        XCVR_FOLDED_TIMING20,
+        /* 180: XCVR_TSM->TIMING21 */
+        XCVR_FOLDED_TIMING21,
+        /* 181: XCVR_TSM->TIMING22 */
+        XCVR_FOLDED_TIMING22,
+        /* 182: XCVR_TSM->TIMING23 */
+        XCVR_FOLDED_TIMING23,
+        /* 183: XCVR_TSM->TIMING24 */
+        XCVR_FOLDED_TIMING24,
+        /* 184: XCVR_TSM->TIMING25 */
+        XCVR_FOLDED_TIMING25,
+        /* 185: XCVR_TSM->TIMING26 */
+        XCVR_FOLDED_TIMING26,
+        /* 186: XCVR_TSM->TIMING27 */
+        XCVR_FOLDED_TIMING27,
+        /* 187: XCVR_TSM->TIMING28 */
+        XCVR_FOLDED_TIMING28,
+        /* 188: XCVR_TSM->TIMING29 */
+        XCVR_FOLDED_TIMING29,
+        /* 189: XCVR_TSM->TIMING30 */
+        XCVR_FOLDED_TIMING30,
+        /* 190: XCVR_TSM->TIMING31 */
+        XCVR_FOLDED_TIMING31,
+        /* 191: XCVR_TSM->TIMING32 */
+        XCVR_FOLDED_TIMING32,
+        /* 192: XCVR_TSM->TIMING33 */
+        XCVR_FOLDED_TIMING33,
+        /* 193: XCVR_TSM->TIMING34 */
+        XCVR_FOLDED_TIMING34,
+        /* 194: XCVR_TSM->TIMING35 */
+        XCVR_FOLDED_TIMING35,
+        /* 195: XCVR_TSM->TIMING36 */
+        XCVR_FOLDED_TIMING36,
+        /* 196: XCVR_TSM->TIMING37 */
+        XCVR_FOLDED_TIMING37,
+        /* 197: XCVR_TSM->TIMING38 */
+        XCVR_FOLDED_TIMING38,
+        /* 198: XCVR_TSM->TIMING39 */
+        XCVR_FOLDED_TIMING39,
+        /* 199: XCVR_TSM->TIMING40 */
+        XCVR_FOLDED_TIMING40,
+        /* 200: XCVR_TSM->TIMING41 */
+        XCVR_FOLDED_TIMING41,
+        /* 201: XCVR_TSM->TIMING42 */
+        XCVR_FOLDED_TIMING42,
+        /* 202: XCVR_TSM->TIMING43 */
+        XCVR_FOLDED_TIMING43,
+        /* 203: XCVR_TSM->TIMING44 */
+        XCVR_FOLDED_TIMING44,
+        /* 204: XCVR_TSM->TIMING45 */
+        XCVR_FOLDED_TIMING45,
+        /* 205: XCVR_TSM->TIMING46 */
+        XCVR_FOLDED_TIMING46,
+        /* 206: XCVR_TSM->TIMING47 */
+        XCVR_FOLDED_TIMING47,
+        /* 207: XCVR_TSM->TIMING48 */
+        XCVR_FOLDED_TIMING48,
+        /* 208: XCVR_TSM->TIMING49 */
+        XCVR_FOLDED_TIMING49,
+        /* 209: XCVR_TSM->TIMING50 */
+        XCVR_FOLDED_TIMING50,
+        /* 210: XCVR_TSM->TIMING51 */
+        XCVR_FOLDED_TIMING51,
+        /* 211: XCVR_TSM->TIMING52 */
+        XCVR_FOLDED_TIMING52,
+        /* 212: XCVR_TSM->WU_LATENCY */
+        XCVR_FOLDED_WU_LATENCY,
+        /* 213: XCVR_TX_DIG->DATARATE_CONFIG_FILTER_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(3) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(2) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(1),
+#else
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(4) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(3) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(2) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(1),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 214: XCVR_TX_DIG->DATARATE_CONFIG_FSK_CTRL */
+        XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV0(0x0000) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV1(0x0000),
+        /* 215: XCVR_TX_DIG->DATARATE_CONFIG_GFSK_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x00CB),
+#else
+        XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x00A5),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 216: XCVR_TX_DIG->DATA_PADDING_CTRL */
+        XCVR_FOLDED_DATA_PADDING_CTRL | XCVR_TX_DIG_DATA_PADDING_CTRL_DATA_PADDING_SEL(0) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_PAD_DLY(0) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_PAD_DLY_EN(1),
+        /* 217: XCVR_TX_DIG->DATA_PADDING_CTRL_1 */
+        XCVR_FOLDED_DATA_PADDING_CTRL_1 | XCVR_TX_DIG_DATA_PADDING_CTRL_1_RAMP_UP_DLY(0x04) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_1_TX_DATA_FLUSH_DLY(0x04),
+        /* 218: XCVR_TX_DIG->DATA_PADDING_CTRL_2 */
+        XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_MFDEV(0x1800) | XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_PFDEV(0x0800),
+        /* 219: XCVR_TX_DIG->FSK_CTRL */
+        XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_0(0x1800) | XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_1(0x0800),
+        /* 220: XCVR_TX_DIG->GFSK_COEFF_0_1 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_0(0x017) | XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_1(0x029),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_0(0x001) | XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_1(0x004),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 221: XCVR_TX_DIG->GFSK_COEFF_2_3 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_2(0x044) | XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_3(0x067),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_2(0x00D) | XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_3(0x028),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 222: XCVR_TX_DIG->GFSK_COEFF_4_5 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_4(0x090) | XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_5(0x0BA),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_4(0x063) | XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_5(0x0C0),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 223: XCVR_TX_DIG->GFSK_COEFF_6_7 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_6(0x0DC) | XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_7(0x0EF),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_6(0x12C) | XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_7(0x176),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 224: XCVR_TX_DIG->GFSK_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(0) |
+            XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x032B),
+#else
+        XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(0) |
+            XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x0293),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 225: XCVR_TX_DIG->IMAGE_FILTER_CTRL */
+        XCVR_FOLDED_IMAGE_FILTER_CTRL | XCVR_TX_DIG_IMAGE_FILTER_CTRL_IMAGE_FILTER_OVRD_EN(0),
+        /* 226: XCVR_TX_DIG->PA_CTRL */
+        XCVR_FOLDED_PA_CTRL | XCVR_TX_DIG_PA_CTRL_PA_RAMP_SEL(1),
+        /* 227: XCVR_TX_DIG->PA_RAMP_TBL0 */
+        XCVR_FOLDED_PA_RAMP_TBL0,
+        /* 228: XCVR_TX_DIG->PA_RAMP_TBL1 */
+        XCVR_FOLDED_PA_RAMP_TBL1,
+        /* 229: XCVR_TX_DIG->PA_RAMP_TBL2 */
+        XCVR_FOLDED_PA_RAMP_TBL2,
+        /* 230: XCVR_TX_DIG->PA_RAMP_TBL3 */
+        XCVR_FOLDED_PA_RAMP_TBL3,
+        /* 231: XCVR_TX_DIG->SWITCH_TX_CTRL */
+        XCVR_FOLDED_SWITCH_TX_CTRL,
+        /* 232: XCVR_TX_DIG->TXDIG_CTRL */
+        XCVR_FOLDED_TXDIG_CTRL | XCVR_TX_DIG_TXDIG_CTRL_DATA_STREAM_SEL(0) | XCVR_TX_DIG_TXDIG_CTRL_MODULATOR_SEL(0) |
+            XCVR_TX_DIG_TXDIG_CTRL_PFC_EN(0),
+    },
+};
+
+const xcvr_folded_config_t xcvr_gfsk_bt_0p5_h_0p5_1mbps_folded_config = {
+    .config     = &xcvr_gfsk_bt_0p5_h_0p5_1mbps_full_config,
+    .reg_values = {
+        /* 0: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x13) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x0F) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x0B) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x08) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+        /* 1: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x35) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x31),
+        /* 2: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x2D) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x29) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x25),
+        /* 3: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x13) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x0F) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x0B) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x08) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+        /* 4: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x35) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x38),
+        /* 5: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x3C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x04),
+        /* 6: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x0B) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x08) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x04) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+        /* 7: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0B) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x08),
+        /* 8: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x04) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x3C),
+        /* 9: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x0B) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x08) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x04) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+        /* 10: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0B) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x0F),
+        /* 11: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x13) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x17) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x1B),
+        /* 12: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x35) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x38) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x3C) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+        /* 13: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x35) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x31),
+        /* 14: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x2D) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x29) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x25),
+        /* 15: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x35) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x38) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x3C) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+        /* 16: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x35) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x38),
+        /* 17: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x3C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x04),
+        /* 18: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x2D) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x31) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x35) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x38) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+        /* 19: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0B) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x08),
+        /* 20: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x04) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x3C),
+        /* 21: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x2D) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x31) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x35) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x38) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+        /* 22: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0B) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x0F),
+        /* 23: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x13) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x17) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x1B),
+        /* 24: GEN4PHY->DMD_CTRL0 */
+        XCVR_FOLDED_DMD_CTRL0,
+        /* 25: GEN4PHY->DMD_CTRL1 */
+        XCVR_FOLDED_DMD_CTRL1,
+        /* 26: GEN4PHY->FSK_CFG0 */
+        XCVR_FOLDED_FSK_CFG0 | GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_1M(0x15) |
+            GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_2M(0x15) |
+            GEN4PHY_FSK_CFG0_MSK2FSK_SEED(0) | GEN4PHY_FSK_CFG0_MSK_EN(0),
+        /* 27: GEN4PHY->FSK_CFG1 */
+        GEN4PHY_FSK_CFG1_OVERH(0x020) | GEN4PHY_FSK_CFG1_OVERH_INV(0x100) | GEN4PHY_FSK_CFG1_SYNCTSCALE(0xF),
+        /* 28: GEN4PHY->FSK_CFG2 */
+        XCVR_FOLDED_FSK_CFG2,
+        /* 29: GEN4PHY->FSK_FAD_CFG */
+        XCVR_FOLDED_FSK_FAD_CFG,
+        /* 30: GEN4PHY->FSK_FAD_CTRL */
+        XCVR_FOLDED_FSK_FAD_CTRL,
+        /* 31: GEN4PHY->FSK_PD_CFG0 */
+        GEN4PHY_FSK_PD_CFG0_PD_IIR_ALPHA(0xFF) | GEN4PHY_FSK_PD_CFG0_PREAMBLE_T_SCALE(0xC),
+        /* 32: GEN4PHY->FSK_PD_CFG1 */
+        GEN4PHY_FSK_PD_CFG1_PREAMBLE_PATTERN(0x55),
+        /* 33: GEN4PHY->FSK_PD_CFG2 */
+        GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_1M(0xF6) | GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_2M(0xF6),
+        /* 34: GEN4PHY->FSK_PD_PH[0] */
+        GEN4PHY_FSK_PD_PH_REF0(0x03) | GEN4PHY_FSK_PD_PH_REF1(0x05) | GEN4PHY_FSK_PD_PH_REF2(0x03) |
+            GEN4PHY_FSK_PD_PH_REF3(0x00),
+        /* 35: GEN4PHY->FSK_PD_PH[1] */
+        GEN4PHY_FSK_PD_PH_REF0(0x3D) | GEN4PHY_FSK_PD_PH_REF1(0x3B) | GEN4PHY_FSK_PD_PH_REF2(0x3D) |
+            GEN4PHY_FSK_PD_PH_REF3(0x00),
+        /* 36: GEN4PHY->FSK_PT */
+        XCVR_FOLDED_FSK_PT | GEN4PHY_FSK_PT_AGC_TIMEOUT(0x0048),
+        /* 37: GEN4PHY->LR_AA_CFG */
+        GEN4PHY_LR_AA_CFG_AA_COR_THRESH(0x96) | GEN4PHY_LR_AA_CFG_AA_HAM_THRESH(0x06) |
+            GEN4PHY_LR_AA_CFG_AA_LR_CORR_GAIN(0x06) | GEN4PHY_LR_AA_CFG_ACCESS_ADDR_HAM(0x02),
+        /* 38: GEN4PHY->LR_PD_CFG */
+        GEN4PHY_LR_PD_CFG_CORR_TH(0x9a) | GEN4PHY_LR_PD_CFG_FREQ_TH(0x01) | GEN4PHY_LR_PD_CFG_NO_PEAKS(1),
+        /* 39: GEN4PHY->LR_PD_PH[0] */
+        GEN4PHY_LR_PD_PH_REF0(0x28) | GEN4PHY_LR_PD_PH_REF1(0x30) | GEN4PHY_LR_PD_PH_REF2(0x38) |
+            GEN4PHY_LR_PD_PH_REF3(0x3D),
+        /* 40: GEN4PHY->LR_PD_PH[1] */
+        GEN4PHY_LR_PD_PH_REF0(0x38) | GEN4PHY_LR_PD_PH_REF1(0x30) | GEN4PHY_LR_PD_PH_REF2(0x28) |
+            GEN4PHY_LR_PD_PH_REF3(0x20),
+        /* 41: GEN4PHY->LR_PD_PH[2] */
+        GEN4PHY_LR_PD_PH_REF0(0x18) | GEN4PHY_LR_PD_PH_REF1(0x10) | GEN4PHY_LR_PD_PH_REF2(0x08) |
+            GEN4PHY_LR_PD_PH_REF3(0x03),
+        /* 42: GEN4PHY->LR_PD_PH[3] */
+        GEN4PHY_LR_PD_PH_REF0(0x08) | GEN4PHY_LR_PD_PH_REF1(0x10) | GEN4PHY_LR_PD_PH_REF2(0x18) |
+            GEN4PHY_LR_PD_PH_REF3(0x20),
+        /* 43: GEN4PHY->MISC */
+        XCVR_FOLDED_MISC,
+        /* 44: GEN4PHY->PREPHY_MISC */
+        XCVR_FOLDED_PREPHY_MISC,
+        /* 45: GEN4PHY->RTT_CTRL */
+        XCVR_FOLDED_RTT_CTRL,
+        /* 46: GEN4PHY->RTT_REF */
+        GEN4PHY_RTT_REF_FM_REF_010(0x48) | GEN4PHY_RTT_REF_FM_REF_110(0x63) | GEN4PHY_RTT_REF_FM_REF_111(0x80),
+        /* 47: GEN4PHY->SM_CFG */
+        XCVR_FOLDED_SM_CFG | GEN4PHY_SM_CFG_AA_TIMEOUT_UNCODED(0x0A0),
+        /* 48: RADIO_CTRL->LL_CTRL */
+        RADIO_CTRL_LL_CTRL_ACTIVE_LL(0),
+        /* 49: XCVR_ANALOG->LDO_0 */
+        XCVR_FOLDED_LDO_0,
+        /* 50: XCVR_ANALOG->LDO_1 */
+        XCVR_FOLDED_LDO_1,
+        /* 51: XCVR_ANALOG->PLL */
+        XCVR_FOLDED_PLL,
+        /* 52: XCVR_ANALOG->RX_0 */
+        XCVR_FOLDED_RX_0,
+        /* 53: XCVR_ANALOG->RX_1 */
+        XCVR_FOLDED_RX_1,
+        /* 54: XCVR_ANALOG->TX_DAC_PA */
+        XCVR_FOLDED_TX_DAC_PA | XCVR_ANALOG_TX_DAC_PA_DAC_TRIM_CFBK_DRS(0),
+        /* 55: XCVR_ANALOG->XO_DIST */
+        XCVR_FOLDED_XO_DIST,
+        /* 56: XCVR_MISC->IPS_FO_ADDR[0] */
+        XCVR_MISC_IPS_FO_ADDR_ADDR(0x32C) | XCVR_MISC_IPS_FO_ADDR_ENTRY_RX(1) | XCVR_MISC_IPS_FO_ADDR_ENTRY_TX(1),
+        /* 57: XCVR_MISC->IPS_FO_ADDR[1] */
+        XCVR_MISC_IPS_FO_ADDR_ADDR(0x034) | XCVR_MISC_IPS_FO_ADDR_ENTRY_RX(0) | XCVR_MISC_IPS_FO_ADDR_ENTRY_TX(0),
+        /* 58: XCVR_MISC->IPS_FO_DRS0_DATA[0] */
+        XCVR_MISC_IPS_FO_DRS0_DATA_DRS0_DATA(0x20FF0000),
+        /* 59: XCVR_MISC->IPS_FO_DRS0_DATA[1] */
+        XCVR_MISC_IPS_FO_DRS0_DATA_DRS0_DATA(0x00000000),
+        /* 60: XCVR_MISC->IPS_FO_DRS1_DATA[0] */
+        XCVR_MISC_IPS_FO_DRS1_DATA_DRS1_DATA(0x10FF0000),
+        /* 61: XCVR_MISC->IPS_FO_DRS1_DATA[1] */
+        XCVR_MISC_IPS_FO_DRS1_DATA_DRS1_DATA(0x00000000),
+        /* 62: XCVR_MISC->LDO_TRIM_0 */
+        XCVR_FOLDED_LDO_TRIM_0,
+        /* 63: XCVR_MISC->LDO_TRIM_1 */
+        XCVR_FOLDED_LDO_TRIM_1,
+        /* 64: XCVR_MISC->XCVR_CTRL */
+        XCVR_FOLDED_XCVR_CTRL | XCVR_MISC_XCVR_CTRL_DATA_RATE_DRS(0) | XCVR_MISC_XCVR_CTRL_DEMOD_SEL(1) |
+            XCVR_MISC_XCVR_CTRL_LL_CFG_CAPT_DIS(0),
+        /* 65: XCVR_PLL_DIG->CHAN_MAP */
+        XCVR_FOLDED_CHAN_MAP | XCVR_PLL_DIG_CHAN_MAP_BAND_SELECT(0),
+        /* 66: XCVR_PLL_DIG->CHAN_MAP_EXT */
+#if RF_OSC_26MHZ == 1
+        XCVR_FOLDED_CHAN_MAP_EXT | XCVR_PLL_DIG_CHAN_MAP_EXT_NUM_OFFSET(0x013B13B),
+#else
+        XCVR_FOLDED_CHAN_MAP_EXT | XCVR_PLL_DIG_CHAN_MAP_EXT_NUM_OFFSET(0x0100000),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 67: XCVR_PLL_DIG->DATA_RATE_OVRD_CTRL1 */
+        XCVR_FOLDED_DATA_RATE_OVRD_CTRL1,
+        /* 68: XCVR_PLL_DIG->DATA_RATE_OVRD_CTRL2 */
+#if RF_OSC_26MHZ == 1
+        XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL2_NUM_OFFSET_CFG1(0x01D89D9),
+#else
+        XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL2_NUM_OFFSET_CFG1(0x0180000),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 69: XCVR_PLL_DIG->DELAY_MATCH */
+#if RF_OSC_26MHZ == 1
+        XCVR_FOLDED_DELAY_MATCH | XCVR_PLL_DIG_DELAY_MATCH_HPM_INTEGER_DELAY(0x04) |
+            XCVR_PLL_DIG_DELAY_MATCH_LPM_SDM_DELAY(0x02),
+#else
+        XCVR_FOLDED_DELAY_MATCH | XCVR_PLL_DIG_DELAY_MATCH_HPM_INTEGER_DELAY(0x04) |
+            XCVR_PLL_DIG_DELAY_MATCH_LPM_SDM_DELAY(0x03),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 70: XCVR_PLL_DIG->HPMCAL_CTRL */
+        XCVR_FOLDED_HPMCAL_CTRL | XCVR_PLL_DIG_HPMCAL_CTRL_HPM_CAL_ARRAY_SIZE(0),
+        /* 71: XCVR_PLL_DIG->HPM_BUMP */
+        XCVR_FOLDED_HPM_BUMP | XCVR_PLL_DIG_HPM_BUMP_HPM_VCM_CAL(2) | XCVR_PLL_DIG_HPM_BUMP_HPM_VCM_TX(2),
+        /* 72: XCVR_PLL_DIG->HPM_CAL_TIMING */
+        XCVR_FOLDED_HPM_CAL_TIMING,
+        /* 73: XCVR_PLL_DIG->HPM_CTRL */
+        XCVR_FOLDED_HPM_CTRL,
+        /* 74: XCVR_PLL_DIG->HPM_SDM_RES */
+        XCVR_FOLDED_HPM_SDM_RES | XCVR_PLL_DIG_HPM_SDM_RES_HPM_COUNT_ADJUST(0x02),
+        /* 75: XCVR_PLL_DIG->LOCK_DETECT */
+        XCVR_FOLDED_LOCK_DETECT,
+        /* 76: XCVR_PLL_DIG->LPM_CTRL */
+        XCVR_FOLDED_LPM_CTRL,
+        /* 77: XCVR_PLL_DIG->LPM_SDM_CTRL1 */
+        XCVR_FOLDED_LPM_SDM_CTRL1,
+        /* 78: XCVR_PLL_DIG->MOD_CTRL */
+        XCVR_FOLDED_MOD_CTRL,
+        /* 79: XCVR_PLL_DIG->PLL_DATARATE_CTRL */
+        XCVR_FOLDED_PLL_DATARATE_CTRL,
+        /* 80: XCVR_PLL_DIG->TUNING_CAP_RX_CTRL */
+        XCVR_FOLDED_TUNING_CAP_RX_CTRL,
+        /* 81: XCVR_PLL_DIG->TUNING_CAP_TX_CTRL */
+        XCVR_FOLDED_TUNING_CAP_TX_CTRL,
+        /* 82: XCVR_RX_DIG->ACQ_FILT_0_3 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x02) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x08) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x0B) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x07),
+#else
+        XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x02) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x02) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x7A) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x75),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 83: XCVR_RX_DIG->ACQ_FILT_0_3_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H0(0x01) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H1(0x3D) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H2(0x77) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H3(0x72),
+#else
+        XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H0(0x3E) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H1(0x3E) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H2(0x02) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H3(0x09),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 84: XCVR_RX_DIG->ACQ_FILT_10_11 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x067) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x084),
+#else
+        XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x068) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x0DE),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 85: XCVR_RX_DIG->ACQ_FILT_10_11_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x050) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x05A),
+#else
+        XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x06E) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x0A1),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 86: XCVR_RX_DIG->ACQ_FILT_4_7 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x7C) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x6C) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_H6(0xE3) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0xEB),
+#else
+        XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x01) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x18) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_H6(0x17) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0xEB),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 87: XCVR_RX_DIG->ACQ_FILT_4_7_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x71) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x75) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0x00) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0x12),
+#else
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x0B) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x00) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0xEB) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0xDE),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 88: XCVR_RX_DIG->ACQ_FILT_8_9 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x009) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x037),
+#else
+        XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x1C2) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x1E9),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 89: XCVR_RX_DIG->ACQ_FILT_8_9_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x028) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x03E),
+#else
+        XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x1F0) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x026),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 90: XCVR_RX_DIG->AGC_CTRL */
+        XCVR_FOLDED_AGC_CTRL,
+        /* 91: XCVR_RX_DIG->AGC_CTRL_STAT */
+        XCVR_FOLDED_AGC_CTRL_STAT,
+        /* 92: XCVR_RX_DIG->AGC_IDX0_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX0_GAIN_CFG,
+        /* 93: XCVR_RX_DIG->AGC_IDX0_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX0_GAIN_VAL,
+        /* 94: XCVR_RX_DIG->AGC_IDX0_THR */
+        XCVR_FOLDED_AGC_IDX0_THR,
+        /* 95: XCVR_RX_DIG->AGC_IDX10_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX10_GAIN_CFG,
+        /* 96: XCVR_RX_DIG->AGC_IDX10_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX10_GAIN_VAL,
+        /* 97: XCVR_RX_DIG->AGC_IDX10_THR */
+        XCVR_FOLDED_AGC_IDX10_THR,
+        /* 98: XCVR_RX_DIG->AGC_IDX11_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX11_GAIN_CFG | XCVR_RX_DIG_AGC_IDX11_GAIN_CFG_MAG_THR_11_DRS_OFS(0x02) |
+            XCVR_RX_DIG_AGC_IDX11_GAIN_CFG_MAG_THR_HI_11_DRS_OFS(0x04),
+        /* 99: XCVR_RX_DIG->AGC_IDX11_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX11_GAIN_VAL | XCVR_RX_DIG_AGC_IDX11_GAIN_VAL_MAG_THR_11(0x003) |
+            XCVR_RX_DIG_AGC_IDX11_GAIN_VAL_MAG_THR_HI_11(0x005),
+        /* 100: XCVR_RX_DIG->AGC_IDX11_THR */
+        XCVR_FOLDED_AGC_IDX11_THR,
+        /* 101: XCVR_RX_DIG->AGC_IDX1_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX1_GAIN_CFG,
+        /* 102: XCVR_RX_DIG->AGC_IDX1_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX1_GAIN_VAL,
+        /* 103: XCVR_RX_DIG->AGC_IDX1_THR */
+        XCVR_FOLDED_AGC_IDX1_THR,
+        /* 104: XCVR_RX_DIG->AGC_IDX2_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX2_GAIN_CFG,
+        /* 105: XCVR_RX_DIG->AGC_IDX2_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX2_GAIN_VAL,
+        /* 106: XCVR_RX_DIG->AGC_IDX2_THR */
+        XCVR_FOLDED_AGC_IDX2_THR,
+        /* 107: XCVR_RX_DIG->AGC_IDX3_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX3_GAIN_CFG,
+        /* 108: XCVR_RX_DIG->AGC_IDX3_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX3_GAIN_VAL,
+        /* 109: XCVR_RX_DIG->AGC_IDX3_THR */
+        XCVR_FOLDED_AGC_IDX3_THR,
+        /* 110: XCVR_RX_DIG->AGC_IDX4_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX4_GAIN_CFG,
+        /* 111: XCVR_RX_DIG->AGC_IDX4_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX4_GAIN_VAL,
+        /* 112: XCVR_RX_DIG->AGC_IDX4_THR */
+        XCVR_FOLDED_AGC_IDX4_THR,
+        /* 113: XCVR_RX_DIG->AGC_IDX5_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX5_GAIN_CFG,
+        /* 114: XCVR_RX_DIG->AGC_IDX5_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX5_GAIN_VAL,
+        /* 115: XCVR_RX_DIG->AGC_IDX5_THR */
+        XCVR_FOLDED_AGC_IDX5_THR,
+        /* 116: XCVR_RX_DIG->AGC_IDX6_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX6_GAIN_CFG,
+        /* 117: XCVR_RX_DIG->AGC_IDX6_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX6_GAIN_VAL,
+        /* 118: XCVR_RX_DIG->AGC_IDX6_THR */
+        XCVR_FOLDED_AGC_IDX6_THR,
+        /* 119: XCVR_RX_DIG->AGC_IDX7_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX7_GAIN_CFG,
+        /* 120: XCVR_RX_DIG->AGC_IDX7_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX7_GAIN_VAL,
+        /* 121: XCVR_RX_DIG->AGC_IDX7_THR */
+        XCVR_FOLDED_AGC_IDX7_THR,
+        /* 122: XCVR_RX_DIG->AGC_IDX8_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX8_GAIN_CFG,
+        /* 123: XCVR_RX_DIG->AGC_IDX8_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX8_GAIN_VAL,
+        /* 124: XCVR_RX_DIG->AGC_IDX8_THR */
+        XCVR_FOLDED_AGC_IDX8_THR,
+        /* 125: XCVR_RX_DIG->AGC_IDX9_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX9_GAIN_CFG,
+        /* 126: XCVR_RX_DIG->AGC_IDX9_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX9_GAIN_VAL,
+        /* 127: XCVR_RX_DIG->AGC_IDX9_THR */
+        XCVR_FOLDED_AGC_IDX9_THR,
+        /* 128: XCVR_RX_DIG->AGC_MIS_GAIN_CFG */
+        XCVR_FOLDED_AGC_MIS_GAIN_CFG,
+        /* 129: XCVR_RX_DIG->AGC_THR_FAST */
+        XCVR_FOLDED_AGC_THR_FAST,
+        /* 130: XCVR_RX_DIG->AGC_THR_FAST_DRS */
+        XCVR_FOLDED_AGC_THR_FAST_DRS,
+        /* 131: XCVR_RX_DIG->AGC_THR_MIS */
+        XCVR_FOLDED_AGC_THR_MIS,
+        /* 132: XCVR_RX_DIG->AGC_TIMING0 */
+        XCVR_FOLDED_AGC_TIMING0 | XCVR_RX_DIG_AGC_TIMING0_AGC_GAIN_STEP_WAIT(0x08),
+        /* 133: XCVR_RX_DIG->AGC_TIMING0_DRS */
+        XCVR_FOLDED_AGC_TIMING0_DRS | XCVR_RX_DIG_AGC_TIMING0_DRS_AGC_GAIN_STEP_WAIT(0x08),
+        /* 134: XCVR_RX_DIG->AGC_TIMING1 */
+        XCVR_FOLDED_AGC_TIMING1 | XCVR_RX_DIG_AGC_TIMING1_AGC_FREEZE_TIMEOUT(0x27) |
+            XCVR_RX_DIG_AGC_TIMING1_AGC_HOLD_TIMEOUT(0x05),
+        /* 135: XCVR_RX_DIG->AGC_TIMING1_DRS */
+        XCVR_RX_DIG_AGC_TIMING1_DRS_AGC_FREEZE_TIMEOUT(0x27) | XCVR_RX_DIG_AGC_TIMING1_DRS_AGC_HOLD_TIMEOUT(0x05),
+        /* 136: XCVR_RX_DIG->AGC_TIMING2 */
+        XCVR_FOLDED_AGC_TIMING2 | XCVR_RX_DIG_AGC_TIMING2_AGC_UNFREEZE_FEAT_TIMEOUT(0x07F) |
+            XCVR_RX_DIG_AGC_TIMING2_AGC_UNHOLD_FEAT_TIMEOUT(0x000),
+        /* 137: XCVR_RX_DIG->AGC_TIMING2_DRS */
+        XCVR_RX_DIG_AGC_TIMING2_DRS_AGC_UNFREEZE_FEAT_TIMEOUT(0x07F) |
+            XCVR_RX_DIG_AGC_TIMING2_DRS_AGC_UNHOLD_FEAT_TIMEOUT(0x000),
+        /* 138: XCVR_RX_DIG->CTRL0 */
+#if RF_OSC_26MHZ == 1
+        XCVR_FOLDED_CTRL0 | XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(2) |
+            XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x027) |
+            XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(0) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#else
+        XCVR_FOLDED_CTRL0 | XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(3) |
+            XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x020) |
+            XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(0) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 139: XCVR_RX_DIG->CTRL0_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(1) |
+            XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x03B),
+#else
+        XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(2) |
+            XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x030),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 140: XCVR_RX_DIG->CTRL1 */
+        XCVR_FOLDED_CTRL1,
+        /* 141: XCVR_RX_DIG->DCOC_CTRL0 */
+        XCVR_FOLDED_DCOC_CTRL0 | XCVR_RX_DIG_DCOC_CTRL0_DCOC_DAC_ORDER(0) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFII(0x8) |
+            XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFIIP(1) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFQQ(0x2) |
+            XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFQQP(0),
+        /* 142: XCVR_RX_DIG->DCOC_CTRL0_DRS */
+        XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFII(4) | XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFIIP(1) |
+            XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFQQ(1) | XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFQQP(0),
+        /* 143: XCVR_RX_DIG->DCOC_CTRL1 */
+        XCVR_FOLDED_DCOC_CTRL1,
+        /* 144: XCVR_RX_DIG->DEMOD_FILT_0_1 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_DEMOD_FILT_0_1_H0(0x1FD) | XCVR_RX_DIG_DEMOD_FILT_0_1_H1(0x1FC),
+#else
+        XCVR_RX_DIG_DEMOD_FILT_0_1_H0(0x1FD) | XCVR_RX_DIG_DEMOD_FILT_0_1_H1(0x1FE),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 145: XCVR_RX_DIG->DEMOD_FILT_0_1_DRS */
+        XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H0(0x1FD) | XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H1(0x1FE),
+        /* 146: XCVR_RX_DIG->DEMOD_FILT_2_4 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_DEMOD_FILT_2_4_H2(0x01F) | XCVR_RX_DIG_DEMOD_FILT_2_4_H3(0x085) |
+            XCVR_RX_DIG_DEMOD_FILT_2_4_H4(0x0C4),
+#else
+        XCVR_RX_DIG_DEMOD_FILT_2_4_H2(0x024) | XCVR_RX_DIG_DEMOD_FILT_2_4_H3(0x083) |
+            XCVR_RX_DIG_DEMOD_FILT_2_4_H4(0x0BC),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 147: XCVR_RX_DIG->DEMOD_FILT_2_4_DRS */
+        XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H2(0x023) | XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H3(0x083) |
+            XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H4(0x0BC),
+        /* 148: XCVR_RX_DIG->NB_RSSI_CTRL0 */
+        XCVR_FOLDED_NB_RSSI_CTRL0,
+        /* 149: XCVR_RX_DIG->NB_RSSI_CTRL1 */
+        XCVR_FOLDED_NB_RSSI_CTRL1,
+        /* 150: XCVR_RX_DIG->RCCAL_CTRL0 */
+        XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE(2) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE_DRS(1) |
+            XCVR_RX_DIG_RCCAL_CTRL0_CBPF_CCODE_OFFSET(0x00) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE(1) |
+            XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE_DRS(0) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CMPOUT_INV(0) |
+            XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CODE_OFFSET(0x0) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_SMPL_DLY(0),
+        /* 151: XCVR_RX_DIG->RSSI_GLOBAL_CTRL */
+        XCVR_FOLDED_RSSI_GLOBAL_CTRL | XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_CCA1_ED_EN(0),
+        /* 152: XCVR_RX_DIG->WB_RSSI_CTRL */
+        XCVR_FOLDED_WB_RSSI_CTRL,
+        /* 153: XCVR_TSM->CTRL */
+        XCVR_FOLDED_CTRL,
+        /* 154: XCVR_TSM->END_OF_SEQ */
+        XCVR_FOLDED_END_OF_SEQ,
+        /* 155: XCVR_TSM->FAST_CTRL1 */
+        XCVR_FOLDED_FAST_CTRL1,
+        /* 156: XCVR_TSM->FAST_CTRL2 */
+        XCVR_FOLDED_FAST_CTRL2,
+        /* 157: XCVR_TSM->FAST_CTRL3 */
+        XCVR_FOLDED_FAST_CTRL3,
+        /* 158: XCVR_TSM->RECYCLE_COUNT */
+        XCVR_FOLDED_RECYCLE_COUNT,
+        /* 159: XCVR_TSM->TIMING00 */
+        XCVR_FOLDED_TIMING00,
+        /* 160: XCVR_TSM->TIMING01 */
+        XCVR_FOLDED_TIMING01,
+        /* 161: XCVR_TSM->TIMING02 */
+        XCVR_FOLDED_TIMING02,
+        /* 162: XCVR_TSM->TIMING03 */
+        XCVR_FOLDED_TIMING03,
+        /* 163: XCVR_TSM->TIMING04 */
+        XCVR_FOLDED_TIMING04,
+        /* 164: XCVR_TSM->TIMING05 */
+        XCVR_FOLDED_TIMING05,
+        /* 165: XCVR_TSM->TIMING06 */
+        XCVR_FOLDED_TIMING06,
+        /* 166: XCVR_TSM->TIMING07 */
+        XCVR_FOLDED_TIMING07,
+        /* 167: XCVR_TSM->TIMING08 */
+        XCVR_FOLDED_TIMING08,
+        /* 168: XCVR_TSM->TIMING09 */
+        XCVR_FOLDED_TIMING09,
+        /* 169: XCVR_TSM->TIMING10 */
+        XCVR_FOLDED_TIMING10,
+        /* 170: XCVR_TSM->TIMING11 */
+        XCVR_FOLDED_TIMING11,
+        /* 171: XCVR_TSM->TIMING12 */
+        XCVR_FOLDED_TIMING12,
+        /* 172: XCVR_TSM->TIMING13 */
+        XCVR_FOLDED_TIMING13,
+        /* 173: XCVR_TSM->TIMING14 */
+        XCVR_FOLDED_TIMING14,
+        /* 174: XCVR_TSM->TIMING15 */
+        XCVR_FOLDED_TIMING15,
+        /* 175: XCVR_TSM->TIMING16 */
+        XCVR_FOLDED_TIMING16,
+        /* 176: XCVR_TSM->TIMING17 */
+        XCVR_FOLDED_TIMING17,
+        /* 177: XCVR_TSM->TIMING18 */
+        XCVR_FOLDED_TIMING18,
+        /* 178: XCVR_TSM->TIMING19 */
+        XCVR_FOLDED_TIMING19,
+        /* 179: XCVR_TSM->TIMING20 */
+        XCVR_FOLDED_TIMING20,
+        /* 180: XCVR_TSM->TIMING21 */
+        XCVR_FOLDED_TIMING21,
+        /* 181: XCVR_TSM->TIMING22 */
+        XCVR_FOLDED_TIMING22,
+        /* 182: XCVR_TSM->TIMING23 */
+        XCVR_FOLDED_TIMING23,
+        /* 183: XCVR_TSM->TIMING24 */
+        XCVR_FOLDED_TIMING24,
+        /* 184: XCVR_TSM->TIMING25 */
+        XCVR_FOLDED_TIMING25,
+        /* 185: XCVR_TSM->TIMING26 */
+        XCVR_FOLDED_TIMING26,
+        /* 186: XCVR_TSM->TIMING27 */
+        XCVR_FOLDED_TIMING27,
+        /* 187: XCVR_TSM->TIMING28 */
+        XCVR_FOLDED_TIMING28,
+        /* 188: XCVR_TSM->TIMING29 */
+        XCVR_FOLDED_TIMING29,
+        /* 189: XCVR_TSM->TIMING30 */
+        XCVR_FOLDED_TIMING30,
+        /* 190: XCVR_TSM->TIMING31 */
+        XCVR_FOLDED_TIMING31,
+        /* 191: XCVR_TSM->TIMING32 */
+        XCVR_FOLDED_TIMING32,
+        /* 192: XCVR_TSM->TIMING33 */
+        XCVR_FOLDED_TIMING33,
+        /* 193: XCVR_TSM->TIMING34 */
+        XCVR_FOLDED_TIMING34,
+        /* 194: XCVR_TSM->TIMING35 */
+        XCVR_FOLDED_TIMING35,
+        /* 195: XCVR_TSM->TIMING36 */
+        XCVR_FOLDED_TIMING36,
+        /* 196: XCVR_TSM->TIMING37 */
+        XCVR_FOLDED_TIMING37,
+        /* 197: XCVR_TSM->TIMING38 */
+        XCVR_FOLDED_TIMING38,
+        /* 198: XCVR_TSM->TIMING39 */
+        XCVR_FOLDED_TIMING39,
+        /* 199: XCVR_TSM->TIMING40 */
+        XCVR_FOLDED_TIMING40,
+        /* 200: XCVR_TSM->TIMING41 */
+        XCVR_FOLDED_TIMING41,
+        /* 201: XCVR_TSM->TIMING42 */
+        XCVR_FOLDED_TIMING42,
+        /* 202: XCVR_TSM->TIMING43 */
+        XCVR_FOLDED_TIMING43,
+        /* 203: XCVR_TSM->TIMING44 */
+        XCVR_FOLDED_TIMING44,
+        /* 204: XCVR_TSM->TIMING45 */
+        XCVR_FOLDED_TIMING45,
+        /* 205: XCVR_TSM->TIMING46 */
+        XCVR_FOLDED_TIMING46,
+        /* 206: XCVR_TSM->TIMING47 */
+        XCVR_FOLDED_TIMING47,
+        /* 207: XCVR_TSM->TIMING48 */
+        XCVR_FOLDED_TIMING48,
+        /* 208: XCVR_TSM->TIMING49 */
+        XCVR_FOLDED_TIMING49,
+        /* 209: XCVR_TSM->TIMING50 */
+        XCVR_FOLDED_TIMING50,
+        /* 210: XCVR_TSM->TIMING51 */
+        XCVR_FOLDED_TIMING51,
+        /* 211: XCVR_TSM->TIMING52 */
+        XCVR_FOLDED_TIMING52,
+        /* 212: XCVR_TSM->WU_LATENCY */
+        XCVR_FOLDED_WU_LATENCY,
+        /* 213: XCVR_TX_DIG->DATARATE_CONFIG_FILTER_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(0),
+#else
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(0),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 214: XCVR_TX_DIG->DATARATE_CONFIG_FSK_CTRL */
+        XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV0(0x0000) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV1(0x0000),
+        /* 215: XCVR_TX_DIG->DATARATE_CONFIG_GFSK_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x0A20),
+#else
+        XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x0830),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 216: XCVR_TX_DIG->DATA_PADDING_CTRL */
+        XCVR_FOLDED_DATA_PADDING_CTRL | XCVR_TX_DIG_DATA_PADDING_CTRL_DATA_PADDING_SEL(0) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_PAD_DLY(0) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_PAD_DLY_EN(1),
+        /* 217: XCVR_TX_DIG->DATA_PADDING_CTRL_1 */
+        XCVR_FOLDED_DATA_PADDING_CTRL_1 | XCVR_TX_DIG_DATA_PADDING_CTRL_1_RAMP_UP_DLY(0x04) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_1_TX_DATA_FLUSH_DLY(0x04),
+        /* 218: XCVR_TX_DIG->DATA_PADDING_CTRL_2 */
+        XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_MFDEV(0x1C00) | XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_PFDEV(0x0400),
+        /* 219: XCVR_TX_DIG->FSK_CTRL */
+        XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_0(0x1C00) | XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_1(0x0400),
+        /* 220: XCVR_TX_DIG->GFSK_COEFF_0_1 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_0(0x017) | XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_1(0x029),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_0(0x001) | XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_1(0x004),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 221: XCVR_TX_DIG->GFSK_COEFF_2_3 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_2(0x044) | XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_3(0x067),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_2(0x00D) | XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_3(0x028),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 222: XCVR_TX_DIG->GFSK_COEFF_4_5 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_4(0x090) | XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_5(0x0BA),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_4(0x063) | XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_5(0x0C0),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 223: XCVR_TX_DIG->GFSK_COEFF_6_7 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_6(0x0DC) | XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_7(0x0EF),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_6(0x12C) | XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_7(0x176),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 224: XCVR_TX_DIG->GFSK_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(0) |
+            XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x4E4),
+#else
+        XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(0) |
+            XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x400),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 225: XCVR_TX_DIG->IMAGE_FILTER_CTRL */
+        XCVR_FOLDED_IMAGE_FILTER_CTRL | XCVR_TX_DIG_IMAGE_FILTER_CTRL_IMAGE_FILTER_OVRD_EN(0),
+        /* 226: XCVR_TX_DIG->PA_CTRL */
+        XCVR_FOLDED_PA_CTRL | XCVR_TX_DIG_PA_CTRL_PA_RAMP_SEL(1),
+        /* 227: XCVR_TX_DIG->PA_RAMP_TBL0 */
+        XCVR_FOLDED_PA_RAMP_TBL0,
+        /* 228: XCVR_TX_DIG->PA_RAMP_TBL1 */
+        XCVR_FOLDED_PA_RAMP_TBL1,
+        /* 229: XCVR_TX_DIG->PA_RAMP_TBL2 */
+        XCVR_FOLDED_PA_RAMP_TBL2,
+        /* 230: XCVR_TX_DIG->PA_RAMP_TBL3 */
+        XCVR_FOLDED_PA_RAMP_TBL3,
+        /* 231: XCVR_TX_DIG->SWITCH_TX_CTRL */
+        XCVR_FOLDED_SWITCH_TX_CTRL,
+        /* 232: XCVR_TX_DIG->TXDIG_CTRL */
+        XCVR_FOLDED_TXDIG_CTRL | XCVR_TX_DIG_TXDIG_CTRL_DATA_STREAM_SEL(0) | XCVR_TX_DIG_TXDIG_CTRL_MODULATOR_SEL(0) |
+            XCVR_TX_DIG_TXDIG_CTRL_PFC_EN(0),
+    },
+};
+
+const xcvr_folded_config_t xcvr_gfsk_bt_0p5_h_0p5_500kbps_folded_config = {
+    .config     = &xcvr_gfsk_bt_0p5_h_0p5_500kbps_full_config,
+    .reg_values = {
+        /* 0: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x14) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x10) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x0C) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x08) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+        /* 1: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x34) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x30),
+        /* 2: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x2C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x28) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x24),
+        /* 3: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x14) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x10) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x0C) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x08) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+        /* 4: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x34) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x38),
+        /* 5: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x3C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x04),
+        /* 6: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x0C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x08) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x04) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+        /* 7: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x08),
+        /* 8: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x04) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x3C),
+        /* 9: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x0C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x08) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x04) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+        /* 10: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x10),
+        /* 11: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x14) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x18) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x1C),
+        /* 12: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x34) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x38) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x3C) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+        /* 13: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x34) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x30),
+        /* 14: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x2C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x28) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x24),
+        /* 15: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x34) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x38) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x3C) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+        /* 16: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x34) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x38),
+        /* 17: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x3C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x04),
+        /* 18: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x2C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x30) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x34) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x38) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+        /* 19: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x08),
+        /* 20: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x04) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x3C),
+        /* 21: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x2C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x30) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x34) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x38) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+        /* 22: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x10),
+        /* 23: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x14) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x18) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x1C),
+        /* 24: GEN4PHY->DMD_CTRL0 */
+        XCVR_FOLDED_DMD_CTRL0,
+        /* 25: GEN4PHY->DMD_CTRL1 */
+        XCVR_FOLDED_DMD_CTRL1,
+        /* 26: GEN4PHY->FSK_CFG0 */
+        XCVR_FOLDED_FSK_CFG0 | GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_1M(0x15) |
+            GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_2M(0x11) |
+            GEN4PHY_FSK_CFG0_MSK2FSK_SEED(0) | GEN4PHY_FSK_CFG0_MSK_EN(0),
+        /* 27: GEN4PHY->FSK_CFG1 */
+        GEN4PHY_FSK_CFG1_OVERH(0x020) | GEN4PHY_FSK_CFG1_OVERH_INV(0x100) | GEN4PHY_FSK_CFG1_SYNCTSCALE(0xF),
+        /* 28: GEN4PHY->FSK_CFG2 */
+        XCVR_FOLDED_FSK_CFG2,
+        /* 29: GEN4PHY->FSK_FAD_CFG */
+        XCVR_FOLDED_FSK_FAD_CFG,
+        /* 30: GEN4PHY->FSK_FAD_CTRL */
+        XCVR_FOLDED_FSK_FAD_CTRL,
+        /* 31: GEN4PHY->FSK_PD_CFG0 */
+        GEN4PHY_FSK_PD_CFG0_PD_IIR_ALPHA(0xFF) | GEN4PHY_FSK_PD_CFG0_PREAMBLE_T_SCALE(0xC),
+        /* 32: GEN4PHY->FSK_PD_CFG1 */
+        GEN4PHY_FSK_PD_CFG1_PREAMBLE_PATTERN(0x55),
+        /* 33: GEN4PHY->FSK_PD_CFG2 */
+        GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_1M(0xF6) | GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_2M(0xEB),
+        /* 34: GEN4PHY->FSK_PD_PH[0] */
+        GEN4PHY_FSK_PD_PH_REF0(0x03) | GEN4PHY_FSK_PD_PH_REF1(0x05) | GEN4PHY_FSK_PD_PH_REF2(0x03) |
+            GEN4PHY_FSK_PD_PH_REF3(0x00),
+        /* 35: GEN4PHY->FSK_PD_PH[1] */
+        GEN4PHY_FSK_PD_PH_REF0(0x3D) | GEN4PHY_FSK_PD_PH_REF1(0x3B) | GEN4PHY_FSK_PD_PH_REF2(0x3D) |
+            GEN4PHY_FSK_PD_PH_REF3(0x00),
+        /* 36: GEN4PHY->FSK_PT */
+        XCVR_FOLDED_FSK_PT | GEN4PHY_FSK_PT_AGC_TIMEOUT(0x0048),
+        /* 37: GEN4PHY->LR_AA_CFG */
+        GEN4PHY_LR_AA_CFG_AA_COR_THRESH(0x00) | GEN4PHY_LR_AA_CFG_AA_HAM_THRESH(0x00) |
+            GEN4PHY_LR_AA_CFG_AA_LR_CORR_GAIN(0x00) | GEN4PHY_LR_AA_CFG_ACCESS_ADDR_HAM(0x00),
+        /* 38: GEN4PHY->LR_PD_CFG */
+        GEN4PHY_LR_PD_CFG_CORR_TH(0x00) | GEN4PHY_LR_PD_CFG_FREQ_TH(0x00) | GEN4PHY_LR_PD_CFG_NO_PEAKS(0),
+        /* 39: GEN4PHY->LR_PD_PH[0] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 40: GEN4PHY->LR_PD_PH[1] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 41: GEN4PHY->LR_PD_PH[2] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 42: GEN4PHY->LR_PD_PH[3] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 43: GEN4PHY->MISC */
+        XCVR_FOLDED_MISC,
+        /* 44: GEN4PHY->PREPHY_MISC */
+        XCVR_FOLDED_PREPHY_MISC,
+        /* 45: GEN4PHY->RTT_CTRL */
+        XCVR_FOLDED_RTT_CTRL,
+        /* 46: GEN4PHY->RTT_REF */
+        GEN4PHY_RTT_REF_FM_REF_010(0x48) | GEN4PHY_RTT_REF_FM_REF_110(0x63) | GEN4PHY_RTT_REF_FM_REF_111(0x80),
+        /* 47: GEN4PHY->SM_CFG */
+        XCVR_FOLDED_SM_CFG | GEN4PHY_SM_CFG_AA_TIMEOUT_UNCODED(0x0A0),
+        /* 48: RADIO_CTRL->LL_CTRL */
+        RADIO_CTRL_LL_CTRL_ACTIVE_LL(2),
+        /* 49: XCVR_ANALOG->LDO_0 */
+        XCVR_FOLDED_LDO_0,
+        /* 50: XCVR_ANALOG->LDO_1 */
+        XCVR_FOLDED_LDO_1,
+        /* 51: XCVR_ANALOG->PLL */
+        XCVR_FOLDED_PLL,
+        /* 52: XCVR_ANALOG->RX_0 */
+        XCVR_FOLDED_RX_0,
+        /* 53: XCVR_ANALOG->RX_1 */
+        XCVR_FOLDED_RX_1,
+        /* 54: XCVR_ANALOG->TX_DAC_PA */
+        XCVR_FOLDED_TX_DAC_PA | XCVR_ANALOG_TX_DAC_PA_DAC_TRIM_CFBK_DRS(1),
+        /* 55: XCVR_ANALOG->XO_DIST */
+        XCVR_FOLDED_XO_DIST,
+        /* 56: XCVR_MISC->IPS_FO_ADDR[0] */
+        XCVR_MISC_IPS_FO_ADDR_ADDR(0x370) | XCVR_MISC_IPS_FO_ADDR_ENTRY_RX(0) | XCVR_MISC_IPS_FO_ADDR_ENTRY_TX(0),
+        /* 57: XCVR_MISC->IPS_FO_ADDR[1] */
+        XCVR_MISC_IPS_FO_ADDR_ADDR(0x02C) | XCVR_MISC_IPS_FO_ADDR_ENTRY_RX(0) | XCVR_MISC_IPS_FO_ADDR_ENTRY_TX(0),
+        /* 58: XCVR_MISC->IPS_FO_DRS0_DATA[0] */
+        XCVR_MISC_IPS_FO_DRS0_DATA_DRS0_DATA(0x00000000),
+        /* 59: XCVR_MISC->IPS_FO_DRS0_DATA[1] */
+        XCVR_MISC_IPS_FO_DRS0_DATA_DRS0_DATA(0x00000000),
+        /* 60: XCVR_MISC->IPS_FO_DRS1_DATA[0] */
+        XCVR_MISC_IPS_FO_DRS1_DATA_DRS1_DATA(0x00000000),
+        /* 61: XCVR_MISC->IPS_FO_DRS1_DATA[1] */
+        XCVR_MISC_IPS_FO_DRS1_DATA_DRS1_DATA(0x00000000),
+        /* 62: XCVR_MISC->LDO_TRIM_0 */
+        XCVR_FOLDED_LDO_TRIM_0,
+        /* 63: XCVR_MISC->LDO_TRIM_1 */
+        XCVR_FOLDED_LDO_TRIM_1,
+        /* 64: XCVR_MISC->XCVR_CTRL */
+        XCVR_FOLDED_XCVR_CTRL | XCVR_MISC_XCVR_CTRL_DATA_RATE_DRS(2) | XCVR_MISC_XCVR_CTRL_DEMOD_SEL(1) |
+            XCVR_MISC_XCVR_CTRL_LL_CFG_CAPT_DIS(0),
+        /* 65: XCVR_PLL_DIG->CHAN_MAP */
+        XCVR_FOLDED_CHAN_MAP | XCVR_PLL_DIG_CHAN_MAP_BAND_SELECT(0),
+        /* 66: XCVR_PLL_DIG->CHAN_MAP_EXT */
+#if RF_OSC_26MHZ == 1
+        XCVR_FOLDED_CHAN_MAP_EXT | XCVR_PLL_DIG_CHAN_MAP_EXT_NUM_OFFSET(0x013B13B),
+#else
+        XCVR_FOLDED_CHAN_MAP_EXT | XCVR_PLL_DIG_CHAN_MAP_EXT_NUM_OFFSET(0x0100000),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 67: XCVR_PLL_DIG->DATA_RATE_OVRD_CTRL1 */
+        XCVR_FOLDED_DATA_RATE_OVRD_CTRL1,
+        /* 68: XCVR_PLL_DIG->DATA_RATE_OVRD_CTRL2 */
+#if RF_OSC_26MHZ == 1
+        XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL2_NUM_OFFSET_CFG1(0x013B13B),
+#else
+        XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL2_NUM_OFFSET_CFG1(0x0100000),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 69: XCVR_PLL_DIG->DELAY_MATCH */
+        XCVR_FOLDED_DELAY_MATCH | XCVR_PLL_DIG_DELAY_MATCH_HPM_INTEGER_DELAY(0x04) |
+            XCVR_PLL_DIG_DELAY_MATCH_LPM_SDM_DELAY(0x03),
+        /* 70: XCVR_PLL_DIG->HPMCAL_CTRL */
+        XCVR_FOLDED_HPMCAL_CTRL | XCVR_PLL_DIG_HPMCAL_CTRL_HPM_CAL_ARRAY_SIZE(0),
+        /* 71: XCVR_PLL_DIG->HPM_BUMP */
+        XCVR_FOLDED_HPM_BUMP | XCVR_PLL_DIG_HPM_BUMP_HPM_VCM_CAL(2) | XCVR_PLL_DIG_HPM_BUMP_HPM_VCM_TX(2),
+        /* 72: XCVR_PLL_DIG->HPM_CAL_TIMING */
+        XCVR_FOLDED_HPM_CAL_TIMING,
+        /* 73: XCVR_PLL_DIG->HPM_CTRL */
+        XCVR_FOLDED_HPM_CTRL,
+        /* 74: XCVR_PLL_DIG->HPM_SDM_RES */
+        XCVR_FOLDED_HPM_SDM_RES | XCVR_PLL_DIG_HPM_SDM_RES_HPM_COUNT_ADJUST(0x02),
+        /* 75: XCVR_PLL_DIG->LOCK_DETECT */
+        XCVR_FOLDED_LOCK_DETECT,
+        /* 76: XCVR_PLL_DIG->LPM_CTRL */
+        XCVR_FOLDED_LPM_CTRL,
+        /* 77: XCVR_PLL_DIG->LPM_SDM_CTRL1 */
+        XCVR_FOLDED_LPM_SDM_CTRL1,
+        /* 78: XCVR_PLL_DIG->MOD_CTRL */
+        XCVR_FOLDED_MOD_CTRL,
+        /* 79: XCVR_PLL_DIG->PLL_DATARATE_CTRL */
+        XCVR_FOLDED_PLL_DATARATE_CTRL,
+        /* 80: XCVR_PLL_DIG->TUNING_CAP_RX_CTRL */
+        XCVR_FOLDED_TUNING_CAP_RX_CTRL,
+        /* 81: XCVR_PLL_DIG->TUNING_CAP_TX_CTRL */
+        XCVR_FOLDED_TUNING_CAP_TX_CTRL,
+        /* 82: XCVR_RX_DIG->ACQ_FILT_0_3 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x3E) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x01) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x08) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x0D),
+#else
+        XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x02) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x05) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x7F) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x73),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 83: XCVR_RX_DIG->ACQ_FILT_0_3_DRS */
+        XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H0(0x00) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H1(0x00) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H2(0x00) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H3(0x00),
+        /* 84: XCVR_RX_DIG->ACQ_FILT_10_11 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x06F) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x09D),
+#else
+        XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x061) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x0EF),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 85: XCVR_RX_DIG->ACQ_FILT_10_11_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x066) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x0A6),
+#else
+        XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x03F) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x104),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 86: XCVR_RX_DIG->ACQ_FILT_4_7 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x09) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x77) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_H6(0xE2) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0xDB),
+#else
+        XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x78) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x14) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_H6(0x22) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0xF8),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 87: XCVR_RX_DIG->ACQ_FILT_4_7_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x04) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x05) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0xFA) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0xE8),
+#else
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x7D) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x7A) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0x0D) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0x17),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 88: XCVR_RX_DIG->ACQ_FILT_8_9 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x1F4) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x02C),
+#else
+        XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x1BC) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x1D5),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 89: XCVR_RX_DIG->ACQ_FILT_8_9_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x1E9) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x016),
+#else
+        XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x1E2) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x1BE),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 90: XCVR_RX_DIG->AGC_CTRL */
+        XCVR_FOLDED_AGC_CTRL,
+        /* 91: XCVR_RX_DIG->AGC_CTRL_STAT */
+        XCVR_FOLDED_AGC_CTRL_STAT,
+        /* 92: XCVR_RX_DIG->AGC_IDX0_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX0_GAIN_CFG,
+        /* 93: XCVR_RX_DIG->AGC_IDX0_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX0_GAIN_VAL,
+        /* 94: XCVR_RX_DIG->AGC_IDX0_THR */
+        XCVR_FOLDED_AGC_IDX0_THR,
+        /* 95: XCVR_RX_DIG->AGC_IDX10_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX10_GAIN_CFG,
+        /* 96: XCVR_RX_DIG->AGC_IDX10_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX10_GAIN_VAL,
+        /* 97: XCVR_RX_DIG->AGC_IDX10_THR */
+        XCVR_FOLDED_AGC_IDX10_THR,
+        /* 98: XCVR_RX_DIG->AGC_IDX11_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX11_GAIN_CFG | XCVR_RX_DIG_AGC_IDX11_GAIN_CFG_MAG_THR_11_DRS_OFS(0x00) |
+            XCVR_RX_DIG_AGC_IDX11_GAIN_CFG_MAG_THR_HI_11_DRS_OFS(0x00),
+        /* 99: XCVR_RX_DIG->AGC_IDX11_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX11_GAIN_VAL | XCVR_RX_DIG_AGC_IDX11_GAIN_VAL_MAG_THR_11(0x000) |
+            XCVR_RX_DIG_AGC_IDX11_GAIN_VAL_MAG_THR_HI_11(0x000),
+        /* 100: XCVR_RX_DIG->AGC_IDX11_THR */
+        XCVR_FOLDED_AGC_IDX11_THR,
+        /* 101: XCVR_RX_DIG->AGC_IDX1_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX1_GAIN_CFG,
+        /* 102: XCVR_RX_DIG->AGC_IDX1_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX1_GAIN_VAL,
+        /* 103: XCVR_RX_DIG->AGC_IDX1_THR */
+        XCVR_FOLDED_AGC_IDX1_THR,
+        /* 104: XCVR_RX_DIG->AGC_IDX2_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX2_GAIN_CFG,
+        /* 105: XCVR_RX_DIG->AGC_IDX2_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX2_GAIN_VAL,
+        /* 106: XCVR_RX_DIG->AGC_IDX2_THR */
+        XCVR_FOLDED_AGC_IDX2_THR,
+        /* 107: XCVR_RX_DIG->AGC_IDX3_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX3_GAIN_CFG,
+        /* 108: XCVR_RX_DIG->AGC_IDX3_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX3_GAIN_VAL,
+        /* 109: XCVR_RX_DIG->AGC_IDX3_THR */
+        XCVR_FOLDED_AGC_IDX3_THR,
+        /* 110: XCVR_RX_DIG->AGC_IDX4_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX4_GAIN_CFG,
+        /* 111: XCVR_RX_DIG->AGC_IDX4_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX4_GAIN_VAL,
+        /* 112: XCVR_RX_DIG->AGC_IDX4_THR */
+        XCVR_FOLDED_AGC_IDX4_THR,
+        /* 113: XCVR_RX_DIG->AGC_IDX5_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX5_GAIN_CFG,
+        /* 114: XCVR_RX_DIG->AGC_IDX5_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX5_GAIN_VAL,
+        /* 115: XCVR_RX_DIG->AGC_IDX5_THR */
+        XCVR_FOLDED_AGC_IDX5_THR,
+        /* 116: XCVR_RX_DIG->AGC_IDX6_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX6_GAIN_CFG,
+        /* 117: XCVR_RX_DIG->AGC_IDX6_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX6_GAIN_VAL,
+        /* 118: XCVR_RX_DIG->AGC_IDX6_THR */
+        XCVR_FOLDED_AGC_IDX6_THR,
+        /* 119: XCVR_RX_DIG->AGC_IDX7_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX7_GAIN_CFG,
+        /* 120: XCVR_RX_DIG->AGC_IDX7_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX7_GAIN_VAL,
+        /* 121: XCVR_RX_DIG->AGC_IDX7_THR */
+        XCVR_FOLDED_AGC_IDX7_THR,
+        /* 122: XCVR_RX_DIG->AGC_IDX8_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX8_GAIN_CFG,
+        /* 123: XCVR_RX_DIG->AGC_IDX8_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX8_GAIN_VAL,
+        /* 124: XCVR_RX_DIG->AGC_IDX8_THR */
+        XCVR_FOLDED_AGC_IDX8_THR,
+        /* 125: XCVR_RX_DIG->AGC_IDX9_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX9_GAIN_CFG,
+        /* 126: XCVR_RX_DIG->AGC_IDX9_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX9_GAIN_VAL,
+        /* 127: XCVR_RX_DIG->AGC_IDX9_THR */
+        XCVR_FOLDED_AGC_IDX9_THR,
+        /* 128: XCVR_RX_DIG->AGC_MIS_GAIN_CFG */
+        XCVR_FOLDED_AGC_MIS_GAIN_CFG,
+        /* 129: XCVR_RX_DIG->AGC_THR_FAST */
+        XCVR_FOLDED_AGC_THR_FAST,
+        /* 130: XCVR_RX_DIG->AGC_THR_FAST_DRS */
+        XCVR_FOLDED_AGC_THR_FAST_DRS,
+        /* 131: XCVR_RX_DIG->AGC_THR_MIS */
+        XCVR_FOLDED_AGC_THR_MIS,
+        /* 132: XCVR_RX_DIG->AGC_TIMING0 */
+        XCVR_FOLDED_AGC_TIMING0 | XCVR_RX_DIG_AGC_TIMING0_AGC_GAIN_STEP_WAIT(0x10),
+        /* 133: XCVR_RX_DIG->AGC_TIMING0_DRS */
+        XCVR_FOLDED_AGC_TIMING0_DRS | XCVR_RX_DIG_AGC_TIMING0_DRS_AGC_GAIN_STEP_WAIT(0x08),
+        /* 134: XCVR_RX_DIG->AGC_TIMING1 */
+        XCVR_FOLDED_AGC_TIMING1 | XCVR_RX_DIG_AGC_TIMING1_AGC_FREEZE_TIMEOUT(0x0A) |
+            XCVR_RX_DIG_AGC_TIMING1_AGC_HOLD_TIMEOUT(0x08),
+        /* 135: XCVR_RX_DIG->AGC_TIMING1_DRS */
+        XCVR_RX_DIG_AGC_TIMING1_DRS_AGC_FREEZE_TIMEOUT(0x27) | XCVR_RX_DIG_AGC_TIMING1_DRS_AGC_HOLD_TIMEOUT(0x0A),
+        /* 136: XCVR_RX_DIG->AGC_TIMING2 */
+        XCVR_FOLDED_AGC_TIMING2 | XCVR_RX_DIG_AGC_TIMING2_AGC_UNFREEZE_FEAT_TIMEOUT(0x000) |
+            XCVR_RX_DIG_AGC_TIMING2_AGC_UNHOLD_FEAT_TIMEOUT(0x000),
+        /* 137: XCVR_RX_DIG->AGC_TIMING2_DRS */
+        XCVR_RX_DIG_AGC_TIMING2_DRS_AGC_UNFREEZE_FEAT_TIMEOUT(0x07F) |
+            XCVR_RX_DIG_AGC_TIMING2_DRS_AGC_UNHOLD_FEAT_TIMEOUT(0x000),
+        /* 138: XCVR_RX_DIG->CTRL0 */
+#if RF_OSC_26MHZ == 1
+        XCVR_FOLDED_CTRL0 | XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(2) |
+            XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x027) |
+            XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(1) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#else
+        XCVR_FOLDED_CTRL0 | XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(3) |
+            XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x020) |
+            XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(1) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 139: XCVR_RX_DIG->CTRL0_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(3) |
+            XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x027),
+#else
+        XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(4) |
+            XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x020),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 140: XCVR_RX_DIG->CTRL1 */
+        XCVR_FOLDED_CTRL1,
+        /* 141: XCVR_RX_DIG->DCOC_CTRL0 */
+        XCVR_FOLDED_DCOC_CTRL0 | XCVR_RX_DIG_DCOC_CTRL0_DCOC_DAC_ORDER(1) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFII(0x6) |
+            XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFIIP(1) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFQQ(0x5) |
+            XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFQQP(1),
+        /* 142: XCVR_RX_DIG->DCOC_CTRL0_DRS */
+        XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFII(6) | XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFIIP(1) |
+            XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFQQ(5) | XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFQQP(1),
+        /* 143: XCVR_RX_DIG->DCOC_CTRL1 */
+        XCVR_FOLDED_DCOC_CTRL1,
+        /* 144: XCVR_RX_DIG->DEMOD_FILT_0_1 */
+        XCVR_RX_DIG_DEMOD_FILT_0_1_H0(0x1FD) | XCVR_RX_DIG_DEMOD_FILT_0_1_H1(0x1FE),
+        /* 145: XCVR_RX_DIG->DEMOD_FILT_0_1_DRS */
+        XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H0(0x1FD) | XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H1(0x1FE),
+        /* 146: XCVR_RX_DIG->DEMOD_FILT_2_4 */
+        XCVR_RX_DIG_DEMOD_FILT_2_4_H2(0x024) | XCVR_RX_DIG_DEMOD_FILT_2_4_H3(0x082) |
+            XCVR_RX_DIG_DEMOD_FILT_2_4_H4(0x0BA),
+        /* 147: XCVR_RX_DIG->DEMOD_FILT_2_4_DRS */
+        XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H2(0x022) | XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H3(0x083) |
+            XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H4(0x0BE),
+        /* 148: XCVR_RX_DIG->NB_RSSI_CTRL0 */
+        XCVR_FOLDED_NB_RSSI_CTRL0,
+        /* 149: XCVR_RX_DIG->NB_RSSI_CTRL1 */
+        XCVR_FOLDED_NB_RSSI_CTRL1,
+        /* 150: XCVR_RX_DIG->RCCAL_CTRL0 */
+        XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE(2) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE_DRS(3) |
+            XCVR_RX_DIG_RCCAL_CTRL0_CBPF_CCODE_OFFSET(0x00) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE(1) |
+            XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE_DRS(1) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CMPOUT_INV(0) |
+            XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CODE_OFFSET(0x0) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_SMPL_DLY(0),
+        /* 151: XCVR_RX_DIG->RSSI_GLOBAL_CTRL */
+        XCVR_FOLDED_RSSI_GLOBAL_CTRL | XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_CCA1_ED_EN(0),
+        /* 152: XCVR_RX_DIG->WB_RSSI_CTRL */
+        XCVR_FOLDED_WB_RSSI_CTRL,
+        /* 153: XCVR_TSM->CTRL */
+        XCVR_FOLDED_CTRL,
+        /* 154: XCVR_TSM->END_OF_SEQ */
+        XCVR_FOLDED_END_OF_SEQ,
+        /* 155: XCVR_TSM->FAST_CTRL1 */
+        XCVR_FOLDED_FAST_CTRL1,
+        /* 156: XCVR_TSM->FAST_CTRL2 */
+        XCVR_FOLDED_FAST_CTRL2,
+        /* 157: XCVR_TSM->FAST_CTRL3 */
+        XCVR_FOLDED_FAST_CTRL3,
+        /* 158: XCVR_TSM->RECYCLE_COUNT */
+        XCVR_FOLDED_RECYCLE_COUNT,
+        /* 159: XCVR_TSM->TIMING00 */
+        XCVR_FOLDED_TIMING00,
+        /* 160: XCVR_TSM->TIMING01 */
+        XCVR_FOLDED_TIMING01,
+        /* 161: XCVR_TSM->TIMING02 */
+        XCVR_FOLDED_TIMING02,
+        /* 162: XCVR_TSM->TIMING03 */
+        XCVR_FOLDED_TIMING03,
+        /* 163: XCVR_TSM->TIMING04 */
+        XCVR_FOLDED_TIMING04,
+        /* 164: XCVR_TSM->TIMING05 */
+        XCVR_FOLDED_TIMING05,
+        /* 165: XCVR_TSM->TIMING06 */
+        XCVR_FOLDED_TIMING06,
+        /* 166: XCVR_TSM->TIMING07 */
+        XCVR_FOLDED_TIMING07,
+        /* 167: XCVR_TSM->TIMING08 */
+        XCVR_FOLDED_TIMING08,
+        /* 168: XCVR_TSM->TIMING09 */
+        XCVR_FOLDED_TIMING09,
+        /* 169: XCVR_TSM->TIMING10 */
+        XCVR_FOLDED_TIMING10,
+        /* 170: XCVR_TSM->TIMING11 */
+        XCVR_FOLDED_TIMING11,
+        /* 171: XCVR_TSM->TIMING12 */
+        XCVR_FOLDED_TIMING12,
+        /* 172: XCVR_TSM->TIMING13 */
+        XCVR_FOLDED_TIMING13,
+        /* 173: XCVR_TSM->TIMING14 */
+        XCVR_FOLDED_TIMING14,
+        /* 174: XCVR_TSM->TIMING15 */
+        XCVR_FOLDED_TIMING15,
+        /* 175: XCVR_TSM->TIMING16 */
+        XCVR_FOLDED_TIMING16,
+        /* 176: XCVR_TSM->TIMING17 */
+        XCVR_FOLDED_TIMING17,
+        /* 177: XCVR_TSM->TIMING18 */
+        XCVR_FOLDED_TIMING18,
+        /* 178: XCVR_TSM->TIMING19 */
+        XCVR_FOLDED_TIMING19,
+        /* 179: XCVR_TSM->TIMING20 */
+        XCVR_FOLDED_TIMING20,
+        /* 180: XCVR_TSM->TIMING21 */
+        XCVR_FOLDED_TIMING21,
+        /* 181: XCVR_TSM->TIMING22 */
+        XCVR_FOLDED_TIMING22,
+        /* 182: XCVR_TSM->TIMING23 */
+        XCVR_FOLDED_TIMING23,
+        /* 183: XCVR_TSM->TIMING24 */
+        XCVR_FOLDED_TIMING24,
+        /* 184: XCVR_TSM->TIMING25 */
+        XCVR_FOLDED_TIMING25,
+        /* 185: XCVR_TSM->TIMING26 */
+        XCVR_FOLDED_TIMING26,
+        /* 186: XCVR_TSM->TIMING27 */
+        XCVR_FOLDED_TIMING27,
+        /* 187: XCVR_TSM->TIMING28 */
+        XCVR_FOLDED_TIMING28,
+        /* 188: XCVR_TSM->TIMING29 */
+        XCVR_FOLDED_TIMING29,
+        /* 189: XCVR_TSM->TIMING30 */
+        XCVR_FOLDED_TIMING30,
+        /* 190: XCVR_TSM->TIMING31 */
+        XCVR_FOLDED_TIMING31,
+        /* 191: XCVR_TSM->TIMING32 */
+        XCVR_FOLDED_TIMING32,
+        /* 192: XCVR_TSM->TIMING33 */
+        XCVR_FOLDED_TIMING33,
+        /* 193: XCVR_TSM->TIMING34 */
+        XCVR_FOLDED_TIMING34,
+        /* 194: XCVR_TSM->TIMING35 */
+        XCVR_FOLDED_TIMING35,
+        /* 195: XCVR_TSM->TIMING36 */
+        XCVR_FOLDED_TIMING36,
+        /* 196: XCVR_TSM->TIMING37 */
+        XCVR_FOLDED_TIMING37,
+        /* 197: XCVR_TSM->TIMING38 */
+        XCVR_FOLDED_TIMING38,
+        /* 198: XCVR_TSM->TIMING39 */
+        XCVR_FOLDED_TIMING39,
+        /* 199: XCVR_TSM->TIMING40 */
+        XCVR_FOLDED_TIMING40,
+        /* 200: XCVR_TSM->TIMING41 */
+        XCVR_FOLDED_TIMING41,
+        /* 201: XCVR_TSM->TIMING42 */
+        XCVR_FOLDED_TIMING42,
+        /* 202: XCVR_TSM->TIMING43 */
+        XCVR_FOLDED_TIMING43,
+        /* 203: XCVR_TSM->TIMING44 */
+        XCVR_FOLDED_TIMING44,
+        /* 204: XCVR_TSM->TIMING45 */
+        XCVR_FOLDED_TIMING45,
+        /* 205: XCVR_TSM->TIMING46 */
+        XCVR_FOLDED_TIMING46,
+        /* 206: XCVR_TSM->TIMING47 */
+        XCVR_FOLDED_TIMING47,
+        /* 207: XCVR_TSM->TIMING48 */
+        XCVR_FOLDED_TIMING48,
+        /* 208: XCVR_TSM->TIMING49 */
+        XCVR_FOLDED_TIMING49,
+        /* 209: XCVR_TSM->TIMING50 */
+        XCVR_FOLDED_TIMING50,
+        /* 210: XCVR_TSM->TIMING51 */
+        XCVR_FOLDED_TIMING51,
+        /* 211: XCVR_TSM->TIMING52 */
+        XCVR_FOLDED_TIMING52,
+        /* 212: XCVR_TSM->WU_LATENCY */
+        XCVR_FOLDED_WU_LATENCY,
+        /* 213: XCVR_TX_DIG->DATARATE_CONFIG_FILTER_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(2) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(2) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(1),
+#else
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(3) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(2) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(1),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 214: XCVR_TX_DIG->DATARATE_CONFIG_FSK_CTRL */
+        XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV0(0x0000) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV1(0x0000),
+        /* 215: XCVR_TX_DIG->DATARATE_CONFIG_GFSK_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x0279),
+#else
+        XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x0203),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 216: XCVR_TX_DIG->DATA_PADDING_CTRL */
+        XCVR_FOLDED_DATA_PADDING_CTRL | XCVR_TX_DIG_DATA_PADDING_CTRL_DATA_PADDING_SEL(0) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_PAD_DLY(0) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_PAD_DLY_EN(1),
+        /* 217: XCVR_TX_DIG->DATA_PADDING_CTRL_1 */
+        XCVR_FOLDED_DATA_PADDING_CTRL_1 | XCVR_TX_DIG_DATA_PADDING_CTRL_1_RAMP_UP_DLY(0x04) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_1_TX_DATA_FLUSH_DLY(0x04),
+        /* 218: XCVR_TX_DIG->DATA_PADDING_CTRL_2 */
+        XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_MFDEV(0x1C00) | XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_PFDEV(0x0400),
+        /* 219: XCVR_TX_DIG->FSK_CTRL */
+        XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_0(0x1C00) | XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_1(0x0400),
+        /* 220: XCVR_TX_DIG->GFSK_COEFF_0_1 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_0(0x017) | XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_1(0x029),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_0(0x001) | XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_1(0x004),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 221: XCVR_TX_DIG->GFSK_COEFF_2_3 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_2(0x044) | XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_3(0x067),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_2(0x00D) | XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_3(0x028),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 222: XCVR_TX_DIG->GFSK_COEFF_4_5 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_4(0x090) | XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_5(0x0BA),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_4(0x063) | XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_5(0x0C0),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 223: XCVR_TX_DIG->GFSK_COEFF_6_7 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_6(0x0DC) | XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_7(0x0EF),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_6(0x12C) | XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_7(0x176),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 224: XCVR_TX_DIG->GFSK_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(0) |
+            XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x4E9),
+#else
+        XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(0) |
+            XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x3FD),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 225: XCVR_TX_DIG->IMAGE_FILTER_CTRL */
+        XCVR_FOLDED_IMAGE_FILTER_CTRL | XCVR_TX_DIG_IMAGE_FILTER_CTRL_IMAGE_FILTER_OVRD_EN(0),
+        /* 226: XCVR_TX_DIG->PA_CTRL */
+        XCVR_FOLDED_PA_CTRL | XCVR_TX_DIG_PA_CTRL_PA_RAMP_SEL(1),
+        /* 227: XCVR_TX_DIG->PA_RAMP_TBL0 */
+        XCVR_FOLDED_PA_RAMP_TBL0,
+        /* 228: XCVR_TX_DIG->PA_RAMP_TBL1 */
+        XCVR_FOLDED_PA_RAMP_TBL1,
+        /* 229: XCVR_TX_DIG->PA_RAMP_TBL2 */
+        XCVR_FOLDED_PA_RAMP_TBL2,
+        /* 230: XCVR_TX_DIG->PA_RAMP_TBL3 */
+        XCVR_FOLDED_PA_RAMP_TBL3,
+        /* 231: XCVR_TX_DIG->SWITCH_TX_CTRL */
+        XCVR_FOLDED_SWITCH_TX_CTRL,
+        /* 232: XCVR_TX_DIG->TXDIG_CTRL */
+        XCVR_FOLDED_TXDIG_CTRL | XCVR_TX_DIG_TXDIG_CTRL_DATA_STREAM_SEL(0) | XCVR_TX_DIG_TXDIG_CTRL_MODULATOR_SEL(0) |
+            XCVR_TX_DIG_TXDIG_CTRL_PFC_EN(0),
+    },
+};
+
+const xcvr_folded_config_t xcvr_gfsk_bt_0p5_h_0p5_250kbps_folded_config = {
+    .config     = &xcvr_gfsk_bt_0p5_h_0p5_250kbps_full_config,
+    .reg_values = {
+        /* 0: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x14) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x10) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x0C) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x08) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+        /* 1: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x34) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x30),
+        /* 2: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x2C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x28) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x24),
+        /* 3: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x14) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x10) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x0C) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x08) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+        /* 4: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x34) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x38),
+        /* 5: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x3C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x04),
+        /* 6: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x0C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x08) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x04) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+        /* 7: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x08),
+        /* 8: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x04) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x3C),
+        /* 9: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x0C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x08) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x04) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+        /* 10: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x10),
+        /* 11: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x14) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x18) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x1C),
+        /* 12: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x34) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x38) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x3C) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+        /* 13: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x34) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x30),
+        /* 14: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x2C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x28) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x24),
+        /* 15: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x34) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x38) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x3C) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+        /* 16: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x34) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x38),
+        /* 17: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x3C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x04),
+        /* 18: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x2C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x30) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x34) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x38) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+        /* 19: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x08),
+        /* 20: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x04) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x3C),
+        /* 21: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x2C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x30) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x34) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x38) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+        /* 22: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x10),
+        /* 23: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x14) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x18) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x1C),
+        /* 24: GEN4PHY->DMD_CTRL0 */
+        XCVR_FOLDED_DMD_CTRL0,
+        /* 25: GEN4PHY->DMD_CTRL1 */
+        XCVR_FOLDED_DMD_CTRL1,
+        /* 26: GEN4PHY->FSK_CFG0 */
+        XCVR_FOLDED_FSK_CFG0 | GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_1M(0x15) |
+            GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_2M(0x11) |
+            GEN4PHY_FSK_CFG0_MSK2FSK_SEED(0) | GEN4PHY_FSK_CFG0_MSK_EN(0),
+        /* 27: GEN4PHY->FSK_CFG1 */
+        GEN4PHY_FSK_CFG1_OVERH(0x020) | GEN4PHY_FSK_CFG1_OVERH_INV(0x100) | GEN4PHY_FSK_CFG1_SYNCTSCALE(0xF),
+        /* 28: GEN4PHY->FSK_CFG2 */
+        XCVR_FOLDED_FSK_CFG2,
+        /* 29: GEN4PHY->FSK_FAD_CFG */
+        XCVR_FOLDED_FSK_FAD_CFG,
+        /* 30: GEN4PHY->FSK_FAD_CTRL */
+        XCVR_FOLDED_FSK_FAD_CTRL,
+        /* 31: GEN4PHY->FSK_PD_CFG0 */
+        GEN4PHY_FSK_PD_CFG0_PD_IIR_ALPHA(0xFF) | GEN4PHY_FSK_PD_CFG0_PREAMBLE_T_SCALE(0xC),
+        /* 32: GEN4PHY->FSK_PD_CFG1 */
+        GEN4PHY_FSK_PD_CFG1_PREAMBLE_PATTERN(0x55),
+        /* 33: GEN4PHY->FSK_PD_CFG2 */
+        GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_1M(0xEB) | GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_2M(0xEB),
+        /* 34: GEN4PHY->FSK_PD_PH[0] */
+        GEN4PHY_FSK_PD_PH_REF0(0x03) | GEN4PHY_FSK_PD_PH_REF1(0x05) | GEN4PHY_FSK_PD_PH_REF2(0x03) |
+            GEN4PHY_FSK_PD_PH_REF3(0x00),
+        /* 35: GEN4PHY->FSK_PD_PH[1] */
+        GEN4PHY_FSK_PD_PH_REF0(0x3D) | GEN4PHY_FSK_PD_PH_REF1(0x3B) | GEN4PHY_FSK_PD_PH_REF2(0x3D) |
+            GEN4PHY_FSK_PD_PH_REF3(0x00),
+        /* 36: GEN4PHY->FSK_PT */
+        XCVR_FOLDED_FSK_PT | GEN4PHY_FSK_PT_AGC_TIMEOUT(0x0048),
+        /* 37: GEN4PHY->LR_AA_CFG */
+        GEN4PHY_LR_AA_CFG_AA_COR_THRESH(0x00) | GEN4PHY_LR_AA_CFG_AA_HAM_THRESH(0x00) |
+            GEN4PHY_LR_AA_CFG_AA_LR_CORR_GAIN(0x00) | GEN4PHY_LR_AA_CFG_ACCESS_ADDR_HAM(0x00),
+        /* 38: GEN4PHY->LR_PD_CFG */
+        GEN4PHY_LR_PD_CFG_CORR_TH(0x00) | GEN4PHY_LR_PD_CFG_FREQ_TH(0x00) | GEN4PHY_LR_PD_CFG_NO_PEAKS(0),
+        /* 39: GEN4PHY->LR_PD_PH[0] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 40: GEN4PHY->LR_PD_PH[1] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 41: GEN4PHY->LR_PD_PH[2] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 42: GEN4PHY->LR_PD_PH[3] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 43: GEN4PHY->MISC */
+        XCVR_FOLDED_MISC,
+        /* 44: GEN4PHY->PREPHY_MISC */
+        XCVR_FOLDED_PREPHY_MISC,
+        /* 45: GEN4PHY->RTT_CTRL */
+        XCVR_FOLDED_RTT_CTRL,
+        /* 46: GEN4PHY->RTT_REF */
+        GEN4PHY_RTT_REF_FM_REF_010(0x48) | GEN4PHY_RTT_REF_FM_REF_110(0x63) | GEN4PHY_RTT_REF_FM_REF_111(0x80),
+        /* 47: GEN4PHY->SM_CFG */
+        XCVR_FOLDED_SM_CFG | GEN4PHY_SM_CFG_AA_TIMEOUT_UNCODED(0x0A0),
+        /* 48: RADIO_CTRL->LL_CTRL */
+        RADIO_CTRL_LL_CTRL_ACTIVE_LL(2),
+        /* 49: XCVR_ANALOG->LDO_0 */
+        XCVR_FOLDED_LDO_0,
+        /* 50: XCVR_ANALOG->LDO_1 */
+        XCVR_FOLDED_LDO_1,
+        /* 51: XCVR_ANALOG->PLL */
+        XCVR_FOLDED_PLL,
+        /* 52: XCVR_ANALOG->RX_0 */
+        XCVR_FOLDED_RX_0,
+        /* 53: XCVR_ANALOG->RX_1 */
+        XCVR_FOLDED_RX_1,
+        /* 54: XCVR_ANALOG->TX_DAC_PA */
+        XCVR_FOLDED_TX_DAC_PA | XCVR_ANALOG_TX_DAC_PA_DAC_TRIM_CFBK_DRS(1),
+        /* 55: XCVR_ANALOG->XO_DIST */
+        XCVR_FOLDED_XO_DIST,
+        /* 56: XCVR_MISC->IPS_FO_ADDR[0] */
+        XCVR_MISC_IPS_FO_ADDR_ADDR(0x370) | XCVR_MISC_IPS_FO_ADDR_ENTRY_RX(0) | XCVR_MISC_IPS_FO_ADDR_ENTRY_TX(0),
+        /* 57: XCVR_MISC->IPS_FO_ADDR[1] */
+        XCVR_MISC_IPS_FO_ADDR_ADDR(0x02C) | XCVR_MISC_IPS_FO_ADDR_ENTRY_RX(0) | XCVR_MISC_IPS_FO_ADDR_ENTRY_TX(0),
+        /* 58: XCVR_MISC->IPS_FO_DRS0_DATA[0] */
+        XCVR_MISC_IPS_FO_DRS0_DATA_DRS0_DATA(0x00000000),
+        /* 59: XCVR_MISC->IPS_FO_DRS0_DATA[1] */
+        XCVR_MISC_IPS_FO_DRS0_DATA_DRS0_DATA(0x00000000),
+        /* 60: XCVR_MISC->IPS_FO_DRS1_DATA[0] */
+        XCVR_MISC_IPS_FO_DRS1_DATA_DRS1_DATA(0x00000000),
+        /* 61: XCVR_MISC->IPS_FO_DRS1_DATA[1] */
+        XCVR_MISC_IPS_FO_DRS1_DATA_DRS1_DATA(0x00000000),
+        /* 62: XCVR_MISC->LDO_TRIM_0 */
+        XCVR_FOLDED_LDO_TRIM_0,
+        /* 63: XCVR_MISC->LDO_TRIM_1 */
+        XCVR_FOLDED_LDO_TRIM_1,
+        /* 64: XCVR_MISC->XCVR_CTRL */
+        XCVR_FOLDED_XCVR_CTRL | XCVR_MISC_XCVR_CTRL_DATA_RATE_DRS(3) | XCVR_MISC_XCVR_CTRL_DEMOD_SEL(1) |
+            XCVR_MISC_XCVR_CTRL_LL_CFG_CAPT_DIS(0),
+        /* 65: XCVR_PLL_DIG->CHAN_MAP */
+        XCVR_FOLDED_CHAN_MAP | XCVR_PLL_DIG_CHAN_MAP_BAND_SELECT(0),
+        /* 66: XCVR_PLL_DIG->CHAN_MAP_EXT */
+#if RF_OSC_26MHZ == 1
+        XCVR_FOLDED_CHAN_MAP_EXT | XCVR_PLL_DIG_CHAN_MAP_EXT_NUM_OFFSET(0x013B13B),
+#else
+        XCVR_FOLDED_CHAN_MAP_EXT | XCVR_PLL_DIG_CHAN_MAP_EXT_NUM_OFFSET(0x0100000),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 67: XCVR_PLL_DIG->DATA_RATE_OVRD_CTRL1 */
+        XCVR_FOLDED_DATA_RATE_OVRD_CTRL1,
+        /* 68: XCVR_PLL_DIG->DATA_RATE_OVRD_CTRL2 */
+#if RF_OSC_26MHZ == 1
+        XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL2_NUM_OFFSET_CFG1(0x013B13B),
+#else
+        XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL2_NUM_OFFSET_CFG1(0x0100000),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 69: XCVR_PLL_DIG->DELAY_MATCH */
+        XCVR_FOLDED_DELAY_MATCH | XCVR_PLL_DIG_DELAY_MATCH_HPM_INTEGER_DELAY(0x04) |
+            XCVR_PLL_DIG_DELAY_MATCH_LPM_SDM_DELAY(0x03),
+        /* 70: XCVR_PLL_DIG->HPMCAL_CTRL */
+        XCVR_FOLDED_HPMCAL_CTRL | XCVR_PLL_DIG_HPMCAL_CTRL_HPM_CAL_ARRAY_SIZE(0),
+        /* 71: XCVR_PLL_DIG->HPM_BUMP */
+        XCVR_FOLDED_HPM_BUMP | XCVR_PLL_DIG_HPM_BUMP_HPM_VCM_CAL(2) | XCVR_PLL_DIG_HPM_BUMP_HPM_VCM_TX(2),
+        /* 72: XCVR_PLL_DIG->HPM_CAL_TIMING */
+        XCVR_FOLDED_HPM_CAL_TIMING,
+        /* 73: XCVR_PLL_DIG->HPM_CTRL */
+        XCVR_FOLDED_HPM_CTRL,
+        /* 74: XCVR_PLL_DIG->HPM_SDM_RES */
+        XCVR_FOLDED_HPM_SDM_RES | XCVR_PLL_DIG_HPM_SDM_RES_HPM_COUNT_ADJUST(0x02),
+        /* 75: XCVR_PLL_DIG->LOCK_DETECT */
+        XCVR_FOLDED_LOCK_DETECT,
+        /* 76: XCVR_PLL_DIG->LPM_CTRL */
+        XCVR_FOLDED_LPM_CTRL,
+        /* 77: XCVR_PLL_DIG->LPM_SDM_CTRL1 */
+        XCVR_FOLDED_LPM_SDM_CTRL1,
+        /* 78: XCVR_PLL_DIG->MOD_CTRL */
+        XCVR_FOLDED_MOD_CTRL,
+        /* 79: XCVR_PLL_DIG->PLL_DATARATE_CTRL */
+        XCVR_FOLDED_PLL_DATARATE_CTRL,
+        /* 80: XCVR_PLL_DIG->TUNING_CAP_RX_CTRL */
+        XCVR_FOLDED_TUNING_CAP_RX_CTRL,
+        /* 81: XCVR_PLL_DIG->TUNING_CAP_TX_CTRL */
+        XCVR_FOLDED_TUNING_CAP_TX_CTRL,
+        /* 82: XCVR_RX_DIG->ACQ_FILT_0_3 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x3E) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x01) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x08) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x0D),
+#else
+        XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x02) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x05) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x7F) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x73),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 83: XCVR_RX_DIG->ACQ_FILT_0_3_DRS */
+        XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H0(0x00) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H1(0x00) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H2(0x00) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H3(0x00),
+        /* 84: XCVR_RX_DIG->ACQ_FILT_10_11 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x06F) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x09D),
+#else
+        XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x061) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x0EF),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 85: XCVR_RX_DIG->ACQ_FILT_10_11_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x06B) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x0B3),
+#else
+        XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x024) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x119),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 86: XCVR_RX_DIG->ACQ_FILT_4_7 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x09) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x77) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_H6(0xE2) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0xDB),
+#else
+        XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x78) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x14) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_H6(0x22) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0xF8),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 87: XCVR_RX_DIG->ACQ_FILT_4_7_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x03) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x05) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0xFB) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0xE6),
+#else
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x01) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x79) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0xFE) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0x1C),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 88: XCVR_RX_DIG->ACQ_FILT_8_9 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x1F4) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x02C),
+#else
+        XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x1BC) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x1D5),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 89: XCVR_RX_DIG->ACQ_FILT_8_9_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x1E5) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x013),
+#else
+        XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x1FC) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x1B3),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 90: XCVR_RX_DIG->AGC_CTRL */
+        XCVR_FOLDED_AGC_CTRL,
+        /* 91: XCVR_RX_DIG->AGC_CTRL_STAT */
+        XCVR_FOLDED_AGC_CTRL_STAT,
+        /* 92: XCVR_RX_DIG->AGC_IDX0_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX0_GAIN_CFG,
+        /* 93: XCVR_RX_DIG->AGC_IDX0_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX0_GAIN_VAL,
+        /* 94: XCVR_RX_DIG->AGC_IDX0_THR */
+        XCVR_FOLDED_AGC_IDX0_THR,
+        /* 95: XCVR_RX_DIG->AGC_IDX10_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX10_GAIN_CFG,
+        /* 96: XCVR_RX_DIG->AGC_IDX10_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX10_GAIN_VAL,
+        /* 97: XCVR_RX_DIG->AGC_IDX10_THR */
+        XCVR_FOLDED_AGC_IDX10_THR,
+        /* 98: XCVR_RX_DIG->AGC_IDX11_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX11_GAIN_CFG | XCVR_RX_DIG_AGC_IDX11_GAIN_CFG_MAG_THR_11_DRS_OFS(0x00) |
+            XCVR_RX_DIG_AGC_IDX11_GAIN_CFG_MAG_THR_HI_11_DRS_OFS(0x00),
+        /* 99: XCVR_RX_DIG->AGC_IDX11_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX11_GAIN_VAL | XCVR_RX_DIG_AGC_IDX11_GAIN_VAL_MAG_THR_11(0x000) |
+            XCVR_RX_DIG_AGC_IDX11_GAIN_VAL_MAG_THR_HI_11(0x000),
+        /* 100: XCVR_RX_DIG->AGC_IDX11_THR */
+        XCVR_FOLDED_AGC_IDX11_THR,
+        /* 101: XCVR_RX_DIG->AGC_IDX1_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX1_GAIN_CFG,
+        /* 102: XCVR_RX_DIG->AGC_IDX1_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX1_GAIN_VAL,
+        /* 103: XCVR_RX_DIG->AGC_IDX1_THR */
+        XCVR_FOLDED_AGC_IDX1_THR,
+        /* 104: XCVR_RX_DIG->AGC_IDX2_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX2_GAIN_CFG,
+        /* 105: XCVR_RX_DIG->AGC_IDX2_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX2_GAIN_VAL,
+        /* 106: XCVR_RX_DIG->AGC_IDX2_THR */
+        XCVR_FOLDED_AGC_IDX2_THR,
+        /* 107: XCVR_RX_DIG->AGC_IDX3_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX3_GAIN_CFG,
+        /* 108: XCVR_RX_DIG->AGC_IDX3_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX3_GAIN_VAL,
+        /* 109: XCVR_RX_DIG->AGC_IDX3_THR */
+        XCVR_FOLDED_AGC_IDX3_THR,
+        /* 110: XCVR_RX_DIG->AGC_IDX4_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX4_GAIN_CFG,
+        /* 111: XCVR_RX_DIG->AGC_IDX4_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX4_GAIN_VAL,
+        /* 112: XCVR_RX_DIG->AGC_IDX4_THR */
+        XCVR_FOLDED_AGC_IDX4_THR,
+        /* 113: XCVR_RX_DIG->AGC_IDX5_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX5_GAIN_CFG,
+        /* 114: XCVR_RX_DIG->AGC_IDX5_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX5_GAIN_VAL,
+        /* 115: XCVR_RX_DIG->AGC_IDX5_THR */
+        XCVR_FOLDED_AGC_IDX5_THR,
+        /* 116: XCVR_RX_DIG->AGC_IDX6_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX6_GAIN_CFG,
+        /* 117: XCVR_RX_DIG->AGC_IDX6_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX6_GAIN_VAL,
+        /* 118: XCVR_RX_DIG->AGC_IDX6_THR */
+        XCVR_FOLDED_AGC_IDX6_THR,
+        /* 119: XCVR_RX_DIG->AGC_IDX7_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX7_GAIN_CFG,
+        /* 120: XCVR_RX_DIG->AGC_IDX7_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX7_GAIN_VAL,
+        /* 121: XCVR_RX_DIG->AGC_IDX7_THR */
+        XCVR_FOLDED_AGC_IDX7_THR,
+        /* 122: XCVR_RX_DIG->AGC_IDX8_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX8_GAIN_CFG,
+        /* 123: XCVR_RX_DIG->AGC_IDX8_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX8_GAIN_VAL,
+        /* 124: XCVR_RX_DIG->AGC_IDX8_THR */
+        XCVR_FOLDED_AGC_IDX8_THR,
+        /* 125: XCVR_RX_DIG->AGC_IDX9_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX9_GAIN_CFG,
+        /* 126: XCVR_RX_DIG->AGC_IDX9_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX9_GAIN_VAL,
+        /* 127: XCVR_RX_DIG->AGC_IDX9_THR */
+        XCVR_FOLDED_AGC_IDX9_THR,
+        /* 128: XCVR_RX_DIG->AGC_MIS_GAIN_CFG */
+        XCVR_FOLDED_AGC_MIS_GAIN_CFG,
+        /* 129: XCVR_RX_DIG->AGC_THR_FAST */
+        XCVR_FOLDED_AGC_THR_FAST,
+        /* 130: XCVR_RX_DIG->AGC_THR_FAST_DRS */
+        XCVR_FOLDED_AGC_THR_FAST_DRS,
+        /* 131: XCVR_RX_DIG->AGC_THR_MIS */
+        XCVR_FOLDED_AGC_THR_MIS,
+        /* 132: XCVR_RX_DIG->AGC_TIMING0 */
+        XCVR_FOLDED_AGC_TIMING0 | XCVR_RX_DIG_AGC_TIMING0_AGC_GAIN_STEP_WAIT(0x10),
+        /* 133: XCVR_RX_DIG->AGC_TIMING0_DRS */
+        XCVR_FOLDED_AGC_TIMING0_DRS | XCVR_RX_DIG_AGC_TIMING0_DRS_AGC_GAIN_STEP_WAIT(0x08),
+        /* 134: XCVR_RX_DIG->AGC_TIMING1 */
+        XCVR_FOLDED_AGC_TIMING1 | XCVR_RX_DIG_AGC_TIMING1_AGC_FREEZE_TIMEOUT(0x0A) |
+            XCVR_RX_DIG_AGC_TIMING1_AGC_HOLD_TIMEOUT(0x08),
+        /* 135: XCVR_RX_DIG->AGC_TIMING1_DRS */
+        XCVR_RX_DIG_AGC_TIMING1_DRS_AGC_FREEZE_TIMEOUT(0x27) | XCVR_RX_DIG_AGC_TIMING1_DRS_AGC_HOLD_TIMEOUT(0x14),
+        /* 136: XCVR_RX_DIG->AGC_TIMING2 */
+        XCVR_FOLDED_AGC_TIMING2 | XCVR_RX_DIG_AGC_TIMING2_AGC_UNFREEZE_FEAT_TIMEOUT(0x000) |
+            XCVR_RX_DIG_AGC_TIMING2_AGC_UNHOLD_FEAT_TIMEOUT(0x000),
+        /* 137: XCVR_RX_DIG->AGC_TIMING2_DRS */
+        XCVR_RX_DIG_AGC_TIMING2_DRS_AGC_UNFREEZE_FEAT_TIMEOUT(0x07F) |
+            XCVR_RX_DIG_AGC_TIMING2_DRS_AGC_UNHOLD_FEAT_TIMEOUT(0x000),
+        /* 138: XCVR_RX_DIG->CTRL0 */
+#if RF_OSC_26MHZ == 1
+        XCVR_FOLDED_CTRL0 | XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(2) |
+            XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x027) |
+            XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(1) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#else
+        XCVR_FOLDED_CTRL0 | XCVR_RX_DIG_CTRL0_CIC_ORDER(1) | XCVR_RX_DIG_CTRL0_CIC_RATE(3) |
+            XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x020) |
+            XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(1) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 139: XCVR_RX_DIG->CTRL0_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(4) |
+            XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x027),
+#else
+        XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(1) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(5) |
+            XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x020),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 140: XCVR_RX_DIG->CTRL1 */
+        XCVR_FOLDED_CTRL1,
+        /* 141: XCVR_RX_DIG->DCOC_CTRL0 */
+        XCVR_FOLDED_DCOC_CTRL0 | XCVR_RX_DIG_DCOC_CTRL0_DCOC_DAC_ORDER(1) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFII(0x6) |
+            XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFIIP(1) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFQQ(0x5) |
+            XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFQQP(1),
+        /* 142: XCVR_RX_DIG->DCOC_CTRL0_DRS */
+        XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFII(6) | XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFIIP(1) |
+            XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFQQ(5) | XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFQQP(1),
+        /* 143: XCVR_RX_DIG->DCOC_CTRL1 */
+        XCVR_FOLDED_DCOC_CTRL1,
+        /* 144: XCVR_RX_DIG->DEMOD_FILT_0_1 */
+        XCVR_RX_DIG_DEMOD_FILT_0_1_H0(0x1FD) | XCVR_RX_DIG_DEMOD_FILT_0_1_H1(0x1FE),
+        /* 145: XCVR_RX_DIG->DEMOD_FILT_0_1_DRS */
+        XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H0(0x1FD) | XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H1(0x1FC),
+        /* 146: XCVR_RX_DIG->DEMOD_FILT_2_4 */
+        XCVR_RX_DIG_DEMOD_FILT_2_4_H2(0x024) | XCVR_RX_DIG_DEMOD_FILT_2_4_H3(0x082) |
+            XCVR_RX_DIG_DEMOD_FILT_2_4_H4(0x0BA),
+        /* 147: XCVR_RX_DIG->DEMOD_FILT_2_4_DRS */
+        XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H2(0x020) | XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H3(0x084) |
+            XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H4(0x0C2),
+        /* 148: XCVR_RX_DIG->NB_RSSI_CTRL0 */
+        XCVR_FOLDED_NB_RSSI_CTRL0,
+        /* 149: XCVR_RX_DIG->NB_RSSI_CTRL1 */
+        XCVR_FOLDED_NB_RSSI_CTRL1,
+        /* 150: XCVR_RX_DIG->RCCAL_CTRL0 */
+        XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE(2) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE_DRS(4) |
+            XCVR_RX_DIG_RCCAL_CTRL0_CBPF_CCODE_OFFSET(0x00) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE(1) |
+            XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE_DRS(1) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CMPOUT_INV(0) |
+            XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CODE_OFFSET(0x0) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_SMPL_DLY(0),
+        /* 151: XCVR_RX_DIG->RSSI_GLOBAL_CTRL */
+        XCVR_FOLDED_RSSI_GLOBAL_CTRL | XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_CCA1_ED_EN(0),
+        /* 152: XCVR_RX_DIG->WB_RSSI_CTRL */
+        XCVR_FOLDED_WB_RSSI_CTRL,
+        /* 153: XCVR_TSM->CTRL */
+        XCVR_FOLDED_CTRL,
+        /* 154: XCVR_TSM->END_OF_SEQ */
+        XCVR_FOLDED_END_OF_SEQ,
+        /* 155: XCVR_TSM->FAST_CTRL1 */
+        XCVR_FOLDED_FAST_CTRL1,
+        /* 156: XCVR_TSM->FAST_CTRL2 */
+        XCVR_FOLDED_FAST_CTRL2,
+        /* 157: XCVR_TSM->FAST_CTRL3 */
+        XCVR_FOLDED_FAST_CTRL3,
+        /* 158: XCVR_TSM->RECYCLE_COUNT */
+        XCVR_FOLDED_RECYCLE_COUNT,
+        /* 159: XCVR_TSM->TIMING00 */
+        XCVR_FOLDED_TIMING00,
+        /* 160: XCVR_TSM->TIMING01 */
+        XCVR_FOLDED_TIMING01,
+        /* 161: XCVR_TSM->TIMING02 */
+        XCVR_FOLDED_TIMING02,
+        /* 162: XCVR_TSM->TIMING03 */
+        XCVR_FOLDED_TIMING03,
+        /* 163: XCVR_TSM->TIMING04 */
+        XCVR_FOLDED_TIMING04,
+        /* 164: XCVR_TSM->TIMING05 */
+        XCVR_FOLDED_TIMING05,
+        /* 165: XCVR_TSM->TIMING06 */
+        XCVR_FOLDED_TIMING06,
+        /* 166: XCVR_TSM->TIMING07 */
+        XCVR_FOLDED_TIMING07,
+        /* 167: XCVR_TSM->TIMING08 */
+        XCVR_FOLDED_TIMING08,
+        /* 168: XCVR_TSM->TIMING09 */
+        XCVR_FOLDED_TIMING09,
+        /* 169: XCVR_TSM->TIMING10 */
+        XCVR_FOLDED_TIMING10,
+        /* 170: XCVR_TSM->TIMING11 */
+        XCVR_FOLDED_TIMING11,
+        /* 171: XCVR_TSM->TIMING12 */
+        XCVR_FOLDED_TIMING12,
+        /* 172: XCVR_TSM->TIMING13 */
+        XCVR_FOLDED_TIMING13,
+        /* 173: XCVR_TSM->TIMING14 */
+        XCVR_FOLDED_TIMING14,
+        /* 174: XCVR_TSM->TIMING15 */
+        XCVR_FOLDED_TIMING15,
+        /* 175: XCVR_TSM->TIMING16 */
+        XCVR_FOLDED_TIMING16,
+        /* 176: XCVR_TSM->TIMING17 */
+        XCVR_FOLDED_TIMING17,
+        /* 177: XCVR_TSM->TIMING18 */
+        XCVR_FOLDED_TIMING18,
+        /* 178: XCVR_TSM->TIMING19 */
+        XCVR_FOLDED_TIMING19,
+        /* 179: XCVR_TSM->TIMING20 */
+        XCVR_FOLDED_TIMING20,
+        /* 180: XCVR_TSM->TIMING21 */
+        XCVR_FOLDED_TIMING21,
+        /* 181: XCVR_TSM->TIMING22 */
+        XCVR_FOLDED_TIMING22,
+        /* 182: XCVR_TSM->TIMING23 */
+        XCVR_FOLDED_TIMING23,
+        /* 183: XCVR_TSM->TIMING24 */
+        XCVR_FOLDED_TIMING24,
+        /* 184: XCVR_TSM->TIMING25 */
+        XCVR_FOLDED_TIMING25,
+        /* 185: XCVR_TSM->TIMING26 */
+        XCVR_FOLDED_TIMING26,
+        /* 186: XCVR_TSM->TIMING27 */
+        XCVR_FOLDED_TIMING27,
+        /* 187: XCVR_TSM->TIMING28 */
+        XCVR_FOLDED_TIMING28,
+        /* 188: XCVR_TSM->TIMING29 */
+        XCVR_FOLDED_TIMING29,
+        /* 189: XCVR_TSM->TIMING30 */
+        XCVR_FOLDED_TIMING30,
+        /* 190: XCVR_TSM->TIMING31 */
+        XCVR_FOLDED_TIMING31,
+        /* 191: XCVR_TSM->TIMING32 */
+        XCVR_FOLDED_TIMING32,
+        /* 192: XCVR_TSM->TIMING33 */
+        XCVR_FOLDED_TIMING33,
+        /* 193: XCVR_TSM->TIMING34 */
+        XCVR_FOLDED_TIMING34,
+        /* 194: XCVR_TSM->TIMING35 */
+        XCVR_FOLDED_TIMING35,
+        /* 195: XCVR_TSM->TIMING36 */
+        XCVR_FOLDED_TIMING36,
+        /* 196: XCVR_TSM->TIMING37 */
+        XCVR_FOLDED_TIMING37,
+        /* 197: XCVR_TSM->TIMING38 */
+        XCVR_FOLDED_TIMING38,
+        /* 198: XCVR_TSM->TIMING39 */
+        XCVR_FOLDED_TIMING39,
+        /* 199: XCVR_TSM->TIMING40 */
+        XCVR_FOLDED_TIMING40,
+        /* 200: XCVR_TSM->TIMING41 */
+        XCVR_FOLDED_TIMING41,
+        /* 201: XCVR_TSM->TIMING42 */
+        XCVR_FOLDED_TIMING42,
+        /* 202: XCVR_TSM->TIMING43 */
+        XCVR_FOLDED_TIMING43,
+        /* 203: XCVR_TSM->TIMING44 */
+        XCVR_FOLDED_TIMING44,
+        /* 204: XCVR_TSM->TIMING45 */
+        XCVR_FOLDED_TIMING45,
+        /* 205: XCVR_TSM->TIMING46 */
+        XCVR_FOLDED_TIMING46,
+        /* 206: XCVR_TSM->TIMING47 */
+        XCVR_FOLDED_TIMING47,
+        /* 207: XCVR_TSM->TIMING48 */
+        XCVR_FOLDED_TIMING48,
+        /* 208: XCVR_TSM->TIMING49 */
+        XCVR_FOLDED_TIMING49,
+        /* 209: XCVR_TSM->TIMING50 */
+        XCVR_FOLDED_TIMING50,
+        /* 210: XCVR_TSM->TIMING51 */
+        XCVR_FOLDED_TIMING51,
+        /* 211: XCVR_TSM->TIMING52 */
+        XCVR_FOLDED_TIMING52,
+        /* 212: XCVR_TSM->WU_LATENCY */
+        XCVR_FOLDED_WU_LATENCY,
+        /* 213: XCVR_TX_DIG->DATARATE_CONFIG_FILTER_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(3) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(2) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(1),
+#else
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(4) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(3) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(2) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(1),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 214: XCVR_TX_DIG->DATARATE_CONFIG_FSK_CTRL */
+        XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV0(0x0000) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV1(0x0000),
+        /* 215: XCVR_TX_DIG->DATARATE_CONFIG_GFSK_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x013D),
+#else
+        XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x0101),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 216: XCVR_TX_DIG->DATA_PADDING_CTRL */
+        XCVR_FOLDED_DATA_PADDING_CTRL | XCVR_TX_DIG_DATA_PADDING_CTRL_DATA_PADDING_SEL(0) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_PAD_DLY(0) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_PAD_DLY_EN(1),
+        /* 217: XCVR_TX_DIG->DATA_PADDING_CTRL_1 */
+        XCVR_FOLDED_DATA_PADDING_CTRL_1 | XCVR_TX_DIG_DATA_PADDING_CTRL_1_RAMP_UP_DLY(0x04) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_1_TX_DATA_FLUSH_DLY(0x04),
+        /* 218: XCVR_TX_DIG->DATA_PADDING_CTRL_2 */
+        XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_MFDEV(0x1C00) | XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_PFDEV(0x0400),
+        /* 219: XCVR_TX_DIG->FSK_CTRL */
+        XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_0(0x1C00) | XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_1(0x0400),
+        /* 220: XCVR_TX_DIG->GFSK_COEFF_0_1 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_0(0x017) | XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_1(0x029),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_0(0x001) | XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_1(0x004),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 221: XCVR_TX_DIG->GFSK_COEFF_2_3 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_2(0x044) | XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_3(0x067),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_2(0x00D) | XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_3(0x028),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 222: XCVR_TX_DIG->GFSK_COEFF_4_5 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_4(0x090) | XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_5(0x0BA),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_4(0x063) | XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_5(0x0C0),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 223: XCVR_TX_DIG->GFSK_COEFF_6_7 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_6(0x0DC) | XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_7(0x0EF),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_6(0x12C) | XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_7(0x176),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 224: XCVR_TX_DIG->GFSK_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(0) |
+            XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x4E9),
+#else
+        XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(0) |
+            XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x3FD),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 225: XCVR_TX_DIG->IMAGE_FILTER_CTRL */
+        XCVR_FOLDED_IMAGE_FILTER_CTRL | XCVR_TX_DIG_IMAGE_FILTER_CTRL_IMAGE_FILTER_OVRD_EN(0),
+        /* 226: XCVR_TX_DIG->PA_CTRL */
+        XCVR_FOLDED_PA_CTRL | XCVR_TX_DIG_PA_CTRL_PA_RAMP_SEL(1),
+        /* 227: XCVR_TX_DIG->PA_RAMP_TBL0 */
+        XCVR_FOLDED_PA_RAMP_TBL0,
+        /* 228: XCVR_TX_DIG->PA_RAMP_TBL1 */
+        XCVR_FOLDED_PA_RAMP_TBL1,
+        /* 229: XCVR_TX_DIG->PA_RAMP_TBL2 */
+        XCVR_FOLDED_PA_RAMP_TBL2,
+        /* 230: XCVR_TX_DIG->PA_RAMP_TBL3 */
+        XCVR_FOLDED_PA_RAMP_TBL3,
+        /* 231: XCVR_TX_DIG->SWITCH_TX_CTRL */
+        XCVR_FOLDED_SWITCH_TX_CTRL,
+        /* 232: XCVR_TX_DIG->TXDIG_CTRL */
+        XCVR_FOLDED_TXDIG_CTRL | XCVR_TX_DIG_TXDIG_CTRL_DATA_STREAM_SEL(0) | XCVR_TX_DIG_TXDIG_CTRL_MODULATOR_SEL(0) |
+            XCVR_TX_DIG_TXDIG_CTRL_PFC_EN(0),
+    },
+};
+
+const xcvr_folded_config_t xcvr_gfsk_bt_0p5_h_0p7_1mbps_folded_config = {
+    .config     = &xcvr_gfsk_bt_0p5_h_0p7_1mbps_full_config,
+    .reg_values = {
+        /* 0: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x1C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x16) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x11) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x0B) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x06),
+        /* 1: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3A) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x35) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x2F) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x2A),
+        /* 2: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x24) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x1E) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x19),
+        /* 3: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x1C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x16) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x11) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x0B) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x06),
+        /* 4: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3A) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x35) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x2F) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x35),
+        /* 5: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x3A) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x06),
+        /* 6: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x11) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x0B) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x06) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3A),
+        /* 7: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x06) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x0B) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x11) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x0B),
+        /* 8: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x06) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x3A),
+        /* 9: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x11) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x0B) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x06) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3A),
+        /* 10: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x06) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x0B) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x11) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x16),
+        /* 11: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x1C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x22) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x27),
+        /* 12: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x2F) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x35) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x3A) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x06),
+        /* 13: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3A) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x35) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x2F) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x2A),
+        /* 14: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x24) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x1E) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x19),
+        /* 15: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x2F) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x35) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x3A) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x06),
+        /* 16: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3A) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x35) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x2F) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x35),
+        /* 17: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x3A) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x06),
+        /* 18: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x24) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x2A) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x2F) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x35) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3A),
+        /* 19: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x06) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x0B) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x11) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x0B),
+        /* 20: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x06) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x3A),
+        /* 21: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x24) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x2A) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x2F) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x35) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3A),
+        /* 22: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x06) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x0B) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x11) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x16),
+        /* 23: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x1C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x22) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x27),
+        /* 24: GEN4PHY->DMD_CTRL0 */
+        XCVR_FOLDED_DMD_CTRL0,
+        /* 25: GEN4PHY->DMD_CTRL1 */
+        XCVR_FOLDED_DMD_CTRL1,
+        /* 26: GEN4PHY->FSK_CFG0 */
+        XCVR_FOLDED_FSK_CFG0 | GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_1M(0x16) |
+            GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_2M(0x18) |
+            GEN4PHY_FSK_CFG0_MSK2FSK_SEED(0) | GEN4PHY_FSK_CFG0_MSK_EN(0),
+        /* 27: GEN4PHY->FSK_CFG1 */
+        GEN4PHY_FSK_CFG1_OVERH(0x02D) | GEN4PHY_FSK_CFG1_OVERH_INV(0x0B7) | GEN4PHY_FSK_CFG1_SYNCTSCALE(0xF),
+        /* 28: GEN4PHY->FSK_CFG2 */
+        XCVR_FOLDED_FSK_CFG2,
+        /* 29: GEN4PHY->FSK_FAD_CFG */
+        XCVR_FOLDED_FSK_FAD_CFG,
+        /* 30: GEN4PHY->FSK_FAD_CTRL */
+        XCVR_FOLDED_FSK_FAD_CTRL,
+        /* 31: GEN4PHY->FSK_PD_CFG0 */
+        GEN4PHY_FSK_PD_CFG0_PD_IIR_ALPHA(0xFF) | GEN4PHY_FSK_PD_CFG0_PREAMBLE_T_SCALE(0xC),
+        /* 32: GEN4PHY->FSK_PD_CFG1 */
+        GEN4PHY_FSK_PD_CFG1_PREAMBLE_PATTERN(0x55),
+        /* 33: GEN4PHY->FSK_PD_CFG2 */
+        GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_1M(0xD7) | GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_2M(0xF6),
+        /* 34: GEN4PHY->FSK_PD_PH[0] */
+        GEN4PHY_FSK_PD_PH_REF0(0x05) | GEN4PHY_FSK_PD_PH_REF1(0x07) | GEN4PHY_FSK_PD_PH_REF2(0x05) |
+            GEN4PHY_FSK_PD_PH_REF3(0x00),
+        /* 35: GEN4PHY->FSK_PD_PH[1] */
+        GEN4PHY_FSK_PD_PH_REF0(0x3B) | GEN4PHY_FSK_PD_PH_REF1(0x39) | GEN4PHY_FSK_PD_PH_REF2(0x3B) |
+            GEN4PHY_FSK_PD_PH_REF3(0x00),
+        /* 36: GEN4PHY->FSK_PT */
+        XCVR_FOLDED_FSK_PT | GEN4PHY_FSK_PT_AGC_TIMEOUT(0x0048),
+        /* 37: GEN4PHY->LR_AA_CFG */
+        GEN4PHY_LR_AA_CFG_AA_COR_THRESH(0x00) | GEN4PHY_LR_AA_CFG_AA_HAM_THRESH(0x00) |
+            GEN4PHY_LR_AA_CFG_AA_LR_CORR_GAIN(0x00) | GEN4PHY_LR_AA_CFG_ACCESS_ADDR_HAM(0x00),
+        /* 38: GEN4PHY->LR_PD_CFG */
+        GEN4PHY_LR_PD_CFG_CORR_TH(0x00) | GEN4PHY_LR_PD_CFG_FREQ_TH(0x00) | GEN4PHY_LR_PD_CFG_NO_PEAKS(0),
+        /* 39: GEN4PHY->LR_PD_PH[0] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 40: GEN4PHY->LR_PD_PH[1] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 41: GEN4PHY->LR_PD_PH[2] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 42: GEN4PHY->LR_PD_PH[3] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 43: GEN4PHY->MISC */
+        XCVR_FOLDED_MISC,
+        /* 44: GEN4PHY->PREPHY_MISC */
+        XCVR_FOLDED_PREPHY_MISC,
+        /* 45: GEN4PHY->RTT_CTRL */
+        XCVR_FOLDED_RTT_CTRL,
+        /* 46: GEN4PHY->RTT_REF */
+        GEN4PHY_RTT_REF_FM_REF_010(0x48) | GEN4PHY_RTT_REF_FM_REF_110(0x63) | GEN4PHY_RTT_REF_FM_REF_111(0x80),
+        /* 47: GEN4PHY->SM_CFG */
+        XCVR_FOLDED_SM_CFG | GEN4PHY_SM_CFG_AA_TIMEOUT_UNCODED(0x0A0),
+        /* 48: RADIO_CTRL->LL_CTRL */
+        RADIO_CTRL_LL_CTRL_ACTIVE_LL(2),
+        /* 49: XCVR_ANALOG->LDO_0 */
+        XCVR_FOLDED_LDO_0,
+        /* 50: XCVR_ANALOG->LDO_1 */
+        XCVR_FOLDED_LDO_1,
+        /* 51: XCVR_ANALOG->PLL */
+        XCVR_FOLDED_PLL,
+        /* 52: XCVR_ANALOG->RX_0 */
+        XCVR_FOLDED_RX_0,
+        /* 53: XCVR_ANALOG->RX_1 */
+        XCVR_FOLDED_RX_1,
+        /* 54: XCVR_ANALOG->TX_DAC_PA */
+        XCVR_FOLDED_TX_DAC_PA | XCVR_ANALOG_TX_DAC_PA_DAC_TRIM_CFBK_DRS(0),
+        /* 55: XCVR_ANALOG->XO_DIST */
+        XCVR_FOLDED_XO_DIST,
+        /* 56: XCVR_MISC->IPS_FO_ADDR[0] */
+        XCVR_MISC_IPS_FO_ADDR_ADDR(0x370) | XCVR_MISC_IPS_FO_ADDR_ENTRY_RX(0) | XCVR_MISC_IPS_FO_ADDR_ENTRY_TX(0),
+        /* 57: XCVR_MISC->IPS_FO_ADDR[1] */
+        XCVR_MISC_IPS_FO_ADDR_ADDR(0x02C) | XCVR_MISC_IPS_FO_ADDR_ENTRY_RX(0) | XCVR_MISC_IPS_FO_ADDR_ENTRY_TX(0),
+        /* 58: XCVR_MISC->IPS_FO_DRS0_DATA[0] */
+        XCVR_MISC_IPS_FO_DRS0_DATA_DRS0_DATA(0x00000000),
+        /* 59: XCVR_MISC->IPS_FO_DRS0_DATA[1] */
+        XCVR_MISC_IPS_FO_DRS0_DATA_DRS0_DATA(0x00000000),
+        /* 60: XCVR_MISC->IPS_FO_DRS1_DATA[0] */
+        XCVR_MISC_IPS_FO_DRS1_DATA_DRS1_DATA(0x00000000),
+        /* 61: XCVR_MISC->IPS_FO_DRS1_DATA[1] */
+        XCVR_MISC_IPS_FO_DRS1_DATA_DRS1_DATA(0x00000000),
+        /* 62: XCVR_MISC->LDO_TRIM_0 */
+        XCVR_FOLDED_LDO_TRIM_0,
+        /* 63: XCVR_MISC->LDO_TRIM_1 */
+        XCVR_FOLDED_LDO_TRIM_1,
+        /* 64: XCVR_MISC->XCVR_CTRL */
+        XCVR_FOLDED_XCVR_CTRL | XCVR_MISC_XCVR_CTRL_DATA_RATE_DRS(0) | XCVR_MISC_XCVR_CTRL_DEMOD_SEL(1) |
+            XCVR_MISC_XCVR_CTRL_LL_CFG_CAPT_DIS(0),
+        /* 65: XCVR_PLL_DIG->CHAN_MAP */
+        XCVR_FOLDED_CHAN_MAP | XCVR_PLL_DIG_CHAN_MAP_BAND_SELECT(0),
+        /* 66: XCVR_PLL_DIG->CHAN_MAP_EXT */
+#if RF_OSC_26MHZ == 1
+        XCVR_FOLDED_CHAN_MAP_EXT | XCVR_PLL_DIG_CHAN_MAP_EXT_NUM_OFFSET(0x013B13B),
+#else
+        XCVR_FOLDED_CHAN_MAP_EXT | XCVR_PLL_DIG_CHAN_MAP_EXT_NUM_OFFSET(0x0100000),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 67: XCVR_PLL_DIG->DATA_RATE_OVRD_CTRL1 */
+        XCVR_FOLDED_DATA_RATE_OVRD_CTRL1,
+        /* 68: XCVR_PLL_DIG->DATA_RATE_OVRD_CTRL2 */
+#if RF_OSC_26MHZ == 1
+        XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL2_NUM_OFFSET_CFG1(0x01D89D9),
+#else
+        XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL2_NUM_OFFSET_CFG1(0x0180000),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 69: XCVR_PLL_DIG->DELAY_MATCH */
+        XCVR_FOLDED_DELAY_MATCH | XCVR_PLL_DIG_DELAY_MATCH_HPM_INTEGER_DELAY(0x04) |
+            XCVR_PLL_DIG_DELAY_MATCH_LPM_SDM_DELAY(0x03),
+        /* 70: XCVR_PLL_DIG->HPMCAL_CTRL */
+        XCVR_FOLDED_HPMCAL_CTRL | XCVR_PLL_DIG_HPMCAL_CTRL_HPM_CAL_ARRAY_SIZE(0),
+        /* 71: XCVR_PLL_DIG->HPM_BUMP */
+        XCVR_FOLDED_HPM_BUMP | XCVR_PLL_DIG_HPM_BUMP_HPM_VCM_CAL(2) | XCVR_PLL_DIG_HPM_BUMP_HPM_VCM_TX(2),
+        /* 72: XCVR_PLL_DIG->HPM_CAL_TIMING */
+        XCVR_FOLDED_HPM_CAL_TIMING,
+        /* 73: XCVR_PLL_DIG->HPM_CTRL */
+        XCVR_FOLDED_HPM_CTRL,
+        /* 74: XCVR_PLL_DIG->HPM_SDM_RES */
+        XCVR_FOLDED_HPM_SDM_RES | XCVR_PLL_DIG_HPM_SDM_RES_HPM_COUNT_ADJUST(0x02),
+        /* 75: XCVR_PLL_DIG->LOCK_DETECT */
+        XCVR_FOLDED_LOCK_DETECT,
+        /* 76: XCVR_PLL_DIG->LPM_CTRL */
+        XCVR_FOLDED_LPM_CTRL,
+        /* 77: XCVR_PLL_DIG->LPM_SDM_CTRL1 */
+        XCVR_FOLDED_LPM_SDM_CTRL1,
+        /* 78: XCVR_PLL_DIG->MOD_CTRL */
+        XCVR_FOLDED_MOD_CTRL,
+        /* 79: XCVR_PLL_DIG->PLL_DATARATE_CTRL */
+        XCVR_FOLDED_PLL_DATARATE_CTRL,
+        /* 80: XCVR_PLL_DIG->TUNING_CAP_RX_CTRL */
+        XCVR_FOLDED_TUNING_CAP_RX_CTRL,
+        /* 81: XCVR_PLL_DIG->TUNING_CAP_TX_CTRL */
+        XCVR_FOLDED_TUNING_CAP_TX_CTRL,
+        /* 82: XCVR_RX_DIG->ACQ_FILT_0_3 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x3E) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x00) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x06) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x0C),
+#else
+        XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x00) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x05) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x03) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x76),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 83: XCVR_RX_DIG->ACQ_FILT_0_3_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H0(0x01) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H1(0x05) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H2(0x09) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H3(0x07),
+#else
+        XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H0(0x02) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H1(0x3E) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H2(0x78) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H3(0x7A),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 84: XCVR_RX_DIG->ACQ_FILT_10_11 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x06B) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x099),
+#else
+        XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x05A) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x0EF),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 85: XCVR_RX_DIG->ACQ_FILT_10_11_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x06B) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x08C),
+#else
+        XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x06E) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x0D4),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 86: XCVR_RX_DIG->ACQ_FILT_4_7 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x0A) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x7C) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_H6(0xE7) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0xDE),
+#else
+        XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x72) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x0B) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_H6(0x23) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0x04),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 87: XCVR_RX_DIG->ACQ_FILT_4_7_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x7D) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x6D) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0xE2) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0xE7),
+#else
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x0B) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x1A) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0x0C) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0xDF),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 88: XCVR_RX_DIG->ACQ_FILT_8_9 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x1F4) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x029),
+#else
+        XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x1C4) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x1D0),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 89: XCVR_RX_DIG->ACQ_FILT_8_9_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x005) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x037),
+#else
+        XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x1C5) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x1F7),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 90: XCVR_RX_DIG->AGC_CTRL */
+        XCVR_FOLDED_AGC_CTRL,
+        /* 91: XCVR_RX_DIG->AGC_CTRL_STAT */
+        XCVR_FOLDED_AGC_CTRL_STAT,
+        /* 92: XCVR_RX_DIG->AGC_IDX0_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX0_GAIN_CFG,
+        /* 93: XCVR_RX_DIG->AGC_IDX0_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX0_GAIN_VAL,
+        /* 94: XCVR_RX_DIG->AGC_IDX0_THR */
+        XCVR_FOLDED_AGC_IDX0_THR,
+        /* 95: XCVR_RX_DIG->AGC_IDX10_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX10_GAIN_CFG,
+        /* 96: XCVR_RX_DIG->AGC_IDX10_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX10_GAIN_VAL,
+        /* 97: XCVR_RX_DIG->AGC_IDX10_THR */
+        XCVR_FOLDED_AGC_IDX10_THR,
+        /* 98: XCVR_RX_DIG->AGC_IDX11_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX11_GAIN_CFG | XCVR_RX_DIG_AGC_IDX11_GAIN_CFG_MAG_THR_11_DRS_OFS(0x00) |
+            XCVR_RX_DIG_AGC_IDX11_GAIN_CFG_MAG_THR_HI_11_DRS_OFS(0x00),
+        /* 99: XCVR_RX_DIG->AGC_IDX11_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX11_GAIN_VAL | XCVR_RX_DIG_AGC_IDX11_GAIN_VAL_MAG_THR_11(0x000) |
+            XCVR_RX_DIG_AGC_IDX11_GAIN_VAL_MAG_THR_HI_11(0x000),
+        /* 100: XCVR_RX_DIG->AGC_IDX11_THR */
+        XCVR_FOLDED_AGC_IDX11_THR,
+        /* 101: XCVR_RX_DIG->AGC_IDX1_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX1_GAIN_CFG,
+        /* 102: XCVR_RX_DIG->AGC_IDX1_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX1_GAIN_VAL,
+        /* 103: XCVR_RX_DIG->AGC_IDX1_THR */
+        XCVR_FOLDED_AGC_IDX1_THR,
+        /* 104: XCVR_RX_DIG->AGC_IDX2_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX2_GAIN_CFG,
+        /* 105: XCVR_RX_DIG->AGC_IDX2_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX2_GAIN_VAL,
+        /* 106: XCVR_RX_DIG->AGC_IDX2_THR */
+        XCVR_FOLDED_AGC_IDX2_THR,
+        /* 107: XCVR_RX_DIG->AGC_IDX3_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX3_GAIN_CFG,
+        /* 108: XCVR_RX_DIG->AGC_IDX3_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX3_GAIN_VAL,
+        /* 109: XCVR_RX_DIG->AGC_IDX3_THR */
+        XCVR_FOLDED_AGC_IDX3_THR,
+        /* 110: XCVR_RX_DIG->AGC_IDX4_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX4_GAIN_CFG,
+        /* 111: XCVR_RX_DIG->AGC_IDX4_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX4_GAIN_VAL,
+        /* 112: XCVR_RX_DIG->AGC_IDX4_THR */
+        XCVR_FOLDED_AGC_IDX4_THR,
+        /* 113: XCVR_RX_DIG->AGC_IDX5_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX5_GAIN_CFG,
+        /* 114: XCVR_RX_DIG->AGC_IDX5_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX5_GAIN_VAL,
+        /* 115: XCVR_RX_DIG->AGC_IDX5_THR */
+        XCVR_FOLDED_AGC_IDX5_THR,
+        /* 116: XCVR_RX_DIG->AGC_IDX6_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX6_GAIN_CFG,
+        /* 117: XCVR_RX_DIG->AGC_IDX6_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX6_GAIN_VAL,
+        /* 118: XCVR_RX_DIG->AGC_IDX6_THR */
+        XCVR_FOLDED_AGC_IDX6_THR,
+        /* 119: XCVR_RX_DIG->AGC_IDX7_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX7_GAIN_CFG,
+        /* 120: XCVR_RX_DIG->AGC_IDX7_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX7_GAIN_VAL,
+        /* 121: XCVR_RX_DIG->AGC_IDX7_THR */
+        XCVR_FOLDED_AGC_IDX7_THR,
+        /* 122: XCVR_RX_DIG->AGC_IDX8_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX8_GAIN_CFG,
+        /* 123: XCVR_RX_DIG->AGC_IDX8_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX8_GAIN_VAL,
+        /* 124: XCVR_RX_DIG->AGC_IDX8_THR */
+        XCVR_FOLDED_AGC_IDX8_THR,
+        /* 125: XCVR_RX_DIG->AGC_IDX9_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX9_GAIN_CFG,
+        /* 126: XCVR_RX_DIG->AGC_IDX9_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX9_GAIN_VAL,
+        /* 127: XCVR_RX_DIG->AGC_IDX9_THR */
+        XCVR_FOLDED_AGC_IDX9_THR,
+        /* 128: XCVR_RX_DIG->AGC_MIS_GAIN_CFG */
+        XCVR_FOLDED_AGC_MIS_GAIN_CFG,
+        /* 129: XCVR_RX_DIG->AGC_THR_FAST */
+        XCVR_FOLDED_AGC_THR_FAST,
+        /* 130: XCVR_RX_DIG->AGC_THR_FAST_DRS */
+        XCVR_FOLDED_AGC_THR_FAST_DRS,
+        /* 131: XCVR_RX_DIG->AGC_THR_MIS */
+        XCVR_FOLDED_AGC_THR_MIS,
+        /* 132: XCVR_RX_DIG->AGC_TIMING0 */
+        XCVR_FOLDED_AGC_TIMING0 | XCVR_RX_DIG_AGC_TIMING0_AGC_GAIN_STEP_WAIT(0x10),
+        /* 133: XCVR_RX_DIG->AGC_TIMING0_DRS */
+        XCVR_FOLDED_AGC_TIMING0_DRS | XCVR_RX_DIG_AGC_TIMING0_DRS_AGC_GAIN_STEP_WAIT(0x10),
+        /* 134: XCVR_RX_DIG->AGC_TIMING1 */
+        XCVR_FOLDED_AGC_TIMING1 | XCVR_RX_DIG_AGC_TIMING1_AGC_FREEZE_TIMEOUT(0x0A) |
+            XCVR_RX_DIG_AGC_TIMING1_AGC_HOLD_TIMEOUT(0x08),
+        /* 135: XCVR_RX_DIG->AGC_TIMING1_DRS */
+        XCVR_RX_DIG_AGC_TIMING1_DRS_AGC_FREEZE_TIMEOUT(0x0A) | XCVR_RX_DIG_AGC_TIMING1_DRS_AGC_HOLD_TIMEOUT(0x08),
+        /* 136: XCVR_RX_DIG->AGC_TIMING2 */
+        XCVR_FOLDED_AGC_TIMING2 | XCVR_RX_DIG_AGC_TIMING2_AGC_UNFREEZE_FEAT_TIMEOUT(0x000) |
+            XCVR_RX_DIG_AGC_TIMING2_AGC_UNHOLD_FEAT_TIMEOUT(0x000),
+        /* 137: XCVR_RX_DIG->AGC_TIMING2_DRS */
+        XCVR_RX_DIG_AGC_TIMING2_DRS_AGC_UNFREEZE_FEAT_TIMEOUT(0x000) |
+            XCVR_RX_DIG_AGC_TIMING2_DRS_AGC_UNHOLD_FEAT_TIMEOUT(0x000),
+        /* 138: XCVR_RX_DIG->CTRL0 */
+#if RF_OSC_26MHZ == 1
+        XCVR_FOLDED_CTRL0 | XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(2) |
+            XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x027) |
+            XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(0) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#else
+        XCVR_FOLDED_CTRL0 | XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(3) |
+            XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x020) |
+            XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(0) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 139: XCVR_RX_DIG->CTRL0_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(1) |
+            XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x03B),
+#else
+        XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(2) |
+            XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x030),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 140: XCVR_RX_DIG->CTRL1 */
+        XCVR_FOLDED_CTRL1,
+        /* 141: XCVR_RX_DIG->DCOC_CTRL0 */
+        XCVR_FOLDED_DCOC_CTRL0 | XCVR_RX_DIG_DCOC_CTRL0_DCOC_DAC_ORDER(0) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFII(0x8) |
+            XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFIIP(1) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFQQ(0x2) |
+            XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFQQP(0),
+        /* 142: XCVR_RX_DIG->DCOC_CTRL0_DRS */
+        XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFII(4) | XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFIIP(1) |
+            XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFQQ(1) | XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFQQP(0),
+        /* 143: XCVR_RX_DIG->DCOC_CTRL1 */
+        XCVR_FOLDED_DCOC_CTRL1,
+        /* 144: XCVR_RX_DIG->DEMOD_FILT_0_1 */
+        XCVR_RX_DIG_DEMOD_FILT_0_1_H0(0x1FD) | XCVR_RX_DIG_DEMOD_FILT_0_1_H1(0x1FB),
+        /* 145: XCVR_RX_DIG->DEMOD_FILT_0_1_DRS */
+        XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H0(0x1FD) | XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H1(0x1FB),
+        /* 146: XCVR_RX_DIG->DEMOD_FILT_2_4 */
+        XCVR_RX_DIG_DEMOD_FILT_2_4_H2(0x01E) | XCVR_RX_DIG_DEMOD_FILT_2_4_H3(0x085) |
+            XCVR_RX_DIG_DEMOD_FILT_2_4_H4(0x0C6),
+        /* 147: XCVR_RX_DIG->DEMOD_FILT_2_4_DRS */
+        XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H2(0x01F) | XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H3(0x086) |
+            XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H4(0x0C6),
+        /* 148: XCVR_RX_DIG->NB_RSSI_CTRL0 */
+        XCVR_FOLDED_NB_RSSI_CTRL0,
+        /* 149: XCVR_RX_DIG->NB_RSSI_CTRL1 */
+        XCVR_FOLDED_NB_RSSI_CTRL1,
+        /* 150: XCVR_RX_DIG->RCCAL_CTRL0 */
+        XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE(2) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE_DRS(1) |
+            XCVR_RX_DIG_RCCAL_CTRL0_CBPF_CCODE_OFFSET(0x00) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE(1) |
+            XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE_DRS(0) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CMPOUT_INV(0) |
+            XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CODE_OFFSET(0x0) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_SMPL_DLY(0),
+        /* 151: XCVR_RX_DIG->RSSI_GLOBAL_CTRL */
+        XCVR_FOLDED_RSSI_GLOBAL_CTRL | XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_CCA1_ED_EN(0),
+        /* 152: XCVR_RX_DIG->WB_RSSI_CTRL */
+        XCVR_FOLDED_WB_RSSI_CTRL,
+        /* 153: XCVR_TSM->CTRL */
+        XCVR_FOLDED_CTRL,
+        /* 154: XCVR_TSM->END_OF_SEQ */
+        XCVR_FOLDED_END_OF_SEQ,
+        /* 155: XCVR_TSM->FAST_CTRL1 */
+        XCVR_FOLDED_FAST_CTRL1,
+        /* 156: XCVR_TSM->FAST_CTRL2 */
+        XCVR_FOLDED_FAST_CTRL2,
+        /* 157: XCVR_TSM->FAST_CTRL3 */
+        XCVR_FOLDED_FAST_CTRL3,
+        /* 158: XCVR_TSM->RECYCLE_COUNT */
+        XCVR_FOLDED_RECYCLE_COUNT,
+        /* 159: XCVR_TSM->TIMING00 */
+        XCVR_FOLDED_TIMING00,
+        /* 160: XCVR_TSM->TIMING01 */
+        XCVR_FOLDED_TIMING01,
+        /* 161: XCVR_TSM->TIMING02 */
+        XCVR_FOLDED_TIMING02,
+        /* 162: XCVR_TSM->TIMING03 */
+        XCVR_FOLDED_TIMING03,
+        /* 163: XCVR_TSM->TIMING04 */
+        XCVR_FOLDED_TIMING04,
+        /* 164: XCVR_TSM->TIMING05 */
+        XCVR_FOLDED_TIMING05,
+        /* 165: XCVR_TSM->TIMING06 */
+        XCVR_FOLDED_TIMING06,
+        /* 166: XCVR_TSM->TIMING07 */
+        XCVR_FOLDED_TIMING07,
+        /* 167: XCVR_TSM->TIMING08 */
+        XCVR_FOLDED_TIMING08,
+        /* 168: XCVR_TSM->TIMING09 */
+        XCVR_FOLDED_TIMING09,
+        /* 169: XCVR_TSM->TIMING10 */
+        XCVR_FOLDED_TIMING10,
+        /* 170: XCVR_TSM->TIMING11 */
+        XCVR_FOLDED_TIMING11,
+        /* 171: XCVR_TSM->TIMING12 */
+        XCVR_FOLDED_TIMING12,
+        /* 172: XCVR_TSM->TIMING13 */
+        XCVR_FOLDED_TIMING13,
+        /* 173: XCVR_TSM->TIMING14 */
+        XCVR_FOLDED_TIMING14,
+        /* 174: XCVR_TSM->TIMING15 */
+        XCVR_FOLDED_TIMING15,
+        /* 175: XCVR_TSM->TIMING16 */
+        XCVR_FOLDED_TIMING16,
+        /* 176: XCVR_TSM->TIMING17 */
+        XCVR_FOLDED_TIMING17,
+        /* 177: XCVR_TSM->TIMING18 */
+        XCVR_FOLDED_TIMING18,
+        /* 178: XCVR_TSM->TIMING19 */
+        XCVR_FOLDED_TIMING19,
+        /* 179: XCVR_TSM->TIMING20 */
+        XCVR_FOLDED_TIMING20,
+        /* 180: XCVR_TSM->TIMING21 */
+        XCVR_FOLDED_TIMING21,
+        /* 181: XCVR_TSM->TIMING22 */
+        XCVR_FOLDED_TIMING22,
+        /* 182: XCVR_TSM->TIMING23 */
+        XCVR_FOLDED_TIMING23,
+        /* 183: XCVR_TSM->TIMING24 */
+        XCVR_FOLDED_TIMING24,
+        /* 184: XCVR_TSM->TIMING25 */
+        XCVR_FOLDED_TIMING25,
+        /* 185: XCVR_TSM->TIMING26 */
+        XCVR_FOLDED_TIMING26,
+        /* 186: XCVR_TSM->TIMING27 */
+        XCVR_FOLDED_TIMING27,
+        /* 187: XCVR_TSM->TIMING28 */
+        XCVR_FOLDED_TIMING28,
+        /* 188: XCVR_TSM->TIMING29 */
+        XCVR_FOLDED_TIMING29,
+        /* 189: XCVR_TSM->TIMING30 */
+        XCVR_FOLDED_TIMING30,
+        /* 190: XCVR_TSM->TIMING31 */
+        XCVR_FOLDED_TIMING31,
+        /* 191: XCVR_TSM->TIMING32 */
+        XCVR_FOLDED_TIMING32,
+        /* 192: XCVR_TSM->TIMING33 */
+        XCVR_FOLDED_TIMING33,
+        /* 193: XCVR_TSM->TIMING34 */
+        XCVR_FOLDED_TIMING34,
+        /* 194: XCVR_TSM->TIMING35 */
+        XCVR_FOLDED_TIMING35,
+        /* 195: XCVR_TSM->TIMING36 */
+        XCVR_FOLDED_TIMING36,
+        /* 196: XCVR_TSM->TIMING37 */
+        XCVR_FOLDED_TIMING37,
+        /* 197: XCVR_TSM->TIMING38 */
+        XCVR_FOLDED_TIMING38,
+        /* 198: XCVR_TSM->TIMING39 */
+        XCVR_FOLDED_TIMING39,
+        /* 199: XCVR_TSM->TIMING40 */
+        XCVR_FOLDED_TIMING40,
+        /* 200: XCVR_TSM->TIMING41 */
+        XCVR_FOLDED_TIMING41,
+        /* 201: XCVR_TSM->TIMING42 */
+        XCVR_FOLDED_TIMING42,
+        /* 202: XCVR_TSM->TIMING43 */
+        XCVR_FOLDED_TIMING43,
+        /* 203: XCVR_TSM->TIMING44 */
+        XCVR_FOLDED_TIMING44,
+        /* 204: XCVR_TSM->TIMING45 */
+        XCVR_FOLDED_TIMING45,
+        /* 205: XCVR_TSM->TIMING46 */
+        XCVR_FOLDED_TIMING46,
+        /* 206: XCVR_TSM->TIMING47 */
+        XCVR_FOLDED_TIMING47,
+        /* 207: XCVR_TSM->TIMING48 */
+        XCVR_FOLDED_TIMING48,
+        /* 208: XCVR_TSM->TIMING49 */
+        XCVR_FOLDED_TIMING49,
+        /* 209: XCVR_TSM->TIMING50 */
+        XCVR_FOLDED_TIMING50,
+        /* 210: XCVR_TSM->TIMING51 */
+        XCVR_FOLDED_TIMING51,
+        /* 211: XCVR_TSM->TIMING52 */
+        XCVR_FOLDED_TIMING52,
+        /* 212: XCVR_TSM->WU_LATENCY */
+        XCVR_FOLDED_WU_LATENCY,
+        /* 213: XCVR_TX_DIG->DATARATE_CONFIG_FILTER_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(0),
+#else
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(0),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 214: XCVR_TX_DIG->DATARATE_CONFIG_FSK_CTRL */
+        XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV0(0x0000) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV1(0x0000),
+        /* 215: XCVR_TX_DIG->DATARATE_CONFIG_GFSK_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x0DF8),
+#else
+        XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x0B60),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 216: XCVR_TX_DIG->DATA_PADDING_CTRL */
+        XCVR_FOLDED_DATA_PADDING_CTRL | XCVR_TX_DIG_DATA_PADDING_CTRL_DATA_PADDING_SEL(0) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_PAD_DLY(0) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_PAD_DLY_EN(1),
+        /* 217: XCVR_TX_DIG->DATA_PADDING_CTRL_1 */
+        XCVR_FOLDED_DATA_PADDING_CTRL_1 | XCVR_TX_DIG_DATA_PADDING_CTRL_1_RAMP_UP_DLY(0x04) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_1_TX_DATA_FLUSH_DLY(0x04),
+        /* 218: XCVR_TX_DIG->DATA_PADDING_CTRL_2 */
+        XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_MFDEV(0x1800) | XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_PFDEV(0x0800),
+        /* 219: XCVR_TX_DIG->FSK_CTRL */
+        XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_0(0x1800) | XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_1(0x0800),
+        /* 220: XCVR_TX_DIG->GFSK_COEFF_0_1 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_0(0x017) | XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_1(0x029),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_0(0x001) | XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_1(0x004),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 221: XCVR_TX_DIG->GFSK_COEFF_2_3 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_2(0x044) | XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_3(0x067),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_2(0x00D) | XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_3(0x028),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 222: XCVR_TX_DIG->GFSK_COEFF_4_5 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_4(0x090) | XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_5(0x0BA),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_4(0x063) | XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_5(0x0C0),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 223: XCVR_TX_DIG->GFSK_COEFF_6_7 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_6(0x0DC) | XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_7(0x0EF),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_6(0x12C) | XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_7(0x176),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 224: XCVR_TX_DIG->GFSK_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(0) |
+            XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x06EF),
+#else
+        XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(0) |
+            XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x05A2),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 225: XCVR_TX_DIG->IMAGE_FILTER_CTRL */
+        XCVR_FOLDED_IMAGE_FILTER_CTRL | XCVR_TX_DIG_IMAGE_FILTER_CTRL_IMAGE_FILTER_OVRD_EN(0),
+        /* 226: XCVR_TX_DIG->PA_CTRL */
+        XCVR_FOLDED_PA_CTRL | XCVR_TX_DIG_PA_CTRL_PA_RAMP_SEL(1),
+        /* 227: XCVR_TX_DIG->PA_RAMP_TBL0 */
+        XCVR_FOLDED_PA_RAMP_TBL0,
+        /* 228: XCVR_TX_DIG->PA_RAMP_TBL1 */
+        XCVR_FOLDED_PA_RAMP_TBL1,
+        /* 229: XCVR_TX_DIG->PA_RAMP_TBL2 */
+        XCVR_FOLDED_PA_RAMP_TBL2,
+        /* 230: XCVR_TX_DIG->PA_RAMP_TBL3 */
+        XCVR_FOLDED_PA_RAMP_TBL3,
+        /* 231: XCVR_TX_DIG->SWITCH_TX_CTRL */
+        XCVR_FOLDED_SWITCH_TX_CTRL,
+        /* 232: XCVR_TX_DIG->TXDIG_CTRL */
+        XCVR_FOLDED_TXDIG_CTRL | XCVR_TX_DIG_TXDIG_CTRL_DATA_STREAM_SEL(0) | XCVR_TX_DIG_TXDIG_CTRL_MODULATOR_SEL(0) |
+            XCVR_TX_DIG_TXDIG_CTRL_PFC_EN(0),
+    },
+};
+
+const xcvr_folded_config_t xcvr_gfsk_bt_0p5_h_0p7_500kbps_folded_config = {
+    .config     = &xcvr_gfsk_bt_0p5_h_0p7_500kbps_full_config,
+    .reg_values = {
+        /* 0: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x1C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x16) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x11) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x0B) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x06),
+        /* 1: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3A) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x35) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x2F) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x2A),
+        /* 2: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x24) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x1E) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x19),
+        /* 3: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x1C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x16) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x11) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x0B) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x06),
+        /* 4: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3A) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x35) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x2F) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x35),
+        /* 5: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x3A) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x06),
+        /* 6: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x11) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x0B) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x06) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3A),
+        /* 7: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x06) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x0B) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x11) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x0B),
+        /* 8: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x06) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x3A),
+        /* 9: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x11) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x0B) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x06) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3A),
+        /* 10: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x06) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x0B) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x11) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x16),
+        /* 11: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x1C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x22) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x27),
+        /* 12: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x2F) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x35) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x3A) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x06),
+        /* 13: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3A) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x35) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x2F) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x2A),
+        /* 14: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x24) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x1E) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x19),
+        /* 15: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x2F) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x35) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x3A) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x06),
+        /* 16: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3A) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x35) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x2F) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x35),
+        /* 17: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x3A) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x06),
+        /* 18: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x24) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x2A) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x2F) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x35) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3A),
+        /* 19: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x06) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x0B) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x11) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x0B),
+        /* 20: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x06) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x3A),
+        /* 21: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x24) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x2A) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x2F) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x35) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3A),
+        /* 22: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x06) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x0B) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x11) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x16),
+        /* 23: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x1C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x22) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x27),
+        /* 24: GEN4PHY->DMD_CTRL0 */
+        XCVR_FOLDED_DMD_CTRL0,
+        /* 25: GEN4PHY->DMD_CTRL1 */
+        XCVR_FOLDED_DMD_CTRL1,
+        /* 26: GEN4PHY->FSK_CFG0 */
+        XCVR_FOLDED_FSK_CFG0 | GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_1M(0x10) |
+            GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_2M(0x11) |
+            GEN4PHY_FSK_CFG0_MSK2FSK_SEED(0) | GEN4PHY_FSK_CFG0_MSK_EN(0),
+        /* 27: GEN4PHY->FSK_CFG1 */
+        GEN4PHY_FSK_CFG1_OVERH(0x02D) | GEN4PHY_FSK_CFG1_OVERH_INV(0x0B7) | GEN4PHY_FSK_CFG1_SYNCTSCALE(0xF),
+        /* 28: GEN4PHY->FSK_CFG2 */
+        XCVR_FOLDED_FSK_CFG2,
+        /* 29: GEN4PHY->FSK_FAD_CFG */
+        XCVR_FOLDED_FSK_FAD_CFG,
+        /* 30: GEN4PHY->FSK_FAD_CTRL */
+        XCVR_FOLDED_FSK_FAD_CTRL,
+        /* 31: GEN4PHY->FSK_PD_CFG0 */
+        GEN4PHY_FSK_PD_CFG0_PD_IIR_ALPHA(0xFF) | GEN4PHY_FSK_PD_CFG0_PREAMBLE_T_SCALE(0xC),
+        /* 32: GEN4PHY->FSK_PD_CFG1 */
+        GEN4PHY_FSK_PD_CFG1_PREAMBLE_PATTERN(0x55),
+        /* 33: GEN4PHY->FSK_PD_CFG2 */
+        GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_1M(0xD7) | GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_2M(0xEB),
+        /* 34: GEN4PHY->FSK_PD_PH[0] */
+        GEN4PHY_FSK_PD_PH_REF0(0x05) | GEN4PHY_FSK_PD_PH_REF1(0x07) | GEN4PHY_FSK_PD_PH_REF2(0x05) |
+            GEN4PHY_FSK_PD_PH_REF3(0x00),
+        /* 35: GEN4PHY->FSK_PD_PH[1] */
+        GEN4PHY_FSK_PD_PH_REF0(0x3B) | GEN4PHY_FSK_PD_PH_REF1(0x39) | GEN4PHY_FSK_PD_PH_REF2(0x3B) |
+            GEN4PHY_FSK_PD_PH_REF3(0x00),
+        /* 36: GEN4PHY->FSK_PT */
+        XCVR_FOLDED_FSK_PT | GEN4PHY_FSK_PT_AGC_TIMEOUT(0x0048),
+        /* 37: GEN4PHY->LR_AA_CFG */
+        GEN4PHY_LR_AA_CFG_AA_COR_THRESH(0x00) | GEN4PHY_LR_AA_CFG_AA_HAM_THRESH(0x00) |
+            GEN4PHY_LR_AA_CFG_AA_LR_CORR_GAIN(0x00) | GEN4PHY_LR_AA_CFG_ACCESS_ADDR_HAM(0x00),
+        /* 38: GEN4PHY->LR_PD_CFG */
+        GEN4PHY_LR_PD_CFG_CORR_TH(0x00) | GEN4PHY_LR_PD_CFG_FREQ_TH(0x00) | GEN4PHY_LR_PD_CFG_NO_PEAKS(0),
+        /* 39: GEN4PHY->LR_PD_PH[0] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 40: GEN4PHY->LR_PD_PH[1] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 41: GEN4PHY->LR_PD_PH[2] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 42: GEN4PHY->LR_PD_PH[3] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 43: GEN4PHY->MISC */
+        XCVR_FOLDED_MISC,
+        /* 44: GEN4PHY->PREPHY_MISC */
+        XCVR_FOLDED_PREPHY_MISC,
+        /* 45: GEN4PHY->RTT_CTRL */
+        XCVR_FOLDED_RTT_CTRL,
+        /* 46: GEN4PHY->RTT_REF */
+        GEN4PHY_RTT_REF_FM_REF_010(0x48) | GEN4PHY_RTT_REF_FM_REF_110(0x63) | GEN4PHY_RTT_REF_FM_REF_111(0x80),
+        /* 47: GEN4PHY->SM_CFG */
+        XCVR_FOLDED_SM_CFG | GEN4PHY_SM_CFG_AA_TIMEOUT_UNCODED(0x0A0),
+        /* 48: RADIO_CTRL->LL_CTRL */
+        RADIO_CTRL_LL_CTRL_ACTIVE_LL(2),
+        /* 49: XCVR_ANALOG->LDO_0 */
+        XCVR_FOLDED_LDO_0,
+        /* 50: XCVR_ANALOG->LDO_1 */
+        XCVR_FOLDED_LDO_1,
+        /* 51: XCVR_ANALOG->PLL */
+        XCVR_FOLDED_PLL,
+        /* 52: XCVR_ANALOG->RX_0 */
+        XCVR_FOLDED_RX_0,
+        /* 53: XCVR_ANALOG->RX_1 */
+        XCVR_FOLDED_RX_1,
+        /* 54: XCVR_ANALOG->TX_DAC_PA */
+        XCVR_FOLDED_TX_DAC_PA | XCVR_ANALOG_TX_DAC_PA_DAC_TRIM_CFBK_DRS(1),
+        /* 55: XCVR_ANALOG->XO_DIST */
+        XCVR_FOLDED_XO_DIST,
+        /* 56: XCVR_MISC->IPS_FO_ADDR[0] */
+        XCVR_MISC_IPS_FO_ADDR_ADDR(0x370) | XCVR_MISC_IPS_FO_ADDR_ENTRY_RX(0) | XCVR_MISC_IPS_FO_ADDR_ENTRY_TX(0),
+        /* 57: XCVR_MISC->IPS_FO_ADDR[1] */
+        XCVR_MISC_IPS_FO_ADDR_ADDR(0x02C) | XCVR_MISC_IPS_FO_ADDR_ENTRY_RX(0) | XCVR_MISC_IPS_FO_ADDR_ENTRY_TX(0),
+        /* 58: XCVR_MISC->IPS_FO_DRS0_DATA[0] */
+        XCVR_MISC_IPS_FO_DRS0_DATA_DRS0_DATA(0x00000000),
+        /* 59: XCVR_MISC->IPS_FO_DRS0_DATA[1] */
+        XCVR_MISC_IPS_FO_DRS0_DATA_DRS0_DATA(0x00000000),
+        /* 60: XCVR_MISC->IPS_FO_DRS1_DATA[0] */
+        XCVR_MISC_IPS_FO_DRS1_DATA_DRS1_DATA(0x00000000),
+        /* 61: XCVR_MISC->IPS_FO_DRS1_DATA[1] */
+        XCVR_MISC_IPS_FO_DRS1_DATA_DRS1_DATA(0x00000000),
+        /* 62: XCVR_MISC->LDO_TRIM_0 */
+        XCVR_FOLDED_LDO_TRIM_0,
+        /* 63: XCVR_MISC->LDO_TRIM_1 */
+        XCVR_FOLDED_LDO_TRIM_1,
+        /* 64: XCVR_MISC->XCVR_CTRL */
+        XCVR_FOLDED_XCVR_CTRL | XCVR_MISC_XCVR_CTRL_DATA_RATE_DRS(2) | XCVR_MISC_XCVR_CTRL_DEMOD_SEL(1) |
+            XCVR_MISC_XCVR_CTRL_LL_CFG_CAPT_DIS(0),
+        /* 65: XCVR_PLL_DIG->CHAN_MAP */
+        XCVR_FOLDED_CHAN_MAP | XCVR_PLL_DIG_CHAN_MAP_BAND_SELECT(0),
+        /* 66: XCVR_PLL_DIG->CHAN_MAP_EXT */
+#if RF_OSC_26MHZ == 1
+        XCVR_FOLDED_CHAN_MAP_EXT | XCVR_PLL_DIG_CHAN_MAP_EXT_NUM_OFFSET(0x013B13B),
+#else
+        XCVR_FOLDED_CHAN_MAP_EXT | XCVR_PLL_DIG_CHAN_MAP_EXT_NUM_OFFSET(0x0100000),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 67: XCVR_PLL_DIG->DATA_RATE_OVRD_CTRL1 */
+        XCVR_FOLDED_DATA_RATE_OVRD_CTRL1,
+        /* 68: XCVR_PLL_DIG->DATA_RATE_OVRD_CTRL2 */
+#if RF_OSC_26MHZ == 1
+        XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL2_NUM_OFFSET_CFG1(0x013B13B),
+#else
+        XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL2_NUM_OFFSET_CFG1(0x0100000),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 69: XCVR_PLL_DIG->DELAY_MATCH */
+        XCVR_FOLDED_DELAY_MATCH | XCVR_PLL_DIG_DELAY_MATCH_HPM_INTEGER_DELAY(0x04) |
+            XCVR_PLL_DIG_DELAY_MATCH_LPM_SDM_DELAY(0x03),
+        /* 70: XCVR_PLL_DIG->HPMCAL_CTRL */
+        XCVR_FOLDED_HPMCAL_CTRL | XCVR_PLL_DIG_HPMCAL_CTRL_HPM_CAL_ARRAY_SIZE(0),
+        /* 71: XCVR_PLL_DIG->HPM_BUMP */
+        XCVR_FOLDED_HPM_BUMP | XCVR_PLL_DIG_HPM_BUMP_HPM_VCM_CAL(2) | XCVR_PLL_DIG_HPM_BUMP_HPM_VCM_TX(2),
+        /* 72: XCVR_PLL_DIG->HPM_CAL_TIMING */
+        XCVR_FOLDED_HPM_CAL_TIMING,
+        /* 73: XCVR_PLL_DIG->HPM_CTRL */
+        XCVR_FOLDED_HPM_CTRL,
+        /* 74: XCVR_PLL_DIG->HPM_SDM_RES */
+        XCVR_FOLDED_HPM_SDM_RES | XCVR_PLL_DIG_HPM_SDM_RES_HPM_COUNT_ADJUST(0x02),
+        /* 75: XCVR_PLL_DIG->LOCK_DETECT */
+        XCVR_FOLDED_LOCK_DETECT,
+        /* 76: XCVR_PLL_DIG->LPM_CTRL */
+        XCVR_FOLDED_LPM_CTRL,
+        /* 77: XCVR_PLL_DIG->LPM_SDM_CTRL1 */
+        XCVR_FOLDED_LPM_SDM_CTRL1,
+        /* 78: XCVR_PLL_DIG->MOD_CTRL */
+        XCVR_FOLDED_MOD_CTRL,
+        /* 79: XCVR_PLL_DIG->PLL_DATARATE_CTRL */
+        XCVR_FOLDED_PLL_DATARATE_CTRL,
+        /* 80: XCVR_PLL_DIG->TUNING_CAP_RX_CTRL */
+        XCVR_FOLDED_TUNING_CAP_RX_CTRL,
+        /* 81: XCVR_PLL_DIG->TUNING_CAP_TX_CTRL */
+        XCVR_FOLDED_TUNING_CAP_TX_CTRL,
+        /* 82: XCVR_RX_DIG->ACQ_FILT_0_3 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x3E) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x00) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x06) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x0C),
+#else
+        XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x00) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x05) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x03) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x76),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 83: XCVR_RX_DIG->ACQ_FILT_0_3_DRS */
+        XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H0(0x00) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H1(0x00) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H2(0x00) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H3(0x00),
+        /* 84: XCVR_RX_DIG->ACQ_FILT_10_11 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x06B) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x099),
+#else
+        XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x05A) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x0EF),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 85: XCVR_RX_DIG->ACQ_FILT_10_11_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x066) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x0A9),
+#else
+        XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x039) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x10B),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 86: XCVR_RX_DIG->ACQ_FILT_4_7 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x0A) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x7C) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_H6(0xE7) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0xDE),
+#else
+        XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x72) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x0B) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_H6(0x23) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0x04),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 87: XCVR_RX_DIG->ACQ_FILT_4_7_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x04) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x06) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0xFB) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0xE8),
+#else
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x7E) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x79) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0x0B) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0x1B),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 88: XCVR_RX_DIG->ACQ_FILT_8_9 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x1F4) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x029),
+#else
+        XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x1C4) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x1D0),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 89: XCVR_RX_DIG->ACQ_FILT_8_9_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x1E7) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x014),
+#else
+        XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x1E6) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x1B9),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 90: XCVR_RX_DIG->AGC_CTRL */
+        XCVR_FOLDED_AGC_CTRL,
+        /* 91: XCVR_RX_DIG->AGC_CTRL_STAT */
+        XCVR_FOLDED_AGC_CTRL_STAT,
+        /* 92: XCVR_RX_DIG->AGC_IDX0_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX0_GAIN_CFG,
+        /* 93: XCVR_RX_DIG->AGC_IDX0_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX0_GAIN_VAL,
+        /* 94: XCVR_RX_DIG->AGC_IDX0_THR */
+        XCVR_FOLDED_AGC_IDX0_THR,
+        /* 95: XCVR_RX_DIG->AGC_IDX10_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX10_GAIN_CFG,
+        /* 96: XCVR_RX_DIG->AGC_IDX10_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX10_GAIN_VAL,
+        /* 97: XCVR_RX_DIG->AGC_IDX10_THR */
+        XCVR_FOLDED_AGC_IDX10_THR,
+        /* 98: XCVR_RX_DIG->AGC_IDX11_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX11_GAIN_CFG | XCVR_RX_DIG_AGC_IDX11_GAIN_CFG_MAG_THR_11_DRS_OFS(0x00) |
+            XCVR_RX_DIG_AGC_IDX11_GAIN_CFG_MAG_THR_HI_11_DRS_OFS(0x00),
+        /* 99: XCVR_RX_DIG->AGC_IDX11_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX11_GAIN_VAL | XCVR_RX_DIG_AGC_IDX11_GAIN_VAL_MAG_THR_11(0x000) |
+            XCVR_RX_DIG_AGC_IDX11_GAIN_VAL_MAG_THR_HI_11(0x000),
+        /* 100: XCVR_RX_DIG->AGC_IDX11_THR */
+        XCVR_FOLDED_AGC_IDX11_THR,
+        /* 101: XCVR_RX_DIG->AGC_IDX1_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX1_GAIN_CFG,
+        /* 102: XCVR_RX_DIG->AGC_IDX1_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX1_GAIN_VAL,
+        /* 103: XCVR_RX_DIG->AGC_IDX1_THR */
+        XCVR_FOLDED_AGC_IDX1_THR,
+        /* 104: XCVR_RX_DIG->AGC_IDX2_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX2_GAIN_CFG,
+        /* 105: XCVR_RX_DIG->AGC_IDX2_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX2_GAIN_VAL,
+        /* 106: XCVR_RX_DIG->AGC_IDX2_THR */
+        XCVR_FOLDED_AGC_IDX2_THR,
+        /* 107: XCVR_RX_DIG->AGC_IDX3_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX3_GAIN_CFG,
+        /* 108: XCVR_RX_DIG->AGC_IDX3_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX3_GAIN_VAL,
+        /* 109: XCVR_RX_DIG->AGC_IDX3_THR */
+        XCVR_FOLDED_AGC_IDX3_THR,
+        /* 110: XCVR_RX_DIG->AGC_IDX4_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX4_GAIN_CFG,
+        /* 111: XCVR_RX_DIG->AGC_IDX4_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX4_GAIN_VAL,
+        /* 112: XCVR_RX_DIG->AGC_IDX4_THR */
+        XCVR_FOLDED_AGC_IDX4_THR,
+        /* 113: XCVR_RX_DIG->AGC_IDX5_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX5_GAIN_CFG,
+        /* 114: XCVR_RX_DIG->AGC_IDX5_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX5_GAIN_VAL,
+        /* 115: XCVR_RX_DIG->AGC_IDX5_THR */
+        XCVR_FOLDED_AGC_IDX5_THR,
+        /* 116: XCVR_RX_DIG->AGC_IDX6_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX6_GAIN_CFG,
+        /* 117: XCVR_RX_DIG->AGC_IDX6_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX6_GAIN_VAL,
+        /* 118: XCVR_RX_DIG->AGC_IDX6_THR */
+        XCVR_FOLDED_AGC_IDX6_THR,
+        /* 119: XCVR_RX_DIG->AGC_IDX7_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX7_GAIN_CFG,
+        /* 120: XCVR_RX_DIG->AGC_IDX7_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX7_GAIN_VAL,
+        /* 121: XCVR_RX_DIG->AGC_IDX7_THR */
+        XCVR_FOLDED_AGC_IDX7_THR,
+        /* 122: XCVR_RX_DIG->AGC_IDX8_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX8_GAIN_CFG,
+        /* 123: XCVR_RX_DIG->AGC_IDX8_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX8_GAIN_VAL,
+        /* 124: XCVR_RX_DIG->AGC_IDX8_THR */
+        XCVR_FOLDED_AGC_IDX8_THR,
+        /* 125: XCVR_RX_DIG->AGC_IDX9_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX9_GAIN_CFG,
+        /* 126: XCVR_RX_DIG->AGC_IDX9_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX9_GAIN_VAL,
+        /* 127: XCVR_RX_DIG->AGC_IDX9_THR */
+        XCVR_FOLDED_AGC_IDX9_THR,
+        /* 128: XCVR_RX_DIG->AGC_MIS_GAIN_CFG */
+        XCVR_FOLDED_AGC_MIS_GAIN_CFG,
+        /* 129: XCVR_RX_DIG->AGC_THR_FAST */
+        XCVR_FOLDED_AGC_THR_FAST,
+        /* 130: XCVR_RX_DIG->AGC_THR_FAST_DRS */
+        XCVR_FOLDED_AGC_THR_FAST_DRS,
+        /* 131: XCVR_RX_DIG->AGC_THR_MIS */
+        XCVR_FOLDED_AGC_THR_MIS,
+        /* 132: XCVR_RX_DIG->AGC_TIMING0 */
+        XCVR_FOLDED_AGC_TIMING0 | XCVR_RX_DIG_AGC_TIMING0_AGC_GAIN_STEP_WAIT(0x10),
+        /* 133: XCVR_RX_DIG->AGC_TIMING0_DRS */
+        XCVR_FOLDED_AGC_TIMING0_DRS | XCVR_RX_DIG_AGC_TIMING0_DRS_AGC_GAIN_STEP_WAIT(0x10),
+        /* 134: XCVR_RX_DIG->AGC_TIMING1 */
+        XCVR_FOLDED_AGC_TIMING1 | XCVR_RX_DIG_AGC_TIMING1_AGC_FREEZE_TIMEOUT(0x0A) |
+            XCVR_RX_DIG_AGC_TIMING1_AGC_HOLD_TIMEOUT(0x08),
+        /* 135: XCVR_RX_DIG->AGC_TIMING1_DRS */
+        XCVR_RX_DIG_AGC_TIMING1_DRS_AGC_FREEZE_TIMEOUT(0x0A) | XCVR_RX_DIG_AGC_TIMING1_DRS_AGC_HOLD_TIMEOUT(0x08),
+        /* 136: XCVR_RX_DIG->AGC_TIMING2 */
+        XCVR_FOLDED_AGC_TIMING2 | XCVR_RX_DIG_AGC_TIMING2_AGC_UNFREEZE_FEAT_TIMEOUT(0x000) |
+            XCVR_RX_DIG_AGC_TIMING2_AGC_UNHOLD_FEAT_TIMEOUT(0x000),
+        /* 137: XCVR_RX_DIG->AGC_TIMING2_DRS */
+        XCVR_RX_DIG_AGC_TIMING2_DRS_AGC_UNFREEZE_FEAT_TIMEOUT(0x000) |
+            XCVR_RX_DIG_AGC_TIMING2_DRS_AGC_UNHOLD_FEAT_TIMEOUT(0x000),
+        /* 138: XCVR_RX_DIG->CTRL0 */
+#if RF_OSC_26MHZ == 1
+        XCVR_FOLDED_CTRL0 | XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(2) |
+            XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x027) |
+            XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(1) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#else
+        XCVR_FOLDED_CTRL0 | XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(3) |
+            XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x020) |
+            XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(1) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 139: XCVR_RX_DIG->CTRL0_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(3) |
+            XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x027),
+#else
+        XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(4) |
+            XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x020),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 140: XCVR_RX_DIG->CTRL1 */
+        XCVR_FOLDED_CTRL1,
+        /* 141: XCVR_RX_DIG->DCOC_CTRL0 */
+        XCVR_FOLDED_DCOC_CTRL0 | XCVR_RX_DIG_DCOC_CTRL0_DCOC_DAC_ORDER(1) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFII(0x6) |
+            XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFIIP(1) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFQQ(0x5) |
+            XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFQQP(1),
+        /* 142: XCVR_RX_DIG->DCOC_CTRL0_DRS */
+        XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFII(6) | XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFIIP(1) |
+            XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFQQ(5) | XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFQQP(1),
+        /* 143: XCVR_RX_DIG->DCOC_CTRL1 */
+        XCVR_FOLDED_DCOC_CTRL1,
+        /* 144: XCVR_RX_DIG->DEMOD_FILT_0_1 */
+        XCVR_RX_DIG_DEMOD_FILT_0_1_H0(0x1FD) | XCVR_RX_DIG_DEMOD_FILT_0_1_H1(0x1FB),
+        /* 145: XCVR_RX_DIG->DEMOD_FILT_0_1_DRS */
+        XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H0(0x1FD) | XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H1(0x1FC),
+        /* 146: XCVR_RX_DIG->DEMOD_FILT_2_4 */
+        XCVR_RX_DIG_DEMOD_FILT_2_4_H2(0x01E) | XCVR_RX_DIG_DEMOD_FILT_2_4_H3(0x085) |
+            XCVR_RX_DIG_DEMOD_FILT_2_4_H4(0x0C6),
+        /* 147: XCVR_RX_DIG->DEMOD_FILT_2_4_DRS */
+        XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H2(0x020) | XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H3(0x084) |
+            XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H4(0x0C2),
+        /* 148: XCVR_RX_DIG->NB_RSSI_CTRL0 */
+        XCVR_FOLDED_NB_RSSI_CTRL0,
+        /* 149: XCVR_RX_DIG->NB_RSSI_CTRL1 */
+        XCVR_FOLDED_NB_RSSI_CTRL1,
+        /* 150: XCVR_RX_DIG->RCCAL_CTRL0 */
+        XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE(2) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE_DRS(3) |
+            XCVR_RX_DIG_RCCAL_CTRL0_CBPF_CCODE_OFFSET(0x00) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE(1) |
+            XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE_DRS(1) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CMPOUT_INV(0) |
+            XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CODE_OFFSET(0x0) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_SMPL_DLY(0),
+        /* 151: XCVR_RX_DIG->RSSI_GLOBAL_CTRL */
+        XCVR_FOLDED_RSSI_GLOBAL_CTRL | XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_CCA1_ED_EN(0),
+        /* 152: XCVR_RX_DIG->WB_RSSI_CTRL */
+        XCVR_FOLDED_WB_RSSI_CTRL,
+        /* 153: XCVR_TSM->CTRL */
+        XCVR_FOLDED_CTRL,
+        /* 154: XCVR_TSM->END_OF_SEQ */
+        XCVR_FOLDED_END_OF_SEQ,
+        /* 155: XCVR_TSM->FAST_CTRL1 */
+        XCVR_FOLDED_FAST_CTRL1,
+        /* 156: XCVR_TSM->FAST_CTRL2 */
+        XCVR_FOLDED_FAST_CTRL2,
+        /* 157: XCVR_TSM->FAST_CTRL3 */
+        XCVR_FOLDED_FAST_CTRL3,
+        /* 158: XCVR_TSM->RECYCLE_COUNT */
+        XCVR_FOLDED_RECYCLE_COUNT,
+        /* 159: XCVR_TSM->TIMING00 */
+        XCVR_FOLDED_TIMING00,
+        /* 160: XCVR_TSM->TIMING01 */
+        XCVR_FOLDED_TIMING01,
+        /* 161: XCVR_TSM->TIMING02 */
+        XCVR_FOLDED_TIMING02,
+        /* 162: XCVR_TSM->TIMING03 */
+        XCVR_FOLDED_TIMING03,
+        /* 163: XCVR_TSM->TIMING04 */
+        XCVR_FOLDED_TIMING04,
+        /* 164: XCVR_TSM->TIMING05 */
+        XCVR_FOLDED_TIMING05,
+        /* 165: XCVR_TSM->TIMING06 */
+        XCVR_FOLDED_TIMING06,
+        /* 166: XCVR_TSM->TIMING07 */
+        XCVR_FOLDED_TIMING07,
+        /* 167: XCVR_TSM->TIMING08 */
+        XCVR_FOLDED_TIMING08,
+        /* 168: XCVR_TSM->TIMING09 */
+        XCVR_FOLDED_TIMING09,
+        /* 169: XCVR_TSM->TIMING10 */
+        XCVR_FOLDED_TIMING10,
+        /* 170: XCVR_TSM->TIMING11 */
+        XCVR_FOLDED_TIMING11,
+        /* 171: XCVR_TSM->TIMING12 */
+        XCVR_FOLDED_TIMING12,
+        /* 172: XCVR_TSM->TIMING13 */
+        XCVR_FOLDED_TIMING13,
+        /* 173: XCVR_TSM->TIMING14 */
+        XCVR_FOLDED_TIMING14,
+        /* 174: XCVR_TSM->TIMING15 */
+        XCVR_FOLDED_TIMING15,
+        /* 175: XCVR_TSM->TIMING16 */
+        XCVR_FOLDED_TIMING16,
+        /* 176: XCVR_TSM->TIMING17 */
+        XCVR_FOLDED_TIMING17,
+        /* 177: XCVR_TSM->TIMING18 */
+        XCVR_FOLDED_TIMING18,
+        /* 178: XCVR_TSM->TIMING19 */
+        XCVR_FOLDED_TIMING19,
+        /* 179: XCVR_TSM->TIMING20 */
+        XCVR_FOLDED_TIMING20,
+        /* 180: XCVR_TSM->TIMING21 */
+        XCVR_FOLDED_TIMING21,
+        /* 181: XCVR_TSM->TIMING22 */
+        XCVR_FOLDED_TIMING22,
+        /* 182: XCVR_TSM->TIMING23 */
+        XCVR_FOLDED_TIMING23,
+        /* 183: XCVR_TSM->TIMING24 */
+        XCVR_FOLDED_TIMING24,
+        /* 184: XCVR_TSM->TIMING25 */
+        XCVR_FOLDED_TIMING25,
+        /* 185: XCVR_TSM->TIMING26 */
+        XCVR_FOLDED_TIMING26,
+        /* 186: XCVR_TSM->TIMING27 */
+        XCVR_FOLDED_TIMING27,
+        /* 187: XCVR_TSM->TIMING28 */
+        XCVR_FOLDED_TIMING28,
+        /* 188: XCVR_TSM->TIMING29 */
+        XCVR_FOLDED_TIMING29,
+        /* 189: XCVR_TSM->TIMING30 */
+        XCVR_FOLDED_TIMING30,
+        /* 190: XCVR_TSM->TIMING31 */
+        XCVR_FOLDED_TIMING31,
+        /* 191: XCVR_TSM->TIMING32 */
+        XCVR_FOLDED_TIMING32,
+        /* 192: XCVR_TSM->TIMING33 */
+        XCVR_FOLDED_TIMING33,
+        /* 193: XCVR_TSM->TIMING34 */
+        XCVR_FOLDED_TIMING34,
+        /* 194: XCVR_TSM->TIMING35 */
+        XCVR_FOLDED_TIMING35,
+        /* 195: XCVR_TSM->TIMING36 */
+        XCVR_FOLDED_TIMING36,
+        /* 196: XCVR_TSM->TIMING37 */
+        XCVR_FOLDED_TIMING37,
+        /* 197: XCVR_TSM->TIMING38 */
+        XCVR_FOLDED_TIMING38,
+        /* 198: XCVR_TSM->TIMING39 */
+        XCVR_FOLDED_TIMING39,
+        /* 199: XCVR_TSM->TIMING40 */
+        XCVR_FOLDED_TIMING40,
+        /* 200: XCVR_TSM->TIMING41 */
+        XCVR_FOLDED_TIMING41,
+        /* 201: XCVR_TSM->TIMING42 */
+        XCVR_FOLDED_TIMING42,
+        /* 202: XCVR_TSM->TIMING43 */
+        XCVR_FOLDED_TIMING43,
+        /* 203: XCVR_TSM->TIMING44 */
+        XCVR_FOLDED_TIMING44,
+        /* 204: XCVR_TSM->TIMING45 */
+        XCVR_FOLDED_TIMING45,
+        /* 205: XCVR_TSM->TIMING46 */
+        XCVR_FOLDED_TIMING46,
+        /* 206: XCVR_TSM->TIMING47 */
+        XCVR_FOLDED_TIMING47,
+        /* 207: XCVR_TSM->TIMING48 */
+        XCVR_FOLDED_TIMING48,
+        /* 208: XCVR_TSM->TIMING49 */
+        XCVR_FOLDED_TIMING49,
+        /* 209: XCVR_TSM->TIMING50 */
+        XCVR_FOLDED_TIMING50,
+        /* 210: XCVR_TSM->TIMING51 */
+        XCVR_FOLDED_TIMING51,
+        /* 211: XCVR_TSM->TIMING52 */
+        XCVR_FOLDED_TIMING52,
+        /* 212: XCVR_TSM->WU_LATENCY */
+        XCVR_FOLDED_WU_LATENCY,
+        /* 213: XCVR_TX_DIG->DATARATE_CONFIG_FILTER_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(2) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(2) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(1),
+#else
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(3) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(2) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(1),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 214: XCVR_TX_DIG->DATARATE_CONFIG_FSK_CTRL */
+        XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV0(0x0000) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV1(0x0000),
+        /* 215: XCVR_TX_DIG->DATARATE_CONFIG_GFSK_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x37E),
+#else
+        XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x2D8),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 216: XCVR_TX_DIG->DATA_PADDING_CTRL */
+        XCVR_FOLDED_DATA_PADDING_CTRL | XCVR_TX_DIG_DATA_PADDING_CTRL_DATA_PADDING_SEL(0) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_PAD_DLY(0) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_PAD_DLY_EN(1),
+        /* 217: XCVR_TX_DIG->DATA_PADDING_CTRL_1 */
+        XCVR_FOLDED_DATA_PADDING_CTRL_1 | XCVR_TX_DIG_DATA_PADDING_CTRL_1_RAMP_UP_DLY(0x04) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_1_TX_DATA_FLUSH_DLY(0x04),
+        /* 218: XCVR_TX_DIG->DATA_PADDING_CTRL_2 */
+        XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_MFDEV(0x1800) | XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_PFDEV(0x0800),
+        /* 219: XCVR_TX_DIG->FSK_CTRL */
+        XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_0(0x1800) | XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_1(0x0800),
+        /* 220: XCVR_TX_DIG->GFSK_COEFF_0_1 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_0(0x017) | XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_1(0x029),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_0(0x001) | XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_1(0x004),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 221: XCVR_TX_DIG->GFSK_COEFF_2_3 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_2(0x044) | XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_3(0x067),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_2(0x00D) | XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_3(0x028),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 222: XCVR_TX_DIG->GFSK_COEFF_4_5 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_4(0x090) | XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_5(0x0BA),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_4(0x063) | XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_5(0x0C0),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 223: XCVR_TX_DIG->GFSK_COEFF_6_7 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_6(0x0DC) | XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_7(0x0EF),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_6(0x12C) | XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_7(0x176),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 224: XCVR_TX_DIG->GFSK_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(0) |
+            XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x06EF),
+#else
+        XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(0) |
+            XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x05A2),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 225: XCVR_TX_DIG->IMAGE_FILTER_CTRL */
+        XCVR_FOLDED_IMAGE_FILTER_CTRL | XCVR_TX_DIG_IMAGE_FILTER_CTRL_IMAGE_FILTER_OVRD_EN(0),
+        /* 226: XCVR_TX_DIG->PA_CTRL */
+        XCVR_FOLDED_PA_CTRL | XCVR_TX_DIG_PA_CTRL_PA_RAMP_SEL(1),
+        /* 227: XCVR_TX_DIG->PA_RAMP_TBL0 */
+        XCVR_FOLDED_PA_RAMP_TBL0,
+        /* 228: XCVR_TX_DIG->PA_RAMP_TBL1 */
+        XCVR_FOLDED_PA_RAMP_TBL1,
+        /* 229: XCVR_TX_DIG->PA_RAMP_TBL2 */
+        XCVR_FOLDED_PA_RAMP_TBL2,
+        /* 230: XCVR_TX_DIG->PA_RAMP_TBL3 */
+        XCVR_FOLDED_PA_RAMP_TBL3,
+        /* 231: XCVR_TX_DIG->SWITCH_TX_CTRL */
+        XCVR_FOLDED_SWITCH_TX_CTRL,
+        /* 232: XCVR_TX_DIG->TXDIG_CTRL */
+        XCVR_FOLDED_TXDIG_CTRL | XCVR_TX_DIG_TXDIG_CTRL_DATA_STREAM_SEL(0) | XCVR_TX_DIG_TXDIG_CTRL_MODULATOR_SEL(0) |
+            XCVR_TX_DIG_TXDIG_CTRL_PFC_EN(0),
+    },
+};
+
+const xcvr_folded_config_t xcvr_gfsk_bt_0p5_h_0p7_250kbps_folded_config = {
+    .config     = &xcvr_gfsk_bt_0p5_h_0p7_250kbps_full_config,
+    .reg_values = {
+        /* 0: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x1C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x16) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x11) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x0B) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x06),
+        /* 1: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3A) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x35) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x2F) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x2A),
+        /* 2: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x24) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x1E) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x19),
+        /* 3: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x1C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x16) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x11) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x0B) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x06),
+        /* 4: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3A) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x35) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x2F) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x35),
+        /* 5: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x3A) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x06),
+        /* 6: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x11) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x0B) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x06) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3A),
+        /* 7: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x06) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x0B) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x11) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x0B),
+        /* 8: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x06) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x3A),
+        /* 9: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x11) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x0B) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x06) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3A),
+        /* 10: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x06) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x0B) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x11) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x16),
+        /* 11: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x1C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x22) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x27),
+        /* 12: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x2F) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x35) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x3A) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x06),
+        /* 13: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3A) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x35) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x2F) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x2A),
+        /* 14: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x24) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x1E) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x19),
+        /* 15: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x2F) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x35) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x3A) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x06),
+        /* 16: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3A) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x35) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x2F) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x35),
+        /* 17: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x3A) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x06),
+        /* 18: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x24) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x2A) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x2F) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x35) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3A),
+        /* 19: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x06) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x0B) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x11) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x0B),
+        /* 20: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x06) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x3A),
+        /* 21: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x24) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x2A) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x2F) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x35) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3A),
+        /* 22: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x06) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x0B) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x11) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x16),
+        /* 23: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x1C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x22) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x27),
+        /* 24: GEN4PHY->DMD_CTRL0 */
+        XCVR_FOLDED_DMD_CTRL0,
+        /* 25: GEN4PHY->DMD_CTRL1 */
+        XCVR_FOLDED_DMD_CTRL1,
+        /* 26: GEN4PHY->FSK_CFG0 */
+        XCVR_FOLDED_FSK_CFG0 | GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_1M(0x10) |
+            GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_2M(0x11) |
+            GEN4PHY_FSK_CFG0_MSK2FSK_SEED(0) | GEN4PHY_FSK_CFG0_MSK_EN(0),
+        /* 27: GEN4PHY->FSK_CFG1 */
+        GEN4PHY_FSK_CFG1_OVERH(0x02D) | GEN4PHY_FSK_CFG1_OVERH_INV(0x0B7) | GEN4PHY_FSK_CFG1_SYNCTSCALE(0xF),
+        /* 28: GEN4PHY->FSK_CFG2 */
+        XCVR_FOLDED_FSK_CFG2,
+        /* 29: GEN4PHY->FSK_FAD_CFG */
+        XCVR_FOLDED_FSK_FAD_CFG,
+        /* 30: GEN4PHY->FSK_FAD_CTRL */
+        XCVR_FOLDED_FSK_FAD_CTRL,
+        /* 31: GEN4PHY->FSK_PD_CFG0 */
+        GEN4PHY_FSK_PD_CFG0_PD_IIR_ALPHA(0xFF) | GEN4PHY_FSK_PD_CFG0_PREAMBLE_T_SCALE(0xC),
+        /* 32: GEN4PHY->FSK_PD_CFG1 */
+        GEN4PHY_FSK_PD_CFG1_PREAMBLE_PATTERN(0x55),
+        /* 33: GEN4PHY->FSK_PD_CFG2 */
+        GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_1M(0xD7) | GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_2M(0xEB),
+        /* 34: GEN4PHY->FSK_PD_PH[0] */
+        GEN4PHY_FSK_PD_PH_REF0(0x05) | GEN4PHY_FSK_PD_PH_REF1(0x07) | GEN4PHY_FSK_PD_PH_REF2(0x05) |
+            GEN4PHY_FSK_PD_PH_REF3(0x00),
+        /* 35: GEN4PHY->FSK_PD_PH[1] */
+        GEN4PHY_FSK_PD_PH_REF0(0x3B) | GEN4PHY_FSK_PD_PH_REF1(0x39) | GEN4PHY_FSK_PD_PH_REF2(0x3B) |
+            GEN4PHY_FSK_PD_PH_REF3(0x00),
+        /* 36: GEN4PHY->FSK_PT */
+        XCVR_FOLDED_FSK_PT | GEN4PHY_FSK_PT_AGC_TIMEOUT(0x0048),
+        /* 37: GEN4PHY->LR_AA_CFG */
+        GEN4PHY_LR_AA_CFG_AA_COR_THRESH(0x00) | GEN4PHY_LR_AA_CFG_AA_HAM_THRESH(0x00) |
+            GEN4PHY_LR_AA_CFG_AA_LR_CORR_GAIN(0x00) | GEN4PHY_LR_AA_CFG_ACCESS_ADDR_HAM(0x00),
+        /* 38: GEN4PHY->LR_PD_CFG */
+        GEN4PHY_LR_PD_CFG_CORR_TH(0x00) | GEN4PHY_LR_PD_CFG_FREQ_TH(0x00) | GEN4PHY_LR_PD_CFG_NO_PEAKS(0),
+        /* 39: GEN4PHY->LR_PD_PH[0] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 40: GEN4PHY->LR_PD_PH[1] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 41: GEN4PHY->LR_PD_PH[2] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 42: GEN4PHY->LR_PD_PH[3] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 43: GEN4PHY->MISC */
+        XCVR_FOLDED_MISC,
+        /* 44: GEN4PHY->PREPHY_MISC */
+        XCVR_FOLDED_PREPHY_MISC,
+        /* 45: GEN4PHY->RTT_CTRL */
+        XCVR_FOLDED_RTT_CTRL,
+        /* 46: GEN4PHY->RTT_REF */
+        GEN4PHY_RTT_REF_FM_REF_010(0x48) | GEN4PHY_RTT_REF_FM_REF_110(0x63) | GEN4PHY_RTT_REF_FM_REF_111(0x80),
+        /* 47: GEN4PHY->SM_CFG */
+        XCVR_FOLDED_SM_CFG | GEN4PHY_SM_CFG_AA_TIMEOUT_UNCODED(0x0A0),
+        /* 48: RADIO_CTRL->LL_CTRL */
+        RADIO_CTRL_LL_CTRL_ACTIVE_LL(2),
+        /* 49: XCVR_ANALOG->LDO_0 */
+        XCVR_FOLDED_LDO_0,
+        /* 50: XCVR_ANALOG->LDO_1 */
+        XCVR_FOLDED_LDO_1,
+        /* 51: XCVR_ANALOG->PLL */
+        XCVR_FOLDED_PLL,
+        /* 52: XCVR_ANALOG->RX_0 */
+        XCVR_FOLDED_RX_0,
+        /* 53: XCVR_ANALOG->RX_1 */
+        XCVR_FOLDED_RX_1,
+        /* 54: XCVR_ANALOG->TX_DAC_PA */
+        XCVR_FOLDED_TX_DAC_PA | XCVR_ANALOG_TX_DAC_PA_DAC_TRIM_CFBK_DRS(1),
+        /* 55: XCVR_ANALOG->XO_DIST */
+        XCVR_FOLDED_XO_DIST,
+        /* 56: XCVR_MISC->IPS_FO_ADDR[0] */
+        XCVR_MISC_IPS_FO_ADDR_ADDR(0x370) | XCVR_MISC_IPS_FO_ADDR_ENTRY_RX(0) | XCVR_MISC_IPS_FO_ADDR_ENTRY_TX(0),
+        /* 57: XCVR_MISC->IPS_FO_ADDR[1] */
+        XCVR_MISC_IPS_FO_ADDR_ADDR(0x02C) | XCVR_MISC_IPS_FO_ADDR_ENTRY_RX(0) | XCVR_MISC_IPS_FO_ADDR_ENTRY_TX(0),
+        /* 58: XCVR_MISC->IPS_FO_DRS0_DATA[0] */
+        XCVR_MISC_IPS_FO_DRS0_DATA_DRS0_DATA(0x00000000),
+        /* 59: XCVR_MISC->IPS_FO_DRS0_DATA[1] */
+        XCVR_MISC_IPS_FO_DRS0_DATA_DRS0_DATA(0x00000000),
+        /* 60: XCVR_MISC->IPS_FO_DRS1_DATA[0] */
+        XCVR_MISC_IPS_FO_DRS1_DATA_DRS1_DATA(0x00000000),
+        /* 61: XCVR_MISC->IPS_FO_DRS1_DATA[1] */
+        XCVR_MISC_IPS_FO_DRS1_DATA_DRS1_DATA(0x00000000),
+        /* 62: XCVR_MISC->LDO_TRIM_0 */
+        XCVR_FOLDED_LDO_TRIM_0,
+        /* 63: XCVR_MISC->LDO_TRIM_1 */
+        XCVR_FOLDED_LDO_TRIM_1,
+        /* 64: XCVR_MISC->XCVR_CTRL */
+        XCVR_FOLDED_XCVR_CTRL | XCVR_MISC_XCVR_CTRL_DATA_RATE_DRS(3) | XCVR_MISC_XCVR_CTRL_DEMOD_SEL(1) |
+            XCVR_MISC_XCVR_CTRL_LL_CFG_CAPT_DIS(0),
+        /* 65: XCVR_PLL_DIG->CHAN_MAP */
+        XCVR_FOLDED_CHAN_MAP | XCVR_PLL_DIG_CHAN_MAP_BAND_SELECT(0),
+        /* 66: XCVR_PLL_DIG->CHAN_MAP_EXT */
+#if RF_OSC_26MHZ == 1
+        XCVR_FOLDED_CHAN_MAP_EXT | XCVR_PLL_DIG_CHAN_MAP_EXT_NUM_OFFSET(0x013B13B),
+#else
+        XCVR_FOLDED_CHAN_MAP_EXT | XCVR_PLL_DIG_CHAN_MAP_EXT_NUM_OFFSET(0x0100000),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 67: XCVR_PLL_DIG->DATA_RATE_OVRD_CTRL1 */
+        XCVR_FOLDED_DATA_RATE_OVRD_CTRL1,
+        /* 68: XCVR_PLL_DIG->DATA_RATE_OVRD_CTRL2 */
+#if RF_OSC_26MHZ == 1
+        XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL2_NUM_OFFSET_CFG1(0x013B13B),
+#else
+        XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL2_NUM_OFFSET_CFG1(0x0100000),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 69: XCVR_PLL_DIG->DELAY_MATCH */
+        XCVR_FOLDED_DELAY_MATCH | XCVR_PLL_DIG_DELAY_MATCH_HPM_INTEGER_DELAY(0x04) |
+            XCVR_PLL_DIG_DELAY_MATCH_LPM_SDM_DELAY(0x03),
+        /* 70: XCVR_PLL_DIG->HPMCAL_CTRL */
+        XCVR_FOLDED_HPMCAL_CTRL | XCVR_PLL_DIG_HPMCAL_CTRL_HPM_CAL_ARRAY_SIZE(0),
+        /* 71: XCVR_PLL_DIG->HPM_BUMP */
+        XCVR_FOLDED_HPM_BUMP | XCVR_PLL_DIG_HPM_BUMP_HPM_VCM_CAL(2) | XCVR_PLL_DIG_HPM_BUMP_HPM_VCM_TX(2),
+        /* 72: XCVR_PLL_DIG->HPM_CAL_TIMING */
+        XCVR_FOLDED_HPM_CAL_TIMING,
+        /* 73: XCVR_PLL_DIG->HPM_CTRL */
+        XCVR_FOLDED_HPM_CTRL,
+        /* 74: XCVR_PLL_DIG->HPM_SDM_RES */
+        XCVR_FOLDED_HPM_SDM_RES | XCVR_PLL_DIG_HPM_SDM_RES_HPM_COUNT_ADJUST(0x02),
+        /* 75: XCVR_PLL_DIG->LOCK_DETECT */
+        XCVR_FOLDED_LOCK_DETECT,
+        /* 76: XCVR_PLL_DIG->LPM_CTRL */
+        XCVR_FOLDED_LPM_CTRL,
+        /* 77: XCVR_PLL_DIG->LPM_SDM_CTRL1 */
+        XCVR_FOLDED_LPM_SDM_CTRL1,
+        /* 78: XCVR_PLL_DIG->MOD_CTRL */
+        XCVR_FOLDED_MOD_CTRL,
+        /* 79: XCVR_PLL_DIG->PLL_DATARATE_CTRL */
+        XCVR_FOLDED_PLL_DATARATE_CTRL,
+        /* 80: XCVR_PLL_DIG->TUNING_CAP_RX_CTRL */
+        XCVR_FOLDED_TUNING_CAP_RX_CTRL,
+        /* 81: XCVR_PLL_DIG->TUNING_CAP_TX_CTRL */
+        XCVR_FOLDED_TUNING_CAP_TX_CTRL,
+        /* 82: XCVR_RX_DIG->ACQ_FILT_0_3 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x3E) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x00) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x06) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x0C),
+#else
+        XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x00) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x05) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x03) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x76),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 83: XCVR_RX_DIG->ACQ_FILT_0_3_DRS */
+        XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H0(0x00) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H1(0x00) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H2(0x00) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H3(0x00),
+        /* 84: XCVR_RX_DIG->ACQ_FILT_10_11 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x06B) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x099),
+#else
+        XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x05A) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x0EF),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 85: XCVR_RX_DIG->ACQ_FILT_10_11_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x06B) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x0B3),
+#else
+        XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x024) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x119),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 86: XCVR_RX_DIG->ACQ_FILT_4_7 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x0A) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x7C) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_H6(0xE7) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0xDE),
+#else
+        XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x72) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x0B) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_H6(0x23) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0x04),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 87: XCVR_RX_DIG->ACQ_FILT_4_7_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x03) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x05) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0xFB) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0xE6),
+#else
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x01) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x79) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0xFE) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0x1C),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 88: XCVR_RX_DIG->ACQ_FILT_8_9 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x1F4) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x029),
+#else
+        XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x1C4) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x1D0),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 89: XCVR_RX_DIG->ACQ_FILT_8_9_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x1E5) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x013),
+#else
+        XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x1FC) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x1B3),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 90: XCVR_RX_DIG->AGC_CTRL */
+        XCVR_FOLDED_AGC_CTRL,
+        /* 91: XCVR_RX_DIG->AGC_CTRL_STAT */
+        XCVR_FOLDED_AGC_CTRL_STAT,
+        /* 92: XCVR_RX_DIG->AGC_IDX0_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX0_GAIN_CFG,
+        /* 93: XCVR_RX_DIG->AGC_IDX0_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX0_GAIN_VAL,
+        /* 94: XCVR_RX_DIG->AGC_IDX0_THR */
+        XCVR_FOLDED_AGC_IDX0_THR,
+        /* 95: XCVR_RX_DIG->AGC_IDX10_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX10_GAIN_CFG,
+        /* 96: XCVR_RX_DIG->AGC_IDX10_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX10_GAIN_VAL,
+        /* 97: XCVR_RX_DIG->AGC_IDX10_THR */
+        XCVR_FOLDED_AGC_IDX10_THR,
+        /* 98: XCVR_RX_DIG->AGC_IDX11_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX11_GAIN_CFG | XCVR_RX_DIG_AGC_IDX11_GAIN_CFG_MAG_THR_11_DRS_OFS(0x00) |
+            XCVR_RX_DIG_AGC_IDX11_GAIN_CFG_MAG_THR_HI_11_DRS_OFS(0x00),
+        /* 99: XCVR_RX_DIG->AGC_IDX11_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX11_GAIN_VAL | XCVR_RX_DIG_AGC_IDX11_GAIN_VAL_MAG_THR_11(0x000) |
+            XCVR_RX_DIG_AGC_IDX11_GAIN_VAL_MAG_THR_HI_11(0x000),
+        /* 100: XCVR_RX_DIG->AGC_IDX11_THR */
+        XCVR_FOLDED_AGC_IDX11_THR,
+        /* 101: XCVR_RX_DIG->AGC_IDX1_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX1_GAIN_CFG,
+        /* 102: XCVR_RX_DIG->AGC_IDX1_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX1_GAIN_VAL,
+        /* 103: XCVR_RX_DIG->AGC_IDX1_THR */
+        XCVR_FOLDED_AGC_IDX1_THR,
+        /* 104: XCVR_RX_DIG->AGC_IDX2_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX2_GAIN_CFG,
+        /* 105: XCVR_RX_DIG->AGC_IDX2_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX2_GAIN_VAL,
+        /* 106: XCVR_RX_DIG->AGC_IDX2_THR */
+        XCVR_FOLDED_AGC_IDX2_THR,
+        /* 107: XCVR_RX_DIG->AGC_IDX3_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX3_GAIN_CFG,
+        /* 108: XCVR_RX_DIG->AGC_IDX3_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX3_GAIN_VAL,
+        /* 109: XCVR_RX_DIG->AGC_IDX3_THR */
+        XCVR_FOLDED_AGC_IDX3_THR,
+        /* 110: XCVR_RX_DIG->AGC_IDX4_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX4_GAIN_CFG,
+        /* 111: XCVR_RX_DIG->AGC_IDX4_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX4_GAIN_VAL,
+        /* 112: XCVR_RX_DIG->AGC_IDX4_THR */
+        XCVR_FOLDED_AGC_IDX4_THR,
+        /* 113: XCVR_RX_DIG->AGC_IDX5_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX5_GAIN_CFG,
+        /* 114: XCVR_RX_DIG->AGC_IDX5_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX5_GAIN_VAL,
+        /* 115: XCVR_RX_DIG->AGC_IDX5_THR */
+        XCVR_FOLDED_AGC_IDX5_THR,
+        /* 116: XCVR_RX_DIG->AGC_IDX6_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX6_GAIN_CFG,
+        /* 117: XCVR_RX_DIG->AGC_IDX6_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX6_GAIN_VAL,
+        /* 118: XCVR_RX_DIG->AGC_IDX6_THR */
+        XCVR_FOLDED_AGC_IDX6_THR,
+        /* 119: XCVR_RX_DIG->AGC_IDX7_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX7_GAIN_CFG,
+        /* 120: XCVR_RX_DIG->AGC_IDX7_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX7_GAIN_VAL,
+        /* 121: XCVR_RX_DIG->AGC_IDX7_THR */
+        XCVR_FOLDED_AGC_IDX7_THR,
+        /* 122: XCVR_RX_DIG->AGC_IDX8_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX8_GAIN_CFG,
+        /* 123: XCVR_RX_DIG->AGC_IDX8_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX8_GAIN_VAL,
+        /* 124: XCVR_RX_DIG->AGC_IDX8_THR */
+        XCVR_FOLDED_AGC_IDX8_THR,
+        /* 125: XCVR_RX_DIG->AGC_IDX9_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX9_GAIN_CFG,
+        /* 126: XCVR_RX_DIG->AGC_IDX9_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX9_GAIN_VAL,
+        /* 127: XCVR_RX_DIG->AGC_IDX9_THR */
+        XCVR_FOLDED_AGC_IDX9_THR,
+        /* 128: XCVR_RX_DIG->AGC_MIS_GAIN_CFG */
+        XCVR_FOLDED_AGC_MIS_GAIN_CFG,
+        /* 129: XCVR_RX_DIG->AGC_THR_FAST */
+        XCVR_FOLDED_AGC_THR_FAST,
+        /* 130: XCVR_RX_DIG->AGC_THR_FAST_DRS */
+        XCVR_FOLDED_AGC_THR_FAST_DRS,
+        /* 131: XCVR_RX_DIG->AGC_THR_MIS */
+        XCVR_FOLDED_AGC_THR_MIS,
+        /* 132: XCVR_RX_DIG->AGC_TIMING0 */
+        XCVR_FOLDED_AGC_TIMING0 | XCVR_RX_DIG_AGC_TIMING0_AGC_GAIN_STEP_WAIT(0x10),
+        /* 133: XCVR_RX_DIG->AGC_TIMING0_DRS */
+        XCVR_FOLDED_AGC_TIMING0_DRS | XCVR_RX_DIG_AGC_TIMING0_DRS_AGC_GAIN_STEP_WAIT(0x10),
+        /* 134: XCVR_RX_DIG->AGC_TIMING1 */
+        XCVR_FOLDED_AGC_TIMING1 | XCVR_RX_DIG_AGC_TIMING1_AGC_FREEZE_TIMEOUT(0x0A) |
+            XCVR_RX_DIG_AGC_TIMING1_AGC_HOLD_TIMEOUT(0x08),
+        /* 135: XCVR_RX_DIG->AGC_TIMING1_DRS */
+        XCVR_RX_DIG_AGC_TIMING1_DRS_AGC_FREEZE_TIMEOUT(0x0A) | XCVR_RX_DIG_AGC_TIMING1_DRS_AGC_HOLD_TIMEOUT(0x08),
+        /* 136: XCVR_RX_DIG->AGC_TIMING2 */
+        XCVR_FOLDED_AGC_TIMING2 | XCVR_RX_DIG_AGC_TIMING2_AGC_UNFREEZE_FEAT_TIMEOUT(0x000) |
+            XCVR_RX_DIG_AGC_TIMING2_AGC_UNHOLD_FEAT_TIMEOUT(0x000),
+        /* 137: XCVR_RX_DIG->AGC_TIMING2_DRS */
+        XCVR_RX_DIG_AGC_TIMING2_DRS_AGC_UNFREEZE_FEAT_TIMEOUT(0x000) |
+            XCVR_RX_DIG_AGC_TIMING2_DRS_AGC_UNHOLD_FEAT_TIMEOUT(0x000),
+        /* 138: XCVR_RX_DIG->CTRL0 */
+#if RF_OSC_26MHZ == 1
+        XCVR_FOLDED_CTRL0 | XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(2) |
+            XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x027) |
+            XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(1) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#else
+        XCVR_FOLDED_CTRL0 | XCVR_RX_DIG_CTRL0_CIC_ORDER(1) | XCVR_RX_DIG_CTRL0_CIC_RATE(3) |
+            XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x020) |
+            XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(1) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 139: XCVR_RX_DIG->CTRL0_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(4) |
+            XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x027),
+#else
+        XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(1) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(5) |
+            XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x020),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 140: XCVR_RX_DIG->CTRL1 */
+        XCVR_FOLDED_CTRL1,
+        /* 141: XCVR_RX_DIG->DCOC_CTRL0 */
+        XCVR_FOLDED_DCOC_CTRL0 | XCVR_RX_DIG_DCOC_CTRL0_DCOC_DAC_ORDER(1) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFII(0x6) |
+            XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFIIP(1) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFQQ(0x5) |
+            XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFQQP(1),
+        /* 142: XCVR_RX_DIG->DCOC_CTRL0_DRS */
+        XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFII(6) | XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFIIP(1) |
+            XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFQQ(5) | XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFQQP(1),
+        /* 143: XCVR_RX_DIG->DCOC_CTRL1 */
+        XCVR_FOLDED_DCOC_CTRL1,
+        /* 144: XCVR_RX_DIG->DEMOD_FILT_0_1 */
+        XCVR_RX_DIG_DEMOD_FILT_0_1_H0(0x1FD) | XCVR_RX_DIG_DEMOD_FILT_0_1_H1(0x1FB),
+        /* 145: XCVR_RX_DIG->DEMOD_FILT_0_1_DRS */
+        XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H0(0x1FD) | XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H1(0x1FC),
+        /* 146: XCVR_RX_DIG->DEMOD_FILT_2_4 */
+        XCVR_RX_DIG_DEMOD_FILT_2_4_H2(0x01E) | XCVR_RX_DIG_DEMOD_FILT_2_4_H3(0x085) |
+            XCVR_RX_DIG_DEMOD_FILT_2_4_H4(0x0C6),
+        /* 147: XCVR_RX_DIG->DEMOD_FILT_2_4_DRS */
+        XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H2(0x020) | XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H3(0x084) |
+            XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H4(0x0C2),
+        /* 148: XCVR_RX_DIG->NB_RSSI_CTRL0 */
+        XCVR_FOLDED_NB_RSSI_CTRL0,
+        /* 149: XCVR_RX_DIG->NB_RSSI_CTRL1 */
+        XCVR_FOLDED_NB_RSSI_CTRL1,
+        /* 150: XCVR_RX_DIG->RCCAL_CTRL0 */
+        XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE(2) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE_DRS(4) |
+            XCVR_RX_DIG_RCCAL_CTRL0_CBPF_CCODE_OFFSET(0x00) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE(1) |
+            XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE_DRS(1) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CMPOUT_INV(0) |
+            XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CODE_OFFSET(0x0) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_SMPL_DLY(0),
+        /* 151: XCVR_RX_DIG->RSSI_GLOBAL_CTRL */
+        XCVR_FOLDED_RSSI_GLOBAL_CTRL | XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_CCA1_ED_EN(0),
+        /* 152: XCVR_RX_DIG->WB_RSSI_CTRL */
+        XCVR_FOLDED_WB_RSSI_CTRL,
+        /* 153: XCVR_TSM->CTRL */
+        XCVR_FOLDED_CTRL,
+        /* 154: XCVR_TSM->END_OF_SEQ */
+        XCVR_FOLDED_END_OF_SEQ,
+        /* 155: XCVR_TSM->FAST_CTRL1 */
+        XCVR_FOLDED_FAST_CTRL1,
+        /* 156: XCVR_TSM->FAST_CTRL2 */
+        XCVR_FOLDED_FAST_CTRL2,
+        /* 157: XCVR_TSM->FAST_CTRL3 */
+        XCVR_FOLDED_FAST_CTRL3,
+        /* 158: XCVR_TSM->RECYCLE_COUNT */
+        XCVR_FOLDED_RECYCLE_COUNT,
+        /* 159: XCVR_TSM->TIMING00 */
+        XCVR_FOLDED_TIMING00,
+        /* 160: XCVR_TSM->TIMING01 */
+        XCVR_FOLDED_TIMING01,
+        /* 161: XCVR_TSM->TIMING02 */
+        XCVR_FOLDED_TIMING02,
+        /* 162: XCVR_TSM->TIMING03 */
+        XCVR_FOLDED_TIMING03,
+        /* 163: XCVR_TSM->TIMING04 */
+        XCVR_FOLDED_TIMING04,
+        /* 164: XCVR_TSM->TIMING05 */
+        XCVR_FOLDED_TIMING05,
+        /* 165: XCVR_TSM->TIMING06 */
+        XCVR_FOLDED_TIMING06,
+        /* 166: XCVR_TSM->TIMING07 */
+        XCVR_FOLDED_TIMING07,
+        /* 167: XCVR_TSM->TIMING08 */
+        XCVR_FOLDED_TIMING08,
+        /* 168: XCVR_TSM->TIMING09 */
+        XCVR_FOLDED_TIMING09,
+        /* 169: XCVR_TSM->TIMING10 */
+        XCVR_FOLDED_TIMING10,
+        /* 170: XCVR_TSM->TIMING11 */
+        XCVR_FOLDED_TIMING11,
+        /* 171: XCVR_TSM->TIMING12 */
+        XCVR_FOLDED_TIMING12,
+        /* 172: XCVR_TSM->TIMING13 */
+        XCVR_FOLDED_TIMING13,
+        /* 173: XCVR_TSM->TIMING14 */
+        XCVR_FOLDED_TIMING14,
+        /* 174: XCVR_TSM->TIMING15 */
+        XCVR_FOLDED_TIMING15,
+        /* 175: XCVR_TSM->TIMING16 */
+        XCVR_FOLDED_TIMING16,
+        /* 176: XCVR_TSM->TIMING17 */
+        XCVR_FOLDED_TIMING17,
+        /* 177: XCVR_TSM->TIMING18 */
+        XCVR_FOLDED_TIMING18,
+        /* 178: XCVR_TSM->TIMING19 */
+        XCVR_FOLDED_TIMING19,
+        /* 179: XCVR_TSM->TIMING20 */
+        XCVR_FOLDED_TIMING20,
+        /* 180: XCVR_TSM->TIMING21 */
+        XCVR_FOLDED_TIMING21,
+        /* 181: XCVR_TSM->TIMING22 */
+        XCVR_FOLDED_TIMING22,
+        /* 182: XCVR_TSM->TIMING23 */
+        XCVR_FOLDED_TIMING23,
+        /* 183: XCVR_TSM->TIMING24 */
+        XCVR_FOLDED_TIMING24,
+        /* 184: XCVR_TSM->TIMING25 */
+        XCVR_FOLDED_TIMING25,
+        /* 185: XCVR_TSM->TIMING26 */
+        XCVR_FOLDED_TIMING26,
+        /* 186: XCVR_TSM->TIMING27 */
+        XCVR_FOLDED_TIMING27,
+        /* 187: XCVR_TSM->TIMING28 */
+        XCVR_FOLDED_TIMING28,
+        /* 188: XCVR_TSM->TIMING29 */
+        XCVR_FOLDED_TIMING29,
+        /* 189: XCVR_TSM->TIMING30 */
+        XCVR_FOLDED_TIMING30,
+        /* 190: XCVR_TSM->TIMING31 */
+        XCVR_FOLDED_TIMING31,
+        /* 191: XCVR_TSM->TIMING32 */
+        XCVR_FOLDED_TIMING32,
+        /* 192: XCVR_TSM->TIMING33 */
+        XCVR_FOLDED_TIMING33,
+        /* 193: XCVR_TSM->TIMING34 */
+        XCVR_FOLDED_TIMING34,
+        /* 194: XCVR_TSM->TIMING35 */
+        XCVR_FOLDED_TIMING35,
+        /* 195: XCVR_TSM->TIMING36 */
+        XCVR_FOLDED_TIMING36,
+        /* 196: XCVR_TSM->TIMING37 */
+        XCVR_FOLDED_TIMING37,
+        /* 197: XCVR_TSM->TIMING38 */
+        XCVR_FOLDED_TIMING38,
+        /* 198: XCVR_TSM->TIMING39 */
+        XCVR_FOLDED_TIMING39,
+        /* 199: XCVR_TSM->TIMING40 */
+        XCVR_FOLDED_TIMING40,
+        /* 200: XCVR_TSM->TIMING41 */
+        XCVR_FOLDED_TIMING41,
+        /* 201: XCVR_TSM->TIMING42 */
+        XCVR_FOLDED_TIMING42,
+        /* 202: XCVR_TSM->TIMING43 */
+        XCVR_FOLDED_TIMING43,
+        /* 203: XCVR_TSM->TIMING44 */
+        XCVR_FOLDED_TIMING44,
+        /* 204: XCVR_TSM->TIMING45 */
+        XCVR_FOLDED_TIMING45,
+        /* 205: XCVR_TSM->TIMING46 */
+        XCVR_FOLDED_TIMING46,
+        /* 206: XCVR_TSM->TIMING47 */
+        XCVR_FOLDED_TIMING47,
+        /* 207: XCVR_TSM->TIMING48 */
+        XCVR_FOLDED_TIMING48,
+        /* 208: XCVR_TSM->TIMING49 */
+        XCVR_FOLDED_TIMING49,
+        /* 209: XCVR_TSM->TIMING50 */
+        XCVR_FOLDED_TIMING50,
+        /* 210: XCVR_TSM->TIMING51 */
+        XCVR_FOLDED_TIMING51,
+        /* 211: XCVR_TSM->TIMING52 */
+        XCVR_FOLDED_TIMING52,
+        /* 212: XCVR_TSM->WU_LATENCY */
+        XCVR_FOLDED_WU_LATENCY,
+        /* 213: XCVR_TX_DIG->DATARATE_CONFIG_FILTER_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(3) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(2) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(1),
+#else
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(4) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(3) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(2) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(1),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 214: XCVR_TX_DIG->DATARATE_CONFIG_FSK_CTRL */
+        XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV0(0x0000) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV1(0x0000),
+        /* 215: XCVR_TX_DIG->DATARATE_CONFIG_GFSK_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x1BF),
+#else
+        XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x16D),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 216: XCVR_TX_DIG->DATA_PADDING_CTRL */
+        XCVR_FOLDED_DATA_PADDING_CTRL | XCVR_TX_DIG_DATA_PADDING_CTRL_DATA_PADDING_SEL(0) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_PAD_DLY(0) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_PAD_DLY_EN(1),
+        /* 217: XCVR_TX_DIG->DATA_PADDING_CTRL_1 */
+        XCVR_FOLDED_DATA_PADDING_CTRL_1 | XCVR_TX_DIG_DATA_PADDING_CTRL_1_RAMP_UP_DLY(0x04) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_1_TX_DATA_FLUSH_DLY(0x04),
+        /* 218: XCVR_TX_DIG->DATA_PADDING_CTRL_2 */
+        XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_MFDEV(0x1800) | XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_PFDEV(0x0800),
+        /* 219: XCVR_TX_DIG->FSK_CTRL */
+        XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_0(0x1800) | XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_1(0x0800),
+        /* 220: XCVR_TX_DIG->GFSK_COEFF_0_1 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_0(0x017) | XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_1(0x029),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_0(0x001) | XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_1(0x004),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 221: XCVR_TX_DIG->GFSK_COEFF_2_3 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_2(0x044) | XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_3(0x067),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_2(0x00D) | XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_3(0x028),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 222: XCVR_TX_DIG->GFSK_COEFF_4_5 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_4(0x090) | XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_5(0x0BA),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_4(0x063) | XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_5(0x0C0),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 223: XCVR_TX_DIG->GFSK_COEFF_6_7 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_6(0x0DC) | XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_7(0x0EF),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_6(0x12C) | XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_7(0x176),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 224: XCVR_TX_DIG->GFSK_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(0) |
+            XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x06EF),
+#else
+        XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(0) |
+            XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x05A2),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 225: XCVR_TX_DIG->IMAGE_FILTER_CTRL */
+        XCVR_FOLDED_IMAGE_FILTER_CTRL | XCVR_TX_DIG_IMAGE_FILTER_CTRL_IMAGE_FILTER_OVRD_EN(0),
+        /* 226: XCVR_TX_DIG->PA_CTRL */
+        XCVR_FOLDED_PA_CTRL | XCVR_TX_DIG_PA_CTRL_PA_RAMP_SEL(1),
+        /* 227: XCVR_TX_DIG->PA_RAMP_TBL0 */
+        XCVR_FOLDED_PA_RAMP_TBL0,
+        /* 228: XCVR_TX_DIG->PA_RAMP_TBL1 */
+        XCVR_FOLDED_PA_RAMP_TBL1,
+        /* 229: XCVR_TX_DIG->PA_RAMP_TBL2 */
+        XCVR_FOLDED_PA_RAMP_TBL2,
+        /* 230: XCVR_TX_DIG->PA_RAMP_TBL3 */
+        XCVR_FOLDED_PA_RAMP_TBL3,
+        /* 231: XCVR_TX_DIG->SWITCH_TX_CTRL */
+        XCVR_FOLDED_SWITCH_TX_CTRL,
+        /* 232: XCVR_TX_DIG->TXDIG_CTRL */
+        XCVR_FOLDED_TXDIG_CTRL | XCVR_TX_DIG_TXDIG_CTRL_DATA_STREAM_SEL(0) | XCVR_TX_DIG_TXDIG_CTRL_MODULATOR_SEL(0) |
+            XCVR_TX_DIG_TXDIG_CTRL_PFC_EN(0),
+    },
+};
+
+const xcvr_folded_config_t xcvr_gfsk_bt_0p5_h_1p0_1mbps_folded_config = {
+    .config     = &xcvr_gfsk_bt_0p5_h_1p0_1mbps_full_config,
+    .reg_values = {
+        /* 0: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x28) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x20) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x18) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x10) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x08),
+        /* 1: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x38) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x30) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x28) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x20),
+        /* 2: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x18) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x10) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x08),
+        /* 3: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x28) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x20) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x18) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x10) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x08),
+        /* 4: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x38) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x30) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x28) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x30),
+        /* 5: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x38) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x08),
+        /* 6: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x18) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x10) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x08) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x38),
+        /* 7: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x08) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x10) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x18) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x10),
+        /* 8: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x08) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x38),
+        /* 9: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x18) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x10) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x08) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x38),
+        /* 10: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x08) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x10) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x18) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x20),
+        /* 11: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x28) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x30) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x38),
+        /* 12: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x28) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x30) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x38) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x08),
+        /* 13: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x38) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x30) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x28) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x20),
+        /* 14: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x18) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x10) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x08),
+        /* 15: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x28) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x30) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x38) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x08),
+        /* 16: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x38) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x30) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x28) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x30),
+        /* 17: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x38) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x08),
+        /* 18: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x18) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x20) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x28) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x30) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x38),
+        /* 19: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x08) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x10) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x18) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x10),
+        /* 20: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x08) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x38),
+        /* 21: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x18) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x20) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x28) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x30) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x38),
+        /* 22: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x08) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x10) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x18) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x20),
+        /* 23: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x28) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x30) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x38),
+        /* 24: GEN4PHY->DMD_CTRL0 */
+        XCVR_FOLDED_DMD_CTRL0,
+        /* 25: GEN4PHY->DMD_CTRL1 */
+        XCVR_FOLDED_DMD_CTRL1,
+        /* 26: GEN4PHY->FSK_CFG0 */
+        XCVR_FOLDED_FSK_CFG0 | GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_1M(0x14) |
+            GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_2M(0x11) |
+            GEN4PHY_FSK_CFG0_MSK2FSK_SEED(0) | GEN4PHY_FSK_CFG0_MSK_EN(0),
+        /* 27: GEN4PHY->FSK_CFG1 */
+        GEN4PHY_FSK_CFG1_OVERH(0x040) | GEN4PHY_FSK_CFG1_OVERH_INV(0x080) | GEN4PHY_FSK_CFG1_SYNCTSCALE(0xF),
+        /* 28: GEN4PHY->FSK_CFG2 */
+        XCVR_FOLDED_FSK_CFG2,
+        /* 29: GEN4PHY->FSK_FAD_CFG */
+        XCVR_FOLDED_FSK_FAD_CFG,
+        /* 30: GEN4PHY->FSK_FAD_CTRL */
+        XCVR_FOLDED_FSK_FAD_CTRL,
+        /* 31: GEN4PHY->FSK_PD_CFG0 */
+        GEN4PHY_FSK_PD_CFG0_PD_IIR_ALPHA(0xFF) | GEN4PHY_FSK_PD_CFG0_PREAMBLE_T_SCALE(0xC),
+        /* 32: GEN4PHY->FSK_PD_CFG1 */
+        GEN4PHY_FSK_PD_CFG1_PREAMBLE_PATTERN(0x55),
+        /* 33: GEN4PHY->FSK_PD_CFG2 */
+        GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_1M(0xD7) | GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_2M(0xF6),
+        /* 34: GEN4PHY->FSK_PD_PH[0] */
+        GEN4PHY_FSK_PD_PH_REF0(0x07) | GEN4PHY_FSK_PD_PH_REF1(0x0A) | GEN4PHY_FSK_PD_PH_REF2(0x07) |
+            GEN4PHY_FSK_PD_PH_REF3(0x00),
+        /* 35: GEN4PHY->FSK_PD_PH[1] */
+        GEN4PHY_FSK_PD_PH_REF0(0x39) | GEN4PHY_FSK_PD_PH_REF1(0x36) | GEN4PHY_FSK_PD_PH_REF2(0x39) |
+            GEN4PHY_FSK_PD_PH_REF3(0x00),
+        /* 36: GEN4PHY->FSK_PT */
+        XCVR_FOLDED_FSK_PT | GEN4PHY_FSK_PT_AGC_TIMEOUT(0x0048),
+        /* 37: GEN4PHY->LR_AA_CFG */
+        GEN4PHY_LR_AA_CFG_AA_COR_THRESH(0x00) | GEN4PHY_LR_AA_CFG_AA_HAM_THRESH(0x00) |
+            GEN4PHY_LR_AA_CFG_AA_LR_CORR_GAIN(0x00) | GEN4PHY_LR_AA_CFG_ACCESS_ADDR_HAM(0x00),
+        /* 38: GEN4PHY->LR_PD_CFG */
+        GEN4PHY_LR_PD_CFG_CORR_TH(0x00) | GEN4PHY_LR_PD_CFG_FREQ_TH(0x00) | GEN4PHY_LR_PD_CFG_NO_PEAKS(0),
+        /* 39: GEN4PHY->LR_PD_PH[0] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 40: GEN4PHY->LR_PD_PH[1] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 41: GEN4PHY->LR_PD_PH[2] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 42: GEN4PHY->LR_PD_PH[3] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 43: GEN4PHY->MISC */
+        XCVR_FOLDED_MISC,
+        /* 44: GEN4PHY->PREPHY_MISC */
+        XCVR_FOLDED_PREPHY_MISC,
+        /* 45: GEN4PHY->RTT_CTRL */
+        XCVR_FOLDED_RTT_CTRL,
+        /* 46: GEN4PHY->RTT_REF */
+        GEN4PHY_RTT_REF_FM_REF_010(0x48) | GEN4PHY_RTT_REF_FM_REF_110(0x63) | GEN4PHY_RTT_REF_FM_REF_111(0x80),
+        /* 47: GEN4PHY->SM_CFG */
+        XCVR_FOLDED_SM_CFG | GEN4PHY_SM_CFG_AA_TIMEOUT_UNCODED(0x0A0),
+        /* 48: RADIO_CTRL->LL_CTRL */
+        RADIO_CTRL_LL_CTRL_ACTIVE_LL(2),
+        /* 49: XCVR_ANALOG->LDO_0 */
+        XCVR_FOLDED_LDO_0,
+        /* 50: XCVR_ANALOG->LDO_1 */
+        XCVR_FOLDED_LDO_1,
+        /* 51: XCVR_ANALOG->PLL */
+        XCVR_FOLDED_PLL,
+        /* 52: XCVR_ANALOG->RX_0 */
+        XCVR_FOLDED_RX_0,
+        /* 53: XCVR_ANALOG->RX_1 */
+        XCVR_FOLDED_RX_1,
+        /* 54: XCVR_ANALOG->TX_DAC_PA */
+        XCVR_FOLDED_TX_DAC_PA | XCVR_ANALOG_TX_DAC_PA_DAC_TRIM_CFBK_DRS(0),
+        /* 55: XCVR_ANALOG->XO_DIST */
+        XCVR_FOLDED_XO_DIST,
+        /* 56: XCVR_MISC->IPS_FO_ADDR[0] */
+        XCVR_MISC_IPS_FO_ADDR_ADDR(0x370) | XCVR_MISC_IPS_FO_ADDR_ENTRY_RX(0) | XCVR_MISC_IPS_FO_ADDR_ENTRY_TX(0),
+        /* 57: XCVR_MISC->IPS_FO_ADDR[1] */
+        XCVR_MISC_IPS_FO_ADDR_ADDR(0x02C) | XCVR_MISC_IPS_FO_ADDR_ENTRY_RX(0) | XCVR_MISC_IPS_FO_ADDR_ENTRY_TX(0),
+        /* 58: XCVR_MISC->IPS_FO_DRS0_DATA[0] */
+        XCVR_MISC_IPS_FO_DRS0_DATA_DRS0_DATA(0x00000000),
+        /* 59: XCVR_MISC->IPS_FO_DRS0_DATA[1] */
+        XCVR_MISC_IPS_FO_DRS0_DATA_DRS0_DATA(0x00000000),
+        /* 60: XCVR_MISC->IPS_FO_DRS1_DATA[0] */
+        XCVR_MISC_IPS_FO_DRS1_DATA_DRS1_DATA(0x00000000),
+        /* 61: XCVR_MISC->IPS_FO_DRS1_DATA[1] */
+        XCVR_MISC_IPS_FO_DRS1_DATA_DRS1_DATA(0x00000000),
+        /* 62: XCVR_MISC->LDO_TRIM_0 */
+        XCVR_FOLDED_LDO_TRIM_0,
+        /* 63: XCVR_MISC->LDO_TRIM_1 */
+        XCVR_FOLDED_LDO_TRIM_1,
+        /* 64: XCVR_MISC->XCVR_CTRL */
+        XCVR_FOLDED_XCVR_CTRL | XCVR_MISC_XCVR_CTRL_DATA_RATE_DRS(0) | XCVR_MISC_XCVR_CTRL_DEMOD_SEL(1) |
+            XCVR_MISC_XCVR_CTRL_LL_CFG_CAPT_DIS(0),
+        /* 65: XCVR_PLL_DIG->CHAN_MAP */
+        XCVR_FOLDED_CHAN_MAP | XCVR_PLL_DIG_CHAN_MAP_BAND_SELECT(0),
+        /* 66: XCVR_PLL_DIG->CHAN_MAP_EXT */
+#if RF_OSC_26MHZ == 1
+        XCVR_FOLDED_CHAN_MAP_EXT | XCVR_PLL_DIG_CHAN_MAP_EXT_NUM_OFFSET(0x013B13B),
+#else
+        XCVR_FOLDED_CHAN_MAP_EXT | XCVR_PLL_DIG_CHAN_MAP_EXT_NUM_OFFSET(0x0100000),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 67: XCVR_PLL_DIG->DATA_RATE_OVRD_CTRL1 */
+        XCVR_FOLDED_DATA_RATE_OVRD_CTRL1,
+        /* 68: XCVR_PLL_DIG->DATA_RATE_OVRD_CTRL2 */
+#if RF_OSC_26MHZ == 1
+        XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL2_NUM_OFFSET_CFG1(0x01D89D9),
+#else
+        XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL2_NUM_OFFSET_CFG1(0x0180000),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 69: XCVR_PLL_DIG->DELAY_MATCH */
+        XCVR_FOLDED_DELAY_MATCH | XCVR_PLL_DIG_DELAY_MATCH_HPM_INTEGER_DELAY(0x04) |
+            XCVR_PLL_DIG_DELAY_MATCH_LPM_SDM_DELAY(0x03),
+        /* 70: XCVR_PLL_DIG->HPMCAL_CTRL */
+        XCVR_FOLDED_HPMCAL_CTRL | XCVR_PLL_DIG_HPMCAL_CTRL_HPM_CAL_ARRAY_SIZE(0),
+        /* 71: XCVR_PLL_DIG->HPM_BUMP */
+        XCVR_FOLDED_HPM_BUMP | XCVR_PLL_DIG_HPM_BUMP_HPM_VCM_CAL(2) | XCVR_PLL_DIG_HPM_BUMP_HPM_VCM_TX(2),
+        /* 72: XCVR_PLL_DIG->HPM_CAL_TIMING */
+        XCVR_FOLDED_HPM_CAL_TIMING,
+        /* 73: XCVR_PLL_DIG->HPM_CTRL */
+        XCVR_FOLDED_HPM_CTRL,
+        /* 74: XCVR_PLL_DIG->HPM_SDM_RES */
+        XCVR_FOLDED_HPM_SDM_RES | XCVR_PLL_DIG_HPM_SDM_RES_HPM_COUNT_ADJUST(0x02),
+        /* 75: XCVR_PLL_DIG->LOCK_DETECT */
+        XCVR_FOLDED_LOCK_DETECT,
+        /* 76: XCVR_PLL_DIG->LPM_CTRL */
+        XCVR_FOLDED_LPM_CTRL,
+        /* 77: XCVR_PLL_DIG->LPM_SDM_CTRL1 */
+        XCVR_FOLDED_LPM_SDM_CTRL1,
+        /* 78: XCVR_PLL_DIG->MOD_CTRL */
+        XCVR_FOLDED_MOD_CTRL,
+        /* 79: XCVR_PLL_DIG->PLL_DATARATE_CTRL */
+        XCVR_FOLDED_PLL_DATARATE_CTRL,
+        /* 80: XCVR_PLL_DIG->TUNING_CAP_RX_CTRL */
+        XCVR_FOLDED_TUNING_CAP_RX_CTRL,
+        /* 81: XCVR_PLL_DIG->TUNING_CAP_TX_CTRL */
+        XCVR_FOLDED_TUNING_CAP_TX_CTRL,
+        /* 82: XCVR_RX_DIG->ACQ_FILT_0_3 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x03) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x00) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x78) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x77),
+#else
+        XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x03) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x01) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x76) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x03),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 83: XCVR_RX_DIG->ACQ_FILT_0_3_DRS */
+        XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H0(0x00) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H1(0x00) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H2(0x00) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H3(0x00),
+        /* 84: XCVR_RX_DIG->ACQ_FILT_10_11 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x066) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x0C9),
+#else
+        XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x3FA) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x140),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 85: XCVR_RX_DIG->ACQ_FILT_10_11_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x054) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x0E4),
+#else
+        XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x3B2) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x167),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 86: XCVR_RX_DIG->ACQ_FILT_4_7 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x06) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x1A) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_H6(0x11) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0xE7),
+#else
+        XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x15) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x6D) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_H6(0xE2) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0x36),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 87: XCVR_RX_DIG->ACQ_FILT_4_7_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x7C) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x05) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0x15) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0x04),
+#else
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x01) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x0A) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0xE8) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0x00),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 88: XCVR_RX_DIG->ACQ_FILT_8_9 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x1CA) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x1F5),
+#else
+        XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x01F) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x18F),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 89: XCVR_RX_DIG->ACQ_FILT_8_9_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x1D2) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x1D7),
+#else
+        XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x048) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x1AC),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 90: XCVR_RX_DIG->AGC_CTRL */
+        XCVR_FOLDED_AGC_CTRL,
+        /* 91: XCVR_RX_DIG->AGC_CTRL_STAT */
+        XCVR_FOLDED_AGC_CTRL_STAT,
+        /* 92: XCVR_RX_DIG->AGC_IDX0_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX0_GAIN_CFG,
+        /* 93: XCVR_RX_DIG->AGC_IDX0_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX0_GAIN_VAL,
+        /* 94: XCVR_RX_DIG->AGC_IDX0_THR */
+        XCVR_FOLDED_AGC_IDX0_THR,
+        /* 95: XCVR_RX_DIG->AGC_IDX10_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX10_GAIN_CFG,
+        /* 96: XCVR_RX_DIG->AGC_IDX10_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX10_GAIN_VAL,
+        /* 97: XCVR_RX_DIG->AGC_IDX10_THR */
+        XCVR_FOLDED_AGC_IDX10_THR,
+        /* 98: XCVR_RX_DIG->AGC_IDX11_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX11_GAIN_CFG | XCVR_RX_DIG_AGC_IDX11_GAIN_CFG_MAG_THR_11_DRS_OFS(0x00) |
+            XCVR_RX_DIG_AGC_IDX11_GAIN_CFG_MAG_THR_HI_11_DRS_OFS(0x00),
+        /* 99: XCVR_RX_DIG->AGC_IDX11_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX11_GAIN_VAL | XCVR_RX_DIG_AGC_IDX11_GAIN_VAL_MAG_THR_11(0x000) |
+            XCVR_RX_DIG_AGC_IDX11_GAIN_VAL_MAG_THR_HI_11(0x000),
+        /* 100: XCVR_RX_DIG->AGC_IDX11_THR */
+        XCVR_FOLDED_AGC_IDX11_THR,
+        /* 101: XCVR_RX_DIG->AGC_IDX1_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX1_GAIN_CFG,
+        /* 102: XCVR_RX_DIG->AGC_IDX1_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX1_GAIN_VAL,
+        /* 103: XCVR_RX_DIG->AGC_IDX1_THR */
+        XCVR_FOLDED_AGC_IDX1_THR,
+        /* 104: XCVR_RX_DIG->AGC_IDX2_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX2_GAIN_CFG,
+        /* 105: XCVR_RX_DIG->AGC_IDX2_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX2_GAIN_VAL,
+        /* 106: XCVR_RX_DIG->AGC_IDX2_THR */
+        XCVR_FOLDED_AGC_IDX2_THR,
+        /* 107: XCVR_RX_DIG->AGC_IDX3_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX3_GAIN_CFG,
+        /* 108: XCVR_RX_DIG->AGC_IDX3_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX3_GAIN_VAL,
+        /* 109: XCVR_RX_DIG->AGC_IDX3_THR */
+        XCVR_FOLDED_AGC_IDX3_THR,
+        /* 110: XCVR_RX_DIG->AGC_IDX4_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX4_GAIN_CFG,
+        /* 111: XCVR_RX_DIG->AGC_IDX4_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX4_GAIN_VAL,
+        /* 112: XCVR_RX_DIG->AGC_IDX4_THR */
+        XCVR_FOLDED_AGC_IDX4_THR,
+        /* 113: XCVR_RX_DIG->AGC_IDX5_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX5_GAIN_CFG,
+        /* 114: XCVR_RX_DIG->AGC_IDX5_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX5_GAIN_VAL,
+        /* 115: XCVR_RX_DIG->AGC_IDX5_THR */
+        XCVR_FOLDED_AGC_IDX5_THR,
+        /* 116: XCVR_RX_DIG->AGC_IDX6_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX6_GAIN_CFG,
+        /* 117: XCVR_RX_DIG->AGC_IDX6_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX6_GAIN_VAL,
+        /* 118: XCVR_RX_DIG->AGC_IDX6_THR */
+        XCVR_FOLDED_AGC_IDX6_THR,
+        /* 119: XCVR_RX_DIG->AGC_IDX7_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX7_GAIN_CFG,
+        /* 120: XCVR_RX_DIG->AGC_IDX7_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX7_GAIN_VAL,
+        /* 121: XCVR_RX_DIG->AGC_IDX7_THR */
+        XCVR_FOLDED_AGC_IDX7_THR,
+        /* 122: XCVR_RX_DIG->AGC_IDX8_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX8_GAIN_CFG,
+        /* 123: XCVR_RX_DIG->AGC_IDX8_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX8_GAIN_VAL,
+        /* 124: XCVR_RX_DIG->AGC_IDX8_THR */
+        XCVR_FOLDED_AGC_IDX8_THR,
+        /* 125: XCVR_RX_DIG->AGC_IDX9_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX9_GAIN_CFG,
+        /* 126: XCVR_RX_DIG->AGC_IDX9_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX9_GAIN_VAL,
+        /* 127: XCVR_RX_DIG->AGC_IDX9_THR */
+        XCVR_FOLDED_AGC_IDX9_THR,
+        /* 128: XCVR_RX_DIG->AGC_MIS_GAIN_CFG */
+        XCVR_FOLDED_AGC_MIS_GAIN_CFG,
+        /* 129: XCVR_RX_DIG->AGC_THR_FAST */
+        XCVR_FOLDED_AGC_THR_FAST,
+        /* 130: XCVR_RX_DIG->AGC_THR_FAST_DRS */
+        XCVR_FOLDED_AGC_THR_FAST_DRS,
+        /* 131: XCVR_RX_DIG->AGC_THR_MIS */
+        XCVR_FOLDED_AGC_THR_MIS,
+        /* 132: XCVR_RX_DIG->AGC_TIMING0 */
+        XCVR_FOLDED_AGC_TIMING0 | XCVR_RX_DIG_AGC_TIMING0_AGC_GAIN_STEP_WAIT(0x10),
+        /* 133: XCVR_RX_DIG->AGC_TIMING0_DRS */
+        XCVR_FOLDED_AGC_TIMING0_DRS | XCVR_RX_DIG_AGC_TIMING0_DRS_AGC_GAIN_STEP_WAIT(0x10),
+        /* 134: XCVR_RX_DIG->AGC_TIMING1 */
+        XCVR_FOLDED_AGC_TIMING1 | XCVR_RX_DIG_AGC_TIMING1_AGC_FREEZE_TIMEOUT(0x0A) |
+            XCVR_RX_DIG_AGC_TIMING1_AGC_HOLD_TIMEOUT(0x08),
+        /* 135: XCVR_RX_DIG->AGC_TIMING1_DRS */
+        XCVR_RX_DIG_AGC_TIMING1_DRS_AGC_FREEZE_TIMEOUT(0x0A) | XCVR_RX_DIG_AGC_TIMING1_DRS_AGC_HOLD_TIMEOUT(0x08),
+        /* 136: XCVR_RX_DIG->AGC_TIMING2 */
+        XCVR_FOLDED_AGC_TIMING2 | XCVR_RX_DIG_AGC_TIMING2_AGC_UNFREEZE_FEAT_TIMEOUT(0x000) |
+            XCVR_RX_DIG_AGC_TIMING2_AGC_UNHOLD_FEAT_TIMEOUT(0x000),
+        /* 137: XCVR_RX_DIG->AGC_TIMING2_DRS */
+        XCVR_RX_DIG_AGC_TIMING2_DRS_AGC_UNFREEZE_FEAT_TIMEOUT(0x000) |
+            XCVR_RX_DIG_AGC_TIMING2_DRS_AGC_UNHOLD_FEAT_TIMEOUT(0x000),
+        /* 138: XCVR_RX_DIG->CTRL0 */
+#if RF_OSC_26MHZ == 1
+        XCVR_FOLDED_CTRL0 | XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(2) |
+            XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x03B) |
+            XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(0) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#else
+        XCVR_FOLDED_CTRL0 | XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(3) |
+            XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x030) |
+            XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(0) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 139: XCVR_RX_DIG->CTRL0_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(1) |
+            XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x03B),
+#else
+        XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(2) |
+            XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x030),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 140: XCVR_RX_DIG->CTRL1 */
+        XCVR_FOLDED_CTRL1,
+        /* 141: XCVR_RX_DIG->DCOC_CTRL0 */
+        XCVR_FOLDED_DCOC_CTRL0 | XCVR_RX_DIG_DCOC_CTRL0_DCOC_DAC_ORDER(0) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFII(0x8) |
+            XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFIIP(1) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFQQ(0x2) |
+            XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFQQP(0),
+        /* 142: XCVR_RX_DIG->DCOC_CTRL0_DRS */
+        XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFII(4) | XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFIIP(1) |
+            XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFQQ(1) | XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFQQP(0),
+        /* 143: XCVR_RX_DIG->DCOC_CTRL1 */
+        XCVR_FOLDED_DCOC_CTRL1,
+        /* 144: XCVR_RX_DIG->DEMOD_FILT_0_1 */
+        XCVR_RX_DIG_DEMOD_FILT_0_1_H0(0x002) | XCVR_RX_DIG_DEMOD_FILT_0_1_H1(0x1F6),
+        /* 145: XCVR_RX_DIG->DEMOD_FILT_0_1_DRS */
+        XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H0(0x001) | XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H1(0x1F5),
+        /* 146: XCVR_RX_DIG->DEMOD_FILT_2_4 */
+        XCVR_RX_DIG_DEMOD_FILT_2_4_H2(0x3F3) | XCVR_RX_DIG_DEMOD_FILT_2_4_H3(0x08A) |
+            XCVR_RX_DIG_DEMOD_FILT_2_4_H4(0x116),
+        /* 147: XCVR_RX_DIG->DEMOD_FILT_2_4_DRS */
+        XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H2(0x3F6) | XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H3(0x08B) |
+            XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H4(0x110),
+        /* 148: XCVR_RX_DIG->NB_RSSI_CTRL0 */
+        XCVR_FOLDED_NB_RSSI_CTRL0,
+        /* 149: XCVR_RX_DIG->NB_RSSI_CTRL1 */
+        XCVR_FOLDED_NB_RSSI_CTRL1,
+        /* 150: XCVR_RX_DIG->RCCAL_CTRL0 */
+        XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE(2) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE_DRS(0) |
+            XCVR_RX_DIG_RCCAL_CTRL0_CBPF_CCODE_OFFSET(0x00) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE(0) |
+            XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE_DRS(0) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CMPOUT_INV(0) |
+            XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CODE_OFFSET(0x0) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_SMPL_DLY(0),
+        /* 151: XCVR_RX_DIG->RSSI_GLOBAL_CTRL */
+        XCVR_FOLDED_RSSI_GLOBAL_CTRL | XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_CCA1_ED_EN(0),
+        /* 152: XCVR_RX_DIG->WB_RSSI_CTRL */
+        XCVR_FOLDED_WB_RSSI_CTRL,
+        /* 153: XCVR_TSM->CTRL */
+        XCVR_FOLDED_CTRL,
+        /* 154: XCVR_TSM->END_OF_SEQ */
+        XCVR_FOLDED_END_OF_SEQ,
+        /* 155: XCVR_TSM->FAST_CTRL1 */
+        XCVR_FOLDED_FAST_CTRL1,
+        /* 156: XCVR_TSM->FAST_CTRL2 */
+        XCVR_FOLDED_FAST_CTRL2,
+        /* 157: XCVR_TSM->FAST_CTRL3 */
+        XCVR_FOLDED_FAST_CTRL3,
+        /* 158: XCVR_TSM->RECYCLE_COUNT */
+        XCVR_FOLDED_RECYCLE_COUNT,
+        /* 159: XCVR_TSM->TIMING00 */
+        XCVR_FOLDED_TIMING00,
+        /* 160: XCVR_TSM->TIMING01 */
+        XCVR_FOLDED_TIMING01,
+        /* 161: XCVR_TSM->TIMING02 */
+        XCVR_FOLDED_TIMING02,
+        /* 162: XCVR_TSM->TIMING03 */
+        XCVR_FOLDED_TIMING03,
+        /* 163: XCVR_TSM->TIMING04 */
+        XCVR_FOLDED_TIMING04,
+        /* 164: XCVR_TSM->TIMING05 */
+        XCVR_FOLDED_TIMING05,
+        /* 165: XCVR_TSM->TIMING06 */
+        XCVR_FOLDED_TIMING06,
+        /* 166: XCVR_TSM->TIMING07 */
+        XCVR_FOLDED_TIMING07,
+        /* 167: XCVR_TSM->TIMING08 */
+        XCVR_FOLDED_TIMING08,
+        /* 168: XCVR_TSM->TIMING09 */
+        XCVR_FOLDED_TIMING09,
+        /* 169: XCVR_TSM->TIMING10 */
+        XCVR_FOLDED_TIMING10,
+        /* 170: XCVR_TSM->TIMING11 */
+        XCVR_FOLDED_TIMING11,
+        /* 171: XCVR_TSM->TIMING12 */
+        XCVR_FOLDED_TIMING12,
+        /* 172: XCVR_TSM->TIMING13 */
+        XCVR_FOLDED_TIMING13,
+        /* 173: XCVR_TSM->TIMING14 */
+        XCVR_FOLDED_TIMING14,
+        /* 174: XCVR_TSM->TIMING15 */
+        XCVR_FOLDED_TIMING15,
+        /* 175: XCVR_TSM->TIMING16 */
+        XCVR_FOLDED_TIMING16,
+        /* 176: XCVR_TSM->TIMING17 */
+        XCVR_FOLDED_TIMING17,
+        /* 177: XCVR_TSM->TIMING18 */
+        XCVR_FOLDED_TIMING18,
+        /* 178: XCVR_TSM->TIMING19 */
+        XCVR_FOLDED_TIMING19,
+        /* 179: XCVR_TSM->TIMING20 */
+        XCVR_FOLDED_TIMING20,
+        /* 180: XCVR_TSM->TIMING21 */
+        XCVR_FOLDED_TIMING21,
+        /* 181: XCVR_TSM->TIMING22 */
+        XCVR_FOLDED_TIMING22,
+        /* 182: XCVR_TSM->TIMING23 */
+        XCVR_FOLDED_TIMING23,
+        /* 183: XCVR_TSM->TIMING24 */
+        XCVR_FOLDED_TIMING24,
+        /* 184: XCVR_TSM->TIMING25 */
+        XCVR_FOLDED_TIMING25,
+        /* 185: XCVR_TSM->TIMING26 */
+        XCVR_FOLDED_TIMING26,
+        /* 186: XCVR_TSM->TIMING27 */
+        XCVR_FOLDED_TIMING27,
+        /* 187: XCVR_TSM->TIMING28 */
+        XCVR_FOLDED_TIMING28,
+        /* 188: XCVR_TSM->TIMING29 */
+        XCVR_FOLDED_TIMING29,
+        /* 189: XCVR_TSM->TIMING30 */
+        XCVR_FOLDED_TIMING30,
+        /* 190: XCVR_TSM->TIMING31 */
+        XCVR_FOLDED_TIMING31,
+        /* 191: XCVR_TSM->TIMING32 */
+        XCVR_FOLDED_TIMING32,
+        /* 192: XCVR_TSM->TIMING33 */
+        XCVR_FOLDED_TIMING33,
+        /* 193: XCVR_TSM->TIMING34 */
+        XCVR_FOLDED_TIMING34,
+        /* 194: XCVR_TSM->TIMING35 */
+        XCVR_FOLDED_TIMING35,
+        /* 195: XCVR_TSM->TIMING36 */
+        XCVR_FOLDED_TIMING36,
+        /* 196: XCVR_TSM->TIMING37 */
+        XCVR_FOLDED_TIMING37,
+        /* 197: XCVR_TSM->TIMING38 */
+        XCVR_FOLDED_TIMING38,
+        /* 198: XCVR_TSM->TIMING39 */
+        XCVR_FOLDED_TIMING39,
+        /* 199: XCVR_TSM->TIMING40 */
+        XCVR_FOLDED_TIMING40,
+        /* 200: XCVR_TSM->TIMING41 */
+        XCVR_FOLDED_TIMING41,
+        /* 201: XCVR_TSM->TIMING42 */
+        XCVR_FOLDED_TIMING42,
+        /* 202: XCVR_TSM->TIMING43 */
+        XCVR_FOLDED_TIMING43,
+        /* 203: XCVR_TSM->TIMING44 */
+        XCVR_FOLDED_TIMING44,
+        /* 204: XCVR_TSM->TIMING45 */
+        XCVR_FOLDED_TIMING45,
+        /* 205: XCVR_TSM->TIMING46 */
+        XCVR_FOLDED_TIMING46,
+        /* 206: XCVR_TSM->TIMING47 */
+        XCVR_FOLDED_TIMING47,
+        /* 207: XCVR_TSM->TIMING48 */
+        XCVR_FOLDED_TIMING48,
+        /* 208: XCVR_TSM->TIMING49 */
+        XCVR_FOLDED_TIMING49,
+        /* 209: XCVR_TSM->TIMING50 */
+        XCVR_FOLDED_TIMING50,
+        /* 210: XCVR_TSM->TIMING51 */
+        XCVR_FOLDED_TIMING51,
+        /* 211: XCVR_TSM->TIMING52 */
+        XCVR_FOLDED_TIMING52,
+        /* 212: XCVR_TSM->WU_LATENCY */
+        XCVR_FOLDED_WU_LATENCY,
+        /* 213: XCVR_TX_DIG->DATARATE_CONFIG_FILTER_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(0),
+#else
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(0),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 214: XCVR_TX_DIG->DATARATE_CONFIG_FSK_CTRL */
+        XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV0(0x0000) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV1(0x0000),
+        /* 215: XCVR_TX_DIG->DATARATE_CONFIG_GFSK_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x13D0),
+#else
+        XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x1018),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 216: XCVR_TX_DIG->DATA_PADDING_CTRL */
+        XCVR_FOLDED_DATA_PADDING_CTRL | XCVR_TX_DIG_DATA_PADDING_CTRL_DATA_PADDING_SEL(0) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_PAD_DLY(0) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_PAD_DLY_EN(1),
+        /* 217: XCVR_TX_DIG->DATA_PADDING_CTRL_1 */
+        XCVR_FOLDED_DATA_PADDING_CTRL_1 | XCVR_TX_DIG_DATA_PADDING_CTRL_1_RAMP_UP_DLY(0x04) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_1_TX_DATA_FLUSH_DLY(0x04),
+        /* 218: XCVR_TX_DIG->DATA_PADDING_CTRL_2 */
+        XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_MFDEV(0x1800) | XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_PFDEV(0x0800),
+        /* 219: XCVR_TX_DIG->FSK_CTRL */
+        XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_0(0x1800) | XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_1(0x0800),
+        /* 220: XCVR_TX_DIG->GFSK_COEFF_0_1 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_0(0x017) | XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_1(0x029),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_0(0x001) | XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_1(0x004),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 221: XCVR_TX_DIG->GFSK_COEFF_2_3 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_2(0x044) | XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_3(0x067),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_2(0x00D) | XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_3(0x028),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 222: XCVR_TX_DIG->GFSK_COEFF_4_5 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_4(0x090) | XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_5(0x0BA),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_4(0x063) | XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_5(0x0C0),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 223: XCVR_TX_DIG->GFSK_COEFF_6_7 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_6(0x0DC) | XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_7(0x0EF),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_6(0x12C) | XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_7(0x176),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 224: XCVR_TX_DIG->GFSK_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(0) |
+            XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x09E8),
+#else
+        XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(0) |
+            XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x080C),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 225: XCVR_TX_DIG->IMAGE_FILTER_CTRL */
+        XCVR_FOLDED_IMAGE_FILTER_CTRL | XCVR_TX_DIG_IMAGE_FILTER_CTRL_IMAGE_FILTER_OVRD_EN(0),
+        /* 226: XCVR_TX_DIG->PA_CTRL */
+        XCVR_FOLDED_PA_CTRL | XCVR_TX_DIG_PA_CTRL_PA_RAMP_SEL(1),
+        /* 227: XCVR_TX_DIG->PA_RAMP_TBL0 */
+        XCVR_FOLDED_PA_RAMP_TBL0,
+        /* 228: XCVR_TX_DIG->PA_RAMP_TBL1 */
+        XCVR_FOLDED_PA_RAMP_TBL1,
+        /* 229: XCVR_TX_DIG->PA_RAMP_TBL2 */
+        XCVR_FOLDED_PA_RAMP_TBL2,
+        /* 230: XCVR_TX_DIG->PA_RAMP_TBL3 */
+        XCVR_FOLDED_PA_RAMP_TBL3,
+        /* 231: XCVR_TX_DIG->SWITCH_TX_CTRL */
+        XCVR_FOLDED_SWITCH_TX_CTRL,
+        /* 232: XCVR_TX_DIG->TXDIG_CTRL */
+        XCVR_FOLDED_TXDIG_CTRL | XCVR_TX_DIG_TXDIG_CTRL_DATA_STREAM_SEL(0) | XCVR_TX_DIG_TXDIG_CTRL_MODULATOR_SEL(0) |
+            XCVR_TX_DIG_TXDIG_CTRL_PFC_EN(0),
+    },
+};
+
+const xcvr_folded_config_t xcvr_gfsk_bt_0p5_h_1p0_500kbps_folded_config = {
+    .config     = &xcvr_gfsk_bt_0p5_h_1p0_500kbps_full_config,
+    .reg_values = {
+        /* 0: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x28) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x20) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x18) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x10) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x08),
+        /* 1: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x38) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x30) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x28) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x20),
+        /* 2: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x18) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x10) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x08),
+        /* 3: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x28) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x20) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x18) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x10) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x08),
+        /* 4: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x38) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x30) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x28) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x30),
+        /* 5: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x38) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x08),
+        /* 6: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x18) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x10) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x08) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x38),
+        /* 7: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x08) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x10) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x18) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x10),
+        /* 8: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x08) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x38),
+        /* 9: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x18) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x10) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x08) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x38),
+        /* 10: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x08) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x10) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x18) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x20),
+        /* 11: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x28) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x30) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x38),
+        /* 12: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x28) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x30) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x38) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x08),
+        /* 13: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x38) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x30) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x28) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x20),
+        /* 14: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x18) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x10) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x08),
+        /* 15: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x28) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x30) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x38) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x08),
+        /* 16: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x38) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x30) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x28) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x30),
+        /* 17: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x38) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x08),
+        /* 18: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x18) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x20) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x28) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x30) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x38),
+        /* 19: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x08) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x10) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x18) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x10),
+        /* 20: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x08) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x38),
+        /* 21: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x18) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x20) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x28) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x30) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x38),
+        /* 22: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x08) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x10) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x18) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x20),
+        /* 23: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x28) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x30) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x38),
+        /* 24: GEN4PHY->DMD_CTRL0 */
+        XCVR_FOLDED_DMD_CTRL0,
+        /* 25: GEN4PHY->DMD_CTRL1 */
+        XCVR_FOLDED_DMD_CTRL1,
+        /* 26: GEN4PHY->FSK_CFG0 */
+        XCVR_FOLDED_FSK_CFG0 | GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_1M(0x13) |
+            GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_2M(0x11) |
+            GEN4PHY_FSK_CFG0_MSK2FSK_SEED(0) | GEN4PHY_FSK_CFG0_MSK_EN(0),
+        /* 27: GEN4PHY->FSK_CFG1 */
+        GEN4PHY_FSK_CFG1_OVERH(0x040) | GEN4PHY_FSK_CFG1_OVERH_INV(0x080) | GEN4PHY_FSK_CFG1_SYNCTSCALE(0xF),
+        /* 28: GEN4PHY->FSK_CFG2 */
+        XCVR_FOLDED_FSK_CFG2,
+        /* 29: GEN4PHY->FSK_FAD_CFG */
+        XCVR_FOLDED_FSK_FAD_CFG,
+        /* 30: GEN4PHY->FSK_FAD_CTRL */
+        XCVR_FOLDED_FSK_FAD_CTRL,
+        /* 31: GEN4PHY->FSK_PD_CFG0 */
+        GEN4PHY_FSK_PD_CFG0_PD_IIR_ALPHA(0xFF) | GEN4PHY_FSK_PD_CFG0_PREAMBLE_T_SCALE(0xC),
+        /* 32: GEN4PHY->FSK_PD_CFG1 */
+        GEN4PHY_FSK_PD_CFG1_PREAMBLE_PATTERN(0x55),
+        /* 33: GEN4PHY->FSK_PD_CFG2 */
+        GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_1M(0xD7) | GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_2M(0xEB),
+        /* 34: GEN4PHY->FSK_PD_PH[0] */
+        GEN4PHY_FSK_PD_PH_REF0(0x07) | GEN4PHY_FSK_PD_PH_REF1(0x0A) | GEN4PHY_FSK_PD_PH_REF2(0x07) |
+            GEN4PHY_FSK_PD_PH_REF3(0x00),
+        /* 35: GEN4PHY->FSK_PD_PH[1] */
+        GEN4PHY_FSK_PD_PH_REF0(0x39) | GEN4PHY_FSK_PD_PH_REF1(0x36) | GEN4PHY_FSK_PD_PH_REF2(0x39) |
+            GEN4PHY_FSK_PD_PH_REF3(0x00),
+        /* 36: GEN4PHY->FSK_PT */
+        XCVR_FOLDED_FSK_PT | GEN4PHY_FSK_PT_AGC_TIMEOUT(0x0048),
+        /* 37: GEN4PHY->LR_AA_CFG */
+        GEN4PHY_LR_AA_CFG_AA_COR_THRESH(0x00) | GEN4PHY_LR_AA_CFG_AA_HAM_THRESH(0x00) |
+            GEN4PHY_LR_AA_CFG_AA_LR_CORR_GAIN(0x00) | GEN4PHY_LR_AA_CFG_ACCESS_ADDR_HAM(0x00),
+        /* 38: GEN4PHY->LR_PD_CFG */
+        GEN4PHY_LR_PD_CFG_CORR_TH(0x00) | GEN4PHY_LR_PD_CFG_FREQ_TH(0x00) | GEN4PHY_LR_PD_CFG_NO_PEAKS(0),
+        /* 39: GEN4PHY->LR_PD_PH[0] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 40: GEN4PHY->LR_PD_PH[1] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 41: GEN4PHY->LR_PD_PH[2] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 42: GEN4PHY->LR_PD_PH[3] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 43: GEN4PHY->MISC */
+        XCVR_FOLDED_MISC,
+        /* 44: GEN4PHY->PREPHY_MISC */
+        XCVR_FOLDED_PREPHY_MISC,
+        /* 45: GEN4PHY->RTT_CTRL */
+        XCVR_FOLDED_RTT_CTRL,
+        /* 46: GEN4PHY->RTT_REF */
+        GEN4PHY_RTT_REF_FM_REF_010(0x48) | GEN4PHY_RTT_REF_FM_REF_110(0x63) | GEN4PHY_RTT_REF_FM_REF_111(0x80),
+        /* 47: GEN4PHY->SM_CFG */
+        XCVR_FOLDED_SM_CFG | GEN4PHY_SM_CFG_AA_TIMEOUT_UNCODED(0x0A0),
+        /* 48: RADIO_CTRL->LL_CTRL */
+        RADIO_CTRL_LL_CTRL_ACTIVE_LL(2),
+        /* 49: XCVR_ANALOG->LDO_0 */
+        XCVR_FOLDED_LDO_0,
+        /* 50: XCVR_ANALOG->LDO_1 */
+        XCVR_FOLDED_LDO_1,
+        /* 51: XCVR_ANALOG->PLL */
+        XCVR_FOLDED_PLL,
+        /* 52: XCVR_ANALOG->RX_0 */
+        XCVR_FOLDED_RX_0,
+        /* 53: XCVR_ANALOG->RX_1 */
+        XCVR_FOLDED_RX_1,
+        /* 54: XCVR_ANALOG->TX_DAC_PA */
+        XCVR_FOLDED_TX_DAC_PA | XCVR_ANALOG_TX_DAC_PA_DAC_TRIM_CFBK_DRS(1),
+        /* 55: XCVR_ANALOG->XO_DIST */
+        XCVR_FOLDED_XO_DIST,
+        /* 56: XCVR_MISC->IPS_FO_ADDR[0] */
+        XCVR_MISC_IPS_FO_ADDR_ADDR(0x370) | XCVR_MISC_IPS_FO_ADDR_ENTRY_RX(0) | XCVR_MISC_IPS_FO_ADDR_ENTRY_TX(0),
+        /* 57: XCVR_MISC->IPS_FO_ADDR[1] */
+        XCVR_MISC_IPS_FO_ADDR_ADDR(0x02C) | XCVR_MISC_IPS_FO_ADDR_ENTRY_RX(0) | XCVR_MISC_IPS_FO_ADDR_ENTRY_TX(0),
+        /* 58: XCVR_MISC->IPS_FO_DRS0_DATA[0] */
+        XCVR_MISC_IPS_FO_DRS0_DATA_DRS0_DATA(0x00000000),
+        /* 59: XCVR_MISC->IPS_FO_DRS0_DATA[1] */
+        XCVR_MISC_IPS_FO_DRS0_DATA_DRS0_DATA(0x00000000),
+        /* 60: XCVR_MISC->IPS_FO_DRS1_DATA[0] */
+        XCVR_MISC_IPS_FO_DRS1_DATA_DRS1_DATA(0x00000000),
+        /* 61: XCVR_MISC->IPS_FO_DRS1_DATA[1] */
+        XCVR_MISC_IPS_FO_DRS1_DATA_DRS1_DATA(0x00000000),
+        /* 62: XCVR_MISC->LDO_TRIM_0 */
+        XCVR_FOLDED_LDO_TRIM_0,
+        /* 63: XCVR_MISC->LDO_TRIM_1 */
+        XCVR_FOLDED_LDO_TRIM_1,
+        /* 64: XCVR_MISC->XCVR_CTRL */
+        XCVR_FOLDED_XCVR_CTRL | XCVR_MISC_XCVR_CTRL_DATA_RATE_DRS(2) | XCVR_MISC_XCVR_CTRL_DEMOD_SEL(1) |
+            XCVR_MISC_XCVR_CTRL_LL_CFG_CAPT_DIS(0),
+        /* 65: XCVR_PLL_DIG->CHAN_MAP */
+        XCVR_FOLDED_CHAN_MAP | XCVR_PLL_DIG_CHAN_MAP_BAND_SELECT(0),
+        /* 66: XCVR_PLL_DIG->CHAN_MAP_EXT */
+#if RF_OSC_26MHZ == 1
+        XCVR_FOLDED_CHAN_MAP_EXT | XCVR_PLL_DIG_CHAN_MAP_EXT_NUM_OFFSET(0x013B13B),
+#else
+        XCVR_FOLDED_CHAN_MAP_EXT | XCVR_PLL_DIG_CHAN_MAP_EXT_NUM_OFFSET(0x0100000),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 67: XCVR_PLL_DIG->DATA_RATE_OVRD_CTRL1 */
+        XCVR_FOLDED_DATA_RATE_OVRD_CTRL1,
+        /* 68: XCVR_PLL_DIG->DATA_RATE_OVRD_CTRL2 */
+#if RF_OSC_26MHZ == 1
+        XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL2_NUM_OFFSET_CFG1(0x013B13B),
+#else
+        XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL2_NUM_OFFSET_CFG1(0x0100000),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 69: XCVR_PLL_DIG->DELAY_MATCH */
+        XCVR_FOLDED_DELAY_MATCH | XCVR_PLL_DIG_DELAY_MATCH_HPM_INTEGER_DELAY(0x04) |
+            XCVR_PLL_DIG_DELAY_MATCH_LPM_SDM_DELAY(0x03),
+        /* 70: XCVR_PLL_DIG->HPMCAL_CTRL */
+        XCVR_FOLDED_HPMCAL_CTRL | XCVR_PLL_DIG_HPMCAL_CTRL_HPM_CAL_ARRAY_SIZE(0),
+        /* 71: XCVR_PLL_DIG->HPM_BUMP */
+        XCVR_FOLDED_HPM_BUMP | XCVR_PLL_DIG_HPM_BUMP_HPM_VCM_CAL(2) | XCVR_PLL_DIG_HPM_BUMP_HPM_VCM_TX(2),
+        /* 72: XCVR_PLL_DIG->HPM_CAL_TIMING */
+        XCVR_FOLDED_HPM_CAL_TIMING,
+        /* 73: XCVR_PLL_DIG->HPM_CTRL */
+        XCVR_FOLDED_HPM_CTRL,
+        /* 74: XCVR_PLL_DIG->HPM_SDM_RES */
+        XCVR_FOLDED_HPM_SDM_RES | XCVR_PLL_DIG_HPM_SDM_RES_HPM_COUNT_ADJUST(0x02),
+        /* 75: XCVR_PLL_DIG->LOCK_DETECT */
+        XCVR_FOLDED_LOCK_DETECT,
+        /* 76: XCVR_PLL_DIG->LPM_CTRL */
+        XCVR_FOLDED_LPM_CTRL,
+        /* 77: XCVR_PLL_DIG->LPM_SDM_CTRL1 */
+        XCVR_FOLDED_LPM_SDM_CTRL1,
+        /* 78: XCVR_PLL_DIG->MOD_CTRL */
+        XCVR_FOLDED_MOD_CTRL,
+        /* 79: XCVR_PLL_DIG->PLL_DATARATE_CTRL */
+        XCVR_FOLDED_PLL_DATARATE_CTRL,
+        /* 80: XCVR_PLL_DIG->TUNING_CAP_RX_CTRL */
+        XCVR_FOLDED_TUNING_CAP_RX_CTRL,
+        /* 81: XCVR_PLL_DIG->TUNING_CAP_TX_CTRL */
+        XCVR_FOLDED_TUNING_CAP_TX_CTRL,
+        /* 82: XCVR_RX_DIG->ACQ_FILT_0_3 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x03) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x00) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x78) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x77),
+#else
+        XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x03) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x01) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x76) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x03),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 83: XCVR_RX_DIG->ACQ_FILT_0_3_DRS */
+        XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H0(0x00) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H1(0x00) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H2(0x00) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H3(0x00),
+        /* 84: XCVR_RX_DIG->ACQ_FILT_10_11 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x066) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x0C9),
+#else
+        XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x3FA) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x140),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 85: XCVR_RX_DIG->ACQ_FILT_10_11_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x054) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x0E4),
+#else
+        XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x3B2) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x167),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 86: XCVR_RX_DIG->ACQ_FILT_4_7 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x06) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x1A) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_H6(0x11) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0xE7),
+#else
+        XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x15) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x6D) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_H6(0xE2) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0x36),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 87: XCVR_RX_DIG->ACQ_FILT_4_7_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x7C) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x05) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0x15) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0x04),
+#else
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x01) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x0A) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0xE8) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0x00),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 88: XCVR_RX_DIG->ACQ_FILT_8_9 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x1CA) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x1F5),
+#else
+        XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x01F) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x18F),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 89: XCVR_RX_DIG->ACQ_FILT_8_9_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x1D2) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x1D7),
+#else
+        XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x048) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x1AC),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 90: XCVR_RX_DIG->AGC_CTRL */
+        XCVR_FOLDED_AGC_CTRL,
+        /* 91: XCVR_RX_DIG->AGC_CTRL_STAT */
+        XCVR_FOLDED_AGC_CTRL_STAT,
+        /* 92: XCVR_RX_DIG->AGC_IDX0_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX0_GAIN_CFG,
+        /* 93: XCVR_RX_DIG->AGC_IDX0_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX0_GAIN_VAL,
+        /* 94: XCVR_RX_DIG->AGC_IDX0_THR */
+        XCVR_FOLDED_AGC_IDX0_THR,
+        /* 95: XCVR_RX_DIG->AGC_IDX10_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX10_GAIN_CFG,
+        /* 96: XCVR_RX_DIG->AGC_IDX10_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX10_GAIN_VAL,
+        /* 97: XCVR_RX_DIG->AGC_IDX10_THR */
+        XCVR_FOLDED_AGC_IDX10_THR,
+        /* 98: XCVR_RX_DIG->AGC_IDX11_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX11_GAIN_CFG | XCVR_RX_DIG_AGC_IDX11_GAIN_CFG_MAG_THR_11_DRS_OFS(0x00) |
+            XCVR_RX_DIG_AGC_IDX11_GAIN_CFG_MAG_THR_HI_11_DRS_OFS(0x00),
+        /* 99: XCVR_RX_DIG->AGC_IDX11_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX11_GAIN_VAL | XCVR_RX_DIG_AGC_IDX11_GAIN_VAL_MAG_THR_11(0x000) |
+            XCVR_RX_DIG_AGC_IDX11_GAIN_VAL_MAG_THR_HI_11(0x000),
+        /* 100: XCVR_RX_DIG->AGC_IDX11_THR */
+        XCVR_FOLDED_AGC_IDX11_THR,
+        /* 101: XCVR_RX_DIG->AGC_IDX1_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX1_GAIN_CFG,
+        /* 102: XCVR_RX_DIG->AGC_IDX1_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX1_GAIN_VAL,
+        /* 103: XCVR_RX_DIG->AGC_IDX1_THR */
+        XCVR_FOLDED_AGC_IDX1_THR,
+        /* 104: XCVR_RX_DIG->AGC_IDX2_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX2_GAIN_CFG,
+        /* 105: XCVR_RX_DIG->AGC_IDX2_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX2_GAIN_VAL,
+        /* 106: XCVR_RX_DIG->AGC_IDX2_THR */
+        XCVR_FOLDED_AGC_IDX2_THR,
+        /* 107: XCVR_RX_DIG->AGC_IDX3_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX3_GAIN_CFG,
+        /* 108: XCVR_RX_DIG->AGC_IDX3_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX3_GAIN_VAL,
+        /* 109: XCVR_RX_DIG->AGC_IDX3_THR */
+        XCVR_FOLDED_AGC_IDX3_THR,
+        /* 110: XCVR_RX_DIG->AGC_IDX4_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX4_GAIN_CFG,
+        /* 111: XCVR_RX_DIG->AGC_IDX4_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX4_GAIN_VAL,
+        /* 112: XCVR_RX_DIG->AGC_IDX4_THR */
+        XCVR_FOLDED_AGC_IDX4_THR,
+        /* 113: XCVR_RX_DIG->AGC_IDX5_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX5_GAIN_CFG,
+        /* 114: XCVR_RX_DIG->AGC_IDX5_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX5_GAIN_VAL,
+        /* 115: XCVR_RX_DIG->AGC_IDX5_THR */
+        XCVR_FOLDED_AGC_IDX5_THR,
+        /* 116: XCVR_RX_DIG->AGC_IDX6_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX6_GAIN_CFG,
+        /* 117: XCVR_RX_DIG->AGC_IDX6_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX6_GAIN_VAL,
+        /* 118: XCVR_RX_DIG->AGC_IDX6_THR */
+        XCVR_FOLDED_AGC_IDX6_THR,
+        /* 119: XCVR_RX_DIG->AGC_IDX7_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX7_GAIN_CFG,
+        /* 120: XCVR_RX_DIG->AGC_IDX7_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX7_GAIN_VAL,
+        /* 121: XCVR_RX_DIG->AGC_IDX7_THR */
+        XCVR_FOLDED_AGC_IDX7_THR,
+        /* 122: XCVR_RX_DIG->AGC_IDX8_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX8_GAIN_CFG,
+        /* 123: XCVR_RX_DIG->AGC_IDX8_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX8_GAIN_VAL,
+        /* 124: XCVR_RX_DIG->AGC_IDX8_THR */
+        XCVR_FOLDED_AGC_IDX8_THR,
+        /* 125: XCVR_RX_DIG->AGC_IDX9_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX9_GAIN_CFG,
+        /* 126: XCVR_RX_DIG->AGC_IDX9_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX9_GAIN_VAL,
+        /* 127: XCVR_RX_DIG->AGC_IDX9_THR */
+        XCVR_FOLDED_AGC_IDX9_THR,
+        /* 128: XCVR_RX_DIG->AGC_MIS_GAIN_CFG */
+        XCVR_FOLDED_AGC_MIS_GAIN_CFG,
+        /* 129: XCVR_RX_DIG->AGC_THR_FAST */
+        XCVR_FOLDED_AGC_THR_FAST,
+        /* 130: XCVR_RX_DIG->AGC_THR_FAST_DRS */
+        XCVR_FOLDED_AGC_THR_FAST_DRS,
+        /* 131: XCVR_RX_DIG->AGC_THR_MIS */
+        XCVR_FOLDED_AGC_THR_MIS,
+        /* 132: XCVR_RX_DIG->AGC_TIMING0 */
+        XCVR_FOLDED_AGC_TIMING0 | XCVR_RX_DIG_AGC_TIMING0_AGC_GAIN_STEP_WAIT(0x10),
+        /* 133: XCVR_RX_DIG->AGC_TIMING0_DRS */
+        XCVR_FOLDED_AGC_TIMING0_DRS | XCVR_RX_DIG_AGC_TIMING0_DRS_AGC_GAIN_STEP_WAIT(0x10),
+        /* 134: XCVR_RX_DIG->AGC_TIMING1 */
+        XCVR_FOLDED_AGC_TIMING1 | XCVR_RX_DIG_AGC_TIMING1_AGC_FREEZE_TIMEOUT(0x0A) |
+            XCVR_RX_DIG_AGC_TIMING1_AGC_HOLD_TIMEOUT(0x08),
+        /* 135: XCVR_RX_DIG->AGC_TIMING1_DRS */
+        XCVR_RX_DIG_AGC_TIMING1_DRS_AGC_FREEZE_TIMEOUT(0x0A) | XCVR_RX_DIG_AGC_TIMING1_DRS_AGC_HOLD_TIMEOUT(0x08),
+        /* 136: XCVR_RX_DIG->AGC_TIMING2 */
+        XCVR_FOLDED_AGC_TIMING2 | XCVR_RX_DIG_AGC_TIMING2_AGC_UNFREEZE_FEAT_TIMEOUT(0x000) |
+            XCVR_RX_DIG_AGC_TIMING2_AGC_UNHOLD_FEAT_TIMEOUT(0x000),
+        /* 137: XCVR_RX_DIG->AGC_TIMING2_DRS */
+        XCVR_RX_DIG_AGC_TIMING2_DRS_AGC_UNFREEZE_FEAT_TIMEOUT(0x000) |
+            XCVR_RX_DIG_AGC_TIMING2_DRS_AGC_UNHOLD_FEAT_TIMEOUT(0x000),
+        /* 138: XCVR_RX_DIG->CTRL0 */
+#if RF_OSC_26MHZ == 1
+        XCVR_FOLDED_CTRL0 | XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(2) |
+            XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x03B) |
+            XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(1) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#else
+        XCVR_FOLDED_CTRL0 | XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(3) |
+            XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x030) |
+            XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(1) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 139: XCVR_RX_DIG->CTRL0_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(3) |
+            XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x027),
+#else
+        XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(4) |
+            XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x020),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 140: XCVR_RX_DIG->CTRL1 */
+        XCVR_FOLDED_CTRL1,
+        /* 141: XCVR_RX_DIG->DCOC_CTRL0 */
+        XCVR_FOLDED_DCOC_CTRL0 | XCVR_RX_DIG_DCOC_CTRL0_DCOC_DAC_ORDER(1) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFII(0x6) |
+            XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFIIP(1) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFQQ(0x5) |
+            XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFQQP(1),
+        /* 142: XCVR_RX_DIG->DCOC_CTRL0_DRS */
+        XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFII(6) | XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFIIP(1) |
+            XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFQQ(5) | XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFQQP(1),
+        /* 143: XCVR_RX_DIG->DCOC_CTRL1 */
+        XCVR_FOLDED_DCOC_CTRL1,
+        /* 144: XCVR_RX_DIG->DEMOD_FILT_0_1 */
+        XCVR_RX_DIG_DEMOD_FILT_0_1_H0(0x002) | XCVR_RX_DIG_DEMOD_FILT_0_1_H1(0x1F6),
+        /* 145: XCVR_RX_DIG->DEMOD_FILT_0_1_DRS */
+        XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H0(0x001) | XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H1(0x1F5),
+        /* 146: XCVR_RX_DIG->DEMOD_FILT_2_4 */
+        XCVR_RX_DIG_DEMOD_FILT_2_4_H2(0x3F3) | XCVR_RX_DIG_DEMOD_FILT_2_4_H3(0x08A) |
+            XCVR_RX_DIG_DEMOD_FILT_2_4_H4(0x116),
+        /* 147: XCVR_RX_DIG->DEMOD_FILT_2_4_DRS */
+        XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H2(0x3F6) | XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H3(0x08B) |
+            XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H4(0x110),
+        /* 148: XCVR_RX_DIG->NB_RSSI_CTRL0 */
+        XCVR_FOLDED_NB_RSSI_CTRL0,
+        /* 149: XCVR_RX_DIG->NB_RSSI_CTRL1 */
+        XCVR_FOLDED_NB_RSSI_CTRL1,
+        /* 150: XCVR_RX_DIG->RCCAL_CTRL0 */
+        XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE(2) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE_DRS(3) |
+            XCVR_RX_DIG_RCCAL_CTRL0_CBPF_CCODE_OFFSET(0x00) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE(0) |
+            XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE_DRS(1) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CMPOUT_INV(0) |
+            XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CODE_OFFSET(0x0) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_SMPL_DLY(0),
+        /* 151: XCVR_RX_DIG->RSSI_GLOBAL_CTRL */
+        XCVR_FOLDED_RSSI_GLOBAL_CTRL | XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_CCA1_ED_EN(0),
+        /* 152: XCVR_RX_DIG->WB_RSSI_CTRL */
+        XCVR_FOLDED_WB_RSSI_CTRL,
+        /* 153: XCVR_TSM->CTRL */
+        XCVR_FOLDED_CTRL,
+        /* 154: XCVR_TSM->END_OF_SEQ */
+        XCVR_FOLDED_END_OF_SEQ,
+        /* 155: XCVR_TSM->FAST_CTRL1 */
+        XCVR_FOLDED_FAST_CTRL1,
+        /* 156: XCVR_TSM->FAST_CTRL2 */
+        XCVR_FOLDED_FAST_CTRL2,
+        /* 157: XCVR_TSM->FAST_CTRL3 */
+        XCVR_FOLDED_FAST_CTRL3,
+        /* 158: XCVR_TSM->RECYCLE_COUNT */
+        XCVR_FOLDED_RECYCLE_COUNT,
+        /* 159: XCVR_TSM->TIMING00 */
+        XCVR_FOLDED_TIMING00,
+        /* 160: XCVR_TSM->TIMING01 */
+        XCVR_FOLDED_TIMING01,
+        /* 161: XCVR_TSM->TIMING02 */
+        XCVR_FOLDED_TIMING02,
+        /* 162: XCVR_TSM->TIMING03 */
+        XCVR_FOLDED_TIMING03,
+        /* 163: XCVR_TSM->TIMING04 */
+        XCVR_FOLDED_TIMING04,
+        /* 164: XCVR_TSM->TIMING05 */
+        XCVR_FOLDED_TIMING05,
+        /* 165: XCVR_TSM->TIMING06 */
+        XCVR_FOLDED_TIMING06,
+        /* 166: XCVR_TSM->TIMING07 */
+        XCVR_FOLDED_TIMING07,
+        /* 167: XCVR_TSM->TIMING08 */
+        XCVR_FOLDED_TIMING08,
+        /* 168: XCVR_TSM->TIMING09 */
+        XCVR_FOLDED_TIMING09,
+        /* 169: XCVR_TSM->TIMING10 */
+        XCVR_FOLDED_TIMING10,
+        /* 170: XCVR_TSM->TIMING11 */
+        XCVR_FOLDED_TIMING11,
+        /* 171: XCVR_TSM->TIMING12 */
+        XCVR_FOLDED_TIMING12,
+        /* 172: XCVR_TSM->TIMING13 */
+        XCVR_FOLDED_TIMING13,
+        /* 173: XCVR_TSM->TIMING14 */
+        XCVR_FOLDED_TIMING14,
+        /* 174: XCVR_TSM->TIMING15 */
+        XCVR_FOLDED_TIMING15,
+        /* 175: XCVR_TSM->TIMING16 */
+        XCVR_FOLDED_TIMING16,
+        /* 176: XCVR_TSM->TIMING17 */
+        XCVR_FOLDED_TIMING17,
+        /* 177: XCVR_TSM->TIMING18 */
+        XCVR_FOLDED_TIMING18,
+        /* 178: XCVR_TSM->TIMING19 */
+        XCVR_FOLDED_TIMING19,
+        /* 179: XCVR_TSM->TIMING20 */
+        XCVR_FOLDED_TIMING20,
+        /* 180: XCVR_TSM->TIMING21 */
+        XCVR_FOLDED_TIMING21,
+        /* 181: XCVR_TSM->TIMING22 */
+        XCVR_FOLDED_TIMING22,
+        /* 182: XCVR_TSM->TIMING23 */
+        XCVR_FOLDED_TIMING23,
+        /* 183: XCVR_TSM->TIMING24 */
+        XCVR_FOLDED_TIMING24,
+        /* 184: XCVR_TSM->TIMING25 */
+        XCVR_FOLDED_TIMING25,
+        /* 185: XCVR_TSM->TIMING26 */
+        XCVR_FOLDED_TIMING26,
+        /* 186: XCVR_TSM->TIMING27 */
+        XCVR_FOLDED_TIMING27,
+        /* 187: XCVR_TSM->TIMING28 */
+        XCVR_FOLDED_TIMING28,
+        /* 188: XCVR_TSM->TIMING29 */
+        XCVR_FOLDED_TIMING29,
+        /* 189: XCVR_TSM->TIMING30 */
+        XCVR_FOLDED_TIMING30,
+        /* 190: XCVR_TSM->TIMING31 */
+        XCVR_FOLDED_TIMING31,
+        /* 191: XCVR_TSM->TIMING32 */
+        XCVR_FOLDED_TIMING32,
+        /* 192: XCVR_TSM->TIMING33 */
+        XCVR_FOLDED_TIMING33,
+        /* 193: XCVR_TSM->TIMING34 */
+        XCVR_FOLDED_TIMING34,
+        /* 194: XCVR_TSM->TIMING35 */
+        XCVR_FOLDED_TIMING35,
+        /* 195: XCVR_TSM->TIMING36 */
+        XCVR_FOLDED_TIMING36,
+        /* 196: XCVR_TSM->TIMING37 */
+        XCVR_FOLDED_TIMING37,
+        /* 197: XCVR_TSM->TIMING38 */
+        XCVR_FOLDED_TIMING38,
+        /* 198: XCVR_TSM->TIMING39 */
+        XCVR_FOLDED_TIMING39,
+        /* 199: XCVR_TSM->TIMING40 */
+        XCVR_FOLDED_TIMING40,
+        /* 200: XCVR_TSM->TIMING41 */
+        XCVR_FOLDED_TIMING41,
+        /* 201: XCVR_TSM->TIMING42 */
+        XCVR_FOLDED_TIMING42,
+        /* 202: XCVR_TSM->TIMING43 */
+        XCVR_FOLDED_TIMING43,
+        /* 203: XCVR_TSM->TIMING44 */
+        XCVR_FOLDED_TIMING44,
+        /* 204: XCVR_TSM->TIMING45 */
+        XCVR_FOLDED_TIMING45,
+        /* 205: XCVR_TSM->TIMING46 */
+        XCVR_FOLDED_TIMING46,
+        /* 206: XCVR_TSM->TIMING47 */
+        XCVR_FOLDED_TIMING47,
+        /* 207: XCVR_TSM->TIMING48 */
+        XCVR_FOLDED_TIMING48,
+        /* 208: XCVR_TSM->TIMING49 */
+        XCVR_FOLDED_TIMING49,
+        /* 209: XCVR_TSM->TIMING50 */
+        XCVR_FOLDED_TIMING50,
+        /* 210: XCVR_TSM->TIMING51 */
+        XCVR_FOLDED_TIMING51,
+        /* 211: XCVR_TSM->TIMING52 */
+        XCVR_FOLDED_TIMING52,
+        /* 212: XCVR_TSM->WU_LATENCY */
+        XCVR_FOLDED_WU_LATENCY,
+        /* 213: XCVR_TX_DIG->DATARATE_CONFIG_FILTER_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(2) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(2) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(1),
+#else
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(3) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(2) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(1),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 214: XCVR_TX_DIG->DATARATE_CONFIG_FSK_CTRL */
+        XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV0(0x0000) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV1(0x0000),
+        /* 215: XCVR_TX_DIG->DATARATE_CONFIG_GFSK_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x04F2),
+#else
+        XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x0406),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 216: XCVR_TX_DIG->DATA_PADDING_CTRL */
+        XCVR_FOLDED_DATA_PADDING_CTRL | XCVR_TX_DIG_DATA_PADDING_CTRL_DATA_PADDING_SEL(0) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_PAD_DLY(0) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_PAD_DLY_EN(1),
+        /* 217: XCVR_TX_DIG->DATA_PADDING_CTRL_1 */
+        XCVR_FOLDED_DATA_PADDING_CTRL_1 | XCVR_TX_DIG_DATA_PADDING_CTRL_1_RAMP_UP_DLY(0x04) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_1_TX_DATA_FLUSH_DLY(0x04),
+        /* 218: XCVR_TX_DIG->DATA_PADDING_CTRL_2 */
+        XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_MFDEV(0x1800) | XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_PFDEV(0x0800),
+        /* 219: XCVR_TX_DIG->FSK_CTRL */
+        XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_0(0x1800) | XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_1(0x0800),
+        /* 220: XCVR_TX_DIG->GFSK_COEFF_0_1 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_0(0x017) | XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_1(0x029),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_0(0x001) | XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_1(0x004),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 221: XCVR_TX_DIG->GFSK_COEFF_2_3 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_2(0x044) | XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_3(0x067),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_2(0x00D) | XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_3(0x028),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 222: XCVR_TX_DIG->GFSK_COEFF_4_5 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_4(0x090) | XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_5(0x0BA),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_4(0x063) | XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_5(0x0C0),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 223: XCVR_TX_DIG->GFSK_COEFF_6_7 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_6(0x0DC) | XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_7(0x0EF),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_6(0x12C) | XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_7(0x176),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 224: XCVR_TX_DIG->GFSK_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(0) |
+            XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x09E8),
+#else
+        XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(0) |
+            XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x080C),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 225: XCVR_TX_DIG->IMAGE_FILTER_CTRL */
+        XCVR_FOLDED_IMAGE_FILTER_CTRL | XCVR_TX_DIG_IMAGE_FILTER_CTRL_IMAGE_FILTER_OVRD_EN(0),
+        /* 226: XCVR_TX_DIG->PA_CTRL */
+        XCVR_FOLDED_PA_CTRL | XCVR_TX_DIG_PA_CTRL_PA_RAMP_SEL(1),
+        /* 227: XCVR_TX_DIG->PA_RAMP_TBL0 */
+        XCVR_FOLDED_PA_RAMP_TBL0,
+        /* 228: XCVR_TX_DIG->PA_RAMP_TBL1 */
+        XCVR_FOLDED_PA_RAMP_TBL1,
+        /* 229: XCVR_TX_DIG->PA_RAMP_TBL2 */
+        XCVR_FOLDED_PA_RAMP_TBL2,
+        /* 230: XCVR_TX_DIG->PA_RAMP_TBL3 */
+        XCVR_FOLDED_PA_RAMP_TBL3,
+        /* 231: XCVR_TX_DIG->SWITCH_TX_CTRL */
+        XCVR_FOLDED_SWITCH_TX_CTRL,
+        /* 232: XCVR_TX_DIG->TXDIG_CTRL */
+        XCVR_FOLDED_TXDIG_CTRL | XCVR_TX_DIG_TXDIG_CTRL_DATA_STREAM_SEL(0) | XCVR_TX_DIG_TXDIG_CTRL_MODULATOR_SEL(0) |
+            XCVR_TX_DIG_TXDIG_CTRL_PFC_EN(0),
+    },
+};
+
+const xcvr_folded_config_t xcvr_gfsk_bt_0p5_h_1p0_250kbps_folded_config = {
+    .config     = &xcvr_gfsk_bt_0p5_h_1p0_250kbps_full_config,
+    .reg_values = {
+        /* 0: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x28) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x20) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x18) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x10) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x08),
+        /* 1: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x38) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x30) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x28) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x20),
+        /* 2: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x18) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x10) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x08),
+        /* 3: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x28) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x20) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x18) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x10) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x08),
+        /* 4: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x38) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x30) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x28) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x30),
+        /* 5: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x38) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x08),
+        /* 6: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x18) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x10) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x08) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x38),
+        /* 7: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x08) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x10) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x18) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x10),
+        /* 8: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x08) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x38),
+        /* 9: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x18) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x10) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x08) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x38),
+        /* 10: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x08) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x10) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x18) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x20),
+        /* 11: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x28) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x30) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x38),
+        /* 12: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x28) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x30) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x38) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x08),
+        /* 13: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x38) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x30) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x28) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x20),
+        /* 14: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x18) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x10) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x08),
+        /* 15: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x28) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x30) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x38) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x08),
+        /* 16: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x38) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x30) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x28) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x30),
+        /* 17: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x38) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x08),
+        /* 18: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x18) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x20) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x28) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x30) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x38),
+        /* 19: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x08) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x10) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x18) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x10),
+        /* 20: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x08) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x38),
+        /* 21: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x18) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x20) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x28) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x30) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x38),
+        /* 22: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x08) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x10) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x18) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x20),
+        /* 23: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x28) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x30) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x38),
+        /* 24: GEN4PHY->DMD_CTRL0 */
+        XCVR_FOLDED_DMD_CTRL0,
+        /* 25: GEN4PHY->DMD_CTRL1 */
+        XCVR_FOLDED_DMD_CTRL1,
+        /* 26: GEN4PHY->FSK_CFG0 */
+        XCVR_FOLDED_FSK_CFG0 | GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_1M(0x13) |
+            GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_2M(0x11) |
+            GEN4PHY_FSK_CFG0_MSK2FSK_SEED(0) | GEN4PHY_FSK_CFG0_MSK_EN(0),
+        /* 27: GEN4PHY->FSK_CFG1 */
+        GEN4PHY_FSK_CFG1_OVERH(0x040) | GEN4PHY_FSK_CFG1_OVERH_INV(0x080) | GEN4PHY_FSK_CFG1_SYNCTSCALE(0xF),
+        /* 28: GEN4PHY->FSK_CFG2 */
+        XCVR_FOLDED_FSK_CFG2,
+        /* 29: GEN4PHY->FSK_FAD_CFG */
+        XCVR_FOLDED_FSK_FAD_CFG,
+        /* 30: GEN4PHY->FSK_FAD_CTRL */
+        XCVR_FOLDED_FSK_FAD_CTRL,
+        /* 31: GEN4PHY->FSK_PD_CFG0 */
+        GEN4PHY_FSK_PD_CFG0_PD_IIR_ALPHA(0xFF) | GEN4PHY_FSK_PD_CFG0_PREAMBLE_T_SCALE(0xC),
+        /* 32: GEN4PHY->FSK_PD_CFG1 */
+        GEN4PHY_FSK_PD_CFG1_PREAMBLE_PATTERN(0x55),
+        /* 33: GEN4PHY->FSK_PD_CFG2 */
+        GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_1M(0xD7) | GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_2M(0xEB),
+        /* 34: GEN4PHY->FSK_PD_PH[0] */
+        GEN4PHY_FSK_PD_PH_REF0(0x07) | GEN4PHY_FSK_PD_PH_REF1(0x0A) | GEN4PHY_FSK_PD_PH_REF2(0x07) |
+            GEN4PHY_FSK_PD_PH_REF3(0x00),
+        /* 35: GEN4PHY->FSK_PD_PH[1] */
+        GEN4PHY_FSK_PD_PH_REF0(0x39) | GEN4PHY_FSK_PD_PH_REF1(0x36) | GEN4PHY_FSK_PD_PH_REF2(0x39) |
+            GEN4PHY_FSK_PD_PH_REF3(0x00),
+        /* 36: GEN4PHY->FSK_PT */
+        XCVR_FOLDED_FSK_PT | GEN4PHY_FSK_PT_AGC_TIMEOUT(0x0048),
+        /* 37: GEN4PHY->LR_AA_CFG */
+        GEN4PHY_LR_AA_CFG_AA_COR_THRESH(0x00) | GEN4PHY_LR_AA_CFG_AA_HAM_THRESH(0x00) |
+            GEN4PHY_LR_AA_CFG_AA_LR_CORR_GAIN(0x00) | GEN4PHY_LR_AA_CFG_ACCESS_ADDR_HAM(0x00),
+        /* 38: GEN4PHY->LR_PD_CFG */
+        GEN4PHY_LR_PD_CFG_CORR_TH(0x00) | GEN4PHY_LR_PD_CFG_FREQ_TH(0x00) | GEN4PHY_LR_PD_CFG_NO_PEAKS(0),
+        /* 39: GEN4PHY->LR_PD_PH[0] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 40: GEN4PHY->LR_PD_PH[1] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 41: GEN4PHY->LR_PD_PH[2] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 42: GEN4PHY->LR_PD_PH[3] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 43: GEN4PHY->MISC */
+        XCVR_FOLDED_MISC,
+        /* 44: GEN4PHY->PREPHY_MISC */
+        XCVR_FOLDED_PREPHY_MISC,
+        /* 45: GEN4PHY->RTT_CTRL */
+        XCVR_FOLDED_RTT_CTRL,
+        /* 46: GEN4PHY->RTT_REF */
+        GEN4PHY_RTT_REF_FM_REF_010(0x48) | GEN4PHY_RTT_REF_FM_REF_110(0x63) | GEN4PHY_RTT_REF_FM_REF_111(0x80),
+        /* 47: GEN4PHY->SM_CFG */
+        XCVR_FOLDED_SM_CFG | GEN4PHY_SM_CFG_AA_TIMEOUT_UNCODED(0x0A0),
+        /* 48: RADIO_CTRL->LL_CTRL */
+        RADIO_CTRL_LL_CTRL_ACTIVE_LL(2),
+        /* 49: XCVR_ANALOG->LDO_0 */
+        XCVR_FOLDED_LDO_0,
+        /* 50: XCVR_ANALOG->LDO_1 */
+        XCVR_FOLDED_LDO_1,
+        /* 51: XCVR_ANALOG->PLL */
+        XCVR_FOLDED_PLL,
+        /* 52: XCVR_ANALOG->RX_0 */
+        XCVR_FOLDED_RX_0,
+        /* 53: XCVR_ANALOG->RX_1 */
+        XCVR_FOLDED_RX_1,
+        /* 54: XCVR_ANALOG->TX_DAC_PA */
+        XCVR_FOLDED_TX_DAC_PA | XCVR_ANALOG_TX_DAC_PA_DAC_TRIM_CFBK_DRS(1),
+        /* 55: XCVR_ANALOG->XO_DIST */
+        XCVR_FOLDED_XO_DIST,
+        /* 56: XCVR_MISC->IPS_FO_ADDR[0] */
+        XCVR_MISC_IPS_FO_ADDR_ADDR(0x370) | XCVR_MISC_IPS_FO_ADDR_ENTRY_RX(0) | XCVR_MISC_IPS_FO_ADDR_ENTRY_TX(0),
+        /* 57: XCVR_MISC->IPS_FO_ADDR[1] */
+        XCVR_MISC_IPS_FO_ADDR_ADDR(0x02C) | XCVR_MISC_IPS_FO_ADDR_ENTRY_RX(0) | XCVR_MISC_IPS_FO_ADDR_ENTRY_TX(0),
+        /* 58: XCVR_MISC->IPS_FO_DRS0_DATA[0] */
+        XCVR_MISC_IPS_FO_DRS0_DATA_DRS0_DATA(0x00000000),
+        /* 59: XCVR_MISC->IPS_FO_DRS0_DATA[1] */
+        XCVR_MISC_IPS_FO_DRS0_DATA_DRS0_DATA(0x00000000),
+        /* 60: XCVR_MISC->IPS_FO_DRS1_DATA[0] */
+        XCVR_MISC_IPS_FO_DRS1_DATA_DRS1_DATA(0x00000000),
+        /* 61: XCVR_MISC->IPS_FO_DRS1_DATA[1] */
+        XCVR_MISC_IPS_FO_DRS1_DATA_DRS1_DATA(0x00000000),
+        /* 62: XCVR_MISC->LDO_TRIM_0 */
+        XCVR_FOLDED_LDO_TRIM_0,
+        /* 63: XCVR_MISC->LDO_TRIM_1 */
+        XCVR_FOLDED_LDO_TRIM_1,
+        /* 64: XCVR_MISC->XCVR_CTRL */
+        XCVR_FOLDED_XCVR_CTRL | XCVR_MISC_XCVR_CTRL_DATA_RATE_DRS(3) | XCVR_MISC_XCVR_CTRL_DEMOD_SEL(1) |
+            XCVR_MISC_XCVR_CTRL_LL_CFG_CAPT_DIS(0),
+        /* 65: XCVR_PLL_DIG->CHAN_MAP */
+        XCVR_FOLDED_CHAN_MAP | XCVR_PLL_DIG_CHAN_MAP_BAND_SELECT(0),
+        /* 66: XCVR_PLL_DIG->CHAN_MAP_EXT */
+#if RF_OSC_26MHZ == 1
+        XCVR_FOLDED_CHAN_MAP_EXT | XCVR_PLL_DIG_CHAN_MAP_EXT_NUM_OFFSET(0x013B13B),
+#else
+        XCVR_FOLDED_CHAN_MAP_EXT | XCVR_PLL_DIG_CHAN_MAP_EXT_NUM_OFFSET(0x0100000),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 67: XCVR_PLL_DIG->DATA_RATE_OVRD_CTRL1 */
+        XCVR_FOLDED_DATA_RATE_OVRD_CTRL1,
+        /* 68: XCVR_PLL_DIG->DATA_RATE_OVRD_CTRL2 */
+#if RF_OSC_26MHZ == 1
+        XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL2_NUM_OFFSET_CFG1(0x013B13B),
+#else
+        XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL2_NUM_OFFSET_CFG1(0x0100000),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 69: XCVR_PLL_DIG->DELAY_MATCH */
+        XCVR_FOLDED_DELAY_MATCH | XCVR_PLL_DIG_DELAY_MATCH_HPM_INTEGER_DELAY(0x04) |
+            XCVR_PLL_DIG_DELAY_MATCH_LPM_SDM_DELAY(0x03),
+        /* 70: XCVR_PLL_DIG->HPMCAL_CTRL */
+        XCVR_FOLDED_HPMCAL_CTRL | XCVR_PLL_DIG_HPMCAL_CTRL_HPM_CAL_ARRAY_SIZE(0),
+        /* 71: XCVR_PLL_DIG->HPM_BUMP */
+        XCVR_FOLDED_HPM_BUMP | XCVR_PLL_DIG_HPM_BUMP_HPM_VCM_CAL(2) | XCVR_PLL_DIG_HPM_BUMP_HPM_VCM_TX(2),
+        /* 72: XCVR_PLL_DIG->HPM_CAL_TIMING */
+        XCVR_FOLDED_HPM_CAL_TIMING,
+        /* 73: XCVR_PLL_DIG->HPM_CTRL */
+        XCVR_FOLDED_HPM_CTRL,
+        /* 74: XCVR_PLL_DIG->HPM_SDM_RES */
+        XCVR_FOLDED_HPM_SDM_RES | XCVR_PLL_DIG_HPM_SDM_RES_HPM_COUNT_ADJUST(0x02),
+        /* 75: XCVR_PLL_DIG->LOCK_DETECT */
+        XCVR_FOLDED_LOCK_DETECT,
+        /* 76: XCVR_PLL_DIG->LPM_CTRL */
+        XCVR_FOLDED_LPM_CTRL,
+        /* 77: XCVR_PLL_DIG->LPM_SDM_CTRL1 */
+        XCVR_FOLDED_LPM_SDM_CTRL1,
+        /* 78: XCVR_PLL_DIG->MOD_CTRL */
+        XCVR_FOLDED_MOD_CTRL,
+        /* 79: XCVR_PLL_DIG->PLL_DATARATE_CTRL */
+        XCVR_FOLDED_PLL_DATARATE_CTRL,
+        /* 80: XCVR_PLL_DIG->TUNING_CAP_RX_CTRL */
+        XCVR_FOLDED_TUNING_CAP_RX_CTRL,
+        /* 81: XCVR_PLL_DIG->TUNING_CAP_TX_CTRL */
+        XCVR_FOLDED_TUNING_CAP_TX_CTRL,
+        /* 82: XCVR_RX_DIG->ACQ_FILT_0_3 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x03) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x00) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x78) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x77),
+#else
+        XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x03) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x01) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x76) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x03),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 83: XCVR_RX_DIG->ACQ_FILT_0_3_DRS */
+        XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H0(0x00) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H1(0x00) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H2(0x00) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H3(0x00),
+        /* 84: XCVR_RX_DIG->ACQ_FILT_10_11 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x066) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x0C9),
+#else
+        XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x3FA) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x140),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 85: XCVR_RX_DIG->ACQ_FILT_10_11_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x05B) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x0E8),
+#else
+        XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x3A8) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x164),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 86: XCVR_RX_DIG->ACQ_FILT_4_7 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x06) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x1A) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_H6(0x11) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0xE7),
+#else
+        XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x15) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x6D) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_H6(0xE2) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0x36),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 87: XCVR_RX_DIG->ACQ_FILT_4_7_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x7D) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x06) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0x12) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0xFD),
+#else
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x7D) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x0A) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0xF9) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0xEB),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 88: XCVR_RX_DIG->ACQ_FILT_8_9 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x1CA) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x1F5),
+#else
+        XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x01F) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x18F),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 89: XCVR_RX_DIG->ACQ_FILT_8_9_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x1CF) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x1DD),
+#else
+        XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x03E) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x1CC),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 90: XCVR_RX_DIG->AGC_CTRL */
+        XCVR_FOLDED_AGC_CTRL,
+        /* 91: XCVR_RX_DIG->AGC_CTRL_STAT */
+        XCVR_FOLDED_AGC_CTRL_STAT,
+        /* 92: XCVR_RX_DIG->AGC_IDX0_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX0_GAIN_CFG,
+        /* 93: XCVR_RX_DIG->AGC_IDX0_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX0_GAIN_VAL,
+        /* 94: XCVR_RX_DIG->AGC_IDX0_THR */
+        XCVR_FOLDED_AGC_IDX0_THR,
+        /* 95: XCVR_RX_DIG->AGC_IDX10_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX10_GAIN_CFG,
+        /* 96: XCVR_RX_DIG->AGC_IDX10_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX10_GAIN_VAL,
+        /* 97: XCVR_RX_DIG->AGC_IDX10_THR */
+        XCVR_FOLDED_AGC_IDX10_THR,
+        /* 98: XCVR_RX_DIG->AGC_IDX11_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX11_GAIN_CFG | XCVR_RX_DIG_AGC_IDX11_GAIN_CFG_MAG_THR_11_DRS_OFS(0x00) |
+            XCVR_RX_DIG_AGC_IDX11_GAIN_CFG_MAG_THR_HI_11_DRS_OFS(0x00),
+        /* 99: XCVR_RX_DIG->AGC_IDX11_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX11_GAIN_VAL | XCVR_RX_DIG_AGC_IDX11_GAIN_VAL_MAG_THR_11(0x000) |
+            XCVR_RX_DIG_AGC_IDX11_GAIN_VAL_MAG_THR_HI_11(0x000),
+        /* 100: XCVR_RX_DIG->AGC_IDX11_THR */
+        XCVR_FOLDED_AGC_IDX11_THR,
+        /* 101: XCVR_RX_DIG->AGC_IDX1_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX1_GAIN_CFG,
+        /* 102: XCVR_RX_DIG->AGC_IDX1_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX1_GAIN_VAL,
+        /* 103: XCVR_RX_DIG->AGC_IDX1_THR */
+        XCVR_FOLDED_AGC_IDX1_THR,
+        /* 104: XCVR_RX_DIG->AGC_IDX2_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX2_GAIN_CFG,
+        /* 105: XCVR_RX_DIG->AGC_IDX2_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX2_GAIN_VAL,
+        /* 106: XCVR_RX_DIG->AGC_IDX2_THR */
+        XCVR_FOLDED_AGC_IDX2_THR,
+        /* 107: XCVR_RX_DIG->AGC_IDX3_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX3_GAIN_CFG,
+        /* 108: XCVR_RX_DIG->AGC_IDX3_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX3_GAIN_VAL,
+        /* 109: XCVR_RX_DIG->AGC_IDX3_THR */
+        XCVR_FOLDED_AGC_IDX3_THR,
+        /* 110: XCVR_RX_DIG->AGC_IDX4_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX4_GAIN_CFG,
+        /* 111: XCVR_RX_DIG->AGC_IDX4_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX4_GAIN_VAL,
+        /* 112: XCVR_RX_DIG->AGC_IDX4_THR */
+        XCVR_FOLDED_AGC_IDX4_THR,
+        /* 113: XCVR_RX_DIG->AGC_IDX5_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX5_GAIN_CFG,
+        /* 114: XCVR_RX_DIG->AGC_IDX5_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX5_GAIN_VAL,
+        /* 115: XCVR_RX_DIG->AGC_IDX5_THR */
+        XCVR_FOLDED_AGC_IDX5_THR,
+        /* 116: XCVR_RX_DIG->AGC_IDX6_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX6_GAIN_CFG,
+        /* 117: XCVR_RX_DIG->AGC_IDX6_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX6_GAIN_VAL,
+        /* 118: XCVR_RX_DIG->AGC_IDX6_THR */
+        XCVR_FOLDED_AGC_IDX6_THR,
+        /* 119: XCVR_RX_DIG->AGC_IDX7_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX7_GAIN_CFG,
+        /* 120: XCVR_RX_DIG->AGC_IDX7_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX7_GAIN_VAL,
+        /* 121: XCVR_RX_DIG->AGC_IDX7_THR */
+        XCVR_FOLDED_AGC_IDX7_THR,
+        /* 122: XCVR_RX_DIG->AGC_IDX8_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX8_GAIN_CFG,
+        /* 123: XCVR_RX_DIG->AGC_IDX8_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX8_GAIN_VAL,
+        /* 124: XCVR_RX_DIG->AGC_IDX8_THR */
+        XCVR_FOLDED_AGC_IDX8_THR,
+        /* 125: XCVR_RX_DIG->AGC_IDX9_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX9_GAIN_CFG,
+        /* 126: XCVR_RX_DIG->AGC_IDX9_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX9_GAIN_VAL,
+        /* 127: XCVR_RX_DIG->AGC_IDX9_THR */
+        XCVR_FOLDED_AGC_IDX9_THR,
+        /* 128: XCVR_RX_DIG->AGC_MIS_GAIN_CFG */
+        XCVR_FOLDED_AGC_MIS_GAIN_CFG,
+        /* 129: XCVR_RX_DIG->AGC_THR_FAST */
+        XCVR_FOLDED_AGC_THR_FAST,
+        /* 130: XCVR_RX_DIG->AGC_THR_FAST_DRS */
+        XCVR_FOLDED_AGC_THR_FAST_DRS,
+        /* 131: XCVR_RX_DIG->AGC_THR_MIS */
+        XCVR_FOLDED_AGC_THR_MIS,
+        /* 132: XCVR_RX_DIG->AGC_TIMING0 */
+        XCVR_FOLDED_AGC_TIMING0 | XCVR_RX_DIG_AGC_TIMING0_AGC_GAIN_STEP_WAIT(0x10),
+        /* 133: XCVR_RX_DIG->AGC_TIMING0_DRS */
+        XCVR_FOLDED_AGC_TIMING0_DRS | XCVR_RX_DIG_AGC_TIMING0_DRS_AGC_GAIN_STEP_WAIT(0x10),
+        /* 134: XCVR_RX_DIG->AGC_TIMING1 */
+        XCVR_FOLDED_AGC_TIMING1 | XCVR_RX_DIG_AGC_TIMING1_AGC_FREEZE_TIMEOUT(0x0A) |
+            XCVR_RX_DIG_AGC_TIMING1_AGC_HOLD_TIMEOUT(0x08),
+        /* 135: XCVR_RX_DIG->AGC_TIMING1_DRS */
+        XCVR_RX_DIG_AGC_TIMING1_DRS_AGC_FREEZE_TIMEOUT(0x0A) | XCVR_RX_DIG_AGC_TIMING1_DRS_AGC_HOLD_TIMEOUT(0x08),
+        /* 136: XCVR_RX_DIG->AGC_TIMING2 */
+        XCVR_FOLDED_AGC_TIMING2 | XCVR_RX_DIG_AGC_TIMING2_AGC_UNFREEZE_FEAT_TIMEOUT(0x000) |
+            XCVR_RX_DIG_AGC_TIMING2_AGC_UNHOLD_FEAT_TIMEOUT(0x000),
+        /* 137: XCVR_RX_DIG->AGC_TIMING2_DRS */
+        XCVR_RX_DIG_AGC_TIMING2_DRS_AGC_UNFREEZE_FEAT_TIMEOUT(0x000) |
+            XCVR_RX_DIG_AGC_TIMING2_DRS_AGC_UNHOLD_FEAT_TIMEOUT(0x000),
+        /* 138: XCVR_RX_DIG->CTRL0 */
+#if RF_OSC_26MHZ == 1
+        XCVR_FOLDED_CTRL0 | XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(2) |
+            XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x03B) |
+            XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(1) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#else
+        XCVR_FOLDED_CTRL0 | XCVR_RX_DIG_CTRL0_CIC_ORDER(1) | XCVR_RX_DIG_CTRL0_CIC_RATE(3) |
+            XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x030) |
+            XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(1) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 139: XCVR_RX_DIG->CTRL0_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(4) |
+            XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x027),
+#else
+        XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(1) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(5) |
+            XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x020),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 140: XCVR_RX_DIG->CTRL1 */
+        XCVR_FOLDED_CTRL1,
+        /* 141: XCVR_RX_DIG->DCOC_CTRL0 */
+        XCVR_FOLDED_DCOC_CTRL0 | XCVR_RX_DIG_DCOC_CTRL0_DCOC_DAC_ORDER(1) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFII(0x6) |
+            XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFIIP(1) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFQQ(0x5) |
+            XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFQQP(1),
+        /* 142: XCVR_RX_DIG->DCOC_CTRL0_DRS */
+        XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFII(6) | XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFIIP(1) |
+            XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFQQ(5) | XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFQQP(1),
+        /* 143: XCVR_RX_DIG->DCOC_CTRL1 */
+        XCVR_FOLDED_DCOC_CTRL1,
+        /* 144: XCVR_RX_DIG->DEMOD_FILT_0_1 */
+        XCVR_RX_DIG_DEMOD_FILT_0_1_H0(0x002) | XCVR_RX_DIG_DEMOD_FILT_0_1_H1(0x1F6),
+        /* 145: XCVR_RX_DIG->DEMOD_FILT_0_1_DRS */
+        XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H0(0x002) | XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H1(0x1F5),
+        /* 146: XCVR_RX_DIG->DEMOD_FILT_2_4 */
+        XCVR_RX_DIG_DEMOD_FILT_2_4_H2(0x3F3) | XCVR_RX_DIG_DEMOD_FILT_2_4_H3(0x08A) |
+            XCVR_RX_DIG_DEMOD_FILT_2_4_H4(0x116),
+        /* 147: XCVR_RX_DIG->DEMOD_FILT_2_4_DRS */
+        XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H2(0x3F5) | XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H3(0x08B) |
+            XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H4(0x112),
+        /* 148: XCVR_RX_DIG->NB_RSSI_CTRL0 */
+        XCVR_FOLDED_NB_RSSI_CTRL0,
+        /* 149: XCVR_RX_DIG->NB_RSSI_CTRL1 */
+        XCVR_FOLDED_NB_RSSI_CTRL1,
+        /* 150: XCVR_RX_DIG->RCCAL_CTRL0 */
+        XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE(2) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE_DRS(4) |
+            XCVR_RX_DIG_RCCAL_CTRL0_CBPF_CCODE_OFFSET(0x00) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE(0) |
+            XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE_DRS(1) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CMPOUT_INV(0) |
+            XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CODE_OFFSET(0x0) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_SMPL_DLY(0),
+        /* 151: XCVR_RX_DIG->RSSI_GLOBAL_CTRL */
+        XCVR_FOLDED_RSSI_GLOBAL_CTRL | XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_CCA1_ED_EN(0),
+        /* 152: XCVR_RX_DIG->WB_RSSI_CTRL */
+        XCVR_FOLDED_WB_RSSI_CTRL,
+        /* 153: XCVR_TSM->CTRL */
+        XCVR_FOLDED_CTRL,
+        /* 154: XCVR_TSM->END_OF_SEQ */
+        XCVR_FOLDED_END_OF_SEQ,
+        /* 155: XCVR_TSM->FAST_CTRL1 */
+        XCVR_FOLDED_FAST_CTRL1,
+        /* 156: XCVR_TSM->FAST_CTRL2 */
+        XCVR_FOLDED_FAST_CTRL2,
+        /* 157: XCVR_TSM->FAST_CTRL3 */
+        XCVR_FOLDED_FAST_CTRL3,
+        /* 158: XCVR_TSM->RECYCLE_COUNT */
+        XCVR_FOLDED_RECYCLE_COUNT,
+        /* 159: XCVR_TSM->TIMING00 */
+        XCVR_FOLDED_TIMING00,
+        /* 160: XCVR_TSM->TIMING01 */
+        XCVR_FOLDED_TIMING01,
+        /* 161: XCVR_TSM->TIMING02 */
+        XCVR_FOLDED_TIMING02,
+        /* 162: XCVR_TSM->TIMING03 */
+        XCVR_FOLDED_TIMING03,
+        /* 163: XCVR_TSM->TIMING04 */
+        XCVR_FOLDED_TIMING04,
+        /* 164: XCVR_TSM->TIMING05 */
+        XCVR_FOLDED_TIMING05,
+        /* 165: XCVR_TSM->TIMING06 */
+        XCVR_FOLDED_TIMING06,
+        /* 166: XCVR_TSM->TIMING07 */
+        XCVR_FOLDED_TIMING07,
+        /* 167: XCVR_TSM->TIMING08 */
+        XCVR_FOLDED_TIMING08,
+        /* 168: XCVR_TSM->TIMING09 */
+        XCVR_FOLDED_TIMING09,
+        /* 169: XCVR_TSM->TIMING10 */
+        XCVR_FOLDED_TIMING10,
+        /* 170: XCVR_TSM->TIMING11 */
+        XCVR_FOLDED_TIMING11,
+        /* 171: XCVR_TSM->TIMING12 */
+        XCVR_FOLDED_TIMING12,
+        /* 172: XCVR_TSM->TIMING13 */
+        XCVR_FOLDED_TIMING13,
+        /* 173: XCVR_TSM->TIMING14 */
+        XCVR_FOLDED_TIMING14,
+        /* 174: XCVR_TSM->TIMING15 */
+        XCVR_FOLDED_TIMING15,
+        /* 175: XCVR_TSM->TIMING16 */
+        XCVR_FOLDED_TIMING16,
+        /* 176: XCVR_TSM->TIMING17 */
+        XCVR_FOLDED_TIMING17,
+        /* 177: XCVR_TSM->TIMING18 */
+        XCVR_FOLDED_TIMING18,
+        /* 178: XCVR_TSM->TIMING19 */
+        XCVR_FOLDED_TIMING19,
+        /* 179: XCVR_TSM->TIMING20 */
+        XCVR_FOLDED_TIMING20,
+        /* 180: XCVR_TSM->TIMING21 */
+        XCVR_FOLDED_TIMING21,
+        /* 181: XCVR_TSM->TIMING22 */
+        XCVR_FOLDED_TIMING22,
+        /* 182: XCVR_TSM->TIMING23 */
+        XCVR_FOLDED_TIMING23,
+        /* 183: XCVR_TSM->TIMING24 */
+        XCVR_FOLDED_TIMING24,
+        /* 184: XCVR_TSM->TIMING25 */
+        XCVR_FOLDED_TIMING25,
+        /* 185: XCVR_TSM->TIMING26 */
+        XCVR_FOLDED_TIMING26,
+        /* 186: XCVR_TSM->TIMING27 */
+        XCVR_FOLDED_TIMING27,
+        /* 187: XCVR_TSM->TIMING28 */
+        XCVR_FOLDED_TIMING28,
+        /* 188: XCVR_TSM->TIMING29 */
+        XCVR_FOLDED_TIMING29,
+        /* 189: XCVR_TSM->TIMING30 */
+        XCVR_FOLDED_TIMING30,
+        /* 190: XCVR_TSM->TIMING31 */
+        XCVR_FOLDED_TIMING31,
+        /* 191: XCVR_TSM->TIMING32 */
+        XCVR_FOLDED_TIMING32,
+        /* 192: XCVR_TSM->TIMING33 */
+        XCVR_FOLDED_TIMING33,
+        /* 193: XCVR_TSM->TIMING34 */
+        XCVR_FOLDED_TIMING34,
+        /* 194: XCVR_TSM->TIMING35 */
+        XCVR_FOLDED_TIMING35,
+        /* 195: XCVR_TSM->TIMING36 */
+        XCVR_FOLDED_TIMING36,
+        /* 196: XCVR_TSM->TIMING37 */
+        XCVR_FOLDED_TIMING37,
+        /* 197: XCVR_TSM->TIMING38 */
+        XCVR_FOLDED_TIMING38,
+        /* 198: XCVR_TSM->TIMING39 */
+        XCVR_FOLDED_TIMING39,
+        /* 199: XCVR_TSM->TIMING40 */
+        XCVR_FOLDED_TIMING40,
+        /* 200: XCVR_TSM->TIMING41 */
+        XCVR_FOLDED_TIMING41,
+        /* 201: XCVR_TSM->TIMING42 */
+        XCVR_FOLDED_TIMING42,
+        /* 202: XCVR_TSM->TIMING43 */
+        XCVR_FOLDED_TIMING43,
+        /* 203: XCVR_TSM->TIMING44 */
+        XCVR_FOLDED_TIMING44,
+        /* 204: XCVR_TSM->TIMING45 */
+        XCVR_FOLDED_TIMING45,
+        /* 205: XCVR_TSM->TIMING46 */
+        XCVR_FOLDED_TIMING46,
+        /* 206: XCVR_TSM->TIMING47 */
+        XCVR_FOLDED_TIMING47,
+        /* 207: XCVR_TSM->TIMING48 */
+        XCVR_FOLDED_TIMING48,
+        /* 208: XCVR_TSM->TIMING49 */
+        XCVR_FOLDED_TIMING49,
+        /* 209: XCVR_TSM->TIMING50 */
+        XCVR_FOLDED_TIMING50,
+        /* 210: XCVR_TSM->TIMING51 */
+        XCVR_FOLDED_TIMING51,
+        /* 211: XCVR_TSM->TIMING52 */
+        XCVR_FOLDED_TIMING52,
+        /* 212: XCVR_TSM->WU_LATENCY */
+        XCVR_FOLDED_WU_LATENCY,
+        /* 213: XCVR_TX_DIG->DATARATE_CONFIG_FILTER_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(3) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(2) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(1),
+#else
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(4) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(3) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(2) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(1),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 214: XCVR_TX_DIG->DATARATE_CONFIG_FSK_CTRL */
+        XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV0(0x0000) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV1(0x0000),
+        /* 215: XCVR_TX_DIG->DATARATE_CONFIG_GFSK_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x279),
+#else
+        XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x203),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 216: XCVR_TX_DIG->DATA_PADDING_CTRL */
+        XCVR_FOLDED_DATA_PADDING_CTRL | XCVR_TX_DIG_DATA_PADDING_CTRL_DATA_PADDING_SEL(0) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_PAD_DLY(0) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_PAD_DLY_EN(1),
+        /* 217: XCVR_TX_DIG->DATA_PADDING_CTRL_1 */
+        XCVR_FOLDED_DATA_PADDING_CTRL_1 | XCVR_TX_DIG_DATA_PADDING_CTRL_1_RAMP_UP_DLY(0x04) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_1_TX_DATA_FLUSH_DLY(0x04),
+        /* 218: XCVR_TX_DIG->DATA_PADDING_CTRL_2 */
+        XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_MFDEV(0x1800) | XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_PFDEV(0x0800),
+        /* 219: XCVR_TX_DIG->FSK_CTRL */
+        XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_0(0x1800) | XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_1(0x0800),
+        /* 220: XCVR_TX_DIG->GFSK_COEFF_0_1 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_0(0x017) | XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_1(0x029),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_0(0x001) | XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_1(0x004),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 221: XCVR_TX_DIG->GFSK_COEFF_2_3 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_2(0x044) | XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_3(0x067),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_2(0x00D) | XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_3(0x028),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 222: XCVR_TX_DIG->GFSK_COEFF_4_5 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_4(0x090) | XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_5(0x0BA),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_4(0x063) | XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_5(0x0C0),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 223: XCVR_TX_DIG->GFSK_COEFF_6_7 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_6(0x0DC) | XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_7(0x0EF),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_6(0x12C) | XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_7(0x176),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 224: XCVR_TX_DIG->GFSK_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(0) |
+            XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x09E8),
+#else
+        XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(0) |
+            XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x080C),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 225: XCVR_TX_DIG->IMAGE_FILTER_CTRL */
+        XCVR_FOLDED_IMAGE_FILTER_CTRL | XCVR_TX_DIG_IMAGE_FILTER_CTRL_IMAGE_FILTER_OVRD_EN(0),
+        /* 226: XCVR_TX_DIG->PA_CTRL */
+        XCVR_FOLDED_PA_CTRL | XCVR_TX_DIG_PA_CTRL_PA_RAMP_SEL(1),
+        /* 227: XCVR_TX_DIG->PA_RAMP_TBL0 */
+        XCVR_FOLDED_PA_RAMP_TBL0,
+        /* 228: XCVR_TX_DIG->PA_RAMP_TBL1 */
+        XCVR_FOLDED_PA_RAMP_TBL1,
+        /* 229: XCVR_TX_DIG->PA_RAMP_TBL2 */
+        XCVR_FOLDED_PA_RAMP_TBL2,
+        /* 230: XCVR_TX_DIG->PA_RAMP_TBL3 */
+        XCVR_FOLDED_PA_RAMP_TBL3,
+        /* 231: XCVR_TX_DIG->SWITCH_TX_CTRL */
+        XCVR_FOLDED_SWITCH_TX_CTRL,
+        /* 232: XCVR_TX_DIG->TXDIG_CTRL */
+        XCVR_FOLDED_TXDIG_CTRL | XCVR_TX_DIG_TXDIG_CTRL_DATA_STREAM_SEL(0) | XCVR_TX_DIG_TXDIG_CTRL_MODULATOR_SEL(0) |
+            XCVR_TX_DIG_TXDIG_CTRL_PFC_EN(0),
+    },
+};
+
+const xcvr_folded_config_t xcvr_gfsk_bt_0p7_h_0p5_1mbps_folded_config = {
+    .config     = &xcvr_gfsk_bt_0p7_h_0p5_1mbps_full_config,
+    .reg_values = {
+        /* 0: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x14) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x10) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x0C) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x08) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+        /* 1: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x34) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x30),
+        /* 2: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x2C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x28) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x24),
+        /* 3: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x14) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x10) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x0C) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x08) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+        /* 4: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x34) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x38),
+        /* 5: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x3C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x04),
+        /* 6: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x0C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x08) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x04) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+        /* 7: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x08),
+        /* 8: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x04) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x3C),
+        /* 9: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x0C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x08) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x04) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+        /* 10: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x10),
+        /* 11: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x14) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x18) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x1C),
+        /* 12: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x34) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x38) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x3C) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+        /* 13: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x34) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x30),
+        /* 14: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x2C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x28) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x24),
+        /* 15: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x34) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x38) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x3C) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+        /* 16: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x34) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x38),
+        /* 17: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x3C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x04),
+        /* 18: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x2C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x30) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x34) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x38) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+        /* 19: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x08),
+        /* 20: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x04) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x3C),
+        /* 21: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x2C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x30) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x34) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x38) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+        /* 22: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x10),
+        /* 23: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x14) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x18) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x1C),
+        /* 24: GEN4PHY->DMD_CTRL0 */
+        XCVR_FOLDED_DMD_CTRL0,
+        /* 25: GEN4PHY->DMD_CTRL1 */
+        XCVR_FOLDED_DMD_CTRL1,
+        /* 26: GEN4PHY->FSK_CFG0 */
+        XCVR_FOLDED_FSK_CFG0 | GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_1M(0x0F) |
+            GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_2M(0x11) |
+            GEN4PHY_FSK_CFG0_MSK2FSK_SEED(0) | GEN4PHY_FSK_CFG0_MSK_EN(0),
+        /* 27: GEN4PHY->FSK_CFG1 */
+        GEN4PHY_FSK_CFG1_OVERH(0x020) | GEN4PHY_FSK_CFG1_OVERH_INV(0x100) | GEN4PHY_FSK_CFG1_SYNCTSCALE(0xF),
+        /* 28: GEN4PHY->FSK_CFG2 */
+        XCVR_FOLDED_FSK_CFG2,
+        /* 29: GEN4PHY->FSK_FAD_CFG */
+        XCVR_FOLDED_FSK_FAD_CFG,
+        /* 30: GEN4PHY->FSK_FAD_CTRL */
+        XCVR_FOLDED_FSK_FAD_CTRL,
+        /* 31: GEN4PHY->FSK_PD_CFG0 */
+        GEN4PHY_FSK_PD_CFG0_PD_IIR_ALPHA(0xFF) | GEN4PHY_FSK_PD_CFG0_PREAMBLE_T_SCALE(0xC),
+        /* 32: GEN4PHY->FSK_PD_CFG1 */
+        GEN4PHY_FSK_PD_CFG1_PREAMBLE_PATTERN(0x55),
+        /* 33: GEN4PHY->FSK_PD_CFG2 */
+        GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_1M(0xEB) | GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_2M(0xF6),
+        /* 34: GEN4PHY->FSK_PD_PH[0] */
+        GEN4PHY_FSK_PD_PH_REF0(0x04) | GEN4PHY_FSK_PD_PH_REF1(0x06) | GEN4PHY_FSK_PD_PH_REF2(0x04) |
+            GEN4PHY_FSK_PD_PH_REF3(0x00),
+        /* 35: GEN4PHY->FSK_PD_PH[1] */
+        GEN4PHY_FSK_PD_PH_REF0(0x3C) | GEN4PHY_FSK_PD_PH_REF1(0x3A) | GEN4PHY_FSK_PD_PH_REF2(0x3C) |
+            GEN4PHY_FSK_PD_PH_REF3(0x00),
+        /* 36: GEN4PHY->FSK_PT */
+        XCVR_FOLDED_FSK_PT | GEN4PHY_FSK_PT_AGC_TIMEOUT(0x0048),
+        /* 37: GEN4PHY->LR_AA_CFG */
+        GEN4PHY_LR_AA_CFG_AA_COR_THRESH(0x00) | GEN4PHY_LR_AA_CFG_AA_HAM_THRESH(0x00) |
+            GEN4PHY_LR_AA_CFG_AA_LR_CORR_GAIN(0x00) | GEN4PHY_LR_AA_CFG_ACCESS_ADDR_HAM(0x00),
+        /* 38: GEN4PHY->LR_PD_CFG */
+        GEN4PHY_LR_PD_CFG_CORR_TH(0x00) | GEN4PHY_LR_PD_CFG_FREQ_TH(0x00) | GEN4PHY_LR_PD_CFG_NO_PEAKS(0),
+        /* 39: GEN4PHY->LR_PD_PH[0] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 40: GEN4PHY->LR_PD_PH[1] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 41: GEN4PHY->LR_PD_PH[2] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 42: GEN4PHY->LR_PD_PH[3] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 43: GEN4PHY->MISC */
+        XCVR_FOLDED_MISC,
+        /* 44: GEN4PHY->PREPHY_MISC */
+        XCVR_FOLDED_PREPHY_MISC,
+        /* 45: GEN4PHY->RTT_CTRL */
+        XCVR_FOLDED_RTT_CTRL,
+        /* 46: GEN4PHY->RTT_REF */
+        GEN4PHY_RTT_REF_FM_REF_010(0x48) | GEN4PHY_RTT_REF_FM_REF_110(0x63) | GEN4PHY_RTT_REF_FM_REF_111(0x80),
+        /* 47: GEN4PHY->SM_CFG */
+        XCVR_FOLDED_SM_CFG | GEN4PHY_SM_CFG_AA_TIMEOUT_UNCODED(0x0A0),
+        /* 48: RADIO_CTRL->LL_CTRL */
+        RADIO_CTRL_LL_CTRL_ACTIVE_LL(2),
+        /* 49: XCVR_ANALOG->LDO_0 */
+        XCVR_FOLDED_LDO_0,
+        /* 50: XCVR_ANALOG->LDO_1 */
+        XCVR_FOLDED_LDO_1,
+        /* 51: XCVR_ANALOG->PLL */
+        XCVR_FOLDED_PLL,
+        /* 52: XCVR_ANALOG->RX_0 */
+        XCVR_FOLDED_RX_0,
+        /* 53: XCVR_ANALOG->RX_1 */
+        XCVR_FOLDED_RX_1,
+        /* 54: XCVR_ANALOG->TX_DAC_PA */
+        XCVR_FOLDED_TX_DAC_PA | XCVR_ANALOG_TX_DAC_PA_DAC_TRIM_CFBK_DRS(0),
+        /* 55: XCVR_ANALOG->XO_DIST */
+        XCVR_FOLDED_XO_DIST,
+        /* 56: XCVR_MISC->IPS_FO_ADDR[0] */
+        XCVR_MISC_IPS_FO_ADDR_ADDR(0x370) | XCVR_MISC_IPS_FO_ADDR_ENTRY_RX(0) | XCVR_MISC_IPS_FO_ADDR_ENTRY_TX(0),
+        /* 57: XCVR_MISC->IPS_FO_ADDR[1] */
+        XCVR_MISC_IPS_FO_ADDR_ADDR(0x02C) | XCVR_MISC_IPS_FO_ADDR_ENTRY_RX(0) | XCVR_MISC_IPS_FO_ADDR_ENTRY_TX(0),
+        /* 58: XCVR_MISC->IPS_FO_DRS0_DATA[0] */
+        XCVR_MISC_IPS_FO_DRS0_DATA_DRS0_DATA(0x00000000),
+        /* 59: XCVR_MISC->IPS_FO_DRS0_DATA[1] */
+        XCVR_MISC_IPS_FO_DRS0_DATA_DRS0_DATA(0x00000000),
+        /* 60: XCVR_MISC->IPS_FO_DRS1_DATA[0] */
+        XCVR_MISC_IPS_FO_DRS1_DATA_DRS1_DATA(0x00000000),
+        /* 61: XCVR_MISC->IPS_FO_DRS1_DATA[1] */
+        XCVR_MISC_IPS_FO_DRS1_DATA_DRS1_DATA(0x00000000),
+        /* 62: XCVR_MISC->LDO_TRIM_0 */
+        XCVR_FOLDED_LDO_TRIM_0,
+        /* 63: XCVR_MISC->LDO_TRIM_1 */
+        XCVR_FOLDED_LDO_TRIM_1,
+        /* 64: XCVR_MISC->XCVR_CTRL */
+        XCVR_FOLDED_XCVR_CTRL | XCVR_MISC_XCVR_CTRL_DATA_RATE_DRS(0) | XCVR_MISC_XCVR_CTRL_DEMOD_SEL(1) |
+            XCVR_MISC_XCVR_CTRL_LL_CFG_CAPT_DIS(0),
+        /* 65: XCVR_PLL_DIG->CHAN_MAP */
+        XCVR_FOLDED_CHAN_MAP | XCVR_PLL_DIG_CHAN_MAP_BAND_SELECT(0),
+        /* 66: XCVR_PLL_DIG->CHAN_MAP_EXT */
+#if RF_OSC_26MHZ == 1
+        XCVR_FOLDED_CHAN_MAP_EXT | XCVR_PLL_DIG_CHAN_MAP_EXT_NUM_OFFSET(0x013B13B),
+#else
+        XCVR_FOLDED_CHAN_MAP_EXT | XCVR_PLL_DIG_CHAN_MAP_EXT_NUM_OFFSET(0x0100000),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 67: XCVR_PLL_DIG->DATA_RATE_OVRD_CTRL1 */
+        XCVR_FOLDED_DATA_RATE_OVRD_CTRL1,
+        /* 68: XCVR_PLL_DIG->DATA_RATE_OVRD_CTRL2 */
+#if RF_OSC_26MHZ == 1
+        XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL2_NUM_OFFSET_CFG1(0x01D89D9),
+#else
+        XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL2_NUM_OFFSET_CFG1(0x0180000),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 69: XCVR_PLL_DIG->DELAY_MATCH */
+        XCVR_FOLDED_DELAY_MATCH | XCVR_PLL_DIG_DELAY_MATCH_HPM_INTEGER_DELAY(0x04) |
+            XCVR_PLL_DIG_DELAY_MATCH_LPM_SDM_DELAY(0x03),
+        /* 70: XCVR_PLL_DIG->HPMCAL_CTRL */
+        XCVR_FOLDED_HPMCAL_CTRL | XCVR_PLL_DIG_HPMCAL_CTRL_HPM_CAL_ARRAY_SIZE(0),
+        /* 71: XCVR_PLL_DIG->HPM_BUMP */
+        XCVR_FOLDED_HPM_BUMP | XCVR_PLL_DIG_HPM_BUMP_HPM_VCM_CAL(2) | XCVR_PLL_DIG_HPM_BUMP_HPM_VCM_TX(2),
+        /* 72: XCVR_PLL_DIG->HPM_CAL_TIMING */
+        XCVR_FOLDED_HPM_CAL_TIMING,
+        /* 73: XCVR_PLL_DIG->HPM_CTRL */
+        XCVR_FOLDED_HPM_CTRL,
+        /* 74: XCVR_PLL_DIG->HPM_SDM_RES */
+        XCVR_FOLDED_HPM_SDM_RES | XCVR_PLL_DIG_HPM_SDM_RES_HPM_COUNT_ADJUST(0x02),
+        /* 75: XCVR_PLL_DIG->LOCK_DETECT */
+        XCVR_FOLDED_LOCK_DETECT,
+        /* 76: XCVR_PLL_DIG->LPM_CTRL */
+        XCVR_FOLDED_LPM_CTRL,
+        /* 77: XCVR_PLL_DIG->LPM_SDM_CTRL1 */
+        XCVR_FOLDED_LPM_SDM_CTRL1,
+        /* 78: XCVR_PLL_DIG->MOD_CTRL */
+        XCVR_FOLDED_MOD_CTRL,
+        /* 79: XCVR_PLL_DIG->PLL_DATARATE_CTRL */
+        XCVR_FOLDED_PLL_DATARATE_CTRL,
+        /* 80: XCVR_PLL_DIG->TUNING_CAP_RX_CTRL */
+        XCVR_FOLDED_TUNING_CAP_RX_CTRL,
+        /* 81: XCVR_PLL_DIG->TUNING_CAP_TX_CTRL */
+        XCVR_FOLDED_TUNING_CAP_TX_CTRL,
+        /* 82: XCVR_RX_DIG->ACQ_FILT_0_3 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x3F) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x01) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x07) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x0B),
+#else
+        XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x01) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x04) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x7F) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x75),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 83: XCVR_RX_DIG->ACQ_FILT_0_3_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H0(0x01) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H1(0x05) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H2(0x09) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H3(0x08),
+#else
+        XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H0(0x02) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H1(0x00) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H2(0x78) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H3(0x77),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 84: XCVR_RX_DIG->ACQ_FILT_10_11 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x069) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x090),
+#else
+        XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x061) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x0E1),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 85: XCVR_RX_DIG->ACQ_FILT_10_11_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x06C) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x090),
+#else
+        XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x06C) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x0DB),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 86: XCVR_RX_DIG->ACQ_FILT_4_7 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x06) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x77) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_H6(0xE7) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0xE4),
+#else
+        XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x79) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x12) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_H6(0x1C) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0xF7),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 87: XCVR_RX_DIG->ACQ_FILT_4_7_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x7E) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x6E) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0xE1) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0xE5),
+#else
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x08) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x1B) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0x11) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0xE2),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 88: XCVR_RX_DIG->ACQ_FILT_8_9 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x1FC) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x02E),
+#else
+        XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x1C6) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x1E1),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 89: XCVR_RX_DIG->ACQ_FILT_8_9_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x002) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x035),
+#else
+        XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x1C0) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x1EF),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 90: XCVR_RX_DIG->AGC_CTRL */
+        XCVR_FOLDED_AGC_CTRL,
+        /* 91: XCVR_RX_DIG->AGC_CTRL_STAT */
+        XCVR_FOLDED_AGC_CTRL_STAT,
+        /* 92: XCVR_RX_DIG->AGC_IDX0_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX0_GAIN_CFG,
+        /* 93: XCVR_RX_DIG->AGC_IDX0_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX0_GAIN_VAL,
+        /* 94: XCVR_RX_DIG->AGC_IDX0_THR */
+        XCVR_FOLDED_AGC_IDX0_THR,
+        /* 95: XCVR_RX_DIG->AGC_IDX10_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX10_GAIN_CFG,
+        /* 96: XCVR_RX_DIG->AGC_IDX10_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX10_GAIN_VAL,
+        /* 97: XCVR_RX_DIG->AGC_IDX10_THR */
+        XCVR_FOLDED_AGC_IDX10_THR,
+        /* 98: XCVR_RX_DIG->AGC_IDX11_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX11_GAIN_CFG | XCVR_RX_DIG_AGC_IDX11_GAIN_CFG_MAG_THR_11_DRS_OFS(0x00) |
+            XCVR_RX_DIG_AGC_IDX11_GAIN_CFG_MAG_THR_HI_11_DRS_OFS(0x00),
+        /* 99: XCVR_RX_DIG->AGC_IDX11_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX11_GAIN_VAL | XCVR_RX_DIG_AGC_IDX11_GAIN_VAL_MAG_THR_11(0x000) |
+            XCVR_RX_DIG_AGC_IDX11_GAIN_VAL_MAG_THR_HI_11(0x000),
+        /* 100: XCVR_RX_DIG->AGC_IDX11_THR */
+        XCVR_FOLDED_AGC_IDX11_THR,
+        /* 101: XCVR_RX_DIG->AGC_IDX1_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX1_GAIN_CFG,
+        /* 102: XCVR_RX_DIG->AGC_IDX1_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX1_GAIN_VAL,
+        /* 103: XCVR_RX_DIG->AGC_IDX1_THR */
+        XCVR_FOLDED_AGC_IDX1_THR,
+        /* 104: XCVR_RX_DIG->AGC_IDX2_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX2_GAIN_CFG,
+        /* 105: XCVR_RX_DIG->AGC_IDX2_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX2_GAIN_VAL,
+        /* 106: XCVR_RX_DIG->AGC_IDX2_THR */
+        XCVR_FOLDED_AGC_IDX2_THR,
+        /* 107: XCVR_RX_DIG->AGC_IDX3_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX3_GAIN_CFG,
+        /* 108: XCVR_RX_DIG->AGC_IDX3_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX3_GAIN_VAL,
+        /* 109: XCVR_RX_DIG->AGC_IDX3_THR */
+        XCVR_FOLDED_AGC_IDX3_THR,
+        /* 110: XCVR_RX_DIG->AGC_IDX4_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX4_GAIN_CFG,
+        /* 111: XCVR_RX_DIG->AGC_IDX4_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX4_GAIN_VAL,
+        /* 112: XCVR_RX_DIG->AGC_IDX4_THR */
+        XCVR_FOLDED_AGC_IDX4_THR,
+        /* 113: XCVR_RX_DIG->AGC_IDX5_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX5_GAIN_CFG,
+        /* 114: XCVR_RX_DIG->AGC_IDX5_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX5_GAIN_VAL,
+        /* 115: XCVR_RX_DIG->AGC_IDX5_THR */
+        XCVR_FOLDED_AGC_IDX5_THR,
+        /* 116: XCVR_RX_DIG->AGC_IDX6_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX6_GAIN_CFG,
+        /* 117: XCVR_RX_DIG->AGC_IDX6_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX6_GAIN_VAL,
+        /* 118: XCVR_RX_DIG->AGC_IDX6_THR */
+        XCVR_FOLDED_AGC_IDX6_THR,
+        /* 119: XCVR_RX_DIG->AGC_IDX7_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX7_GAIN_CFG,
+        /* 120: XCVR_RX_DIG->AGC_IDX7_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX7_GAIN_VAL,
+        /* 121: XCVR_RX_DIG->AGC_IDX7_THR */
+        XCVR_FOLDED_AGC_IDX7_THR,
+        /* 122: XCVR_RX_DIG->AGC_IDX8_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX8_GAIN_CFG,
+        /* 123: XCVR_RX_DIG->AGC_IDX8_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX8_GAIN_VAL,
+        /* 124: XCVR_RX_DIG->AGC_IDX8_THR */
+        XCVR_FOLDED_AGC_IDX8_THR,
+        /* 125: XCVR_RX_DIG->AGC_IDX9_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX9_GAIN_CFG,
+        /* 126: XCVR_RX_DIG->AGC_IDX9_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX9_GAIN_VAL,
+        /* 127: XCVR_RX_DIG->AGC_IDX9_THR */
+        XCVR_FOLDED_AGC_IDX9_THR,
+        /* 128: XCVR_RX_DIG->AGC_MIS_GAIN_CFG */
+        XCVR_FOLDED_AGC_MIS_GAIN_CFG,
+        /* 129: XCVR_RX_DIG->AGC_THR_FAST */
+        XCVR_FOLDED_AGC_THR_FAST,
+        /* 130: XCVR_RX_DIG->AGC_THR_FAST_DRS */
+        XCVR_FOLDED_AGC_THR_FAST_DRS,
+        /* 131: XCVR_RX_DIG->AGC_THR_MIS */
+        XCVR_FOLDED_AGC_THR_MIS,
+        /* 132: XCVR_RX_DIG->AGC_TIMING0 */
+        XCVR_FOLDED_AGC_TIMING0 | XCVR_RX_DIG_AGC_TIMING0_AGC_GAIN_STEP_WAIT(0x10),
+        /* 133: XCVR_RX_DIG->AGC_TIMING0_DRS */
+        XCVR_FOLDED_AGC_TIMING0_DRS | XCVR_RX_DIG_AGC_TIMING0_DRS_AGC_GAIN_STEP_WAIT(0x10),
+        /* 134: XCVR_RX_DIG->AGC_TIMING1 */
+        XCVR_FOLDED_AGC_TIMING1 | XCVR_RX_DIG_AGC_TIMING1_AGC_FREEZE_TIMEOUT(0x0A) |
+            XCVR_RX_DIG_AGC_TIMING1_AGC_HOLD_TIMEOUT(0x08),
+        /* 135: XCVR_RX_DIG->AGC_TIMING1_DRS */
+        XCVR_RX_DIG_AGC_TIMING1_DRS_AGC_FREEZE_TIMEOUT(0x0A) | XCVR_RX_DIG_AGC_TIMING1_DRS_AGC_HOLD_TIMEOUT(0x08),
+        /* 136: XCVR_RX_DIG->AGC_TIMING2 */
+        XCVR_FOLDED_AGC_TIMING2 | XCVR_RX_DIG_AGC_TIMING2_AGC_UNFREEZE_FEAT_TIMEOUT(0x000) |
+            XCVR_RX_DIG_AGC_TIMING2_AGC_UNHOLD_FEAT_TIMEOUT(0x000),
+        /* 137: XCVR_RX_DIG->AGC_TIMING2_DRS */
+        XCVR_RX_DIG_AGC_TIMING2_DRS_AGC_UNFREEZE_FEAT_TIMEOUT(0x000) |
+            XCVR_RX_DIG_AGC_TIMING2_DRS_AGC_UNHOLD_FEAT_TIMEOUT(0x000),
+        /* 138: XCVR_RX_DIG->CTRL0 */
+#if RF_OSC_26MHZ == 1
+        XCVR_FOLDED_CTRL0 | XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(2) |
+            XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x027) |
+            XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(0) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#else
+        XCVR_FOLDED_CTRL0 | XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(3) |
+            XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x020) |
+            XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(0) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 139: XCVR_RX_DIG->CTRL0_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(1) |
+            XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x03B),
+#else
+        XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(2) |
+            XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x030),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 140: XCVR_RX_DIG->CTRL1 */
+        XCVR_FOLDED_CTRL1,
+        /* 141: XCVR_RX_DIG->DCOC_CTRL0 */
+        XCVR_FOLDED_DCOC_CTRL0 | XCVR_RX_DIG_DCOC_CTRL0_DCOC_DAC_ORDER(0) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFII(0x8) |
+            XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFIIP(1) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFQQ(0x2) |
+            XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFQQP(0),
+        /* 142: XCVR_RX_DIG->DCOC_CTRL0_DRS */
+        XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFII(4) | XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFIIP(1) |
+            XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFQQ(1) | XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFQQP(0),
+        /* 143: XCVR_RX_DIG->DCOC_CTRL1 */
+        XCVR_FOLDED_DCOC_CTRL1,
+        /* 144: XCVR_RX_DIG->DEMOD_FILT_0_1 */
+        XCVR_RX_DIG_DEMOD_FILT_0_1_H0(0x1FD) | XCVR_RX_DIG_DEMOD_FILT_0_1_H1(0x1FD),
+        /* 145: XCVR_RX_DIG->DEMOD_FILT_0_1_DRS */
+        XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H0(0x1FD) | XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H1(0x1FB),
+        /* 146: XCVR_RX_DIG->DEMOD_FILT_2_4 */
+        XCVR_RX_DIG_DEMOD_FILT_2_4_H2(0x021) | XCVR_RX_DIG_DEMOD_FILT_2_4_H3(0x084) |
+            XCVR_RX_DIG_DEMOD_FILT_2_4_H4(0x0C0),
+        /* 147: XCVR_RX_DIG->DEMOD_FILT_2_4_DRS */
+        XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H2(0x01D) | XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H3(0x086) |
+            XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H4(0x0C8),
+        /* 148: XCVR_RX_DIG->NB_RSSI_CTRL0 */
+        XCVR_FOLDED_NB_RSSI_CTRL0,
+        /* 149: XCVR_RX_DIG->NB_RSSI_CTRL1 */
+        XCVR_FOLDED_NB_RSSI_CTRL1,
+        /* 150: XCVR_RX_DIG->RCCAL_CTRL0 */
+        XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE(2) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE_DRS(1) |
+            XCVR_RX_DIG_RCCAL_CTRL0_CBPF_CCODE_OFFSET(0x00) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE(1) |
+            XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE_DRS(0) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CMPOUT_INV(0) |
+            XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CODE_OFFSET(0x0) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_SMPL_DLY(0),
+        /* 151: XCVR_RX_DIG->RSSI_GLOBAL_CTRL */
+        XCVR_FOLDED_RSSI_GLOBAL_CTRL | XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_CCA1_ED_EN(0),
+        /* 152: XCVR_RX_DIG->WB_RSSI_CTRL */
+        XCVR_FOLDED_WB_RSSI_CTRL,
+        /* 153: XCVR_TSM->CTRL */
+        XCVR_FOLDED_CTRL,
+        /* 154: XCVR_TSM->END_OF_SEQ */
+        XCVR_FOLDED_END_OF_SEQ,
+        /* 155: XCVR_TSM->FAST_CTRL1 */
+        XCVR_FOLDED_FAST_CTRL1,
+        /* 156: XCVR_TSM->FAST_CTRL2 */
+        XCVR_FOLDED_FAST_CTRL2,
+        /* 157: XCVR_TSM->FAST_CTRL3 */
+        XCVR_FOLDED_FAST_CTRL3,
+        /* 158: XCVR_TSM->RECYCLE_COUNT */
+        XCVR_FOLDED_RECYCLE_COUNT,
+        /* 159: XCVR_TSM->TIMING00 */
+        XCVR_FOLDED_TIMING00,
+        /* 160: XCVR_TSM->TIMING01 */
+        XCVR_FOLDED_TIMING01,
+        /* 161: XCVR_TSM->TIMING02 */
+        XCVR_FOLDED_TIMING02,
+        /* 162: XCVR_TSM->TIMING03 */
+        XCVR_FOLDED_TIMING03,
+        /* 163: XCVR_TSM->TIMING04 */
+        XCVR_FOLDED_TIMING04,
+        /* 164: XCVR_TSM->TIMING05 */
+        XCVR_FOLDED_TIMING05,
+        /* 165: XCVR_TSM->TIMING06 */
+        XCVR_FOLDED_TIMING06,
+        /* 166: XCVR_TSM->TIMING07 */
+        XCVR_FOLDED_TIMING07,
+        /* 167: XCVR_TSM->TIMING08 */
+        XCVR_FOLDED_TIMING08,
+        /* 168: XCVR_TSM->TIMING09 */
+        XCVR_FOLDED_TIMING09,
+        /* 169: XCVR_TSM->TIMING10 */
+        XCVR_FOLDED_TIMING10,
+        /* 170: XCVR_TSM->TIMING11 */
+        XCVR_FOLDED_TIMING11,
+        /* 171: XCVR_TSM->TIMING12 */
+        XCVR_FOLDED_TIMING12,
+        /* 172: XCVR_TSM->TIMING13 */
+        XCVR_FOLDED_TIMING13,
+        /* 173: XCVR_TSM->TIMING14 */
+        XCVR_FOLDED_TIMING14,
+        /* 174: XCVR_TSM->TIMING15 */
+        XCVR_FOLDED_TIMING15,
+        /* 175: XCVR_TSM->TIMING16 */
+        XCVR_FOLDED_TIMING16,
+        /* 176: XCVR_TSM->TIMING17 */
+        XCVR_FOLDED_TIMING17,
+        /* 177: XCVR_TSM->TIMING18 */
+        XCVR_FOLDED_TIMING18,
+        /* 178: XCVR_TSM->TIMING19 */
+        XCVR_FOLDED_TIMING19,
+        /* 179: XCVR_TSM->TIMING20 */
+        XCVR_FOLDED_TIMING20,
+        /* 180: XCVR_TSM->TIMING21 */
+        XCVR_FOLDED_TIMING21,
+        /* 181: XCVR_TSM->TIMING22 */
+        XCVR_FOLDED_TIMING22,
+        /* 182: XCVR_TSM->TIMING23 */
+        XCVR_FOLDED_TIMING23,
+        /* 183: XCVR_TSM->TIMING24 */
+        XCVR_FOLDED_TIMING24,
+        /* 184: XCVR_TSM->TIMING25 */
+        XCVR_FOLDED_TIMING25,
+        /* 185: XCVR_TSM->TIMING26 */
+        XCVR_FOLDED_TIMING26,
+        /* 186: XCVR_TSM->TIMING27 */
+        XCVR_FOLDED_TIMING27,
+        /* 187: XCVR_TSM->TIMING28 */
+        XCVR_FOLDED_TIMING28,
+        /* 188: XCVR_TSM->TIMING29 */
+        XCVR_FOLDED_TIMING29,
+        /* 189: XCVR_TSM->TIMING30 */
+        XCVR_FOLDED_TIMING30,
+        /* 190: XCVR_TSM->TIMING31 */
+        XCVR_FOLDED_TIMING31,
+        /* 191: XCVR_TSM->TIMING32 */
+        XCVR_FOLDED_TIMING32,
+        /* 192: XCVR_TSM->TIMING33 */
+        XCVR_FOLDED_TIMING33,
+        /* 193: XCVR_TSM->TIMING34 */
+        XCVR_FOLDED_TIMING34,
+        /* 194: XCVR_TSM->TIMING35 */
+        XCVR_FOLDED_TIMING35,
+        /* 195: XCVR_TSM->TIMING36 */
+        XCVR_FOLDED_TIMING36,
+        /* 196: XCVR_TSM->TIMING37 */
+        XCVR_FOLDED_TIMING37,
+        /* 197: XCVR_TSM->TIMING38 */
+        XCVR_FOLDED_TIMING38,
+        /* 198: XCVR_TSM->TIMING39 */
+        XCVR_FOLDED_TIMING39,
+        /* 199: XCVR_TSM->TIMING40 */
+        XCVR_FOLDED_TIMING40,
+        /* 200: XCVR_TSM->TIMING41 */
+        XCVR_FOLDED_TIMING41,
+        /* 201: XCVR_TSM->TIMING42 */
+        XCVR_FOLDED_TIMING42,
+        /* 202: XCVR_TSM->TIMING43 */
+        XCVR_FOLDED_TIMING43,
+        /* 203: XCVR_TSM->TIMING44 */
+        XCVR_FOLDED_TIMING44,
+        /* 204: XCVR_TSM->TIMING45 */
+        XCVR_FOLDED_TIMING45,
+        /* 205: XCVR_TSM->TIMING46 */
+        XCVR_FOLDED_TIMING46,
+        /* 206: XCVR_TSM->TIMING47 */
+        XCVR_FOLDED_TIMING47,
+        /* 207: XCVR_TSM->TIMING48 */
+        XCVR_FOLDED_TIMING48,
+        /* 208: XCVR_TSM->TIMING49 */
+        XCVR_FOLDED_TIMING49,
+        /* 209: XCVR_TSM->TIMING50 */
+        XCVR_FOLDED_TIMING50,
+        /* 210: XCVR_TSM->TIMING51 */
+        XCVR_FOLDED_TIMING51,
+        /* 211: XCVR_TSM->TIMING52 */
+        XCVR_FOLDED_TIMING52,
+        /* 212: XCVR_TSM->WU_LATENCY */
+        XCVR_FOLDED_WU_LATENCY,
+        /* 213: XCVR_TX_DIG->DATARATE_CONFIG_FILTER_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(0),
+#else
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(0),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 214: XCVR_TX_DIG->DATARATE_CONFIG_FSK_CTRL */
+        XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV0(0x0000) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV1(0x0000),
+        /* 215: XCVR_TX_DIG->DATARATE_CONFIG_GFSK_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x09DE),
+#else
+        XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x0804),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 216: XCVR_TX_DIG->DATA_PADDING_CTRL */
+        XCVR_FOLDED_DATA_PADDING_CTRL | XCVR_TX_DIG_DATA_PADDING_CTRL_DATA_PADDING_SEL(0) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_PAD_DLY(0) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_PAD_DLY_EN(1),
+        /* 217: XCVR_TX_DIG->DATA_PADDING_CTRL_1 */
+        XCVR_FOLDED_DATA_PADDING_CTRL_1 | XCVR_TX_DIG_DATA_PADDING_CTRL_1_RAMP_UP_DLY(0x04) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_1_TX_DATA_FLUSH_DLY(0x04),
+        /* 218: XCVR_TX_DIG->DATA_PADDING_CTRL_2 */
+        XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_MFDEV(0x0000) | XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_PFDEV(0x0000),
+        /* 219: XCVR_TX_DIG->FSK_CTRL */
+        XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_0(0x0000) | XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_1(0x0000),
+        /* 220: XCVR_TX_DIG->GFSK_COEFF_0_1 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_0(0x003) | XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_1(0x00A),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_0(0x000) | XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_1(0x000),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 221: XCVR_TX_DIG->GFSK_COEFF_2_3 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_2(0x01B) | XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_3(0x03E),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_2(0x001) | XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_3(0x007),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 222: XCVR_TX_DIG->GFSK_COEFF_4_5 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_4(0x079) | XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_5(0x0C6),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_4(0x025) | XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_5(0x08A),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 223: XCVR_TX_DIG->GFSK_COEFF_6_7 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_6(0x114) | XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_7(0x145),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_6(0x14A) | XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_7(0x1FE),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 224: XCVR_TX_DIG->GFSK_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(1) |
+            XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x4E9),
+#else
+        XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(1) |
+            XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x3FD),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 225: XCVR_TX_DIG->IMAGE_FILTER_CTRL */
+        XCVR_FOLDED_IMAGE_FILTER_CTRL | XCVR_TX_DIG_IMAGE_FILTER_CTRL_IMAGE_FILTER_OVRD_EN(0),
+        /* 226: XCVR_TX_DIG->PA_CTRL */
+        XCVR_FOLDED_PA_CTRL | XCVR_TX_DIG_PA_CTRL_PA_RAMP_SEL(1),
+        /* 227: XCVR_TX_DIG->PA_RAMP_TBL0 */
+        XCVR_FOLDED_PA_RAMP_TBL0,
+        /* 228: XCVR_TX_DIG->PA_RAMP_TBL1 */
+        XCVR_FOLDED_PA_RAMP_TBL1,
+        /* 229: XCVR_TX_DIG->PA_RAMP_TBL2 */
+        XCVR_FOLDED_PA_RAMP_TBL2,
+        /* 230: XCVR_TX_DIG->PA_RAMP_TBL3 */
+        XCVR_FOLDED_PA_RAMP_TBL3,
+        /* 231: XCVR_TX_DIG->SWITCH_TX_CTRL */
+        XCVR_FOLDED_SWITCH_TX_CTRL,
+        /* 232: XCVR_TX_DIG->TXDIG_CTRL */
+        XCVR_FOLDED_TXDIG_CTRL | XCVR_TX_DIG_TXDIG_CTRL_DATA_STREAM_SEL(0) | XCVR_TX_DIG_TXDIG_CTRL_MODULATOR_SEL(0) |
+            XCVR_TX_DIG_TXDIG_CTRL_PFC_EN(0),
+    },
+};
+
+const xcvr_folded_config_t xcvr_gfsk_bt_0p7_h_0p5_500kbps_folded_config = {
+    .config     = &xcvr_gfsk_bt_0p7_h_0p5_500kbps_full_config,
+    .reg_values = {
+        /* 0: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x14) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x10) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x0C) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x08) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+        /* 1: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x34) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x30),
+        /* 2: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x2C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x28) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x24),
+        /* 3: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x14) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x10) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x0C) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x08) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+        /* 4: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x34) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x38),
+        /* 5: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x3C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x04),
+        /* 6: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x0C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x08) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x04) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+        /* 7: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x08),
+        /* 8: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x04) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x3C),
+        /* 9: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x0C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x08) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x04) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+        /* 10: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x10),
+        /* 11: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x14) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x18) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x1C),
+        /* 12: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x34) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x38) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x3C) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+        /* 13: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x34) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x30),
+        /* 14: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x2C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x28) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x24),
+        /* 15: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x34) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x38) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x3C) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+        /* 16: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x34) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x38),
+        /* 17: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x3C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x04),
+        /* 18: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x2C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x30) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x34) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x38) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+        /* 19: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x08),
+        /* 20: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x04) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x3C),
+        /* 21: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x2C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x30) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x34) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x38) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+        /* 22: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x10),
+        /* 23: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x14) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x18) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x1C),
+        /* 24: GEN4PHY->DMD_CTRL0 */
+        XCVR_FOLDED_DMD_CTRL0,
+        /* 25: GEN4PHY->DMD_CTRL1 */
+        XCVR_FOLDED_DMD_CTRL1,
+        /* 26: GEN4PHY->FSK_CFG0 */
+        XCVR_FOLDED_FSK_CFG0 | GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_1M(0x0F) |
+            GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_2M(0x11) |
+            GEN4PHY_FSK_CFG0_MSK2FSK_SEED(0) | GEN4PHY_FSK_CFG0_MSK_EN(0),
+        /* 27: GEN4PHY->FSK_CFG1 */
+        GEN4PHY_FSK_CFG1_OVERH(0x020) | GEN4PHY_FSK_CFG1_OVERH_INV(0x100) | GEN4PHY_FSK_CFG1_SYNCTSCALE(0xF),
+        /* 28: GEN4PHY->FSK_CFG2 */
+        XCVR_FOLDED_FSK_CFG2,
+        /* 29: GEN4PHY->FSK_FAD_CFG */
+        XCVR_FOLDED_FSK_FAD_CFG,
+        /* 30: GEN4PHY->FSK_FAD_CTRL */
+        XCVR_FOLDED_FSK_FAD_CTRL,
+        /* 31: GEN4PHY->FSK_PD_CFG0 */
+        GEN4PHY_FSK_PD_CFG0_PD_IIR_ALPHA(0xFF) | GEN4PHY_FSK_PD_CFG0_PREAMBLE_T_SCALE(0xC),
+        /* 32: GEN4PHY->FSK_PD_CFG1 */
+        GEN4PHY_FSK_PD_CFG1_PREAMBLE_PATTERN(0x55),
+        /* 33: GEN4PHY->FSK_PD_CFG2 */
+        GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_1M(0xEB) | GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_2M(0xEB),
+        /* 34: GEN4PHY->FSK_PD_PH[0] */
+        GEN4PHY_FSK_PD_PH_REF0(0x04) | GEN4PHY_FSK_PD_PH_REF1(0x06) | GEN4PHY_FSK_PD_PH_REF2(0x04) |
+            GEN4PHY_FSK_PD_PH_REF3(0x00),
+        /* 35: GEN4PHY->FSK_PD_PH[1] */
+        GEN4PHY_FSK_PD_PH_REF0(0x3C) | GEN4PHY_FSK_PD_PH_REF1(0x3A) | GEN4PHY_FSK_PD_PH_REF2(0x3C) |
+            GEN4PHY_FSK_PD_PH_REF3(0x00),
+        /* 36: GEN4PHY->FSK_PT */
+        XCVR_FOLDED_FSK_PT | GEN4PHY_FSK_PT_AGC_TIMEOUT(0x0048),
+        /* 37: GEN4PHY->LR_AA_CFG */
+        GEN4PHY_LR_AA_CFG_AA_COR_THRESH(0x00) | GEN4PHY_LR_AA_CFG_AA_HAM_THRESH(0x00) |
+            GEN4PHY_LR_AA_CFG_AA_LR_CORR_GAIN(0x00) | GEN4PHY_LR_AA_CFG_ACCESS_ADDR_HAM(0x00),
+        /* 38: GEN4PHY->LR_PD_CFG */
+        GEN4PHY_LR_PD_CFG_CORR_TH(0x00) | GEN4PHY_LR_PD_CFG_FREQ_TH(0x00) | GEN4PHY_LR_PD_CFG_NO_PEAKS(0),
+        /* 39: GEN4PHY->LR_PD_PH[0] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 40: GEN4PHY->LR_PD_PH[1] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 41: GEN4PHY->LR_PD_PH[2] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 42: GEN4PHY->LR_PD_PH[3] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 43: GEN4PHY->MISC */
+        XCVR_FOLDED_MISC,
+        /* 44: GEN4PHY->PREPHY_MISC */
+        XCVR_FOLDED_PREPHY_MISC,
+        /* 45: GEN4PHY->RTT_CTRL */
+        XCVR_FOLDED_RTT_CTRL,
+        /* 46: GEN4PHY->RTT_REF */
+        GEN4PHY_RTT_REF_FM_REF_010(0x48) | GEN4PHY_RTT_REF_FM_REF_110(0x63) | GEN4PHY_RTT_REF_FM_REF_111(0x80),
+        /* 47: GEN4PHY->SM_CFG */
+        XCVR_FOLDED_SM_CFG | GEN4PHY_SM_CFG_AA_TIMEOUT_UNCODED(0x0A0),
+        /* 48: RADIO_CTRL->LL_CTRL */
+        RADIO_CTRL_LL_CTRL_ACTIVE_LL(2),
+        /* 49: XCVR_ANALOG->LDO_0 */
+        XCVR_FOLDED_LDO_0,
+        /* 50: XCVR_ANALOG->LDO_1 */
+        XCVR_FOLDED_LDO_1,
+        /* 51: XCVR_ANALOG->PLL */
+        XCVR_FOLDED_PLL,
+        /* 52: XCVR_ANALOG->RX_0 */
+        XCVR_FOLDED_RX_0,
+        /* 53: XCVR_ANALOG->RX_1 */
+        XCVR_FOLDED_RX_1,
+        /* 54: XCVR_ANALOG->TX_DAC_PA */
+        XCVR_FOLDED_TX_DAC_PA | XCVR_ANALOG_TX_DAC_PA_DAC_TRIM_CFBK_DRS(1),
+        /* 55: XCVR_ANALOG->XO_DIST */
+        XCVR_FOLDED_XO_DIST,
+        /* 56: XCVR_MISC->IPS_FO_ADDR[0] */
+        XCVR_MISC_IPS_FO_ADDR_ADDR(0x370) | XCVR_MISC_IPS_FO_ADDR_ENTRY_RX(0) | XCVR_MISC_IPS_FO_ADDR_ENTRY_TX(0),
+        /* 57: XCVR_MISC->IPS_FO_ADDR[1] */
+        XCVR_MISC_IPS_FO_ADDR_ADDR(0x02C) | XCVR_MISC_IPS_FO_ADDR_ENTRY_RX(0) | XCVR_MISC_IPS_FO_ADDR_ENTRY_TX(0),
+        /* 58: XCVR_MISC->IPS_FO_DRS0_DATA[0] */
+        XCVR_MISC_IPS_FO_DRS0_DATA_DRS0_DATA(0x00000000),
+        /* 59: XCVR_MISC->IPS_FO_DRS0_DATA[1] */
+        XCVR_MISC_IPS_FO_DRS0_DATA_DRS0_DATA(0x00000000),
+        /* 60: XCVR_MISC->IPS_FO_DRS1_DATA[0] */
+        XCVR_MISC_IPS_FO_DRS1_DATA_DRS1_DATA(0x00000000),
+        /* 61: XCVR_MISC->IPS_FO_DRS1_DATA[1] */
+        XCVR_MISC_IPS_FO_DRS1_DATA_DRS1_DATA(0x00000000),
+        /* 62: XCVR_MISC->LDO_TRIM_0 */
+        XCVR_FOLDED_LDO_TRIM_0,
+        /* 63: XCVR_MISC->LDO_TRIM_1 */
+        XCVR_FOLDED_LDO_TRIM_1,
+        /* 64: XCVR_MISC->XCVR_CTRL */
+        XCVR_FOLDED_XCVR_CTRL | XCVR_MISC_XCVR_CTRL_DATA_RATE_DRS(2) | XCVR_MISC_XCVR_CTRL_DEMOD_SEL(1) |
+            XCVR_MISC_XCVR_CTRL_LL_CFG_CAPT_DIS(0),
+        /* 65: XCVR_PLL_DIG->CHAN_MAP */
+        XCVR_FOLDED_CHAN_MAP | XCVR_PLL_DIG_CHAN_MAP_BAND_SELECT(0),
+        /* 66: XCVR_PLL_DIG->CHAN_MAP_EXT */
+#if RF_OSC_26MHZ == 1
+        XCVR_FOLDED_CHAN_MAP_EXT | XCVR_PLL_DIG_CHAN_MAP_EXT_NUM_OFFSET(0x013B13B),
+#else
+        XCVR_FOLDED_CHAN_MAP_EXT | XCVR_PLL_DIG_CHAN_MAP_EXT_NUM_OFFSET(0x0100000),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 67: XCVR_PLL_DIG->DATA_RATE_OVRD_CTRL1 */
+        XCVR_FOLDED_DATA_RATE_OVRD_CTRL1,
+        /* 68: XCVR_PLL_DIG->DATA_RATE_OVRD_CTRL2 */
+#if RF_OSC_26MHZ == 1
+        XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL2_NUM_OFFSET_CFG1(0x013B13B),
+#else
+        XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL2_NUM_OFFSET_CFG1(0x0100000),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 69: XCVR_PLL_DIG->DELAY_MATCH */
+        XCVR_FOLDED_DELAY_MATCH | XCVR_PLL_DIG_DELAY_MATCH_HPM_INTEGER_DELAY(0x04) |
+            XCVR_PLL_DIG_DELAY_MATCH_LPM_SDM_DELAY(0x03),
+        /* 70: XCVR_PLL_DIG->HPMCAL_CTRL */
+        XCVR_FOLDED_HPMCAL_CTRL | XCVR_PLL_DIG_HPMCAL_CTRL_HPM_CAL_ARRAY_SIZE(0),
+        /* 71: XCVR_PLL_DIG->HPM_BUMP */
+        XCVR_FOLDED_HPM_BUMP | XCVR_PLL_DIG_HPM_BUMP_HPM_VCM_CAL(2) | XCVR_PLL_DIG_HPM_BUMP_HPM_VCM_TX(2),
+        /* 72: XCVR_PLL_DIG->HPM_CAL_TIMING */
+        XCVR_FOLDED_HPM_CAL_TIMING,
+        /* 73: XCVR_PLL_DIG->HPM_CTRL */
+        XCVR_FOLDED_HPM_CTRL,
+        /* 74: XCVR_PLL_DIG->HPM_SDM_RES */
+        XCVR_FOLDED_HPM_SDM_RES | XCVR_PLL_DIG_HPM_SDM_RES_HPM_COUNT_ADJUST(0x02),
+        /* 75: XCVR_PLL_DIG->LOCK_DETECT */
+        XCVR_FOLDED_LOCK_DETECT,
+        /* 76: XCVR_PLL_DIG->LPM_CTRL */
+        XCVR_FOLDED_LPM_CTRL,
+        /* 77: XCVR_PLL_DIG->LPM_SDM_CTRL1 */
+        XCVR_FOLDED_LPM_SDM_CTRL1,
+        /* 78: XCVR_PLL_DIG->MOD_CTRL */
+        XCVR_FOLDED_MOD_CTRL,
+        /* 79: XCVR_PLL_DIG->PLL_DATARATE_CTRL */
+        XCVR_FOLDED_PLL_DATARATE_CTRL,
+        /* 80: XCVR_PLL_DIG->TUNING_CAP_RX_CTRL */
+        XCVR_FOLDED_TUNING_CAP_RX_CTRL,
+        /* 81: XCVR_PLL_DIG->TUNING_CAP_TX_CTRL */
+        XCVR_FOLDED_TUNING_CAP_TX_CTRL,
+        /* 82: XCVR_RX_DIG->ACQ_FILT_0_3 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x3F) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x01) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x07) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x0B),
+#else
+        XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x01) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x04) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x7F) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x75),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 83: XCVR_RX_DIG->ACQ_FILT_0_3_DRS */
+        XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H0(0x00) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H1(0x00) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H2(0x00) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H3(0x00),
+        /* 84: XCVR_RX_DIG->ACQ_FILT_10_11 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x069) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x090),
+#else
+        XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x061) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x0E1),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 85: XCVR_RX_DIG->ACQ_FILT_10_11_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x066) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x0AD),
+#else
+        XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x039) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x10B),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 86: XCVR_RX_DIG->ACQ_FILT_4_7 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x06) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x77) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_H6(0xE7) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0xE4),
+#else
+        XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x79) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x12) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_H6(0x1C) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0xF7),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 87: XCVR_RX_DIG->ACQ_FILT_4_7_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x04) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x07) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0xFD) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0xE8),
+#else
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x7E) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x79) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0x0B) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0x1B),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 88: XCVR_RX_DIG->ACQ_FILT_8_9 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x1FC) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x02E),
+#else
+        XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x1C6) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x1E1),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 89: XCVR_RX_DIG->ACQ_FILT_8_9_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x1E4) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x011),
+#else
+        XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x1E6) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x1B9),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 90: XCVR_RX_DIG->AGC_CTRL */
+        XCVR_FOLDED_AGC_CTRL,
+        /* 91: XCVR_RX_DIG->AGC_CTRL_STAT */
+        XCVR_FOLDED_AGC_CTRL_STAT,
+        /* 92: XCVR_RX_DIG->AGC_IDX0_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX0_GAIN_CFG,
+        /* 93: XCVR_RX_DIG->AGC_IDX0_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX0_GAIN_VAL,
+        /* 94: XCVR_RX_DIG->AGC_IDX0_THR */
+        XCVR_FOLDED_AGC_IDX0_THR,
+        /* 95: XCVR_RX_DIG->AGC_IDX10_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX10_GAIN_CFG,
+        /* 96: XCVR_RX_DIG->AGC_IDX10_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX10_GAIN_VAL,
+        /* 97: XCVR_RX_DIG->AGC_IDX10_THR */
+        XCVR_FOLDED_AGC_IDX10_THR,
+        /* 98: XCVR_RX_DIG->AGC_IDX11_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX11_GAIN_CFG | XCVR_RX_DIG_AGC_IDX11_GAIN_CFG_MAG_THR_11_DRS_OFS(0x00) |
+            XCVR_RX_DIG_AGC_IDX11_GAIN_CFG_MAG_THR_HI_11_DRS_OFS(0x00),
+        /* 99: XCVR_RX_DIG->AGC_IDX11_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX11_GAIN_VAL | XCVR_RX_DIG_AGC_IDX11_GAIN_VAL_MAG_THR_11(0x000) |
+            XCVR_RX_DIG_AGC_IDX11_GAIN_VAL_MAG_THR_HI_11(0x000),
+        /* 100: XCVR_RX_DIG->AGC_IDX11_THR */
+        XCVR_FOLDED_AGC_IDX11_THR,
+        /* 101: XCVR_RX_DIG->AGC_IDX1_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX1_GAIN_CFG,
+        /* 102: XCVR_RX_DIG->AGC_IDX1_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX1_GAIN_VAL,
+        /* 103: XCVR_RX_DIG->AGC_IDX1_THR */
+        XCVR_FOLDED_AGC_IDX1_THR,
+        /* 104: XCVR_RX_DIG->AGC_IDX2_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX2_GAIN_CFG,
+        /* 105: XCVR_RX_DIG->AGC_IDX2_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX2_GAIN_VAL,
+        /* 106: XCVR_RX_DIG->AGC_IDX2_THR */
+        XCVR_FOLDED_AGC_IDX2_THR,
+        /* 107: XCVR_RX_DIG->AGC_IDX3_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX3_GAIN_CFG,
+        /* 108: XCVR_RX_DIG->AGC_IDX3_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX3_GAIN_VAL,
+        /* 109: XCVR_RX_DIG->AGC_IDX3_THR */
+        XCVR_FOLDED_AGC_IDX3_THR,
+        /* 110: XCVR_RX_DIG->AGC_IDX4_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX4_GAIN_CFG,
+        /* 111: XCVR_RX_DIG->AGC_IDX4_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX4_GAIN_VAL,
+        /* 112: XCVR_RX_DIG->AGC_IDX4_THR */
+        XCVR_FOLDED_AGC_IDX4_THR,
+        /* 113: XCVR_RX_DIG->AGC_IDX5_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX5_GAIN_CFG,
+        /* 114: XCVR_RX_DIG->AGC_IDX5_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX5_GAIN_VAL,
+        /* 115: XCVR_RX_DIG->AGC_IDX5_THR */
+        XCVR_FOLDED_AGC_IDX5_THR,
+        /* 116: XCVR_RX_DIG->AGC_IDX6_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX6_GAIN_CFG,
+        /* 117: XCVR_RX_DIG->AGC_IDX6_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX6_GAIN_VAL,
+        /* 118: XCVR_RX_DIG->AGC_IDX6_THR */
+        XCVR_FOLDED_AGC_IDX6_THR,
+        /* 119: XCVR_RX_DIG->AGC_IDX7_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX7_GAIN_CFG,
+        /* 120: XCVR_RX_DIG->AGC_IDX7_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX7_GAIN_VAL,
+        /* 121: XCVR_RX_DIG->AGC_IDX7_THR */
+        XCVR_FOLDED_AGC_IDX7_THR,
+        /* 122: XCVR_RX_DIG->AGC_IDX8_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX8_GAIN_CFG,
+        /* 123: XCVR_RX_DIG->AGC_IDX8_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX8_GAIN_VAL,
+        /* 124: XCVR_RX_DIG->AGC_IDX8_THR */
+        XCVR_FOLDED_AGC_IDX8_THR,
+        /* 125: XCVR_RX_DIG->AGC_IDX9_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX9_GAIN_CFG,
+        /* 126: XCVR_RX_DIG->AGC_IDX9_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX9_GAIN_VAL,
+        /* 127: XCVR_RX_DIG->AGC_IDX9_THR */
+        XCVR_FOLDED_AGC_IDX9_THR,
+        /* 128: XCVR_RX_DIG->AGC_MIS_GAIN_CFG */
+        XCVR_FOLDED_AGC_MIS_GAIN_CFG,
+        /* 129: XCVR_RX_DIG->AGC_THR_FAST */
+        XCVR_FOLDED_AGC_THR_FAST,
+        /* 130: XCVR_RX_DIG->AGC_THR_FAST_DRS */
+        XCVR_FOLDED_AGC_THR_FAST_DRS,
+        /* 131: XCVR_RX_DIG->AGC_THR_MIS */
+        XCVR_FOLDED_AGC_THR_MIS,
+        /* 132: XCVR_RX_DIG->AGC_TIMING0 */
+        XCVR_FOLDED_AGC_TIMING0 | XCVR_RX_DIG_AGC_TIMING0_AGC_GAIN_STEP_WAIT(0x10),
+        /* 133: XCVR_RX_DIG->AGC_TIMING0_DRS */
+        XCVR_FOLDED_AGC_TIMING0_DRS | XCVR_RX_DIG_AGC_TIMING0_DRS_AGC_GAIN_STEP_WAIT(0x10),
+        /* 134: XCVR_RX_DIG->AGC_TIMING1 */
+        XCVR_FOLDED_AGC_TIMING1 | XCVR_RX_DIG_AGC_TIMING1_AGC_FREEZE_TIMEOUT(0x0A) |
+            XCVR_RX_DIG_AGC_TIMING1_AGC_HOLD_TIMEOUT(0x08),
+        /* 135: XCVR_RX_DIG->AGC_TIMING1_DRS */
+        XCVR_RX_DIG_AGC_TIMING1_DRS_AGC_FREEZE_TIMEOUT(0x0A) | XCVR_RX_DIG_AGC_TIMING1_DRS_AGC_HOLD_TIMEOUT(0x08),
+        /* 136: XCVR_RX_DIG->AGC_TIMING2 */
+        XCVR_FOLDED_AGC_TIMING2 | XCVR_RX_DIG_AGC_TIMING2_AGC_UNFREEZE_FEAT_TIMEOUT(0x000) |
+            XCVR_RX_DIG_AGC_TIMING2_AGC_UNHOLD_FEAT_TIMEOUT(0x000),
+        /* 137: XCVR_RX_DIG->AGC_TIMING2_DRS */
+        XCVR_RX_DIG_AGC_TIMING2_DRS_AGC_UNFREEZE_FEAT_TIMEOUT(0x000) |
+            XCVR_RX_DIG_AGC_TIMING2_DRS_AGC_UNHOLD_FEAT_TIMEOUT(0x000),
+        /* 138: XCVR_RX_DIG->CTRL0 */
+#if RF_OSC_26MHZ == 1
+        XCVR_FOLDED_CTRL0 | XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(2) |
+            XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x027) |
+            XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(1) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#else
+        XCVR_FOLDED_CTRL0 | XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(3) |
+            XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x020) |
+            XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(1) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 139: XCVR_RX_DIG->CTRL0_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(3) |
+            XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x027),
+#else
+        XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(4) |
+            XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x020),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 140: XCVR_RX_DIG->CTRL1 */
+        XCVR_FOLDED_CTRL1,
+        /* 141: XCVR_RX_DIG->DCOC_CTRL0 */
+        XCVR_FOLDED_DCOC_CTRL0 | XCVR_RX_DIG_DCOC_CTRL0_DCOC_DAC_ORDER(1) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFII(0x6) |
+            XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFIIP(1) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFQQ(0x5) |
+            XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFQQP(1),
+        /* 142: XCVR_RX_DIG->DCOC_CTRL0_DRS */
+        XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFII(6) | XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFIIP(1) |
+            XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFQQ(5) | XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFQQP(1),
+        /* 143: XCVR_RX_DIG->DCOC_CTRL1 */
+        XCVR_FOLDED_DCOC_CTRL1,
+        /* 144: XCVR_RX_DIG->DEMOD_FILT_0_1 */
+        XCVR_RX_DIG_DEMOD_FILT_0_1_H0(0x1FD) | XCVR_RX_DIG_DEMOD_FILT_0_1_H1(0x1FD),
+        /* 145: XCVR_RX_DIG->DEMOD_FILT_0_1_DRS */
+        XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H0(0x1FD) | XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H1(0x1FC),
+        /* 146: XCVR_RX_DIG->DEMOD_FILT_2_4 */
+        XCVR_RX_DIG_DEMOD_FILT_2_4_H2(0x021) | XCVR_RX_DIG_DEMOD_FILT_2_4_H3(0x084) |
+            XCVR_RX_DIG_DEMOD_FILT_2_4_H4(0x0C0),
+        /* 147: XCVR_RX_DIG->DEMOD_FILT_2_4_DRS */
+        XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H2(0x020) | XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H3(0x084) |
+            XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H4(0x0C2),
+        /* 148: XCVR_RX_DIG->NB_RSSI_CTRL0 */
+        XCVR_FOLDED_NB_RSSI_CTRL0,
+        /* 149: XCVR_RX_DIG->NB_RSSI_CTRL1 */
+        XCVR_FOLDED_NB_RSSI_CTRL1,
+        /* 150: XCVR_RX_DIG->RCCAL_CTRL0 */
+        XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE(2) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE_DRS(3) |
+            XCVR_RX_DIG_RCCAL_CTRL0_CBPF_CCODE_OFFSET(0x00) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE(1) |
+            XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE_DRS(1) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CMPOUT_INV(0) |
+            XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CODE_OFFSET(0x0) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_SMPL_DLY(0),
+        /* 151: XCVR_RX_DIG->RSSI_GLOBAL_CTRL */
+        XCVR_FOLDED_RSSI_GLOBAL_CTRL | XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_CCA1_ED_EN(0),
+        /* 152: XCVR_RX_DIG->WB_RSSI_CTRL */
+        XCVR_FOLDED_WB_RSSI_CTRL,
+        /* 153: XCVR_TSM->CTRL */
+        XCVR_FOLDED_CTRL,
+        /* 154: XCVR_TSM->END_OF_SEQ */
+        XCVR_FOLDED_END_OF_SEQ,
+        /* 155: XCVR_TSM->FAST_CTRL1 */
+        XCVR_FOLDED_FAST_CTRL1,
+        /* 156: XCVR_TSM->FAST_CTRL2 */
+        XCVR_FOLDED_FAST_CTRL2,
+        /* 157: XCVR_TSM->FAST_CTRL3 */
+        XCVR_FOLDED_FAST_CTRL3,
+        /* 158: XCVR_TSM->RECYCLE_COUNT */
+        XCVR_FOLDED_RECYCLE_COUNT,
+        /* 159: XCVR_TSM->TIMING00 */
+        XCVR_FOLDED_TIMING00,
+        /* 160: XCVR_TSM->TIMING01 */
+        XCVR_FOLDED_TIMING01,
+        /* 161: XCVR_TSM->TIMING02 */
+        XCVR_FOLDED_TIMING02,
+        /* 162: XCVR_TSM->TIMING03 */
+        XCVR_FOLDED_TIMING03,
+        /* 163: XCVR_TSM->TIMING04 */
+        XCVR_FOLDED_TIMING04,
+        /* 164: XCVR_TSM->TIMING05 */
+        XCVR_FOLDED_TIMING05,
+        /* 165: XCVR_TSM->TIMING06 */
+        XCVR_FOLDED_TIMING06,
+        /* 166: XCVR_TSM->TIMING07 */
+        XCVR_FOLDED_TIMING07,
+        /* 167: XCVR_TSM->TIMING08 */
+        XCVR_FOLDED_TIMING08,
+        /* 168: XCVR_TSM->TIMING09 */
+        XCVR_FOLDED_TIMING09,
+        /* 169: XCVR_TSM->TIMING10 */
+        XCVR_FOLDED_TIMING10,
+        /* 170: XCVR_TSM->TIMING11 */
+        XCVR_FOLDED_TIMING11,
+        /* 171: XCVR_TSM->TIMING12 */
+        XCVR_FOLDED_TIMING12,
+        /* 172: XCVR_TSM->TIMING13 */
+        XCVR_FOLDED_TIMING13,
+        /* 173: XCVR_TSM->TIMING14 */
+        XCVR_FOLDED_TIMING14,
+        /* 174: XCVR_TSM->TIMING15 */
+        XCVR_FOLDED_TIMING15,
+        /* 175: XCVR_TSM->TIMING16 */
+        XCVR_FOLDED_TIMING16,
+        /* 176: XCVR_TSM->TIMING17 */
+        XCVR_FOLDED_TIMING17,
+        /* 177: XCVR_TSM->TIMING18 */
+        XCVR_FOLDED_TIMING18,
+        /* 178: XCVR_TSM->TIMING19 */
+        XCVR_FOLDED_TIMING19,
+        /* 179: XCVR_TSM->TIMING20 */
+        XCVR_FOLDED_TIMING20,
+        /* 180: XCVR_TSM->TIMING21 */
+        XCVR_FOLDED_TIMING21,
+        /* 181: XCVR_TSM->TIMING22 */
+        XCVR_FOLDED_TIMING22,
+        /* 182: XCVR_TSM->TIMING23 */
+        XCVR_FOLDED_TIMING23,
+        /* 183: XCVR_TSM->TIMING24 */
+        XCVR_FOLDED_TIMING24,
+        /* 184: XCVR_TSM->TIMING25 */
+        XCVR_FOLDED_TIMING25,
+        /* 185: XCVR_TSM->TIMING26 */
+        XCVR_FOLDED_TIMING26,
+        /* 186: XCVR_TSM->TIMING27 */
+        XCVR_FOLDED_TIMING27,
+        /* 187: XCVR_TSM->TIMING28 */
+        XCVR_FOLDED_TIMING28,
+        /* 188: XCVR_TSM->TIMING29 */
+        XCVR_FOLDED_TIMING29,
+        /* 189: XCVR_TSM->TIMING30 */
+        XCVR_FOLDED_TIMING30,
+        /* 190: XCVR_TSM->TIMING31 */
+        XCVR_FOLDED_TIMING31,
+        /* 191: XCVR_TSM->TIMING32 */
+        XCVR_FOLDED_TIMING32,
+        /* 192: XCVR_TSM->TIMING33 */
+        XCVR_FOLDED_TIMING33,
+        /* 193: XCVR_TSM->TIMING34 */
+        XCVR_FOLDED_TIMING34,
+        /* 194: XCVR_TSM->TIMING35 */
+        XCVR_FOLDED_TIMING35,
+        /* 195: XCVR_TSM->TIMING36 */
+        XCVR_FOLDED_TIMING36,
+        /* 196: XCVR_TSM->TIMING37 */
+        XCVR_FOLDED_TIMING37,
+        /* 197: XCVR_TSM->TIMING38 */
+        XCVR_FOLDED_TIMING38,
+        /* 198: XCVR_TSM->TIMING39 */
+        XCVR_FOLDED_TIMING39,
+        /* 199: XCVR_TSM->TIMING40 */
+        XCVR_FOLDED_TIMING40,
+        /* 200: XCVR_TSM->TIMING41 */
+        XCVR_FOLDED_TIMING41,
+        /* 201: XCVR_TSM->TIMING42 */
+        XCVR_FOLDED_TIMING42,
+        /* 202: XCVR_TSM->TIMING43 */
+        XCVR_FOLDED_TIMING43,
+        /* 203: XCVR_TSM->TIMING44 */
+        XCVR_FOLDED_TIMING44,
+        /* 204: XCVR_TSM->TIMING45 */
+        XCVR_FOLDED_TIMING45,
+        /* 205: XCVR_TSM->TIMING46 */
+        XCVR_FOLDED_TIMING46,
+        /* 206: XCVR_TSM->TIMING47 */
+        XCVR_FOLDED_TIMING47,
+        /* 207: XCVR_TSM->TIMING48 */
+        XCVR_FOLDED_TIMING48,
+        /* 208: XCVR_TSM->TIMING49 */
+        XCVR_FOLDED_TIMING49,
+        /* 209: XCVR_TSM->TIMING50 */
+        XCVR_FOLDED_TIMING50,
+        /* 210: XCVR_TSM->TIMING51 */
+        XCVR_FOLDED_TIMING51,
+        /* 211: XCVR_TSM->TIMING52 */
+        XCVR_FOLDED_TIMING52,
+        /* 212: XCVR_TSM->WU_LATENCY */
+        XCVR_FOLDED_WU_LATENCY,
+        /* 213: XCVR_TX_DIG->DATARATE_CONFIG_FILTER_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(2) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(2) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(1),
+#else
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(3) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(2) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(1),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 214: XCVR_TX_DIG->DATARATE_CONFIG_FSK_CTRL */
+        XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV0(0x0000) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV1(0x0000),
+        /* 215: XCVR_TX_DIG->DATARATE_CONFIG_GFSK_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x0279),
+#else
+        XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x0203),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 216: XCVR_TX_DIG->DATA_PADDING_CTRL */
+        XCVR_FOLDED_DATA_PADDING_CTRL | XCVR_TX_DIG_DATA_PADDING_CTRL_DATA_PADDING_SEL(0) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_PAD_DLY(0) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_PAD_DLY_EN(1),
+        /* 217: XCVR_TX_DIG->DATA_PADDING_CTRL_1 */
+        XCVR_FOLDED_DATA_PADDING_CTRL_1 | XCVR_TX_DIG_DATA_PADDING_CTRL_1_RAMP_UP_DLY(0x04) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_1_TX_DATA_FLUSH_DLY(0x04),
+        /* 218: XCVR_TX_DIG->DATA_PADDING_CTRL_2 */
+        XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_MFDEV(0x0000) | XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_PFDEV(0x0000),
+        /* 219: XCVR_TX_DIG->FSK_CTRL */
+        XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_0(0x0000) | XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_1(0x0000),
+        /* 220: XCVR_TX_DIG->GFSK_COEFF_0_1 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_0(0x003) | XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_1(0x00A),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_0(0x000) | XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_1(0x000),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 221: XCVR_TX_DIG->GFSK_COEFF_2_3 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_2(0x01B) | XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_3(0x03E),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_2(0x001) | XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_3(0x007),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 222: XCVR_TX_DIG->GFSK_COEFF_4_5 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_4(0x079) | XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_5(0x0C6),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_4(0x025) | XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_5(0x08A),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 223: XCVR_TX_DIG->GFSK_COEFF_6_7 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_6(0x114) | XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_7(0x145),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_6(0x14A) | XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_7(0x1FE),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 224: XCVR_TX_DIG->GFSK_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(1) |
+            XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x276),
+#else
+        XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(1) |
+            XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x200),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 225: XCVR_TX_DIG->IMAGE_FILTER_CTRL */
+        XCVR_FOLDED_IMAGE_FILTER_CTRL | XCVR_TX_DIG_IMAGE_FILTER_CTRL_IMAGE_FILTER_OVRD_EN(0),
+        /* 226: XCVR_TX_DIG->PA_CTRL */
+        XCVR_FOLDED_PA_CTRL | XCVR_TX_DIG_PA_CTRL_PA_RAMP_SEL(1),
+        /* 227: XCVR_TX_DIG->PA_RAMP_TBL0 */
+        XCVR_FOLDED_PA_RAMP_TBL0,
+        /* 228: XCVR_TX_DIG->PA_RAMP_TBL1 */
+        XCVR_FOLDED_PA_RAMP_TBL1,
+        /* 229: XCVR_TX_DIG->PA_RAMP_TBL2 */
+        XCVR_FOLDED_PA_RAMP_TBL2,
+        /* 230: XCVR_TX_DIG->PA_RAMP_TBL3 */
+        XCVR_FOLDED_PA_RAMP_TBL3,
+        /* 231: XCVR_TX_DIG->SWITCH_TX_CTRL */
+        XCVR_FOLDED_SWITCH_TX_CTRL,
+        /* 232: XCVR_TX_DIG->TXDIG_CTRL */
+        XCVR_FOLDED_TXDIG_CTRL | XCVR_TX_DIG_TXDIG_CTRL_DATA_STREAM_SEL(0) | XCVR_TX_DIG_TXDIG_CTRL_MODULATOR_SEL(0) |
+            XCVR_TX_DIG_TXDIG_CTRL_PFC_EN(0),
+    },
+};
+
+const xcvr_folded_config_t xcvr_gfsk_bt_0p7_h_0p5_250kbps_folded_config = {
+    .config     = &xcvr_gfsk_bt_0p7_h_0p5_250kbps_full_config,
+    .reg_values = {
+        /* 0: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x14) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x10) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x0C) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x08) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+        /* 1: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x34) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x30),
+        /* 2: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x2C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x28) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x24),
+        /* 3: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x14) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x10) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x0C) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x08) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+        /* 4: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x34) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x38),
+        /* 5: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x3C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x04),
+        /* 6: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x0C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x08) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x04) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+        /* 7: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x08),
+        /* 8: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x04) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x3C),
+        /* 9: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x0C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x08) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x04) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+        /* 10: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x10),
+        /* 11: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x14) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x18) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x1C),
+        /* 12: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x34) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x38) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x3C) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+        /* 13: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x34) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x30),
+        /* 14: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x2C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x28) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x24),
+        /* 15: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x34) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x38) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x3C) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+        /* 16: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x34) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x38),
+        /* 17: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x3C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x04),
+        /* 18: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x2C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x30) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x34) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x38) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+        /* 19: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x08),
+        /* 20: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x04) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x3C),
+        /* 21: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x2C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x30) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x34) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x38) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+        /* 22: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x10),
+        /* 23: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x14) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x18) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x1C),
+        /* 24: GEN4PHY->DMD_CTRL0 */
+        XCVR_FOLDED_DMD_CTRL0,
+        /* 25: GEN4PHY->DMD_CTRL1 */
+        XCVR_FOLDED_DMD_CTRL1,
+        /* 26: GEN4PHY->FSK_CFG0 */
+        XCVR_FOLDED_FSK_CFG0 | GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_1M(0x0F) |
+            GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_2M(0x11) |
+            GEN4PHY_FSK_CFG0_MSK2FSK_SEED(0) | GEN4PHY_FSK_CFG0_MSK_EN(0),
+        /* 27: GEN4PHY->FSK_CFG1 */
+        GEN4PHY_FSK_CFG1_OVERH(0x020) | GEN4PHY_FSK_CFG1_OVERH_INV(0x100) | GEN4PHY_FSK_CFG1_SYNCTSCALE(0xF),
+        /* 28: GEN4PHY->FSK_CFG2 */
+        XCVR_FOLDED_FSK_CFG2,
+        /* 29: GEN4PHY->FSK_FAD_CFG */
+        XCVR_FOLDED_FSK_FAD_CFG,
+        /* 30: GEN4PHY->FSK_FAD_CTRL */
+        XCVR_FOLDED_FSK_FAD_CTRL,
+        /* 31: GEN4PHY->FSK_PD_CFG0 */
+        GEN4PHY_FSK_PD_CFG0_PD_IIR_ALPHA(0xFF) | GEN4PHY_FSK_PD_CFG0_PREAMBLE_T_SCALE(0xC),
+        /* 32: GEN4PHY->FSK_PD_CFG1 */
+        GEN4PHY_FSK_PD_CFG1_PREAMBLE_PATTERN(0x55),
+        /* 33: GEN4PHY->FSK_PD_CFG2 */
+        GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_1M(0xEB) | GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_2M(0xEB),
+        /* 34: GEN4PHY->FSK_PD_PH[0] */
+        GEN4PHY_FSK_PD_PH_REF0(0x04) | GEN4PHY_FSK_PD_PH_REF1(0x06) | GEN4PHY_FSK_PD_PH_REF2(0x04) |
+            GEN4PHY_FSK_PD_PH_REF3(0x00),
+        /* 35: GEN4PHY->FSK_PD_PH[1] */
+        GEN4PHY_FSK_PD_PH_REF0(0x3C) | GEN4PHY_FSK_PD_PH_REF1(0x3A) | GEN4PHY_FSK_PD_PH_REF2(0x3C) |
+            GEN4PHY_FSK_PD_PH_REF3(0x00),
+        /* 36: GEN4PHY->FSK_PT */
+        XCVR_FOLDED_FSK_PT | GEN4PHY_FSK_PT_AGC_TIMEOUT(0x0048),
+        /* 37: GEN4PHY->LR_AA_CFG */
+        GEN4PHY_LR_AA_CFG_AA_COR_THRESH(0x00) | GEN4PHY_LR_AA_CFG_AA_HAM_THRESH(0x00) |
+            GEN4PHY_LR_AA_CFG_AA_LR_CORR_GAIN(0x00) | GEN4PHY_LR_AA_CFG_ACCESS_ADDR_HAM(0x00),
+        /* 38: GEN4PHY->LR_PD_CFG */
+        GEN4PHY_LR_PD_CFG_CORR_TH(0x00) | GEN4PHY_LR_PD_CFG_FREQ_TH(0x00) | GEN4PHY_LR_PD_CFG_NO_PEAKS(0),
+        /* 39: GEN4PHY->LR_PD_PH[0] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 40: GEN4PHY->LR_PD_PH[1] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 41: GEN4PHY->LR_PD_PH[2] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 42: GEN4PHY->LR_PD_PH[3] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 43: GEN4PHY->MISC */
+        XCVR_FOLDED_MISC,
+        /* 44: GEN4PHY->PREPHY_MISC */
+        XCVR_FOLDED_PREPHY_MISC,
+        /* 45: GEN4PHY->RTT_CTRL */
+        XCVR_FOLDED_RTT_CTRL,
+        /* 46: GEN4PHY->RTT_REF */
+        GEN4PHY_RTT_REF_FM_REF_010(0x48) | GEN4PHY_RTT_REF_FM_REF_110(0x63) | GEN4PHY_RTT_REF_FM_REF_111(0x80),
+        /* 47: GEN4PHY->SM_CFG */
+        XCVR_FOLDED_SM_CFG | GEN4PHY_SM_CFG_AA_TIMEOUT_UNCODED(0x0A0),
+        /* 48: RADIO_CTRL->LL_CTRL */
+        RADIO_CTRL_LL_CTRL_ACTIVE_LL(2),
+        /* 49: XCVR_ANALOG->LDO_0 */
+        XCVR_FOLDED_LDO_0,
+        /* 50: XCVR_ANALOG->LDO_1 */
+        XCVR_FOLDED_LDO_1,
+        /* 51: XCVR_ANALOG->PLL */
+        XCVR_FOLDED_PLL,
+        /* 52: XCVR_ANALOG->RX_0 */
+        XCVR_FOLDED_RX_0,
+        /* 53: XCVR_ANALOG->RX_1 */
+        XCVR_FOLDED_RX_1,
+        /* 54: XCVR_ANALOG->TX_DAC_PA */
+        XCVR_FOLDED_TX_DAC_PA | XCVR_ANALOG_TX_DAC_PA_DAC_TRIM_CFBK_DRS(1),
+        /* 55: XCVR_ANALOG->XO_DIST */
+        XCVR_FOLDED_XO_DIST,
+        /* 56: XCVR_MISC->IPS_FO_ADDR[0] */
+        XCVR_MISC_IPS_FO_ADDR_ADDR(0x370) | XCVR_MISC_IPS_FO_ADDR_ENTRY_RX(0) | XCVR_MISC_IPS_FO_ADDR_ENTRY_TX(0),
+        /* 57: XCVR_MISC->IPS_FO_ADDR[1] */
+        XCVR_MISC_IPS_FO_ADDR_ADDR(0x02C) | XCVR_MISC_IPS_FO_ADDR_ENTRY_RX(0) | XCVR_MISC_IPS_FO_ADDR_ENTRY_TX(0),
+        /* 58: XCVR_MISC->IPS_FO_DRS0_DATA[0] */
+        XCVR_MISC_IPS_FO_DRS0_DATA_DRS0_DATA(0x00000000),
+        /* 59: XCVR_MISC->IPS_FO_DRS0_DATA[1] */
+        XCVR_MISC_IPS_FO_DRS0_DATA_DRS0_DATA(0x00000000),
+        /* 60: XCVR_MISC->IPS_FO_DRS1_DATA[0] */
+        XCVR_MISC_IPS_FO_DRS1_DATA_DRS1_DATA(0x00000000),
+        /* 61: XCVR_MISC->IPS_FO_DRS1_DATA[1] */
+        XCVR_MISC_IPS_FO_DRS1_DATA_DRS1_DATA(0x00000000),
+        /* 62: XCVR_MISC->LDO_TRIM_0 */
+        XCVR_FOLDED_LDO_TRIM_0,
+        /* 63: XCVR_MISC->LDO_TRIM_1 */
+        XCVR_FOLDED_LDO_TRIM_1,
+        /* 64: XCVR_MISC->XCVR_CTRL */
+        XCVR_FOLDED_XCVR_CTRL | XCVR_MISC_XCVR_CTRL_DATA_RATE_DRS(3) | XCVR_MISC_XCVR_CTRL_DEMOD_SEL(1) |
+            XCVR_MISC_XCVR_CTRL_LL_CFG_CAPT_DIS(0),
+        /* 65: XCVR_PLL_DIG->CHAN_MAP */
+        XCVR_FOLDED_CHAN_MAP | XCVR_PLL_DIG_CHAN_MAP_BAND_SELECT(0),
+        /* 66: XCVR_PLL_DIG->CHAN_MAP_EXT */
+#if RF_OSC_26MHZ == 1
+        XCVR_FOLDED_CHAN_MAP_EXT | XCVR_PLL_DIG_CHAN_MAP_EXT_NUM_OFFSET(0x013B13B),
+#else
+        XCVR_FOLDED_CHAN_MAP_EXT | XCVR_PLL_DIG_CHAN_MAP_EXT_NUM_OFFSET(0x0100000),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 67: XCVR_PLL_DIG->DATA_RATE_OVRD_CTRL1 */
+        XCVR_FOLDED_DATA_RATE_OVRD_CTRL1,
+        /* 68: XCVR_PLL_DIG->DATA_RATE_OVRD_CTRL2 */
+#if RF_OSC_26MHZ == 1
+        XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL2_NUM_OFFSET_CFG1(0x013B13B),
+#else
+        XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL2_NUM_OFFSET_CFG1(0x0100000),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 69: XCVR_PLL_DIG->DELAY_MATCH */
+        XCVR_FOLDED_DELAY_MATCH | XCVR_PLL_DIG_DELAY_MATCH_HPM_INTEGER_DELAY(0x04) |
+            XCVR_PLL_DIG_DELAY_MATCH_LPM_SDM_DELAY(0x03),
+        /* 70: XCVR_PLL_DIG->HPMCAL_CTRL */
+        XCVR_FOLDED_HPMCAL_CTRL | XCVR_PLL_DIG_HPMCAL_CTRL_HPM_CAL_ARRAY_SIZE(0),
+        /* 71: XCVR_PLL_DIG->HPM_BUMP */
+        XCVR_FOLDED_HPM_BUMP | XCVR_PLL_DIG_HPM_BUMP_HPM_VCM_CAL(2) | XCVR_PLL_DIG_HPM_BUMP_HPM_VCM_TX(2),
+        /* 72: XCVR_PLL_DIG->HPM_CAL_TIMING */
+        XCVR_FOLDED_HPM_CAL_TIMING,
+        /* 73: XCVR_PLL_DIG->HPM_CTRL */
+        XCVR_FOLDED_HPM_CTRL,
+        /* 74: XCVR_PLL_DIG->HPM_SDM_RES */
+        XCVR_FOLDED_HPM_SDM_RES | XCVR_PLL_DIG_HPM_SDM_RES_HPM_COUNT_ADJUST(0x02),
+        /* 75: XCVR_PLL_DIG->LOCK_DETECT */
+        XCVR_FOLDED_LOCK_DETECT,
+        /* 76: XCVR_PLL_DIG->LPM_CTRL */
+        XCVR_FOLDED_LPM_CTRL,
+        /* 77: XCVR_PLL_DIG->LPM_SDM_CTRL1 */
+        XCVR_FOLDED_LPM_SDM_CTRL1,
+        /* 78: XCVR_PLL_DIG->MOD_CTRL */
+        XCVR_FOLDED_MOD_CTRL,
+        /* 79: XCVR_PLL_DIG->PLL_DATARATE_CTRL */
+        XCVR_FOLDED_PLL_DATARATE_CTRL,
+        /* 80: XCVR_PLL_DIG->TUNING_CAP_RX_CTRL */
+        XCVR_FOLDED_TUNING_CAP_RX_CTRL,
+        /* 81: XCVR_PLL_DIG->TUNING_CAP_TX_CTRL */
+        XCVR_FOLDED_TUNING_CAP_TX_CTRL,
+        /* 82: XCVR_RX_DIG->ACQ_FILT_0_3 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x3F) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x01) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x07) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x0B),
+#else
+        XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x01) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x04) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x7F) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x75),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 83: XCVR_RX_DIG->ACQ_FILT_0_3_DRS */
+        XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H0(0x00) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H1(0x00) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H2(0x00) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H3(0x00),
+        /* 84: XCVR_RX_DIG->ACQ_FILT_10_11 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x069) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x090),
+#else
+        XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x061) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x0E1),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 85: XCVR_RX_DIG->ACQ_FILT_10_11_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x06B) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x0B3),
+#else
+        XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x024) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x119),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 86: XCVR_RX_DIG->ACQ_FILT_4_7 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x06) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x77) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_H6(0xE7) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0xE4),
+#else
+        XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x79) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x12) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_H6(0x1C) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0xF7),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 87: XCVR_RX_DIG->ACQ_FILT_4_7_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x03) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x05) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0xFB) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0xE6),
+#else
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x01) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x79) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0xFE) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0x1C),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 88: XCVR_RX_DIG->ACQ_FILT_8_9 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x1FC) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x02E),
+#else
+        XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x1C6) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x1E1),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 89: XCVR_RX_DIG->ACQ_FILT_8_9_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x1E5) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x013),
+#else
+        XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x1FC) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x1B3),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 90: XCVR_RX_DIG->AGC_CTRL */
+        XCVR_FOLDED_AGC_CTRL,
+        /* 91: XCVR_RX_DIG->AGC_CTRL_STAT */
+        XCVR_FOLDED_AGC_CTRL_STAT,
+        /* 92: XCVR_RX_DIG->AGC_IDX0_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX0_GAIN_CFG,
+        /* 93: XCVR_RX_DIG->AGC_IDX0_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX0_GAIN_VAL,
+        /* 94: XCVR_RX_DIG->AGC_IDX0_THR */
+        XCVR_FOLDED_AGC_IDX0_THR,
+        /* 95: XCVR_RX_DIG->AGC_IDX10_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX10_GAIN_CFG,
+        /* 96: XCVR_RX_DIG->AGC_IDX10_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX10_GAIN_VAL,
+        /* 97: XCVR_RX_DIG->AGC_IDX10_THR */
+        XCVR_FOLDED_AGC_IDX10_THR,
+        /* 98: XCVR_RX_DIG->AGC_IDX11_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX11_GAIN_CFG | XCVR_RX_DIG_AGC_IDX11_GAIN_CFG_MAG_THR_11_DRS_OFS(0x00) |
+            XCVR_RX_DIG_AGC_IDX11_GAIN_CFG_MAG_THR_HI_11_DRS_OFS(0x00),
+        /* 99: XCVR_RX_DIG->AGC_IDX11_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX11_GAIN_VAL | XCVR_RX_DIG_AGC_IDX11_GAIN_VAL_MAG_THR_11(0x000) |
+            XCVR_RX_DIG_AGC_IDX11_GAIN_VAL_MAG_THR_HI_11(0x000),
+        /* 100: XCVR_RX_DIG->AGC_IDX11_THR */
+        XCVR_FOLDED_AGC_IDX11_THR,
+        /* 101: XCVR_RX_DIG->AGC_IDX1_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX1_GAIN_CFG,
+        /* 102: XCVR_RX_DIG->AGC_IDX1_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX1_GAIN_VAL,
+        /* 103: XCVR_RX_DIG->AGC_IDX1_THR */
+        XCVR_FOLDED_AGC_IDX1_THR,
+        /* 104: XCVR_RX_DIG->AGC_IDX2_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX2_GAIN_CFG,
+        /* 105: XCVR_RX_DIG->AGC_IDX2_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX2_GAIN_VAL,
+        /* 106: XCVR_RX_DIG->AGC_IDX2_THR */
+        XCVR_FOLDED_AGC_IDX2_THR,
+        /* 107: XCVR_RX_DIG->AGC_IDX3_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX3_GAIN_CFG,
+        /* 108: XCVR_RX_DIG->AGC_IDX3_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX3_GAIN_VAL,
+        /* 109: XCVR_RX_DIG->AGC_IDX3_THR */
+        XCVR_FOLDED_AGC_IDX3_THR,
+        /* 110: XCVR_RX_DIG->AGC_IDX4_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX4_GAIN_CFG,
+        /* 111: XCVR_RX_DIG->AGC_IDX4_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX4_GAIN_VAL,
+        /* 112: XCVR_RX_DIG->AGC_IDX4_THR */
+        XCVR_FOLDED_AGC_IDX4_THR,
+        /* 113: XCVR_RX_DIG->AGC_IDX5_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX5_GAIN_CFG,
+        /* 114: XCVR_RX_DIG->AGC_IDX5_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX5_GAIN_VAL,
+        /* 115: XCVR_RX_DIG->AGC_IDX5_THR */
+        XCVR_FOLDED_AGC_IDX5_THR,
+        /* 116: XCVR_RX_DIG->AGC_IDX6_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX6_GAIN_CFG,
+        /* 117: XCVR_RX_DIG->AGC_IDX6_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX6_GAIN_VAL,
+        /* 118: XCVR_RX_DIG->AGC_IDX6_THR */
+        XCVR_FOLDED_AGC_IDX6_THR,
+        /* 119: XCVR_RX_DIG->AGC_IDX7_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX7_GAIN_CFG,
+        /* 120: XCVR_RX_DIG->AGC_IDX7_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX7_GAIN_VAL,
+        /* 121: XCVR_RX_DIG->AGC_IDX7_THR */
+        XCVR_FOLDED_AGC_IDX7_THR,
+        /* 122: XCVR_RX_DIG->AGC_IDX8_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX8_GAIN_CFG,
+        /* 123: XCVR_RX_DIG->AGC_IDX8_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX8_GAIN_VAL,
+        /* 124: XCVR_RX_DIG->AGC_IDX8_THR */
+        XCVR_FOLDED_AGC_IDX8_THR,
+        /* 125: XCVR_RX_DIG->AGC_IDX9_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX9_GAIN_CFG,
+        /* 126: XCVR_RX_DIG->AGC_IDX9_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX9_GAIN_VAL,
+        /* 127: XCVR_RX_DIG->AGC_IDX9_THR */
+        XCVR_FOLDED_AGC_IDX9_THR,
+        /* 128: XCVR_RX_DIG->AGC_MIS_GAIN_CFG */
+        XCVR_FOLDED_AGC_MIS_GAIN_CFG,
+        /* 129: XCVR_RX_DIG->AGC_THR_FAST */
+        XCVR_FOLDED_AGC_THR_FAST,
+        /* 130: XCVR_RX_DIG->AGC_THR_FAST_DRS */
+        XCVR_FOLDED_AGC_THR_FAST_DRS,
+        /* 131: XCVR_RX_DIG->AGC_THR_MIS */
+        XCVR_FOLDED_AGC_THR_MIS,
+        /* 132: XCVR_RX_DIG->AGC_TIMING0 */
+        XCVR_FOLDED_AGC_TIMING0 | XCVR_RX_DIG_AGC_TIMING0_AGC_GAIN_STEP_WAIT(0x10),
+        /* 133: XCVR_RX_DIG->AGC_TIMING0_DRS */
+        XCVR_FOLDED_AGC_TIMING0_DRS | XCVR_RX_DIG_AGC_TIMING0_DRS_AGC_GAIN_STEP_WAIT(0x10),
+        /* 134: XCVR_RX_DIG->AGC_TIMING1 */
+        XCVR_FOLDED_AGC_TIMING1 | XCVR_RX_DIG_AGC_TIMING1_AGC_FREEZE_TIMEOUT(0x0A) |
+            XCVR_RX_DIG_AGC_TIMING1_AGC_HOLD_TIMEOUT(0x08),
+        /* 135: XCVR_RX_DIG->AGC_TIMING1_DRS */
+        XCVR_RX_DIG_AGC_TIMING1_DRS_AGC_FREEZE_TIMEOUT(0x0A) | XCVR_RX_DIG_AGC_TIMING1_DRS_AGC_HOLD_TIMEOUT(0x08),
+        /* 136: XCVR_RX_DIG->AGC_TIMING2 */
+        XCVR_FOLDED_AGC_TIMING2 | XCVR_RX_DIG_AGC_TIMING2_AGC_UNFREEZE_FEAT_TIMEOUT(0x000) |
+            XCVR_RX_DIG_AGC_TIMING2_AGC_UNHOLD_FEAT_TIMEOUT(0x000),
+        /* 137: XCVR_RX_DIG->AGC_TIMING2_DRS */
+        XCVR_RX_DIG_AGC_TIMING2_DRS_AGC_UNFREEZE_FEAT_TIMEOUT(0x000) |
+            XCVR_RX_DIG_AGC_TIMING2_DRS_AGC_UNHOLD_FEAT_TIMEOUT(0x000),
+        /* 138: XCVR_RX_DIG->CTRL0 */
+#if RF_OSC_26MHZ == 1
+        XCVR_FOLDED_CTRL0 | XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(2) |
+            XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x027) |
+            XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(1) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#else
+        XCVR_FOLDED_CTRL0 | XCVR_RX_DIG_CTRL0_CIC_ORDER(1) | XCVR_RX_DIG_CTRL0_CIC_RATE(3) |
+            XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x020) |
+            XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(1) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 139: XCVR_RX_DIG->CTRL0_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(4) |
+            XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x027),
+#else
+        XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(1) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(5) |
+            XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x020),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 140: XCVR_RX_DIG->CTRL1 */
+        XCVR_FOLDED_CTRL1,
+        /* 141: XCVR_RX_DIG->DCOC_CTRL0 */
+        XCVR_FOLDED_DCOC_CTRL0 | XCVR_RX_DIG_DCOC_CTRL0_DCOC_DAC_ORDER(1) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFII(0x6) |
+            XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFIIP(1) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFQQ(0x5) |
+            XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFQQP(1),
+        /* 142: XCVR_RX_DIG->DCOC_CTRL0_DRS */
+        XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFII(6) | XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFIIP(1) |
+            XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFQQ(5) | XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFQQP(1),
+        /* 143: XCVR_RX_DIG->DCOC_CTRL1 */
+        XCVR_FOLDED_DCOC_CTRL1,
+        /* 144: XCVR_RX_DIG->DEMOD_FILT_0_1 */
+        XCVR_RX_DIG_DEMOD_FILT_0_1_H0(0x1FD) | XCVR_RX_DIG_DEMOD_FILT_0_1_H1(0x1FD),
+        /* 145: XCVR_RX_DIG->DEMOD_FILT_0_1_DRS */
+        XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H0(0x1FD) | XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H1(0x1FC),
+        /* 146: XCVR_RX_DIG->DEMOD_FILT_2_4 */
+        XCVR_RX_DIG_DEMOD_FILT_2_4_H2(0x021) | XCVR_RX_DIG_DEMOD_FILT_2_4_H3(0x084) |
+            XCVR_RX_DIG_DEMOD_FILT_2_4_H4(0x0C0),
+        /* 147: XCVR_RX_DIG->DEMOD_FILT_2_4_DRS */
+        XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H2(0x020) | XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H3(0x084) |
+            XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H4(0x0C2),
+        /* 148: XCVR_RX_DIG->NB_RSSI_CTRL0 */
+        XCVR_FOLDED_NB_RSSI_CTRL0,
+        /* 149: XCVR_RX_DIG->NB_RSSI_CTRL1 */
+        XCVR_FOLDED_NB_RSSI_CTRL1,
+        /* 150: XCVR_RX_DIG->RCCAL_CTRL0 */
+        XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE(2) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE_DRS(4) |
+            XCVR_RX_DIG_RCCAL_CTRL0_CBPF_CCODE_OFFSET(0x00) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE(1) |
+            XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE_DRS(1) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CMPOUT_INV(0) |
+            XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CODE_OFFSET(0x0) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_SMPL_DLY(0),
+        /* 151: XCVR_RX_DIG->RSSI_GLOBAL_CTRL */
+        XCVR_FOLDED_RSSI_GLOBAL_CTRL | XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_CCA1_ED_EN(0),
+        /* 152: XCVR_RX_DIG->WB_RSSI_CTRL */
+        XCVR_FOLDED_WB_RSSI_CTRL,
+        /* 153: XCVR_TSM->CTRL */
+        XCVR_FOLDED_CTRL,
+        /* 154: XCVR_TSM->END_OF_SEQ */
+        XCVR_FOLDED_END_OF_SEQ,
+        /* 155: XCVR_TSM->FAST_CTRL1 */
+        XCVR_FOLDED_FAST_CTRL1,
+        /* 156: XCVR_TSM->FAST_CTRL2 */
+        XCVR_FOLDED_FAST_CTRL2,
+        /* 157: XCVR_TSM->FAST_CTRL3 */
+        XCVR_FOLDED_FAST_CTRL3,
+        /* 158: XCVR_TSM->RECYCLE_COUNT */
+        XCVR_FOLDED_RECYCLE_COUNT,
+        /* 159: XCVR_TSM->TIMING00 */
+        XCVR_FOLDED_TIMING00,
+        /* 160: XCVR_TSM->TIMING01 */
+        XCVR_FOLDED_TIMING01,
+        /* 161: XCVR_TSM->TIMING02 */
+        XCVR_FOLDED_TIMING02,
+        /* 162: XCVR_TSM->TIMING03 */
+        XCVR_FOLDED_TIMING03,
+        /* 163: XCVR_TSM->TIMING04 */
+        XCVR_FOLDED_TIMING04,
+        /* 164: XCVR_TSM->TIMING05 */
+        XCVR_FOLDED_TIMING05,
+        /* 165: XCVR_TSM->TIMING06 */
+        XCVR_FOLDED_TIMING06,
+        /* 166: XCVR_TSM->TIMING07 */
+        XCVR_FOLDED_TIMING07,
+        /* 167: XCVR_TSM->TIMING08 */
+        XCVR_FOLDED_TIMING08,
+        /* 168: XCVR_TSM->TIMING09 */
+        XCVR_FOLDED_TIMING09,
+        /* 169: XCVR_TSM->TIMING10 */
+        XCVR_FOLDED_TIMING10,
+        /* 170: XCVR_TSM->TIMING11 */
+        XCVR_FOLDED_TIMING11,
+        /* 171: XCVR_TSM->TIMING12 */
+        XCVR_FOLDED_TIMING12,
+        /* 172: XCVR_TSM->TIMING13 */
+        XCVR_FOLDED_TIMING13,
+        /* 173: XCVR_TSM->TIMING14 */
+        XCVR_FOLDED_TIMING14,
+        /* 174: XCVR_TSM->TIMING15 */
+        XCVR_FOLDED_TIMING15,
+        /* 175: XCVR_TSM->TIMING16 */
+        XCVR_FOLDED_TIMING16,
+        /* 176: XCVR_TSM->TIMING17 */
+        XCVR_FOLDED_TIMING17,
+        /* 177: XCVR_TSM->TIMING18 */
+        XCVR_FOLDED_TIMING18,
+        /* 178: XCVR_TSM->TIMING19 */
+        XCVR_FOLDED_TIMING19,
+        /* 179: XCVR_TSM->TIMING20 */
+        XCVR_FOLDED_TIMING20,
+        /* 180: XCVR_TSM->TIMING21 */
+        XCVR_FOLDED_TIMING21,
+        /* 181: XCVR_TSM->TIMING22 */
+        XCVR_FOLDED_TIMING22,
+        /* 182: XCVR_TSM->TIMING23 */
+        XCVR_FOLDED_TIMING23,
+        /* 183: XCVR_TSM->TIMING24 */
+        XCVR_FOLDED_TIMING24,
+        /* 184: XCVR_TSM->TIMING25 */
+        XCVR_FOLDED_TIMING25,
+        /* 185: XCVR_TSM->TIMING26 */
+        XCVR_FOLDED_TIMING26,
+        /* 186: XCVR_TSM->TIMING27 */
+        XCVR_FOLDED_TIMING27,
+        /* 187: XCVR_TSM->TIMING28 */
+        XCVR_FOLDED_TIMING28,
+        /* 188: XCVR_TSM->TIMING29 */
+        XCVR_FOLDED_TIMING29,
+        /* 189: XCVR_TSM->TIMING30 */
+        XCVR_FOLDED_TIMING30,
+        /* 190: XCVR_TSM->TIMING31 */
+        XCVR_FOLDED_TIMING31,
+        /* 191: XCVR_TSM->TIMING32 */
+        XCVR_FOLDED_TIMING32,
+        /* 192: XCVR_TSM->TIMING33 */
+        XCVR_FOLDED_TIMING33,
+        /* 193: XCVR_TSM->TIMING34 */
+        XCVR_FOLDED_TIMING34,
+        /* 194: XCVR_TSM->TIMING35 */
+        XCVR_FOLDED_TIMING35,
+        /* 195: XCVR_TSM->TIMING36 */
+        XCVR_FOLDED_TIMING36,
+        /* 196: XCVR_TSM->TIMING37 */
+        XCVR_FOLDED_TIMING37,
+        /* 197: XCVR_TSM->TIMING38 */
+        XCVR_FOLDED_TIMING38,
+        /* 198: XCVR_TSM->TIMING39 */
+        XCVR_FOLDED_TIMING39,
+        /* 199: XCVR_TSM->TIMING40 */
+        XCVR_FOLDED_TIMING40,
+        /* 200: XCVR_TSM->TIMING41 */
+        XCVR_FOLDED_TIMING41,
+        /* 201: XCVR_TSM->TIMING42 */
+        XCVR_FOLDED_TIMING42,
+        /* 202: XCVR_TSM->TIMING43 */
+        XCVR_FOLDED_TIMING43,
+        /* 203: XCVR_TSM->TIMING44 */
+        XCVR_FOLDED_TIMING44,
+        /* 204: XCVR_TSM->TIMING45 */
+        XCVR_FOLDED_TIMING45,
+        /* 205: XCVR_TSM->TIMING46 */
+        XCVR_FOLDED_TIMING46,
+        /* 206: XCVR_TSM->TIMING47 */
+        XCVR_FOLDED_TIMING47,
+        /* 207: XCVR_TSM->TIMING48 */
+        XCVR_FOLDED_TIMING48,
+        /* 208: XCVR_TSM->TIMING49 */
+        XCVR_FOLDED_TIMING49,
+        /* 209: XCVR_TSM->TIMING50 */
+        XCVR_FOLDED_TIMING50,
+        /* 210: XCVR_TSM->TIMING51 */
+        XCVR_FOLDED_TIMING51,
+        /* 211: XCVR_TSM->TIMING52 */
+        XCVR_FOLDED_TIMING52,
+        /* 212: XCVR_TSM->WU_LATENCY */
+        XCVR_FOLDED_WU_LATENCY,
+        /* 213: XCVR_TX_DIG->DATARATE_CONFIG_FILTER_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(3) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(2) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(1),
+#else
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(4) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(3) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(2) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(1),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 214: XCVR_TX_DIG->DATARATE_CONFIG_FSK_CTRL */
+        XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV0(0x0000) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV1(0x0000),
+        /* 215: XCVR_TX_DIG->DATARATE_CONFIG_GFSK_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x013D),
+#else
+        XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x0101),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 216: XCVR_TX_DIG->DATA_PADDING_CTRL */
+        XCVR_FOLDED_DATA_PADDING_CTRL | XCVR_TX_DIG_DATA_PADDING_CTRL_DATA_PADDING_SEL(0) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_PAD_DLY(0) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_PAD_DLY_EN(1),
+        /* 217: XCVR_TX_DIG->DATA_PADDING_CTRL_1 */
+        XCVR_FOLDED_DATA_PADDING_CTRL_1 | XCVR_TX_DIG_DATA_PADDING_CTRL_1_RAMP_UP_DLY(0x04) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_1_TX_DATA_FLUSH_DLY(0x04),
+        /* 218: XCVR_TX_DIG->DATA_PADDING_CTRL_2 */
+        XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_MFDEV(0x0000) | XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_PFDEV(0x0000),
+        /* 219: XCVR_TX_DIG->FSK_CTRL */
+        XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_0(0x0000) | XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_1(0x0000),
+        /* 220: XCVR_TX_DIG->GFSK_COEFF_0_1 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_0(0x003) | XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_1(0x00A),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_0(0x000) | XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_1(0x000),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 221: XCVR_TX_DIG->GFSK_COEFF_2_3 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_2(0x01B) | XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_3(0x03E),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_2(0x001) | XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_3(0x007),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 222: XCVR_TX_DIG->GFSK_COEFF_4_5 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_4(0x079) | XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_5(0x0C6),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_4(0x025) | XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_5(0x08A),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 223: XCVR_TX_DIG->GFSK_COEFF_6_7 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_6(0x114) | XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_7(0x145),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_6(0x14A) | XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_7(0x1FE),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 224: XCVR_TX_DIG->GFSK_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(1) |
+            XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x13B),
+#else
+        XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(1) |
+            XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x100),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 225: XCVR_TX_DIG->IMAGE_FILTER_CTRL */
+        XCVR_FOLDED_IMAGE_FILTER_CTRL | XCVR_TX_DIG_IMAGE_FILTER_CTRL_IMAGE_FILTER_OVRD_EN(0),
+        /* 226: XCVR_TX_DIG->PA_CTRL */
+        XCVR_FOLDED_PA_CTRL | XCVR_TX_DIG_PA_CTRL_PA_RAMP_SEL(1),
+        /* 227: XCVR_TX_DIG->PA_RAMP_TBL0 */
+        XCVR_FOLDED_PA_RAMP_TBL0,
+        /* 228: XCVR_TX_DIG->PA_RAMP_TBL1 */
+        XCVR_FOLDED_PA_RAMP_TBL1,
+        /* 229: XCVR_TX_DIG->PA_RAMP_TBL2 */
+        XCVR_FOLDED_PA_RAMP_TBL2,
+        /* 230: XCVR_TX_DIG->PA_RAMP_TBL3 */
+        XCVR_FOLDED_PA_RAMP_TBL3,
+        /* 231: XCVR_TX_DIG->SWITCH_TX_CTRL */
+        XCVR_FOLDED_SWITCH_TX_CTRL,
+        /* 232: XCVR_TX_DIG->TXDIG_CTRL */
+        XCVR_FOLDED_TXDIG_CTRL | XCVR_TX_DIG_TXDIG_CTRL_DATA_STREAM_SEL(0) | XCVR_TX_DIG_TXDIG_CTRL_MODULATOR_SEL(0) |
+            XCVR_TX_DIG_TXDIG_CTRL_PFC_EN(0),
+    },
+};
+
+const xcvr_folded_config_t xcvr_gfsk_bt_1p0_h_0p5_1mbps_folded_config = {
+    .config     = &xcvr_gfsk_bt_1p0_h_0p5_1mbps_full_config,
+    .reg_values = {
+        /* 0: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x14) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x10) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x0C) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x08) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+        /* 1: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x34) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x30),
+        /* 2: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x2C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x28) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x24),
+        /* 3: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x14) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x10) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x0C) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x08) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+        /* 4: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x34) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x38),
+        /* 5: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x3C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x04),
+        /* 6: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x0C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x08) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x04) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+        /* 7: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x08),
+        /* 8: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x04) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x3C),
+        /* 9: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x0C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x08) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x04) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+        /* 10: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x10),
+        /* 11: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x14) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x18) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x1C),
+        /* 12: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x34) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x38) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x3C) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+        /* 13: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x34) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x30),
+        /* 14: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x2C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x28) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x24),
+        /* 15: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x34) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x38) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x3C) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+        /* 16: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x34) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x38),
+        /* 17: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x3C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x04),
+        /* 18: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x2C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x30) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x34) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x38) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+        /* 19: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x08),
+        /* 20: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x04) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x3C),
+        /* 21: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x2C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x30) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x34) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x38) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+        /* 22: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x10),
+        /* 23: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x14) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x18) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x1C),
+        /* 24: GEN4PHY->DMD_CTRL0 */
+        XCVR_FOLDED_DMD_CTRL0,
+        /* 25: GEN4PHY->DMD_CTRL1 */
+        XCVR_FOLDED_DMD_CTRL1,
+        /* 26: GEN4PHY->FSK_CFG0 */
+        XCVR_FOLDED_FSK_CFG0 | GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_1M(0x0F) |
+            GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_2M(0x11) |
+            GEN4PHY_FSK_CFG0_MSK2FSK_SEED(0) | GEN4PHY_FSK_CFG0_MSK_EN(0),
+        /* 27: GEN4PHY->FSK_CFG1 */
+        GEN4PHY_FSK_CFG1_OVERH(0x020) | GEN4PHY_FSK_CFG1_OVERH_INV(0x100) | GEN4PHY_FSK_CFG1_SYNCTSCALE(0xF),
+        /* 28: GEN4PHY->FSK_CFG2 */
+        XCVR_FOLDED_FSK_CFG2,
+        /* 29: GEN4PHY->FSK_FAD_CFG */
+        XCVR_FOLDED_FSK_FAD_CFG,
+        /* 30: GEN4PHY->FSK_FAD_CTRL */
+        XCVR_FOLDED_FSK_FAD_CTRL,
+        /* 31: GEN4PHY->FSK_PD_CFG0 */
+        GEN4PHY_FSK_PD_CFG0_PD_IIR_ALPHA(0xFF) | GEN4PHY_FSK_PD_CFG0_PREAMBLE_T_SCALE(0xC),
+        /* 32: GEN4PHY->FSK_PD_CFG1 */
+        GEN4PHY_FSK_PD_CFG1_PREAMBLE_PATTERN(0x55),
+        /* 33: GEN4PHY->FSK_PD_CFG2 */
+        GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_1M(0xEB) | GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_2M(0xF6),
+        /* 34: GEN4PHY->FSK_PD_PH[0] */
+        GEN4PHY_FSK_PD_PH_REF0(0x04) | GEN4PHY_FSK_PD_PH_REF1(0x06) | GEN4PHY_FSK_PD_PH_REF2(0x04) |
+            GEN4PHY_FSK_PD_PH_REF3(0x00),
+        /* 35: GEN4PHY->FSK_PD_PH[1] */
+        GEN4PHY_FSK_PD_PH_REF0(0x3C) | GEN4PHY_FSK_PD_PH_REF1(0x3A) | GEN4PHY_FSK_PD_PH_REF2(0x3C) |
+            GEN4PHY_FSK_PD_PH_REF3(0x00),
+        /* 36: GEN4PHY->FSK_PT */
+        XCVR_FOLDED_FSK_PT | GEN4PHY_FSK_PT_AGC_TIMEOUT(0x0048),
+        /* 37: GEN4PHY->LR_AA_CFG */
+        GEN4PHY_LR_AA_CFG_AA_COR_THRESH(0x00) | GEN4PHY_LR_AA_CFG_AA_HAM_THRESH(0x00) |
+            GEN4PHY_LR_AA_CFG_AA_LR_CORR_GAIN(0x00) | GEN4PHY_LR_AA_CFG_ACCESS_ADDR_HAM(0x00),
+        /* 38: GEN4PHY->LR_PD_CFG */
+        GEN4PHY_LR_PD_CFG_CORR_TH(0x00) | GEN4PHY_LR_PD_CFG_FREQ_TH(0x00) | GEN4PHY_LR_PD_CFG_NO_PEAKS(0),
+        /* 39: GEN4PHY->LR_PD_PH[0] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 40: GEN4PHY->LR_PD_PH[1] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 41: GEN4PHY->LR_PD_PH[2] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 42: GEN4PHY->LR_PD_PH[3] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 43: GEN4PHY->MISC */
+        XCVR_FOLDED_MISC,
+        /* 44: GEN4PHY->PREPHY_MISC */
+        XCVR_FOLDED_PREPHY_MISC,
+        /* 45: GEN4PHY->RTT_CTRL */
+        XCVR_FOLDED_RTT_CTRL,
+        /* 46: GEN4PHY->RTT_REF */
+        GEN4PHY_RTT_REF_FM_REF_010(0x5e) | GEN4PHY_RTT_REF_FM_REF_110(0x6e) | GEN4PHY_RTT_REF_FM_REF_111(0x80),
+        /* 47: GEN4PHY->SM_CFG */
+        XCVR_FOLDED_SM_CFG | GEN4PHY_SM_CFG_AA_TIMEOUT_UNCODED(0x0A0),
+        /* 48: RADIO_CTRL->LL_CTRL */
+        RADIO_CTRL_LL_CTRL_ACTIVE_LL(2),
+        /* 49: XCVR_ANALOG->LDO_0 */
+        XCVR_FOLDED_LDO_0,
+        /* 50: XCVR_ANALOG->LDO_1 */
+        XCVR_FOLDED_LDO_1,
+        /* 51: XCVR_ANALOG->PLL */
+        XCVR_FOLDED_PLL,
+        /* 52: XCVR_ANALOG->RX_0 */
+        XCVR_FOLDED_RX_0,
+        /* 53: XCVR_ANALOG->RX_1 */
+        XCVR_FOLDED_RX_1,
+        /* 54: XCVR_ANALOG->TX_DAC_PA */
+        XCVR_FOLDED_TX_DAC_PA | XCVR_ANALOG_TX_DAC_PA_DAC_TRIM_CFBK_DRS(0),
+        /* 55: XCVR_ANALOG->XO_DIST */
+        XCVR_FOLDED_XO_DIST,
+        /* 56: XCVR_MISC->IPS_FO_ADDR[0] */
+        XCVR_MISC_IPS_FO_ADDR_ADDR(0x370) | XCVR_MISC_IPS_FO_ADDR_ENTRY_RX(0) | XCVR_MISC_IPS_FO_ADDR_ENTRY_TX(0),
+        /* 57: XCVR_MISC->IPS_FO_ADDR[1] */
+        XCVR_MISC_IPS_FO_ADDR_ADDR(0x02C) | XCVR_MISC_IPS_FO_ADDR_ENTRY_RX(0) | XCVR_MISC_IPS_FO_ADDR_ENTRY_TX(0),
+        /* 58: XCVR_MISC->IPS_FO_DRS0_DATA[0] */
+        XCVR_MISC_IPS_FO_DRS0_DATA_DRS0_DATA(0x00000000),
+        /* 59: XCVR_MISC->IPS_FO_DRS0_DATA[1] */
+        XCVR_MISC_IPS_FO_DRS0_DATA_DRS0_DATA(0x00000000),
+        /* 60: XCVR_MISC->IPS_FO_DRS1_DATA[0] */
+        XCVR_MISC_IPS_FO_DRS1_DATA_DRS1_DATA(0x00000000),
+        /* 61: XCVR_MISC->IPS_FO_DRS1_DATA[1] */
+        XCVR_MISC_IPS_FO_DRS1_DATA_DRS1_DATA(0x00000000),
+        /* 62: XCVR_MISC->LDO_TRIM_0 */
+        XCVR_FOLDED_LDO_TRIM_0,
+        /* 63: XCVR_MISC->LDO_TRIM_1 */
+        XCVR_FOLDED_LDO_TRIM_1,
+        /* 64: XCVR_MISC->XCVR_CTRL */
+        XCVR_FOLDED_XCVR_CTRL | XCVR_MISC_XCVR_CTRL_DATA_RATE_DRS(0) | XCVR_MISC_XCVR_CTRL_DEMOD_SEL(1) |
+            XCVR_MISC_XCVR_CTRL_LL_CFG_CAPT_DIS(0),
+        /* 65: XCVR_PLL_DIG->CHAN_MAP */
+        XCVR_FOLDED_CHAN_MAP | XCVR_PLL_DIG_CHAN_MAP_BAND_SELECT(0),
+        /* 66: XCVR_PLL_DIG->CHAN_MAP_EXT */
+#if RF_OSC_26MHZ == 1
+        XCVR_FOLDED_CHAN_MAP_EXT | XCVR_PLL_DIG_CHAN_MAP_EXT_NUM_OFFSET(0x013B13B),
+#else
+        XCVR_FOLDED_CHAN_MAP_EXT | XCVR_PLL_DIG_CHAN_MAP_EXT_NUM_OFFSET(0x0100000),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 67: XCVR_PLL_DIG->DATA_RATE_OVRD_CTRL1 */
+        XCVR_FOLDED_DATA_RATE_OVRD_CTRL1,
+        /* 68: XCVR_PLL_DIG->DATA_RATE_OVRD_CTRL2 */
+#if RF_OSC_26MHZ == 1
+        XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL2_NUM_OFFSET_CFG1(0x01D89D9),
+#else
+        XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL2_NUM_OFFSET_CFG1(0x0180000),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 69: XCVR_PLL_DIG->DELAY_MATCH */
+#if RF_OSC_26MHZ == 1
+        XCVR_FOLDED_DELAY_MATCH | XCVR_PLL_DIG_DELAY_MATCH_HPM_INTEGER_DELAY(0x04) |
+            XCVR_PLL_DIG_DELAY_MATCH_LPM_SDM_DELAY(0x02),
+#else
+        XCVR_FOLDED_DELAY_MATCH | XCVR_PLL_DIG_DELAY_MATCH_HPM_INTEGER_DELAY(0x04) |
+            XCVR_PLL_DIG_DELAY_MATCH_LPM_SDM_DELAY(0x03),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 70: XCVR_PLL_DIG->HPMCAL_CTRL */
+        XCVR_FOLDED_HPMCAL_CTRL | XCVR_PLL_DIG_HPMCAL_CTRL_HPM_CAL_ARRAY_SIZE(0),
+        /* 71: XCVR_PLL_DIG->HPM_BUMP */
+        XCVR_FOLDED_HPM_BUMP | XCVR_PLL_DIG_HPM_BUMP_HPM_VCM_CAL(2) | XCVR_PLL_DIG_HPM_BUMP_HPM_VCM_TX(2),
+        /* 72: XCVR_PLL_DIG->HPM_CAL_TIMING */
+        XCVR_FOLDED_HPM_CAL_TIMING,
+        /* 73: XCVR_PLL_DIG->HPM_CTRL */
+        XCVR_FOLDED_HPM_CTRL,
+        /* 74: XCVR_PLL_DIG->HPM_SDM_RES */
+        XCVR_FOLDED_HPM_SDM_RES | XCVR_PLL_DIG_HPM_SDM_RES_HPM_COUNT_ADJUST(0x02),
+        /* 75: XCVR_PLL_DIG->LOCK_DETECT */
+        XCVR_FOLDED_LOCK_DETECT,
+        /* 76: XCVR_PLL_DIG->LPM_CTRL */
+        XCVR_FOLDED_LPM_CTRL,
+        /* 77: XCVR_PLL_DIG->LPM_SDM_CTRL1 */
+        XCVR_FOLDED_LPM_SDM_CTRL1,
+        /* 78: XCVR_PLL_DIG->MOD_CTRL */
+        XCVR_FOLDED_MOD_CTRL,
+        /* 79: XCVR_PLL_DIG->PLL_DATARATE_CTRL */
+        XCVR_FOLDED_PLL_DATARATE_CTRL,
+        /* 80: XCVR_PLL_DIG->TUNING_CAP_RX_CTRL */
+        XCVR_FOLDED_TUNING_CAP_RX_CTRL,
+        /* 81: XCVR_PLL_DIG->TUNING_CAP_TX_CTRL */
+        XCVR_FOLDED_TUNING_CAP_TX_CTRL,
+        /* 82: XCVR_RX_DIG->ACQ_FILT_0_3 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x3E) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x04) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x0D) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x10),
+#else
+        XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x01) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x04) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x7F) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x73),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 83: XCVR_RX_DIG->ACQ_FILT_0_3_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H0(0x06) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H1(0x0A) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H2(0x0A) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H3(0x03),
+#else
+        XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H0(0x01) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H1(0x3E) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H2(0x78) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H3(0x7B),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 84: XCVR_RX_DIG->ACQ_FILT_10_11 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x06C) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x094),
+#else
+        XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x061) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x0EC),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 85: XCVR_RX_DIG->ACQ_FILT_10_11_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x067) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x081),
+#else
+        XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x06E) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x0D1),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 86: XCVR_RX_DIG->ACQ_FILT_4_7 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x06) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x73) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_H6(0xDF) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0xDE),
+#else
+        XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x79) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x14) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_H6(0x21) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0xF7),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 87: XCVR_RX_DIG->ACQ_FILT_4_7_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x75) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x68) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0xE3) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0xF0),
+#else
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x0C) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x19) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0x09) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0xDD),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 88: XCVR_RX_DIG->ACQ_FILT_8_9 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x1FA) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x030),
+#else
+        XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x1BD) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x1D7),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 89: XCVR_RX_DIG->ACQ_FILT_8_9_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x00F) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x03C),
+#else
+        XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x1C7) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x1FA),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 90: XCVR_RX_DIG->AGC_CTRL */
+        XCVR_FOLDED_AGC_CTRL,
+        /* 91: XCVR_RX_DIG->AGC_CTRL_STAT */
+        XCVR_FOLDED_AGC_CTRL_STAT,
+        /* 92: XCVR_RX_DIG->AGC_IDX0_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX0_GAIN_CFG,
+        /* 93: XCVR_RX_DIG->AGC_IDX0_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX0_GAIN_VAL,
+        /* 94: XCVR_RX_DIG->AGC_IDX0_THR */
+        XCVR_FOLDED_AGC_IDX0_THR,
+        /* 95: XCVR_RX_DIG->AGC_IDX10_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX10_GAIN_CFG,
+        /* 96: XCVR_RX_DIG->AGC_IDX10_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX10_GAIN_VAL,
+        /* 97: XCVR_RX_DIG->AGC_IDX10_THR */
+        XCVR_FOLDED_AGC_IDX10_THR,
+        /* 98: XCVR_RX_DIG->AGC_IDX11_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX11_GAIN_CFG | XCVR_RX_DIG_AGC_IDX11_GAIN_CFG_MAG_THR_11_DRS_OFS(0x00) |
+            XCVR_RX_DIG_AGC_IDX11_GAIN_CFG_MAG_THR_HI_11_DRS_OFS(0x00),
+        /* 99: XCVR_RX_DIG->AGC_IDX11_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX11_GAIN_VAL | XCVR_RX_DIG_AGC_IDX11_GAIN_VAL_MAG_THR_11(0x000) |
+            XCVR_RX_DIG_AGC_IDX11_GAIN_VAL_MAG_THR_HI_11(0x000),
+        /* 100: XCVR_RX_DIG->AGC_IDX11_THR */
+        XCVR_FOLDED_AGC_IDX11_THR,
+        /* 101: XCVR_RX_DIG->AGC_IDX1_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX1_GAIN_CFG,
+        /* 102: XCVR_RX_DIG->AGC_IDX1_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX1_GAIN_VAL,
+        /* 103: XCVR_RX_DIG->AGC_IDX1_THR */
+        XCVR_FOLDED_AGC_IDX1_THR,
+        /* 104: XCVR_RX_DIG->AGC_IDX2_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX2_GAIN_CFG,
+        /* 105: XCVR_RX_DIG->AGC_IDX2_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX2_GAIN_VAL,
+        /* 106: XCVR_RX_DIG->AGC_IDX2_THR */
+        XCVR_FOLDED_AGC_IDX2_THR,
+        /* 107: XCVR_RX_DIG->AGC_IDX3_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX3_GAIN_CFG,
+        /* 108: XCVR_RX_DIG->AGC_IDX3_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX3_GAIN_VAL,
+        /* 109: XCVR_RX_DIG->AGC_IDX3_THR */
+        XCVR_FOLDED_AGC_IDX3_THR,
+        /* 110: XCVR_RX_DIG->AGC_IDX4_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX4_GAIN_CFG,
+        /* 111: XCVR_RX_DIG->AGC_IDX4_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX4_GAIN_VAL,
+        /* 112: XCVR_RX_DIG->AGC_IDX4_THR */
+        XCVR_FOLDED_AGC_IDX4_THR,
+        /* 113: XCVR_RX_DIG->AGC_IDX5_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX5_GAIN_CFG,
+        /* 114: XCVR_RX_DIG->AGC_IDX5_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX5_GAIN_VAL,
+        /* 115: XCVR_RX_DIG->AGC_IDX5_THR */
+        XCVR_FOLDED_AGC_IDX5_THR,
+        /* 116: XCVR_RX_DIG->AGC_IDX6_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX6_GAIN_CFG,
+        /* 117: XCVR_RX_DIG->AGC_IDX6_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX6_GAIN_VAL,
+        /* 118: XCVR_RX_DIG->AGC_IDX6_THR */
+        XCVR_FOLDED_AGC_IDX6_THR,
+        /* 119: XCVR_RX_DIG->AGC_IDX7_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX7_GAIN_CFG,
+        /* 120: XCVR_RX_DIG->AGC_IDX7_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX7_GAIN_VAL,
+        /* 121: XCVR_RX_DIG->AGC_IDX7_THR */
+        XCVR_FOLDED_AGC_IDX7_THR,
+        /* 122: XCVR_RX_DIG->AGC_IDX8_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX8_GAIN_CFG,
+        /* 123: XCVR_RX_DIG->AGC_IDX8_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX8_GAIN_VAL,
+        /* 124: XCVR_RX_DIG->AGC_IDX8_THR */
+        XCVR_FOLDED_AGC_IDX8_THR,
+        /* 125: XCVR_RX_DIG->AGC_IDX9_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX9_GAIN_CFG,
+        /* 126: XCVR_RX_DIG->AGC_IDX9_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX9_GAIN_VAL,
+        /* 127: XCVR_RX_DIG->AGC_IDX9_THR */
+        XCVR_FOLDED_AGC_IDX9_THR,
+        /* 128: XCVR_RX_DIG->AGC_MIS_GAIN_CFG */
+        XCVR_FOLDED_AGC_MIS_GAIN_CFG,
+        /* 129: XCVR_RX_DIG->AGC_THR_FAST */
+        XCVR_FOLDED_AGC_THR_FAST,
+        /* 130: XCVR_RX_DIG->AGC_THR_FAST_DRS */
+        XCVR_FOLDED_AGC_THR_FAST_DRS,
+        /* 131: XCVR_RX_DIG->AGC_THR_MIS */
+        XCVR_FOLDED_AGC_THR_MIS,
+        /* 132: XCVR_RX_DIG->AGC_TIMING0 */
+        XCVR_FOLDED_AGC_TIMING0 | XCVR_RX_DIG_AGC_TIMING0_AGC_GAIN_STEP_WAIT(0x10),
+        /* 133: XCVR_RX_DIG->AGC_TIMING0_DRS */
+        XCVR_FOLDED_AGC_TIMING0_DRS | XCVR_RX_DIG_AGC_TIMING0_DRS_AGC_GAIN_STEP_WAIT(0x10),
+        /* 134: XCVR_RX_DIG->AGC_TIMING1 */
+        XCVR_FOLDED_AGC_TIMING1 | XCVR_RX_DIG_AGC_TIMING1_AGC_FREEZE_TIMEOUT(0x0A) |
+            XCVR_RX_DIG_AGC_TIMING1_AGC_HOLD_TIMEOUT(0x08),
+        /* 135: XCVR_RX_DIG->AGC_TIMING1_DRS */
+        XCVR_RX_DIG_AGC_TIMING1_DRS_AGC_FREEZE_TIMEOUT(0x0A) | XCVR_RX_DIG_AGC_TIMING1_DRS_AGC_HOLD_TIMEOUT(0x08),
+        /* 136: XCVR_RX_DIG->AGC_TIMING2 */
+        XCVR_FOLDED_AGC_TIMING2 | XCVR_RX_DIG_AGC_TIMING2_AGC_UNFREEZE_FEAT_TIMEOUT(0x000) |
+            XCVR_RX_DIG_AGC_TIMING2_AGC_UNHOLD_FEAT_TIMEOUT(0x000),
+        /* 137: XCVR_RX_DIG->AGC_TIMING2_DRS */
+        XCVR_RX_DIG_AGC_TIMING2_DRS_AGC_UNFREEZE_FEAT_TIMEOUT(0x000) |
+            XCVR_RX_DIG_AGC_TIMING2_DRS_AGC_UNHOLD_FEAT_TIMEOUT(0x000),
+        /* 138: XCVR_RX_DIG->CTRL0 */
+#if RF_OSC_26MHZ == 1
+        XCVR_FOLDED_CTRL0 | XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(2) |
+            XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x027) |
+            XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(0) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#else
+        XCVR_FOLDED_CTRL0 | XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(3) |
+            XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x020) |
+            XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(0) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 139: XCVR_RX_DIG->CTRL0_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(1) |
+            XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x03B),
+#else
+        XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(2) |
+            XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x030),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 140: XCVR_RX_DIG->CTRL1 */
+        XCVR_FOLDED_CTRL1,
+        /* 141: XCVR_RX_DIG->DCOC_CTRL0 */
+        XCVR_FOLDED_DCOC_CTRL0 | XCVR_RX_DIG_DCOC_CTRL0_DCOC_DAC_ORDER(0) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFII(0x8) |
+            XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFIIP(1) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFQQ(0x2) |
+            XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFQQP(0),
+        /* 142: XCVR_RX_DIG->DCOC_CTRL0_DRS */
+        XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFII(4) | XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFIIP(1) |
+            XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFQQ(1) | XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFQQP(0),
+        /* 143: XCVR_RX_DIG->DCOC_CTRL1 */
+        XCVR_FOLDED_DCOC_CTRL1,
+        /* 144: XCVR_RX_DIG->DEMOD_FILT_0_1 */
+        XCVR_RX_DIG_DEMOD_FILT_0_1_H0(0x1FD) | XCVR_RX_DIG_DEMOD_FILT_0_1_H1(0x1FB),
+        /* 145: XCVR_RX_DIG->DEMOD_FILT_0_1_DRS */
+        XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H0(0x1FD) | XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H1(0x1FB),
+        /* 146: XCVR_RX_DIG->DEMOD_FILT_2_4 */
+        XCVR_RX_DIG_DEMOD_FILT_2_4_H2(0x01E) | XCVR_RX_DIG_DEMOD_FILT_2_4_H3(0x085) |
+            XCVR_RX_DIG_DEMOD_FILT_2_4_H4(0x0C6),
+        /* 147: XCVR_RX_DIG->DEMOD_FILT_2_4_DRS */
+        XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H2(0x01E) | XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H3(0x086) |
+            XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H4(0x0C8),
+        /* 148: XCVR_RX_DIG->NB_RSSI_CTRL0 */
+        XCVR_FOLDED_NB_RSSI_CTRL0,
+        /* 149: XCVR_RX_DIG->NB_RSSI_CTRL1 */
+        XCVR_FOLDED_NB_RSSI_CTRL1,
+        /* 150: XCVR_RX_DIG->RCCAL_CTRL0 */
+        XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE(2) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE_DRS(1) |
+            XCVR_RX_DIG_RCCAL_CTRL0_CBPF_CCODE_OFFSET(0x00) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE(1) |
+            XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE_DRS(0) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CMPOUT_INV(0) |
+            XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CODE_OFFSET(0x0) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_SMPL_DLY(0),
+        /* 151: XCVR_RX_DIG->RSSI_GLOBAL_CTRL */
+        XCVR_FOLDED_RSSI_GLOBAL_CTRL | XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_CCA1_ED_EN(0),
+        /* 152: XCVR_RX_DIG->WB_RSSI_CTRL */
+        XCVR_FOLDED_WB_RSSI_CTRL,
+        /* 153: XCVR_TSM->CTRL */
+        XCVR_FOLDED_CTRL,
+        /* 154: XCVR_TSM->END_OF_SEQ */
+        XCVR_FOLDED_END_OF_SEQ,
+        /* 155: XCVR_TSM->FAST_CTRL1 */
+        XCVR_FOLDED_FAST_CTRL1,
+        /* 156: XCVR_TSM->FAST_CTRL2 */
+        XCVR_FOLDED_FAST_CTRL2,
+        /* 157: XCVR_TSM->FAST_CTRL3 */
+        XCVR_FOLDED_FAST_CTRL3,
+        /* 158: XCVR_TSM->RECYCLE_COUNT */
+        XCVR_FOLDED_RECYCLE_COUNT,
+        /* 159: XCVR_TSM->TIMING00 */
+        XCVR_FOLDED_TIMING00,
+        /* 160: XCVR_TSM->TIMING01 */
+        XCVR_FOLDED_TIMING01,
+        /* 161: XCVR_TSM->TIMING02 */
+        XCVR_FOLDED_TIMING02,
+        /* 162: XCVR_TSM->TIMING03 */
+        XCVR_FOLDED_TIMING03,
+        /* 163: XCVR_TSM->TIMING04 */
+        XCVR_FOLDED_TIMING04,
+        /* 164: XCVR_TSM->TIMING05 */
+        XCVR_FOLDED_TIMING05,
+        /* 165: XCVR_TSM->TIMING06 */
+        XCVR_FOLDED_TIMING06,
+        /* 166: XCVR_TSM->TIMING07 */
+        XCVR_FOLDED_TIMING07,
+        /* 167: XCVR_TSM->TIMING08 */
+        XCVR_FOLDED_TIMING08,
+        /* 168: XCVR_TSM->TIMING09 */
+        XCVR_FOLDED_TIMING09,
+        /* 169: XCVR_TSM->TIMING10 */
+        XCVR_FOLDED_TIMING10,
+        /* 170: XCVR_TSM->TIMING11 */
+        XCVR_FOLDED_TIMING11,
+        /* 171: XCVR_TSM->TIMING12 */
+        XCVR_FOLDED_TIMING12,
+        /* 172: XCVR_TSM->TIMING13 */
+        XCVR_FOLDED_TIMING13,
+        /* 173: XCVR_TSM->TIMING14 */
+        XCVR_FOLDED_TIMING14,
+        /* 174: XCVR_TSM->TIMING15 */
+        XCVR_FOLDED_TIMING15,
+        /* 175: XCVR_TSM->TIMING16 */
+        XCVR_FOLDED_TIMING16,
+        /* 176: XCVR_TSM->TIMING17 */
+        XCVR_FOLDED_TIMING17,
+        /* 177: XCVR_TSM->TIMING18 */
+        XCVR_FOLDED_TIMING18,
+        /* 178: XCVR_TSM->TIMING19 */
+        XCVR_FOLDED_TIMING19,
+        /* 179: XCVR_TSM->TIMING20 */
+        XCVR_FOLDED_TIMING20,
+        /* 180: XCVR_TSM->TIMING21 */
+        XCVR_FOLDED_TIMING21,
+        /* 181: XCVR_TSM->TIMING22 */
+        XCVR_FOLDED_TIMING22,
+        /* 182: XCVR_TSM->TIMING23 */
+        XCVR_FOLDED_TIMING23,
+        /* 183: XCVR_TSM->TIMING24 */
+        XCVR_FOLDED_TIMING24,
+        /* 184: XCVR_TSM->TIMING25 */
+        XCVR_FOLDED_TIMING25,
+        /* 185: XCVR_TSM->TIMING26 */
+        XCVR_FOLDED_TIMING26,
+        /* 186: XCVR_TSM->TIMING27 */
+        XCVR_FOLDED_TIMING27,
+        /* 187: XCVR_TSM->TIMING28 */
+        XCVR_FOLDED_TIMING28,
+        /* 188: XCVR_TSM->TIMING29 */
+        XCVR_FOLDED_TIMING29,
+        /* 189: XCVR_TSM->TIMING30 */
+        XCVR_FOLDED_TIMING30,
+        /* 190: XCVR_TSM->TIMING31 */
+        XCVR_FOLDED_TIMING31,
+        /* 191: XCVR_TSM->TIMING32 */
+        XCVR_FOLDED_TIMING32,
+        /* 192: XCVR_TSM->TIMING33 */
+        XCVR_FOLDED_TIMING33,
+        /* 193: XCVR_TSM->TIMING34 */
+        XCVR_FOLDED_TIMING34,
+        /* 194: XCVR_TSM->TIMING35 */
+        XCVR_FOLDED_TIMING35,
+        /* 195: XCVR_TSM->TIMING36 */
+        XCVR_FOLDED_TIMING36,
+        /* 196: XCVR_TSM->TIMING37 */
+        XCVR_FOLDED_TIMING37,
+        /* 197: XCVR_TSM->TIMING38 */
+        XCVR_FOLDED_TIMING38,
+        /* 198: XCVR_TSM->TIMING39 */
+        XCVR_FOLDED_TIMING39,
+        /* 199: XCVR_TSM->TIMING40 */
+        XCVR_FOLDED_TIMING40,
+        /* 200: XCVR_TSM->TIMING41 */
+        XCVR_FOLDED_TIMING41,
+        /* 201: XCVR_TSM->TIMING42 */
+        XCVR_FOLDED_TIMING42,
+        /* 202: XCVR_TSM->TIMING43 */
+        XCVR_FOLDED_TIMING43,
+        /* 203: XCVR_TSM->TIMING44 */
+        XCVR_FOLDED_TIMING44,
+        /* 204: XCVR_TSM->TIMING45 */
+        XCVR_FOLDED_TIMING45,
+        /* 205: XCVR_TSM->TIMING46 */
+        XCVR_FOLDED_TIMING46,
+        /* 206: XCVR_TSM->TIMING47 */
+        XCVR_FOLDED_TIMING47,
+        /* 207: XCVR_TSM->TIMING48 */
+        XCVR_FOLDED_TIMING48,
+        /* 208: XCVR_TSM->TIMING49 */
+        XCVR_FOLDED_TIMING49,
+        /* 209: XCVR_TSM->TIMING50 */
+        XCVR_FOLDED_TIMING50,
+        /* 210: XCVR_TSM->TIMING51 */
+        XCVR_FOLDED_TIMING51,
+        /* 211: XCVR_TSM->TIMING52 */
+        XCVR_FOLDED_TIMING52,
+        /* 212: XCVR_TSM->WU_LATENCY */
+        XCVR_FOLDED_WU_LATENCY,
+        /* 213: XCVR_TX_DIG->DATARATE_CONFIG_FILTER_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(0),
+#else
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(0),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 214: XCVR_TX_DIG->DATARATE_CONFIG_FSK_CTRL */
+        XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV0(0x0000) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV1(0x0000),
+        /* 215: XCVR_TX_DIG->DATARATE_CONFIG_GFSK_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x09FD),
+#else
+        XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x080D),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 216: XCVR_TX_DIG->DATA_PADDING_CTRL */
+        XCVR_FOLDED_DATA_PADDING_CTRL | XCVR_TX_DIG_DATA_PADDING_CTRL_DATA_PADDING_SEL(0) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_PAD_DLY(0) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_PAD_DLY_EN(1),
+        /* 217: XCVR_TX_DIG->DATA_PADDING_CTRL_1 */
+        XCVR_FOLDED_DATA_PADDING_CTRL_1 | XCVR_TX_DIG_DATA_PADDING_CTRL_1_RAMP_UP_DLY(0x04) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_1_TX_DATA_FLUSH_DLY(0x04),
+        /* 218: XCVR_TX_DIG->DATA_PADDING_CTRL_2 */
+        XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_MFDEV(0x1C00) | XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_PFDEV(0x0400),
+        /* 219: XCVR_TX_DIG->FSK_CTRL */
+        XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_0(0x0000) | XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_1(0x0000),
+        /* 220: XCVR_TX_DIG->GFSK_COEFF_0_1 */
+        XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_0(0x000) | XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_1(0x000),
+        /* 221: XCVR_TX_DIG->GFSK_COEFF_2_3 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_2(0x001) | XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_3(0x008),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_2(0x000) | XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_3(0x000),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 222: XCVR_TX_DIG->GFSK_COEFF_4_5 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_4(0x01E) | XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_5(0x052),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_4(0x001) | XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_5(0x018),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 223: XCVR_TX_DIG->GFSK_COEFF_6_7 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_6(0x0A2) | XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_7(0x0E3),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_6(0x08D) | XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_7(0x158),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 224: XCVR_TX_DIG->GFSK_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(1) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(1) |
+            XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x4E4),
+#else
+        XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(1) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(1) |
+            XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x400),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 225: XCVR_TX_DIG->IMAGE_FILTER_CTRL */
+        XCVR_FOLDED_IMAGE_FILTER_CTRL | XCVR_TX_DIG_IMAGE_FILTER_CTRL_IMAGE_FILTER_OVRD_EN(0),
+        /* 226: XCVR_TX_DIG->PA_CTRL */
+        XCVR_FOLDED_PA_CTRL | XCVR_TX_DIG_PA_CTRL_PA_RAMP_SEL(1),
+        /* 227: XCVR_TX_DIG->PA_RAMP_TBL0 */
+        XCVR_FOLDED_PA_RAMP_TBL0,
+        /* 228: XCVR_TX_DIG->PA_RAMP_TBL1 */
+        XCVR_FOLDED_PA_RAMP_TBL1,
+        /* 229: XCVR_TX_DIG->PA_RAMP_TBL2 */
+        XCVR_FOLDED_PA_RAMP_TBL2,
+        /* 230: XCVR_TX_DIG->PA_RAMP_TBL3 */
+        XCVR_FOLDED_PA_RAMP_TBL3,
+        /* 231: XCVR_TX_DIG->SWITCH_TX_CTRL */
+        XCVR_FOLDED_SWITCH_TX_CTRL,
+        /* 232: XCVR_TX_DIG->TXDIG_CTRL */
+        XCVR_FOLDED_TXDIG_CTRL | XCVR_TX_DIG_TXDIG_CTRL_DATA_STREAM_SEL(0) | XCVR_TX_DIG_TXDIG_CTRL_MODULATOR_SEL(0) |
+            XCVR_TX_DIG_TXDIG_CTRL_PFC_EN(0),
+    },
+};
+
+const xcvr_folded_config_t xcvr_gfsk_bt_2p0_h_0p5_1mbps_folded_config = {
+    .config     = &xcvr_gfsk_bt_2p0_h_0p5_1mbps_full_config,
+    .reg_values = {
+        /* 0: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x14) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x10) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x0C) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x08) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+        /* 1: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x34) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x30),
+        /* 2: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x2C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x28) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x24),
+        /* 3: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x14) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x10) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x0C) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x08) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+        /* 4: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x34) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x38),
+        /* 5: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x3C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x04),
+        /* 6: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x0C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x08) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x04) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+        /* 7: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x08),
+        /* 8: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x04) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x3C),
+        /* 9: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x0C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x08) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x04) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+        /* 10: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x10),
+        /* 11: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x14) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x18) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x1C),
+        /* 12: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x34) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x38) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x3C) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+        /* 13: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x34) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x30),
+        /* 14: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x2C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x28) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x24),
+        /* 15: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x34) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x38) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x3C) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+        /* 16: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x34) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x38),
+        /* 17: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x3C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x04),
+        /* 18: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x2C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x30) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x34) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x38) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+        /* 19: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x08),
+        /* 20: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x04) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x3C),
+        /* 21: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x2C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x30) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x34) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x38) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+        /* 22: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x10),
+        /* 23: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x14) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x18) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x1C),
+        /* 24: GEN4PHY->DMD_CTRL0 */
+        XCVR_FOLDED_DMD_CTRL0,
+        /* 25: GEN4PHY->DMD_CTRL1 */
+        XCVR_FOLDED_DMD_CTRL1,
+        /* 26: GEN4PHY->FSK_CFG0 */
+        XCVR_FOLDED_FSK_CFG0 | GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_1M(0x0F) |
+            GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_2M(0x11) |
+            GEN4PHY_FSK_CFG0_MSK2FSK_SEED(0) | GEN4PHY_FSK_CFG0_MSK_EN(0),
+        /* 27: GEN4PHY->FSK_CFG1 */
+        GEN4PHY_FSK_CFG1_OVERH(0x020) | GEN4PHY_FSK_CFG1_OVERH_INV(0x100) | GEN4PHY_FSK_CFG1_SYNCTSCALE(0xF),
+        /* 28: GEN4PHY->FSK_CFG2 */
+        XCVR_FOLDED_FSK_CFG2,
+        /* 29: GEN4PHY->FSK_FAD_CFG */
+        XCVR_FOLDED_FSK_FAD_CFG,
+        /* 30: GEN4PHY->FSK_FAD_CTRL */
+        XCVR_FOLDED_FSK_FAD_CTRL,
+        /* 31: GEN4PHY->FSK_PD_CFG0 */
+        GEN4PHY_FSK_PD_CFG0_PD_IIR_ALPHA(0xFF) | GEN4PHY_FSK_PD_CFG0_PREAMBLE_T_SCALE(0xC),
+        /* 32: GEN4PHY->FSK_PD_CFG1 */
+        GEN4PHY_FSK_PD_CFG1_PREAMBLE_PATTERN(0x55),
+        /* 33: GEN4PHY->FSK_PD_CFG2 */
+        GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_1M(0xEB) | GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_2M(0xF6),
+        /* 34: GEN4PHY->FSK_PD_PH[0] */
+        GEN4PHY_FSK_PD_PH_REF0(0x04) | GEN4PHY_FSK_PD_PH_REF1(0x06) | GEN4PHY_FSK_PD_PH_REF2(0x04) |
+            GEN4PHY_FSK_PD_PH_REF3(0x00),
+        /* 35: GEN4PHY->FSK_PD_PH[1] */
+        GEN4PHY_FSK_PD_PH_REF0(0x3C) | GEN4PHY_FSK_PD_PH_REF1(0x3A) | GEN4PHY_FSK_PD_PH_REF2(0x3C) |
+            GEN4PHY_FSK_PD_PH_REF3(0x00),
+        /* 36: GEN4PHY->FSK_PT */
+        XCVR_FOLDED_FSK_PT | GEN4PHY_FSK_PT_AGC_TIMEOUT(0x0048),
+        /* 37: GEN4PHY->LR_AA_CFG */
+        GEN4PHY_LR_AA_CFG_AA_COR_THRESH(0x00) | GEN4PHY_LR_AA_CFG_AA_HAM_THRESH(0x00) |
+            GEN4PHY_LR_AA_CFG_AA_LR_CORR_GAIN(0x00) | GEN4PHY_LR_AA_CFG_ACCESS_ADDR_HAM(0x00),
+        /* 38: GEN4PHY->LR_PD_CFG */
+        GEN4PHY_LR_PD_CFG_CORR_TH(0x00) | GEN4PHY_LR_PD_CFG_FREQ_TH(0x00) | GEN4PHY_LR_PD_CFG_NO_PEAKS(0),
+        /* 39: GEN4PHY->LR_PD_PH[0] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 40: GEN4PHY->LR_PD_PH[1] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 41: GEN4PHY->LR_PD_PH[2] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 42: GEN4PHY->LR_PD_PH[3] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 43: GEN4PHY->MISC */
+        XCVR_FOLDED_MISC,
+        /* 44: GEN4PHY->PREPHY_MISC */
+        XCVR_FOLDED_PREPHY_MISC,
+        /* 45: GEN4PHY->RTT_CTRL */
+        XCVR_FOLDED_RTT_CTRL,
+        /* 46: GEN4PHY->RTT_REF */
+        GEN4PHY_RTT_REF_FM_REF_010(0x5e) | GEN4PHY_RTT_REF_FM_REF_110(0x6e) | GEN4PHY_RTT_REF_FM_REF_111(0x80),
+        /* 47: GEN4PHY->SM_CFG */
+        XCVR_FOLDED_SM_CFG | GEN4PHY_SM_CFG_AA_TIMEOUT_UNCODED(0x0A0),
+        /* 48: RADIO_CTRL->LL_CTRL */
+        RADIO_CTRL_LL_CTRL_ACTIVE_LL(2),
+        /* 49: XCVR_ANALOG->LDO_0 */
+        XCVR_FOLDED_LDO_0,
+        /* 50: XCVR_ANALOG->LDO_1 */
+        XCVR_FOLDED_LDO_1,
+        /* 51: XCVR_ANALOG->PLL */
+        XCVR_FOLDED_PLL,
+        /* 52: XCVR_ANALOG->RX_0 */
+        XCVR_FOLDED_RX_0,
+        /* 53: XCVR_ANALOG->RX_1 */
+        XCVR_FOLDED_RX_1,
+        /* 54: XCVR_ANALOG->TX_DAC_PA */
+        XCVR_FOLDED_TX_DAC_PA | XCVR_ANALOG_TX_DAC_PA_DAC_TRIM_CFBK_DRS(0),
+        /* 55: XCVR_ANALOG->XO_DIST */
+        XCVR_FOLDED_XO_DIST,
+        /* 56: XCVR_MISC->IPS_FO_ADDR[0] */
+        XCVR_MISC_IPS_FO_ADDR_ADDR(0x370) | XCVR_MISC_IPS_FO_ADDR_ENTRY_RX(0) | XCVR_MISC_IPS_FO_ADDR_ENTRY_TX(0),
+        /* 57: XCVR_MISC->IPS_FO_ADDR[1] */
+        XCVR_MISC_IPS_FO_ADDR_ADDR(0x02C) | XCVR_MISC_IPS_FO_ADDR_ENTRY_RX(0) | XCVR_MISC_IPS_FO_ADDR_ENTRY_TX(0),
+        /* 58: XCVR_MISC->IPS_FO_DRS0_DATA[0] */
+        XCVR_MISC_IPS_FO_DRS0_DATA_DRS0_DATA(0x00000000),
+        /* 59: XCVR_MISC->IPS_FO_DRS0_DATA[1] */
+        XCVR_MISC_IPS_FO_DRS0_DATA_DRS0_DATA(0x00000000),
+        /* 60: XCVR_MISC->IPS_FO_DRS1_DATA[0] */
+        XCVR_MISC_IPS_FO_DRS1_DATA_DRS1_DATA(0x00000000),
+        /* 61: XCVR_MISC->IPS_FO_DRS1_DATA[1] */
+        XCVR_MISC_IPS_FO_DRS1_DATA_DRS1_DATA(0x00000000),
+        /* 62: XCVR_MISC->LDO_TRIM_0 */
+        XCVR_FOLDED_LDO_TRIM_0,
+        /* 63: XCVR_MISC->LDO_TRIM_1 */
+        XCVR_FOLDED_LDO_TRIM_1,
+        /* 64: XCVR_MISC->XCVR_CTRL */
+        XCVR_FOLDED_XCVR_CTRL | XCVR_MISC_XCVR_CTRL_DATA_RATE_DRS(0) | XCVR_MISC_XCVR_CTRL_DEMOD_SEL(1) |
+            XCVR_MISC_XCVR_CTRL_LL_CFG_CAPT_DIS(0),
+        /* 65: XCVR_PLL_DIG->CHAN_MAP */
+        XCVR_FOLDED_CHAN_MAP | XCVR_PLL_DIG_CHAN_MAP_BAND_SELECT(0),
+        /* 66: XCVR_PLL_DIG->CHAN_MAP_EXT */
+#if RF_OSC_26MHZ == 1
+        XCVR_FOLDED_CHAN_MAP_EXT | XCVR_PLL_DIG_CHAN_MAP_EXT_NUM_OFFSET(0x013B13B),
+#else
+        XCVR_FOLDED_CHAN_MAP_EXT | XCVR_PLL_DIG_CHAN_MAP_EXT_NUM_OFFSET(0x0100000),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 67: XCVR_PLL_DIG->DATA_RATE_OVRD_CTRL1 */
+        XCVR_FOLDED_DATA_RATE_OVRD_CTRL1,
+        /* 68: XCVR_PLL_DIG->DATA_RATE_OVRD_CTRL2 */
+#if RF_OSC_26MHZ == 1
+        XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL2_NUM_OFFSET_CFG1(0x01D89D9),
+#else
+        XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL2_NUM_OFFSET_CFG1(0x0180000),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 69: XCVR_PLL_DIG->DELAY_MATCH */
+#if RF_OSC_26MHZ == 1
+        XCVR_FOLDED_DELAY_MATCH | XCVR_PLL_DIG_DELAY_MATCH_HPM_INTEGER_DELAY(0x04) |
+            XCVR_PLL_DIG_DELAY_MATCH_LPM_SDM_DELAY(0x02),
+#else
+        XCVR_FOLDED_DELAY_MATCH | XCVR_PLL_DIG_DELAY_MATCH_HPM_INTEGER_DELAY(0x04) |
+            XCVR_PLL_DIG_DELAY_MATCH_LPM_SDM_DELAY(0x03),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 70: XCVR_PLL_DIG->HPMCAL_CTRL */
+        XCVR_FOLDED_HPMCAL_CTRL | XCVR_PLL_DIG_HPMCAL_CTRL_HPM_CAL_ARRAY_SIZE(0),
+        /* 71: XCVR_PLL_DIG->HPM_BUMP */
+        XCVR_FOLDED_HPM_BUMP | XCVR_PLL_DIG_HPM_BUMP_HPM_VCM_CAL(2) | XCVR_PLL_DIG_HPM_BUMP_HPM_VCM_TX(2),
+        /* 72: XCVR_PLL_DIG->HPM_CAL_TIMING */
+        XCVR_FOLDED_HPM_CAL_TIMING,
+        /* 73: XCVR_PLL_DIG->HPM_CTRL */
+        XCVR_FOLDED_HPM_CTRL,
+        /* 74: XCVR_PLL_DIG->HPM_SDM_RES */
+        XCVR_FOLDED_HPM_SDM_RES | XCVR_PLL_DIG_HPM_SDM_RES_HPM_COUNT_ADJUST(0x02),
+        /* 75: XCVR_PLL_DIG->LOCK_DETECT */
+        XCVR_FOLDED_LOCK_DETECT,
+        /* 76: XCVR_PLL_DIG->LPM_CTRL */
+        XCVR_FOLDED_LPM_CTRL,
+        /* 77: XCVR_PLL_DIG->LPM_SDM_CTRL1 */
+        XCVR_FOLDED_LPM_SDM_CTRL1,
+        /* 78: XCVR_PLL_DIG->MOD_CTRL */
+        XCVR_FOLDED_MOD_CTRL,
+        /* 79: XCVR_PLL_DIG->PLL_DATARATE_CTRL */
+        XCVR_FOLDED_PLL_DATARATE_CTRL,
+        /* 80: XCVR_PLL_DIG->TUNING_CAP_RX_CTRL */
+        XCVR_FOLDED_TUNING_CAP_RX_CTRL,
+        /* 81: XCVR_PLL_DIG->TUNING_CAP_TX_CTRL */
+        XCVR_FOLDED_TUNING_CAP_TX_CTRL,
+        /* 82: XCVR_RX_DIG->ACQ_FILT_0_3 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x3B) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x01) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x0C) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x13),
+#else
+        XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x01) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x05) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x02) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x74),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 83: XCVR_RX_DIG->ACQ_FILT_0_3_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H0(0x03) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H1(0x0A) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H2(0x0C) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H3(0x07),
+#else
+        XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H0(0x02) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H1(0x00) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H2(0x78) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H3(0x77),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 84: XCVR_RX_DIG->ACQ_FILT_10_11 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x06F) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x09C),
+#else
+        XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x05B) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x0FB),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 85: XCVR_RX_DIG->ACQ_FILT_10_11_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x069) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x088),
+#else
+        XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x06C) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x0DB),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 86: XCVR_RX_DIG->ACQ_FILT_4_7 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x0C) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x77) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_H6(0xDF) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0xD8),
+#else
+        XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x71) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x0F) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_H6(0x28) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0x03),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 87: XCVR_RX_DIG->ACQ_FILT_4_7_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x7A) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x69) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0xE0) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0xE9),
+#else
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x08) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x1B) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0x11) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0xE2),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 88: XCVR_RX_DIG->ACQ_FILT_8_9 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x1F2) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x02B),
+#else
+        XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x1BB) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x1C7),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 89: XCVR_RX_DIG->ACQ_FILT_8_9_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x008) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x039),
+#else
+        XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x1C0) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x1EF),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 90: XCVR_RX_DIG->AGC_CTRL */
+        XCVR_FOLDED_AGC_CTRL,
+        /* 91: XCVR_RX_DIG->AGC_CTRL_STAT */
+        XCVR_FOLDED_AGC_CTRL_STAT,
+        /* 92: XCVR_RX_DIG->AGC_IDX0_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX0_GAIN_CFG,
+        /* 93: XCVR_RX_DIG->AGC_IDX0_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX0_GAIN_VAL,
+        /* 94: XCVR_RX_DIG->AGC_IDX0_THR */
+        XCVR_FOLDED_AGC_IDX0_THR,
+        /* 95: XCVR_RX_DIG->AGC_IDX10_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX10_GAIN_CFG,
+        /* 96: XCVR_RX_DIG->AGC_IDX10_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX10_GAIN_VAL,
+        /* 97: XCVR_RX_DIG->AGC_IDX10_THR */
+        XCVR_FOLDED_AGC_IDX10_THR,
+        /* 98: XCVR_RX_DIG->AGC_IDX11_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX11_GAIN_CFG | XCVR_RX_DIG_AGC_IDX11_GAIN_CFG_MAG_THR_11_DRS_OFS(0x00) |
+            XCVR_RX_DIG_AGC_IDX11_GAIN_CFG_MAG_THR_HI_11_DRS_OFS(0x00),
+        /* 99: XCVR_RX_DIG->AGC_IDX11_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX11_GAIN_VAL | XCVR_RX_DIG_AGC_IDX11_GAIN_VAL_MAG_THR_11(0x000) |
+            XCVR_RX_DIG_AGC_IDX11_GAIN_VAL_MAG_THR_HI_11(0x000),
+        /* 100: XCVR_RX_DIG->AGC_IDX11_THR */
+        XCVR_FOLDED_AGC_IDX11_THR,
+        /* 101: XCVR_RX_DIG->AGC_IDX1_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX1_GAIN_CFG,
+        /* 102: XCVR_RX_DIG->AGC_IDX1_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX1_GAIN_VAL,
+        /* 103: XCVR_RX_DIG->AGC_IDX1_THR */
+        XCVR_FOLDED_AGC_IDX1_THR,
+        /* 104: XCVR_RX_DIG->AGC_IDX2_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX2_GAIN_CFG,
+        /* 105: XCVR_RX_DIG->AGC_IDX2_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX2_GAIN_VAL,
+        /* 106: XCVR_RX_DIG->AGC_IDX2_THR */
+        XCVR_FOLDED_AGC_IDX2_THR,
+        /* 107: XCVR_RX_DIG->AGC_IDX3_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX3_GAIN_CFG,
+        /* 108: XCVR_RX_DIG->AGC_IDX3_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX3_GAIN_VAL,
+        /* 109: XCVR_RX_DIG->AGC_IDX3_THR */
+        XCVR_FOLDED_AGC_IDX3_THR,
+        /* 110: XCVR_RX_DIG->AGC_IDX4_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX4_GAIN_CFG,
+        /* 111: XCVR_RX_DIG->AGC_IDX4_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX4_GAIN_VAL,
+        /* 112: XCVR_RX_DIG->AGC_IDX4_THR */
+        XCVR_FOLDED_AGC_IDX4_THR,
+        /* 113: XCVR_RX_DIG->AGC_IDX5_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX5_GAIN_CFG,
+        /* 114: XCVR_RX_DIG->AGC_IDX5_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX5_GAIN_VAL,
+        /* 115: XCVR_RX_DIG->AGC_IDX5_THR */
+        XCVR_FOLDED_AGC_IDX5_THR,
+        /* 116: XCVR_RX_DIG->AGC_IDX6_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX6_GAIN_CFG,
+        /* 117: XCVR_RX_DIG->AGC_IDX6_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX6_GAIN_VAL,
+        /* 118: XCVR_RX_DIG->AGC_IDX6_THR */
+        XCVR_FOLDED_AGC_IDX6_THR,
+        /* 119: XCVR_RX_DIG->AGC_IDX7_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX7_GAIN_CFG,
+        /* 120: XCVR_RX_DIG->AGC_IDX7_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX7_GAIN_VAL,
+        /* 121: XCVR_RX_DIG->AGC_IDX7_THR */
+        XCVR_FOLDED_AGC_IDX7_THR,
+        /* 122: XCVR_RX_DIG->AGC_IDX8_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX8_GAIN_CFG,
+        /* 123: XCVR_RX_DIG->AGC_IDX8_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX8_GAIN_VAL,
+        /* 124: XCVR_RX_DIG->AGC_IDX8_THR */
+        XCVR_FOLDED_AGC_IDX8_THR,
+        /* 125: XCVR_RX_DIG->AGC_IDX9_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX9_GAIN_CFG,
+        /* 126: XCVR_RX_DIG->AGC_IDX9_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX9_GAIN_VAL,
+        /* 127: XCVR_RX_DIG->AGC_IDX9_THR */
+        XCVR_FOLDED_AGC_IDX9_THR,
+        /* 128: XCVR_RX_DIG->AGC_MIS_GAIN_CFG */
+        XCVR_FOLDED_AGC_MIS_GAIN_CFG,
+        /* 129: XCVR_RX_DIG->AGC_THR_FAST */
+        XCVR_FOLDED_AGC_THR_FAST,
+        /* 130: XCVR_RX_DIG->AGC_THR_FAST_DRS */
+        XCVR_FOLDED_AGC_THR_FAST_DRS,
+        /* 131: XCVR_RX_DIG->AGC_THR_MIS */
+        XCVR_FOLDED_AGC_THR_MIS,
+        /* 132: XCVR_RX_DIG->AGC_TIMING0 */
+        XCVR_FOLDED_AGC_TIMING0 | XCVR_RX_DIG_AGC_TIMING0_AGC_GAIN_STEP_WAIT(0x10),
+        /* 133: XCVR_RX_DIG->AGC_TIMING0_DRS */
+        XCVR_FOLDED_AGC_TIMING0_DRS | XCVR_RX_DIG_AGC_TIMING0_DRS_AGC_GAIN_STEP_WAIT(0x10),
+        /* 134: XCVR_RX_DIG->AGC_TIMING1 */
+        XCVR_FOLDED_AGC_TIMING1 | XCVR_RX_DIG_AGC_TIMING1_AGC_FREEZE_TIMEOUT(0x0A) |
+            XCVR_RX_DIG_AGC_TIMING1_AGC_HOLD_TIMEOUT(0x08),
+        /* 135: XCVR_RX_DIG->AGC_TIMING1_DRS */
+        XCVR_RX_DIG_AGC_TIMING1_DRS_AGC_FREEZE_TIMEOUT(0x0A) | XCVR_RX_DIG_AGC_TIMING1_DRS_AGC_HOLD_TIMEOUT(0x08),
+        /* 136: XCVR_RX_DIG->AGC_TIMING2 */
+        XCVR_FOLDED_AGC_TIMING2 | XCVR_RX_DIG_AGC_TIMING2_AGC_UNFREEZE_FEAT_TIMEOUT(0x000) |
+            XCVR_RX_DIG_AGC_TIMING2_AGC_UNHOLD_FEAT_TIMEOUT(0x000),
+        /* 137: XCVR_RX_DIG->AGC_TIMING2_DRS */
+        XCVR_RX_DIG_AGC_TIMING2_DRS_AGC_UNFREEZE_FEAT_TIMEOUT(0x000) |
+            XCVR_RX_DIG_AGC_TIMING2_DRS_AGC_UNHOLD_FEAT_TIMEOUT(0x000),
+        /* 138: XCVR_RX_DIG->CTRL0 */
+#if RF_OSC_26MHZ == 1
+        XCVR_FOLDED_CTRL0 | XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(2) |
+            XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x027) |
+            XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(0) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#else
+        XCVR_FOLDED_CTRL0 | XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(3) |
+            XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x020) |
+            XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(0) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 139: XCVR_RX_DIG->CTRL0_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(1) |
+            XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x03B),
+#else
+        XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(2) |
+            XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x030),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 140: XCVR_RX_DIG->CTRL1 */
+        XCVR_FOLDED_CTRL1,
+        /* 141: XCVR_RX_DIG->DCOC_CTRL0 */
+        XCVR_FOLDED_DCOC_CTRL0 | XCVR_RX_DIG_DCOC_CTRL0_DCOC_DAC_ORDER(0) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFII(0x8) |
+            XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFIIP(1) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFQQ(0x2) |
+            XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFQQP(0),
+        /* 142: XCVR_RX_DIG->DCOC_CTRL0_DRS */
+        XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFII(4) | XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFIIP(1) |
+            XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFQQ(1) | XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFQQP(0),
+        /* 143: XCVR_RX_DIG->DCOC_CTRL1 */
+        XCVR_FOLDED_DCOC_CTRL1,
+        /* 144: XCVR_RX_DIG->DEMOD_FILT_0_1 */
+        XCVR_RX_DIG_DEMOD_FILT_0_1_H0(0x1FD) | XCVR_RX_DIG_DEMOD_FILT_0_1_H1(0x1FA),
+        /* 145: XCVR_RX_DIG->DEMOD_FILT_0_1_DRS */
+        XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H0(0x1FD) | XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H1(0x1FA),
+        /* 146: XCVR_RX_DIG->DEMOD_FILT_2_4 */
+        XCVR_RX_DIG_DEMOD_FILT_2_4_H2(0x01C) | XCVR_RX_DIG_DEMOD_FILT_2_4_H3(0x086) |
+            XCVR_RX_DIG_DEMOD_FILT_2_4_H4(0x0CA),
+        /* 147: XCVR_RX_DIG->DEMOD_FILT_2_4_DRS */
+        XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H2(0x01A) | XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H3(0x087) |
+            XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H4(0x0CE),
+        /* 148: XCVR_RX_DIG->NB_RSSI_CTRL0 */
+        XCVR_FOLDED_NB_RSSI_CTRL0,
+        /* 149: XCVR_RX_DIG->NB_RSSI_CTRL1 */
+        XCVR_FOLDED_NB_RSSI_CTRL1,
+        /* 150: XCVR_RX_DIG->RCCAL_CTRL0 */
+        XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE(2) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE_DRS(1) |
+            XCVR_RX_DIG_RCCAL_CTRL0_CBPF_CCODE_OFFSET(0x00) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE(1) |
+            XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE_DRS(0) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CMPOUT_INV(0) |
+            XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CODE_OFFSET(0x0) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_SMPL_DLY(0),
+        /* 151: XCVR_RX_DIG->RSSI_GLOBAL_CTRL */
+        XCVR_FOLDED_RSSI_GLOBAL_CTRL | XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_CCA1_ED_EN(0),
+        /* 152: XCVR_RX_DIG->WB_RSSI_CTRL */
+        XCVR_FOLDED_WB_RSSI_CTRL,
+        /* 153: XCVR_TSM->CTRL */
+        XCVR_FOLDED_CTRL,
+        /* 154: XCVR_TSM->END_OF_SEQ */
+        XCVR_FOLDED_END_OF_SEQ,
+        /* 155: XCVR_TSM->FAST_CTRL1 */
+        XCVR_FOLDED_FAST_CTRL1,
+        /* 156: XCVR_TSM->FAST_CTRL2 */
+        XCVR_FOLDED_FAST_CTRL2,
+        /* 157: XCVR_TSM->FAST_CTRL3 */
+        XCVR_FOLDED_FAST_CTRL3,
+        /* 158: XCVR_TSM->RECYCLE_COUNT */
+        XCVR_FOLDED_RECYCLE_COUNT,
+        /* 159: XCVR_TSM->TIMING00 */
+        XCVR_FOLDED_TIMING00,
+        /* 160: XCVR_TSM->TIMING01 */
+        XCVR_FOLDED_TIMING01,
+        /* 161: XCVR_TSM->TIMING02 */
+        XCVR_FOLDED_TIMING02,
+        /* 162: XCVR_TSM->TIMING03 */
+        XCVR_FOLDED_TIMING03,
+        /* 163: XCVR_TSM->TIMING04 */
+        XCVR_FOLDED_TIMING04,
+        /* 164: XCVR_TSM->TIMING05 */
+        XCVR_FOLDED_TIMING05,
+        /* 165: XCVR_TSM->TIMING06 */
+        XCVR_FOLDED_TIMING06,
+        /* 166: XCVR_TSM->TIMING07 */
+        XCVR_FOLDED_TIMING07,
+        /* 167: XCVR_TSM->TIMING08 */
+        XCVR_FOLDED_TIMING08,
+        /* 168: XCVR_TSM->TIMING09 */
+        XCVR_FOLDED_TIMING09,
+        /* 169: XCVR_TSM->TIMING10 */
+        XCVR_FOLDED_TIMING10,
+        /* 170: XCVR_TSM->TIMING11 */
+        XCVR_FOLDED_TIMING11,
+        /* 171: XCVR_TSM->TIMING12 */
+        XCVR_FOLDED_TIMING12,
+        /* 172: XCVR_TSM->TIMING13 */
+        XCVR_FOLDED_TIMING13,
+        /* 173: XCVR_TSM->TIMING14 */
+        XCVR_FOLDED_TIMING14,
+        /* 174: XCVR_TSM->TIMING15 */
+        XCVR_FOLDED_TIMING15,
+        /* 175: XCVR_TSM->TIMING16 */
+        XCVR_FOLDED_TIMING16,
+        /* 176: XCVR_TSM->TIMING17 */
+        XCVR_FOLDED_TIMING17,
+        /* 177: XCVR_TSM->TIMING18 */
+        XCVR_FOLDED_TIMING18,
+        /* 178: XCVR_TSM->TIMING19 */
+        XCVR_FOLDED_TIMING19,
+        /* 179: XCVR_TSM->TIMING20 */
+        XCVR_FOLDED_TIMING20,
+        /* 180: XCVR_TSM->TIMING21 */
+        XCVR_FOLDED_TIMING21,
+        /* 181: XCVR_TSM->TIMING22 */
+        XCVR_FOLDED_TIMING22,
+        /* 182: XCVR_TSM->TIMING23 */
+        XCVR_FOLDED_TIMING23,
+        /* 183: XCVR_TSM->TIMING24 */
+        XCVR_FOLDED_TIMING24,
+        /* 184: XCVR_TSM->TIMING25 */
+        XCVR_FOLDED_TIMING25,
+        /* 185: XCVR_TSM->TIMING26 */
+        XCVR_FOLDED_TIMING26,
+        /* 186: XCVR_TSM->TIMING27 */
+        XCVR_FOLDED_TIMING27,
+        /* 187: XCVR_TSM->TIMING28 */
+        XCVR_FOLDED_TIMING28,
+        /* 188: XCVR_TSM->TIMING29 */
+        XCVR_FOLDED_TIMING29,
+        /* 189: XCVR_TSM->TIMING30 */
+        XCVR_FOLDED_TIMING30,
+        /* 190: XCVR_TSM->TIMING31 */
+        XCVR_FOLDED_TIMING31,
+        /* 191: XCVR_TSM->TIMING32 */
+        XCVR_FOLDED_TIMING32,
+        /* 192: XCVR_TSM->TIMING33 */
+        XCVR_FOLDED_TIMING33,
+        /* 193: XCVR_TSM->TIMING34 */
+        XCVR_FOLDED_TIMING34,
+        /* 194: XCVR_TSM->TIMING35 */
+        XCVR_FOLDED_TIMING35,
+        /* 195: XCVR_TSM->TIMING36 */
+        XCVR_FOLDED_TIMING36,
+        /* 196: XCVR_TSM->TIMING37 */
+        XCVR_FOLDED_TIMING37,
+        /* 197: XCVR_TSM->TIMING38 */
+        XCVR_FOLDED_TIMING38,
+        /* 198: XCVR_TSM->TIMING39 */
+        XCVR_FOLDED_TIMING39,
+        /* 199: XCVR_TSM->TIMING40 */
+        XCVR_FOLDED_TIMING40,
+        /* 200: XCVR_TSM->TIMING41 */
+        XCVR_FOLDED_TIMING41,
+        /* 201: XCVR_TSM->TIMING42 */
+        XCVR_FOLDED_TIMING42,
+        /* 202: XCVR_TSM->TIMING43 */
+        XCVR_FOLDED_TIMING43,
+        /* 203: XCVR_TSM->TIMING44 */
+        XCVR_FOLDED_TIMING44,
+        /* 204: XCVR_TSM->TIMING45 */
+        XCVR_FOLDED_TIMING45,
+        /* 205: XCVR_TSM->TIMING46 */
+        XCVR_FOLDED_TIMING46,
+        /* 206: XCVR_TSM->TIMING47 */
+        XCVR_FOLDED_TIMING47,
+        /* 207: XCVR_TSM->TIMING48 */
+        XCVR_FOLDED_TIMING48,
+        /* 208: XCVR_TSM->TIMING49 */
+        XCVR_FOLDED_TIMING49,
+        /* 209: XCVR_TSM->TIMING50 */
+        XCVR_FOLDED_TIMING50,
+        /* 210: XCVR_TSM->TIMING51 */
+        XCVR_FOLDED_TIMING51,
+        /* 211: XCVR_TSM->TIMING52 */
+        XCVR_FOLDED_TIMING52,
+        /* 212: XCVR_TSM->WU_LATENCY */
+        XCVR_FOLDED_WU_LATENCY,
+        /* 213: XCVR_TX_DIG->DATARATE_CONFIG_FILTER_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(0),
+#else
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(0),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 214: XCVR_TX_DIG->DATARATE_CONFIG_FSK_CTRL */
+        XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV0(0x0000) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV1(0x0000),
+        /* 215: XCVR_TX_DIG->DATARATE_CONFIG_GFSK_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x09FD),
+#else
+        XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x080D),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 216: XCVR_TX_DIG->DATA_PADDING_CTRL */
+        XCVR_FOLDED_DATA_PADDING_CTRL | XCVR_TX_DIG_DATA_PADDING_CTRL_DATA_PADDING_SEL(0) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_PAD_DLY(0) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_PAD_DLY_EN(1),
+        /* 217: XCVR_TX_DIG->DATA_PADDING_CTRL_1 */
+        XCVR_FOLDED_DATA_PADDING_CTRL_1 | XCVR_TX_DIG_DATA_PADDING_CTRL_1_RAMP_UP_DLY(0x04) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_1_TX_DATA_FLUSH_DLY(0x04),
+        /* 218: XCVR_TX_DIG->DATA_PADDING_CTRL_2 */
+        XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_MFDEV(0x1C00) | XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_PFDEV(0x0400),
+        /* 219: XCVR_TX_DIG->FSK_CTRL */
+        XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_0(0x0000) | XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_1(0x0000),
+        /* 220: XCVR_TX_DIG->GFSK_COEFF_0_1 */
+        XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_0(0x000) | XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_1(0x000),
+        /* 221: XCVR_TX_DIG->GFSK_COEFF_2_3 */
+        XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_2(0x000) | XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_3(0x000),
+        /* 222: XCVR_TX_DIG->GFSK_COEFF_4_5 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_4(0x000) | XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_5(0x007),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_4(0x000) | XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_5(0x000),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 223: XCVR_TX_DIG->GFSK_COEFF_6_7 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_6(0x068) | XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_7(0x191),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_6(0x00E) | XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_7(0x1F1),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 224: XCVR_TX_DIG->GFSK_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(1) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(1) |
+            XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x4E4),
+#else
+        XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(1) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(1) |
+            XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x400),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 225: XCVR_TX_DIG->IMAGE_FILTER_CTRL */
+        XCVR_FOLDED_IMAGE_FILTER_CTRL | XCVR_TX_DIG_IMAGE_FILTER_CTRL_IMAGE_FILTER_OVRD_EN(0),
+        /* 226: XCVR_TX_DIG->PA_CTRL */
+        XCVR_FOLDED_PA_CTRL | XCVR_TX_DIG_PA_CTRL_PA_RAMP_SEL(1),
+        /* 227: XCVR_TX_DIG->PA_RAMP_TBL0 */
+        XCVR_FOLDED_PA_RAMP_TBL0,
+        /* 228: XCVR_TX_DIG->PA_RAMP_TBL1 */
+        XCVR_FOLDED_PA_RAMP_TBL1,
+        /* 229: XCVR_TX_DIG->PA_RAMP_TBL2 */
+        XCVR_FOLDED_PA_RAMP_TBL2,
+        /* 230: XCVR_TX_DIG->PA_RAMP_TBL3 */
+        XCVR_FOLDED_PA_RAMP_TBL3,
+        /* 231: XCVR_TX_DIG->SWITCH_TX_CTRL */
+        XCVR_FOLDED_SWITCH_TX_CTRL,
+        /* 232: XCVR_TX_DIG->TXDIG_CTRL */
+        XCVR_FOLDED_TXDIG_CTRL | XCVR_TX_DIG_TXDIG_CTRL_DATA_STREAM_SEL(0) | XCVR_TX_DIG_TXDIG_CTRL_MODULATOR_SEL(0) |
+            XCVR_TX_DIG_TXDIG_CTRL_PFC_EN(0),
+    },
+};
+
+const xcvr_folded_config_t xcvr_msk_1mbps_folded_config = {
+    .config     = &xcvr_msk_1mbps_full_config,
+    .reg_values = {
+        /* 0: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x14) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x10) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x0C) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x08) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+        /* 1: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x34) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x30),
+        /* 2: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x2C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x28) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x24),
+        /* 3: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x14) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x10) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x0C) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x08) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+        /* 4: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x34) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x38),
+        /* 5: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x3C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x04),
+        /* 6: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x0C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x08) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x04) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+        /* 7: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x08),
+        /* 8: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x04) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x3C),
+        /* 9: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x0C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x08) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x04) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+        /* 10: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x10),
+        /* 11: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x14) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x18) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x1C),
+        /* 12: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x34) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x38) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x3C) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+        /* 13: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x34) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x30),
+        /* 14: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x2C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x28) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x24),
+        /* 15: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x34) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x38) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x3C) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+        /* 16: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x34) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x38),
+        /* 17: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x3C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x04),
+        /* 18: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x2C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x30) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x34) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x38) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+        /* 19: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x08),
+        /* 20: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x04) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x3C),
+        /* 21: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x2C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x30) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x34) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x38) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+        /* 22: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x10),
+        /* 23: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x14) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x18) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x1C),
+        /* 24: GEN4PHY->DMD_CTRL0 */
+        XCVR_FOLDED_DMD_CTRL0,
+        /* 25: GEN4PHY->DMD_CTRL1 */
+        XCVR_FOLDED_DMD_CTRL1,
+        /* 26: GEN4PHY->FSK_CFG0 */
+        XCVR_FOLDED_FSK_CFG0 | GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_1M(0x1A) |
+            GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_2M(0x1C) |
+            GEN4PHY_FSK_CFG0_MSK2FSK_SEED(1) | GEN4PHY_FSK_CFG0_MSK_EN(1),
+        /* 27: GEN4PHY->FSK_CFG1 */
+        GEN4PHY_FSK_CFG1_OVERH(0x020) | GEN4PHY_FSK_CFG1_OVERH_INV(0x100) | GEN4PHY_FSK_CFG1_SYNCTSCALE(0xF),
+        /* 28: GEN4PHY->FSK_CFG2 */
+        XCVR_FOLDED_FSK_CFG2,
+        /* 29: GEN4PHY->FSK_FAD_CFG */
+        XCVR_FOLDED_FSK_FAD_CFG,
+        /* 30: GEN4PHY->FSK_FAD_CTRL */
+        XCVR_FOLDED_FSK_FAD_CTRL,
+        /* 31: GEN4PHY->FSK_PD_CFG0 */
+        GEN4PHY_FSK_PD_CFG0_PD_IIR_ALPHA(0xFF) | GEN4PHY_FSK_PD_CFG0_PREAMBLE_T_SCALE(0xC),
+        /* 32: GEN4PHY->FSK_PD_CFG1 */
+        GEN4PHY_FSK_PD_CFG1_PREAMBLE_PATTERN(0x55),
+        /* 33: GEN4PHY->FSK_PD_CFG2 */
+        GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_1M(0xE6) | GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_2M(0xF6),
+        /* 34: GEN4PHY->FSK_PD_PH[0] */
+        GEN4PHY_FSK_PD_PH_REF0(0x03) | GEN4PHY_FSK_PD_PH_REF1(0x05) | GEN4PHY_FSK_PD_PH_REF2(0x03) |
+            GEN4PHY_FSK_PD_PH_REF3(0x00),
+        /* 35: GEN4PHY->FSK_PD_PH[1] */
+        GEN4PHY_FSK_PD_PH_REF0(0x3D) | GEN4PHY_FSK_PD_PH_REF1(0x3B) | GEN4PHY_FSK_PD_PH_REF2(0x3D) |
+            GEN4PHY_FSK_PD_PH_REF3(0x00),
+        /* 36: GEN4PHY->FSK_PT */
+        XCVR_FOLDED_FSK_PT | GEN4PHY_FSK_PT_AGC_TIMEOUT(0x0048),
+        /* 37: GEN4PHY->LR_AA_CFG */
+        GEN4PHY_LR_AA_CFG_AA_COR_THRESH(0x00) | GEN4PHY_LR_AA_CFG_AA_HAM_THRESH(0x00) |
+            GEN4PHY_LR_AA_CFG_AA_LR_CORR_GAIN(0x00) | GEN4PHY_LR_AA_CFG_ACCESS_ADDR_HAM(0x00),
+        /* 38: GEN4PHY->LR_PD_CFG */
+        GEN4PHY_LR_PD_CFG_CORR_TH(0x00) | GEN4PHY_LR_PD_CFG_FREQ_TH(0x00) | GEN4PHY_LR_PD_CFG_NO_PEAKS(0),
+        /* 39: GEN4PHY->LR_PD_PH[0] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 40: GEN4PHY->LR_PD_PH[1] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 41: GEN4PHY->LR_PD_PH[2] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 42: GEN4PHY->LR_PD_PH[3] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 43: GEN4PHY->MISC */
+        XCVR_FOLDED_MISC,
+        /* 44: GEN4PHY->PREPHY_MISC */
+        XCVR_FOLDED_PREPHY_MISC,
+        /* 45: GEN4PHY->RTT_CTRL */
+        XCVR_FOLDED_RTT_CTRL,
+        /* 46: GEN4PHY->RTT_REF */
+        GEN4PHY_RTT_REF_FM_REF_010(0x48) | GEN4PHY_RTT_REF_FM_REF_110(0x63) | GEN4PHY_RTT_REF_FM_REF_111(0x80),
+        /* 47: GEN4PHY->SM_CFG */
+        XCVR_FOLDED_SM_CFG | GEN4PHY_SM_CFG_AA_TIMEOUT_UNCODED(0x0A0),
+        /* 48: RADIO_CTRL->LL_CTRL */
+        RADIO_CTRL_LL_CTRL_ACTIVE_LL(2),
+        /* 49: XCVR_ANALOG->LDO_0 */
+        XCVR_FOLDED_LDO_0,
+        /* 50: XCVR_ANALOG->LDO_1 */
+        XCVR_FOLDED_LDO_1,
+        /* 51: XCVR_ANALOG->PLL */
+        XCVR_FOLDED_PLL,
+        /* 52: XCVR_ANALOG->RX_0 */
+        XCVR_FOLDED_RX_0,
+        /* 53: XCVR_ANALOG->RX_1 */
+        XCVR_FOLDED_RX_1,
+        /* 54: XCVR_ANALOG->TX_DAC_PA */
+        XCVR_FOLDED_TX_DAC_PA | XCVR_ANALOG_TX_DAC_PA_DAC_TRIM_CFBK_DRS(0),
+        /* 55: XCVR_ANALOG->XO_DIST */
+        XCVR_FOLDED_XO_DIST,
+        /* 56: XCVR_MISC->IPS_FO_ADDR[0] */
+        XCVR_MISC_IPS_FO_ADDR_ADDR(0x370) | XCVR_MISC_IPS_FO_ADDR_ENTRY_RX(0) | XCVR_MISC_IPS_FO_ADDR_ENTRY_TX(0),
+        /* 57: XCVR_MISC->IPS_FO_ADDR[1] */
+        XCVR_MISC_IPS_FO_ADDR_ADDR(0x02C) | XCVR_MISC_IPS_FO_ADDR_ENTRY_RX(0) | XCVR_MISC_IPS_FO_ADDR_ENTRY_TX(0),
+        /* 58: XCVR_MISC->IPS_FO_DRS0_DATA[0] */
+        XCVR_MISC_IPS_FO_DRS0_DATA_DRS0_DATA(0x00000000),
+        /* 59: XCVR_MISC->IPS_FO_DRS0_DATA[1] */
+        XCVR_MISC_IPS_FO_DRS0_DATA_DRS0_DATA(0x00000000),
+        /* 60: XCVR_MISC->IPS_FO_DRS1_DATA[0] */
+        XCVR_MISC_IPS_FO_DRS1_DATA_DRS1_DATA(0x00000000),
+        /* 61: XCVR_MISC->IPS_FO_DRS1_DATA[1] */
+        XCVR_MISC_IPS_FO_DRS1_DATA_DRS1_DATA(0x00000000),
+        /* 62: XCVR_MISC->LDO_TRIM_0 */
+        XCVR_FOLDED_LDO_TRIM_0,
+        /* 63: XCVR_MISC->LDO_TRIM_1 */
+        XCVR_FOLDED_LDO_TRIM_1,
+        /* 64: XCVR_MISC->XCVR_CTRL */
+        XCVR_FOLDED_XCVR_CTRL | XCVR_MISC_XCVR_CTRL_DATA_RATE_DRS(0) | XCVR_MISC_XCVR_CTRL_DEMOD_SEL(1) |
+            XCVR_MISC_XCVR_CTRL_LL_CFG_CAPT_DIS(0),
+        /* 65: XCVR_PLL_DIG->CHAN_MAP */
+        XCVR_FOLDED_CHAN_MAP | XCVR_PLL_DIG_CHAN_MAP_BAND_SELECT(0),
+        /* 66: XCVR_PLL_DIG->CHAN_MAP_EXT */
+#if RF_OSC_26MHZ == 1
+        XCVR_FOLDED_CHAN_MAP_EXT | XCVR_PLL_DIG_CHAN_MAP_EXT_NUM_OFFSET(0x013B13B),
+#else
+        XCVR_FOLDED_CHAN_MAP_EXT | XCVR_PLL_DIG_CHAN_MAP_EXT_NUM_OFFSET(0x0100000),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 67: XCVR_PLL_DIG->DATA_RATE_OVRD_CTRL1 */
+        XCVR_FOLDED_DATA_RATE_OVRD_CTRL1,
+        /* 68: XCVR_PLL_DIG->DATA_RATE_OVRD_CTRL2 */
+#if RF_OSC_26MHZ == 1
+        XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL2_NUM_OFFSET_CFG1(0x01D89D9),
+#else
+        XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL2_NUM_OFFSET_CFG1(0x0180000),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 69: XCVR_PLL_DIG->DELAY_MATCH */
+        XCVR_FOLDED_DELAY_MATCH | XCVR_PLL_DIG_DELAY_MATCH_HPM_INTEGER_DELAY(0x04) |
+            XCVR_PLL_DIG_DELAY_MATCH_LPM_SDM_DELAY(0x03),
+        /* 70: XCVR_PLL_DIG->HPMCAL_CTRL */
+        XCVR_FOLDED_HPMCAL_CTRL | XCVR_PLL_DIG_HPMCAL_CTRL_HPM_CAL_ARRAY_SIZE(0),
+        /* 71: XCVR_PLL_DIG->HPM_BUMP */
+        XCVR_FOLDED_HPM_BUMP | XCVR_PLL_DIG_HPM_BUMP_HPM_VCM_CAL(2) | XCVR_PLL_DIG_HPM_BUMP_HPM_VCM_TX(2),
+        /* 72: XCVR_PLL_DIG->HPM_CAL_TIMING */
+        XCVR_FOLDED_HPM_CAL_TIMING,
+        /* 73: XCVR_PLL_DIG->HPM_CTRL */
+        XCVR_FOLDED_HPM_CTRL,
+        /* 74: XCVR_PLL_DIG->HPM_SDM_RES */
+        XCVR_FOLDED_HPM_SDM_RES | XCVR_PLL_DIG_HPM_SDM_RES_HPM_COUNT_ADJUST(0x02),
+        /* 75: XCVR_PLL_DIG->LOCK_DETECT */
+        XCVR_FOLDED_LOCK_DETECT,
+        /* 76: XCVR_PLL_DIG->LPM_CTRL */
+        XCVR_FOLDED_LPM_CTRL,
+        /* 77: XCVR_PLL_DIG->LPM_SDM_CTRL1 */
+        XCVR_FOLDED_LPM_SDM_CTRL1,
+        /* 78: XCVR_PLL_DIG->MOD_CTRL */
+        XCVR_FOLDED_MOD_CTRL,
+        /* 79: XCVR_PLL_DIG->PLL_DATARATE_CTRL */
+        XCVR_FOLDED_PLL_DATARATE_CTRL,
+        /* 80: XCVR_PLL_DIG->TUNING_CAP_RX_CTRL */
+        XCVR_FOLDED_TUNING_CAP_RX_CTRL,
+        /* 81: XCVR_PLL_DIG->TUNING_CAP_TX_CTRL */
+        XCVR_FOLDED_TUNING_CAP_TX_CTRL,
+        /* 82: XCVR_RX_DIG->ACQ_FILT_0_3 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x03) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x00) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x78) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x77),
+#else
+        XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x02) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x05) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x7F) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x73),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 83: XCVR_RX_DIG->ACQ_FILT_0_3_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H0(0x3F) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H1(0x03) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H2(0x08) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H3(0x0A),
+#else
+        XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H0(0x02) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H1(0x3E) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H2(0x78) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H3(0x7A),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 84: XCVR_RX_DIG->ACQ_FILT_10_11 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x066) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x0C9),
+#else
+        XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x061) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x0EF),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 85: XCVR_RX_DIG->ACQ_FILT_10_11_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x069) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x08E),
+#else
+        XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x06E) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x0D4),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 86: XCVR_RX_DIG->ACQ_FILT_4_7 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x06) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x1A) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_H6(0x11) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0xE7),
+#else
+        XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x78) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x14) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_H6(0x22) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0xF8),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 87: XCVR_RX_DIG->ACQ_FILT_4_7_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x03) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x74) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0xE6) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0xE6),
+#else
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x0B) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x1A) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0x0C) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0xDF),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 88: XCVR_RX_DIG->ACQ_FILT_8_9 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x1CA) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x1F5),
+#else
+        XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x1BC) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x1D5),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 89: XCVR_RX_DIG->ACQ_FILT_8_9_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x1FF) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x031),
+#else
+        XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x1C5) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x1F7),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 90: XCVR_RX_DIG->AGC_CTRL */
+        XCVR_FOLDED_AGC_CTRL,
+        /* 91: XCVR_RX_DIG->AGC_CTRL_STAT */
+        XCVR_FOLDED_AGC_CTRL_STAT,
+        /* 92: XCVR_RX_DIG->AGC_IDX0_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX0_GAIN_CFG,
+        /* 93: XCVR_RX_DIG->AGC_IDX0_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX0_GAIN_VAL,
+        /* 94: XCVR_RX_DIG->AGC_IDX0_THR */
+        XCVR_FOLDED_AGC_IDX0_THR,
+        /* 95: XCVR_RX_DIG->AGC_IDX10_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX10_GAIN_CFG,
+        /* 96: XCVR_RX_DIG->AGC_IDX10_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX10_GAIN_VAL,
+        /* 97: XCVR_RX_DIG->AGC_IDX10_THR */
+        XCVR_FOLDED_AGC_IDX10_THR,
+        /* 98: XCVR_RX_DIG->AGC_IDX11_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX11_GAIN_CFG | XCVR_RX_DIG_AGC_IDX11_GAIN_CFG_MAG_THR_11_DRS_OFS(0x00) |
+            XCVR_RX_DIG_AGC_IDX11_GAIN_CFG_MAG_THR_HI_11_DRS_OFS(0x00),
+        /* 99: XCVR_RX_DIG->AGC_IDX11_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX11_GAIN_VAL | XCVR_RX_DIG_AGC_IDX11_GAIN_VAL_MAG_THR_11(0x000) |
+            XCVR_RX_DIG_AGC_IDX11_GAIN_VAL_MAG_THR_HI_11(0x000),
+        /* 100: XCVR_RX_DIG->AGC_IDX11_THR */
+        XCVR_FOLDED_AGC_IDX11_THR,
+        /* 101: XCVR_RX_DIG->AGC_IDX1_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX1_GAIN_CFG,
+        /* 102: XCVR_RX_DIG->AGC_IDX1_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX1_GAIN_VAL,
+        /* 103: XCVR_RX_DIG->AGC_IDX1_THR */
+        XCVR_FOLDED_AGC_IDX1_THR,
+        /* 104: XCVR_RX_DIG->AGC_IDX2_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX2_GAIN_CFG,
+        /* 105: XCVR_RX_DIG->AGC_IDX2_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX2_GAIN_VAL,
+        /* 106: XCVR_RX_DIG->AGC_IDX2_THR */
+        XCVR_FOLDED_AGC_IDX2_THR,
+        /* 107: XCVR_RX_DIG->AGC_IDX3_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX3_GAIN_CFG,
+        /* 108: XCVR_RX_DIG->AGC_IDX3_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX3_GAIN_VAL,
+        /* 109: XCVR_RX_DIG->AGC_IDX3_THR */
+        XCVR_FOLDED_AGC_IDX3_THR,
+        /* 110: XCVR_RX_DIG->AGC_IDX4_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX4_GAIN_CFG,
+        /* 111: XCVR_RX_DIG->AGC_IDX4_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX4_GAIN_VAL,
+        /* 112: XCVR_RX_DIG->AGC_IDX4_THR */
+        XCVR_FOLDED_AGC_IDX4_THR,
+        /* 113: XCVR_RX_DIG->AGC_IDX5_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX5_GAIN_CFG,
+        /* 114: XCVR_RX_DIG->AGC_IDX5_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX5_GAIN_VAL,
+        /* 115: XCVR_RX_DIG->AGC_IDX5_THR */
+        XCVR_FOLDED_AGC_IDX5_THR,
+        /* 116: XCVR_RX_DIG->AGC_IDX6_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX6_GAIN_CFG,
+        /* 117: XCVR_RX_DIG->AGC_IDX6_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX6_GAIN_VAL,
+        /* 118: XCVR_RX_DIG->AGC_IDX6_THR */
+        XCVR_FOLDED_AGC_IDX6_THR,
+        /* 119: XCVR_RX_DIG->AGC_IDX7_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX7_GAIN_CFG,
+        /* 120: XCVR_RX_DIG->AGC_IDX7_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX7_GAIN_VAL,
+        /* 121: XCVR_RX_DIG->AGC_IDX7_THR */
+        XCVR_FOLDED_AGC_IDX7_THR,
+        /* 122: XCVR_RX_DIG->AGC_IDX8_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX8_GAIN_CFG,
+        /* 123: XCVR_RX_DIG->AGC_IDX8_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX8_GAIN_VAL,
+        /* 124: XCVR_RX_DIG->AGC_IDX8_THR */
+        XCVR_FOLDED_AGC_IDX8_THR,
+        /* 125: XCVR_RX_DIG->AGC_IDX9_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX9_GAIN_CFG,
+        /* 126: XCVR_RX_DIG->AGC_IDX9_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX9_GAIN_VAL,
+        /* 127: XCVR_RX_DIG->AGC_IDX9_THR */
+        XCVR_FOLDED_AGC_IDX9_THR,
+        /* 128: XCVR_RX_DIG->AGC_MIS_GAIN_CFG */
+        XCVR_FOLDED_AGC_MIS_GAIN_CFG,
+        /* 129: XCVR_RX_DIG->AGC_THR_FAST */
+        XCVR_FOLDED_AGC_THR_FAST,
+        /* 130: XCVR_RX_DIG->AGC_THR_FAST_DRS */
+        XCVR_FOLDED_AGC_THR_FAST_DRS,
+        /* 131: XCVR_RX_DIG->AGC_THR_MIS */
+        XCVR_FOLDED_AGC_THR_MIS,
+        /* 132: XCVR_RX_DIG->AGC_TIMING0 */
+        XCVR_FOLDED_AGC_TIMING0 | XCVR_RX_DIG_AGC_TIMING0_AGC_GAIN_STEP_WAIT(0x08),
+        /* 133: XCVR_RX_DIG->AGC_TIMING0_DRS */
+        XCVR_FOLDED_AGC_TIMING0_DRS | XCVR_RX_DIG_AGC_TIMING0_DRS_AGC_GAIN_STEP_WAIT(0x08),
+        /* 134: XCVR_RX_DIG->AGC_TIMING1 */
+        XCVR_FOLDED_AGC_TIMING1 | XCVR_RX_DIG_AGC_TIMING1_AGC_FREEZE_TIMEOUT(0x27) |
+            XCVR_RX_DIG_AGC_TIMING1_AGC_HOLD_TIMEOUT(0x05),
+        /* 135: XCVR_RX_DIG->AGC_TIMING1_DRS */
+        XCVR_RX_DIG_AGC_TIMING1_DRS_AGC_FREEZE_TIMEOUT(0x0A) | XCVR_RX_DIG_AGC_TIMING1_DRS_AGC_HOLD_TIMEOUT(0x08),
+        /* 136: XCVR_RX_DIG->AGC_TIMING2 */
+        XCVR_FOLDED_AGC_TIMING2 | XCVR_RX_DIG_AGC_TIMING2_AGC_UNFREEZE_FEAT_TIMEOUT(0x07F) |
+            XCVR_RX_DIG_AGC_TIMING2_AGC_UNHOLD_FEAT_TIMEOUT(0x000),
+        /* 137: XCVR_RX_DIG->AGC_TIMING2_DRS */
+        XCVR_RX_DIG_AGC_TIMING2_DRS_AGC_UNFREEZE_FEAT_TIMEOUT(0x000) |
+            XCVR_RX_DIG_AGC_TIMING2_DRS_AGC_UNHOLD_FEAT_TIMEOUT(0x000),
+        /* 138: XCVR_RX_DIG->CTRL0 */
+#if RF_OSC_26MHZ == 1
+        XCVR_FOLDED_CTRL0 | XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(2) |
+            XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x03B) |
+            XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(0) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#else
+        XCVR_FOLDED_CTRL0 | XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(3) |
+            XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x020) |
+            XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(0) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 139: XCVR_RX_DIG->CTRL0_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(1) |
+            XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x03B),
+#else
+        XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(2) |
+            XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x030),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 140: XCVR_RX_DIG->CTRL1 */
+        XCVR_FOLDED_CTRL1,
+        /* 141: XCVR_RX_DIG->DCOC_CTRL0 */
+        XCVR_FOLDED_DCOC_CTRL0 | XCVR_RX_DIG_DCOC_CTRL0_DCOC_DAC_ORDER(0) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFII(0x8) |
+            XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFIIP(1) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFQQ(0x2) |
+            XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFQQP(0),
+        /* 142: XCVR_RX_DIG->DCOC_CTRL0_DRS */
+        XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFII(4) | XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFIIP(1) |
+            XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFQQ(1) | XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFQQP(0),
+        /* 143: XCVR_RX_DIG->DCOC_CTRL1 */
+        XCVR_FOLDED_DCOC_CTRL1,
+        /* 144: XCVR_RX_DIG->DEMOD_FILT_0_1 */
+        XCVR_RX_DIG_DEMOD_FILT_0_1_H0(0x002) | XCVR_RX_DIG_DEMOD_FILT_0_1_H1(0x1F6),
+        /* 145: XCVR_RX_DIG->DEMOD_FILT_0_1_DRS */
+        XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H0(0x1FD) | XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H1(0x1FB),
+        /* 146: XCVR_RX_DIG->DEMOD_FILT_2_4 */
+        XCVR_RX_DIG_DEMOD_FILT_2_4_H2(0x024) | XCVR_RX_DIG_DEMOD_FILT_2_4_H3(0x082) |
+            XCVR_RX_DIG_DEMOD_FILT_2_4_H4(0x0BA),
+        /* 147: XCVR_RX_DIG->DEMOD_FILT_2_4_DRS */
+        XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H2(0x01F) | XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H3(0x086) |
+            XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H4(0x0C6),
+        /* 148: XCVR_RX_DIG->NB_RSSI_CTRL0 */
+        XCVR_FOLDED_NB_RSSI_CTRL0,
+        /* 149: XCVR_RX_DIG->NB_RSSI_CTRL1 */
+        XCVR_FOLDED_NB_RSSI_CTRL1,
+        /* 150: XCVR_RX_DIG->RCCAL_CTRL0 */
+        XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE(2) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE_DRS(0) |
+            XCVR_RX_DIG_RCCAL_CTRL0_CBPF_CCODE_OFFSET(0x00) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE(1) |
+            XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE_DRS(0) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CMPOUT_INV(0) |
+            XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CODE_OFFSET(0x0) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_SMPL_DLY(0),
+        /* 151: XCVR_RX_DIG->RSSI_GLOBAL_CTRL */
+        XCVR_FOLDED_RSSI_GLOBAL_CTRL | XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_CCA1_ED_EN(0),
+        /* 152: XCVR_RX_DIG->WB_RSSI_CTRL */
+        XCVR_FOLDED_WB_RSSI_CTRL,
+        /* 153: XCVR_TSM->CTRL */
+        XCVR_FOLDED_CTRL,
+        /* 154: XCVR_TSM->END_OF_SEQ */
+        XCVR_FOLDED_END_OF_SEQ,
+        /* 155: XCVR_TSM->FAST_CTRL1 */
+        XCVR_FOLDED_FAST_CTRL1,
+        /* 156: XCVR_TSM->FAST_CTRL2 */
+        XCVR_FOLDED_FAST_CTRL2,
+        /* 157: XCVR_TSM->FAST_CTRL3 */
+        XCVR_FOLDED_FAST_CTRL3,
+        /* 158: XCVR_TSM->RECYCLE_COUNT */
+        XCVR_FOLDED_RECYCLE_COUNT,
+        /* 159: XCVR_TSM->TIMING00 */
+        XCVR_FOLDED_TIMING00,
+        /* 160: XCVR_TSM->TIMING01 */
+        XCVR_FOLDED_TIMING01,
+        /* 161: XCVR_TSM->TIMING02 */
+        XCVR_FOLDED_TIMING02,
+        /* 162: XCVR_TSM->TIMING03 */
+        XCVR_FOLDED_TIMING03,
+        /* 163: XCVR_TSM->TIMING04 */
+        XCVR_FOLDED_TIMING04,
+        /* 164: XCVR_TSM->TIMING05 */
+        XCVR_FOLDED_TIMING05,
+        /* 165: XCVR_TSM->TIMING06 */
+        XCVR_FOLDED_TIMING06,
+        /* 166: XCVR_TSM->TIMING07 */
+        XCVR_FOLDED_TIMING07,
+        /* 167: XCVR_TSM->TIMING08 */
+        XCVR_FOLDED_TIMING08,
+        /* 168: XCVR_TSM->TIMING09 */
+        XCVR_FOLDED_TIMING09,
+        /* 169: XCVR_TSM->TIMING10 */
+        XCVR_FOLDED_TIMING10,
+        /* 170: XCVR_TSM->TIMING11 */
+        XCVR_FOLDED_TIMING11,
+        /* 171: XCVR_TSM->TIMING12 */
+        XCVR_FOLDED_TIMING12,
+        /* 172: XCVR_TSM->TIMING13 */
+        XCVR_FOLDED_TIMING13,
+        /* 173: XCVR_TSM->TIMING14 */
+        XCVR_FOLDED_TIMING14,
+        /* 174: XCVR_TSM->TIMING15 */
+        XCVR_FOLDED_TIMING15,
+        /* 175: XCVR_TSM->TIMING16 */
+        XCVR_FOLDED_TIMING16,
+        /* 176: XCVR_TSM->TIMING17 */
+        XCVR_FOLDED_TIMING17,
+        /* 177: XCVR_TSM->TIMING18 */
+        XCVR_FOLDED_TIMING18,
+        /* 178: XCVR_TSM->TIMING19 */
+        XCVR_FOLDED_TIMING19,
+        /* 179: XCVR_TSM->TIMING20 */
+        XCVR_FOLDED_TIMING20,
+        /* 180: XCVR_TSM->TIMING21 */
+        XCVR_FOLDED_TIMING21,
+        /* 181: XCVR_TSM->TIMING22 */
+        XCVR_FOLDED_TIMING22,
+        /* 182: XCVR_TSM->TIMING23 */
+        XCVR_FOLDED_TIMING23,
+        /* 183: XCVR_TSM->TIMING24 */
+        XCVR_FOLDED_TIMING24,
+        /* 184: XCVR_TSM->TIMING25 */
+        XCVR_FOLDED_TIMING25,
+        /* 185: XCVR_TSM->TIMING26 */
+        XCVR_FOLDED_TIMING26,
+        /* 186: XCVR_TSM->TIMING27 */
+        XCVR_FOLDED_TIMING27,
+        /* 187: XCVR_TSM->TIMING28 */
+        XCVR_FOLDED_TIMING28,
+        /* 188: XCVR_TSM->TIMING29 */
+        XCVR_FOLDED_TIMING29,
+        /* 189: XCVR_TSM->TIMING30 */
+        XCVR_FOLDED_TIMING30,
+        /* 190: XCVR_TSM->TIMING31 */
+        XCVR_FOLDED_TIMING31,
+        /* 191: XCVR_TSM->TIMING32 */
+        XCVR_FOLDED_TIMING32,
+        /* 192: XCVR_TSM->TIMING33 */
+        XCVR_FOLDED_TIMING33,
+        /* 193: XCVR_TSM->TIMING34 */
+        XCVR_FOLDED_TIMING34,
+        /* 194: XCVR_TSM->TIMING35 */
+        XCVR_FOLDED_TIMING35,
+        /* 195: XCVR_TSM->TIMING36 */
+        XCVR_FOLDED_TIMING36,
+        /* 196: XCVR_TSM->TIMING37 */
+        XCVR_FOLDED_TIMING37,
+        /* 197: XCVR_TSM->TIMING38 */
+        XCVR_FOLDED_TIMING38,
+        /* 198: XCVR_TSM->TIMING39 */
+        XCVR_FOLDED_TIMING39,
+        /* 199: XCVR_TSM->TIMING40 */
+        XCVR_FOLDED_TIMING40,
+        /* 200: XCVR_TSM->TIMING41 */
+        XCVR_FOLDED_TIMING41,
+        /* 201: XCVR_TSM->TIMING42 */
+        XCVR_FOLDED_TIMING42,
+        /* 202: XCVR_TSM->TIMING43 */
+        XCVR_FOLDED_TIMING43,
+        /* 203: XCVR_TSM->TIMING44 */
+        XCVR_FOLDED_TIMING44,
+        /* 204: XCVR_TSM->TIMING45 */
+        XCVR_FOLDED_TIMING45,
+        /* 205: XCVR_TSM->TIMING46 */
+        XCVR_FOLDED_TIMING46,
+        /* 206: XCVR_TSM->TIMING47 */
+        XCVR_FOLDED_TIMING47,
+        /* 207: XCVR_TSM->TIMING48 */
+        XCVR_FOLDED_TIMING48,
+        /* 208: XCVR_TSM->TIMING49 */
+        XCVR_FOLDED_TIMING49,
+        /* 209: XCVR_TSM->TIMING50 */
+        XCVR_FOLDED_TIMING50,
+        /* 210: XCVR_TSM->TIMING51 */
+        XCVR_FOLDED_TIMING51,
+        /* 211: XCVR_TSM->TIMING52 */
+        XCVR_FOLDED_TIMING52,
+        /* 212: XCVR_TSM->WU_LATENCY */
+        XCVR_FOLDED_WU_LATENCY,
+        /* 213: XCVR_TX_DIG->DATARATE_CONFIG_FILTER_CTRL */
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(0),
+        /* 214: XCVR_TX_DIG->DATARATE_CONFIG_FSK_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV0(0x1610) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV1(0x09f0),
+#else
+        XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV0(0x1800) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV1(0x0800),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 215: XCVR_TX_DIG->DATARATE_CONFIG_GFSK_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x09DE),
+#else
+        XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x0804),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 216: XCVR_TX_DIG->DATA_PADDING_CTRL */
+        XCVR_FOLDED_DATA_PADDING_CTRL | XCVR_TX_DIG_DATA_PADDING_CTRL_DATA_PADDING_SEL(0) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_PAD_DLY(0) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_PAD_DLY_EN(1),
+        /* 217: XCVR_TX_DIG->DATA_PADDING_CTRL_1 */
+        XCVR_FOLDED_DATA_PADDING_CTRL_1 | XCVR_TX_DIG_DATA_PADDING_CTRL_1_RAMP_UP_DLY(0x04) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_1_TX_DATA_FLUSH_DLY(0x04),
+        /* 218: XCVR_TX_DIG->DATA_PADDING_CTRL_2 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_MFDEV(0x1B0D) | XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_PFDEV(0x04F2),
+#else
+        XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_MFDEV(0x1BF9) | XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_PFDEV(0x0406),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 219: XCVR_TX_DIG->FSK_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_0(0x1B0D) | XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_1(0x04F2),
+#else
+        XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_0(0x1BF9) | XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_1(0x0406),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 220: XCVR_TX_DIG->GFSK_COEFF_0_1 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_0(0x0048) | XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_1(0x0059),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_0(0x0019) | XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_1(0x002C),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 221: XCVR_TX_DIG->GFSK_COEFF_2_3 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_2(0x006B) | XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_3(0x007D),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_2(0x0046) | XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_3(0x0069),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 222: XCVR_TX_DIG->GFSK_COEFF_4_5 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_4(0x008D) | XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_5(0x009A),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_4(0x0091) | XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_5(0x00B8),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 223: XCVR_TX_DIG->GFSK_COEFF_6_7 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_6(0x00A4) | XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_7(0x00A9),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_6(0x00D8) | XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_7(0x00EA),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 224: XCVR_TX_DIG->GFSK_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(0) |
+            XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x4E9),
+#else
+        XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(0) |
+            XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x3FD),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 225: XCVR_TX_DIG->IMAGE_FILTER_CTRL */
+        XCVR_FOLDED_IMAGE_FILTER_CTRL | XCVR_TX_DIG_IMAGE_FILTER_CTRL_IMAGE_FILTER_OVRD_EN(1),
+        /* 226: XCVR_TX_DIG->PA_CTRL */
+        XCVR_FOLDED_PA_CTRL | XCVR_TX_DIG_PA_CTRL_PA_RAMP_SEL(1),
+        /* 227: XCVR_TX_DIG->PA_RAMP_TBL0 */
+        XCVR_FOLDED_PA_RAMP_TBL0,
+        /* 228: XCVR_TX_DIG->PA_RAMP_TBL1 */
+        XCVR_FOLDED_PA_RAMP_TBL1,
+        /* 229: XCVR_TX_DIG->PA_RAMP_TBL2 */
+        XCVR_FOLDED_PA_RAMP_TBL2,
+        /* 230: XCVR_TX_DIG->PA_RAMP_TBL3 */
+        XCVR_FOLDED_PA_RAMP_TBL3,
+        /* 231: XCVR_TX_DIG->SWITCH_TX_CTRL */
+        XCVR_FOLDED_SWITCH_TX_CTRL,
+        /* 232: XCVR_TX_DIG->TXDIG_CTRL */
+        XCVR_FOLDED_TXDIG_CTRL | XCVR_TX_DIG_TXDIG_CTRL_DATA_STREAM_SEL(0) | XCVR_TX_DIG_TXDIG_CTRL_MODULATOR_SEL(1) |
+            XCVR_TX_DIG_TXDIG_CTRL_PFC_EN(1),
+    },
+};
+
+const xcvr_folded_config_t xcvr_msk_500kbps_folded_config = {
+    .config     = &xcvr_msk_500kbps_full_config,
+    .reg_values = {
+        /* 0: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x14) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x10) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x0C) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x08) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+        /* 1: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x34) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x30),
+        /* 2: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x2C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x28) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x24),
+        /* 3: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x14) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x10) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x0C) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x08) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+        /* 4: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x34) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x38),
+        /* 5: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x3C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x04),
+        /* 6: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x0C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x08) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x04) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+        /* 7: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x08),
+        /* 8: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x04) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x3C),
+        /* 9: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x0C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x08) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x04) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+        /* 10: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x10),
+        /* 11: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x14) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x18) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x1C),
+        /* 12: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x34) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x38) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x3C) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+        /* 13: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x34) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x30),
+        /* 14: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x2C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x28) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x24),
+        /* 15: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x34) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x38) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x3C) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+        /* 16: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x34) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x38),
+        /* 17: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x3C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x04),
+        /* 18: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x2C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x30) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x34) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x38) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+        /* 19: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x08),
+        /* 20: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x04) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x3C),
+        /* 21: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x2C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x30) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x34) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x38) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+        /* 22: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x10),
+        /* 23: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x14) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x18) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x1C),
+        /* 24: GEN4PHY->DMD_CTRL0 */
+        XCVR_FOLDED_DMD_CTRL0,
+        /* 25: GEN4PHY->DMD_CTRL1 */
+        XCVR_FOLDED_DMD_CTRL1,
+        /* 26: GEN4PHY->FSK_CFG0 */
+        XCVR_FOLDED_FSK_CFG0 | GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_1M(0x12) |
+            GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_2M(0x11) |
+            GEN4PHY_FSK_CFG0_MSK2FSK_SEED(1) | GEN4PHY_FSK_CFG0_MSK_EN(1),
+        /* 27: GEN4PHY->FSK_CFG1 */
+        GEN4PHY_FSK_CFG1_OVERH(0x020) | GEN4PHY_FSK_CFG1_OVERH_INV(0x100) | GEN4PHY_FSK_CFG1_SYNCTSCALE(0xF),
+        /* 28: GEN4PHY->FSK_CFG2 */
+        XCVR_FOLDED_FSK_CFG2,
+        /* 29: GEN4PHY->FSK_FAD_CFG */
+        XCVR_FOLDED_FSK_FAD_CFG,
+        /* 30: GEN4PHY->FSK_FAD_CTRL */
+        XCVR_FOLDED_FSK_FAD_CTRL,
+        /* 31: GEN4PHY->FSK_PD_CFG0 */
+        GEN4PHY_FSK_PD_CFG0_PD_IIR_ALPHA(0xFF) | GEN4PHY_FSK_PD_CFG0_PREAMBLE_T_SCALE(0xC),
+        /* 32: GEN4PHY->FSK_PD_CFG1 */
+        GEN4PHY_FSK_PD_CFG1_PREAMBLE_PATTERN(0x55),
+        /* 33: GEN4PHY->FSK_PD_CFG2 */
+        GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_1M(0xF0) | GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_2M(0xEB),
+        /* 34: GEN4PHY->FSK_PD_PH[0] */
+        GEN4PHY_FSK_PD_PH_REF0(0x02) | GEN4PHY_FSK_PD_PH_REF1(0x03) | GEN4PHY_FSK_PD_PH_REF2(0x02) |
+            GEN4PHY_FSK_PD_PH_REF3(0x00),
+        /* 35: GEN4PHY->FSK_PD_PH[1] */
+        GEN4PHY_FSK_PD_PH_REF0(0x3E) | GEN4PHY_FSK_PD_PH_REF1(0x3D) | GEN4PHY_FSK_PD_PH_REF2(0x3E) |
+            GEN4PHY_FSK_PD_PH_REF3(0x00),
+        /* 36: GEN4PHY->FSK_PT */
+        XCVR_FOLDED_FSK_PT | GEN4PHY_FSK_PT_AGC_TIMEOUT(0x0160),
+        /* 37: GEN4PHY->LR_AA_CFG */
+        GEN4PHY_LR_AA_CFG_AA_COR_THRESH(0x00) | GEN4PHY_LR_AA_CFG_AA_HAM_THRESH(0x00) |
+            GEN4PHY_LR_AA_CFG_AA_LR_CORR_GAIN(0x00) | GEN4PHY_LR_AA_CFG_ACCESS_ADDR_HAM(0x00),
+        /* 38: GEN4PHY->LR_PD_CFG */
+        GEN4PHY_LR_PD_CFG_CORR_TH(0x00) | GEN4PHY_LR_PD_CFG_FREQ_TH(0x00) | GEN4PHY_LR_PD_CFG_NO_PEAKS(0),
+        /* 39: GEN4PHY->LR_PD_PH[0] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 40: GEN4PHY->LR_PD_PH[1] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 41: GEN4PHY->LR_PD_PH[2] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 42: GEN4PHY->LR_PD_PH[3] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 43: GEN4PHY->MISC */
+        XCVR_FOLDED_MISC,
+        /* 44: GEN4PHY->PREPHY_MISC */
+        XCVR_FOLDED_PREPHY_MISC,
+        /* 45: GEN4PHY->RTT_CTRL */
+        XCVR_FOLDED_RTT_CTRL,
+        /* 46: GEN4PHY->RTT_REF */
+        GEN4PHY_RTT_REF_FM_REF_010(0x48) | GEN4PHY_RTT_REF_FM_REF_110(0x63) | GEN4PHY_RTT_REF_FM_REF_111(0x80),
+        /* 47: GEN4PHY->SM_CFG */
+        XCVR_FOLDED_SM_CFG | GEN4PHY_SM_CFG_AA_TIMEOUT_UNCODED(0x0A0),
+        /* 48: RADIO_CTRL->LL_CTRL */
+        RADIO_CTRL_LL_CTRL_ACTIVE_LL(2),
+        /* 49: XCVR_ANALOG->LDO_0 */
+        XCVR_FOLDED_LDO_0,
+        /* 50: XCVR_ANALOG->LDO_1 */
+        XCVR_FOLDED_LDO_1,
+        /* 51: XCVR_ANALOG->PLL */
+        XCVR_FOLDED_PLL,
+        /* 52: XCVR_ANALOG->RX_0 */
+        XCVR_FOLDED_RX_0,
+        /* 53: XCVR_ANALOG->RX_1 */
+        XCVR_FOLDED_RX_1,
+        /* 54: XCVR_ANALOG->TX_DAC_PA */
+        XCVR_FOLDED_TX_DAC_PA | XCVR_ANALOG_TX_DAC_PA_DAC_TRIM_CFBK_DRS(1),
+        /* 55: XCVR_ANALOG->XO_DIST */
+        XCVR_FOLDED_XO_DIST,
+        /* 56: XCVR_MISC->IPS_FO_ADDR[0] */
+        XCVR_MISC_IPS_FO_ADDR_ADDR(0x370) | XCVR_MISC_IPS_FO_ADDR_ENTRY_RX(0) | XCVR_MISC_IPS_FO_ADDR_ENTRY_TX(0),
+        /* 57: XCVR_MISC->IPS_FO_ADDR[1] */
+        XCVR_MISC_IPS_FO_ADDR_ADDR(0x02C) | XCVR_MISC_IPS_FO_ADDR_ENTRY_RX(0) | XCVR_MISC_IPS_FO_ADDR_ENTRY_TX(0),
+        /* 58: XCVR_MISC->IPS_FO_DRS0_DATA[0] */
+        XCVR_MISC_IPS_FO_DRS0_DATA_DRS0_DATA(0x00000000),
+        /* 59: XCVR_MISC->IPS_FO_DRS0_DATA[1] */
+        XCVR_MISC_IPS_FO_DRS0_DATA_DRS0_DATA(0x00000000),
+        /* 60: XCVR_MISC->IPS_FO_DRS1_DATA[0] */
+        XCVR_MISC_IPS_FO_DRS1_DATA_DRS1_DATA(0x00000000),
+        /* 61: XCVR_MISC->IPS_FO_DRS1_DATA[1] */
+        XCVR_MISC_IPS_FO_DRS1_DATA_DRS1_DATA(0x00000000),
+        /* 62: XCVR_MISC->LDO_TRIM_0 */
+        XCVR_FOLDED_LDO_TRIM_0,
+        /* 63: XCVR_MISC->LDO_TRIM_1 */
+        XCVR_FOLDED_LDO_TRIM_1,
+        /* 64: XCVR_MISC->XCVR_CTRL */
+        XCVR_FOLDED_XCVR_CTRL | XCVR_MISC_XCVR_CTRL_DATA_RATE_DRS(2) | XCVR_MISC_XCVR_CTRL_DEMOD_SEL(1) |
+            XCVR_MISC_XCVR_CTRL_LL_CFG_CAPT_DIS(0),
+        /* 65: XCVR_PLL_DIG->CHAN_MAP */
+        XCVR_FOLDED_CHAN_MAP | XCVR_PLL_DIG_CHAN_MAP_BAND_SELECT(0),
+        /* 66: XCVR_PLL_DIG->CHAN_MAP_EXT */
+#if RF_OSC_26MHZ == 1
+        XCVR_FOLDED_CHAN_MAP_EXT | XCVR_PLL_DIG_CHAN_MAP_EXT_NUM_OFFSET(0x013B13B),
+#else
+        XCVR_FOLDED_CHAN_MAP_EXT | XCVR_PLL_DIG_CHAN_MAP_EXT_NUM_OFFSET(0x0100000),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 67: XCVR_PLL_DIG->DATA_RATE_OVRD_CTRL1 */
+        XCVR_FOLDED_DATA_RATE_OVRD_CTRL1,
+        /* 68: XCVR_PLL_DIG->DATA_RATE_OVRD_CTRL2 */
+#if RF_OSC_26MHZ == 1
+        XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL2_NUM_OFFSET_CFG1(0x013B13B),
+#else
+        XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL2_NUM_OFFSET_CFG1(0x0100000),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 69: XCVR_PLL_DIG->DELAY_MATCH */
+        XCVR_FOLDED_DELAY_MATCH | XCVR_PLL_DIG_DELAY_MATCH_HPM_INTEGER_DELAY(0x04) |
+            XCVR_PLL_DIG_DELAY_MATCH_LPM_SDM_DELAY(0x03),
+        /* 70: XCVR_PLL_DIG->HPMCAL_CTRL */
+        XCVR_FOLDED_HPMCAL_CTRL | XCVR_PLL_DIG_HPMCAL_CTRL_HPM_CAL_ARRAY_SIZE(0),
+        /* 71: XCVR_PLL_DIG->HPM_BUMP */
+        XCVR_FOLDED_HPM_BUMP | XCVR_PLL_DIG_HPM_BUMP_HPM_VCM_CAL(2) | XCVR_PLL_DIG_HPM_BUMP_HPM_VCM_TX(2),
+        /* 72: XCVR_PLL_DIG->HPM_CAL_TIMING */
+        XCVR_FOLDED_HPM_CAL_TIMING,
+        /* 73: XCVR_PLL_DIG->HPM_CTRL */
+        XCVR_FOLDED_HPM_CTRL,
+        /* 74: XCVR_PLL_DIG->HPM_SDM_RES */
+        XCVR_FOLDED_HPM_SDM_RES | XCVR_PLL_DIG_HPM_SDM_RES_HPM_COUNT_ADJUST(0x02),
+        /* 75: XCVR_PLL_DIG->LOCK_DETECT */
+        XCVR_FOLDED_LOCK_DETECT,
+        /* 76: XCVR_PLL_DIG->LPM_CTRL */
+        XCVR_FOLDED_LPM_CTRL,
+        /* 77: XCVR_PLL_DIG->LPM_SDM_CTRL1 */
+        XCVR_FOLDED_LPM_SDM_CTRL1,
+        /* 78: XCVR_PLL_DIG->MOD_CTRL */
+        XCVR_FOLDED_MOD_CTRL,
+        /* 79: XCVR_PLL_DIG->PLL_DATARATE_CTRL */
+        XCVR_FOLDED_PLL_DATARATE_CTRL,
+        /* 80: XCVR_PLL_DIG->TUNING_CAP_RX_CTRL */
+        XCVR_FOLDED_TUNING_CAP_RX_CTRL,
+        /* 81: XCVR_PLL_DIG->TUNING_CAP_TX_CTRL */
+        XCVR_FOLDED_TUNING_CAP_TX_CTRL,
+        /* 82: XCVR_RX_DIG->ACQ_FILT_0_3 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x03) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x00) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x78) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x77),
+#else
+        XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x03) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x01) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x76) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x03),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 83: XCVR_RX_DIG->ACQ_FILT_0_3_DRS */
+        XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H0(0x00) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H1(0x00) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H2(0x00) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H3(0x00),
+        /* 84: XCVR_RX_DIG->ACQ_FILT_10_11 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x066) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x0C9),
+#else
+        XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x3FA) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x140),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 85: XCVR_RX_DIG->ACQ_FILT_10_11_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x053) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x0E5),
+#else
+        XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x3B2) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x167),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 86: XCVR_RX_DIG->ACQ_FILT_4_7 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x06) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x1A) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_H6(0x11) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0xE7),
+#else
+        XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x15) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x6D) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_H6(0xE2) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0x36),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 87: XCVR_RX_DIG->ACQ_FILT_4_7_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x7C) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x05) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0x16) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0x05),
+#else
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x01) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x0A) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0xE8) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0x00),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 88: XCVR_RX_DIG->ACQ_FILT_8_9 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x1CA) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x1F5),
+#else
+        XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x01F) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x18F),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 89: XCVR_RX_DIG->ACQ_FILT_8_9_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x1D2) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x1D5),
+#else
+        XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x048) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x1AC),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 90: XCVR_RX_DIG->AGC_CTRL */
+        XCVR_FOLDED_AGC_CTRL,
+        /* 91: XCVR_RX_DIG->AGC_CTRL_STAT */
+        XCVR_FOLDED_AGC_CTRL_STAT,
+        /* 92: XCVR_RX_DIG->AGC_IDX0_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX0_GAIN_CFG,
+        /* 93: XCVR_RX_DIG->AGC_IDX0_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX0_GAIN_VAL,
+        /* 94: XCVR_RX_DIG->AGC_IDX0_THR */
+        XCVR_FOLDED_AGC_IDX0_THR,
+        /* 95: XCVR_RX_DIG->AGC_IDX10_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX10_GAIN_CFG,
+        /* 96: XCVR_RX_DIG->AGC_IDX10_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX10_GAIN_VAL,
+        /* 97: XCVR_RX_DIG->AGC_IDX10_THR */
+        XCVR_FOLDED_AGC_IDX10_THR,
+        /* 98: XCVR_RX_DIG->AGC_IDX11_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX11_GAIN_CFG | XCVR_RX_DIG_AGC_IDX11_GAIN_CFG_MAG_THR_11_DRS_OFS(0x00) |
+            XCVR_RX_DIG_AGC_IDX11_GAIN_CFG_MAG_THR_HI_11_DRS_OFS(0x00),
+        /* 99: XCVR_RX_DIG->AGC_IDX11_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX11_GAIN_VAL | XCVR_RX_DIG_AGC_IDX11_GAIN_VAL_MAG_THR_11(0x000) |
+            XCVR_RX_DIG_AGC_IDX11_GAIN_VAL_MAG_THR_HI_11(0x000),
+        /* 100: XCVR_RX_DIG->AGC_IDX11_THR */
+        XCVR_FOLDED_AGC_IDX11_THR,
+        /* 101: XCVR_RX_DIG->AGC_IDX1_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX1_GAIN_CFG,
+        /* 102: XCVR_RX_DIG->AGC_IDX1_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX1_GAIN_VAL,
+        /* 103: XCVR_RX_DIG->AGC_IDX1_THR */
+        XCVR_FOLDED_AGC_IDX1_THR,
+        /* 104: XCVR_RX_DIG->AGC_IDX2_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX2_GAIN_CFG,
+        /* 105: XCVR_RX_DIG->AGC_IDX2_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX2_GAIN_VAL,
+        /* 106: XCVR_RX_DIG->AGC_IDX2_THR */
+        XCVR_FOLDED_AGC_IDX2_THR,
+        /* 107: XCVR_RX_DIG->AGC_IDX3_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX3_GAIN_CFG,
+        /* 108: XCVR_RX_DIG->AGC_IDX3_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX3_GAIN_VAL,
+        /* 109: XCVR_RX_DIG->AGC_IDX3_THR */
+        XCVR_FOLDED_AGC_IDX3_THR,
+        /* 110: XCVR_RX_DIG->AGC_IDX4_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX4_GAIN_CFG,
+        /* 111: XCVR_RX_DIG->AGC_IDX4_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX4_GAIN_VAL,
+        /* 112: XCVR_RX_DIG->AGC_IDX4_THR */
+        XCVR_FOLDED_AGC_IDX4_THR,
+        /* 113: XCVR_RX_DIG->AGC_IDX5_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX5_GAIN_CFG,
+        /* 114: XCVR_RX_DIG->AGC_IDX5_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX5_GAIN_VAL,
+        /* 115: XCVR_RX_DIG->AGC_IDX5_THR */
+        XCVR_FOLDED_AGC_IDX5_THR,
+        /* 116: XCVR_RX_DIG->AGC_IDX6_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX6_GAIN_CFG,
+        /* 117: XCVR_RX_DIG->AGC_IDX6_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX6_GAIN_VAL,
+        /* 118: XCVR_RX_DIG->AGC_IDX6_THR */
+        XCVR_FOLDED_AGC_IDX6_THR,
+        /* 119: XCVR_RX_DIG->AGC_IDX7_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX7_GAIN_CFG,
+        /* 120: XCVR_RX_DIG->AGC_IDX7_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX7_GAIN_VAL,
+        /* 121: XCVR_RX_DIG->AGC_IDX7_THR */
+        XCVR_FOLDED_AGC_IDX7_THR,
+        /* 122: XCVR_RX_DIG->AGC_IDX8_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX8_GAIN_CFG,
+        /* 123: XCVR_RX_DIG->AGC_IDX8_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX8_GAIN_VAL,
+        /* 124: XCVR_RX_DIG->AGC_IDX8_THR */
+        XCVR_FOLDED_AGC_IDX8_THR,
+        /* 125: XCVR_RX_DIG->AGC_IDX9_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX9_GAIN_CFG,
+        /* 126: XCVR_RX_DIG->AGC_IDX9_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX9_GAIN_VAL,
+        /* 127: XCVR_RX_DIG->AGC_IDX9_THR */
+        XCVR_FOLDED_AGC_IDX9_THR,
+        /* 128: XCVR_RX_DIG->AGC_MIS_GAIN_CFG */
+        XCVR_FOLDED_AGC_MIS_GAIN_CFG,
+        /* 129: XCVR_RX_DIG->AGC_THR_FAST */
+        XCVR_FOLDED_AGC_THR_FAST,
+        /* 130: XCVR_RX_DIG->AGC_THR_FAST_DRS */
+        XCVR_FOLDED_AGC_THR_FAST_DRS,
+        /* 131: XCVR_RX_DIG->AGC_THR_MIS */
+        XCVR_FOLDED_AGC_THR_MIS,
+        /* 132: XCVR_RX_DIG->AGC_TIMING0 */
+        XCVR_FOLDED_AGC_TIMING0 | XCVR_RX_DIG_AGC_TIMING0_AGC_GAIN_STEP_WAIT(0x10),
+        /* 133: XCVR_RX_DIG->AGC_TIMING0_DRS */
+        XCVR_FOLDED_AGC_TIMING0_DRS | XCVR_RX_DIG_AGC_TIMING0_DRS_AGC_GAIN_STEP_WAIT(0x10),
+        /* 134: XCVR_RX_DIG->AGC_TIMING1 */
+        XCVR_FOLDED_AGC_TIMING1 | XCVR_RX_DIG_AGC_TIMING1_AGC_FREEZE_TIMEOUT(0x0A) |
+            XCVR_RX_DIG_AGC_TIMING1_AGC_HOLD_TIMEOUT(0x08),
+        /* 135: XCVR_RX_DIG->AGC_TIMING1_DRS */
+        XCVR_RX_DIG_AGC_TIMING1_DRS_AGC_FREEZE_TIMEOUT(0x0A) | XCVR_RX_DIG_AGC_TIMING1_DRS_AGC_HOLD_TIMEOUT(0x08),
+        /* 136: XCVR_RX_DIG->AGC_TIMING2 */
+        XCVR_FOLDED_AGC_TIMING2 | XCVR_RX_DIG_AGC_TIMING2_AGC_UNFREEZE_FEAT_TIMEOUT(0x000) |
+            XCVR_RX_DIG_AGC_TIMING2_AGC_UNHOLD_FEAT_TIMEOUT(0x000),
+        /* 137: XCVR_RX_DIG->AGC_TIMING2_DRS */
+        XCVR_RX_DIG_AGC_TIMING2_DRS_AGC_UNFREEZE_FEAT_TIMEOUT(0x000) |
+            XCVR_RX_DIG_AGC_TIMING2_DRS_AGC_UNHOLD_FEAT_TIMEOUT(0x000),
+        /* 138: XCVR_RX_DIG->CTRL0 */
+#if RF_OSC_26MHZ == 1
+        XCVR_FOLDED_CTRL0 | XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(2) |
+            XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x03B) |
+            XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(1) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#else
+        XCVR_FOLDED_CTRL0 | XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(3) |
+            XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x030) |
+            XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(1) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 139: XCVR_RX_DIG->CTRL0_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(3) |
+            XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x027),
+#else
+        XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(4) |
+            XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x020),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 140: XCVR_RX_DIG->CTRL1 */
+        XCVR_FOLDED_CTRL1,
+        /* 141: XCVR_RX_DIG->DCOC_CTRL0 */
+        XCVR_FOLDED_DCOC_CTRL0 | XCVR_RX_DIG_DCOC_CTRL0_DCOC_DAC_ORDER(1) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFII(0x6) |
+            XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFIIP(1) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFQQ(0x5) |
+            XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFQQP(1),
+        /* 142: XCVR_RX_DIG->DCOC_CTRL0_DRS */
+        XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFII(6) | XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFIIP(1) |
+            XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFQQ(5) | XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFQQP(1),
+        /* 143: XCVR_RX_DIG->DCOC_CTRL1 */
+        XCVR_FOLDED_DCOC_CTRL1,
+        /* 144: XCVR_RX_DIG->DEMOD_FILT_0_1 */
+        XCVR_RX_DIG_DEMOD_FILT_0_1_H0(0x002) | XCVR_RX_DIG_DEMOD_FILT_0_1_H1(0x1F6),
+        /* 145: XCVR_RX_DIG->DEMOD_FILT_0_1_DRS */
+        XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H0(0x001) | XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H1(0x1F5),
+        /* 146: XCVR_RX_DIG->DEMOD_FILT_2_4 */
+        XCVR_RX_DIG_DEMOD_FILT_2_4_H2(0x3F3) | XCVR_RX_DIG_DEMOD_FILT_2_4_H3(0x08A) |
+            XCVR_RX_DIG_DEMOD_FILT_2_4_H4(0x116),
+        /* 147: XCVR_RX_DIG->DEMOD_FILT_2_4_DRS */
+        XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H2(0x3F6) | XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H3(0x08B) |
+            XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H4(0x110),
+        /* 148: XCVR_RX_DIG->NB_RSSI_CTRL0 */
+        XCVR_FOLDED_NB_RSSI_CTRL0,
+        /* 149: XCVR_RX_DIG->NB_RSSI_CTRL1 */
+        XCVR_FOLDED_NB_RSSI_CTRL1,
+        /* 150: XCVR_RX_DIG->RCCAL_CTRL0 */
+        XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE(2) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE_DRS(3) |
+            XCVR_RX_DIG_RCCAL_CTRL0_CBPF_CCODE_OFFSET(0x00) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE(0) |
+            XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE_DRS(1) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CMPOUT_INV(0) |
+            XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CODE_OFFSET(0x0) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_SMPL_DLY(0),
+        /* 151: XCVR_RX_DIG->RSSI_GLOBAL_CTRL */
+        XCVR_FOLDED_RSSI_GLOBAL_CTRL | XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_CCA1_ED_EN(0),
+        /* 152: XCVR_RX_DIG->WB_RSSI_CTRL */
+        XCVR_FOLDED_WB_RSSI_CTRL,
+        /* 153: XCVR_TSM->CTRL */
+        XCVR_FOLDED_CTRL,
+        /* 154: XCVR_TSM->END_OF_SEQ */
+        XCVR_FOLDED_END_OF_SEQ,
+        /* 155: XCVR_TSM->FAST_CTRL1 */
+        XCVR_FOLDED_FAST_CTRL1,
+        /* 156: XCVR_TSM->FAST_CTRL2 */
+        XCVR_FOLDED_FAST_CTRL2,
+        /* 157: XCVR_TSM->FAST_CTRL3 */
+        XCVR_FOLDED_FAST_CTRL3,
+        /* 158: XCVR_TSM->RECYCLE_COUNT */
+        XCVR_FOLDED_RECYCLE_COUNT,
+        /* 159: XCVR_TSM->TIMING00 */
+        XCVR_FOLDED_TIMING00,
+        /* 160: XCVR_TSM->TIMING01 */
+        XCVR_FOLDED_TIMING01,
+        /* 161: XCVR_TSM->TIMING02 */
+        XCVR_FOLDED_TIMING02,
+        /* 162: XCVR_TSM->TIMING03 */
+        XCVR_FOLDED_TIMING03,
+        /* 163: XCVR_TSM->TIMING04 */
+        XCVR_FOLDED_TIMING04,
+        /* 164: XCVR_TSM->TIMING05 */
+        XCVR_FOLDED_TIMING05,
+        /* 165: XCVR_TSM->TIMING06 */
+        XCVR_FOLDED_TIMING06,
+        /* 166: XCVR_TSM->TIMING07 */
+        XCVR_FOLDED_TIMING07,
+        /* 167: XCVR_TSM->TIMING08 */
+        XCVR_FOLDED_TIMING08,
+        /* 168: XCVR_TSM->TIMING09 */
+        XCVR_FOLDED_TIMING09,
+        /* 169: XCVR_TSM->TIMING10 */
+        XCVR_FOLDED_TIMING10,
+        /* 170: XCVR_TSM->TIMING11 */
+        XCVR_FOLDED_TIMING11,
+        /* 171: XCVR_TSM->TIMING12 */
+        XCVR_FOLDED_TIMING12,
+        /* 172: XCVR_TSM->TIMING13 */
+        XCVR_FOLDED_TIMING13,
+        /* 173: XCVR_TSM->TIMING14 */
+        XCVR_FOLDED_TIMING14,
+        /* 174: XCVR_TSM->TIMING15 */
+        XCVR_FOLDED_TIMING15,
+        /* 175: XCVR_TSM->TIMING16 */
+        XCVR_FOLDED_TIMING16,
+        /* 176: XCVR_TSM->TIMING17 */
+        XCVR_FOLDED_TIMING17,
+        /* 177: XCVR_TSM->TIMING18 */
+        XCVR_FOLDED_TIMING18,
+        /* 178: XCVR_TSM->TIMING19 */
+        XCVR_FOLDED_TIMING19,
+        /* 179: XCVR_TSM->TIMING20 */
+        XCVR_FOLDED_TIMING20,
+        /* 180: XCVR_TSM->TIMING21 */
+        XCVR_FOLDED_TIMING21,
+        /* 181: XCVR_TSM->TIMING22 */
+        XCVR_FOLDED_TIMING22,
+        /* 182: XCVR_TSM->TIMING23 */
+        XCVR_FOLDED_TIMING23,
+        /* 183: XCVR_TSM->TIMING24 */
+        XCVR_FOLDED_TIMING24,
+        /* 184: XCVR_TSM->TIMING25 */
+        XCVR_FOLDED_TIMING25,
+        /* 185: XCVR_TSM->TIMING26 */
+        XCVR_FOLDED_TIMING26,
+        /* 186: XCVR_TSM->TIMING27 */
+        XCVR_FOLDED_TIMING27,
+        /* 187: XCVR_TSM->TIMING28 */
+        XCVR_FOLDED_TIMING28,
+        /* 188: XCVR_TSM->TIMING29 */
+        XCVR_FOLDED_TIMING29,
+        /* 189: XCVR_TSM->TIMING30 */
+        XCVR_FOLDED_TIMING30,
+        /* 190: XCVR_TSM->TIMING31 */
+        XCVR_FOLDED_TIMING31,
+        /* 191: XCVR_TSM->TIMING32 */
+        XCVR_FOLDED_TIMING32,
+        /* 192: XCVR_TSM->TIMING33 */
+        XCVR_FOLDED_TIMING33,
+        /* 193: XCVR_TSM->TIMING34 */
+        XCVR_FOLDED_TIMING34,
+        /* 194: XCVR_TSM->TIMING35 */
+        XCVR_FOLDED_TIMING35,
+        /* 195: XCVR_TSM->TIMING36 */
+        XCVR_FOLDED_TIMING36,
+        /* 196: XCVR_TSM->TIMING37 */
+        XCVR_FOLDED_TIMING37,
+        /* 197: XCVR_TSM->TIMING38 */
+        XCVR_FOLDED_TIMING38,
+        /* 198: XCVR_TSM->TIMING39 */
+        XCVR_FOLDED_TIMING39,
+        /* 199: XCVR_TSM->TIMING40 */
+        XCVR_FOLDED_TIMING40,
+        /* 200: XCVR_TSM->TIMING41 */
+        XCVR_FOLDED_TIMING41,
+        /* 201: XCVR_TSM->TIMING42 */
+        XCVR_FOLDED_TIMING42,
+        /* 202: XCVR_TSM->TIMING43 */
+        XCVR_FOLDED_TIMING43,
+        /* 203: XCVR_TSM->TIMING44 */
+        XCVR_FOLDED_TIMING44,
+        /* 204: XCVR_TSM->TIMING45 */
+        XCVR_FOLDED_TIMING45,
+        /* 205: XCVR_TSM->TIMING46 */
+        XCVR_FOLDED_TIMING46,
+        /* 206: XCVR_TSM->TIMING47 */
+        XCVR_FOLDED_TIMING47,
+        /* 207: XCVR_TSM->TIMING48 */
+        XCVR_FOLDED_TIMING48,
+        /* 208: XCVR_TSM->TIMING49 */
+        XCVR_FOLDED_TIMING49,
+        /* 209: XCVR_TSM->TIMING50 */
+        XCVR_FOLDED_TIMING50,
+        /* 210: XCVR_TSM->TIMING51 */
+        XCVR_FOLDED_TIMING51,
+        /* 211: XCVR_TSM->TIMING52 */
+        XCVR_FOLDED_TIMING52,
+        /* 212: XCVR_TSM->WU_LATENCY */
+        XCVR_FOLDED_WU_LATENCY,
+        /* 213: XCVR_TX_DIG->DATARATE_CONFIG_FILTER_CTRL */
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(0),
+        /* 214: XCVR_TX_DIG->DATARATE_CONFIG_FSK_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV0(0x1D80) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV1(0x0240),
+#else
+        XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV0(0x1DE0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV1(0x0200),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 215: XCVR_TX_DIG->DATARATE_CONFIG_GFSK_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x0279),
+#else
+        XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x0203),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 216: XCVR_TX_DIG->DATA_PADDING_CTRL */
+        XCVR_FOLDED_DATA_PADDING_CTRL | XCVR_TX_DIG_DATA_PADDING_CTRL_DATA_PADDING_SEL(0) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_PAD_DLY(0) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_PAD_DLY_EN(1),
+        /* 217: XCVR_TX_DIG->DATA_PADDING_CTRL_1 */
+        XCVR_FOLDED_DATA_PADDING_CTRL_1 | XCVR_TX_DIG_DATA_PADDING_CTRL_1_RAMP_UP_DLY(0x04) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_1_TX_DATA_FLUSH_DLY(0x04),
+        /* 218: XCVR_TX_DIG->DATA_PADDING_CTRL_2 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_MFDEV(0x1B0D) | XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_PFDEV(0x04F2),
+#else
+        XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_MFDEV(0x1BF9) | XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_PFDEV(0x0406),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 219: XCVR_TX_DIG->FSK_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_0(0x1B0D) | XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_1(0x04F2),
+#else
+        XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_0(0x1BF9) | XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_1(0x0406),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 220: XCVR_TX_DIG->GFSK_COEFF_0_1 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_0(0x0048) | XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_1(0x0059),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_0(0x0019) | XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_1(0x002C),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 221: XCVR_TX_DIG->GFSK_COEFF_2_3 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_2(0x006B) | XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_3(0x007D),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_2(0x0046) | XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_3(0x0069),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 222: XCVR_TX_DIG->GFSK_COEFF_4_5 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_4(0x008D) | XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_5(0x009A),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_4(0x0091) | XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_5(0x00B8),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 223: XCVR_TX_DIG->GFSK_COEFF_6_7 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_6(0x00A4) | XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_7(0x00A9),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_6(0x00D8) | XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_7(0x00EA),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 224: XCVR_TX_DIG->GFSK_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(0) |
+            XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x4E9),
+#else
+        XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(0) |
+            XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x3FD),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 225: XCVR_TX_DIG->IMAGE_FILTER_CTRL */
+        XCVR_FOLDED_IMAGE_FILTER_CTRL | XCVR_TX_DIG_IMAGE_FILTER_CTRL_IMAGE_FILTER_OVRD_EN(1),
+        /* 226: XCVR_TX_DIG->PA_CTRL */
+        XCVR_FOLDED_PA_CTRL | XCVR_TX_DIG_PA_CTRL_PA_RAMP_SEL(1),
+        /* 227: XCVR_TX_DIG->PA_RAMP_TBL0 */
+        XCVR_FOLDED_PA_RAMP_TBL0,
+        /* 228: XCVR_TX_DIG->PA_RAMP_TBL1 */
+        XCVR_FOLDED_PA_RAMP_TBL1,
+        /* 229: XCVR_TX_DIG->PA_RAMP_TBL2 */
+        XCVR_FOLDED_PA_RAMP_TBL2,
+        /* 230: XCVR_TX_DIG->PA_RAMP_TBL3 */
+        XCVR_FOLDED_PA_RAMP_TBL3,
+        /* 231: XCVR_TX_DIG->SWITCH_TX_CTRL */
+        XCVR_FOLDED_SWITCH_TX_CTRL,
+        /* 232: XCVR_TX_DIG->TXDIG_CTRL */
+        XCVR_FOLDED_TXDIG_CTRL | XCVR_TX_DIG_TXDIG_CTRL_DATA_STREAM_SEL(0) | XCVR_TX_DIG_TXDIG_CTRL_MODULATOR_SEL(1) |
+            XCVR_TX_DIG_TXDIG_CTRL_PFC_EN(1),
+    },
+};
+
+const xcvr_folded_config_t xcvr_msk_250kbps_folded_config = {
+    .config     = &xcvr_msk_250kbps_full_config,
+    .reg_values = {
+        /* 0: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x14) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x10) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x0C) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x08) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+        /* 1: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x34) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x30),
+        /* 2: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x2C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x28) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x24),
+        /* 3: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x14) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x10) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x0C) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x08) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+        /* 4: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x34) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x38),
+        /* 5: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x3C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x04),
+        /* 6: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x0C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x08) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x04) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+        /* 7: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x08),
+        /* 8: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x04) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x3C),
+        /* 9: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x0C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x08) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x04) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+        /* 10: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x10),
+        /* 11: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x14) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x18) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x1C),
+        /* 12: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x34) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x38) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x3C) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+        /* 13: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x34) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x30),
+        /* 14: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x2C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x28) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x24),
+        /* 15: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x34) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x38) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x3C) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+        /* 16: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x34) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x38),
+        /* 17: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x3C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x04),
+        /* 18: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x2C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x30) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x34) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x38) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+        /* 19: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x08),
+        /* 20: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x04) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x3C),
+        /* 21: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x2C) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x30) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x34) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x38) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+        /* 22: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x10),
+        /* 23: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x14) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x18) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x1C),
+        /* 24: GEN4PHY->DMD_CTRL0 */
+        XCVR_FOLDED_DMD_CTRL0,
+        /* 25: GEN4PHY->DMD_CTRL1 */
+        XCVR_FOLDED_DMD_CTRL1,
+        /* 26: GEN4PHY->FSK_CFG0 */
+        XCVR_FOLDED_FSK_CFG0 | GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_1M(0x11) |
+            GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_2M(0x11) |
+            GEN4PHY_FSK_CFG0_MSK2FSK_SEED(1) | GEN4PHY_FSK_CFG0_MSK_EN(1),
+        /* 27: GEN4PHY->FSK_CFG1 */
+        GEN4PHY_FSK_CFG1_OVERH(0x020) | GEN4PHY_FSK_CFG1_OVERH_INV(0x100) | GEN4PHY_FSK_CFG1_SYNCTSCALE(0xF),
+        /* 28: GEN4PHY->FSK_CFG2 */
+        XCVR_FOLDED_FSK_CFG2,
+        /* 29: GEN4PHY->FSK_FAD_CFG */
+        XCVR_FOLDED_FSK_FAD_CFG,
+        /* 30: GEN4PHY->FSK_FAD_CTRL */
+        XCVR_FOLDED_FSK_FAD_CTRL,
+        /* 31: GEN4PHY->FSK_PD_CFG0 */
+        GEN4PHY_FSK_PD_CFG0_PD_IIR_ALPHA(0xFF) | GEN4PHY_FSK_PD_CFG0_PREAMBLE_T_SCALE(0xC),
+        /* 32: GEN4PHY->FSK_PD_CFG1 */
+        GEN4PHY_FSK_PD_CFG1_PREAMBLE_PATTERN(0x55),
+        /* 33: GEN4PHY->FSK_PD_CFG2 */
+        GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_1M(0xB8) | GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_2M(0xEB),
+        /* 34: GEN4PHY->FSK_PD_PH[0] */
+        GEN4PHY_FSK_PD_PH_REF0(0x02) | GEN4PHY_FSK_PD_PH_REF1(0x03) | GEN4PHY_FSK_PD_PH_REF2(0x02) |
+            GEN4PHY_FSK_PD_PH_REF3(0x00),
+        /* 35: GEN4PHY->FSK_PD_PH[1] */
+        GEN4PHY_FSK_PD_PH_REF0(0x3E) | GEN4PHY_FSK_PD_PH_REF1(0x3D) | GEN4PHY_FSK_PD_PH_REF2(0x3E) |
+            GEN4PHY_FSK_PD_PH_REF3(0x00),
+        /* 36: GEN4PHY->FSK_PT */
+        XCVR_FOLDED_FSK_PT | GEN4PHY_FSK_PT_AGC_TIMEOUT(0x0100),
+        /* 37: GEN4PHY->LR_AA_CFG */
+        GEN4PHY_LR_AA_CFG_AA_COR_THRESH(0x00) | GEN4PHY_LR_AA_CFG_AA_HAM_THRESH(0x00) |
+            GEN4PHY_LR_AA_CFG_AA_LR_CORR_GAIN(0x00) | GEN4PHY_LR_AA_CFG_ACCESS_ADDR_HAM(0x00),
+        /* 38: GEN4PHY->LR_PD_CFG */
+        GEN4PHY_LR_PD_CFG_CORR_TH(0x00) | GEN4PHY_LR_PD_CFG_FREQ_TH(0x00) | GEN4PHY_LR_PD_CFG_NO_PEAKS(0),
+        /* 39: GEN4PHY->LR_PD_PH[0] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 40: GEN4PHY->LR_PD_PH[1] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 41: GEN4PHY->LR_PD_PH[2] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 42: GEN4PHY->LR_PD_PH[3] */
+        GEN4PHY_LR_PD_PH_REF0(0x00) | GEN4PHY_LR_PD_PH_REF1(0x00) | GEN4PHY_LR_PD_PH_REF2(0x00) |
+            GEN4PHY_LR_PD_PH_REF3(0x00),
+        /* 43: GEN4PHY->MISC */
+        XCVR_FOLDED_MISC,
+        /* 44: GEN4PHY->PREPHY_MISC */
+        XCVR_FOLDED_PREPHY_MISC,
+        /* 45: GEN4PHY->RTT_CTRL */
+        XCVR_FOLDED_RTT_CTRL,
+        /* 46: GEN4PHY->RTT_REF */
+        GEN4PHY_RTT_REF_FM_REF_010(0x48) | GEN4PHY_RTT_REF_FM_REF_110(0x63) | GEN4PHY_RTT_REF_FM_REF_111(0x80),
+        /* 47: GEN4PHY->SM_CFG */
+        XCVR_FOLDED_SM_CFG | GEN4PHY_SM_CFG_AA_TIMEOUT_UNCODED(0x0A0),
+        /* 48: RADIO_CTRL->LL_CTRL */
+        RADIO_CTRL_LL_CTRL_ACTIVE_LL(2),
+        /* 49: XCVR_ANALOG->LDO_0 */
+        XCVR_FOLDED_LDO_0,
+        /* 50: XCVR_ANALOG->LDO_1 */
+        XCVR_FOLDED_LDO_1,
+        /* 51: XCVR_ANALOG->PLL */
+        XCVR_FOLDED_PLL,
+        /* 52: XCVR_ANALOG->RX_0 */
+        XCVR_FOLDED_RX_0,
+        /* 53: XCVR_ANALOG->RX_1 */
+        XCVR_FOLDED_RX_1,
+        /* 54: XCVR_ANALOG->TX_DAC_PA */
+        XCVR_FOLDED_TX_DAC_PA | XCVR_ANALOG_TX_DAC_PA_DAC_TRIM_CFBK_DRS(1),
+        /* 55: XCVR_ANALOG->XO_DIST */
+        XCVR_FOLDED_XO_DIST,
+        /* 56: XCVR_MISC->IPS_FO_ADDR[0] */
+        XCVR_MISC_IPS_FO_ADDR_ADDR(0x370) | XCVR_MISC_IPS_FO_ADDR_ENTRY_RX(0) | XCVR_MISC_IPS_FO_ADDR_ENTRY_TX(0),
+        /* 57: XCVR_MISC->IPS_FO_ADDR[1] */
+        XCVR_MISC_IPS_FO_ADDR_ADDR(0x02C) | XCVR_MISC_IPS_FO_ADDR_ENTRY_RX(0) | XCVR_MISC_IPS_FO_ADDR_ENTRY_TX(0),
+        /* 58: XCVR_MISC->IPS_FO_DRS0_DATA[0] */
+        XCVR_MISC_IPS_FO_DRS0_DATA_DRS0_DATA(0x00000000),
+        /* 59: XCVR_MISC->IPS_FO_DRS0_DATA[1] */
+        XCVR_MISC_IPS_FO_DRS0_DATA_DRS0_DATA(0x00000000),
+        /* 60: XCVR_MISC->IPS_FO_DRS1_DATA[0] */
+        XCVR_MISC_IPS_FO_DRS1_DATA_DRS1_DATA(0x00000000),
+        /* 61: XCVR_MISC->IPS_FO_DRS1_DATA[1] */
+        XCVR_MISC_IPS_FO_DRS1_DATA_DRS1_DATA(0x00000000),
+        /* 62: XCVR_MISC->LDO_TRIM_0 */
+        XCVR_FOLDED_LDO_TRIM_0,
+        /* 63: XCVR_MISC->LDO_TRIM_1 */
+        XCVR_FOLDED_LDO_TRIM_1,
+        /* 64: XCVR_MISC->XCVR_CTRL */
+        XCVR_FOLDED_XCVR_CTRL | XCVR_MISC_XCVR_CTRL_DATA_RATE_DRS(3) | XCVR_MISC_XCVR_CTRL_DEMOD_SEL(1) |
+            XCVR_MISC_XCVR_CTRL_LL_CFG_CAPT_DIS(0),
+        /* 65: XCVR_PLL_DIG->CHAN_MAP */
+        XCVR_FOLDED_CHAN_MAP | XCVR_PLL_DIG_CHAN_MAP_BAND_SELECT(0),
+        /* 66: XCVR_PLL_DIG->CHAN_MAP_EXT */
+#if RF_OSC_26MHZ == 1
+        XCVR_FOLDED_CHAN_MAP_EXT | XCVR_PLL_DIG_CHAN_MAP_EXT_NUM_OFFSET(0x013B13B),
+#else
+        XCVR_FOLDED_CHAN_MAP_EXT | XCVR_PLL_DIG_CHAN_MAP_EXT_NUM_OFFSET(0x0100000),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 67: XCVR_PLL_DIG->DATA_RATE_OVRD_CTRL1 */
+        XCVR_FOLDED_DATA_RATE_OVRD_CTRL1,
+        /* 68: XCVR_PLL_DIG->DATA_RATE_OVRD_CTRL2 */
+#if RF_OSC_26MHZ == 1
+        XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL2_NUM_OFFSET_CFG1(0x013B13B),
+#else
+        XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL2_NUM_OFFSET_CFG1(0x0100000),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 69: XCVR_PLL_DIG->DELAY_MATCH */
+        XCVR_FOLDED_DELAY_MATCH | XCVR_PLL_DIG_DELAY_MATCH_HPM_INTEGER_DELAY(0x04) |
+            XCVR_PLL_DIG_DELAY_MATCH_LPM_SDM_DELAY(0x03),
+        /* 70: XCVR_PLL_DIG->HPMCAL_CTRL */
+        XCVR_FOLDED_HPMCAL_CTRL | XCVR_PLL_DIG_HPMCAL_CTRL_HPM_CAL_ARRAY_SIZE(0),
+        /* 71: XCVR_PLL_DIG->HPM_BUMP */
+        XCVR_FOLDED_HPM_BUMP | XCVR_PLL_DIG_HPM_BUMP_HPM_VCM_CAL(2) | XCVR_PLL_DIG_HPM_BUMP_HPM_VCM_TX(2),
+        /* 72: XCVR_PLL_DIG->HPM_CAL_TIMING */
+        XCVR_FOLDED_HPM_CAL_TIMING,
+        /* 73: XCVR_PLL_DIG->HPM_CTRL */
+        XCVR_FOLDED_HPM_CTRL,
+        /* 74: XCVR_PLL_DIG->HPM_SDM_RES */
+        XCVR_FOLDED_HPM_SDM_RES | XCVR_PLL_DIG_HPM_SDM_RES_HPM_COUNT_ADJUST(0x02),
+        /* 75: XCVR_PLL_DIG->LOCK_DETECT */
+        XCVR_FOLDED_LOCK_DETECT,
+        /* 76: XCVR_PLL_DIG->LPM_CTRL */
+        XCVR_FOLDED_LPM_CTRL,
+        /* 77: XCVR_PLL_DIG->LPM_SDM_CTRL1 */
+        XCVR_FOLDED_LPM_SDM_CTRL1,
+        /* 78: XCVR_PLL_DIG->MOD_CTRL */
+        XCVR_FOLDED_MOD_CTRL,
+        /* 79: XCVR_PLL_DIG->PLL_DATARATE_CTRL */
+        XCVR_FOLDED_PLL_DATARATE_CTRL,
+        /* 80: XCVR_PLL_DIG->TUNING_CAP_RX_CTRL */
+        XCVR_FOLDED_TUNING_CAP_RX_CTRL,
+        /* 81: XCVR_PLL_DIG->TUNING_CAP_TX_CTRL */
+        XCVR_FOLDED_TUNING_CAP_TX_CTRL,
+        /* 82: XCVR_RX_DIG->ACQ_FILT_0_3 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x03) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x00) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x78) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x77),
+#else
+        XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x03) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x01) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x76) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x03),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 83: XCVR_RX_DIG->ACQ_FILT_0_3_DRS */
+        XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H0(0x00) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H1(0x00) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H2(0x00) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H3(0x00),
+        /* 84: XCVR_RX_DIG->ACQ_FILT_10_11 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x066) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x0C9),
+#else
+        XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x3FA) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x140),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 85: XCVR_RX_DIG->ACQ_FILT_10_11_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x05B) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x0E8),
+#else
+        XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x3A8) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x164),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 86: XCVR_RX_DIG->ACQ_FILT_4_7 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x06) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x1A) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_H6(0x11) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0xE7),
+#else
+        XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x15) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x6D) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_H6(0xE2) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0x36),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 87: XCVR_RX_DIG->ACQ_FILT_4_7_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x7D) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x06) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0x12) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0xFD),
+#else
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x7D) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x0A) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0xF9) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0xEB),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 88: XCVR_RX_DIG->ACQ_FILT_8_9 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x1CA) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x1F5),
+#else
+        XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x01F) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x18F),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 89: XCVR_RX_DIG->ACQ_FILT_8_9_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x1CF) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x1DD),
+#else
+        XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x03E) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x1CC),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 90: XCVR_RX_DIG->AGC_CTRL */
+        XCVR_FOLDED_AGC_CTRL,
+        /* 91: XCVR_RX_DIG->AGC_CTRL_STAT */
+        XCVR_FOLDED_AGC_CTRL_STAT,
+        /* 92: XCVR_RX_DIG->AGC_IDX0_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX0_GAIN_CFG,
+        /* 93: XCVR_RX_DIG->AGC_IDX0_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX0_GAIN_VAL,
+        /* 94: XCVR_RX_DIG->AGC_IDX0_THR */
+        XCVR_FOLDED_AGC_IDX0_THR,
+        /* 95: XCVR_RX_DIG->AGC_IDX10_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX10_GAIN_CFG,
+        /* 96: XCVR_RX_DIG->AGC_IDX10_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX10_GAIN_VAL,
+        /* 97: XCVR_RX_DIG->AGC_IDX10_THR */
+        XCVR_FOLDED_AGC_IDX10_THR,
+        /* 98: XCVR_RX_DIG->AGC_IDX11_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX11_GAIN_CFG | XCVR_RX_DIG_AGC_IDX11_GAIN_CFG_MAG_THR_11_DRS_OFS(0x00) |
+            XCVR_RX_DIG_AGC_IDX11_GAIN_CFG_MAG_THR_HI_11_DRS_OFS(0x00),
+        /* 99: XCVR_RX_DIG->AGC_IDX11_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX11_GAIN_VAL | XCVR_RX_DIG_AGC_IDX11_GAIN_VAL_MAG_THR_11(0x000) |
+            XCVR_RX_DIG_AGC_IDX11_GAIN_VAL_MAG_THR_HI_11(0x000),
+        /* 100: XCVR_RX_DIG->AGC_IDX11_THR */
+        XCVR_FOLDED_AGC_IDX11_THR,
+        /* 101: XCVR_RX_DIG->AGC_IDX1_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX1_GAIN_CFG,
+        /* 102: XCVR_RX_DIG->AGC_IDX1_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX1_GAIN_VAL,
+        /* 103: XCVR_RX_DIG->AGC_IDX1_THR */
+        XCVR_FOLDED_AGC_IDX1_THR,
+        /* 104: XCVR_RX_DIG->AGC_IDX2_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX2_GAIN_CFG,
+        /* 105: XCVR_RX_DIG->AGC_IDX2_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX2_GAIN_VAL,
+        /* 106: XCVR_RX_DIG->AGC_IDX2_THR */
+        XCVR_FOLDED_AGC_IDX2_THR,
+        /* 107: XCVR_RX_DIG->AGC_IDX3_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX3_GAIN_CFG,
+        /* 108: XCVR_RX_DIG->AGC_IDX3_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX3_GAIN_VAL,
+        /* 109: XCVR_RX_DIG->AGC_IDX3_THR */
+        XCVR_FOLDED_AGC_IDX3_THR,
+        /* 110: XCVR_RX_DIG->AGC_IDX4_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX4_GAIN_CFG,
+        /* 111: XCVR_RX_DIG->AGC_IDX4_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX4_GAIN_VAL,
+        /* 112: XCVR_RX_DIG->AGC_IDX4_THR */
+        XCVR_FOLDED_AGC_IDX4_THR,
+        /* 113: XCVR_RX_DIG->AGC_IDX5_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX5_GAIN_CFG,
+        /* 114: XCVR_RX_DIG->AGC_IDX5_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX5_GAIN_VAL,
+        /* 115: XCVR_RX_DIG->AGC_IDX5_THR */
+        XCVR_FOLDED_AGC_IDX5_THR,
+        /* 116: XCVR_RX_DIG->AGC_IDX6_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX6_GAIN_CFG,
+        /* 117: XCVR_RX_DIG->AGC_IDX6_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX6_GAIN_VAL,
+        /* 118: XCVR_RX_DIG->AGC_IDX6_THR */
+        XCVR_FOLDED_AGC_IDX6_THR,
+        /* 119: XCVR_RX_DIG->AGC_IDX7_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX7_GAIN_CFG,
+        /* 120: XCVR_RX_DIG->AGC_IDX7_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX7_GAIN_VAL,
+        /* 121: XCVR_RX_DIG->AGC_IDX7_THR */
+        XCVR_FOLDED_AGC_IDX7_THR,
+        /* 122: XCVR_RX_DIG->AGC_IDX8_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX8_GAIN_CFG,
+        /* 123: XCVR_RX_DIG->AGC_IDX8_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX8_GAIN_VAL,
+        /* 124: XCVR_RX_DIG->AGC_IDX8_THR */
+        XCVR_FOLDED_AGC_IDX8_THR,
+        /* 125: XCVR_RX_DIG->AGC_IDX9_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX9_GAIN_CFG,
+        /* 126: XCVR_RX_DIG->AGC_IDX9_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX9_GAIN_VAL,
+        /* 127: XCVR_RX_DIG->AGC_IDX9_THR */
+        XCVR_FOLDED_AGC_IDX9_THR,
+        /* 128: XCVR_RX_DIG->AGC_MIS_GAIN_CFG */
+        XCVR_FOLDED_AGC_MIS_GAIN_CFG,
+        /* 129: XCVR_RX_DIG->AGC_THR_FAST */
+        XCVR_FOLDED_AGC_THR_FAST,
+        /* 130: XCVR_RX_DIG->AGC_THR_FAST_DRS */
+        XCVR_FOLDED_AGC_THR_FAST_DRS,
+        /* 131: XCVR_RX_DIG->AGC_THR_MIS */
+        XCVR_FOLDED_AGC_THR_MIS,
+        /* 132: XCVR_RX_DIG->AGC_TIMING0 */
+        XCVR_FOLDED_AGC_TIMING0 | XCVR_RX_DIG_AGC_TIMING0_AGC_GAIN_STEP_WAIT(0x10),
+        /* 133: XCVR_RX_DIG->AGC_TIMING0_DRS */
+        XCVR_FOLDED_AGC_TIMING0_DRS | XCVR_RX_DIG_AGC_TIMING0_DRS_AGC_GAIN_STEP_WAIT(0x10),
+        /* 134: XCVR_RX_DIG->AGC_TIMING1 */
+        XCVR_FOLDED_AGC_TIMING1 | XCVR_RX_DIG_AGC_TIMING1_AGC_FREEZE_TIMEOUT(0x0A) |
+            XCVR_RX_DIG_AGC_TIMING1_AGC_HOLD_TIMEOUT(0x08),
+        /* 135: XCVR_RX_DIG->AGC_TIMING1_DRS */
+        XCVR_RX_DIG_AGC_TIMING1_DRS_AGC_FREEZE_TIMEOUT(0x0A) | XCVR_RX_DIG_AGC_TIMING1_DRS_AGC_HOLD_TIMEOUT(0x08),
+        /* 136: XCVR_RX_DIG->AGC_TIMING2 */
+        XCVR_FOLDED_AGC_TIMING2 | XCVR_RX_DIG_AGC_TIMING2_AGC_UNFREEZE_FEAT_TIMEOUT(0x000) |
+            XCVR_RX_DIG_AGC_TIMING2_AGC_UNHOLD_FEAT_TIMEOUT(0x000),
+        /* 137: XCVR_RX_DIG->AGC_TIMING2_DRS */
+        XCVR_RX_DIG_AGC_TIMING2_DRS_AGC_UNFREEZE_FEAT_TIMEOUT(0x000) |
+            XCVR_RX_DIG_AGC_TIMING2_DRS_AGC_UNHOLD_FEAT_TIMEOUT(0x000),
+        /* 138: XCVR_RX_DIG->CTRL0 */
+#if RF_OSC_26MHZ == 1
+        XCVR_FOLDED_CTRL0 | XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(2) |
+            XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x03B) |
+            XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(1) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#else
+        XCVR_FOLDED_CTRL0 | XCVR_RX_DIG_CTRL0_CIC_ORDER(1) | XCVR_RX_DIG_CTRL0_CIC_RATE(3) |
+            XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x030) |
+            XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(1) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(0),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 139: XCVR_RX_DIG->CTRL0_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(4) |
+            XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x027),
+#else
+        XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(1) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(5) |
+            XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x020),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 140: XCVR_RX_DIG->CTRL1 */
+        XCVR_FOLDED_CTRL1,
+        /* 141: XCVR_RX_DIG->DCOC_CTRL0 */
+        XCVR_FOLDED_DCOC_CTRL0 | XCVR_RX_DIG_DCOC_CTRL0_DCOC_DAC_ORDER(1) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFII(0x6) |
+            XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFIIP(1) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFQQ(0x5) |
+            XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFQQP(1),
+        /* 142: XCVR_RX_DIG->DCOC_CTRL0_DRS */
+        XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFII(6) | XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFIIP(1) |
+            XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFQQ(5) | XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFQQP(1),
+        /* 143: XCVR_RX_DIG->DCOC_CTRL1 */
+        XCVR_FOLDED_DCOC_CTRL1,
+        /* 144: XCVR_RX_DIG->DEMOD_FILT_0_1 */
+        XCVR_RX_DIG_DEMOD_FILT_0_1_H0(0x002) | XCVR_RX_DIG_DEMOD_FILT_0_1_H1(0x1F6),
+        /* 145: XCVR_RX_DIG->DEMOD_FILT_0_1_DRS */
+        XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H0(0x002) | XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H1(0x1F5),
+        /* 146: XCVR_RX_DIG->DEMOD_FILT_2_4 */
+        XCVR_RX_DIG_DEMOD_FILT_2_4_H2(0x3F3) | XCVR_RX_DIG_DEMOD_FILT_2_4_H3(0x08A) |
+            XCVR_RX_DIG_DEMOD_FILT_2_4_H4(0x116),
+        /* 147: XCVR_RX_DIG->DEMOD_FILT_2_4_DRS */
+        XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H2(0x3F5) | XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H3(0x08B) |
+            XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H4(0x112),
+        /* 148: XCVR_RX_DIG->NB_RSSI_CTRL0 */
+        XCVR_FOLDED_NB_RSSI_CTRL0,
+        /* 149: XCVR_RX_DIG->NB_RSSI_CTRL1 */
+        XCVR_FOLDED_NB_RSSI_CTRL1,
+        /* 150: XCVR_RX_DIG->RCCAL_CTRL0 */
+        XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE(2) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE_DRS(4) |
+            XCVR_RX_DIG_RCCAL_CTRL0_CBPF_CCODE_OFFSET(0x00) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE(0) |
+            XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE_DRS(1) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CMPOUT_INV(0) |
+            XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CODE_OFFSET(0x0) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_SMPL_DLY(0),
+        /* 151: XCVR_RX_DIG->RSSI_GLOBAL_CTRL */
+        XCVR_FOLDED_RSSI_GLOBAL_CTRL | XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_CCA1_ED_EN(0),
+        /* 152: XCVR_RX_DIG->WB_RSSI_CTRL */
+        XCVR_FOLDED_WB_RSSI_CTRL,
+        /* 153: XCVR_TSM->CTRL */
+        XCVR_FOLDED_CTRL,
+        /* 154: XCVR_TSM->END_OF_SEQ */
+        XCVR_FOLDED_END_OF_SEQ,
+        /* 155: XCVR_TSM->FAST_CTRL1 */
+        XCVR_FOLDED_FAST_CTRL1,
+        /* 156: XCVR_TSM->FAST_CTRL2 */
+        XCVR_FOLDED_FAST_CTRL2,
+        /* 157: XCVR_TSM->FAST_CTRL3 */
+        XCVR_FOLDED_FAST_CTRL3,
+        /* 158: XCVR_TSM->RECYCLE_COUNT */
+        XCVR_FOLDED_RECYCLE_COUNT,
+        /* 159: XCVR_TSM->TIMING00 */
+        XCVR_FOLDED_TIMING00,
+        /* 160: XCVR_TSM->TIMING01 */
+        XCVR_FOLDED_TIMING01,
+        /* 161: XCVR_TSM->TIMING02 */
+        XCVR_FOLDED_TIMING02,
+        /* 162: XCVR_TSM->TIMING03 */
+        XCVR_FOLDED_TIMING03,
+        /* 163: XCVR_TSM->TIMING04 */
+        XCVR_FOLDED_TIMING04,
+        /* 164: XCVR_TSM->TIMING05 */
+        XCVR_FOLDED_TIMING05,
+        /* 165: XCVR_TSM->TIMING06 */
+        XCVR_FOLDED_TIMING06,
+        /* 166: XCVR_TSM->TIMING07 */
+        XCVR_FOLDED_TIMING07,
+        /* 167: XCVR_TSM->TIMING08 */
+        XCVR_FOLDED_TIMING08,
+        /* 168: XCVR_TSM->TIMING09 */
+        XCVR_FOLDED_TIMING09,
+        /* 169: XCVR_TSM->TIMING10 */
+        XCVR_FOLDED_TIMING10,
+        /* 170: XCVR_TSM->TIMING11 */
+        XCVR_FOLDED_TIMING11,
+        /* 171: XCVR_TSM->TIMING12 */
+        XCVR_FOLDED_TIMING12,
+        /* 172: XCVR_TSM->TIMING13 */
+        XCVR_FOLDED_TIMING13,
+        /* 173: XCVR_TSM->TIMING14 */
+        XCVR_FOLDED_TIMING14,
+        /* 174: XCVR_TSM->TIMING15 */
+        XCVR_FOLDED_TIMING15,
+        /* 175: XCVR_TSM->TIMING16 */
+        XCVR_FOLDED_TIMING16,
+        /* 176: XCVR_TSM->TIMING17 */
+        XCVR_FOLDED_TIMING17,
+        /* 177: XCVR_TSM->TIMING18 */
+        XCVR_FOLDED_TIMING18,
+        /* 178: XCVR_TSM->TIMING19 */
+        XCVR_FOLDED_TIMING19,
+        /* 179: XCVR_TSM->TIMING20 */
+        XCVR_FOLDED_TIMING20,
+        /* 180: XCVR_TSM->TIMING21 */
+        XCVR_FOLDED_TIMING21,
+        /* 181: XCVR_TSM->TIMING22 */
+        XCVR_FOLDED_TIMING22,
+        /* 182: XCVR_TSM->TIMING23 */
+        XCVR_FOLDED_TIMING23,
+        /* 183: XCVR_TSM->TIMING24 */
+        XCVR_FOLDED_TIMING24,
+        /* 184: XCVR_TSM->TIMING25 */
+        XCVR_FOLDED_TIMING25,
+        /* 185: XCVR_TSM->TIMING26 */
+        XCVR_FOLDED_TIMING26,
+        /* 186: XCVR_TSM->TIMING27 */
+        XCVR_FOLDED_TIMING27,
+        /* 187: XCVR_TSM->TIMING28 */
+        XCVR_FOLDED_TIMING28,
+        /* 188: XCVR_TSM->TIMING29 */
+        XCVR_FOLDED_TIMING29,
+        /* 189: XCVR_TSM->TIMING30 */
+        XCVR_FOLDED_TIMING30,
+        /* 190: XCVR_TSM->TIMING31 */
+        XCVR_FOLDED_TIMING31,
+        /* 191: XCVR_TSM->TIMING32 */
+        XCVR_FOLDED_TIMING32,
+        /* 192: XCVR_TSM->TIMING33 */
+        XCVR_FOLDED_TIMING33,
+        /* 193: XCVR_TSM->TIMING34 */
+        XCVR_FOLDED_TIMING34,
+        /* 194: XCVR_TSM->TIMING35 */
+        XCVR_FOLDED_TIMING35,
+        /* 195: XCVR_TSM->TIMING36 */
+        XCVR_FOLDED_TIMING36,
+        /* 196: XCVR_TSM->TIMING37 */
+        XCVR_FOLDED_TIMING37,
+        /* 197: XCVR_TSM->TIMING38 */
+        XCVR_FOLDED_TIMING38,
+        /* 198: XCVR_TSM->TIMING39 */
+        XCVR_FOLDED_TIMING39,
+        /* 199: XCVR_TSM->TIMING40 */
+        XCVR_FOLDED_TIMING40,
+        /* 200: XCVR_TSM->TIMING41 */
+        XCVR_FOLDED_TIMING41,
+        /* 201: XCVR_TSM->TIMING42 */
+        XCVR_FOLDED_TIMING42,
+        /* 202: XCVR_TSM->TIMING43 */
+        XCVR_FOLDED_TIMING43,
+        /* 203: XCVR_TSM->TIMING44 */
+        XCVR_FOLDED_TIMING44,
+        /* 204: XCVR_TSM->TIMING45 */
+        XCVR_FOLDED_TIMING45,
+        /* 205: XCVR_TSM->TIMING46 */
+        XCVR_FOLDED_TIMING46,
+        /* 206: XCVR_TSM->TIMING47 */
+        XCVR_FOLDED_TIMING47,
+        /* 207: XCVR_TSM->TIMING48 */
+        XCVR_FOLDED_TIMING48,
+        /* 208: XCVR_TSM->TIMING49 */
+        XCVR_FOLDED_TIMING49,
+        /* 209: XCVR_TSM->TIMING50 */
+        XCVR_FOLDED_TIMING50,
+        /* 210: XCVR_TSM->TIMING51 */
+        XCVR_FOLDED_TIMING51,
+        /* 211: XCVR_TSM->TIMING52 */
+        XCVR_FOLDED_TIMING52,
+        /* 212: XCVR_TSM->WU_LATENCY */
+        XCVR_FOLDED_WU_LATENCY,
+        /* 213: XCVR_TX_DIG->DATARATE_CONFIG_FILTER_CTRL */
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(0),
+        /* 214: XCVR_TX_DIG->DATARATE_CONFIG_FSK_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV0(0x1EA0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV1(0x0120),
+#else
+        XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV0(0x1EE0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV1(0x0100),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 215: XCVR_TX_DIG->DATARATE_CONFIG_GFSK_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x013D),
+#else
+        XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x0101),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 216: XCVR_TX_DIG->DATA_PADDING_CTRL */
+        XCVR_FOLDED_DATA_PADDING_CTRL | XCVR_TX_DIG_DATA_PADDING_CTRL_DATA_PADDING_SEL(0) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_PAD_DLY(0) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_PAD_DLY_EN(1),
+        /* 217: XCVR_TX_DIG->DATA_PADDING_CTRL_1 */
+        XCVR_FOLDED_DATA_PADDING_CTRL_1 | XCVR_TX_DIG_DATA_PADDING_CTRL_1_RAMP_UP_DLY(0x04) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_1_TX_DATA_FLUSH_DLY(0x04),
+        /* 218: XCVR_TX_DIG->DATA_PADDING_CTRL_2 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_MFDEV(0x1B0D) | XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_PFDEV(0x04F2),
+#else
+        XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_MFDEV(0x1BF9) | XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_PFDEV(0x0406),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 219: XCVR_TX_DIG->FSK_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_0(0x1B0D) | XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_1(0x04F2),
+#else
+        XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_0(0x1BF9) | XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_1(0x0406),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 220: XCVR_TX_DIG->GFSK_COEFF_0_1 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_0(0x0048) | XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_1(0x0059),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_0(0x0019) | XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_1(0x002C),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 221: XCVR_TX_DIG->GFSK_COEFF_2_3 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_2(0x006B) | XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_3(0x007D),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_2(0x0046) | XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_3(0x0069),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 222: XCVR_TX_DIG->GFSK_COEFF_4_5 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_4(0x008D) | XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_5(0x009A),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_4(0x0091) | XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_5(0x00B8),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 223: XCVR_TX_DIG->GFSK_COEFF_6_7 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_6(0x00A4) | XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_7(0x00A9),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_6(0x00D8) | XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_7(0x00EA),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 224: XCVR_TX_DIG->GFSK_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(0) |
+            XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x4E9),
+#else
+        XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(0) |
+            XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x3FD),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 225: XCVR_TX_DIG->IMAGE_FILTER_CTRL */
+        XCVR_FOLDED_IMAGE_FILTER_CTRL | XCVR_TX_DIG_IMAGE_FILTER_CTRL_IMAGE_FILTER_OVRD_EN(1),
+        /* 226: XCVR_TX_DIG->PA_CTRL */
+        XCVR_FOLDED_PA_CTRL | XCVR_TX_DIG_PA_CTRL_PA_RAMP_SEL(1),
+        /* 227: XCVR_TX_DIG->PA_RAMP_TBL0 */
+        XCVR_FOLDED_PA_RAMP_TBL0,
+        /* 228: XCVR_TX_DIG->PA_RAMP_TBL1 */
+        XCVR_FOLDED_PA_RAMP_TBL1,
+        /* 229: XCVR_TX_DIG->PA_RAMP_TBL2 */
+        XCVR_FOLDED_PA_RAMP_TBL2,
+        /* 230: XCVR_TX_DIG->PA_RAMP_TBL3 */
+        XCVR_FOLDED_PA_RAMP_TBL3,
+        /* 231: XCVR_TX_DIG->SWITCH_TX_CTRL */
+        XCVR_FOLDED_SWITCH_TX_CTRL,
+        /* 232: XCVR_TX_DIG->TXDIG_CTRL */
+        XCVR_FOLDED_TXDIG_CTRL | XCVR_TX_DIG_TXDIG_CTRL_DATA_STREAM_SEL(0) | XCVR_TX_DIG_TXDIG_CTRL_MODULATOR_SEL(1) |
+            XCVR_TX_DIG_TXDIG_CTRL_PFC_EN(1),
+    },
+};
+
+const xcvr_folded_config_t xcvr_oqpsk_802p15p4_250kbps_folded_config = {
+    .config     = &xcvr_oqpsk_802p15p4_250kbps_full_config,
+    .reg_values = {
+        /* 0: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x13) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x0F) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x0B) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x08) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+        /* 1: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x35) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x31),
+        /* 2: GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x2D) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x29) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x25),
+        /* 3: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x13) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x0F) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x0B) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x08) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+        /* 4: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x35) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x38),
+        /* 5: GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x3C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x04),
+        /* 6: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x0B) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x08) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x04) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+        /* 7: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0B) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x08),
+        /* 8: GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x04) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x3C),
+        /* 9: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x0B) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x08) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x04) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+        /* 10: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0B) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x0F),
+        /* 11: GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x13) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x17) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x1B),
+        /* 12: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x35) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x38) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x3C) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+        /* 13: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x35) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x31),
+        /* 14: GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x2D) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x29) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x25),
+        /* 15: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x35) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x38) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x3C) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x00) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x04),
+        /* 16: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x3C) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x38) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x35) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x38),
+        /* 17: GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x3C) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x04),
+        /* 18: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x2D) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x31) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x35) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x38) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+        /* 19: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0B) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x08),
+        /* 20: GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x04) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x00) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x3C),
+        /* 21: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG0 */
+        GEN4PHY_DMD_WAVE_REG0_SMPL0(0x2D) | GEN4PHY_DMD_WAVE_REG0_SMPL1(0x31) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL2(0x35) | GEN4PHY_DMD_WAVE_REG0_SMPL3(0x38) |
+            GEN4PHY_DMD_WAVE_REG0_SMPL4(0x3C),
+        /* 22: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG1 */
+        GEN4PHY_DMD_WAVE_REG1_SMPL5(0x00) | GEN4PHY_DMD_WAVE_REG1_SMPL6(0x04) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL7(0x08) | GEN4PHY_DMD_WAVE_REG1_SMPL8(0x0B) |
+            GEN4PHY_DMD_WAVE_REG1_SMPL9(0x0F),
+        /* 23: GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG2 */
+        GEN4PHY_DMD_WAVE_REG2_SMPL10(0x13) | GEN4PHY_DMD_WAVE_REG2_SMPL11(0x17) | GEN4PHY_DMD_WAVE_REG2_SMPL12(0x1B),
+        /* 24: GEN4PHY->DMD_CTRL0 */
+        XCVR_FOLDED_DMD_CTRL0,
+        /* 25: GEN4PHY->DMD_CTRL1 */
+        XCVR_FOLDED_DMD_CTRL1,
+        /* 26: GEN4PHY->FSK_CFG0 */
+        XCVR_FOLDED_FSK_CFG0 | GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_1M(0x15) |
+            GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_2M(0x15) |
+            GEN4PHY_FSK_CFG0_MSK2FSK_SEED(0) | GEN4PHY_FSK_CFG0_MSK_EN(0),
+        /* 27: GEN4PHY->FSK_CFG1 */
+        GEN4PHY_FSK_CFG1_OVERH(0x020) | GEN4PHY_FSK_CFG1_OVERH_INV(0x100) | GEN4PHY_FSK_CFG1_SYNCTSCALE(0xF),
+        /* 28: GEN4PHY->FSK_CFG2 */
+        XCVR_FOLDED_FSK_CFG2,
+        /* 29: GEN4PHY->FSK_FAD_CFG */
+        XCVR_FOLDED_FSK_FAD_CFG,
+        /* 30: GEN4PHY->FSK_FAD_CTRL */
+        XCVR_FOLDED_FSK_FAD_CTRL,
+        /* 31: GEN4PHY->FSK_PD_CFG0 */
+        GEN4PHY_FSK_PD_CFG0_PD_IIR_ALPHA(0xFF) | GEN4PHY_FSK_PD_CFG0_PREAMBLE_T_SCALE(0xC),
+        /* 32: GEN4PHY->FSK_PD_CFG1 */
+        GEN4PHY_FSK_PD_CFG1_PREAMBLE_PATTERN(0x55),
+        /* 33: GEN4PHY->FSK_PD_CFG2 */
+        GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_1M(0xF6) | GEN4PHY_FSK_PD_CFG2_PD_THRESH_ACQ_1_3_2M(0xF6),
+        /* 34: GEN4PHY->FSK_PD_PH[0] */
+        GEN4PHY_FSK_PD_PH_REF0(0x03) | GEN4PHY_FSK_PD_PH_REF1(0x05) | GEN4PHY_FSK_PD_PH_REF2(0x03) |
+            GEN4PHY_FSK_PD_PH_REF3(0x00),
+        /* 35: GEN4PHY->FSK_PD_PH[1] */
+        GEN4PHY_FSK_PD_PH_REF0(0x3D) | GEN4PHY_FSK_PD_PH_REF1(0x3B) | GEN4PHY_FSK_PD_PH_REF2(0x3D) |
+            GEN4PHY_FSK_PD_PH_REF3(0x00),
+        /* 36: GEN4PHY->FSK_PT */
+        XCVR_FOLDED_FSK_PT | GEN4PHY_FSK_PT_AGC_TIMEOUT(0x0048),
+        /* 37: GEN4PHY->LR_AA_CFG */
+        GEN4PHY_LR_AA_CFG_AA_COR_THRESH(0x96) | GEN4PHY_LR_AA_CFG_AA_HAM_THRESH(0x06) |
+            GEN4PHY_LR_AA_CFG_AA_LR_CORR_GAIN(0x06) | GEN4PHY_LR_AA_CFG_ACCESS_ADDR_HAM(0x02),
+        /* 38: GEN4PHY->LR_PD_CFG */
+        GEN4PHY_LR_PD_CFG_CORR_TH(0x9A) | GEN4PHY_LR_PD_CFG_FREQ_TH(0x01) | GEN4PHY_LR_PD_CFG_NO_PEAKS(1),
+        /* 39: GEN4PHY->LR_PD_PH[0] */
+        GEN4PHY_LR_PD_PH_REF0(0x28) | GEN4PHY_LR_PD_PH_REF1(0x30) | GEN4PHY_LR_PD_PH_REF2(0x38) |
+            GEN4PHY_LR_PD_PH_REF3(0x3D),
+        /* 40: GEN4PHY->LR_PD_PH[1] */
+        GEN4PHY_LR_PD_PH_REF0(0x38) | GEN4PHY_LR_PD_PH_REF1(0x30) | GEN4PHY_LR_PD_PH_REF2(0x28) |
+            GEN4PHY_LR_PD_PH_REF3(0x20),
+        /* 41: GEN4PHY->LR_PD_PH[2] */
+        GEN4PHY_LR_PD_PH_REF0(0x18) | GEN4PHY_LR_PD_PH_REF1(0x10) | GEN4PHY_LR_PD_PH_REF2(0x08) |
+            GEN4PHY_LR_PD_PH_REF3(0x03),
+        /* 42: GEN4PHY->LR_PD_PH[3] */
+        GEN4PHY_LR_PD_PH_REF0(0x08) | GEN4PHY_LR_PD_PH_REF1(0x10) | GEN4PHY_LR_PD_PH_REF2(0x18) |
+            GEN4PHY_LR_PD_PH_REF3(0x20),
+        /* 43: GEN4PHY->MISC */
+        XCVR_FOLDED_MISC,
+        /* 44: GEN4PHY->PREPHY_MISC */
+        XCVR_FOLDED_PREPHY_MISC,
+        /* 45: GEN4PHY->RTT_CTRL */
+        XCVR_FOLDED_RTT_CTRL,
+        /* 46: GEN4PHY->RTT_REF */
+        GEN4PHY_RTT_REF_FM_REF_010(0x48) | GEN4PHY_RTT_REF_FM_REF_110(0x63) | GEN4PHY_RTT_REF_FM_REF_111(0x80),
+        /* 47: GEN4PHY->SM_CFG */
+        XCVR_FOLDED_SM_CFG | GEN4PHY_SM_CFG_AA_TIMEOUT_UNCODED(0x0A0),
+        /* 48: RADIO_CTRL->LL_CTRL */
+        RADIO_CTRL_LL_CTRL_ACTIVE_LL(1),
+        /* 49: XCVR_ANALOG->LDO_0 */
+        XCVR_FOLDED_LDO_0,
+        /* 50: XCVR_ANALOG->LDO_1 */
+        XCVR_FOLDED_LDO_1,
+        /* 51: XCVR_ANALOG->PLL */
+        XCVR_FOLDED_PLL,
+        /* 52: XCVR_ANALOG->RX_0 */
+        XCVR_FOLDED_RX_0,
+        /* 53: XCVR_ANALOG->RX_1 */
+        XCVR_FOLDED_RX_1,
+        /* 54: XCVR_ANALOG->TX_DAC_PA */
+        XCVR_FOLDED_TX_DAC_PA | XCVR_ANALOG_TX_DAC_PA_DAC_TRIM_CFBK_DRS(0),
+        /* 55: XCVR_ANALOG->XO_DIST */
+        XCVR_FOLDED_XO_DIST,
+        /* 56: XCVR_MISC->IPS_FO_ADDR[0] */
+        XCVR_MISC_IPS_FO_ADDR_ADDR(0x370) | XCVR_MISC_IPS_FO_ADDR_ENTRY_RX(0) | XCVR_MISC_IPS_FO_ADDR_ENTRY_TX(0),
+        /* 57: XCVR_MISC->IPS_FO_ADDR[1] */
+        XCVR_MISC_IPS_FO_ADDR_ADDR(0x02C) | XCVR_MISC_IPS_FO_ADDR_ENTRY_RX(0) | XCVR_MISC_IPS_FO_ADDR_ENTRY_TX(0),
+        /* 58: XCVR_MISC->IPS_FO_DRS0_DATA[0] */
+        XCVR_MISC_IPS_FO_DRS0_DATA_DRS0_DATA(0x00000000),
+        /* 59: XCVR_MISC->IPS_FO_DRS0_DATA[1] */
+        XCVR_MISC_IPS_FO_DRS0_DATA_DRS0_DATA(0x00000000),
+        /* 60: XCVR_MISC->IPS_FO_DRS1_DATA[0] */
+        XCVR_MISC_IPS_FO_DRS1_DATA_DRS1_DATA(0x00000000),
+        /* 61: XCVR_MISC->IPS_FO_DRS1_DATA[1] */
+        XCVR_MISC_IPS_FO_DRS1_DATA_DRS1_DATA(0x00000000),
+        /* 62: XCVR_MISC->LDO_TRIM_0 */
+        XCVR_FOLDED_LDO_TRIM_0,
+        /* 63: XCVR_MISC->LDO_TRIM_1 */
+        XCVR_FOLDED_LDO_TRIM_1,
+        /* 64: XCVR_MISC->XCVR_CTRL */
+        XCVR_FOLDED_XCVR_CTRL | XCVR_MISC_XCVR_CTRL_DATA_RATE_DRS(0) | XCVR_MISC_XCVR_CTRL_DEMOD_SEL(2) |
+            XCVR_MISC_XCVR_CTRL_LL_CFG_CAPT_DIS(1),
+        /* 65: XCVR_PLL_DIG->CHAN_MAP */
+        XCVR_FOLDED_CHAN_MAP | XCVR_PLL_DIG_CHAN_MAP_BAND_SELECT(4),
+        /* 66: XCVR_PLL_DIG->CHAN_MAP_EXT */
+#if RF_OSC_26MHZ == 1
+        XCVR_FOLDED_CHAN_MAP_EXT | XCVR_PLL_DIG_CHAN_MAP_EXT_NUM_OFFSET(0x013B13B),
+#else
+        XCVR_FOLDED_CHAN_MAP_EXT | XCVR_PLL_DIG_CHAN_MAP_EXT_NUM_OFFSET(0x0100000),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 67: XCVR_PLL_DIG->DATA_RATE_OVRD_CTRL1 */
+        XCVR_FOLDED_DATA_RATE_OVRD_CTRL1,
+        /* 68: XCVR_PLL_DIG->DATA_RATE_OVRD_CTRL2 */
+#if RF_OSC_26MHZ == 1
+        XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL2_NUM_OFFSET_CFG1(0x01D89D9),
+#else
+        XCVR_PLL_DIG_DATA_RATE_OVRD_CTRL2_NUM_OFFSET_CFG1(0x0180000),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 69: XCVR_PLL_DIG->DELAY_MATCH */
+        XCVR_FOLDED_DELAY_MATCH | XCVR_PLL_DIG_DELAY_MATCH_HPM_INTEGER_DELAY(0x05) |
+            XCVR_PLL_DIG_DELAY_MATCH_LPM_SDM_DELAY(0x02),
+        /* 70: XCVR_PLL_DIG->HPMCAL_CTRL */
+        XCVR_FOLDED_HPMCAL_CTRL | XCVR_PLL_DIG_HPMCAL_CTRL_HPM_CAL_ARRAY_SIZE(1),
+        /* 71: XCVR_PLL_DIG->HPM_BUMP */
+        XCVR_FOLDED_HPM_BUMP | XCVR_PLL_DIG_HPM_BUMP_HPM_VCM_CAL(4) | XCVR_PLL_DIG_HPM_BUMP_HPM_VCM_TX(4),
+        /* 72: XCVR_PLL_DIG->HPM_CAL_TIMING */
+        XCVR_FOLDED_HPM_CAL_TIMING,
+        /* 73: XCVR_PLL_DIG->HPM_CTRL */
+        XCVR_FOLDED_HPM_CTRL,
+        /* 74: XCVR_PLL_DIG->HPM_SDM_RES */
+        XCVR_FOLDED_HPM_SDM_RES | XCVR_PLL_DIG_HPM_SDM_RES_HPM_COUNT_ADJUST(0x00),
+        /* 75: XCVR_PLL_DIG->LOCK_DETECT */
+        XCVR_FOLDED_LOCK_DETECT,
+        /* 76: XCVR_PLL_DIG->LPM_CTRL */
+        XCVR_FOLDED_LPM_CTRL,
+        /* 77: XCVR_PLL_DIG->LPM_SDM_CTRL1 */
+        XCVR_FOLDED_LPM_SDM_CTRL1,
+        /* 78: XCVR_PLL_DIG->MOD_CTRL */
+        XCVR_FOLDED_MOD_CTRL,
+        /* 79: XCVR_PLL_DIG->PLL_DATARATE_CTRL */
+        XCVR_FOLDED_PLL_DATARATE_CTRL,
+        /* 80: XCVR_PLL_DIG->TUNING_CAP_RX_CTRL */
+        XCVR_FOLDED_TUNING_CAP_RX_CTRL,
+        /* 81: XCVR_PLL_DIG->TUNING_CAP_TX_CTRL */
+        XCVR_FOLDED_TUNING_CAP_TX_CTRL,
+        /* 82: XCVR_RX_DIG->ACQ_FILT_0_3 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x3E) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x01) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x08) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x0D),
+#else
+        XCVR_RX_DIG_ACQ_FILT_0_3_H0(0x02) | XCVR_RX_DIG_ACQ_FILT_0_3_H1(0x05) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_H2(0x7F) | XCVR_RX_DIG_ACQ_FILT_0_3_H3(0x73),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 83: XCVR_RX_DIG->ACQ_FILT_0_3_DRS */
+        XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H0(0x01) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H1(0x3A) |
+            XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H2(0x7F) | XCVR_RX_DIG_ACQ_FILT_0_3_DRS_H3(0x0F),
+        /* 84: XCVR_RX_DIG->ACQ_FILT_10_11 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x06F) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x09D),
+#else
+        XCVR_RX_DIG_ACQ_FILT_10_11_H10(0x061) | XCVR_RX_DIG_ACQ_FILT_10_11_H11(0x0EF),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 85: XCVR_RX_DIG->ACQ_FILT_10_11_DRS */
+        XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H10(0x021) | XCVR_RX_DIG_ACQ_FILT_10_11_DRS_H11(0x12B),
+        /* 86: XCVR_RX_DIG->ACQ_FILT_4_7 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x09) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x77) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_H6(0xE2) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0xDB),
+#else
+        XCVR_RX_DIG_ACQ_FILT_4_7_H4(0x78) | XCVR_RX_DIG_ACQ_FILT_4_7_H5(0x14) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_H6(0x22) | XCVR_RX_DIG_ACQ_FILT_4_7_H7(0xF8),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 87: XCVR_RX_DIG->ACQ_FILT_4_7_DRS */
+        XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H4(0x7F) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H5(0x61) |
+            XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H6(0x06) | XCVR_RX_DIG_ACQ_FILT_4_7_DRS_H7(0x3C),
+        /* 88: XCVR_RX_DIG->ACQ_FILT_8_9 */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x1F4) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x02C),
+#else
+        XCVR_RX_DIG_ACQ_FILT_8_9_H8(0x1BC) | XCVR_RX_DIG_ACQ_FILT_8_9_H9(0x1D5),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 89: XCVR_RX_DIG->ACQ_FILT_8_9_DRS */
+        XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H8(0x1F3) | XCVR_RX_DIG_ACQ_FILT_8_9_DRS_H9(0x194),
+        /* 90: XCVR_RX_DIG->AGC_CTRL */
+        XCVR_FOLDED_AGC_CTRL,
+        /* 91: XCVR_RX_DIG->AGC_CTRL_STAT */
+        XCVR_FOLDED_AGC_CTRL_STAT,
+        /* 92: XCVR_RX_DIG->AGC_IDX0_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX0_GAIN_CFG,
+        /* 93: XCVR_RX_DIG->AGC_IDX0_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX0_GAIN_VAL,
+        /* 94: XCVR_RX_DIG->AGC_IDX0_THR */
+        XCVR_FOLDED_AGC_IDX0_THR,
+        /* 95: XCVR_RX_DIG->AGC_IDX10_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX10_GAIN_CFG,
+        /* 96: XCVR_RX_DIG->AGC_IDX10_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX10_GAIN_VAL,
+        /* 97: XCVR_RX_DIG->AGC_IDX10_THR */
+        XCVR_FOLDED_AGC_IDX10_THR,
+        /* 98: XCVR_RX_DIG->AGC_IDX11_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX11_GAIN_CFG | XCVR_RX_DIG_AGC_IDX11_GAIN_CFG_MAG_THR_11_DRS_OFS(0x00) |
+            XCVR_RX_DIG_AGC_IDX11_GAIN_CFG_MAG_THR_HI_11_DRS_OFS(0x00),
+        /* 99: XCVR_RX_DIG->AGC_IDX11_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX11_GAIN_VAL | XCVR_RX_DIG_AGC_IDX11_GAIN_VAL_MAG_THR_11(0x000) |
+            XCVR_RX_DIG_AGC_IDX11_GAIN_VAL_MAG_THR_HI_11(0x000),
+        /* 100: XCVR_RX_DIG->AGC_IDX11_THR */
+        XCVR_FOLDED_AGC_IDX11_THR,
+        /* 101: XCVR_RX_DIG->AGC_IDX1_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX1_GAIN_CFG,
+        /* 102: XCVR_RX_DIG->AGC_IDX1_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX1_GAIN_VAL,
+        /* 103: XCVR_RX_DIG->AGC_IDX1_THR */
+        XCVR_FOLDED_AGC_IDX1_THR,
+        /* 104: XCVR_RX_DIG->AGC_IDX2_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX2_GAIN_CFG,
+        /* 105: XCVR_RX_DIG->AGC_IDX2_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX2_GAIN_VAL,
+        /* 106: XCVR_RX_DIG->AGC_IDX2_THR */
+        XCVR_FOLDED_AGC_IDX2_THR,
+        /* 107: XCVR_RX_DIG->AGC_IDX3_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX3_GAIN_CFG,
+        /* 108: XCVR_RX_DIG->AGC_IDX3_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX3_GAIN_VAL,
+        /* 109: XCVR_RX_DIG->AGC_IDX3_THR */
+        XCVR_FOLDED_AGC_IDX3_THR,
+        /* 110: XCVR_RX_DIG->AGC_IDX4_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX4_GAIN_CFG,
+        /* 111: XCVR_RX_DIG->AGC_IDX4_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX4_GAIN_VAL,
+        /* 112: XCVR_RX_DIG->AGC_IDX4_THR */
+        XCVR_FOLDED_AGC_IDX4_THR,
+        /* 113: XCVR_RX_DIG->AGC_IDX5_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX5_GAIN_CFG,
+        /* 114: XCVR_RX_DIG->AGC_IDX5_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX5_GAIN_VAL,
+        /* 115: XCVR_RX_DIG->AGC_IDX5_THR */
+        XCVR_FOLDED_AGC_IDX5_THR,
+        /* 116: XCVR_RX_DIG->AGC_IDX6_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX6_GAIN_CFG,
+        /* 117: XCVR_RX_DIG->AGC_IDX6_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX6_GAIN_VAL,
+        /* 118: XCVR_RX_DIG->AGC_IDX6_THR */
+        XCVR_FOLDED_AGC_IDX6_THR,
+        /* 119: XCVR_RX_DIG->AGC_IDX7_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX7_GAIN_CFG,
+        /* 120: XCVR_RX_DIG->AGC_IDX7_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX7_GAIN_VAL,
+        /* 121: XCVR_RX_DIG->AGC_IDX7_THR */
+        XCVR_FOLDED_AGC_IDX7_THR,
+        /* 122: XCVR_RX_DIG->AGC_IDX8_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX8_GAIN_CFG,
+        /* 123: XCVR_RX_DIG->AGC_IDX8_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX8_GAIN_VAL,
+        /* 124: XCVR_RX_DIG->AGC_IDX8_THR */
+        XCVR_FOLDED_AGC_IDX8_THR,
+        /* 125: XCVR_RX_DIG->AGC_IDX9_GAIN_CFG */
+        XCVR_FOLDED_AGC_IDX9_GAIN_CFG,
+        /* 126: XCVR_RX_DIG->AGC_IDX9_GAIN_VAL */
+        XCVR_FOLDED_AGC_IDX9_GAIN_VAL,
+        /* 127: XCVR_RX_DIG->AGC_IDX9_THR */
+        XCVR_FOLDED_AGC_IDX9_THR,
+        /* 128: XCVR_RX_DIG->AGC_MIS_GAIN_CFG */
+        XCVR_FOLDED_AGC_MIS_GAIN_CFG,
+        /* 129: XCVR_RX_DIG->AGC_THR_FAST */
+        XCVR_FOLDED_AGC_THR_FAST,
+        /* 130: XCVR_RX_DIG->AGC_THR_FAST_DRS */
+        XCVR_FOLDED_AGC_THR_FAST_DRS,
+        /* 131: XCVR_RX_DIG->AGC_THR_MIS */
+        XCVR_FOLDED_AGC_THR_MIS,
+        /* 132: XCVR_RX_DIG->AGC_TIMING0 */
+        XCVR_FOLDED_AGC_TIMING0 | XCVR_RX_DIG_AGC_TIMING0_AGC_GAIN_STEP_WAIT(0x08),
+        /* 133: XCVR_RX_DIG->AGC_TIMING0_DRS */
+        XCVR_FOLDED_AGC_TIMING0_DRS | XCVR_RX_DIG_AGC_TIMING0_DRS_AGC_GAIN_STEP_WAIT(0x08),
+        /* 134: XCVR_RX_DIG->AGC_TIMING1 */
+        XCVR_FOLDED_AGC_TIMING1 | XCVR_RX_DIG_AGC_TIMING1_AGC_FREEZE_TIMEOUT(0x27) |
+            XCVR_RX_DIG_AGC_TIMING1_AGC_HOLD_TIMEOUT(0x05),
+        /* 135: XCVR_RX_DIG->AGC_TIMING1_DRS */
+        XCVR_RX_DIG_AGC_TIMING1_DRS_AGC_FREEZE_TIMEOUT(0x27) | XCVR_RX_DIG_AGC_TIMING1_DRS_AGC_HOLD_TIMEOUT(0x05),
+        /* 136: XCVR_RX_DIG->AGC_TIMING2 */
+        XCVR_FOLDED_AGC_TIMING2 | XCVR_RX_DIG_AGC_TIMING2_AGC_UNFREEZE_FEAT_TIMEOUT(0x07F) |
+            XCVR_RX_DIG_AGC_TIMING2_AGC_UNHOLD_FEAT_TIMEOUT(0x000),
+        /* 137: XCVR_RX_DIG->AGC_TIMING2_DRS */
+        XCVR_RX_DIG_AGC_TIMING2_DRS_AGC_UNFREEZE_FEAT_TIMEOUT(0x07F) |
+            XCVR_RX_DIG_AGC_TIMING2_DRS_AGC_UNHOLD_FEAT_TIMEOUT(0x000),
+        /* 138: XCVR_RX_DIG->CTRL0 */
+#if RF_OSC_26MHZ == 1
+        XCVR_FOLDED_CTRL0 | XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(2) |
+            XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x027) |
+            XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(0) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(1),
+#else
+        XCVR_FOLDED_CTRL0 | XCVR_RX_DIG_CTRL0_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_CIC_RATE(3) |
+            XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(0x020) |
+            XCVR_RX_DIG_CTRL0_RX_ACQ_FILT_LEN(0) | XCVR_RX_DIG_CTRL0_RX_FSK_ZB_SEL(1),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 139: XCVR_RX_DIG->CTRL0_DRS */
+#if RF_OSC_26MHZ == 1
+        XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(3) |
+            XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x03B),
+#else
+        XCVR_RX_DIG_CTRL0_DRS_CIC_ORDER(0) | XCVR_RX_DIG_CTRL0_DRS_CIC_RATE(3) |
+            XCVR_RX_DIG_CTRL0_DRS_DIG_MIXER_FREQ(0x030),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 140: XCVR_RX_DIG->CTRL1 */
+        XCVR_FOLDED_CTRL1,
+        /* 141: XCVR_RX_DIG->DCOC_CTRL0 */
+        XCVR_FOLDED_DCOC_CTRL0 | XCVR_RX_DIG_DCOC_CTRL0_DCOC_DAC_ORDER(0) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFII(0x8) |
+            XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFIIP(1) | XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFQQ(0x2) |
+            XCVR_RX_DIG_DCOC_CTRL0_DCOC_SFQQP(0),
+        /* 142: XCVR_RX_DIG->DCOC_CTRL0_DRS */
+        XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFII(4) | XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFIIP(1) |
+            XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFQQ(1) | XCVR_RX_DIG_DCOC_CTRL0_DRS_DCOC_SFQQP(0),
+        /* 143: XCVR_RX_DIG->DCOC_CTRL1 */
+        XCVR_FOLDED_DCOC_CTRL1,
+        /* 144: XCVR_RX_DIG->DEMOD_FILT_0_1 */
+        XCVR_RX_DIG_DEMOD_FILT_0_1_H0(0x1FD) | XCVR_RX_DIG_DEMOD_FILT_0_1_H1(0x1FE),
+        /* 145: XCVR_RX_DIG->DEMOD_FILT_0_1_DRS */
+        XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H0(0x003) | XCVR_RX_DIG_DEMOD_FILT_0_1_DRS_H1(0x0FF),
+        /* 146: XCVR_RX_DIG->DEMOD_FILT_2_4 */
+        XCVR_RX_DIG_DEMOD_FILT_2_4_H2(0x024) | XCVR_RX_DIG_DEMOD_FILT_2_4_H3(0x082) |
+            XCVR_RX_DIG_DEMOD_FILT_2_4_H4(0x0BA),
+        /* 147: XCVR_RX_DIG->DEMOD_FILT_2_4_DRS */
+        XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H2(0x1FF) | XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H3(0x088) |
+            XCVR_RX_DIG_DEMOD_FILT_2_4_DRS_H4(0x124),
+        /* 148: XCVR_RX_DIG->NB_RSSI_CTRL0 */
+        XCVR_FOLDED_NB_RSSI_CTRL0,
+        /* 149: XCVR_RX_DIG->NB_RSSI_CTRL1 */
+        XCVR_FOLDED_NB_RSSI_CTRL1,
+        /* 150: XCVR_RX_DIG->RCCAL_CTRL0 */
+        XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE(2) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_BW_CODE_DRS(3) |
+            XCVR_RX_DIG_RCCAL_CTRL0_CBPF_CCODE_OFFSET(0x00) | XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE(1) |
+            XCVR_RX_DIG_RCCAL_CTRL0_CBPF_SC_CODE_DRS(0) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CMPOUT_INV(0) |
+            XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_CODE_OFFSET(0x0) | XCVR_RX_DIG_RCCAL_CTRL0_RCCAL_SMPL_DLY(0),
+        /* 151: XCVR_RX_DIG->RSSI_GLOBAL_CTRL */
+        XCVR_FOLDED_RSSI_GLOBAL_CTRL | XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_CCA1_ED_EN(1),
+        /* 152: XCVR_RX_DIG->WB_RSSI_CTRL */
+        XCVR_FOLDED_WB_RSSI_CTRL,
+        /* 153: XCVR_TSM->CTRL */
+        XCVR_FOLDED_CTRL,
+        /* 154: XCVR_TSM->END_OF_SEQ */
+        XCVR_FOLDED_END_OF_SEQ,
+        /* 155: XCVR_TSM->FAST_CTRL1 */
+        XCVR_FOLDED_FAST_CTRL1,
+        /* 156: XCVR_TSM->FAST_CTRL2 */
+        XCVR_FOLDED_FAST_CTRL2,
+        /* 157: XCVR_TSM->FAST_CTRL3 */
+        XCVR_FOLDED_FAST_CTRL3,
+        /* 158: XCVR_TSM->RECYCLE_COUNT */
+        XCVR_FOLDED_RECYCLE_COUNT,
+        /* 159: XCVR_TSM->TIMING00 */
+        XCVR_FOLDED_TIMING00,
+        /* 160: XCVR_TSM->TIMING01 */
+        XCVR_FOLDED_TIMING01,
+        /* 161: XCVR_TSM->TIMING02 */
+        XCVR_FOLDED_TIMING02,
+        /* 162: XCVR_TSM->TIMING03 */
+        XCVR_FOLDED_TIMING03,
+        /* 163: XCVR_TSM->TIMING04 */
+        XCVR_FOLDED_TIMING04,
+        /* 164: XCVR_TSM->TIMING05 */
+        XCVR_FOLDED_TIMING05,
+        /* 165: XCVR_TSM->TIMING06 */
+        XCVR_FOLDED_TIMING06,
+        /* 166: XCVR_TSM->TIMING07 */
+        XCVR_FOLDED_TIMING07,
+        /* 167: XCVR_TSM->TIMING08 */
+        XCVR_FOLDED_TIMING08,
+        /* 168: XCVR_TSM->TIMING09 */
+        XCVR_FOLDED_TIMING09,
+        /* 169: XCVR_TSM->TIMING10 */
+        XCVR_FOLDED_TIMING10,
+        /* 170: XCVR_TSM->TIMING11 */
+        XCVR_FOLDED_TIMING11,
+        /* 171: XCVR_TSM->TIMING12 */
+        XCVR_FOLDED_TIMING12,
+        /* 172: XCVR_TSM->TIMING13 */
+        XCVR_FOLDED_TIMING13,
+        /* 173: XCVR_TSM->TIMING14 */
+        XCVR_FOLDED_TIMING14,
+        /* 174: XCVR_TSM->TIMING15 */
+        XCVR_FOLDED_TIMING15,
+        /* 175: XCVR_TSM->TIMING16 */
+        XCVR_FOLDED_TIMING16,
+        /* 176: XCVR_TSM->TIMING17 */
+        XCVR_FOLDED_TIMING17,
+        /* 177: XCVR_TSM->TIMING18 */
+        XCVR_FOLDED_TIMING18,
+        /* 178: XCVR_TSM->TIMING19 */
+        XCVR_FOLDED_TIMING19,
+        /* 179: XCVR_TSM->TIMING20 */
+        XCVR_FOLDED_TIMING20,
+        /* 180: XCVR_TSM->TIMING21 */
+        XCVR_FOLDED_TIMING21,
+        /* 181: XCVR_TSM->TIMING22 */
+        XCVR_FOLDED_TIMING22,
+        /* 182: XCVR_TSM->TIMING23 */
+        XCVR_FOLDED_TIMING23,
+        /* 183: XCVR_TSM->TIMING24 */
+        XCVR_FOLDED_TIMING24,
+        /* 184: XCVR_TSM->TIMING25 */
+        XCVR_FOLDED_TIMING25,
+        /* 185: XCVR_TSM->TIMING26 */
+        XCVR_FOLDED_TIMING26,
+        /* 186: XCVR_TSM->TIMING27 */
+        XCVR_FOLDED_TIMING27,
+        /* 187: XCVR_TSM->TIMING28 */
+        XCVR_FOLDED_TIMING28,
+        /* 188: XCVR_TSM->TIMING29 */
+        XCVR_FOLDED_TIMING29,
+        /* 189: XCVR_TSM->TIMING30 */
+        XCVR_FOLDED_TIMING30,
+        /* 190: XCVR_TSM->TIMING31 */
+        XCVR_FOLDED_TIMING31,
+        /* 191: XCVR_TSM->TIMING32 */
+        XCVR_FOLDED_TIMING32,
+        /* 192: XCVR_TSM->TIMING33 */
+        XCVR_FOLDED_TIMING33,
+        /* 193: XCVR_TSM->TIMING34 */
+        XCVR_FOLDED_TIMING34,
+        /* 194: XCVR_TSM->TIMING35 */
+        XCVR_FOLDED_TIMING35,
+        /* 195: XCVR_TSM->TIMING36 */
+        XCVR_FOLDED_TIMING36,
+        /* 196: XCVR_TSM->TIMING37 */
+        XCVR_FOLDED_TIMING37,
+        /* 197: XCVR_TSM->TIMING38 */
+        XCVR_FOLDED_TIMING38,
+        /* 198: XCVR_TSM->TIMING39 */
+        XCVR_FOLDED_TIMING39,
+        /* 199: XCVR_TSM->TIMING40 */
+        XCVR_FOLDED_TIMING40,
+        /* 200: XCVR_TSM->TIMING41 */
+        XCVR_FOLDED_TIMING41,
+        /* 201: XCVR_TSM->TIMING42 */
+        XCVR_FOLDED_TIMING42,
+        /* 202: XCVR_TSM->TIMING43 */
+        XCVR_FOLDED_TIMING43,
+        /* 203: XCVR_TSM->TIMING44 */
+        XCVR_FOLDED_TIMING44,
+        /* 204: XCVR_TSM->TIMING45 */
+        XCVR_FOLDED_TIMING45,
+        /* 205: XCVR_TSM->TIMING46 */
+        XCVR_FOLDED_TIMING46,
+        /* 206: XCVR_TSM->TIMING47 */
+        XCVR_FOLDED_TIMING47,
+        /* 207: XCVR_TSM->TIMING48 */
+        XCVR_FOLDED_TIMING48,
+        /* 208: XCVR_TSM->TIMING49 */
+        XCVR_FOLDED_TIMING49,
+        /* 209: XCVR_TSM->TIMING50 */
+        XCVR_FOLDED_TIMING50,
+        /* 210: XCVR_TSM->TIMING51 */
+        XCVR_FOLDED_TIMING51,
+        /* 211: XCVR_TSM->TIMING52 */
+        XCVR_FOLDED_TIMING52,
+        /* 212: XCVR_TSM->WU_LATENCY */
+        XCVR_FOLDED_WU_LATENCY,
+        /* 213: XCVR_TX_DIG->DATARATE_CONFIG_FILTER_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(0),
+#else
+        XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_FIR_FILTER_OVRD(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FILTER_OVRD_EN(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_FILTER_OVRD(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_GFSK_FILT_CLK_SEL(1) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_IMAGE_FIR_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC0_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_CLK_SEL(0) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FILTER_CTRL_DATARATE_CONFIG_SYNC1_FILTER_OVRD(0),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 214: XCVR_TX_DIG->DATARATE_CONFIG_FSK_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV0(0x0000) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV1(0x0000),
+#else
+        XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV0(0x1800) |
+            XCVR_TX_DIG_DATARATE_CONFIG_FSK_CTRL_DATARATE_CONFIG_FSK_FDEV1(0x0800),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 215: XCVR_TX_DIG->DATARATE_CONFIG_GFSK_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x09DE),
+#else
+        XCVR_TX_DIG_DATARATE_CONFIG_GFSK_CTRL_DATARATE_CONFIG_GFSK_FDEV(0x0804),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 216: XCVR_TX_DIG->DATA_PADDING_CTRL */
+        XCVR_FOLDED_DATA_PADDING_CTRL | XCVR_TX_DIG_DATA_PADDING_CTRL_DATA_PADDING_SEL(2) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_PAD_DLY(0) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_PAD_DLY_EN(1),
+        /* 217: XCVR_TX_DIG->DATA_PADDING_CTRL_1 */
+        XCVR_FOLDED_DATA_PADDING_CTRL_1 | XCVR_TX_DIG_DATA_PADDING_CTRL_1_RAMP_UP_DLY(0x00) |
+            XCVR_TX_DIG_DATA_PADDING_CTRL_1_TX_DATA_FLUSH_DLY(0x06),
+        /* 218: XCVR_TX_DIG->DATA_PADDING_CTRL_2 */
+        XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_MFDEV(0x1800) | XCVR_TX_DIG_DATA_PADDING_CTRL_2_DATA_PAD_PFDEV(0x0800),
+        /* 219: XCVR_TX_DIG->FSK_CTRL */
+        XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_0(0x1C00) | XCVR_TX_DIG_FSK_CTRL_FSK_FDEV_1(0x0400),
+        /* 220: XCVR_TX_DIG->GFSK_COEFF_0_1 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_0(0x017) | XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_1(0x029),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_0(0x001) | XCVR_TX_DIG_GFSK_COEFF_0_1_GFSK_COEFF_1(0x004),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 221: XCVR_TX_DIG->GFSK_COEFF_2_3 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_2(0x044) | XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_3(0x067),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_2(0x00D) | XCVR_TX_DIG_GFSK_COEFF_2_3_GFSK_COEFF_3(0x028),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 222: XCVR_TX_DIG->GFSK_COEFF_4_5 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_4(0x090) | XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_5(0x0BA),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_4(0x063) | XCVR_TX_DIG_GFSK_COEFF_4_5_GFSK_COEFF_5(0x0C0),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 223: XCVR_TX_DIG->GFSK_COEFF_6_7 */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_6(0x0DC) | XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_7(0x0EF),
+#else
+        XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_6(0x12C) | XCVR_TX_DIG_GFSK_COEFF_6_7_GFSK_COEFF_7(0x176),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 224: XCVR_TX_DIG->GFSK_CTRL */
+#if RF_OSC_26MHZ == 1
+        XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(0) |
+            XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x4E9),
+#else
+        XCVR_TX_DIG_GFSK_CTRL_BT_EQ_OR_GTR_ONE(0) | XCVR_TX_DIG_GFSK_CTRL_GFSK_COEFF_MAN(0) |
+            XCVR_TX_DIG_GFSK_CTRL_GFSK_FDEV(0x3FD),
+#endif /* RF_OSC_26MHZ == 1 */
+        /* 225: XCVR_TX_DIG->IMAGE_FILTER_CTRL */
+        XCVR_FOLDED_IMAGE_FILTER_CTRL | XCVR_TX_DIG_IMAGE_FILTER_CTRL_IMAGE_FILTER_OVRD_EN(0),
+        /* 226: XCVR_TX_DIG->PA_CTRL */
+        XCVR_FOLDED_PA_CTRL | XCVR_TX_DIG_PA_CTRL_PA_RAMP_SEL(2),
+        /* 227: XCVR_TX_DIG->PA_RAMP_TBL0 */
+        XCVR_FOLDED_PA_RAMP_TBL0,
+        /* 228: XCVR_TX_DIG->PA_RAMP_TBL1 */
+        XCVR_FOLDED_PA_RAMP_TBL1,
+        /* 229: XCVR_TX_DIG->PA_RAMP_TBL2 */
+        XCVR_FOLDED_PA_RAMP_TBL2,
+        /* 230: XCVR_TX_DIG->PA_RAMP_TBL3 */
+        XCVR_FOLDED_PA_RAMP_TBL3,
+        /* 231: XCVR_TX_DIG->SWITCH_TX_CTRL */
+        XCVR_FOLDED_SWITCH_TX_CTRL,
+        /* 232: XCVR_TX_DIG->TXDIG_CTRL */
+        XCVR_FOLDED_TXDIG_CTRL | XCVR_TX_DIG_TXDIG_CTRL_DATA_STREAM_SEL(1) | XCVR_TX_DIG_TXDIG_CTRL_MODULATOR_SEL(1) |
+            XCVR_TX_DIG_TXDIG_CTRL_PFC_EN(1),
+    },
+};
+/* clang-format on */
@@ -6,6 +6,7 @@
 
  */
 
+#include <stddef.h>
 #include "fsl_common.h"
 #include "nxp2p4_xcvr.h"
 #include "nxp_xcvr_mode_config.h"
@@ -13,14 +14,325 @@
 /*******************************************************************************
  * Definitions
  ******************************************************************************/
+/* Write a register only when the merged value of the target configuration differs from the active configuration */
+#define XCVR_DELTA_REG_WRITE(reg, curr_val, new_val) \
+    do                                               \
+    {                                                \
+        if ((curr_val) != (new_val))                 \
+        {                                            \
+            (reg) = (new_val);                       \
+        }                                            \
+        else                                         \
+        {                                            \
+            skipped++;                               \
+        }                                            \
+    } while (false)
+
+/* Byte offsets of the configuration fields merged into a register by the table driven register setup */
+#define XCVR_COMMON_FIELD(field) ((uint16_t)offsetof(xcvr_common_config_t, field))
+#define XCVR_MODE_FIELD(field)   ((uint16_t)offsetof(xcvr_mode_datarate_config_t, field))
+
+/* Size in words of the configuration structures carried by a radio configuration blob */
+#define XCVR_BLOB_COMMON_WORDS ((uint32_t)(sizeof(xcvr_common_config_t) / sizeof(uint32_t)))
+#define XCVR_BLOB_MODE_WORDS   ((uint32_t)(sizeof(xcvr_mode_datarate_config_t) / sizeof(uint32_t)))
+#define XCVR_BLOB_CODING_WORDS ((uint32_t)(sizeof(xcvr_coding_config_t) / sizeof(uint32_t)))
 
 /*******************************************************************************
  * Prototypes
  ******************************************************************************/
+static uint32_t XCVR_RegDescValue(const xcvr_reg_desc_t *desc,
+                                  const xcvr_common_config_t *common_cfg,
+                                  const xcvr_mode_datarate_config_t *mode_datarate_cfg);
+static bool XCVR_ModeDeltaIsValid(const xcvr_mode_delta_config_t *delta_config);
+static uint32_t XCVR_ModeDeltaWord(const xcvr_mode_delta_config_t *delta_config, uint16_t word_idx);
 
 /*******************************************************************************
  * Variables
  ******************************************************************************/
+/* Register descriptor table, same register order as XCVR_RadioGenRegSetup() */
+/***********************************************/
+/*********** START OF GENERATED CODE ***********/
+/************** xcvr_reg_desc_table ************/
+/***********************************************/
+const xcvr_reg_desc_t xcvr_reg_desc_table[XCVR_REG_IMAGE_NUM_REGS] = {
+    /*******************/
+    /* GEN4PHY configs */
+    /*******************/
+    {&GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG0, XCVR_REG_NO_FIELD, XCVR_MODE_FIELD(demod_wave[0].dmd_wave_reg0)},
+    {&GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG1, XCVR_REG_NO_FIELD, XCVR_MODE_FIELD(demod_wave[0].dmd_wave_reg1)},
+    {&GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG2, XCVR_REG_NO_FIELD, XCVR_MODE_FIELD(demod_wave[0].dmd_wave_reg2)},
+    {&GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG0, XCVR_REG_NO_FIELD, XCVR_MODE_FIELD(demod_wave[1].dmd_wave_reg0)},
+    {&GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG1, XCVR_REG_NO_FIELD, XCVR_MODE_FIELD(demod_wave[1].dmd_wave_reg1)},
+    {&GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG2, XCVR_REG_NO_FIELD, XCVR_MODE_FIELD(demod_wave[1].dmd_wave_reg2)},
+    {&GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG0, XCVR_REG_NO_FIELD, XCVR_MODE_FIELD(demod_wave[2].dmd_wave_reg0)},
+    {&GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG1, XCVR_REG_NO_FIELD, XCVR_MODE_FIELD(demod_wave[2].dmd_wave_reg1)},
+    {&GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG2, XCVR_REG_NO_FIELD, XCVR_MODE_FIELD(demod_wave[2].dmd_wave_reg2)},
+    {&GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG0, XCVR_REG_NO_FIELD, XCVR_MODE_FIELD(demod_wave[3].dmd_wave_reg0)},
+    {&GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG1, XCVR_REG_NO_FIELD, XCVR_MODE_FIELD(demod_wave[3].dmd_wave_reg1)},
+    {&GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG2, XCVR_REG_NO_FIELD, XCVR_MODE_FIELD(demod_wave[3].dmd_wave_reg2)},
+    {&GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG0, XCVR_REG_NO_FIELD, XCVR_MODE_FIELD(demod_wave[4].dmd_wave_reg0)},
+    {&GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG1, XCVR_REG_NO_FIELD, XCVR_MODE_FIELD(demod_wave[4].dmd_wave_reg1)},
+    {&GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG2, XCVR_REG_NO_FIELD, XCVR_MODE_FIELD(demod_wave[4].dmd_wave_reg2)},
+    {&GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG0, XCVR_REG_NO_FIELD, XCVR_MODE_FIELD(demod_wave[5].dmd_wave_reg0)},
+    {&GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG1, XCVR_REG_NO_FIELD, XCVR_MODE_FIELD(demod_wave[5].dmd_wave_reg1)},
+    {&GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG2, XCVR_REG_NO_FIELD, XCVR_MODE_FIELD(demod_wave[5].dmd_wave_reg2)},
+    {&GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG0, XCVR_REG_NO_FIELD, XCVR_MODE_FIELD(demod_wave[6].dmd_wave_reg0)},
+    {&GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG1, XCVR_REG_NO_FIELD, XCVR_MODE_FIELD(demod_wave[6].dmd_wave_reg1)},
+    {&GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG2, XCVR_REG_NO_FIELD, XCVR_MODE_FIELD(demod_wave[6].dmd_wave_reg2)},
+    {&GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG0, XCVR_REG_NO_FIELD, XCVR_MODE_FIELD(demod_wave[7].dmd_wave_reg0)},
+    {&GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG1, XCVR_REG_NO_FIELD, XCVR_MODE_FIELD(demod_wave[7].dmd_wave_reg1)},
+    {&GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG2, XCVR_REG_NO_FIELD, XCVR_MODE_FIELD(demod_wave[7].dmd_wave_reg2)},
+    {&GEN4PHY->DMD_CTRL0, XCVR_COMMON_FIELD(dmd_ctrl0), XCVR_REG_NO_FIELD},
+    {&GEN4PHY->DMD_CTRL1, XCVR_COMMON_FIELD(dmd_ctrl1), XCVR_REG_NO_FIELD},
+    {&GEN4PHY->FSK_CFG0, XCVR_COMMON_FIELD(fsk_cfg0), XCVR_MODE_FIELD(fsk_cfg0)},
+    {&GEN4PHY->FSK_CFG1, XCVR_REG_NO_FIELD, XCVR_MODE_FIELD(fsk_cfg1)},
+    {&GEN4PHY->FSK_CFG2, XCVR_COMMON_FIELD(fsk_cfg2), XCVR_REG_NO_FIELD},
+    {&GEN4PHY->FSK_FAD_CFG, XCVR_COMMON_FIELD(fsk_fad_cfg), XCVR_REG_NO_FIELD},
+    {&GEN4PHY->FSK_FAD_CTRL, XCVR_COMMON_FIELD(fsk_fad_ctrl), XCVR_REG_NO_FIELD},
+    {&GEN4PHY->FSK_PD_CFG0, XCVR_REG_NO_FIELD, XCVR_MODE_FIELD(fsk_pd_cfg0)},
+    {&GEN4PHY->FSK_PD_CFG1, XCVR_REG_NO_FIELD, XCVR_MODE_FIELD(fsk_pd_cfg1)},
+    {&GEN4PHY->FSK_PD_CFG2, XCVR_REG_NO_FIELD, XCVR_MODE_FIELD(fsk_pd_cfg2)},
+    {&GEN4PHY->FSK_PD_PH[0], XCVR_REG_NO_FIELD, XCVR_MODE_FIELD(fsk_pd_ph[0])},
+    {&GEN4PHY->FSK_PD_PH[1], XCVR_REG_NO_FIELD, XCVR_MODE_FIELD(fsk_pd_ph[1])},
+    {&GEN4PHY->FSK_PT, XCVR_COMMON_FIELD(fsk_pt), XCVR_MODE_FIELD(fsk_pt)},
+    {&GEN4PHY->LR_AA_CFG, XCVR_REG_NO_FIELD, XCVR_MODE_FIELD(lr_aa_cfg)},
+    {&GEN4PHY->LR_PD_CFG, XCVR_REG_NO_FIELD, XCVR_MODE_FIELD(lr_pd_cfg)},
+    {&GEN4PHY->LR_PD_PH[0], XCVR_REG_NO_FIELD, XCVR_MODE_FIELD(lr_pd_ph[0])},
+    {&GEN4PHY->LR_PD_PH[1], XCVR_REG_NO_FIELD, XCVR_MODE_FIELD(lr_pd_ph[1])},
+    {&GEN4PHY->LR_PD_PH[2], XCVR_REG_NO_FIELD, XCVR_MODE_FIELD(lr_pd_ph[2])},
+    {&GEN4PHY->LR_PD_PH[3], XCVR_REG_NO_FIELD, XCVR_MODE_FIELD(lr_pd_ph[3])},
+    {&GEN4PHY->MISC, XCVR_COMMON_FIELD(misc), XCVR_REG_NO_FIELD},
+    {&GEN4PHY->PREPHY_MISC, XCVR_COMMON_FIELD(prephy_misc), XCVR_REG_NO_FIELD},
+    {&GEN4PHY->RTT_CTRL, XCVR_COMMON_FIELD(rtt_ctrl), XCVR_REG_NO_FIELD},
+    {&GEN4PHY->RTT_REF, XCVR_REG_NO_FIELD, XCVR_MODE_FIELD(rtt_ref)},
+    {&GEN4PHY->SM_CFG, XCVR_COMMON_FIELD(sm_cfg), XCVR_MODE_FIELD(sm_cfg)},
+    /**********************/
+    /* RADIO_CTRL configs */
+    /**********************/
+    {&RADIO_CTRL->LL_CTRL, XCVR_REG_NO_FIELD, XCVR_MODE_FIELD(ll_ctrl)},
+    /***********************/
+    /* XCVR_ANALOG configs */
+    /***********************/
+    {&XCVR_ANALOG->LDO_0, XCVR_COMMON_FIELD(ldo_0), XCVR_REG_NO_FIELD},
+    {&XCVR_ANALOG->LDO_1, XCVR_COMMON_FIELD(ldo_1), XCVR_REG_NO_FIELD},
+    {&XCVR_ANALOG->PLL, XCVR_COMMON_FIELD(pll), XCVR_REG_NO_FIELD},
+    {&XCVR_ANALOG->RX_0, XCVR_COMMON_FIELD(rx_0), XCVR_REG_NO_FIELD},
+    {&XCVR_ANALOG->RX_1, XCVR_COMMON_FIELD(rx_1), XCVR_REG_NO_FIELD},
+    {&XCVR_ANALOG->TX_DAC_PA, XCVR_COMMON_FIELD(tx_dac_pa), XCVR_MODE_FIELD(tx_dac_pa)},
+    {&XCVR_ANALOG->XO_DIST, XCVR_COMMON_FIELD(xo_dist), XCVR_REG_NO_FIELD},
+    /*********************/
+    /* XCVR_MISC configs */
+    /*********************/
+    {&XCVR_MISC->IPS_FO_ADDR[0], XCVR_REG_NO_FIELD, XCVR_MODE_FIELD(ips_fo_addr[0])},
+    {&XCVR_MISC->IPS_FO_ADDR[1], XCVR_REG_NO_FIELD, XCVR_MODE_FIELD(ips_fo_addr[1])},
+    {&XCVR_MISC->IPS_FO_ADDR[2], XCVR_REG_NO_FIELD, XCVR_MODE_FIELD(ips_fo_addr[2])},
+    {&XCVR_MISC->IPS_FO_DRS0_DATA[0], XCVR_REG_NO_FIELD, XCVR_MODE_FIELD(ips_fo_drs0_data[0])},
+    {&XCVR_MISC->IPS_FO_DRS0_DATA[1], XCVR_REG_NO_FIELD, XCVR_MODE_FIELD(ips_fo_drs0_data[1])},
+    {&XCVR_MISC->IPS_FO_DRS0_DATA[2], XCVR_REG_NO_FIELD, XCVR_MODE_FIELD(ips_fo_drs0_data[2])},
+    {&XCVR_MISC->IPS_FO_DRS1_DATA[0], XCVR_REG_NO_FIELD, XCVR_MODE_FIELD(ips_fo_drs1_data[0])},
+    {&XCVR_MISC->IPS_FO_DRS1_DATA[1], XCVR_REG_NO_FIELD, XCVR_MODE_FIELD(ips_fo_drs1_data[1])},
+    {&XCVR_MISC->IPS_FO_DRS1_DATA[2], XCVR_REG_NO_FIELD, XCVR_MODE_FIELD(ips_fo_drs1_data[2])},
+    {&XCVR_MISC->LDO_TRIM_0, XCVR_COMMON_FIELD(ldo_trim_0), XCVR_REG_NO_FIELD},
+    {&XCVR_MISC->LDO_TRIM_1, XCVR_COMMON_FIELD(ldo_trim_1), XCVR_REG_NO_FIELD},
+    {&XCVR_MISC->XCVR_CTRL, XCVR_COMMON_FIELD(xcvr_ctrl), XCVR_MODE_FIELD(xcvr_ctrl)},
+    /************************/
+    /* XCVR_PLL_DIG configs */
+    /************************/
+    {&XCVR_PLL_DIG->CHAN_MAP, XCVR_COMMON_FIELD(chan_map), XCVR_MODE_FIELD(chan_map)},
+    {&XCVR_PLL_DIG->CHAN_MAP_EXT, XCVR_COMMON_FIELD(chan_map_ext), XCVR_MODE_FIELD(chan_map_ext)},
+    {&XCVR_PLL_DIG->DATA_RATE_OVRD_CTRL1, XCVR_COMMON_FIELD(data_rate_ovrd_ctrl1), XCVR_REG_NO_FIELD},
+    {&XCVR_PLL_DIG->DATA_RATE_OVRD_CTRL2, XCVR_REG_NO_FIELD, XCVR_MODE_FIELD(data_rate_ovrd_ctrl2)},
+    {&XCVR_PLL_DIG->DELAY_MATCH, XCVR_COMMON_FIELD(delay_match), XCVR_MODE_FIELD(delay_match)},
+    {&XCVR_PLL_DIG->HPMCAL_CTRL, XCVR_COMMON_FIELD(hpmcal_ctrl), XCVR_MODE_FIELD(hpmcal_ctrl)},
+    {&XCVR_PLL_DIG->HPM_BUMP, XCVR_COMMON_FIELD(hpm_bump), XCVR_MODE_FIELD(hpm_bump)},
+    {&XCVR_PLL_DIG->HPM_CAL_TIMING, XCVR_COMMON_FIELD(hpm_cal_timing), XCVR_REG_NO_FIELD},
+    {&XCVR_PLL_DIG->HPM_CTRL, XCVR_COMMON_FIELD(hpm_ctrl), XCVR_REG_NO_FIELD},
+    {&XCVR_PLL_DIG->HPM_SDM_RES, XCVR_COMMON_FIELD(hpm_sdm_res), XCVR_MODE_FIELD(hpm_sdm_res)},
+    {&XCVR_PLL_DIG->LOCK_DETECT, XCVR_COMMON_FIELD(lock_detect), XCVR_REG_NO_FIELD},
+    {&XCVR_PLL_DIG->LPM_CTRL, XCVR_COMMON_FIELD(lpm_ctrl), XCVR_REG_NO_FIELD},
+    {&XCVR_PLL_DIG->LPM_SDM_CTRL1, XCVR_COMMON_FIELD(lpm_sdm_ctrl1), XCVR_REG_NO_FIELD},
+    {&XCVR_PLL_DIG->MOD_CTRL, XCVR_COMMON_FIELD(mod_ctrl), XCVR_REG_NO_FIELD},
+    {&XCVR_PLL_DIG->PLL_DATARATE_CTRL, XCVR_COMMON_FIELD(pll_datarate_ctrl), XCVR_REG_NO_FIELD},
+    {&XCVR_PLL_DIG->TUNING_CAP_RX_CTRL, XCVR_COMMON_FIELD(tuning_cap_rx_ctrl), XCVR_REG_NO_FIELD},
+    {&XCVR_PLL_DIG->TUNING_CAP_TX_CTRL, XCVR_COMMON_FIELD(tuning_cap_tx_ctrl), XCVR_REG_NO_FIELD},
+    /***********************/
+    /* XCVR_RX_DIG configs */
+    /***********************/
+    {&XCVR_RX_DIG->ACQ_FILT_0_3, XCVR_REG_NO_FIELD, XCVR_MODE_FIELD(acq_filt_0_3)},
+    {&XCVR_RX_DIG->ACQ_FILT_0_3_DRS, XCVR_REG_NO_FIELD, XCVR_MODE_FIELD(acq_filt_0_3_drs)},
+    {&XCVR_RX_DIG->ACQ_FILT_10_11, XCVR_REG_NO_FIELD, XCVR_MODE_FIELD(acq_filt_10_11)},
+    {&XCVR_RX_DIG->ACQ_FILT_10_11_DRS, XCVR_REG_NO_FIELD, XCVR_MODE_FIELD(acq_filt_10_11_drs)},
+    {&XCVR_RX_DIG->ACQ_FILT_4_7, XCVR_REG_NO_FIELD, XCVR_MODE_FIELD(acq_filt_4_7)},
+    {&XCVR_RX_DIG->ACQ_FILT_4_7_DRS, XCVR_REG_NO_FIELD, XCVR_MODE_FIELD(acq_filt_4_7_drs)},
+    {&XCVR_RX_DIG->ACQ_FILT_8_9, XCVR_REG_NO_FIELD, XCVR_MODE_FIELD(acq_filt_8_9)},
+    {&XCVR_RX_DIG->ACQ_FILT_8_9_DRS, XCVR_REG_NO_FIELD, XCVR_MODE_FIELD(acq_filt_8_9_drs)},
+    {&XCVR_RX_DIG->AGC_CTRL, XCVR_COMMON_FIELD(agc_ctrl), XCVR_REG_NO_FIELD},
+    {&XCVR_RX_DIG->AGC_CTRL_STAT, XCVR_COMMON_FIELD(agc_ctrl_stat), XCVR_REG_NO_FIELD},
+    {&XCVR_RX_DIG->AGC_IDX0_GAIN_CFG, XCVR_COMMON_FIELD(agc_idx0_gain_cfg), XCVR_REG_NO_FIELD},
+    {&XCVR_RX_DIG->AGC_IDX0_GAIN_VAL, XCVR_COMMON_FIELD(agc_idx0_gain_val), XCVR_REG_NO_FIELD},
+    {&XCVR_RX_DIG->AGC_IDX0_THR, XCVR_COMMON_FIELD(agc_idx0_thr), XCVR_REG_NO_FIELD},
+    {&XCVR_RX_DIG->AGC_IDX10_GAIN_CFG, XCVR_COMMON_FIELD(agc_idx10_gain_cfg), XCVR_REG_NO_FIELD},
+    {&XCVR_RX_DIG->AGC_IDX10_GAIN_VAL, XCVR_COMMON_FIELD(agc_idx10_gain_val), XCVR_REG_NO_FIELD},
+    {&XCVR_RX_DIG->AGC_IDX10_THR, XCVR_COMMON_FIELD(agc_idx10_thr), XCVR_REG_NO_FIELD},
+    {&XCVR_RX_DIG->AGC_IDX11_GAIN_CFG, XCVR_COMMON_FIELD(agc_idx11_gain_cfg), XCVR_MODE_FIELD(agc_idx11_gain_cfg)},
+    {&XCVR_RX_DIG->AGC_IDX11_GAIN_VAL, XCVR_COMMON_FIELD(agc_idx11_gain_val), XCVR_MODE_FIELD(agc_idx11_gain_val)},
+    {&XCVR_RX_DIG->AGC_IDX11_THR, XCVR_COMMON_FIELD(agc_idx11_thr), XCVR_REG_NO_FIELD},
+    {&XCVR_RX_DIG->AGC_IDX1_GAIN_CFG, XCVR_COMMON_FIELD(agc_idx1_gain_cfg), XCVR_REG_NO_FIELD},
+    {&XCVR_RX_DIG->AGC_IDX1_GAIN_VAL, XCVR_COMMON_FIELD(agc_idx1_gain_val), XCVR_REG_NO_FIELD},
+    {&XCVR_RX_DIG->AGC_IDX1_THR, XCVR_COMMON_FIELD(agc_idx1_thr), XCVR_REG_NO_FIELD},
+    {&XCVR_RX_DIG->AGC_IDX2_GAIN_CFG, XCVR_COMMON_FIELD(agc_idx2_gain_cfg), XCVR_REG_NO_FIELD},
+    {&XCVR_RX_DIG->AGC_IDX2_GAIN_VAL, XCVR_COMMON_FIELD(agc_idx2_gain_val), XCVR_REG_NO_FIELD},
+    {&XCVR_RX_DIG->AGC_IDX2_THR, XCVR_COMMON_FIELD(agc_idx2_thr), XCVR_REG_NO_FIELD},
+    {&XCVR_RX_DIG->AGC_IDX3_GAIN_CFG, XCVR_COMMON_FIELD(agc_idx3_gain_cfg), XCVR_REG_NO_FIELD},
+    {&XCVR_RX_DIG->AGC_IDX3_GAIN_VAL, XCVR_COMMON_FIELD(agc_idx3_gain_val), XCVR_REG_NO_FIELD},
+    {&XCVR_RX_DIG->AGC_IDX3_THR, XCVR_COMMON_FIELD(agc_idx3_thr), XCVR_REG_NO_FIELD},
+    {&XCVR_RX_DIG->AGC_IDX4_GAIN_CFG, XCVR_COMMON_FIELD(agc_idx4_gain_cfg), XCVR_REG_NO_FIELD},
+    {&XCVR_RX_DIG->AGC_IDX4_GAIN_VAL, XCVR_COMMON_FIELD(agc_idx4_gain_val), XCVR_REG_NO_FIELD},
+    {&XCVR_RX_DIG->AGC_IDX4_THR, XCVR_COMMON_FIELD(agc_idx4_thr), XCVR_REG_NO_FIELD},
+    {&XCVR_RX_DIG->AGC_IDX5_GAIN_CFG, XCVR_COMMON_FIELD(agc_idx5_gain_cfg), XCVR_REG_NO_FIELD},
+    {&XCVR_RX_DIG->AGC_IDX5_GAIN_VAL, XCVR_COMMON_FIELD(agc_idx5_gain_val), XCVR_REG_NO_FIELD},
+    {&XCVR_RX_DIG->AGC_IDX5_THR, XCVR_COMMON_FIELD(agc_idx5_thr), XCVR_REG_NO_FIELD},
+    {&XCVR_RX_DIG->AGC_IDX6_GAIN_CFG, XCVR_COMMON_FIELD(agc_idx6_gain_cfg), XCVR_REG_NO_FIELD},
+    {&XCVR_RX_DIG->AGC_IDX6_GAIN_VAL, XCVR_COMMON_FIELD(agc_idx6_gain_val), XCVR_REG_NO_FIELD},
+    {&XCVR_RX_DIG->AGC_IDX6_THR, XCVR_COMMON_FIELD(agc_idx6_thr), XCVR_REG_NO_FIELD},
+    {&XCVR_RX_DIG->AGC_IDX7_GAIN_CFG, XCVR_COMMON_FIELD(agc_idx7_gain_cfg), XCVR_REG_NO_FIELD},
+    {&XCVR_RX_DIG->AGC_IDX7_GAIN_VAL, XCVR_COMMON_FIELD(agc_idx7_gain_val), XCVR_REG_NO_FIELD},
+    {&XCVR_RX_DIG->AGC_IDX7_THR, XCVR_COMMON_FIELD(agc_idx7_thr), XCVR_REG_NO_FIELD},
+    {&XCVR_RX_DIG->AGC_IDX8_GAIN_CFG, XCVR_COMMON_FIELD(agc_idx8_gain_cfg), XCVR_REG_NO_FIELD},
+    {&XCVR_RX_DIG->AGC_IDX8_GAIN_VAL, XCVR_COMMON_FIELD(agc_idx8_gain_val), XCVR_REG_NO_FIELD},
+    {&XCVR_RX_DIG->AGC_IDX8_THR, XCVR_COMMON_FIELD(agc_idx8_thr), XCVR_REG_NO_FIELD},
+    {&XCVR_RX_DIG->AGC_IDX9_GAIN_CFG, XCVR_COMMON_FIELD(agc_idx9_gain_cfg), XCVR_REG_NO_FIELD},
+    {&XCVR_RX_DIG->AGC_IDX9_GAIN_VAL, XCVR_COMMON_FIELD(agc_idx9_gain_val), XCVR_REG_NO_FIELD},
+    {&XCVR_RX_DIG->AGC_IDX9_THR, XCVR_COMMON_FIELD(agc_idx9_thr), XCVR_REG_NO_FIELD},
+    {&XCVR_RX_DIG->AGC_MIS_GAIN_CFG, XCVR_COMMON_FIELD(agc_mis_gain_cfg), XCVR_REG_NO_FIELD},
+    {&XCVR_RX_DIG->AGC_THR_FAST, XCVR_COMMON_FIELD(agc_thr_fast), XCVR_REG_NO_FIELD},
+    {&XCVR_RX_DIG->AGC_THR_FAST_DRS, XCVR_COMMON_FIELD(agc_thr_fast_drs), XCVR_REG_NO_FIELD},
+    {&XCVR_RX_DIG->AGC_THR_MIS, XCVR_COMMON_FIELD(agc_thr_mis), XCVR_REG_NO_FIELD},
+    {&XCVR_RX_DIG->AGC_TIMING0, XCVR_COMMON_FIELD(agc_timing0), XCVR_MODE_FIELD(agc_timing0)},
+    {&XCVR_RX_DIG->AGC_TIMING0_DRS, XCVR_COMMON_FIELD(agc_timing0_drs), XCVR_MODE_FIELD(agc_timing0_drs)},
+    {&XCVR_RX_DIG->AGC_TIMING1, XCVR_COMMON_FIELD(agc_timing1), XCVR_MODE_FIELD(agc_timing1)},
+    {&XCVR_RX_DIG->AGC_TIMING1_DRS, XCVR_REG_NO_FIELD, XCVR_MODE_FIELD(agc_timing1_drs)},
+    {&XCVR_RX_DIG->AGC_TIMING2, XCVR_COMMON_FIELD(agc_timing2), XCVR_MODE_FIELD(agc_timing2)},
+    {&XCVR_RX_DIG->AGC_TIMING2_DRS, XCVR_REG_NO_FIELD, XCVR_MODE_FIELD(agc_timing2_drs)},
+    {&XCVR_RX_DIG->CTRL0, XCVR_COMMON_FIELD(ctrl0), XCVR_MODE_FIELD(ctrl0)},
+    {&XCVR_RX_DIG->CTRL0_DRS, XCVR_REG_NO_FIELD, XCVR_MODE_FIELD(ctrl0_drs)},
+    {&XCVR_RX_DIG->CTRL1, XCVR_COMMON_FIELD(ctrl1), XCVR_REG_NO_FIELD},
+    {&XCVR_RX_DIG->CTRL2, XCVR_COMMON_FIELD(ctrl2), XCVR_REG_NO_FIELD},
+    {&XCVR_RX_DIG->DCOC_CTRL0, XCVR_COMMON_FIELD(dcoc_ctrl0), XCVR_MODE_FIELD(dcoc_ctrl0)},
+    {&XCVR_RX_DIG->DCOC_CTRL0_DRS, XCVR_REG_NO_FIELD, XCVR_MODE_FIELD(dcoc_ctrl0_drs)},
+    {&XCVR_RX_DIG->DCOC_CTRL1, XCVR_COMMON_FIELD(dcoc_ctrl1), XCVR_REG_NO_FIELD},
+    {&XCVR_RX_DIG->DEMOD_FILT_0_1, XCVR_REG_NO_FIELD, XCVR_MODE_FIELD(demod_filt_0_1)},
+    {&XCVR_RX_DIG->DEMOD_FILT_0_1_DRS, XCVR_REG_NO_FIELD, XCVR_MODE_FIELD(demod_filt_0_1_drs)},
+    {&XCVR_RX_DIG->DEMOD_FILT_2_4, XCVR_REG_NO_FIELD, XCVR_MODE_FIELD(demod_filt_2_4)},
+    {&XCVR_RX_DIG->DEMOD_FILT_2_4_DRS, XCVR_REG_NO_FIELD, XCVR_MODE_FIELD(demod_filt_2_4_drs)},
+    {&XCVR_RX_DIG->IQMC_CTRL1_DRS, XCVR_COMMON_FIELD(iqmc_ctrl1_drs), XCVR_REG_NO_FIELD},
+    {&XCVR_RX_DIG->NB_RSSI_CTRL0, XCVR_COMMON_FIELD(nb_rssi_ctrl0), XCVR_REG_NO_FIELD},
+    {&XCVR_RX_DIG->NB_RSSI_CTRL1, XCVR_COMMON_FIELD(nb_rssi_ctrl1), XCVR_REG_NO_FIELD},
+    {&XCVR_RX_DIG->RCCAL_CTRL0, XCVR_REG_NO_FIELD, XCVR_MODE_FIELD(rccal_ctrl0)},
+    {&XCVR_RX_DIG->RSSI_GLOBAL_CTRL, XCVR_COMMON_FIELD(rssi_global_ctrl), XCVR_MODE_FIELD(rssi_global_ctrl)},
+    {&XCVR_RX_DIG->TQI_CTRL, XCVR_COMMON_FIELD(tqi_ctrl), XCVR_REG_NO_FIELD},
+    {&XCVR_RX_DIG->TQI_THR, XCVR_COMMON_FIELD(tqi_thr), XCVR_REG_NO_FIELD},
+    {&XCVR_RX_DIG->WB_RSSI_CTRL, XCVR_COMMON_FIELD(wb_rssi_ctrl), XCVR_REG_NO_FIELD},
+    /********************/
+    /* XCVR_TSM configs */
+    /********************/
+    {&XCVR_TSM->CTRL, XCVR_COMMON_FIELD(ctrl), XCVR_REG_NO_FIELD},
+    {&XCVR_TSM->END_OF_SEQ, XCVR_COMMON_FIELD(end_of_seq), XCVR_REG_NO_FIELD},
+    {&XCVR_TSM->FAST_CTRL1, XCVR_COMMON_FIELD(fast_ctrl1), XCVR_REG_NO_FIELD},
+    {&XCVR_TSM->FAST_CTRL2, XCVR_COMMON_FIELD(fast_ctrl2), XCVR_REG_NO_FIELD},
+    {&XCVR_TSM->FAST_CTRL3, XCVR_COMMON_FIELD(fast_ctrl3), XCVR_REG_NO_FIELD},
+    {&XCVR_TSM->RECYCLE_COUNT, XCVR_COMMON_FIELD(recycle_count), XCVR_REG_NO_FIELD},
+    {&XCVR_TSM->TIMING00, XCVR_COMMON_FIELD(timing00), XCVR_REG_NO_FIELD},
+    {&XCVR_TSM->TIMING01, XCVR_COMMON_FIELD(timing01), XCVR_REG_NO_FIELD},
+    {&XCVR_TSM->TIMING02, XCVR_COMMON_FIELD(timing02), XCVR_REG_NO_FIELD},
+    {&XCVR_TSM->TIMING03, XCVR_COMMON_FIELD(timing03), XCVR_REG_NO_FIELD},
+    {&XCVR_TSM->TIMING04, XCVR_COMMON_FIELD(timing04), XCVR_REG_NO_FIELD},
+    {&XCVR_TSM->TIMING05, XCVR_COMMON_FIELD(timing05), XCVR_REG_NO_FIELD},
+    {&XCVR_TSM->TIMING06, XCVR_COMMON_FIELD(timing06), XCVR_REG_NO_FIELD},
+    {&XCVR_TSM->TIMING07, XCVR_COMMON_FIELD(timing07), XCVR_REG_NO_FIELD},
+    {&XCVR_TSM->TIMING08, XCVR_COMMON_FIELD(timing08), XCVR_REG_NO_FIELD},
+    {&XCVR_TSM->TIMING09, XCVR_COMMON_FIELD(timing09), XCVR_REG_NO_FIELD},
+    {&XCVR_TSM->TIMING10, XCVR_COMMON_FIELD(timing10), XCVR_REG_NO_FIELD},
+    {&XCVR_TSM->TIMING11, XCVR_COMMON_FIELD(timing11), XCVR_REG_NO_FIELD},
+    {&XCVR_TSM->TIMING12, XCVR_COMMON_FIELD(timing12), XCVR_REG_NO_FIELD},
+    {&XCVR_TSM->TIMING13, XCVR_COMMON_FIELD(timing13), XCVR_REG_NO_FIELD},
+    {&XCVR_TSM->TIMING14, XCVR_COMMON_FIELD(timing14), XCVR_REG_NO_FIELD},
+    {&XCVR_TSM->TIMING15, XCVR_COMMON_FIELD(timing15), XCVR_REG_NO_FIELD},
+    {&XCVR_TSM->TIMING16, XCVR_COMMON_FIELD(timing16), XCVR_REG_NO_FIELD},
+    {&XCVR_TSM->TIMING17, XCVR_COMMON_FIELD(timing17), XCVR_REG_NO_FIELD},
+    {&XCVR_TSM->TIMING18, XCVR_COMMON_FIELD(timing18), XCVR_REG_NO_FIELD},
+    {&XCVR_TSM->TIMING19, XCVR_COMMON_FIELD(timing19), XCVR_REG_NO_FIELD},
+    {&XCVR_TSM->TIMING20, XCVR_COMMON_FIELD(timing20), XCVR_REG_NO_FIELD},
+    {&XCVR_TSM->TIMING21, XCVR_COMMON_FIELD(timing21), XCVR_REG_NO_FIELD},
+    {&XCVR_TSM->TIMING22, XCVR_COMMON_FIELD(timing22), XCVR_REG_NO_FIELD},
+    {&XCVR_TSM->TIMING23, XCVR_COMMON_FIELD(timing23), XCVR_REG_NO_FIELD},
+    {&XCVR_TSM->TIMING24, XCVR_COMMON_FIELD(timing24), XCVR_REG_NO_FIELD},
+    {&XCVR_TSM->TIMING25, XCVR_COMMON_FIELD(timing25), XCVR_REG_NO_FIELD},
+    {&XCVR_TSM->TIMING26, XCVR_COMMON_FIELD(timing26), XCVR_REG_NO_FIELD},
+    {&XCVR_TSM->TIMING27, XCVR_COMMON_FIELD(timing27), XCVR_REG_NO_FIELD},
+    {&XCVR_TSM->TIMING28, XCVR_COMMON_FIELD(timing28), XCVR_REG_NO_FIELD},
+    {&XCVR_TSM->TIMING29, XCVR_COMMON_FIELD(timing29), XCVR_REG_NO_FIELD},
+    {&XCVR_TSM->TIMING30, XCVR_COMMON_FIELD(timing30), XCVR_REG_NO_FIELD},
+    {&XCVR_TSM->TIMING31, XCVR_COMMON_FIELD(timing31), XCVR_REG_NO_FIELD},
+    {&XCVR_TSM->TIMING32, XCVR_COMMON_FIELD(timing32), XCVR_REG_NO_FIELD},
+    {&XCVR_TSM->TIMING33, XCVR_COMMON_FIELD(timing33), XCVR_REG_NO_FIELD},
+    {&XCVR_TSM->TIMING34, XCVR_COMMON_FIELD(timing34), XCVR_REG_NO_FIELD},
+    {&XCVR_TSM->TIMING35, XCVR_COMMON_FIELD(timing35), XCVR_REG_NO_FIELD},
+    {&XCVR_TSM->TIMING36, XCVR_COMMON_FIELD(timing36), XCVR_REG_NO_FIELD},
+    {&XCVR_TSM->TIMING37, XCVR_COMMON_FIELD(timing37), XCVR_REG_NO_FIELD},
+    {&XCVR_TSM->TIMING38, XCVR_COMMON_FIELD(timing38), XCVR_REG_NO_FIELD},
+    {&XCVR_TSM->TIMING39, XCVR_COMMON_FIELD(timing39), XCVR_REG_NO_FIELD},
+    {&XCVR_TSM->TIMING40, XCVR_COMMON_FIELD(timing40), XCVR_REG_NO_FIELD},
+    {&XCVR_TSM->TIMING41, XCVR_COMMON_FIELD(timing41), XCVR_REG_NO_FIELD},
+    {&XCVR_TSM->TIMING42, XCVR_COMMON_FIELD(timing42), XCVR_REG_NO_FIELD},
+    {&XCVR_TSM->TIMING43, XCVR_COMMON_FIELD(timing43), XCVR_REG_NO_FIELD},
+    {&XCVR_TSM->TIMING44, XCVR_COMMON_FIELD(timing44), XCVR_REG_NO_FIELD},
+    {&XCVR_TSM->TIMING45, XCVR_COMMON_FIELD(timing45), XCVR_REG_NO_FIELD},
+    {&XCVR_TSM->TIMING46, XCVR_COMMON_FIELD(timing46), XCVR_REG_NO_FIELD},
+    {&XCVR_TSM->TIMING47, XCVR_COMMON_FIELD(timing47), XCVR_REG_NO_FIELD},
+    {&XCVR_TSM->TIMING48, XCVR_COMMON_FIELD(timing48), XCVR_REG_NO_FIELD},
+    {&XCVR_TSM->TIMING49, XCVR_COMMON_FIELD(timing49), XCVR_REG_NO_FIELD},
+    {&XCVR_TSM->TIMING50, XCVR_COMMON_FIELD(timing50), XCVR_REG_NO_FIELD},
+    {&XCVR_TSM->TIMING51, XCVR_COMMON_FIELD(timing51), XCVR_REG_NO_FIELD},
+    {&XCVR_TSM->TIMING52, XCVR_COMMON_FIELD(timing52), XCVR_REG_NO_FIELD},
+    {&XCVR_TSM->TIMING53, XCVR_COMMON_FIELD(timing53), XCVR_REG_NO_FIELD},
+    {&XCVR_TSM->TIMING54, XCVR_COMMON_FIELD(timing54), XCVR_REG_NO_FIELD},
+    {&XCVR_TSM->TIMING55, XCVR_COMMON_FIELD(timing55), XCVR_REG_NO_FIELD},
+    {&XCVR_TSM->TIMING56, XCVR_COMMON_FIELD(timing56), XCVR_REG_NO_FIELD},
+    {&XCVR_TSM->TIMING57, XCVR_COMMON_FIELD(timing57), XCVR_REG_NO_FIELD},
+    {&XCVR_TSM->TIMING58, XCVR_COMMON_FIELD(timing58), XCVR_REG_NO_FIELD},
+    {&XCVR_TSM->TIMING59, XCVR_COMMON_FIELD(timing59), XCVR_REG_NO_FIELD},
+    {&XCVR_TSM->TIMING60, XCVR_COMMON_FIELD(timing60), XCVR_REG_NO_FIELD},
+    {&XCVR_TSM->TIMING61, XCVR_COMMON_FIELD(timing61), XCVR_REG_NO_FIELD},
+    {&XCVR_TSM->WU_LATENCY, XCVR_COMMON_FIELD(wu_latency), XCVR_REG_NO_FIELD},
+    /***********************/
+    /* XCVR_TX_DIG configs */
+    /***********************/
+    {&XCVR_TX_DIG->DATARATE_CONFIG_FILTER_CTRL, XCVR_REG_NO_FIELD, XCVR_MODE_FIELD(datarate_config_filter_ctrl)},
+    {&XCVR_TX_DIG->DATARATE_CONFIG_FSK_CTRL, XCVR_REG_NO_FIELD, XCVR_MODE_FIELD(datarate_config_fsk_ctrl)},
+    {&XCVR_TX_DIG->DATARATE_CONFIG_GFSK_CTRL, XCVR_REG_NO_FIELD, XCVR_MODE_FIELD(datarate_config_gfsk_ctrl)},
+    {&XCVR_TX_DIG->DATA_PADDING_CTRL, XCVR_COMMON_FIELD(data_padding_ctrl), XCVR_MODE_FIELD(data_padding_ctrl)},
+    {&XCVR_TX_DIG->DATA_PADDING_CTRL_1, XCVR_COMMON_FIELD(data_padding_ctrl_1), XCVR_MODE_FIELD(data_padding_ctrl_1)},
+    {&XCVR_TX_DIG->DATA_PADDING_CTRL_2, XCVR_REG_NO_FIELD, XCVR_MODE_FIELD(data_padding_ctrl_2)},
+    {&XCVR_TX_DIG->FSK_CTRL, XCVR_REG_NO_FIELD, XCVR_MODE_FIELD(fsk_ctrl)},
+    {&XCVR_TX_DIG->GFSK_COEFF_0_1, XCVR_REG_NO_FIELD, XCVR_MODE_FIELD(gfsk_coeff_0_1)},
+    {&XCVR_TX_DIG->GFSK_COEFF_2_3, XCVR_REG_NO_FIELD, XCVR_MODE_FIELD(gfsk_coeff_2_3)},
+    {&XCVR_TX_DIG->GFSK_COEFF_4_5, XCVR_REG_NO_FIELD, XCVR_MODE_FIELD(gfsk_coeff_4_5)},
+    {&XCVR_TX_DIG->GFSK_COEFF_6_7, XCVR_REG_NO_FIELD, XCVR_MODE_FIELD(gfsk_coeff_6_7)},
+    {&XCVR_TX_DIG->GFSK_CTRL, XCVR_REG_NO_FIELD, XCVR_MODE_FIELD(gfsk_ctrl)},
+    {&XCVR_TX_DIG->IMAGE_FILTER_CTRL, XCVR_COMMON_FIELD(image_filter_ctrl), XCVR_MODE_FIELD(image_filter_ctrl)},
+    {&XCVR_TX_DIG->PA_CTRL, XCVR_COMMON_FIELD(pa_ctrl), XCVR_MODE_FIELD(pa_ctrl)},
+    {&XCVR_TX_DIG->PA_RAMP_TBL0, XCVR_COMMON_FIELD(pa_ramp_tbl0), XCVR_REG_NO_FIELD},
+    {&XCVR_TX_DIG->PA_RAMP_TBL1, XCVR_COMMON_FIELD(pa_ramp_tbl1), XCVR_REG_NO_FIELD},
+    {&XCVR_TX_DIG->PA_RAMP_TBL2, XCVR_COMMON_FIELD(pa_ramp_tbl2), XCVR_REG_NO_FIELD},
+    {&XCVR_TX_DIG->PA_RAMP_TBL3, XCVR_COMMON_FIELD(pa_ramp_tbl3), XCVR_REG_NO_FIELD},
+    {&XCVR_TX_DIG->SWITCH_TX_CTRL, XCVR_COMMON_FIELD(switch_tx_ctrl), XCVR_REG_NO_FIELD},
+    {&XCVR_TX_DIG->TXDIG_CTRL, XCVR_COMMON_FIELD(txdig_ctrl), XCVR_MODE_FIELD(txdig_ctrl)},
+};
+/***********************************************/
+/************ END OF GENERATED CODE ************/
+/************** xcvr_reg_desc_table ************/
+/***********************************************/
 
 /*******************************************************************************
  * Code
@@ -371,3 +683,1107 @@ xcvrStatus_t XCVR_RadioGenRBMESetup(const xcvr_coding_config_t *rbme)
 
     return status;
 }
+
+xcvrStatus_t XCVR_RadioGenRegSetupDelta(const xcvr_config_t *curr_config,
+                                        const xcvr_config_t *xcvr_config,
+                                        uint32_t *skipped_writes)
+{
+    xcvrStatus_t status = gXcvrInvalidConfiguration_c;
+    uint32_t skipped    = 0U;
+
+    /* Check parameters */
+    if ((curr_config != NULLPTR) && (xcvr_config != NULLPTR))
+    {
+        /* Generated XCVR_RadioGenRegSetupDelta for all XCVR registers goes here */
+        /***********************************************/
+        /*********** START OF GENERATED CODE ***********/
+        /************ XCVR_RadioGenRegSetupDelta *******/
+        /***********************************************/
+        const xcvr_common_config_t *curr_common_cfg               = curr_config->common_cfg;
+        const xcvr_mode_datarate_config_t *curr_mode_datarate_cfg = curr_config->mode_data_rate_cfg;
+        const xcvr_common_config_t *common_cfg                    = xcvr_config->common_cfg;
+        const xcvr_mode_datarate_config_t *mode_datarate_cfg      = xcvr_config->mode_data_rate_cfg;
+        /* GEN4PHY->DMD_CTRL1 is owned by XCVR_RadioGenRBMESetupDelta() which always follows this routine */
+        /*******************/
+        /* GEN4PHY configs */
+        /*******************/
+        XCVR_DELTA_REG_WRITE(GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG0,
+                             curr_mode_datarate_cfg->demod_wave[0].dmd_wave_reg0,
+                             mode_datarate_cfg->demod_wave[0].dmd_wave_reg0);
+        XCVR_DELTA_REG_WRITE(GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG1,
+                             curr_mode_datarate_cfg->demod_wave[0].dmd_wave_reg1,
+                             mode_datarate_cfg->demod_wave[0].dmd_wave_reg1);
+        XCVR_DELTA_REG_WRITE(GEN4PHY->DEMOD_WAVE[0].DMD_WAVE_REG2,
+                             curr_mode_datarate_cfg->demod_wave[0].dmd_wave_reg2,
+                             mode_datarate_cfg->demod_wave[0].dmd_wave_reg2);
+        XCVR_DELTA_REG_WRITE(GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG0,
+                             curr_mode_datarate_cfg->demod_wave[1].dmd_wave_reg0,
+                             mode_datarate_cfg->demod_wave[1].dmd_wave_reg0);
+        XCVR_DELTA_REG_WRITE(GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG1,
+                             curr_mode_datarate_cfg->demod_wave[1].dmd_wave_reg1,
+                             mode_datarate_cfg->demod_wave[1].dmd_wave_reg1);
+        XCVR_DELTA_REG_WRITE(GEN4PHY->DEMOD_WAVE[1].DMD_WAVE_REG2,
+                             curr_mode_datarate_cfg->demod_wave[1].dmd_wave_reg2,
+                             mode_datarate_cfg->demod_wave[1].dmd_wave_reg2);
+        XCVR_DELTA_REG_WRITE(GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG0,
+                             curr_mode_datarate_cfg->demod_wave[2].dmd_wave_reg0,
+                             mode_datarate_cfg->demod_wave[2].dmd_wave_reg0);
+        XCVR_DELTA_REG_WRITE(GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG1,
+                             curr_mode_datarate_cfg->demod_wave[2].dmd_wave_reg1,
+                             mode_datarate_cfg->demod_wave[2].dmd_wave_reg1);
+        XCVR_DELTA_REG_WRITE(GEN4PHY->DEMOD_WAVE[2].DMD_WAVE_REG2,
+                             curr_mode_datarate_cfg->demod_wave[2].dmd_wave_reg2,
+                             mode_datarate_cfg->demod_wave[2].dmd_wave_reg2);
+        XCVR_DELTA_REG_WRITE(GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG0,
+                             curr_mode_datarate_cfg->demod_wave[3].dmd_wave_reg0,
+                             mode_datarate_cfg->demod_wave[3].dmd_wave_reg0);
+        XCVR_DELTA_REG_WRITE(GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG1,
+                             curr_mode_datarate_cfg->demod_wave[3].dmd_wave_reg1,
+                             mode_datarate_cfg->demod_wave[3].dmd_wave_reg1);
+        XCVR_DELTA_REG_WRITE(GEN4PHY->DEMOD_WAVE[3].DMD_WAVE_REG2,
+                             curr_mode_datarate_cfg->demod_wave[3].dmd_wave_reg2,
+                             mode_datarate_cfg->demod_wave[3].dmd_wave_reg2);
+        XCVR_DELTA_REG_WRITE(GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG0,
+                             curr_mode_datarate_cfg->demod_wave[4].dmd_wave_reg0,
+                             mode_datarate_cfg->demod_wave[4].dmd_wave_reg0);
+        XCVR_DELTA_REG_WRITE(GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG1,
+                             curr_mode_datarate_cfg->demod_wave[4].dmd_wave_reg1,
+                             mode_datarate_cfg->demod_wave[4].dmd_wave_reg1);
+        XCVR_DELTA_REG_WRITE(GEN4PHY->DEMOD_WAVE[4].DMD_WAVE_REG2,
+                             curr_mode_datarate_cfg->demod_wave[4].dmd_wave_reg2,
+                             mode_datarate_cfg->demod_wave[4].dmd_wave_reg2);
+        XCVR_DELTA_REG_WRITE(GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG0,
+                             curr_mode_datarate_cfg->demod_wave[5].dmd_wave_reg0,
+                             mode_datarate_cfg->demod_wave[5].dmd_wave_reg0);
+        XCVR_DELTA_REG_WRITE(GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG1,
+                             curr_mode_datarate_cfg->demod_wave[5].dmd_wave_reg1,
+                             mode_datarate_cfg->demod_wave[5].dmd_wave_reg1);
+        XCVR_DELTA_REG_WRITE(GEN4PHY->DEMOD_WAVE[5].DMD_WAVE_REG2,
+                             curr_mode_datarate_cfg->demod_wave[5].dmd_wave_reg2,
+                             mode_datarate_cfg->demod_wave[5].dmd_wave_reg2);
+        XCVR_DELTA_REG_WRITE(GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG0,
+                             curr_mode_datarate_cfg->demod_wave[6].dmd_wave_reg0,
+                             mode_datarate_cfg->demod_wave[6].dmd_wave_reg0);
+        XCVR_DELTA_REG_WRITE(GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG1,
+                             curr_mode_datarate_cfg->demod_wave[6].dmd_wave_reg1,
+                             mode_datarate_cfg->demod_wave[6].dmd_wave_reg1);
+        XCVR_DELTA_REG_WRITE(GEN4PHY->DEMOD_WAVE[6].DMD_WAVE_REG2,
+                             curr_mode_datarate_cfg->demod_wave[6].dmd_wave_reg2,
+                             mode_datarate_cfg->demod_wave[6].dmd_wave_reg2);
+        XCVR_DELTA_REG_WRITE(GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG0,
+                             curr_mode_datarate_cfg->demod_wave[7].dmd_wave_reg0,
+                             mode_datarate_cfg->demod_wave[7].dmd_wave_reg0);
+        XCVR_DELTA_REG_WRITE(GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG1,
+                             curr_mode_datarate_cfg->demod_wave[7].dmd_wave_reg1,
+                             mode_datarate_cfg->demod_wave[7].dmd_wave_reg1);
+        XCVR_DELTA_REG_WRITE(GEN4PHY->DEMOD_WAVE[7].DMD_WAVE_REG2,
+                             curr_mode_datarate_cfg->demod_wave[7].dmd_wave_reg2,
+                             mode_datarate_cfg->demod_wave[7].dmd_wave_reg2);
+        XCVR_DELTA_REG_WRITE(GEN4PHY->DMD_CTRL0, curr_common_cfg->dmd_ctrl0, common_cfg->dmd_ctrl0);
+        XCVR_DELTA_REG_WRITE(GEN4PHY->FSK_CFG0,
+                             curr_mode_datarate_cfg->fsk_cfg0 | curr_common_cfg->fsk_cfg0,
+                             mode_datarate_cfg->fsk_cfg0 | common_cfg->fsk_cfg0);
+        XCVR_DELTA_REG_WRITE(GEN4PHY->FSK_CFG1, curr_mode_datarate_cfg->fsk_cfg1, mode_datarate_cfg->fsk_cfg1);
+        XCVR_DELTA_REG_WRITE(GEN4PHY->FSK_CFG2, curr_common_cfg->fsk_cfg2, common_cfg->fsk_cfg2);
+        XCVR_DELTA_REG_WRITE(GEN4PHY->FSK_FAD_CFG, curr_common_cfg->fsk_fad_cfg, common_cfg->fsk_fad_cfg);
+        XCVR_DELTA_REG_WRITE(GEN4PHY->FSK_FAD_CTRL, curr_common_cfg->fsk_fad_ctrl, common_cfg->fsk_fad_ctrl);
+        XCVR_DELTA_REG_WRITE(GEN4PHY->FSK_PD_CFG0, curr_mode_datarate_cfg->fsk_pd_cfg0, mode_datarate_cfg->fsk_pd_cfg0);
+        XCVR_DELTA_REG_WRITE(GEN4PHY->FSK_PD_CFG1, curr_mode_datarate_cfg->fsk_pd_cfg1, mode_datarate_cfg->fsk_pd_cfg1);
+        XCVR_DELTA_REG_WRITE(GEN4PHY->FSK_PD_CFG2, curr_mode_datarate_cfg->fsk_pd_cfg2, mode_datarate_cfg->fsk_pd_cfg2);
+        XCVR_DELTA_REG_WRITE(GEN4PHY->FSK_PD_PH[0],
+                             curr_mode_datarate_cfg->fsk_pd_ph[0],
+                             mode_datarate_cfg->fsk_pd_ph[0]);
+        XCVR_DELTA_REG_WRITE(GEN4PHY->FSK_PD_PH[1],
+                             curr_mode_datarate_cfg->fsk_pd_ph[1],
+                             mode_datarate_cfg->fsk_pd_ph[1]);
+        XCVR_DELTA_REG_WRITE(GEN4PHY->FSK_PT,
+                             curr_mode_datarate_cfg->fsk_pt | curr_common_cfg->fsk_pt,
+                             mode_datarate_cfg->fsk_pt | common_cfg->fsk_pt);
+        XCVR_DELTA_REG_WRITE(GEN4PHY->LR_AA_CFG, curr_mode_datarate_cfg->lr_aa_cfg, mode_datarate_cfg->lr_aa_cfg);
+        XCVR_DELTA_REG_WRITE(GEN4PHY->LR_PD_CFG, curr_mode_datarate_cfg->lr_pd_cfg, mode_datarate_cfg->lr_pd_cfg);
+        XCVR_DELTA_REG_WRITE(GEN4PHY->LR_PD_PH[0], curr_mode_datarate_cfg->lr_pd_ph[0], mode_datarate_cfg->lr_pd_ph[0]);
+        XCVR_DELTA_REG_WRITE(GEN4PHY->LR_PD_PH[1], curr_mode_datarate_cfg->lr_pd_ph[1], mode_datarate_cfg->lr_pd_ph[1]);
+        XCVR_DELTA_REG_WRITE(GEN4PHY->LR_PD_PH[2], curr_mode_datarate_cfg->lr_pd_ph[2], mode_datarate_cfg->lr_pd_ph[2]);
+        XCVR_DELTA_REG_WRITE(GEN4PHY->LR_PD_PH[3], curr_mode_datarate_cfg->lr_pd_ph[3], mode_datarate_cfg->lr_pd_ph[3]);
+        XCVR_DELTA_REG_WRITE(GEN4PHY->MISC, curr_common_cfg->misc, common_cfg->misc);
+        XCVR_DELTA_REG_WRITE(GEN4PHY->PREPHY_MISC, curr_common_cfg->prephy_misc, common_cfg->prephy_misc);
+        XCVR_DELTA_REG_WRITE(GEN4PHY->RTT_CTRL, curr_common_cfg->rtt_ctrl, common_cfg->rtt_ctrl);
+        XCVR_DELTA_REG_WRITE(GEN4PHY->RTT_REF, curr_mode_datarate_cfg->rtt_ref, mode_datarate_cfg->rtt_ref);
+        XCVR_DELTA_REG_WRITE(GEN4PHY->SM_CFG,
+                             curr_mode_datarate_cfg->sm_cfg | curr_common_cfg->sm_cfg,
+                             mode_datarate_cfg->sm_cfg | common_cfg->sm_cfg);
+        /**********************/
+        /* RADIO_CTRL configs */
+        /**********************/
+        XCVR_DELTA_REG_WRITE(RADIO_CTRL->LL_CTRL, curr_mode_datarate_cfg->ll_ctrl, mode_datarate_cfg->ll_ctrl);
+        /***********************/
+        /* XCVR_ANALOG configs */
+        /***********************/
+        XCVR_DELTA_REG_WRITE(XCVR_ANALOG->LDO_0, curr_common_cfg->ldo_0, common_cfg->ldo_0);
+        XCVR_DELTA_REG_WRITE(XCVR_ANALOG->LDO_1, curr_common_cfg->ldo_1, common_cfg->ldo_1);
+        XCVR_DELTA_REG_WRITE(XCVR_ANALOG->PLL, curr_common_cfg->pll, common_cfg->pll);
+        XCVR_DELTA_REG_WRITE(XCVR_ANALOG->RX_0, curr_common_cfg->rx_0, common_cfg->rx_0);
+        XCVR_DELTA_REG_WRITE(XCVR_ANALOG->RX_1, curr_common_cfg->rx_1, common_cfg->rx_1);
+        XCVR_DELTA_REG_WRITE(XCVR_ANALOG->TX_DAC_PA,
+                             curr_common_cfg->tx_dac_pa | curr_mode_datarate_cfg->tx_dac_pa,
+                             common_cfg->tx_dac_pa | mode_datarate_cfg->tx_dac_pa);
+        XCVR_DELTA_REG_WRITE(XCVR_ANALOG->XO_DIST, curr_common_cfg->xo_dist, common_cfg->xo_dist);
+        /*********************/
+        /* XCVR_MISC configs */
+        /*********************/
+        XCVR_DELTA_REG_WRITE(XCVR_MISC->IPS_FO_ADDR[0],
+                             curr_mode_datarate_cfg->ips_fo_addr[0],
+                             mode_datarate_cfg->ips_fo_addr[0]);
+        XCVR_DELTA_REG_WRITE(XCVR_MISC->IPS_FO_ADDR[1],
+                             curr_mode_datarate_cfg->ips_fo_addr[1],
+                             mode_datarate_cfg->ips_fo_addr[1]);
+        XCVR_DELTA_REG_WRITE(XCVR_MISC->IPS_FO_ADDR[2],
+                             curr_mode_datarate_cfg->ips_fo_addr[2],
+                             mode_datarate_cfg->ips_fo_addr[2]);
+        XCVR_DELTA_REG_WRITE(XCVR_MISC->IPS_FO_DRS0_DATA[0],
+                             curr_mode_datarate_cfg->ips_fo_drs0_data[0],
+                             mode_datarate_cfg->ips_fo_drs0_data[0]);
+        XCVR_DELTA_REG_WRITE(XCVR_MISC->IPS_FO_DRS0_DATA[1],
+                             curr_mode_datarate_cfg->ips_fo_drs0_data[1],
+                             mode_datarate_cfg->ips_fo_drs0_data[1]);
+        XCVR_DELTA_REG_WRITE(XCVR_MISC->IPS_FO_DRS0_DATA[2],
+                             curr_mode_datarate_cfg->ips_fo_drs0_data[2],
+                             mode_datarate_cfg->ips_fo_drs0_data[2]);
+        XCVR_DELTA_REG_WRITE(XCVR_MISC->IPS_FO_DRS1_DATA[0],
+                             curr_mode_datarate_cfg->ips_fo_drs1_data[0],
+                             mode_datarate_cfg->ips_fo_drs1_data[0]);
+        XCVR_DELTA_REG_WRITE(XCVR_MISC->IPS_FO_DRS1_DATA[1],
+                             curr_mode_datarate_cfg->ips_fo_drs1_data[1],
+                             mode_datarate_cfg->ips_fo_drs1_data[1]);
+        XCVR_DELTA_REG_WRITE(XCVR_MISC->IPS_FO_DRS1_DATA[2],
+                             curr_mode_datarate_cfg->ips_fo_drs1_data[2],
+                             mode_datarate_cfg->ips_fo_drs1_data[2]);
+        XCVR_DELTA_REG_WRITE(XCVR_MISC->LDO_TRIM_0, curr_common_cfg->ldo_trim_0, common_cfg->ldo_trim_0);
+        XCVR_DELTA_REG_WRITE(XCVR_MISC->LDO_TRIM_1, curr_common_cfg->ldo_trim_1, common_cfg->ldo_trim_1);
+        XCVR_DELTA_REG_WRITE(XCVR_MISC->XCVR_CTRL,
+                             curr_common_cfg->xcvr_ctrl | curr_mode_datarate_cfg->xcvr_ctrl,
+                             common_cfg->xcvr_ctrl | mode_datarate_cfg->xcvr_ctrl);
+        /************************/
+        /* XCVR_PLL_DIG configs */
+        /************************/
+        XCVR_DELTA_REG_WRITE(XCVR_PLL_DIG->CHAN_MAP,
+                             curr_mode_datarate_cfg->chan_map | curr_common_cfg->chan_map,
+                             mode_datarate_cfg->chan_map | common_cfg->chan_map);
+        XCVR_DELTA_REG_WRITE(XCVR_PLL_DIG->CHAN_MAP_EXT,
+                             curr_common_cfg->chan_map_ext | curr_mode_datarate_cfg->chan_map_ext,
+                             common_cfg->chan_map_ext | mode_datarate_cfg->chan_map_ext);
+        XCVR_DELTA_REG_WRITE(XCVR_PLL_DIG->DATA_RATE_OVRD_CTRL1,
+                             curr_common_cfg->data_rate_ovrd_ctrl1,
+                             common_cfg->data_rate_ovrd_ctrl1);
+        XCVR_DELTA_REG_WRITE(XCVR_PLL_DIG->DATA_RATE_OVRD_CTRL2,
+                             curr_mode_datarate_cfg->data_rate_ovrd_ctrl2,
+                             mode_datarate_cfg->data_rate_ovrd_ctrl2);
+        XCVR_DELTA_REG_WRITE(XCVR_PLL_DIG->DELAY_MATCH,
+                             curr_mode_datarate_cfg->delay_match | curr_common_cfg->delay_match,
+                             mode_datarate_cfg->delay_match | common_cfg->delay_match);
+        XCVR_DELTA_REG_WRITE(XCVR_PLL_DIG->HPMCAL_CTRL,
+                             curr_mode_datarate_cfg->hpmcal_ctrl | curr_common_cfg->hpmcal_ctrl,
+                             mode_datarate_cfg->hpmcal_ctrl | common_cfg->hpmcal_ctrl);
+        XCVR_DELTA_REG_WRITE(XCVR_PLL_DIG->HPM_BUMP,
+                             curr_common_cfg->hpm_bump | curr_mode_datarate_cfg->hpm_bump,
+                             common_cfg->hpm_bump | mode_datarate_cfg->hpm_bump);
+        XCVR_DELTA_REG_WRITE(XCVR_PLL_DIG->HPM_CAL_TIMING, curr_common_cfg->hpm_cal_timing, common_cfg->hpm_cal_timing);
+        XCVR_DELTA_REG_WRITE(XCVR_PLL_DIG->HPM_CTRL, curr_common_cfg->hpm_ctrl, common_cfg->hpm_ctrl);
+        XCVR_DELTA_REG_WRITE(XCVR_PLL_DIG->HPM_SDM_RES,
+                             curr_mode_datarate_cfg->hpm_sdm_res | curr_common_cfg->hpm_sdm_res,
+                             mode_datarate_cfg->hpm_sdm_res | common_cfg->hpm_sdm_res);
+        XCVR_DELTA_REG_WRITE(XCVR_PLL_DIG->LOCK_DETECT, curr_common_cfg->lock_detect, common_cfg->lock_detect);
+        XCVR_DELTA_REG_WRITE(XCVR_PLL_DIG->LPM_CTRL, curr_common_cfg->lpm_ctrl, common_cfg->lpm_ctrl);
+        XCVR_DELTA_REG_WRITE(XCVR_PLL_DIG->LPM_SDM_CTRL1, curr_common_cfg->lpm_sdm_ctrl1, common_cfg->lpm_sdm_ctrl1);
+        XCVR_DELTA_REG_WRITE(XCVR_PLL_DIG->MOD_CTRL, curr_common_cfg->mod_ctrl, common_cfg->mod_ctrl);
+        XCVR_DELTA_REG_WRITE(XCVR_PLL_DIG->PLL_DATARATE_CTRL,
+                             curr_common_cfg->pll_datarate_ctrl,
+                             common_cfg->pll_datarate_ctrl);
+        XCVR_DELTA_REG_WRITE(XCVR_PLL_DIG->TUNING_CAP_RX_CTRL,
+                             curr_common_cfg->tuning_cap_rx_ctrl,
+                             common_cfg->tuning_cap_rx_ctrl);
+        XCVR_DELTA_REG_WRITE(XCVR_PLL_DIG->TUNING_CAP_TX_CTRL,
+                             curr_common_cfg->tuning_cap_tx_ctrl,
+                             common_cfg->tuning_cap_tx_ctrl);
+        /***********************/
+        /* XCVR_RX_DIG configs */
+        /***********************/
+        XCVR_DELTA_REG_WRITE(XCVR_RX_DIG->ACQ_FILT_0_3,
+                             curr_mode_datarate_cfg->acq_filt_0_3,
+                             mode_datarate_cfg->acq_filt_0_3);
+        XCVR_DELTA_REG_WRITE(XCVR_RX_DIG->ACQ_FILT_0_3_DRS,
+                             curr_mode_datarate_cfg->acq_filt_0_3_drs,
+                             mode_datarate_cfg->acq_filt_0_3_drs);
+        XCVR_DELTA_REG_WRITE(XCVR_RX_DIG->ACQ_FILT_10_11,
+                             curr_mode_datarate_cfg->acq_filt_10_11,
+                             mode_datarate_cfg->acq_filt_10_11);
+        XCVR_DELTA_REG_WRITE(XCVR_RX_DIG->ACQ_FILT_10_11_DRS,
+                             curr_mode_datarate_cfg->acq_filt_10_11_drs,
+                             mode_datarate_cfg->acq_filt_10_11_drs);
+        XCVR_DELTA_REG_WRITE(XCVR_RX_DIG->ACQ_FILT_4_7,
+                             curr_mode_datarate_cfg->acq_filt_4_7,
+                             mode_datarate_cfg->acq_filt_4_7);
+        XCVR_DELTA_REG_WRITE(XCVR_RX_DIG->ACQ_FILT_4_7_DRS,
+                             curr_mode_datarate_cfg->acq_filt_4_7_drs,
+                             mode_datarate_cfg->acq_filt_4_7_drs);
+        XCVR_DELTA_REG_WRITE(XCVR_RX_DIG->ACQ_FILT_8_9,
+                             curr_mode_datarate_cfg->acq_filt_8_9,
+                             mode_datarate_cfg->acq_filt_8_9);
+        XCVR_DELTA_REG_WRITE(XCVR_RX_DIG->ACQ_FILT_8_9_DRS,
+                             curr_mode_datarate_cfg->acq_filt_8_9_drs,
+                             mode_datarate_cfg->acq_filt_8_9_drs);
+        XCVR_DELTA_REG_WRITE(XCVR_RX_DIG->AGC_CTRL, curr_common_cfg->agc_ctrl, common_cfg->agc_ctrl);
+        XCVR_DELTA_REG_WRITE(XCVR_RX_DIG->AGC_CTRL_STAT, curr_common_cfg->agc_ctrl_stat, common_cfg->agc_ctrl_stat);
+        XCVR_DELTA_REG_WRITE(XCVR_RX_DIG->AGC_IDX0_GAIN_CFG,
+                             curr_common_cfg->agc_idx0_gain_cfg,
+                             common_cfg->agc_idx0_gain_cfg);
+        XCVR_DELTA_REG_WRITE(XCVR_RX_DIG->AGC_IDX0_GAIN_VAL,
+                             curr_common_cfg->agc_idx0_gain_val,
+                             common_cfg->agc_idx0_gain_val);
+        XCVR_DELTA_REG_WRITE(XCVR_RX_DIG->AGC_IDX0_THR, curr_common_cfg->agc_idx0_thr, common_cfg->agc_idx0_thr);
+        XCVR_DELTA_REG_WRITE(XCVR_RX_DIG->AGC_IDX10_GAIN_CFG,
+                             curr_common_cfg->agc_idx10_gain_cfg,
+                             common_cfg->agc_idx10_gain_cfg);
+        XCVR_DELTA_REG_WRITE(XCVR_RX_DIG->AGC_IDX10_GAIN_VAL,
+                             curr_common_cfg->agc_idx10_gain_val,
+                             common_cfg->agc_idx10_gain_val);
+        XCVR_DELTA_REG_WRITE(XCVR_RX_DIG->AGC_IDX10_THR, curr_common_cfg->agc_idx10_thr, common_cfg->agc_idx10_thr);
+        XCVR_DELTA_REG_WRITE(XCVR_RX_DIG->AGC_IDX11_GAIN_CFG,
+                             curr_common_cfg->agc_idx11_gain_cfg | curr_mode_datarate_cfg->agc_idx11_gain_cfg,
+                             common_cfg->agc_idx11_gain_cfg | mode_datarate_cfg->agc_idx11_gain_cfg);
+        XCVR_DELTA_REG_WRITE(XCVR_RX_DIG->AGC_IDX11_GAIN_VAL,
+                             curr_common_cfg->agc_idx11_gain_val | curr_mode_datarate_cfg->agc_idx11_gain_val,
+                             common_cfg->agc_idx11_gain_val | mode_datarate_cfg->agc_idx11_gain_val);
+        XCVR_DELTA_REG_WRITE(XCVR_RX_DIG->AGC_IDX11_THR, curr_common_cfg->agc_idx11_thr, common_cfg->agc_idx11_thr);
+        XCVR_DELTA_REG_WRITE(XCVR_RX_DIG->AGC_IDX1_GAIN_CFG,
+                             curr_common_cfg->agc_idx1_gain_cfg,
+                             common_cfg->agc_idx1_gain_cfg);
+        XCVR_DELTA_REG_WRITE(XCVR_RX_DIG->AGC_IDX1_GAIN_VAL,
+                             curr_common_cfg->agc_idx1_gain_val,
+                             common_cfg->agc_idx1_gain_val);
+        XCVR_DELTA_REG_WRITE(XCVR_RX_DIG->AGC_IDX1_THR, curr_common_cfg->agc_idx1_thr, common_cfg->agc_idx1_thr);
+        XCVR_DELTA_REG_WRITE(XCVR_RX_DIG->AGC_IDX2_GAIN_CFG,
+                             curr_common_cfg->agc_idx2_gain_cfg,
+                             common_cfg->agc_idx2_gain_cfg);
+        XCVR_DELTA_REG_WRITE(XCVR_RX_DIG->AGC_IDX2_GAIN_VAL,
+                             curr_common_cfg->agc_idx2_gain_val,
+                             common_cfg->agc_idx2_gain_val);
+        XCVR_DELTA_REG_WRITE(XCVR_RX_DIG->AGC_IDX2_THR, curr_common_cfg->agc_idx2_thr, common_cfg->agc_idx2_thr);
+        XCVR_DELTA_REG_WRITE(XCVR_RX_DIG->AGC_IDX3_GAIN_CFG,
+                             curr_common_cfg->agc_idx3_gain_cfg,
+                             common_cfg->agc_idx3_gain_cfg);
+        XCVR_DELTA_REG_WRITE(XCVR_RX_DIG->AGC_IDX3_GAIN_VAL,
+                             curr_common_cfg->agc_idx3_gain_val,
+                             common_cfg->agc_idx3_gain_val);
+        XCVR_DELTA_REG_WRITE(XCVR_RX_DIG->AGC_IDX3_THR, curr_common_cfg->agc_idx3_thr, common_cfg->agc_idx3_thr);
+        XCVR_DELTA_REG_WRITE(XCVR_RX_DIG->AGC_IDX4_GAIN_CFG,
+                             curr_common_cfg->agc_idx4_gain_cfg,
+                             common_cfg->agc_idx4_gain_cfg);
+        XCVR_DELTA_REG_WRITE(XCVR_RX_DIG->AGC_IDX4_GAIN_VAL,
+                             curr_common_cfg->agc_idx4_gain_val,
+                             common_cfg->agc_idx4_gain_val);
+        XCVR_DELTA_REG_WRITE(XCVR_RX_DIG->AGC_IDX4_THR, curr_common_cfg->agc_idx4_thr, common_cfg->agc_idx4_thr);
+        XCVR_DELTA_REG_WRITE(XCVR_RX_DIG->AGC_IDX5_GAIN_CFG,
+                             curr_common_cfg->agc_idx5_gain_cfg,
+                             common_cfg->agc_idx5_gain_cfg);
+        XCVR_DELTA_REG_WRITE(XCVR_RX_DIG->AGC_IDX5_GAIN_VAL,
+                             curr_common_cfg->agc_idx5_gain_val,
+                             common_cfg->agc_idx5_gain_val);
+        XCVR_DELTA_REG_WRITE(XCVR_RX_DIG->AGC_IDX5_THR, curr_common_cfg->agc_idx5_thr, common_cfg->agc_idx5_thr);
+        XCVR_DELTA_REG_WRITE(XCVR_RX_DIG->AGC_IDX6_GAIN_CFG,
+                             curr_common_cfg->agc_idx6_gain_cfg,
+                             common_cfg->agc_idx6_gain_cfg);
+        XCVR_DELTA_REG_WRITE(XCVR_RX_DIG->AGC_IDX6_GAIN_VAL,
+                             curr_common_cfg->agc_idx6_gain_val,
+                             common_cfg->agc_idx6_gain_val);
+        XCVR_DELTA_REG_WRITE(XCVR_RX_DIG->AGC_IDX6_THR, curr_common_cfg->agc_idx6_thr, common_cfg->agc_idx6_thr);
+        XCVR_DELTA_REG_WRITE(XCVR_RX_DIG->AGC_IDX7_GAIN_CFG,
+                             curr_common_cfg->agc_idx7_gain_cfg,
+                             common_cfg->agc_idx7_gain_cfg);
+        XCVR_DELTA_REG_WRITE(XCVR_RX_DIG->AGC_IDX7_GAIN_VAL,
+                             curr_common_cfg->agc_idx7_gain_val,
+                             common_cfg->agc_idx7_gain_val);
+        XCVR_DELTA_REG_WRITE(XCVR_RX_DIG->AGC_IDX7_THR, curr_common_cfg->agc_idx7_thr, common_cfg->agc_idx7_thr);
+        XCVR_DELTA_REG_WRITE(XCVR_RX_DIG->AGC_IDX8_GAIN_CFG,
+                             curr_common_cfg->agc_idx8_gain_cfg,
+                             common_cfg->agc_idx8_gain_cfg);
+        XCVR_DELTA_REG_WRITE(XCVR_RX_DIG->AGC_IDX8_GAIN_VAL,
+                             curr_common_cfg->agc_idx8_gain_val,
+                             common_cfg->agc_idx8_gain_val);
+        XCVR_DELTA_REG_WRITE(XCVR_RX_DIG->AGC_IDX8_THR, curr_common_cfg->agc_idx8_thr, common_cfg->agc_idx8_thr);
+        XCVR_DELTA_REG_WRITE(XCVR_RX_DIG->AGC_IDX9_GAIN_CFG,
+                             curr_common_cfg->agc_idx9_gain_cfg,
+                             common_cfg->agc_idx9_gain_cfg);
+        XCVR_DELTA_REG_WRITE(XCVR_RX_DIG->AGC_IDX9_GAIN_VAL,
+                             curr_common_cfg->agc_idx9_gain_val,
+                             common_cfg->agc_idx9_gain_val);
+        XCVR_DELTA_REG_WRITE(XCVR_RX_DIG->AGC_IDX9_THR, curr_common_cfg->agc_idx9_thr, common_cfg->agc_idx9_thr);
+        XCVR_DELTA_REG_WRITE(XCVR_RX_DIG->AGC_MIS_GAIN_CFG,
+                             curr_common_cfg->agc_mis_gain_cfg,
+                             common_cfg->agc_mis_gain_cfg);
+        XCVR_DELTA_REG_WRITE(XCVR_RX_DIG->AGC_THR_FAST, curr_common_cfg->agc_thr_fast, common_cfg->agc_thr_fast);
+        XCVR_DELTA_REG_WRITE(XCVR_RX_DIG->AGC_THR_FAST_DRS,
+                             curr_common_cfg->agc_thr_fast_drs,
+                             common_cfg->agc_thr_fast_drs);
+        XCVR_DELTA_REG_WRITE(XCVR_RX_DIG->AGC_THR_MIS, curr_common_cfg->agc_thr_mis, common_cfg->agc_thr_mis);
+        XCVR_DELTA_REG_WRITE(XCVR_RX_DIG->AGC_TIMING0,
+                             curr_common_cfg->agc_timing0 | curr_mode_datarate_cfg->agc_timing0,
+                             common_cfg->agc_timing0 | mode_datarate_cfg->agc_timing0);
+        XCVR_DELTA_REG_WRITE(XCVR_RX_DIG->AGC_TIMING0_DRS,
+                             curr_mode_datarate_cfg->agc_timing0_drs | curr_common_cfg->agc_timing0_drs,
+                             mode_datarate_cfg->agc_timing0_drs | common_cfg->agc_timing0_drs);
+        XCVR_DELTA_REG_WRITE(XCVR_RX_DIG->AGC_TIMING1,
+                             curr_mode_datarate_cfg->agc_timing1 | curr_common_cfg->agc_timing1,
+                             mode_datarate_cfg->agc_timing1 | common_cfg->agc_timing1);
+        XCVR_DELTA_REG_WRITE(XCVR_RX_DIG->AGC_TIMING1_DRS,
+                             curr_mode_datarate_cfg->agc_timing1_drs,
+                             mode_datarate_cfg->agc_timing1_drs);
+        XCVR_DELTA_REG_WRITE(XCVR_RX_DIG->AGC_TIMING2,
+                             curr_mode_datarate_cfg->agc_timing2 | curr_common_cfg->agc_timing2,
+                             mode_datarate_cfg->agc_timing2 | common_cfg->agc_timing2);
+        XCVR_DELTA_REG_WRITE(XCVR_RX_DIG->AGC_TIMING2_DRS,
+                             curr_mode_datarate_cfg->agc_timing2_drs,
+                             mode_datarate_cfg->agc_timing2_drs);
+        XCVR_DELTA_REG_WRITE(XCVR_RX_DIG->CTRL0,
+                             curr_common_cfg->ctrl0 | curr_mode_datarate_cfg->ctrl0,
+                             common_cfg->ctrl0 | mode_datarate_cfg->ctrl0);
+        XCVR_DELTA_REG_WRITE(XCVR_RX_DIG->CTRL0_DRS, curr_mode_datarate_cfg->ctrl0_drs, mode_datarate_cfg->ctrl0_drs);
+        XCVR_DELTA_REG_WRITE(XCVR_RX_DIG->CTRL1, curr_common_cfg->ctrl1, common_cfg->ctrl1);
+        XCVR_DELTA_REG_WRITE(XCVR_RX_DIG->CTRL2, curr_common_cfg->ctrl2, common_cfg->ctrl2);
+        XCVR_DELTA_REG_WRITE(XCVR_RX_DIG->DCOC_CTRL0,
+                             curr_common_cfg->dcoc_ctrl0 | curr_mode_datarate_cfg->dcoc_ctrl0,
+                             common_cfg->dcoc_ctrl0 | mode_datarate_cfg->dcoc_ctrl0);
+        XCVR_DELTA_REG_WRITE(XCVR_RX_DIG->DCOC_CTRL0_DRS,
+                             curr_mode_datarate_cfg->dcoc_ctrl0_drs,
+                             mode_datarate_cfg->dcoc_ctrl0_drs);
+        XCVR_DELTA_REG_WRITE(XCVR_RX_DIG->DCOC_CTRL1, curr_common_cfg->dcoc_ctrl1, common_cfg->dcoc_ctrl1);
+        XCVR_DELTA_REG_WRITE(XCVR_RX_DIG->DEMOD_FILT_0_1,
+                             curr_mode_datarate_cfg->demod_filt_0_1,
+                             mode_datarate_cfg->demod_filt_0_1);
+        XCVR_DELTA_REG_WRITE(XCVR_RX_DIG->DEMOD_FILT_0_1_DRS,
+                             curr_mode_datarate_cfg->demod_filt_0_1_drs,
+                             mode_datarate_cfg->demod_filt_0_1_drs);
+        XCVR_DELTA_REG_WRITE(XCVR_RX_DIG->DEMOD_FILT_2_4,
+                             curr_mode_datarate_cfg->demod_filt_2_4,
+                             mode_datarate_cfg->demod_filt_2_4);
+        XCVR_DELTA_REG_WRITE(XCVR_RX_DIG->DEMOD_FILT_2_4_DRS,
+                             curr_mode_datarate_cfg->demod_filt_2_4_drs,
+                             mode_datarate_cfg->demod_filt_2_4_drs);
+        XCVR_DELTA_REG_WRITE(XCVR_RX_DIG->IQMC_CTRL1_DRS, curr_common_cfg->iqmc_ctrl1_drs, common_cfg->iqmc_ctrl1_drs);
+        XCVR_DELTA_REG_WRITE(XCVR_RX_DIG->NB_RSSI_CTRL0, curr_common_cfg->nb_rssi_ctrl0, common_cfg->nb_rssi_ctrl0);
+        XCVR_DELTA_REG_WRITE(XCVR_RX_DIG->NB_RSSI_CTRL1, curr_common_cfg->nb_rssi_ctrl1, common_cfg->nb_rssi_ctrl1);
+        XCVR_DELTA_REG_WRITE(XCVR_RX_DIG->RCCAL_CTRL0,
+                             curr_mode_datarate_cfg->rccal_ctrl0,
+                             mode_datarate_cfg->rccal_ctrl0);
+        XCVR_DELTA_REG_WRITE(XCVR_RX_DIG->RSSI_GLOBAL_CTRL,
+                             curr_common_cfg->rssi_global_ctrl | curr_mode_datarate_cfg->rssi_global_ctrl,
+                             common_cfg->rssi_global_ctrl | mode_datarate_cfg->rssi_global_ctrl);
+        XCVR_DELTA_REG_WRITE(XCVR_RX_DIG->TQI_CTRL, curr_common_cfg->tqi_ctrl, common_cfg->tqi_ctrl);
+        XCVR_DELTA_REG_WRITE(XCVR_RX_DIG->TQI_THR, curr_common_cfg->tqi_thr, common_cfg->tqi_thr);
+        XCVR_DELTA_REG_WRITE(XCVR_RX_DIG->WB_RSSI_CTRL, curr_common_cfg->wb_rssi_ctrl, common_cfg->wb_rssi_ctrl);
+        /********************/
+        /* XCVR_TSM configs */
+        /********************/
+        XCVR_DELTA_REG_WRITE(XCVR_TSM->CTRL, curr_common_cfg->ctrl, common_cfg->ctrl);
+        XCVR_DELTA_REG_WRITE(XCVR_TSM->END_OF_SEQ, curr_common_cfg->end_of_seq, common_cfg->end_of_seq);
+        XCVR_DELTA_REG_WRITE(XCVR_TSM->FAST_CTRL1, curr_common_cfg->fast_ctrl1, common_cfg->fast_ctrl1);
+        XCVR_DELTA_REG_WRITE(XCVR_TSM->FAST_CTRL2, curr_common_cfg->fast_ctrl2, common_cfg->fast_ctrl2);
+        XCVR_DELTA_REG_WRITE(XCVR_TSM->FAST_CTRL3, curr_common_cfg->fast_ctrl3, common_cfg->fast_ctrl3);
+        XCVR_DELTA_REG_WRITE(XCVR_TSM->RECYCLE_COUNT, curr_common_cfg->recycle_count, common_cfg->recycle_count);
+        XCVR_DELTA_REG_WRITE(XCVR_TSM->TIMING00, curr_common_cfg->timing00, common_cfg->timing00);
+        XCVR_DELTA_REG_WRITE(XCVR_TSM->TIMING01, curr_common_cfg->timing01, common_cfg->timing01);
+        XCVR_DELTA_REG_WRITE(XCVR_TSM->TIMING02, curr_common_cfg->timing02, common_cfg->timing02);
+        XCVR_DELTA_REG_WRITE(XCVR_TSM->TIMING03, curr_common_cfg->timing03, common_cfg->timing03);
+        XCVR_DELTA_REG_WRITE(XCVR_TSM->TIMING04, curr_common_cfg->timing04, common_cfg->timing04);
+        XCVR_DELTA_REG_WRITE(XCVR_TSM->TIMING05, curr_common_cfg->timing05, common_cfg->timing05);
+        XCVR_DELTA_REG_WRITE(XCVR_TSM->TIMING06, curr_common_cfg->timing06, common_cfg->timing06);
+        XCVR_DELTA_REG_WRITE(XCVR_TSM->TIMING07, curr_common_cfg->timing07, common_cfg->timing07);
+        XCVR_DELTA_REG_WRITE(XCVR_TSM->TIMING08, curr_common_cfg->timing08, common_cfg->timing08);
+        XCVR_DELTA_REG_WRITE(XCVR_TSM->TIMING09, curr_common_cfg->timing09, common_cfg->timing09);
+        XCVR_DELTA_REG_WRITE(XCVR_TSM->TIMING10, curr_common_cfg->timing10, common_cfg->timing10);
+        XCVR_DELTA_REG_WRITE(XCVR_TSM->TIMING11, curr_common_cfg->timing11, common_cfg->timing11);
+        XCVR_DELTA_REG_WRITE(XCVR_TSM->TIMING12, curr_common_cfg->timing12, common_cfg->timing12);
+        XCVR_DELTA_REG_WRITE(XCVR_TSM->TIMING13, curr_common_cfg->timing13, common_cfg->timing13);
+        XCVR_DELTA_REG_WRITE(XCVR_TSM->TIMING14, curr_common_cfg->timing14, common_cfg->timing14);
+        XCVR_DELTA_REG_WRITE(XCVR_TSM->TIMING15, curr_common_cfg->timing15, common_cfg->timing15);
+        XCVR_DELTA_REG_WRITE(XCVR_TSM->TIMING16, curr_common_cfg->timing16, common_cfg->timing16);
+        XCVR_DELTA_REG_WRITE(XCVR_TSM->TIMING17, curr_common_cfg->timing17, common_cfg->timing17);
+        XCVR_DELTA_REG_WRITE(XCVR_TSM->TIMING18, curr_common_cfg->timing18, common_cfg->timing18);
+        XCVR_DELTA_REG_WRITE(XCVR_TSM->TIMING19, curr_common_cfg->timing19, common_cfg->timing19);
+        XCVR_DELTA_REG_WRITE(XCVR_TSM->TIMING20, curr_common_cfg->timing20, common_cfg->timing20);
+        XCVR_DELTA_REG_WRITE(XCVR_TSM->TIMING21, curr_common_cfg->timing21, common_cfg->timing21);
+        XCVR_DELTA_REG_WRITE(XCVR_TSM->TIMING22, curr_common_cfg->timing22, common_cfg->timing22);
+        XCVR_DELTA_REG_WRITE(XCVR_TSM->TIMING23, curr_common_cfg->timing23, common_cfg->timing23);
+        XCVR_DELTA_REG_WRITE(XCVR_TSM->TIMING24, curr_common_cfg->timing24, common_cfg->timing24);
+        XCVR_DELTA_REG_WRITE(XCVR_TSM->TIMING25, curr_common_cfg->timing25, common_cfg->timing25);
+        XCVR_DELTA_REG_WRITE(XCVR_TSM->TIMING26, curr_common_cfg->timing26, common_cfg->timing26);
+        XCVR_DELTA_REG_WRITE(XCVR_TSM->TIMING27, curr_common_cfg->timing27, common_cfg->timing27);
+        XCVR_DELTA_REG_WRITE(XCVR_TSM->TIMING28, curr_common_cfg->timing28, common_cfg->timing28);
+        XCVR_DELTA_REG_WRITE(XCVR_TSM->TIMING29, curr_common_cfg->timing29, common_cfg->timing29);
+        XCVR_DELTA_REG_WRITE(XCVR_TSM->TIMING30, curr_common_cfg->timing30, common_cfg->timing30);
+        XCVR_DELTA_REG_WRITE(XCVR_TSM->TIMING31, curr_common_cfg->timing31, common_cfg->timing31);
+        XCVR_DELTA_REG_WRITE(XCVR_TSM->TIMING32, curr_common_cfg->timing32, common_cfg->timing32);
+        XCVR_DELTA_REG_WRITE(XCVR_TSM->TIMING33, curr_common_cfg->timing33, common_cfg->timing33);
+        XCVR_DELTA_REG_WRITE(XCVR_TSM->TIMING34, curr_common_cfg->timing34, common_cfg->timing34);
+        XCVR_DELTA_REG_WRITE(XCVR_TSM->TIMING35, curr_common_cfg->timing35, common_cfg->timing35);
+        XCVR_DELTA_REG_WRITE(XCVR_TSM->TIMING36, curr_common_cfg->timing36, common_cfg->timing36);
+        XCVR_DELTA_REG_WRITE(XCVR_TSM->TIMING37, curr_common_cfg->timing37, common_cfg->timing37);
+        XCVR_DELTA_REG_WRITE(XCVR_TSM->TIMING38, curr_common_cfg->timing38, common_cfg->timing38);
+        XCVR_DELTA_REG_WRITE(XCVR_TSM->TIMING39, curr_common_cfg->timing39, common_cfg->timing39);
+        XCVR_DELTA_REG_WRITE(XCVR_TSM->TIMING40, curr_common_cfg->timing40, common_cfg->timing40);
+        XCVR_DELTA_REG_WRITE(XCVR_TSM->TIMING41, curr_common_cfg->timing41, common_cfg->timing41);
+        XCVR_DELTA_REG_WRITE(XCVR_TSM->TIMING42, curr_common_cfg->timing42, common_cfg->timing42);
+        XCVR_DELTA_REG_WRITE(XCVR_TSM->TIMING43, curr_common_cfg->timing43, common_cfg->timing43);
+        XCVR_DELTA_REG_WRITE(XCVR_TSM->TIMING44, curr_common_cfg->timing44, common_cfg->timing44);
+        XCVR_DELTA_REG_WRITE(XCVR_TSM->TIMING45, curr_common_cfg->timing45, common_cfg->timing45);
+        XCVR_DELTA_REG_WRITE(XCVR_TSM->TIMING46, curr_common_cfg->timing46, common_cfg->timing46);
+        XCVR_DELTA_REG_WRITE(XCVR_TSM->TIMING47, curr_common_cfg->timing47, common_cfg->timing47);
+        XCVR_DELTA_REG_WRITE(XCVR_TSM->TIMING48, curr_common_cfg->timing48, common_cfg->timing48);
+        XCVR_DELTA_REG_WRITE(XCVR_TSM->TIMING49, curr_common_cfg->timing49, common_cfg->timing49);
+        XCVR_DELTA_REG_WRITE(XCVR_TSM->TIMING50, curr_common_cfg->timing50, common_cfg->timing50);
+        XCVR_DELTA_REG_WRITE(XCVR_TSM->TIMING51, curr_common_cfg->timing51, common_cfg->timing51);
+        XCVR_DELTA_REG_WRITE(XCVR_TSM->TIMING52, curr_common_cfg->timing52, common_cfg->timing52);
+        XCVR_DELTA_REG_WRITE(XCVR_TSM->TIMING53, curr_common_cfg->timing53, common_cfg->timing53);
+        XCVR_DELTA_REG_WRITE(XCVR_TSM->TIMING54, curr_common_cfg->timing54, common_cfg->timing54);
+        XCVR_DELTA_REG_WRITE(XCVR_TSM->TIMING55, curr_common_cfg->timing55, common_cfg->timing55);
+        XCVR_DELTA_REG_WRITE(XCVR_TSM->TIMING56, curr_common_cfg->timing56, common_cfg->timing56);
+        XCVR_DELTA_REG_WRITE(XCVR_TSM->TIMING57, curr_common_cfg->timing57, common_cfg->timing57);
+        XCVR_DELTA_REG_WRITE(XCVR_TSM->TIMING58, curr_common_cfg->timing58, common_cfg->timing58);
+        XCVR_DELTA_REG_WRITE(XCVR_TSM->TIMING59, curr_common_cfg->timing59, common_cfg->timing59);
+        XCVR_DELTA_REG_WRITE(XCVR_TSM->TIMING60, curr_common_cfg->timing60, common_cfg->timing60);
+        XCVR_DELTA_REG_WRITE(XCVR_TSM->TIMING61, curr_common_cfg->timing61, common_cfg->timing61);
+        XCVR_DELTA_REG_WRITE(XCVR_TSM->WU_LATENCY, curr_common_cfg->wu_latency, common_cfg->wu_latency);
+        /***********************/
+        /* XCVR_TX_DIG configs */
+        /***********************/
+        XCVR_DELTA_REG_WRITE(XCVR_TX_DIG->DATARATE_CONFIG_FILTER_CTRL,
+                             curr_mode_datarate_cfg->datarate_config_filter_ctrl,
+                             mode_datarate_cfg->datarate_config_filter_ctrl);
+        XCVR_DELTA_REG_WRITE(XCVR_TX_DIG->DATARATE_CONFIG_FSK_CTRL,
+                             curr_mode_datarate_cfg->datarate_config_fsk_ctrl,
+                             mode_datarate_cfg->datarate_config_fsk_ctrl);
+        XCVR_DELTA_REG_WRITE(XCVR_TX_DIG->DATARATE_CONFIG_GFSK_CTRL,
+                             curr_mode_datarate_cfg->datarate_config_gfsk_ctrl,
+                             mode_datarate_cfg->datarate_config_gfsk_ctrl);
+        XCVR_DELTA_REG_WRITE(XCVR_TX_DIG->DATA_PADDING_CTRL,
+                             curr_common_cfg->data_padding_ctrl | curr_mode_datarate_cfg->data_padding_ctrl,
+                             common_cfg->data_padding_ctrl | mode_datarate_cfg->data_padding_ctrl);
+        XCVR_DELTA_REG_WRITE(XCVR_TX_DIG->DATA_PADDING_CTRL_1,
+                             curr_common_cfg->data_padding_ctrl_1 | curr_mode_datarate_cfg->data_padding_ctrl_1,
+                             common_cfg->data_padding_ctrl_1 | mode_datarate_cfg->data_padding_ctrl_1);
+        XCVR_DELTA_REG_WRITE(XCVR_TX_DIG->DATA_PADDING_CTRL_2,
+                             curr_mode_datarate_cfg->data_padding_ctrl_2,
+                             mode_datarate_cfg->data_padding_ctrl_2);
+        XCVR_DELTA_REG_WRITE(XCVR_TX_DIG->FSK_CTRL, curr_mode_datarate_cfg->fsk_ctrl, mode_datarate_cfg->fsk_ctrl);
+        XCVR_DELTA_REG_WRITE(XCVR_TX_DIG->GFSK_COEFF_0_1,
+                             curr_mode_datarate_cfg->gfsk_coeff_0_1,
+                             mode_datarate_cfg->gfsk_coeff_0_1);
+        XCVR_DELTA_REG_WRITE(XCVR_TX_DIG->GFSK_COEFF_2_3,
+                             curr_mode_datarate_cfg->gfsk_coeff_2_3,
+                             mode_datarate_cfg->gfsk_coeff_2_3);
+        XCVR_DELTA_REG_WRITE(XCVR_TX_DIG->GFSK_COEFF_4_5,
+                             curr_mode_datarate_cfg->gfsk_coeff_4_5,
+                             mode_datarate_cfg->gfsk_coeff_4_5);
+        XCVR_DELTA_REG_WRITE(XCVR_TX_DIG->GFSK_COEFF_6_7,
+                             curr_mode_datarate_cfg->gfsk_coeff_6_7,
+                             mode_datarate_cfg->gfsk_coeff_6_7);
+        XCVR_DELTA_REG_WRITE(XCVR_TX_DIG->GFSK_CTRL, curr_mode_datarate_cfg->gfsk_ctrl, mode_datarate_cfg->gfsk_ctrl);
+        XCVR_DELTA_REG_WRITE(XCVR_TX_DIG->IMAGE_FILTER_CTRL,
+                             curr_common_cfg->image_filter_ctrl | curr_mode_datarate_cfg->image_filter_ctrl,
+                             common_cfg->image_filter_ctrl | mode_datarate_cfg->image_filter_ctrl);
+        XCVR_DELTA_REG_WRITE(XCVR_TX_DIG->PA_CTRL,
+                             curr_common_cfg->pa_ctrl | curr_mode_datarate_cfg->pa_ctrl,
+                             common_cfg->pa_ctrl | mode_datarate_cfg->pa_ctrl);
+        XCVR_DELTA_REG_WRITE(XCVR_TX_DIG->PA_RAMP_TBL0, curr_common_cfg->pa_ramp_tbl0, common_cfg->pa_ramp_tbl0);
+        XCVR_DELTA_REG_WRITE(XCVR_TX_DIG->PA_RAMP_TBL1, curr_common_cfg->pa_ramp_tbl1, common_cfg->pa_ramp_tbl1);
+        XCVR_DELTA_REG_WRITE(XCVR_TX_DIG->PA_RAMP_TBL2, curr_common_cfg->pa_ramp_tbl2, common_cfg->pa_ramp_tbl2);
+        XCVR_DELTA_REG_WRITE(XCVR_TX_DIG->PA_RAMP_TBL3, curr_common_cfg->pa_ramp_tbl3, common_cfg->pa_ramp_tbl3);
+        XCVR_DELTA_REG_WRITE(XCVR_TX_DIG->SWITCH_TX_CTRL, curr_common_cfg->switch_tx_ctrl, common_cfg->switch_tx_ctrl);
+        XCVR_DELTA_REG_WRITE(XCVR_TX_DIG->TXDIG_CTRL,
+                             curr_mode_datarate_cfg->txdig_ctrl | curr_common_cfg->txdig_ctrl,
+                             mode_datarate_cfg->txdig_ctrl | common_cfg->txdig_ctrl);
+        /* Return status */
+        status = gXcvrSuccess_c;
+        /***********************************************/
+        /************ END OF GENERATED CODE ************/
+        /************ XCVR_RadioGenRegSetupDelta *******/
+        /***********************************************/
+    }
+
+    if (skipped_writes != NULLPTR)
+    {
+        *skipped_writes = skipped;
+    }
+
+    return status;
+}
+
+xcvrStatus_t XCVR_RadioGenRBMESetupDelta(const xcvr_coding_config_t *curr_rbme,
+                                         const xcvr_coding_config_t *rbme,
+                                         uint32_t *skipped_writes)
+{
+    xcvrStatus_t status = gXcvrInvalidConfiguration_c;
+    uint32_t skipped    = 0U;
+
+    /* Check parameters */
+    if ((curr_rbme != NULLPTR) && (rbme != NULLPTR))
+    {
+        /* Generated XCVR_RadioGenRBMESetupDelta for all RBME registers goes here */
+        /***********************************************/
+        /*********** START OF GENERATED CODE ***********/
+        /*********** XCVR_RadioGenRBMESetupDelta *******/
+        /***********************************************/
+        /*******************/
+        /* GEN4PHY configs */
+        /*******************/
+        XCVR_DELTA_REG_WRITE(GEN4PHY->DMD_CTRL1, curr_rbme->dmd_ctrl1, rbme->dmd_ctrl1);
+        /****************/
+        /* RBME configs */
+        /****************/
+        XCVR_DELTA_REG_WRITE(RBME->CRCW_CFG, curr_rbme->crcw_cfg, rbme->crcw_cfg);
+        XCVR_DELTA_REG_WRITE(RBME->CRCW_CFG2, curr_rbme->crcw_cfg2, rbme->crcw_cfg2);
+        XCVR_DELTA_REG_WRITE(RBME->CRCW_CFG3, curr_rbme->crcw_cfg3, rbme->crcw_cfg3);
+        XCVR_DELTA_REG_WRITE(RBME->CRC_INIT, curr_rbme->crc_init, rbme->crc_init);
+        XCVR_DELTA_REG_WRITE(RBME->CRC_PHR_SZ, curr_rbme->crc_phr_sz, rbme->crc_phr_sz);
+        XCVR_DELTA_REG_WRITE(RBME->CRC_POLY, curr_rbme->crc_poly, rbme->crc_poly);
+        XCVR_DELTA_REG_WRITE(RBME->CRC_XOR_OUT, curr_rbme->crc_xor_out, rbme->crc_xor_out);
+        XCVR_DELTA_REG_WRITE(RBME->FCP_CFG, curr_rbme->fcp_cfg, rbme->fcp_cfg);
+        XCVR_DELTA_REG_WRITE(RBME->FEC_BSZ_OV_B4SP, curr_rbme->fec_bsz_ov_b4sp, rbme->fec_bsz_ov_b4sp);
+        XCVR_DELTA_REG_WRITE(RBME->FEC_CFG1, curr_rbme->fec_cfg1, rbme->fec_cfg1);
+        XCVR_DELTA_REG_WRITE(RBME->FEC_CFG2, curr_rbme->fec_cfg2, rbme->fec_cfg2);
+        XCVR_DELTA_REG_WRITE(RBME->FRAME_OVER_SZ, curr_rbme->frame_over_sz, rbme->frame_over_sz);
+        XCVR_DELTA_REG_WRITE(RBME->NPAYL_OVER_SZ, curr_rbme->npayl_over_sz, rbme->npayl_over_sz);
+        XCVR_DELTA_REG_WRITE(RBME->PKT_SZ, curr_rbme->pkt_sz, rbme->pkt_sz);
+        XCVR_DELTA_REG_WRITE(RBME->SPREAD_CFG, curr_rbme->spread_cfg, rbme->spread_cfg);
+        XCVR_DELTA_REG_WRITE(RBME->WHITEN_CFG, curr_rbme->whiten_cfg, rbme->whiten_cfg);
+        XCVR_DELTA_REG_WRITE(RBME->WHITEN_POLY, curr_rbme->whiten_poly, rbme->whiten_poly);
+        XCVR_DELTA_REG_WRITE(RBME->WHITEN_SZ_THR, curr_rbme->whiten_sz_thr, rbme->whiten_sz_thr);
+        /* Return status */
+        status = gXcvrSuccess_c;
+        /***********************************************/
+        /************ END OF GENERATED CODE ************/
+        /*********** XCVR_RadioGenRBMESetupDelta *******/
+        /***********************************************/
+    }
+
+    if (skipped_writes != NULLPTR)
+    {
+        *skipped_writes = skipped;
+    }
+
+    return status;
+}
+
+static uint32_t XCVR_RegDescValue(const xcvr_reg_desc_t *desc,
+                                  const xcvr_common_config_t *common_cfg,
+                                  const xcvr_mode_datarate_config_t *mode_datarate_cfg)
+{
+    uint32_t value = 0U;
+
+    /* Merge the common and the mode dependent fields the same way as the generated register setup */
+    if (desc->common_ofst != XCVR_REG_NO_FIELD)
+    {
+        value |= *(const uint32_t *)(const void *)((const uint8_t *)common_cfg + desc->common_ofst);
+    }
+    if (desc->mode_ofst != XCVR_REG_NO_FIELD)
+    {
+        value |= *(const uint32_t *)(const void *)((const uint8_t *)mode_datarate_cfg + desc->mode_ofst);
+    }
+
+    return value;
+}
+
+xcvrStatus_t XCVR_RadioGenRegSetupTable(const xcvr_config_t *xcvr_config)
+{
+    xcvrStatus_t status = gXcvrInvalidConfiguration_c;
+    uint16_t i;
+
+    /* Check parameter */
+    if (xcvr_config != NULLPTR)
+    {
+        for (i = 0U; i < XCVR_REG_IMAGE_NUM_REGS; i++)
+        {
+            *(xcvr_reg_desc_table[i].reg) =
+                XCVR_RegDescValue(&xcvr_reg_desc_table[i], xcvr_config->common_cfg, xcvr_config->mode_data_rate_cfg);
+        }
+        status = gXcvrSuccess_c;
+    }
+
+    return status;
+}
+
+xcvrStatus_t XCVR_RadioGenRegImageBuild(const xcvr_config_t *xcvr_config, xcvr_reg_image_t *image)
+{
+    xcvrStatus_t status = gXcvrInvalidConfiguration_c;
+    uint16_t i;
+    uint16_t word_idx   = 0U;
+    uint16_t header_idx = 0U;
+    uint16_t run_count  = 0U;
+
+    /* Check parameters */
+    if ((xcvr_config != NULLPTR) && (image != NULLPTR))
+    {
+        for (i = 0U; i < XCVR_REG_IMAGE_NUM_REGS; i++)
+        {
+            /* Start a new run unless this register immediately follows the last register of the current run */
+            if ((run_count == 0U) || (xcvr_reg_desc_table[i].reg != (xcvr_reg_desc_table[i - 1U].reg + 1U)))
+            {
+                if (run_count != 0U)
+                {
+                    image->words[header_idx] |= (uint32_t)run_count;
+                }
+                header_idx               = word_idx;
+                image->words[header_idx] = XCVR_REG_IMAGE_RUN_HDR(i, 0U);
+                word_idx++;
+                run_count = 0U;
+            }
+            image->words[word_idx] =
+                XCVR_RegDescValue(&xcvr_reg_desc_table[i], xcvr_config->common_cfg, xcvr_config->mode_data_rate_cfg);
+            word_idx++;
+            run_count++;
+        }
+        image->words[header_idx] |= (uint32_t)run_count;
+        image->num_words = word_idx;
+        status           = gXcvrSuccess_c;
+    }
+
+    return status;
+}
+
+xcvrStatus_t XCVR_RadioGenRegImageProgram(const xcvr_reg_image_t *image)
+{
+    xcvrStatus_t status = gXcvrInvalidConfiguration_c;
+    const uint32_t *src;
+    const uint32_t *end;
+    volatile uint32_t *dst;
+    uint16_t desc_idx;
+    uint16_t count;
+
+    /* Check parameter */
+    if ((image != NULLPTR) && (image->num_words <= XCVR_REG_IMAGE_MAX_WORDS))
+    {
+        status = gXcvrSuccess_c;
+        src    = &image->words[0];
+        end    = &image->words[image->num_words];
+        while (src < end)
+        {
+            desc_idx = (uint16_t)((*src & XCVR_REG_IMAGE_RUN_IDX_MASK) >> XCVR_REG_IMAGE_RUN_IDX_SHIFT);
+            count    = (uint16_t)(*src & XCVR_REG_IMAGE_RUN_CNT_MASK);
+            src++;
+            if ((count == 0U) || (desc_idx >= XCVR_REG_IMAGE_NUM_REGS) ||
+                (count > (uint16_t)(XCVR_REG_IMAGE_NUM_REGS - desc_idx)) || (count > (uint16_t)(end - src)))
+            {
+                /* Corrupted image, stop before writing outside of the described registers */
+                status = gXcvrInvalidConfiguration_c;
+                break;
+            }
+            /* XCVR_RadioGenRegImageBuild() ends a run at the first register which is not adjacent to the previous one,
+             * so a run is a block of consecutive addresses from the register of its first descriptor to the register
+             * of its last descriptor */
+            dst = xcvr_reg_desc_table[desc_idx].reg;
+            if (xcvr_reg_desc_table[desc_idx + count - 1U].reg != (dst + count - 1U))
+            {
+                status = gXcvrInvalidConfiguration_c;
+                break;
+            }
+            while (count > 0U)
+            {
+                *dst = *src;
+                dst++;
+                src++;
+                count--;
+            }
+        }
+    }
+
+    return status;
+}
+
+xcvrStatus_t XCVR_RadioGenRegSetupFolded(const xcvr_folded_config_t *folded_config)
+{
+    xcvrStatus_t status = gXcvrInvalidConfiguration_c;
+    const uint32_t *src;
+    uint16_t i;
+
+    /* Check parameter */
+    if (folded_config != NULLPTR)
+    {
+        /* Values are already merged, this is a straight copy from flash */
+        src = &folded_config->reg_values[0];
+        for (i = 0U; i < XCVR_REG_IMAGE_NUM_REGS; i++)
+        {
+            *(xcvr_reg_desc_table[i].reg) = src[i];
+        }
+        status = gXcvrSuccess_c;
+    }
+
+    return status;
+}
+
+static bool XCVR_ModeDeltaIsValid(const xcvr_mode_delta_config_t *delta_config)
+{
+    bool valid = false;
+    uint16_t i;
+
+    if ((delta_config != NULLPTR) && (delta_config->base_words != NULLPTR) &&
+        ((delta_config->num_deltas == 0U) ||
+         ((delta_config->delta_idx != NULLPTR) && (delta_config->delta_val != NULLPTR))))
+    {
+        valid = true;
+        for (i = 0U; i < delta_config->num_deltas; i++)
+        {
+            /* Indexes must stay inside the structure and be strictly increasing for the lookup */
+            if (((uint32_t)delta_config->delta_idx[i] >= XCVR_MODE_DELTA_NUM_WORDS) ||
+                ((i > 0U) && (delta_config->delta_idx[i] <= delta_config->delta_idx[i - 1U])))
+            {
+                valid = false;
+                break;
+            }
+        }
+    }
+
+    return valid;
+}
+
+static uint32_t XCVR_ModeDeltaWord(const xcvr_mode_delta_config_t *delta_config, uint16_t word_idx)
+{
+    uint32_t value = delta_config->base_words[word_idx];
+    uint16_t low   = 0U;
+    uint16_t high  = delta_config->num_deltas;
+    uint16_t mid;
+
+    /* Binary search of the sorted delta indexes, the base word is used when the word is not patched */
+    while (low < high)
+    {
+        mid = (uint16_t)((low + high) / 2U);
+        if ((uint16_t)delta_config->delta_idx[mid] < word_idx)
+        {
+            low = mid + 1U;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+    if ((low < delta_config->num_deltas) && ((uint16_t)delta_config->delta_idx[low] == word_idx))
+    {
+        value = delta_config->delta_val[low];
+    }
+
+    return value;
+}
+
+xcvrStatus_t XCVR_RadioGenModeDeltaExpand(const xcvr_mode_delta_config_t *delta_config,
+                                          xcvr_mode_datarate_config_t *mode_datarate_cfg)
+{
+    xcvrStatus_t status = gXcvrInvalidConfiguration_c;
+    uint32_t *dst;
+    uint16_t i;
+
+    /* Check parameters */
+    if ((mode_datarate_cfg != NULLPTR) && XCVR_ModeDeltaIsValid(delta_config))
+    {
+        /* Start from the shared base and patch the words that differ for this mode and data rate */
+        dst = (uint32_t *)(void *)mode_datarate_cfg;
+        for (i = 0U; i < (uint16_t)XCVR_MODE_DELTA_NUM_WORDS; i++)
+        {
+            dst[i] = delta_config->base_words[i];
+        }
+        for (i = 0U; i < delta_config->num_deltas; i++)
+        {
+            dst[delta_config->delta_idx[i]] = delta_config->delta_val[i];
+        }
+        status = gXcvrSuccess_c;
+    }
+
+    return status;
+}
+
+xcvrStatus_t XCVR_RadioGenRegSetupSparse(const xcvr_common_config_t *common_cfg,
+                                         const xcvr_mode_delta_config_t *delta_config)
+{
+    xcvrStatus_t status = gXcvrInvalidConfiguration_c;
+    const xcvr_reg_desc_t *desc;
+    uint32_t value;
+    uint16_t i;
+
+    /* Check parameters, a malformed delta is rejected before any register is written */
+    if ((common_cfg != NULLPTR) && XCVR_ModeDeltaIsValid(delta_config))
+    {
+        for (i = 0U; i < XCVR_REG_IMAGE_NUM_REGS; i++)
+        {
+            desc  = &xcvr_reg_desc_table[i];
+            value = 0U;
+            if (desc->common_ofst != XCVR_REG_NO_FIELD)
+            {
+                value |= *(const uint32_t *)(const void *)((const uint8_t *)common_cfg + desc->common_ofst);
+            }
+            if (desc->mode_ofst != XCVR_REG_NO_FIELD)
+            {
+                value |= XCVR_ModeDeltaWord(delta_config, (uint16_t)(desc->mode_ofst / sizeof(uint32_t)));
+            }
+            *(desc->reg) = value;
+        }
+        status = gXcvrSuccess_c;
+    }
+
+    return status;
+}
+
+xcvrStatus_t XCVR_RadioGenModeBankEncode(const xcvr_config_t *xcvr_config,
+                                         volatile uint32_t *blob,
+                                         uint16_t max_words,
+                                         uint16_t *num_words)
+{
+    xcvrStatus_t status = gXcvrInvalidConfiguration_c;
+    uint16_t i;
+    uint16_t run_len;
+    uint16_t word_idx = 0U;
+
+    /* Check parameters */
+    if ((xcvr_config != NULLPTR) && (blob != NULLPTR) && (num_words != NULLPTR))
+    {
+        status = gXcvrSuccess_c;
+        i      = 0U;
+        while ((i < XCVR_REG_IMAGE_NUM_REGS) && (status == gXcvrSuccess_c))
+        {
+            /* A burst covers consecutive registers, up to the descriptor count field limit */
+            run_len = 1U;
+            while (((i + run_len) < XCVR_REG_IMAGE_NUM_REGS) && (run_len < XCVR_MODE_BANK_MAX_BURST) &&
+                   (xcvr_reg_desc_table[i + run_len].reg == (xcvr_reg_desc_table[i + run_len - 1U].reg + 1U)))
+            {
+                run_len++;
+            }
+            /* Keep room for the run and the terminating descriptor */
+            if (((uint32_t)word_idx + run_len + 2U) > max_words)
+            {
+                status = gXcvrInvalidParameters_c;
+            }
+            else
+            {
+                blob[word_idx] = PR2IPS_DESCRIPTOR(PR2IPS_BURST_XFER, run_len, xcvr_reg_desc_table[i].reg);
+                word_idx++;
+                while (run_len > 0U)
+                {
+                    blob[word_idx] = XCVR_RegDescValue(&xcvr_reg_desc_table[i], xcvr_config->common_cfg,
+                                                       xcvr_config->mode_data_rate_cfg);
+                    word_idx++;
+                    i++;
+                    run_len--;
+                }
+            }
+        }
+        if (status == gXcvrSuccess_c)
+        {
+            blob[word_idx] = 0U; /* All zeros descriptor terminates the list */
+            word_idx++;
+        }
+        *num_words = word_idx;
+    }
+
+    return status;
+}
+
+xcvrStatus_t XCVR_RadioGenModeBankValidate(const uint32_t *blob, uint16_t num_words)
+{
+    xcvrStatus_t status = gXcvrInvalidConfiguration_c;
+    uint32_t descriptor;
+    uint32_t xfer_type;
+    uint32_t count;
+    uint32_t addr;
+    uint16_t word_idx = 0U;
+    uint16_t i;
+    bool found;
+
+    if (blob != NULLPTR)
+    {
+        status = gXcvrSuccess_c;
+        while (status == gXcvrSuccess_c)
+        {
+            if (word_idx >= num_words)
+            {
+                /* Ran out of words before the terminating descriptor */
+                status = gXcvrInvalidConfiguration_c;
+                break;
+            }
+            descriptor = blob[word_idx];
+            if (descriptor == 0U)
+            {
+                /* The terminating descriptor must be the last word */
+                if ((word_idx + 1U) != num_words)
+                {
+                    status = gXcvrInvalidConfiguration_c;
+                }
+                break;
+            }
+            xfer_type = (descriptor & PR2IPS_TYPE_MASK) >> PR2IPS_TYPE_SHIFT;
+            count     = (descriptor & PR2IPS_COUNT_MASK) >> PR2IPS_COUNT_SHIFT;
+            addr      = (descriptor & PR2IPS_ADDR_MASK) >> PR2IPS_ADDR_SHIFT;
+            if ((count == 0U) || ((xfer_type == (uint32_t)PR2IPS_SINGLE_XFER) && (count != 1U)) ||
+                ((xfer_type != (uint32_t)PR2IPS_SINGLE_XFER) && (xfer_type != (uint32_t)PR2IPS_BURST_XFER)) ||
+                ((addr & 0x3U) != 0U) || (((uint32_t)word_idx + count + 1U) >= num_words))
+            {
+                status = gXcvrInvalidConfiguration_c;
+                break;
+            }
+            /* Every register written by the descriptor must be one the radio register setup programs */
+            while ((count > 0U) && (status == gXcvrSuccess_c))
+            {
+                found = false;
+                for (i = 0U; i < XCVR_REG_IMAGE_NUM_REGS; i++)
+                {
+                    if (PR2IPS_ADDR(xcvr_reg_desc_table[i].reg) == addr)
+                    {
+                        found = true;
+                        break;
+                    }
+                }
+                if (!found)
+                {
+                    status = gXcvrInvalidConfiguration_c;
+                }
+                addr += (uint32_t)sizeof(uint32_t);
+                count--;
+            }
+            word_idx += (uint16_t)(((descriptor & PR2IPS_COUNT_MASK) >> PR2IPS_COUNT_SHIFT) + 1U);
+        }
+    }
+
+    return status;
+}
+
+xcvrStatus_t XCVR_RadioGenBlobEncode(const xcvr_common_config_t *common_cfg,
+                                     const xcvr_mode_datarate_config_t *mode_datarate_cfg,
+                                     const xcvr_coding_config_t *coding_cfg,
+                                     uint32_t *blob,
+                                     uint32_t max_words,
+                                     uint32_t *num_words)
+{
+    xcvrStatus_t status = gXcvrInvalidParameters_c;
+    uint32_t word_idx;
+
+    /* Check parameters */
+    if ((blob != NULLPTR) && (num_words != NULLPTR) && (max_words >= XCVR_BLOB_HDR_WORDS) &&
+        ((common_cfg != NULLPTR) || (mode_datarate_cfg != NULLPTR) || (coding_cfg != NULLPTR)))
+    {
+        word_idx = XCVR_BlobAddSection(blob, XCVR_BLOB_HDR_WORDS, max_words, XCVR_BLOB_SECT_COMMON, common_cfg,
+                                       XCVR_BLOB_COMMON_WORDS);
+        word_idx = XCVR_BlobAddSection(blob, word_idx, max_words, XCVR_BLOB_SECT_MODE_DATARATE, mode_datarate_cfg,
+                                       XCVR_BLOB_MODE_WORDS);
+        word_idx = XCVR_BlobAddSection(blob, word_idx, max_words, XCVR_BLOB_SECT_CODING, coding_cfg,
+                                       XCVR_BLOB_CODING_WORDS);
+        if (word_idx <= max_words)
+        {
+            blob[XCVR_BLOB_HDR_MAGIC]     = XCVR_BLOB_MAGIC;
+            blob[XCVR_BLOB_HDR_VERSION]   = XCVR_BLOB_VERSION;
+            blob[XCVR_BLOB_HDR_TARGET]    = XCVR_BLOB_TARGET;
+            blob[XCVR_BLOB_HDR_NUM_WORDS] = word_idx;
+            blob[XCVR_BLOB_HDR_CRC]       = XCVR_BlobCrc(&blob[XCVR_BLOB_HDR_WORDS], word_idx - XCVR_BLOB_HDR_WORDS);
+            *num_words                    = word_idx;
+            status                        = gXcvrSuccess_c;
+        }
+    }
+
+    return status;
+}
+
+xcvrStatus_t XCVR_RadioGenBlobLoad(const uint32_t *blob, uint32_t max_words, xcvr_blob_config_t *blob_config)
+{
+    xcvrStatus_t status = gXcvrInvalidParameters_c;
+    const xcvr_common_config_t *common_cfg               = NULLPTR;
+    const xcvr_mode_datarate_config_t *mode_datarate_cfg = NULLPTR;
+    const xcvr_coding_config_t *coding_cfg               = NULLPTR;
+    uint32_t num_words;
+    uint32_t word_idx;
+    uint32_t sect_type;
+    uint32_t sect_words;
+
+    /* Check parameters */
+    if ((blob != NULLPTR) && (blob_config != NULLPTR) && (max_words >= XCVR_BLOB_HDR_WORDS))
+    {
+        status    = gXcvrInvalidConfiguration_c;
+        num_words = blob[XCVR_BLOB_HDR_NUM_WORDS];
+        /* Header: only the minor version may differ, the size is checked before the CRC reads the payload */
+        if ((blob[XCVR_BLOB_HDR_MAGIC] == XCVR_BLOB_MAGIC) &&
+            ((blob[XCVR_BLOB_HDR_VERSION] >> 16U) == XCVR_BLOB_VERSION_MAJOR) &&
+            (blob[XCVR_BLOB_HDR_TARGET] == XCVR_BLOB_TARGET) && (num_words >= XCVR_BLOB_HDR_WORDS) &&
+            (num_words <= max_words) &&
+            (blob[XCVR_BLOB_HDR_CRC] == XCVR_BlobCrc(&blob[XCVR_BLOB_HDR_WORDS], num_words - XCVR_BLOB_HDR_WORDS)))
+        {
+            status   = gXcvrSuccess_c;
+            word_idx = XCVR_BLOB_HDR_WORDS;
+            while ((word_idx < num_words) && (status == gXcvrSuccess_c))
+            {
+                sect_type  = (blob[word_idx] & XCVR_BLOB_SECT_TYPE_MASK) >> XCVR_BLOB_SECT_TYPE_SHIFT;
+                sect_words = (blob[word_idx] & XCVR_BLOB_SECT_WORDS_MASK) >> XCVR_BLOB_SECT_WORDS_SHIFT;
+                word_idx++;
+                if ((word_idx + sect_words) > num_words)
+                {
+                    status = gXcvrInvalidConfiguration_c;
+                }
+                /* Known sections must match the structure layout of this build and appear only once */
+                else if (sect_type == (uint32_t)XCVR_BLOB_SECT_COMMON)
+                {
+                    if ((sect_words != XCVR_BLOB_COMMON_WORDS) || (common_cfg != NULLPTR))
+                    {
+                        status = gXcvrInvalidConfiguration_c;
+                    }
+                    else
+                    {
+                        common_cfg = (const xcvr_common_config_t *)(const void *)&blob[word_idx];
+                    }
+                }
+                else if (sect_type == (uint32_t)XCVR_BLOB_SECT_MODE_DATARATE)
+                {
+                    if ((sect_words != XCVR_BLOB_MODE_WORDS) || (mode_datarate_cfg != NULLPTR))
+                    {
+                        status = gXcvrInvalidConfiguration_c;
+                    }
+                    else
+                    {
+                        mode_datarate_cfg = (const xcvr_mode_datarate_config_t *)(const void *)&blob[word_idx];
+                        if (((uint32_t)mode_datarate_cfg->radio_mode >= (uint32_t)NUM_RADIO_MODES) ||
+                            ((uint32_t)mode_datarate_cfg->data_rate >= (uint32_t)DR_UNASSIGNED) ||
+                            ((uint32_t)mode_datarate_cfg->alt_data_rate >= (uint32_t)DR_UNASSIGNED))
+                        {
+                            status = gXcvrInvalidConfiguration_c;
+                        }
+                    }
+                }
+                else if (sect_type == (uint32_t)XCVR_BLOB_SECT_CODING)
+                {
+                    if ((sect_words != XCVR_BLOB_CODING_WORDS) || (coding_cfg != NULLPTR))
+                    {
+                        status = gXcvrInvalidConfiguration_c;
+                    }
+                    else
+                    {
+                        coding_cfg = (const xcvr_coding_config_t *)(const void *)&blob[word_idx];
+                        if ((uint32_t)coding_cfg->coding_mode >= (uint32_t)CODING_UNASSIGNED)
+                        {
+                            status = gXcvrInvalidConfiguration_c;
+                        }
+                    }
+                }
+                else
+                {
+                    /* Section added by a later minor version, skipped */
+                }
+                word_idx += sect_words;
+            }
+            if ((status == gXcvrSuccess_c) &&
+                ((common_cfg != NULLPTR) || (mode_datarate_cfg != NULLPTR) || (coding_cfg != NULLPTR)))
+            {
+                blob_config->config.common_cfg         = common_cfg;
+                blob_config->config.mode_data_rate_cfg = mode_datarate_cfg;
+                blob_config->coding_cfg                = coding_cfg;
+            }
+            else
+            {
+                status = gXcvrInvalidConfiguration_c;
+            }
+        }
+    }
+
+    return status;
+}
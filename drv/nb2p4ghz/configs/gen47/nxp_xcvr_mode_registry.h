@@ -0,0 +1,138 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+
+ */
+
+#ifndef NXP_XCVR_MODE_REGISTRY_H
+/* clang-format off */
+#define NXP_XCVR_MODE_REGISTRY_H
+/* clang-format on */
+
+#include "nxp2p4_xcvr.h"
+
+/*!
+ * @addtogroup configs Radio Configuration Files
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ *******************************************************************************/
+/*
+ * Radio modes registered in xcvr_mode_registry. Set a flag to 0 (Kconfig "XCVR mode registry" menu) to leave the
+ * configurations of that mode out of the registry so that the linker can discard them when nothing else refers to them.
+ */
+#ifndef gXcvrRegistryBle_d
+#define gXcvrRegistryBle_d (1) /*!< BLE_MODE and BLE_LR, with the BLE coded S2 and S8 coding configurations */
+#endif
+
+#ifndef gXcvrRegistryOqpsk_d
+#define gXcvrRegistryOqpsk_d (1) /*!< OQPSK_802P15P4 */
+#endif
+
+#ifndef gXcvrRegistryGfskBt0p5H0p5_d
+#define gXcvrRegistryGfskBt0p5H0p5_d (1) /*!< GFSK_BT_0p5_h_0p5 */
+#endif
+
+#ifndef gXcvrRegistryGfskBt0p5H0p32_d
+#define gXcvrRegistryGfskBt0p5H0p32_d (1) /*!< GFSK_BT_0p5_h_0p32 */
+#endif
+
+#ifndef gXcvrRegistryGfskBt0p5H0p7_d
+#define gXcvrRegistryGfskBt0p5H0p7_d (1) /*!< GFSK_BT_0p5_h_0p7 */
+#endif
+
+#ifndef gXcvrRegistryGfskBt0p5H1p0_d
+#define gXcvrRegistryGfskBt0p5H1p0_d (1) /*!< GFSK_BT_0p5_h_1p0 */
+#endif
+
+#ifndef gXcvrRegistryGfskBt0p3H0p5_d
+#define gXcvrRegistryGfskBt0p3H0p5_d (1) /*!< GFSK_BT_0p3_h_0p5 */
+#endif
+
+#ifndef gXcvrRegistryGfskBt0p7H0p5_d
+#define gXcvrRegistryGfskBt0p7H0p5_d (1) /*!< GFSK_BT_0p7_h_0p5 */
+#endif
+
+#ifndef gXcvrRegistryGfskBt1p0H0p5_d
+#define gXcvrRegistryGfskBt1p0H0p5_d (1) /*!< GFSK_BT_1p0_h_0p5 */
+#endif
+
+#ifndef gXcvrRegistryGfskBt2p0H0p5_d
+#define gXcvrRegistryGfskBt2p0H0p5_d (1) /*!< GFSK_BT_2p0_h_0p5 */
+#endif
+
+#ifndef gXcvrRegistryMsk_d
+#define gXcvrRegistryMsk_d (1) /*!< MSK */
+#endif
+
+#ifndef gXcvrRegistryFskH0p5_d
+#define gXcvrRegistryFskH0p5_d (1) /*!< FSK_H_0p5 */
+#endif
+
+#ifndef gXcvrRegistryAnt_d
+#define gXcvrRegistryAnt_d (1) /*!< ANT_UNCODED coding configuration */
+#endif
+
+/*! @brief Number of data rates indexing the mode registry (DR_1MBPS to DR_2MBPS) */
+#define XCVR_MODE_REGISTRY_NUM_RATES ((uint32_t)DR_UNASSIGNED)
+
+/*! @brief Number of codings indexing the mode registry (BLE_UNCODED to ANT_UNCODED) */
+#define XCVR_MODE_REGISTRY_NUM_CODINGS ((uint32_t)CODING_UNASSIGNED)
+
+/*!
+ * @brief XCVR mode registry structure
+ * Configurations indexed directly by radio_mode_t, data_rate_t and coding_t, NULLPTR where no configuration is
+ * registered.
+ */
+typedef struct
+{
+    const xcvr_config_t *config[NUM_RADIO_MODES][XCVR_MODE_REGISTRY_NUM_RATES]; /*!< Configuration per mode and rate */
+    const xcvr_coding_config_t *coding[XCVR_MODE_REGISTRY_NUM_CODINGS];         /*!< Coding configuration per coding */
+} xcvr_mode_registry_t;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+/*! @brief Configurations of the registered radio modes */
+extern const xcvr_mode_registry_t xcvr_mode_registry;
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*!
+ * @brief Looks up the configurations of a radio mode, data rate and coding.
+ *
+ * This function returns the configuration pointers to pass to ::XCVR_Init() or ::XCVR_ChangeMode() for a radio mode
+ * selected at run time, with a direct index in ::xcvr_mode_registry. The data rate of a configuration is its rate
+ * in the configuration name (DR_500KBPS and DR_250KBPS select the 500kbps and 250kbps configurations), DR_1MBPS and
+ * DR_2MBPS both select the 1mbps configuration, which supports 2Mbps as its alternate rate.
+ *
+ * @param[in] radio_mode  The radio mode.
+ * @param[in] data_rate  The data rate.
+ * @param[in] coding  The coding.
+ * @param[out] xcvr_config  Location to store the radio configuration pointer.
+ * @param[out] rbme_config  Location to store the coding configuration pointer.
+ *
+ * @return The status of the lookup, ::gXcvrInvalidParameters_c for a NULLPTR or out of range argument,
+ * ::gXcvrUnsupportedOperation_c if the combination is not registered. The outputs are only written on success.
+ */
+xcvrStatus_t XCVR_GetModeConfig(radio_mode_t radio_mode,
+                                data_rate_t data_rate,
+                                coding_t coding,
+                                const xcvr_config_t **xcvr_config,
+                                const xcvr_coding_config_t **rbme_config);
+
+/* @} */
+
+#if defined(__cplusplus)
+}
+#endif
+
+/*! @}*/
+
+#endif /* NXP_XCVR_MODE_REGISTRY_H */
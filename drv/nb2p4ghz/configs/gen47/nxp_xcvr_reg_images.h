@@ -0,0 +1,44 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/* Generated by tools/xcvr_reg_image_gen.c, do not edit */
+
+#ifndef NXP_XCVR_REG_IMAGES_H
+/* clang-format off */
+#define NXP_XCVR_REG_IMAGES_H
+/* clang-format on */
+
+#include "nxp2p4_xcvr.h"
+
+extern const xcvr_folded_config_t xcvr_fsk_h_0p5_1mbps_folded_config;
+extern const xcvr_folded_config_t xcvr_fsk_h_0p5_500kbps_folded_config;
+extern const xcvr_folded_config_t xcvr_fsk_h_0p5_250kbps_folded_config;
+extern const xcvr_folded_config_t xcvr_gfsk_bt_0p3_h_0p5_1mbps_folded_config;
+extern const xcvr_folded_config_t xcvr_gfsk_bt_0p3_h_0p5_500kbps_folded_config;
+extern const xcvr_folded_config_t xcvr_gfsk_bt_0p3_h_0p5_250kbps_folded_config;
+extern const xcvr_folded_config_t xcvr_gfsk_bt_0p5_h_0p32_1mbps_folded_config;
+extern const xcvr_folded_config_t xcvr_gfsk_bt_0p5_h_0p32_500kbps_folded_config;
+extern const xcvr_folded_config_t xcvr_gfsk_bt_0p5_h_0p32_250kbps_folded_config;
+extern const xcvr_folded_config_t xcvr_gfsk_bt_0p5_h_0p5_1mbps_folded_config;
+extern const xcvr_folded_config_t xcvr_gfsk_bt_0p5_h_0p5_500kbps_folded_config;
+extern const xcvr_folded_config_t xcvr_gfsk_bt_0p5_h_0p5_250kbps_folded_config;
+extern const xcvr_folded_config_t xcvr_gfsk_bt_0p5_h_0p7_1mbps_folded_config;
+extern const xcvr_folded_config_t xcvr_gfsk_bt_0p5_h_0p7_500kbps_folded_config;
+extern const xcvr_folded_config_t xcvr_gfsk_bt_0p5_h_0p7_250kbps_folded_config;
+extern const xcvr_folded_config_t xcvr_gfsk_bt_0p5_h_1p0_1mbps_folded_config;
+extern const xcvr_folded_config_t xcvr_gfsk_bt_0p5_h_1p0_500kbps_folded_config;
+extern const xcvr_folded_config_t xcvr_gfsk_bt_0p5_h_1p0_250kbps_folded_config;
+extern const xcvr_folded_config_t xcvr_gfsk_bt_0p7_h_0p5_1mbps_folded_config;
+extern const xcvr_folded_config_t xcvr_gfsk_bt_0p7_h_0p5_500kbps_folded_config;
+extern const xcvr_folded_config_t xcvr_gfsk_bt_0p7_h_0p5_250kbps_folded_config;
+extern const xcvr_folded_config_t xcvr_gfsk_bt_1p0_h_0p5_1mbps_folded_config;
+extern const xcvr_folded_config_t xcvr_gfsk_bt_2p0_h_0p5_1mbps_folded_config;
+extern const xcvr_folded_config_t xcvr_msk_1mbps_folded_config;
+extern const xcvr_folded_config_t xcvr_msk_500kbps_folded_config;
+extern const xcvr_folded_config_t xcvr_msk_250kbps_folded_config;
+extern const xcvr_folded_config_t xcvr_oqpsk_802p15p4_250kbps_folded_config;
+
+#endif /* NXP_XCVR_REG_IMAGES_H */
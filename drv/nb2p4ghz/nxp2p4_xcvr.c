@@ -8,7 +8,7 @@
 #include "fsl_common.h"
 #include "nxp2p4_xcvr.h"
 #include "nxp_xcvr_trim.h"
-#include <math.h>
+#include "nxp_xcvr_hop_table.h"
 
 /*******************************************************************************
  * Definitions
@@ -20,6 +20,72 @@
 #else
 #define XTAL_TRIM_MAX_VAL (0x3FU)
 #endif /* defined(RADIO_IS_GEN_3P5) */
+#if RF_OSC_26MHZ == 1
+#define XCVR_REF_OSC_HZ (26000000UL)
+#else
+#define XCVR_REF_OSC_HZ (32000000UL)
+#endif /* RF_OSC_26MHZ == 1 */
+#define XCVR_LPM_SDM_DENOM (XCVR_HOP_TABLE_DENOM) /* Low Port denominator of frequency overrides, max resolution */
+#define XCVR_LPM_QUOT_FRAC_BITS (47U) /* Fraction bits of freq / (2 * ref osc) as a float64_t in the band */
+#define XCVR_LPM_SUM_FRAC_BITS (20U)  /* Fraction bits of int + num in LSBs (2^32 to 2^33) as a float64_t in the band */
+#define XCVR_PLL_MIN_FREQ_HZ (2360000000UL) /* Lowest frequency of the frequency overrides */
+#define XCVR_PLL_MAX_FREQ_HZ (2487000000UL) /* Highest frequency of the frequency overrides */
+#define XCVR_MILLIHZ_PER_HZ (1000U)         /* Resolution of the PLL solver frequencies */
+
+/* Warmup trace hooks of the forced sequences and waits, compiled out when the trace is disabled */
+#if (gXcvrWarmupTrace_d == 1)
+#define XCVR_WU_TRACE_REQUEST(mode) XCVR_WuTraceRequest(mode)
+#define XCVR_WU_TRACE_BEGIN()       XCVR_WuTraceBegin()
+#define XCVR_WU_TRACE_POLL()        (wu_trace.polls++)
+#define XCVR_WU_TRACE_END(mode)     XCVR_WuTraceEnd(mode)
+#else
+#define XCVR_WU_TRACE_REQUEST(mode)
+#define XCVR_WU_TRACE_BEGIN()
+#define XCVR_WU_TRACE_POLL()
+#define XCVR_WU_TRACE_END(mode)
+#endif /* (gXcvrWarmupTrace_d == 1) */
+
+/* PLL sigma delta modulator settings in use, as read from the PLL */
+typedef struct
+{
+    uint32_t integer;     /* Integer */
+    uint32_t numerator;   /* Signed numerator, as stored in the register */
+    uint32_t denominator; /* Denominator */
+    uint32_t sign_bit;    /* Sign bit of the numerator, differs for mapped and unmapped channels */
+} xcvr_pll_sdm_t;
+
+/* Last frequency computed by XCVR_GetFreqCached() */
+typedef struct
+{
+    xcvr_pll_sdm_t sdm; /* PLL settings of freq */
+    uint32_t freq;      /* Frequency in Hz */
+    bool valid;         /* freq has been computed */
+} xcvr_pll_freq_cache_t;
+
+#if (gXcvrWarmupTrace_d == 1)
+/* Warmup trace ring buffer and state of the wait in progress */
+typedef struct
+{
+    xcvr_wu_trace_entry_t entries[XCVR_WU_TRACE_SIZE];
+    uint32_t request_time[gXcvrWuTraceNumModes_c]; /* Time of the last forced request of each sequence */
+    xcvr_timestamp_fptr timestamp_fptr;            /* Time source, NULLPTR to time in wait loop iterations */
+    uint32_t wait_start;                           /* Time of the start of the wait in progress */
+    uint32_t polls;                                /* Loop iterations of the wait in progress */
+    uint16_t next;                                 /* Entry written by the next wait */
+    uint16_t count;                                /* Entries held, up to XCVR_WU_TRACE_SIZE */
+    uint8_t requested;                             /* One bit per sequence with a forced request not waited for yet */
+    uint8_t tsm_count;                             /* TSM_COUNT at the start of the wait in progress */
+} xcvr_wu_trace_t;
+#endif /* (gXcvrWarmupTrace_d == 1) */
+
+/* PLL register contents kept by the hops of XCVR_HopToIndex() */
+typedef struct
+{
+    uint32_t sdm_ctrl1;  /* LPM_SDM_CTRL1 without the integer, manual low port control set */
+    uint32_t ctune_ctrl; /* CTUNE_CTRL without the target, target override set */
+    bool pwrsave_clear;  /* Power save warmup is enabled and must be cleared on each hop */
+    bool active;         /* XCVR_HopTableStart() was called and no override was released since */
+} xcvr_pll_hop_state_t;
 
 /*******************************************************************************
  * Prototypes
@@ -28,6 +94,22 @@
 link_layer_t map_mode_to_ll(radio_mode_t mode);
 uint16_t XCVR_IdentifyRadioVer(uint32_t radio_ver);
 #endif /* !defined(GCOV_DO_COVERAGE) */
+#if defined(NXP_RADIO_GEN) && (NXP_RADIO_GEN >= 450) && (gXcvrRbmeSkipUnchanged_d == 1)
+static uint32_t XCVR_RbmeConfigHash(const xcvr_coding_config_t *rbme);
+#endif /* defined(NXP_RADIO_GEN) && (NXP_RADIO_GEN >= 450) && (gXcvrRbmeSkipUnchanged_d == 1) */
+static void XCVR_CalcLowPortSdm(uint32_t freq, uint32_t *integer, int32_t *numerator);
+static void XCVR_BestFraction(uint64_t value, uint64_t scale, uint32_t *numerator, uint32_t *denominator);
+static void XCVR_WriteLowPortSdm(uint32_t integer, uint32_t numerator, uint32_t denominator, uint32_t ctune_target);
+static xcvrStatus_t XCVR_CheckChannel(uint32_t chan_map, uint8_t channel);
+static uint32_t XCVR_ChanMapOverride(uint32_t chan_map, uint8_t channel);
+static void XCVR_ReadPllSdm(xcvr_pll_sdm_t *sdm);
+static uint32_t XCVR_CalcPllFreq(const xcvr_pll_sdm_t *sdm);
+#if (gXcvrWarmupTrace_d == 1)
+static uint32_t XCVR_WuTraceTime(void);
+static void XCVR_WuTraceRequest(xcvr_wu_trace_mode_t mode);
+static void XCVR_WuTraceBegin(void);
+static void XCVR_WuTraceEnd(xcvr_wu_trace_mode_t mode);
+#endif /* (gXcvrWarmupTrace_d == 1) */
 /*******************************************************************************
  * Variables
  ******************************************************************************/
@@ -42,7 +124,26 @@ uint16_t tx_rx_synth_delay = (uint16_t)TX_RX_SYNTH_init;
 #endif
 #endif /* !defined(RADIO_IS_GEN_4P5) */
 static xcvr_currConfig_t current_xcvr_config;
+static xcvr_pll_freq_cache_t pll_freq_cache = {.valid = false};
+static xcvr_pll_hop_state_t pll_hop_state    = {.active = false};
 static uint8_t default_bb_ldo_fh_tx;
+#if (gXcvrWarmupTrace_d == 1)
+static xcvr_wu_trace_t wu_trace = {.timestamp_fptr = NULLPTR, .next = 0U, .count = 0U, .requested = 0U};
+#endif /* (gXcvrWarmupTrace_d == 1) */
+#if defined(NXP_RADIO_GEN) && (NXP_RADIO_GEN >= 450)
+static const xcvr_config_t *active_xcvr_config        = NULLPTR; /* Config programmed by the last full/delta setup */
+static const xcvr_coding_config_t *active_rbme_config = NULLPTR; /* Coding config programmed by the last setup */
+static uint32_t delta_skipped_writes                  = 0U;      /* Register writes avoided by delta mode changes */
+#if (gXcvrShadowRegCache_d == 1)
+static uint32_t xcvr_shadow_values[XCVR_SHADOW_NUM_REGS];
+static uint32_t xcvr_shadow_valid       = 0U; /* One bit per XCVR_SHADOW_REG_T entry holding a valid copy */
+static uint32_t xcvr_shadow_saved_reads = 0U; /* Register reads served from the shadow copy */
+#endif /* (gXcvrShadowRegCache_d == 1) */
+#if (gXcvrRbmeSkipUnchanged_d == 1)
+static const xcvr_coding_config_t *rbme_programmed_config = NULLPTR; /* Coding config programmed in the RBME block */
+static uint32_t rbme_programmed_hash = 0U; /* Content hash of rbme_programmed_config when it was programmed */
+#endif /* (gXcvrRbmeSkipUnchanged_d == 1) */
+#endif /* defined(NXP_RADIO_GEN) && (NXP_RADIO_GEN >= 450) */
 /*******************************************************************************
  * Code
  *******************************************************************************/
@@ -86,6 +187,10 @@ xcvrStatus_t XCVR_InitNoDacTrim(const xcvr_config_t **xcvr_config, const xcvr_co
             current_xcvr_config.data_rate     = (*xcvr_config)->mode_data_rate_cfg->data_rate;
             current_xcvr_config.alt_data_rate = (*xcvr_config)->mode_data_rate_cfg->alt_data_rate;
             current_xcvr_config.coding_mode   = (*rbme_config)->coding_mode;
+#if defined(NXP_RADIO_GEN) && (NXP_RADIO_GEN >= 450)
+            active_xcvr_config = *xcvr_config;
+            active_rbme_config = *rbme_config;
+#endif /* defined(NXP_RADIO_GEN) && (NXP_RADIO_GEN >= 450) */
         }
     }
 
@@ -94,6 +199,13 @@ xcvrStatus_t XCVR_InitNoDacTrim(const xcvr_config_t **xcvr_config, const xcvr_co
 
 void XCVR_Deinit(void)
 {
+#if defined(NXP_RADIO_GEN) && (NXP_RADIO_GEN >= 450)
+    /* Registers return to reset values so the next delta mode change must be a full setup */
+    active_xcvr_config = NULLPTR;
+    active_rbme_config = NULLPTR;
+    XCVR_InvalidateShadowRegs();
+    XCVR_InvalidateRbmeConfig();
+#endif /* defined(NXP_RADIO_GEN) && (NXP_RADIO_GEN >= 450) */
 #if defined(NXP_RADIO_GEN) && (NXP_RADIO_GEN >= 400)
     /*  Assert Radio Reset */
     RFMC_radio_reset();
@@ -117,8 +229,17 @@ xcvrStatus_t XCVR_RadioRegSetup(const xcvr_config_t **xcvr_config)
     /* check config pointer */
     if (xcvr_config != NULLPTR)
     {
+#if defined(NXP_RADIO_GEN) && (NXP_RADIO_GEN >= 450)
+        /* Every register is rewritten, drop the shadow copies */
+        XCVR_InvalidateShadowRegs();
+#endif /* defined(NXP_RADIO_GEN) && (NXP_RADIO_GEN >= 450) */
+#if defined(NXP_RADIO_GEN) && (NXP_RADIO_GEN >= 450) && (gXcvrTableRegSetup_d == 1)
+        /* Configure Radio registers from the register descriptor table (smaller code than the generated setup) */
+        status = XCVR_RadioGenRegSetupTable(*xcvr_config);
+#else
         /* Configure Radio registers */
         status = XCVR_RadioGenRegSetup(*xcvr_config);
+#endif
     }
     else
     {
@@ -132,11 +253,46 @@ xcvrStatus_t XCVR_RBME_Configure(const xcvr_coding_config_t **rbme)
 {
     xcvrStatus_t status = gXcvrSuccess_c;
 
+#if defined(NXP_RADIO_GEN) && (NXP_RADIO_GEN >= 450) && (gXcvrRbmeSkipUnchanged_d == 1)
+    uint32_t hash;
+#endif /* defined(NXP_RADIO_GEN) && (NXP_RADIO_GEN >= 450) && (gXcvrRbmeSkipUnchanged_d == 1) */
+
     /* check config pointer */
     if (rbme != NULLPTR)
     {
+#if defined(NXP_RADIO_GEN) && (NXP_RADIO_GEN >= 450) && (gXcvrRbmeSkipUnchanged_d == 1)
+        if (*rbme == NULLPTR)
+        {
+            status = gXcvrInvalidConfiguration_c;
+        }
+        else
+        {
+            /* The hashes catch a config modified in place (RAM copy, reloaded blob) since it was programmed */
+            hash = XCVR_RbmeConfigHash(*rbme);
+            if ((rbme_programmed_config == *rbme) && (rbme_programmed_hash == hash))
+            {
+                /* RBME block already holds this config, only DMD_CTRL1 may have been overwritten by a register setup */
+                GEN4PHY->DMD_CTRL1 = (*rbme)->dmd_ctrl1;
+            }
+            else if ((rbme_programmed_config != NULLPTR) && (rbme_programmed_config != *rbme) &&
+                     (XCVR_RbmeConfigHash(rbme_programmed_config) == rbme_programmed_hash))
+            {
+                /* Programmed config is still intact, only write the registers that differ from it */
+                status             = XCVR_RadioGenRBMESetupDelta(rbme_programmed_config, *rbme, NULLPTR);
+                GEN4PHY->DMD_CTRL1 = (*rbme)->dmd_ctrl1;
+            }
+            else
+            {
+                /* Configure RBME registers */
+                status = XCVR_RadioGenRBMESetup(*rbme);
+            }
+            rbme_programmed_config = *rbme;
+            rbme_programmed_hash   = hash;
+        }
+#else
         /* Configure RBME registers */
         status = XCVR_RadioGenRBMESetup(*rbme);
+#endif /* defined(NXP_RADIO_GEN) && (NXP_RADIO_GEN >= 450) && (gXcvrRbmeSkipUnchanged_d == 1) */
     }
     else
     {
@@ -146,6 +302,24 @@ xcvrStatus_t XCVR_RBME_Configure(const xcvr_coding_config_t **rbme)
     return status;
 }
 
+#if defined(NXP_RADIO_GEN) && (NXP_RADIO_GEN >= 450) && (gXcvrRbmeSkipUnchanged_d == 1)
+static uint32_t XCVR_RbmeConfigHash(const xcvr_coding_config_t *rbme)
+{
+    const uint32_t *words = (const uint32_t *)(const void *)rbme;
+    uint32_t hash         = 0x811C9DC5U; /* FNV-1a offset basis */
+    uint32_t i;
+
+    /* FNV-1a over the words of the config, enough to notice a config edited in place */
+    for (i = 0U; i < (uint32_t)(sizeof(xcvr_coding_config_t) / sizeof(uint32_t)); i++)
+    {
+        hash ^= words[i];
+        hash *= 0x01000193U; /* FNV prime */
+    }
+
+    return hash;
+}
+#endif /* defined(NXP_RADIO_GEN) && (NXP_RADIO_GEN >= 450) && (gXcvrRbmeSkipUnchanged_d == 1) */
+
 void XCVR_RadioStartup(void)
 {
 #if defined(NXP_RADIO_GEN) && (NXP_RADIO_GEN >= 400)
@@ -225,6 +399,20 @@ xcvrStatus_t XCVR_Configure(const xcvr_config_t **xcvr_config,
             }
 #endif /* (FPGA_TARGET==0) && (!defined(RADIO_IS_GEN_4P0)) */
         }
+
+#if defined(NXP_RADIO_GEN) && (NXP_RADIO_GEN >= 450)
+        /* Track the programmed configuration so later delta mode changes know the register contents */
+        if (config_status == gXcvrSuccess_c)
+        {
+            active_xcvr_config = *xcvr_config;
+            active_rbme_config = *rbme_config;
+        }
+        else
+        {
+            active_xcvr_config = NULLPTR;
+            active_rbme_config = NULLPTR;
+        }
+#endif /* defined(NXP_RADIO_GEN) && (NXP_RADIO_GEN >= 450) */
     }
     else
     {
@@ -236,6 +424,13 @@ xcvrStatus_t XCVR_Configure(const xcvr_config_t **xcvr_config,
 
 void XCVR_Reset(void)
 {
+#if defined(NXP_RADIO_GEN) && (NXP_RADIO_GEN >= 450)
+    /* Registers return to reset values so the next delta mode change must be a full setup */
+    active_xcvr_config = NULLPTR;
+    active_rbme_config = NULLPTR;
+    XCVR_InvalidateShadowRegs();
+    XCVR_InvalidateRbmeConfig();
+#endif /* defined(NXP_RADIO_GEN) && (NXP_RADIO_GEN >= 450) */
 #if defined(NXP_RADIO_GEN) && (NXP_RADIO_GEN >= 400)
     /* Perform a hardware reset on the radio */
     RFMC_radio_reset();
@@ -281,15 +476,208 @@ xcvrStatus_t XCVR_ChangeMode(const xcvr_config_t **xcvr_config, /* Change from o
         current_xcvr_config.data_rate     = (*xcvr_config)->mode_data_rate_cfg->data_rate;
         current_xcvr_config.alt_data_rate = (*xcvr_config)->mode_data_rate_cfg->alt_data_rate;
         current_xcvr_config.coding_mode   = (*rbme_config)->coding_mode;
+#if defined(NXP_RADIO_GEN) && (NXP_RADIO_GEN >= 450)
+        active_xcvr_config = *xcvr_config;
+        active_rbme_config = *rbme_config;
+#endif /* defined(NXP_RADIO_GEN) && (NXP_RADIO_GEN >= 450) */
 
 #if defined(RADIO_IS_GEN_3P5) /* Gen 4 and later radios don't include DAC trims */
         /* Rewrite  DAC trims that have been over-written (restore from saved DAC trim values) */
         status = XCVR_SetDcocDacTrims(&dac_trims);
 #endif /* defined(RADIO_IS_GEN_3P5) */
     }
+#if defined(NXP_RADIO_GEN) && (NXP_RADIO_GEN >= 450)
+    else
+    {
+        /* Register state is unknown after a partial update, next delta mode change must be a full setup */
+        active_xcvr_config = NULLPTR;
+        active_rbme_config = NULLPTR;
+    }
+#endif /* defined(NXP_RADIO_GEN) && (NXP_RADIO_GEN >= 450) */
+
+    return status;
+}
+
+#if defined(NXP_RADIO_GEN) && (NXP_RADIO_GEN >= 450)
+xcvrStatus_t XCVR_ChangeModeDelta(const xcvr_config_t **xcvr_config, const xcvr_coding_config_t **rbme_config)
+{
+    xcvrStatus_t status   = gXcvrSuccess_c;
+    uint32_t reg_skipped  = 0U;
+    uint32_t rbme_skipped = 0U;
+
+    if ((xcvr_config == NULLPTR) || (rbme_config == NULLPTR))
+    {
+        status = gXcvrInvalidParameters_c;
+    }
+    else if ((active_xcvr_config == NULLPTR) || (active_rbme_config == NULLPTR))
+    {
+        /* No known register state to compare against, fall back to a full register setup */
+        status = XCVR_ChangeMode(xcvr_config, rbme_config);
+    }
+    else
+    {
+#if defined(gXcvrSaveRestoreCoexConfig_d)
+        XCVR_CoexistenceSaveRestoreTimings(0x1U); /* save coex related timings to be restored later */
+#endif
+
+        /* Only program the radio registers whose value changes between the active and the target configuration */
+        XCVR_InvalidateShadowRegs();
+        /* RBME is delta-written against active_rbme_config below, outside of XCVR_RBME_Configure() tracking */
+        XCVR_InvalidateRbmeConfig();
+        status = XCVR_RadioGenRegSetupDelta(active_xcvr_config, *xcvr_config, &reg_skipped);
+
+        /* Sets up RBME only */
+        if (status == gXcvrSuccess_c)
+        {
+            status = XCVR_RadioGenRBMESetupDelta(active_rbme_config, *rbme_config, &rbme_skipped);
+        }
+
+#if defined(gXcvrSaveRestoreCoexConfig_d)
+        XCVR_CoexistenceSaveRestoreTimings(0x0U); /* restore  previously saved coex related timings */
+#endif
+
+        if (status == gXcvrSuccess_c)
+        {
+            delta_skipped_writes += reg_skipped + rbme_skipped;
+
+            current_xcvr_config.radio_mode    = (*xcvr_config)->mode_data_rate_cfg->radio_mode;
+            current_xcvr_config.data_rate     = (*xcvr_config)->mode_data_rate_cfg->data_rate;
+            current_xcvr_config.alt_data_rate = (*xcvr_config)->mode_data_rate_cfg->alt_data_rate;
+            current_xcvr_config.coding_mode   = (*rbme_config)->coding_mode;
+            active_xcvr_config                = *xcvr_config;
+            active_rbme_config                = *rbme_config;
+        }
+        else
+        {
+            /* Register state is unknown after a partial update, next delta mode change must be a full setup */
+            active_xcvr_config = NULLPTR;
+            active_rbme_config = NULLPTR;
+        }
+    }
+
+    return status;
+}
+
+uint32_t XCVR_GetDeltaSkippedWrites(void)
+{
+    return delta_skipped_writes;
+}
+
+void XCVR_ClearDeltaSkippedWrites(void)
+{
+    delta_skipped_writes = 0U;
+}
+
+#if (gXcvrShadowRegCache_d == 1)
+uint32_t XCVR_ShadowRead(XCVR_SHADOW_REG_T idx, volatile const uint32_t *reg)
+{
+    uint32_t value;
+    uint32_t mask = 1UL << (uint32_t)idx;
+
+    if ((xcvr_shadow_valid & mask) != 0U)
+    {
+        value = xcvr_shadow_values[idx];
+        xcvr_shadow_saved_reads++;
+    }
+    else
+    {
+        value                   = *reg;
+        xcvr_shadow_values[idx] = value;
+        xcvr_shadow_valid |= mask;
+    }
+
+    return value;
+}
+
+void XCVR_ShadowWrite(XCVR_SHADOW_REG_T idx, volatile uint32_t *reg, uint32_t value)
+{
+    *reg                    = value;
+    xcvr_shadow_values[idx] = value;
+    xcvr_shadow_valid |= 1UL << (uint32_t)idx;
+}
+#endif /* (gXcvrShadowRegCache_d == 1) */
+
+void XCVR_InvalidateShadowRegs(void)
+{
+#if (gXcvrShadowRegCache_d == 1)
+    xcvr_shadow_valid = 0U;
+#endif /* (gXcvrShadowRegCache_d == 1) */
+}
+
+uint32_t XCVR_GetShadowSavedReads(void)
+{
+    uint32_t saved_reads = 0U;
+
+#if (gXcvrShadowRegCache_d == 1)
+    saved_reads = xcvr_shadow_saved_reads;
+#endif /* (gXcvrShadowRegCache_d == 1) */
+
+    return saved_reads;
+}
+
+void XCVR_ClearShadowSavedReads(void)
+{
+#if (gXcvrShadowRegCache_d == 1)
+    xcvr_shadow_saved_reads = 0U;
+#endif /* (gXcvrShadowRegCache_d == 1) */
+}
+
+void XCVR_InvalidateRbmeConfig(void)
+{
+#if (gXcvrRbmeSkipUnchanged_d == 1)
+    rbme_programmed_config = NULLPTR;
+#endif /* (gXcvrRbmeSkipUnchanged_d == 1) */
+}
+
+xcvrStatus_t XCVR_ChangeModeFolded(const xcvr_folded_config_t *folded_config,
+                                   const xcvr_coding_config_t **rbme_config)
+{
+    xcvrStatus_t status = gXcvrSuccess_c;
+
+    if ((folded_config == NULLPTR) || (folded_config->config == NULLPTR) || (rbme_config == NULLPTR))
+    {
+        status = gXcvrInvalidParameters_c;
+    }
+    else
+    {
+#if defined(gXcvrSaveRestoreCoexConfig_d)
+        XCVR_CoexistenceSaveRestoreTimings(0x1U); /* save coex related timings to be restored later */
+#endif
+
+        /* Copy the pre-merged register values, no per field merging needed */
+        XCVR_InvalidateShadowRegs();
+        status = XCVR_RadioGenRegSetupFolded(folded_config);
+
+        /* Sets up RBME only */
+        if (status == gXcvrSuccess_c)
+        {
+            status = XCVR_RBME_Configure(rbme_config);
+        }
+
+#if defined(gXcvrSaveRestoreCoexConfig_d)
+        XCVR_CoexistenceSaveRestoreTimings(0x0U); /* restore  previously saved coex related timings */
+#endif
+
+        if (status == gXcvrSuccess_c)
+        {
+            current_xcvr_config.radio_mode    = folded_config->config->mode_data_rate_cfg->radio_mode;
+            current_xcvr_config.data_rate     = folded_config->config->mode_data_rate_cfg->data_rate;
+            current_xcvr_config.alt_data_rate = folded_config->config->mode_data_rate_cfg->alt_data_rate;
+            current_xcvr_config.coding_mode   = (*rbme_config)->coding_mode;
+            active_xcvr_config                = folded_config->config;
+            active_rbme_config                = *rbme_config;
+        }
+        else
+        {
+            /* Register state is unknown after a partial update, next delta mode change must be a full setup */
+            active_xcvr_config = NULLPTR;
+            active_rbme_config = NULLPTR;
+        }
+    }
 
     return status;
 }
+#endif /* defined(NXP_RADIO_GEN) && (NXP_RADIO_GEN >= 450) */
 
 void XCVR_GetCRCWConfig(rbme_crc_config_t *crc_config, rbme_whiten_config_t *whiten_config)
 {
@@ -313,6 +701,10 @@ void XCVR_GetCRCWConfig(rbme_crc_config_t *crc_config, rbme_whiten_config_t *whi
 
 void XCVR_SetCRCWConfig(const rbme_crc_config_t *crc_config, const rbme_whiten_config_t *whiten_config)
 {
+#if defined(NXP_RADIO_GEN) && (NXP_RADIO_GEN >= 450)
+    /* RBME registers no longer match the programmed coding config */
+    XCVR_InvalidateRbmeConfig();
+#endif /* defined(NXP_RADIO_GEN) && (NXP_RADIO_GEN >= 450) */
     if (crc_config != NULLPTR) /* if the pointer is NULLPTR then don't set the CRC configuration */
     {
         RBME->CRCW_CFG  = crc_config->crcw_cfg;
@@ -337,16 +729,16 @@ void XCVR_EnaNBRSSIMeas(bool IIRnbEnable)
     /* On Gen4p0, narrow band and wide band are two separated block working in parallel */
     if (IIRnbEnable)
     {
-        XCVR_RX_DIG->RSSI_GLOBAL_CTRL |=
-            XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_RSSI_EN_MASK; /* just enable the narrowband RSSI */
+        /* just enable the narrowband RSSI */
+        XCVR_SHADOW_SET(RX_DIG_RSSI_GLOBAL_CTRL, XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_RSSI_EN_MASK);
         XCVR_RX_DIG->AGC_CTRL_STAT |=
             XCVR_RX_DIG_AGC_CTRL_STAT_AGC_CALC_MAG_IN_FRZ_MASK; /* enables magnitude calculation during AGC FREEZE
                                                                    otherwise RSSI_NB doesn't work. */
     }
     else
     {
-        XCVR_RX_DIG->RSSI_GLOBAL_CTRL &=
-            ~(XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_RSSI_EN_MASK); /* just disable the narrowband RSSI */
+        /* just disable the narrowband RSSI */
+        XCVR_SHADOW_CLR(RX_DIG_RSSI_GLOBAL_CTRL, XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_RSSI_EN_MASK);
         XCVR_RX_DIG->AGC_CTRL_STAT &=
             ~(XCVR_RX_DIG_AGC_CTRL_STAT_AGC_CALC_MAG_IN_FRZ_MASK); /* disables magnitude calculation during AGC FREEZE
                                                                       when RSSI_NB is disabled. */
@@ -946,7 +1338,7 @@ int16_t XCVR_GetInstantRssi(void)
     int16_t i16Rssi;
     uint32_t t1, t2, t3;
     t1 = XCVR_2P4GHZ_PHY->FSK_CFG0;
-    t2 = XCVR_RX_DIG->RSSI_GLOBAL_CTRL;
+    t2 = XCVR_SHADOW_RD(RX_DIG_RSSI_GLOBAL_CTRL);
     t3 = XCVR_2P4GHZ_PHY->FSK_PD_CFG2;
     /* Select Narrowband RSSI measurement */
     XCVR_EnaNBRSSIMeas(true); /* Enable Narrowband RSSI measurement */
@@ -956,10 +1348,10 @@ int16_t XCVR_GetInstantRssi(void)
         GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_1M_MASK | GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_2M_MASK;
 
     /* Put RSSI NB into continuous mode */
-    XCVR_RX_DIG->RSSI_GLOBAL_CTRL &= ~(XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_RSSI_AA_MATCH_OVRD_MASK);
-    XCVR_RX_DIG->RSSI_GLOBAL_CTRL |= XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_RSSI_AA_MATCH_OVRD_EN_MASK |
-                                     XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_CONT_MEAS_OVRD_EN_MASK |
-                                     XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_CONT_MEAS_OVRD_MASK;
+    XCVR_SHADOW_CLR(RX_DIG_RSSI_GLOBAL_CTRL, XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_RSSI_AA_MATCH_OVRD_MASK);
+    XCVR_SHADOW_SET(RX_DIG_RSSI_GLOBAL_CTRL, XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_RSSI_AA_MATCH_OVRD_EN_MASK |
+                                             XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_CONT_MEAS_OVRD_EN_MASK |
+                                             XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_CONT_MEAS_OVRD_MASK);
 
     /* Start RX andWait for end of warmup to get valid RSSI */
     XCVR_ForceRxWu();
@@ -968,15 +1360,15 @@ int16_t XCVR_GetInstantRssi(void)
     /* Wait for NB RSSI measurement complete assertion and sign extend the result to 16 bits */
     i16Rssi = XCVR_GetRssiResult();
 
-    XCVR_RX_DIG->RSSI_GLOBAL_CTRL &=
-        ~(XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_RSSI_AA_MATCH_OVRD_MASK |
-          XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_RSSI_AA_MATCH_OVRD_EN_MASK |
-          XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_CONT_MEAS_OVRD_EN_MASK | XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_CONT_MEAS_OVRD_MASK);
+    XCVR_SHADOW_CLR(RX_DIG_RSSI_GLOBAL_CTRL, XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_RSSI_AA_MATCH_OVRD_MASK |
+                                             XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_RSSI_AA_MATCH_OVRD_EN_MASK |
+                                             XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_CONT_MEAS_OVRD_EN_MASK |
+                                             XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_CONT_MEAS_OVRD_MASK);
     XCVR_ForceRxWd();
 
     /* Restore corrupted registers */
     XCVR_2P4GHZ_PHY->FSK_CFG0 = t1; 
-    XCVR_RX_DIG->RSSI_GLOBAL_CTRL = t2;
+    XCVR_SHADOW_WR(RX_DIG_RSSI_GLOBAL_CTRL, t2);
     XCVR_2P4GHZ_PHY->FSK_PD_CFG2  = t3;
 
     return i16Rssi;
@@ -987,27 +1379,27 @@ int16_t XCVR_GetRssiResult(void)
     uint16_t rssi_result = 0U;
 
 #if defined(NXP_RADIO_GEN) && (NXP_RADIO_GEN >= 450)  
-    if ((XCVR_RX_DIG->RSSI_GLOBAL_CTRL & XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_RSSI_AA_MATCH_OVRD_EN_MASK) != 0U)
+    if ((XCVR_SHADOW_RD(RX_DIG_RSSI_GLOBAL_CTRL) & XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_RSSI_AA_MATCH_OVRD_EN_MASK) != 0U)
     {
         /* Trigger the start of a narrowband measurement */
-        XCVR_RX_DIG->RSSI_GLOBAL_CTRL |= (XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_CONT_MEAS_OVRD_EN_MASK |
-                                          XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_CONT_MEAS_OVRD_MASK);
-        XCVR_RX_DIG->RSSI_GLOBAL_CTRL |= XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_RSSI_AA_MATCH_OVRD_MASK;
+        XCVR_SHADOW_SET(RX_DIG_RSSI_GLOBAL_CTRL, XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_CONT_MEAS_OVRD_EN_MASK |
+                                                 XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_CONT_MEAS_OVRD_MASK);
+        XCVR_SHADOW_SET(RX_DIG_RSSI_GLOBAL_CTRL, XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_RSSI_AA_MATCH_OVRD_MASK);
         while ((XCVR_RX_DIG->NB_RSSI_RES0 & XCVR_RX_DIG_NB_RSSI_RES0_RSSI_RDY_NB_MASK) ==
                0U) /* Poll RSSI_RDY_NB bit until 1 */
         {
         } /* Wait for completion */
 
         /* clear bits: */
-        XCVR_RX_DIG->RSSI_GLOBAL_CTRL &= ~(XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_RSSI_AA_MATCH_OVRD_MASK);
-        XCVR_RX_DIG->RSSI_GLOBAL_CTRL &= ~(XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_CONT_MEAS_OVRD_EN_MASK |
-                                           XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_CONT_MEAS_OVRD_MASK);
+        XCVR_SHADOW_CLR(RX_DIG_RSSI_GLOBAL_CTRL, XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_RSSI_AA_MATCH_OVRD_MASK);
+        XCVR_SHADOW_CLR(RX_DIG_RSSI_GLOBAL_CTRL, XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_CONT_MEAS_OVRD_EN_MASK |
+                                                 XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_CONT_MEAS_OVRD_MASK);
 
         XCVR_RX_DIG->NB_RSSI_RES0 |= XCVR_RX_DIG_NB_RSSI_RES0_RSSI_RDY_NB_MASK; // clear rdy status by writting 1
     }
 #else
     /* Trigger the start of a narrowband measurement */
-    XCVR_RX_DIG->RSSI_GLOBAL_CTRL |= XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_RSSI_AA_MATCH_OVRD_MASK;
+    XCVR_SHADOW_SET(RX_DIG_RSSI_GLOBAL_CTRL, XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_RSSI_AA_MATCH_OVRD_MASK);
     while ((XCVR_RX_DIG->NB_RSSI_RES1 & XCVR_RX_DIG_NB_RSSI_RES1_MEAS_COMPLETE_NB_MASK) ==
            0U) /* Measurement complete is clear */
     {
@@ -1023,6 +1415,109 @@ int16_t XCVR_GetRssiResult(void)
     return (int16_t)rssi_result;
 }
 
+#if defined(NXP_RADIO_GEN) && (NXP_RADIO_GEN >= 450)
+xcvrStatus_t XCVR_EdScan(const uint8_t *channels,
+                         uint16_t num_channels,
+                         xcvr_timestamp_fptr timestamp_fptr,
+                         xcvr_ed_scan_t *scan)
+{
+    xcvrStatus_t status = gXcvrSuccess_c;
+    uint32_t chan_map;
+    uint32_t next_chan_map;
+    uint32_t scan_start;
+    uint32_t chan_start;
+    uint32_t elapsed;
+    uint32_t t1, t2, t3;
+    uint16_t rssi_result;
+    int16_t rssi;
+    uint16_t i;
+
+    if ((channels == NULLPTR) || (scan == NULLPTR) || (num_channels == 0U) ||
+        (num_channels > XCVR_ED_SCAN_MAX_CHANNELS))
+    {
+        status = gXcvrInvalidParameters_c;
+    }
+    else
+    {
+        /* All channels are checked before the radio is started */
+        chan_map = XCVR_PLL_DIG->CHAN_MAP;
+        for (i = 0U; (i < num_channels) && (status == gXcvrSuccess_c); i++)
+        {
+            status = XCVR_CheckChannel(chan_map, channels[i]);
+        }
+    }
+
+    if (status == gXcvrSuccess_c)
+    {
+        scan_start = (timestamp_fptr != NULLPTR) ? timestamp_fptr() : 0U;
+        t1         = XCVR_2P4GHZ_PHY->FSK_CFG0;
+        t2         = XCVR_SHADOW_RD(RX_DIG_RSSI_GLOBAL_CTRL);
+        t3         = XCVR_2P4GHZ_PHY->FSK_PD_CFG2;
+
+        /* Same RSSI setup as XCVR_GetInstantRssi(), once for all channels */
+        XCVR_EnaNBRSSIMeas(true);
+        XCVR_2P4GHZ_PHY->FSK_CFG0 =
+            GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_1M_MASK | GEN4PHY_FSK_CFG0_AA_ACQ_1_2_3_THRESH_2M_MASK;
+        XCVR_SHADOW_CLR(RX_DIG_RSSI_GLOBAL_CTRL, XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_RSSI_AA_MATCH_OVRD_MASK);
+        XCVR_SHADOW_SET(RX_DIG_RSSI_GLOBAL_CTRL, XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_RSSI_AA_MATCH_OVRD_EN_MASK);
+
+        next_chan_map          = XCVR_ChanMapOverride(chan_map, channels[0]);
+        XCVR_PLL_DIG->CHAN_MAP = next_chan_map;
+        for (i = 0U; i < num_channels; i++)
+        {
+            chan_start = (timestamp_fptr != NULLPTR) ? timestamp_fptr() : 0U;
+            XCVR_ForceRxWu();
+            XCVR_WaitRxWu();
+
+            /* Trigger the measurement as XCVR_GetRssiResult() does, and prepare the next channel meanwhile */
+            XCVR_SHADOW_SET(RX_DIG_RSSI_GLOBAL_CTRL, XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_CONT_MEAS_OVRD_EN_MASK |
+                                                     XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_CONT_MEAS_OVRD_MASK);
+            XCVR_SHADOW_SET(RX_DIG_RSSI_GLOBAL_CTRL, XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_RSSI_AA_MATCH_OVRD_MASK);
+            if ((i + 1U) < num_channels)
+            {
+                next_chan_map = XCVR_ChanMapOverride(chan_map, channels[i + 1U]);
+            }
+            while ((XCVR_RX_DIG->NB_RSSI_RES0 & XCVR_RX_DIG_NB_RSSI_RES0_RSSI_RDY_NB_MASK) == 0U)
+            {
+            } /* Wait for completion */
+            XCVR_SHADOW_CLR(RX_DIG_RSSI_GLOBAL_CTRL, XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_RSSI_AA_MATCH_OVRD_MASK |
+                                                     XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_CONT_MEAS_OVRD_EN_MASK |
+                                                     XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_CONT_MEAS_OVRD_MASK);
+            rssi_result = (uint16_t)((XCVR_RX_DIG->NB_RSSI_RES0 & XCVR_RX_DIG_NB_RSSI_RES0_RSSI_NB_MASK) >>
+                                     XCVR_RX_DIG_NB_RSSI_RES0_RSSI_NB_SHIFT);
+            XCVR_RX_DIG->NB_RSSI_RES0 |= XCVR_RX_DIG_NB_RSSI_RES0_RSSI_RDY_NB_MASK; /* Clear rdy status by writing 1 */
+
+            /* The next channel is programmed while this one warms down */
+            XCVR_ForceRxWd();
+            if ((i + 1U) < num_channels)
+            {
+                XCVR_PLL_DIG->CHAN_MAP = next_chan_map;
+            }
+
+            /* Sign extend from 9 to 16 bits and saturate to 8 bits while the warmdown completes */
+            rssi_result |= (((rssi_result & 0x0100U) == 0x0100U) ? 0xFE00U : 0x0U);
+            rssi            = (int16_t)rssi_result;
+            rssi            = (rssi > 127) ? 127 : ((rssi < -128) ? -128 : rssi);
+            scan->ed_dbm[i] = (int8_t)rssi;
+            XCVR_WaitRxTxWd();
+
+            elapsed            = (timestamp_fptr != NULLPTR) ? (timestamp_fptr() - chan_start) : 0U;
+            scan->chan_time[i] = (elapsed > 0xFFFFU) ? 0xFFFFU : (uint16_t)elapsed;
+        }
+
+        /* Restore the registers changed by the scan */
+        XCVR_PLL_DIG->CHAN_MAP    = chan_map;
+        XCVR_2P4GHZ_PHY->FSK_CFG0 = t1;
+        XCVR_SHADOW_WR(RX_DIG_RSSI_GLOBAL_CTRL, t2);
+        XCVR_2P4GHZ_PHY->FSK_PD_CFG2 = t3;
+        scan->num_channels           = num_channels;
+        scan->total_time             = (timestamp_fptr != NULLPTR) ? (timestamp_fptr() - scan_start) : 0U;
+    }
+
+    return status;
+}
+#endif /* defined(NXP_RADIO_GEN) && (NXP_RADIO_GEN >= 450) */
+
 #else
 int8_t XCVR_GetInstantRssi(void)
 {
@@ -1100,138 +1595,334 @@ int8_t XCVR_GetInstantRssi(void)
 }
 #endif /* defined(RADIO_IS_GEN_4P0) */
 
-/* ************************ */
-/* Radio debug functions */
-/* ************************ */
-/* The same function is used for Gen 3.5 RX/TX frequency override and Gen4.0/4.5 TX (only) frequency override */
-#if !defined(RADIO_IS_GEN_3P5) /* Gen 4 and later radios use low IF receivers and need custom override for RX and TX \
-                                */
-xcvrStatus_t XCVR_OverrideTxFrequency(uint32_t freq)
-#else
-xcvrStatus_t XCVR_OverrideFrequency(uint32_t freq)
-#endif /* !defined(RADIO_IS_GEN_3P5)*/
+/*
+ * Low Port integer and numerator of a frequency, with XCVR_LPM_SDM_DENOM as denominator, in integer arithmetic only.
+ * The numerator used to be computed in float64_t as round(((freq / (2 * ref osc)) - integer) * denominator) with
+ * intermediate roundings that move it by one LSB from the exact value for a few frequencies close to a rounding tie.
+ * The same roundings are reproduced here so that the result is identical over the 2360-2487MHz band:
+ * - the quotient freq / (2 * ref osc) is rounded to nearest even with XCVR_LPM_QUOT_FRAC_BITS fraction bits,
+ * - the numerator is rounded to XCVR_LPM_SUM_FRAC_BITS fraction bits when added to the integer (int + num LSBs are
+ *   in [2^32, 2^33) in the band), which becomes a bias of half of that resolution before the final round half away
+ *   from zero.
+ * tools/xcvr_sdm_sweep.c checks the programmed registers against the float64_t computation for every whole Hz.
+ */
+static void XCVR_CalcLowPortSdm(uint32_t freq, uint32_t *integer, int32_t *numerator)
 {
-    xcvrStatus_t status = gXcvrSuccess_c;
-#if RF_OSC_26MHZ == 1
-    const uint32_t refOsc = 26000000;
-#else
-    const uint32_t refOsc = 32000000;
-#endif                                               /* RF_OSC_26MHZ == 1 */
-    const uint32_t denominator = 0x08000000UL - 1UL; /* Configure the PLL Denominator to the max for best resolution */
-    const float64_t sdm_lsb    = (float64_t)refOsc / (((float64_t)denominator) / 2.0F);
+    const uint32_t ref_clk2x = 2UL * XCVR_REF_OSC_HZ;
+    uint32_t integer_to_use  = freq / ref_clk2x;
+    uint32_t remainder       = freq % ref_clk2x;
+    uint32_t offset; /* Distance from freq to integer_to_use * ref_clk2x in Hz */
+    bool below;      /* freq is below integer_to_use * ref_clk2x */
+    uint64_t temp;
+    uint64_t quot_frac; /* offset / ref_clk2x with XCVR_LPM_QUOT_FRAC_BITS fraction bits */
+    uint64_t num_lsb;   /* quot_frac * denominator + rounding biases, XCVR_LPM_QUOT_FRAC_BITS - 32 fraction bits */
+    uint32_t num_abs;
 
-    /* Check the input frequency */
-    if ((freq < 2360000000UL) || (freq > 2487000000UL))
+    /* Nearest integer, a fraction of exactly one half stays on the lower integer */
+    if (remainder > XCVR_REF_OSC_HZ)
     {
-        status = gXcvrInvalidParameters_c;
+        integer_to_use++;
+        offset = ref_clk2x - remainder;
+        below  = true;
     }
     else
     {
-        /* Override the frequency setting in the PLL */
-        float64_t integer_used_in_Hz, integer_used_in_LSB, numerator_fraction, numerator_in_Hz, numerator_in_LSB,
-            numerator_unrounded, real_int_and_fraction, real_fraction, requested_freq_in_LSB;
-        uint32_t temp;
-        static uint32_t integer_truncated, integer_to_use;
-        static int32_t numerator_rounded;
+        offset = remainder;
+        below  = false;
+    }
 
-        /* Write the Low Port Denomintor value */
-        XCVR_PLL_DIG->LPM_SDM_CTRL3 = denominator;
+    /* Long division of offset * 2^47 by ref_clk2x in two steps of 23 and 24 bits to stay within 64 bits */
+    temp      = (uint64_t)offset << 23U;
+    quot_frac = (temp / ref_clk2x) << 24U;
+    temp      = (temp % ref_clk2x) << 24U;
+    quot_frac += temp / ref_clk2x;
+    temp = (temp % ref_clk2x) << 1U; /* Twice the remainder, compared with the divisor for round to nearest even */
+    if ((temp > ref_clk2x) || ((temp == ref_clk2x) && ((quot_frac & 1U) != 0U)))
+    {
+        quot_frac++;
+    }
 
-        /* Configure for Coarse Tune */
-        uint32_t coarse_tune_target = freq / 1000000UL;
-        temp                        = XCVR_PLL_DIG->CTUNE_CTRL;
-        temp &= ~(XCVR_PLL_DIG_CTUNE_CTRL_CTUNE_TARGET_MANUAL_MASK);
-        temp |= XCVR_PLL_DIG_CTUNE_CTRL_CTUNE_TARGET_MANUAL(coarse_tune_target) |
-                XCVR_PLL_DIG_CTUNE_CTRL_CTUNE_TARGET_DISABLE_MASK;
-        XCVR_PLL_DIG->CTUNE_CTRL = temp;
+    /*
+     * floor((quot_frac * denominator + 2^46 + 2^26) / 2^47): the rounding biases of one half LSB and of half of the
+     * sum resolution are added, the 73 bit product is split in two 32 bit halves of quot_frac.
+     */
+    num_lsb = ((quot_frac & 0xFFFFFFFFU) * XCVR_LPM_SDM_DENOM) + (1ULL << (XCVR_LPM_QUOT_FRAC_BITS - 1U)) +
+              (1ULL << (XCVR_LPM_QUOT_FRAC_BITS - XCVR_LPM_SUM_FRAC_BITS - 1U));
+    num_lsb = ((quot_frac >> 32U) * XCVR_LPM_SDM_DENOM) + (num_lsb >> 32U);
+    num_abs = (uint32_t)(num_lsb >> (XCVR_LPM_QUOT_FRAC_BITS - 32U));
 
-        /* Calculate the Low Port values */
-        real_int_and_fraction = (float64_t)freq / ((float64_t)refOsc * 2.0F);
-        integer_truncated     = (uint32_t)trunc(real_int_and_fraction);
-        real_fraction         = real_int_and_fraction - (float64_t)integer_truncated;
+    *integer   = integer_to_use;
+    *numerator = below ? -(int32_t)num_abs : (int32_t)num_abs;
+}
 
-        if (real_fraction > 0.5F)
+/*
+ * Closest fraction numerator / denominator to value / scale, for value <= scale / 2 < 2^36, with a denominator of at
+ * most XCVR_LPM_SDM_DENOM. The continued fraction expansion of value / scale is followed up to the last convergent
+ * within the denominator limit, which is then compared with the largest semiconvergent within the limit (the best
+ * rational approximation is one of the two). The fraction is finally scaled to the largest denominator within the
+ * limit, so that the modulator runs with a denominator of the same magnitude as for the other frequency overrides.
+ */
+static void XCVR_BestFraction(uint64_t value, uint64_t scale, uint32_t *numerator, uint32_t *denominator)
+{
+    uint64_t p0 = 0U; /* Convergent before the last one */
+    uint64_t q0 = 1U;
+    uint64_t p1 = 1U; /* Last convergent */
+    uint64_t q1 = 0U;
+    uint64_t p2;
+    uint64_t q2;
+    uint64_t n = value; /* Remainders of the expansion */
+    uint64_t d = scale;
+    uint64_t a;
+    uint64_t k;
+    uint64_t err1;
+    uint64_t err2;
+    bool limit_reached = false;
+
+    while ((d != 0U) && !limit_reached)
+    {
+        a = n / d;
+        if ((q1 != 0U) && (a > ((XCVR_LPM_SDM_DENOM - q0) / q1)))
         {
-            integer_to_use = integer_truncated + 1U;
+            limit_reached = true;
         }
         else
         {
-            integer_to_use = integer_truncated;
+            p2 = p0 + (a * p1);
+            q2 = q0 + (a * q1);
+            p0 = p1;
+            q0 = q1;
+            p1 = p2;
+            q1 = q2;
+            p2 = n - (a * d);
+            n  = d;
+            d  = p2;
         }
+    }
 
-        numerator_fraction = real_int_and_fraction - (float64_t)integer_to_use; /* Fractional portion of numerator */
+    if (limit_reached)
+    {
+        /* Largest semiconvergent within the limit, kept if closer: |p2 * scale - value * q2| / q2 is its distance */
+        k    = (XCVR_LPM_SDM_DENOM - q0) / q1;
+        p2   = p0 + (k * p1);
+        q2   = q0 + (k * q1);
+        err1 = (p1 * scale > value * q1) ? ((p1 * scale) - (value * q1)) : ((value * q1) - (p1 * scale));
+        err2 = (p2 * scale > value * q2) ? ((p2 * scale) - (value * q2)) : ((value * q2) - (p2 * scale));
+        if ((err2 * q1) < (err1 * q2))
+        {
+            p1 = p2;
+            q1 = q2;
+        }
+    }
 
-        integer_used_in_Hz  = (float64_t)integer_to_use * (float64_t)refOsc * 2.0F;
-        integer_used_in_LSB = integer_used_in_Hz / sdm_lsb;
+    /* Same fraction with the largest denominator within the limit */
+    k            = XCVR_LPM_SDM_DENOM / q1;
+    *numerator   = (uint32_t)(p1 * k);
+    *denominator = (uint32_t)(q1 * k);
+}
 
-        numerator_in_Hz  = numerator_fraction * (float64_t)refOsc * 2.0F;
-        numerator_in_LSB = numerator_in_Hz / sdm_lsb;
+/* Low Port settings of a frequency override, the coarse tune target is in MHz */
+static void XCVR_WriteLowPortSdm(uint32_t integer, uint32_t numerator, uint32_t denominator, uint32_t ctune_target)
+{
+    uint32_t temp;
 
-        requested_freq_in_LSB = integer_used_in_LSB + numerator_in_LSB;
-        numerator_unrounded   = (requested_freq_in_LSB - integer_used_in_LSB);
-        numerator_rounded     = (int32_t)round(numerator_unrounded);
+    /* Write the Low Port Denomintor value */
+    XCVR_PLL_DIG->LPM_SDM_CTRL3 = denominator;
 
-        /* Write the Low Port Integer and Numerator */
-        temp = XCVR_PLL_DIG->LPM_SDM_CTRL1;
-        temp &= ~XCVR_PLL_DIG_LPM_SDM_CTRL1_LPM_INTG_MASK;
-        temp |= (XCVR_PLL_DIG_LPM_SDM_CTRL1_LPM_INTG(integer_to_use) | XCVR_PLL_DIG_LPM_SDM_CTRL1_SDM_MAP_DISABLE_MASK);
-        XCVR_PLL_DIG->LPM_SDM_CTRL1 = temp;
-        XCVR_PLL_DIG->LPM_SDM_CTRL2 =
-            (uint32_t)numerator_rounded; /* putting the signed quantity into a 32 bit (unsigned) register */
+    /* Configure for Coarse Tune */
+    temp = XCVR_PLL_DIG->CTUNE_CTRL;
+    temp &= ~(XCVR_PLL_DIG_CTUNE_CTRL_CTUNE_TARGET_MANUAL_MASK);
+    temp |= XCVR_PLL_DIG_CTUNE_CTRL_CTUNE_TARGET_MANUAL(ctune_target) |
+            XCVR_PLL_DIG_CTUNE_CTRL_CTUNE_TARGET_DISABLE_MASK;
+    XCVR_PLL_DIG->CTUNE_CTRL = temp;
 
-        /* Ensure that the TSM does not allow Fast warmup */
-        XCVR_TSM->FAST_CTRL1 |= XCVR_TSM_FAST_CTRL1_PWRSAVE_WU_CLEAR_MASK; /* Must assert the bit first */
-        XCVR_TSM->FAST_CTRL1 &=
-            ~(XCVR_TSM_FAST_CTRL1_PWRSAVE_WU_CLEAR_MASK); /* then deasert the bit manually (it is not self clearing) */
-    }
+    /* Write the Low Port Integer and Numerator */
+    temp = XCVR_PLL_DIG->LPM_SDM_CTRL1;
+    temp &= ~XCVR_PLL_DIG_LPM_SDM_CTRL1_LPM_INTG_MASK;
+    temp |= (XCVR_PLL_DIG_LPM_SDM_CTRL1_LPM_INTG(integer) | XCVR_PLL_DIG_LPM_SDM_CTRL1_SDM_MAP_DISABLE_MASK);
+    XCVR_PLL_DIG->LPM_SDM_CTRL1 = temp;
+    XCVR_PLL_DIG->LPM_SDM_CTRL2 = numerator; /* signed quantity in a 32 bit (unsigned) register */
 
-    return status;
+    /* Ensure that the TSM does not allow Fast warmup */
+    XCVR_TSM->FAST_CTRL1 |= XCVR_TSM_FAST_CTRL1_PWRSAVE_WU_CLEAR_MASK; /* Must assert the bit first */
+    XCVR_TSM->FAST_CTRL1 &=
+        ~(XCVR_TSM_FAST_CTRL1_PWRSAVE_WU_CLEAR_MASK); /* then deasert the bit manually (it is not self clearing) */
 }
 
+/* ************************ */
+/* Radio debug functions */
+/* ************************ */
+/* The same function is used for Gen 3.5 RX/TX frequency override and Gen4.0/4.5 TX (only) frequency override */
 #if !defined(RADIO_IS_GEN_3P5) /* Gen 4 and later radios use low IF receivers and need custom override for RX and TX \
                                 */
-xcvrStatus_t XCVR_OverrideRxFrequency(uint32_t freq, int32_t offset_freq)
+xcvrStatus_t XCVR_OverrideTxFrequency(uint32_t freq)
+#else
+xcvrStatus_t XCVR_OverrideFrequency(uint32_t freq)
+#endif /* !defined(RADIO_IS_GEN_3P5)*/
 {
     xcvrStatus_t status = gXcvrSuccess_c;
-    /* Input frequency is checked in the XCVR_OverrideTxFrequency() routine called below */
-    /* Check the offset frequency */
-    if ((offset_freq < -10000000L) || (offset_freq > 10000000L) || (offset_freq == 0L))
+
+    /* Check the input frequency */
+    if ((freq < XCVR_PLL_MIN_FREQ_HZ) || (freq > XCVR_PLL_MAX_FREQ_HZ))
     {
         status = gXcvrInvalidParameters_c;
     }
     else
     {
-        /* Calculate the correct target frequency */
-        /* Offset generally should be equal to the IF frequency (1MHz or 1.5MHz) but may be much larger for special
-         * localization cases */
-        uint32_t temp_offset = (uint32_t)((offset_freq < 0L) ? -offset_freq : offset_freq);
-        uint32_t target_freq = ((offset_freq < 0L) ? (freq - temp_offset) : (freq + temp_offset));
+        /* Override the frequency setting in the PLL */
+        uint32_t integer_to_use;
+        int32_t numerator_rounded;
 
-        /* Use XCVR_OverrideTXFrequency to program the new target frequency */
-        status = XCVR_OverrideTxFrequency(target_freq);
+        /* Calculate the Low Port values */
+        XCVR_CalcLowPortSdm(freq, &integer_to_use, &numerator_rounded);
+
+        XCVR_WriteLowPortSdm(integer_to_use, (uint32_t)numerator_rounded, XCVR_LPM_SDM_DENOM, freq / 1000000UL);
     }
 
     return status;
 }
-#endif /* !defined(RADIO_IS_GEN_3P5)*/
 
-xcvrStatus_t XCVR_OverrideCustomChannel(const xcvr_pllChannel_t *customChannel)
+xcvrStatus_t XCVR_SolvePllFrequency(uint64_t freq_millihz, xcvr_pll_solution_t *solution)
 {
-    xcvrStatus_t status = gXcvrSuccess_c;
-    uint32_t temp;
+    xcvrStatus_t status  = gXcvrSuccess_c;
+    const uint64_t scale = 2ULL * XCVR_REF_OSC_HZ * XCVR_MILLIHZ_PER_HZ; /* One integer step in mHz */
+    uint64_t remainder;
+    uint64_t offset; /* Distance from freq_millihz to integer * scale */
+    uint32_t integer;
+    uint32_t numerator;
+    uint32_t denominator;
+    int64_t error; /* Synthesized minus requested frequency, in mHz times the denominator */
+    bool below;    /* freq_millihz is below integer * scale */
 
-    if (customChannel == NULLPTR)
+    if ((solution == NULLPTR) || (freq_millihz < ((uint64_t)XCVR_PLL_MIN_FREQ_HZ * XCVR_MILLIHZ_PER_HZ)) ||
+        (freq_millihz > ((uint64_t)XCVR_PLL_MAX_FREQ_HZ * XCVR_MILLIHZ_PER_HZ)))
     {
         status = gXcvrInvalidParameters_c;
-        ;
     }
     else
     {
-        /* denom = 33554432; abs(numerator) must be <= 20132659 (0x1333333) to meet rule  -.6 < num/denom < .6*/
-        temp = customChannel->numerator;
-        if ((temp & 0x08000000U) != 0U)
+        /* Nearest integer, a fraction of exactly one half stays on the lower integer */
+        integer   = (uint32_t)(freq_millihz / scale);
+        remainder = freq_millihz % scale;
+        if (remainder > (scale / 2U))
         {
-            /* Number was negative so convert to positive twos complement */
+            integer++;
+            offset = scale - remainder;
+            below  = true;
+        }
+        else
+        {
+            offset = remainder;
+            below  = false;
+        }
+
+        XCVR_BestFraction(offset, scale, &numerator, &denominator);
+
+        /* 2 * ref osc * (numerator / denominator - offset / scale) with scale = 2 * ref osc in mHz, rounded in uHz */
+        error = ((int64_t)numerator * (int64_t)scale) - ((int64_t)offset * (int64_t)denominator);
+        error = (error * (int64_t)XCVR_MILLIHZ_PER_HZ) +
+                ((error < 0) ? -(int64_t)(denominator / 2U) : (int64_t)(denominator / 2U));
+        error /= (int64_t)denominator;
+
+        solution->intpart      = integer;
+        solution->numerator    = below ? (uint32_t)(-(int32_t)numerator) : numerator;
+        solution->denominator  = denominator;
+        solution->ctune_target = (uint16_t)(freq_millihz / (1000000ULL * XCVR_MILLIHZ_PER_HZ));
+        solution->error_uhz    = below ? -(int32_t)error : (int32_t)error;
+    }
+
+    return status;
+}
+
+xcvrStatus_t XCVR_SolvePllPlan(uint64_t start_millihz,
+                               uint64_t spacing_millihz,
+                               uint32_t count,
+                               xcvr_pll_solution_t *solutions)
+{
+    xcvrStatus_t status = gXcvrSuccess_c;
+    uint64_t freq_millihz;
+    uint32_t i;
+
+    /* Check the whole plan first, nothing is computed for a plan leaving the band */
+    if ((solutions == NULLPTR) || (count == 0U) ||
+        (start_millihz > ((uint64_t)XCVR_PLL_MAX_FREQ_HZ * XCVR_MILLIHZ_PER_HZ)) ||
+        (spacing_millihz > (((uint64_t)XCVR_PLL_MAX_FREQ_HZ * XCVR_MILLIHZ_PER_HZ) / count)) ||
+        ((start_millihz + (spacing_millihz * (count - 1U))) > ((uint64_t)XCVR_PLL_MAX_FREQ_HZ * XCVR_MILLIHZ_PER_HZ)))
+    {
+        status = gXcvrInvalidParameters_c;
+    }
+    else
+    {
+        freq_millihz = start_millihz;
+        for (i = 0U; (i < count) && (status == gXcvrSuccess_c); i++)
+        {
+            status = XCVR_SolvePllFrequency(freq_millihz, &solutions[i]);
+            freq_millihz += spacing_millihz;
+        }
+    }
+
+    return status;
+}
+
+xcvrStatus_t XCVR_OverridePllSolution(const xcvr_pll_solution_t *solution)
+{
+    xcvrStatus_t status = gXcvrSuccess_c;
+
+    if ((solution == NULLPTR) || (solution->denominator == 0U) || (solution->denominator > XCVR_LPM_SDM_DENOM))
+    {
+        status = gXcvrInvalidParameters_c;
+    }
+    else
+    {
+        XCVR_WriteLowPortSdm(solution->intpart, solution->numerator, solution->denominator, solution->ctune_target);
+    }
+
+    return status;
+}
+
+#if !defined(RADIO_IS_GEN_3P5) /* Gen 4 and later radios use low IF receivers and need custom override for RX and TX \
+                                */
+xcvrStatus_t XCVR_OverrideRxFrequency(uint32_t freq, int32_t offset_freq)
+{
+    xcvrStatus_t status = gXcvrSuccess_c;
+    /* Input frequency is checked in the XCVR_OverrideTxFrequency() routine called below */
+    /* Check the offset frequency */
+    if ((offset_freq < -10000000L) || (offset_freq > 10000000L) || (offset_freq == 0L))
+    {
+        status = gXcvrInvalidParameters_c;
+    }
+    else
+    {
+        /* Calculate the correct target frequency */
+        /* Offset generally should be equal to the IF frequency (1MHz or 1.5MHz) but may be much larger for special
+         * localization cases */
+        uint32_t temp_offset = (uint32_t)((offset_freq < 0L) ? -offset_freq : offset_freq);
+        uint32_t target_freq = ((offset_freq < 0L) ? (freq - temp_offset) : (freq + temp_offset));
+
+        /* Use XCVR_OverrideTXFrequency to program the new target frequency */
+        status = XCVR_OverrideTxFrequency(target_freq);
+    }
+
+    return status;
+}
+#endif /* !defined(RADIO_IS_GEN_3P5)*/
+
+xcvrStatus_t XCVR_OverrideCustomChannel(const xcvr_pllChannel_t *customChannel)
+{
+    xcvrStatus_t status = gXcvrSuccess_c;
+    uint32_t temp;
+
+    if (customChannel == NULLPTR)
+    {
+        status = gXcvrInvalidParameters_c;
+        ;
+    }
+    else
+    {
+        /* denom = 33554432; abs(numerator) must be <= 20132659 (0x1333333) to meet rule  -.6 < num/denom < .6*/
+        temp = customChannel->numerator;
+        if ((temp & 0x08000000U) != 0U)
+        {
+            /* Number was negative so convert to positive twos complement */
             temp = ~temp;        /* ones complement */
             temp &= 0xF0000000U; /* mask off 4 high bits since we're only using the lower 28 bits */
             temp += 1U;
@@ -1269,81 +1960,237 @@ xcvrStatus_t XCVR_OverrideCustomChannel(const xcvr_pllChannel_t *customChannel)
     return status;
 }
 
-xcvrStatus_t XCVR_OverrideChannel(uint8_t channel)
+xcvrStatus_t XCVR_HopTableStart(uint8_t index)
 {
     xcvrStatus_t status = gXcvrSuccess_c;
-    uint32_t temp;
 
-    /* Over-ride using the hardware channel mapping table */
-    if (channel == 0xFFU)
+    if (index >= XCVR_HOP_TABLE_NUM_ENTRIES)
     {
-        XCVR_ReleasePLLOverride();
+        status = gXcvrInvalidParameters_c;
+    }
+    else
+    {
+        /* All entries share the Low Port denominator */
+        XCVR_PLL_DIG->LPM_SDM_CTRL3 = XCVR_HOP_TABLE_DENOM;
+
+        /* Stop using the LL channel map and use the manual frequency setting */
+        XCVR_PLL_DIG->CHAN_MAP &= ~(XCVR_PLL_DIG_CHAN_MAP_CHANNEL_NUM_OVRD_MASK |
+                                    XCVR_PLL_DIG_CHAN_MAP_HOP_TBL_CFG_OVRD_MASK | /* Clearing this selects the default
+                                                                                     channel num behavior */
+                                    XCVR_PLL_DIG_CHAN_MAP_HOP_TBL_CFG_OVRD_EN_MASK);
+
+        /* Keep the register contents that do not change between hops */
+        pll_hop_state.sdm_ctrl1 = (XCVR_PLL_DIG->LPM_SDM_CTRL1 & ~XCVR_PLL_DIG_LPM_SDM_CTRL1_LPM_INTG_MASK) |
+                                  XCVR_PLL_DIG_LPM_SDM_CTRL1_SDM_MAP_DISABLE_MASK;
+        pll_hop_state.ctune_ctrl = (XCVR_PLL_DIG->CTUNE_CTRL & ~XCVR_PLL_DIG_CTUNE_CTRL_CTUNE_TARGET_MANUAL_MASK) |
+                                   XCVR_PLL_DIG_CTUNE_CTRL_CTUNE_TARGET_DISABLE_MASK;
+        pll_hop_state.pwrsave_clear = ((XCVR_TSM->FAST_CTRL1 & (XCVR_TSM_FAST_CTRL1_PWRSAVE_RX_WU_EN_MASK |
+                                                                XCVR_TSM_FAST_CTRL1_PWRSAVE_TX_WU_EN_MASK)) != 0U);
+        pll_hop_state.active        = true;
+
+        status = XCVR_HopToIndex(index);
+    }
+
+    return status;
+}
+
+xcvrStatus_t XCVR_HopToIndex(uint8_t index)
+{
+    xcvrStatus_t status = gXcvrSuccess_c;
+    const xcvr_pll_hop_entry_t *entry;
+
+    if (index >= XCVR_HOP_TABLE_NUM_ENTRIES)
+    {
+        status = gXcvrInvalidParameters_c;
+    }
+    else if (!pll_hop_state.active)
+    {
+        status = gXcvrInvalidConfiguration_c;
     }
     else
     {
-        switch ((XCVR_PLL_DIG->CHAN_MAP & XCVR_PLL_DIG_CHAN_MAP_BAND_SELECT_MASK) >>
-                XCVR_PLL_DIG_CHAN_MAP_BAND_SELECT_SHIFT)
+        entry = &xcvr_pll_hop_table[index];
+        XCVR_PLL_DIG->CTUNE_CTRL =
+            pll_hop_state.ctune_ctrl | XCVR_PLL_DIG_CTUNE_CTRL_CTUNE_TARGET_MANUAL(entry->ctune_target);
+        XCVR_PLL_DIG->LPM_SDM_CTRL1 = pll_hop_state.sdm_ctrl1 | XCVR_PLL_DIG_LPM_SDM_CTRL1_LPM_INTG(entry->intpart);
+        XCVR_PLL_DIG->LPM_SDM_CTRL2 = entry->numerator;
+
+        /* Power save warmup is disabled by the default configurations, only clear it when it may be in use */
+        if (pll_hop_state.pwrsave_clear)
         {
-            case 0: ///< BLE Band
-            case 1: ///< MBAN band
-            case 2: ///< BLE/MBAN band
-                if (channel >= 40U)
-                {
-                    status = gXcvrInvalidParameters_c;
-                }
-                break;
+            XCVR_TSM->FAST_CTRL1 |= XCVR_TSM_FAST_CTRL1_PWRSAVE_WU_CLEAR_MASK; /* Must assert the bit first */
+            XCVR_TSM->FAST_CTRL1 &= ~(XCVR_TSM_FAST_CTRL1_PWRSAVE_WU_CLEAR_MASK); /* then deasert the bit manually (it
+                                                                                     is not self clearing) */
+        }
+    }
+
+    return status;
+}
+
+/* Channel check of the hardware channel map band selected in chan_map */
+static xcvrStatus_t XCVR_CheckChannel(uint32_t chan_map, uint8_t channel)
+{
+    xcvrStatus_t status = gXcvrSuccess_c;
+
+    switch ((chan_map & XCVR_PLL_DIG_CHAN_MAP_BAND_SELECT_MASK) >> XCVR_PLL_DIG_CHAN_MAP_BAND_SELECT_SHIFT)
+    {
+        case 0: ///< BLE Band
+        case 1: ///< MBAN band
+        case 2: ///< BLE/MBAN band
+            if (channel >= 40U)
+            {
+                status = gXcvrInvalidParameters_c;
+            }
+            break;
 #if defined(RADIO_IS_GEN_3P5) /* Gen 4 and later radios don't include ANT band */
-            case 3:           ///< ANT band
-                if (channel >= 83U)
-                {
-                    status = gXcvrInvalidParameters_c;
-                }
-                break;
+        case 3:                       ///< ANT band
+            if (channel >= 83U)
+            {
+                status = gXcvrInvalidParameters_c;
+            }
+            break;
 #endif
-            case 4: ///< 802.15.4 band
-                if ((channel <= 10U) || (channel >= 27U))
-                {
-                    status = gXcvrInvalidParameters_c;
-                }
-                break;
-            case 5: ///< 802.15.4j MBAN band
-                if (channel >= 15U)
-                {
-                    status = gXcvrInvalidParameters_c;
-                }
-                break;
-            case 6: ///< DFT
-            case 7: ///< Generic
-                if (channel >= 128U)
-                {
-                    status = gXcvrInvalidParameters_c;
-                }
-                break;
-            default:
+        case 4: ///< 802.15.4 band
+            if ((channel <= 10U) || (channel >= 27U))
+            {
                 status = gXcvrInvalidParameters_c;
-                break;
-        }
+            }
+            break;
+        case 5: ///< 802.15.4j MBAN band
+            if (channel >= 15U)
+            {
+                status = gXcvrInvalidParameters_c;
+            }
+            break;
+        case 6: ///< DFT
+        case 7: ///< Generic
+            if (channel >= 128U)
+            {
+                status = gXcvrInvalidParameters_c;
+            }
+            break;
+        default:
+            status = gXcvrInvalidParameters_c;
+            break;
+    }
+
+    return status;
+}
+
+/* CHAN_MAP contents overriding the channel number of chan_map with channel */
+static uint32_t XCVR_ChanMapOverride(uint32_t chan_map, uint8_t channel)
+{
+    uint32_t temp = chan_map;
+
+    temp &= ~(XCVR_PLL_DIG_CHAN_MAP_CHANNEL_NUM_OVRD_MASK |
+              XCVR_PLL_DIG_CHAN_MAP_HOP_TBL_CFG_OVRD_MASK | /* Clearing this selects the default channel num behavior */
+              XCVR_PLL_DIG_CHAN_MAP_HOP_TBL_CFG_OVRD_EN_MASK);
+    temp |= (XCVR_PLL_DIG_CHAN_MAP_CHANNEL_NUM_OVRD(channel) | XCVR_PLL_DIG_CHAN_MAP_HOP_TBL_CFG_OVRD_EN(1) |
+             XCVR_PLL_DIG_CHAN_MAP_HOP_TBL_CFG_OVRD(1));
+
+    return temp;
+}
+
+xcvrStatus_t XCVR_OverrideChannel(uint8_t channel)
+{
+    xcvrStatus_t status = gXcvrSuccess_c;
+
+    /* Over-ride using the hardware channel mapping table */
+    if (channel == 0xFFU)
+    {
+        XCVR_ReleasePLLOverride();
+    }
+    else
+    {
+        status = XCVR_CheckChannel(XCVR_PLL_DIG->CHAN_MAP, channel);
 
         if (status == gXcvrSuccess_c)
         {
             /* apply the channel over-ride */
-            temp = XCVR_PLL_DIG->CHAN_MAP;
-            temp &= ~(XCVR_PLL_DIG_CHAN_MAP_CHANNEL_NUM_OVRD_MASK |
-                      XCVR_PLL_DIG_CHAN_MAP_HOP_TBL_CFG_OVRD_MASK | /* Clearing this selects the default channel num
-                                                                       behavior */
-                      XCVR_PLL_DIG_CHAN_MAP_HOP_TBL_CFG_OVRD_EN_MASK);
-            temp |= (XCVR_PLL_DIG_CHAN_MAP_CHANNEL_NUM_OVRD(channel) | XCVR_PLL_DIG_CHAN_MAP_HOP_TBL_CFG_OVRD_EN(1) |
-                     XCVR_PLL_DIG_CHAN_MAP_HOP_TBL_CFG_OVRD(1));
-            XCVR_PLL_DIG->CHAN_MAP = temp;
+            XCVR_PLL_DIG->CHAN_MAP = XCVR_ChanMapOverride(XCVR_PLL_DIG->CHAN_MAP, channel);
         }
     }
 
     return status;
 }
 
+xcvrStatus_t XCVR_HopScheduleInit(xcvr_hop_schedule_t *schedule,
+                                  const uint8_t *channels,
+                                  uint16_t num_hops,
+                                  uint32_t dwell_us)
+{
+    xcvrStatus_t status = gXcvrSuccess_c;
+    uint32_t chan_map;
+    uint16_t i;
+
+    if ((schedule == NULLPTR) || (channels == NULLPTR) || (num_hops == 0U) ||
+        (num_hops > XCVR_HOP_SCHEDULE_MAX_HOPS))
+    {
+        status = gXcvrInvalidParameters_c;
+    }
+    else
+    {
+        /* All hops are checked against the band in use, and keep the other CHAN_MAP settings */
+        chan_map = XCVR_PLL_DIG->CHAN_MAP;
+        for (i = 0U; (i < num_hops) && (status == gXcvrSuccess_c); i++)
+        {
+            status                = XCVR_CheckChannel(chan_map, channels[i]);
+            schedule->chan_map[i] = XCVR_ChanMapOverride(chan_map, channels[i]);
+        }
+
+        schedule->num_hops = (status == gXcvrSuccess_c) ? num_hops : 0U;
+        schedule->dwell_us = dwell_us;
+        XCVR_HopScheduleRewind(schedule);
+    }
+
+    return status;
+}
+
+xcvrStatus_t XCVR_HopScheduleNext(xcvr_hop_schedule_t *schedule)
+{
+    xcvrStatus_t status = gXcvrSuccess_c;
+    uint32_t chan_map;
+
+    if ((schedule == NULLPTR) || (schedule->num_hops == 0U))
+    {
+        status = gXcvrInvalidConfiguration_c;
+    }
+    else
+    {
+        /* A hop to the channel already set is no register access at all */
+        chan_map = schedule->chan_map[schedule->next_hop];
+        if ((!schedule->synced) || (chan_map != schedule->last_chan_map))
+        {
+            XCVR_PLL_DIG->CHAN_MAP  = chan_map;
+            schedule->last_chan_map = chan_map;
+            schedule->synced        = true;
+        }
+
+        schedule->next_hop++;
+        if (schedule->next_hop == schedule->num_hops)
+        {
+            schedule->next_hop = 0U;
+        }
+    }
+
+    return status;
+}
+
+void XCVR_HopScheduleRewind(xcvr_hop_schedule_t *schedule)
+{
+    if (schedule != NULLPTR)
+    {
+        schedule->next_hop = 0U;
+        schedule->synced   = false;
+    }
+}
+
 void XCVR_ReleasePLLOverride(void)
 {
     uint32_t temp;
+
+    pll_hop_state.active = false;
+
     /* Stop using the manual frequency setting */
     XCVR_PLL_DIG->LPM_SDM_CTRL1 &= ~XCVR_PLL_DIG_LPM_SDM_CTRL1_SDM_MAP_DISABLE_MASK;
 
@@ -1362,101 +2209,133 @@ void XCVR_ReleasePLLOverride(void)
         ~(XCVR_TSM_FAST_CTRL1_PWRSAVE_WU_CLEAR_MASK); /* then deasert the bit manually (it is not self clearing) */
 }
 
-uint32_t XCVR_GetFreq(void)
+static void XCVR_ReadPllSdm(xcvr_pll_sdm_t *sdm)
 {
-    /* Allow readback of the current PLL frequency */
-    uint32_t pll_int;
-    uint32_t pll_num_unsigned;
-    uint32_t pll_num_sign = 0x04000000UL;
-    int32_t pll_num;
-    uint32_t pll_denom;
-    float64_t freq_float;
-    uint32_t freq = 0;
+    uint32_t ctrl1 = XCVR_PLL_DIG->LPM_SDM_CTRL1;
+
     /* Using mapped channels or not makes a difference what PLL values are read to calculate frequency */
-    if ((XCVR_PLL_DIG->LPM_SDM_CTRL1 & XCVR_PLL_DIG_LPM_SDM_CTRL1_SDM_MAP_DISABLE_MASK) !=
-        0U) /* Not using mapped channels */
+    if ((ctrl1 & XCVR_PLL_DIG_LPM_SDM_CTRL1_SDM_MAP_DISABLE_MASK) != 0U) /* Not using mapped channels */
     {
-        pll_int = (XCVR_PLL_DIG->LPM_SDM_CTRL1 & XCVR_PLL_DIG_LPM_SDM_CTRL1_LPM_INTG_MASK) >>
-                  XCVR_PLL_DIG_LPM_SDM_CTRL1_LPM_INTG_SHIFT;
-
-        pll_num_unsigned = XCVR_PLL_DIG->LPM_SDM_CTRL2;
-        pll_denom        = XCVR_PLL_DIG->LPM_SDM_CTRL3;
-        pll_num_sign     = 0x08000000UL;
+        sdm->integer =
+            (ctrl1 & XCVR_PLL_DIG_LPM_SDM_CTRL1_LPM_INTG_MASK) >> XCVR_PLL_DIG_LPM_SDM_CTRL1_LPM_INTG_SHIFT;
+        sdm->numerator   = XCVR_PLL_DIG->LPM_SDM_CTRL2;
+        sdm->denominator = XCVR_PLL_DIG->LPM_SDM_CTRL3;
+        sdm->sign_bit    = 0x08000000UL;
     }
     else
     {
         /* Using mapped channels so need to read from the _SELECTED fields to get the values being used */
-        pll_int = (XCVR_PLL_DIG->LPM_SDM_CTRL1 & XCVR_PLL_DIG_LPM_SDM_CTRL1_LPM_INTG_SELECTED_MASK) >>
-                  XCVR_PLL_DIG_LPM_SDM_CTRL1_LPM_INTG_SELECTED_SHIFT;
-
-        pll_num_unsigned = XCVR_PLL_DIG->LPM_SDM_RES1;
-        pll_denom        = XCVR_PLL_DIG->LPM_SDM_RES2;
-        pll_num_sign     = 0x04000000UL;
+        sdm->integer = (ctrl1 & XCVR_PLL_DIG_LPM_SDM_CTRL1_LPM_INTG_SELECTED_MASK) >>
+                       XCVR_PLL_DIG_LPM_SDM_CTRL1_LPM_INTG_SELECTED_SHIFT;
+        sdm->numerator   = XCVR_PLL_DIG->LPM_SDM_RES1;
+        sdm->denominator = XCVR_PLL_DIG->LPM_SDM_RES2;
+        sdm->sign_bit    = 0x04000000UL;
     }
+}
 
-#if RF_OSC_26MHZ == 1
-    float64_t ref_clk2x = 52000000.0F;
-#else
-    float64_t ref_clk2x = 64000000.0F;
-#endif /* RF_OSC_26MHZ == 1 */
+/*
+ * Frequency of the PLL settings, 2 * ref osc * (integer + numerator / denominator) truncated to Hz, in integer
+ * arithmetic only. The denominator is rounded to 24 significant bits as the former float32_t conversion did, so that
+ * the readback is unchanged.
+ */
+static uint32_t XCVR_CalcPllFreq(const xcvr_pll_sdm_t *sdm)
+{
+    const uint64_t ref_clk2x = 2UL * XCVR_REF_OSC_HZ;
+    uint64_t denom           = sdm->denominator;
+    uint64_t rem;
+    uint32_t shift = 0U;
+    int64_t num_hz; /* ref_clk2x * numerator */
+    int64_t freq = 0;
 
-    float64_t flt_num;
-    float64_t flt_denom = (float32_t)pll_denom;
-    float64_t flt_int   = (float32_t)pll_int;
-    /* Check if sign bit is asserted */
-    if ((pll_num_unsigned & pll_num_sign) == pll_num_sign)
-    {
-        /* Sign extend the numerator */
-        uint32_t pll_num_utmp = ((~pll_num_unsigned + 1U) &
-                                 (pll_num_sign - 1U)); /* PLL_NUM is signed 27 bits but stored in 32 bits unsigned */
-        pll_num               = (int32_t)(pll_num_utmp);
-
-        /* Calculate the frequency in MHz */
-#if (0)
-        freq_float =
-            ((float32_t)ref_clk * 2.0F * (((float32_t)pll_int) - (((float32_t)pll_num) / ((float32_t)pll_denom))));
-#else
-        flt_num = (float64_t)pll_num;
-        freq_float = ref_clk2x * (flt_int - (flt_num / flt_denom));
-#endif
+    /* Round the denominator to nearest even with 24 significant bits */
+    while ((denom >> shift) >= 0x01000000U)
+    {
+        shift++;
     }
-    else
+    if (shift > 0U)
     {
-        /* Calculate the frequency in MHz */
-        pll_num = (int32_t)pll_num_unsigned;
-#if (0)
-        freq_float =
-            ((float32_t)ref_clk * 2.0F * (((float32_t)pll_int) + (((float32_t)pll_num) / ((float32_t)pll_denom))));
-#else
-        flt_num = (float64_t)pll_num;
-        freq_float = ref_clk2x * (flt_int + (flt_num / flt_denom));
-#endif
+        rem   = denom & ((1ULL << shift) - 1U);
+        denom = denom >> shift;
+        if ((rem > (1ULL << (shift - 1U))) || ((rem == (1ULL << (shift - 1U))) && ((denom & 1U) != 0U)))
+        {
+            denom++;
+        }
+        denom = denom << shift;
+    }
+
+    if (denom != 0U)
+    {
+        /* Check if sign bit is asserted */
+        if ((sdm->numerator & sdm->sign_bit) == sdm->sign_bit)
+        {
+            /* PLL_NUM is signed 27 (26 for mapped channels) bits but stored in 32 bits unsigned, round down */
+            num_hz = (int64_t)ref_clk2x * (int64_t)((~sdm->numerator + 1U) & (sdm->sign_bit - 1U));
+            freq   = (int64_t)(ref_clk2x * sdm->integer) - (int64_t)(((uint64_t)num_hz + denom - 1U) / denom);
+        }
+        else
+        {
+            num_hz = (int64_t)ref_clk2x * (int64_t)(int32_t)sdm->numerator;
+            freq   = (int64_t)(ref_clk2x * sdm->integer) +
+                   ((num_hz >= 0) ? (int64_t)((uint64_t)num_hz / denom) :
+                                    -(int64_t)(((uint64_t)(-num_hz) + denom - 1U) / denom));
+        }
+    }
+
+    return (freq > 0) ? (uint32_t)freq : 0U; /* Integer conversion drops any fractional Hz */
+}
+
+uint32_t XCVR_GetFreq(void)
+{
+    /* Allow readback of the current PLL frequency */
+    xcvr_pll_sdm_t sdm;
+
+    XCVR_ReadPllSdm(&sdm);
+
+    return XCVR_CalcPllFreq(&sdm);
+}
+
+uint32_t XCVR_GetFreqCached(void)
+{
+    xcvr_pll_sdm_t sdm;
+
+    XCVR_ReadPllSdm(&sdm);
+    /* Only recompute when the PLL settings changed since the last call */
+    if ((!pll_freq_cache.valid) || (sdm.integer != pll_freq_cache.sdm.integer) ||
+        (sdm.numerator != pll_freq_cache.sdm.numerator) || (sdm.denominator != pll_freq_cache.sdm.denominator) ||
+        (sdm.sign_bit != pll_freq_cache.sdm.sign_bit))
+    {
+        pll_freq_cache.sdm   = sdm;
+        pll_freq_cache.freq  = XCVR_CalcPllFreq(&sdm);
+        pll_freq_cache.valid = true;
     }
-    freq = (uint32_t)freq_float; /* Integer conversion drops any fractional Hz */
 
-    return freq;
+    return pll_freq_cache.freq;
 }
 
 void XCVR_ForceRxWu(void)
 {
+    XCVR_WU_TRACE_REQUEST(gXcvrWuTraceRxWu_c);
     /* Manual force of RX Warmup */
     XCVR_TSM->CTRL |= XCVR_TSM_CTRL_FORCE_RX_EN_MASK;
 }
 
 void XCVR_ForceRxWd(void)
 {
+    XCVR_WU_TRACE_REQUEST(gXcvrWuTraceWd_c);
     /* Manual force of RX Warmdown */
     XCVR_TSM->CTRL &= ~XCVR_TSM_CTRL_FORCE_RX_EN_MASK;
 }
 
 void XCVR_ForceTxWu(void)
 {
+    XCVR_WU_TRACE_REQUEST(gXcvrWuTraceTxWu_c);
     /* Manual force of TX Warmup */
     XCVR_TSM->CTRL |= XCVR_TSM_CTRL_FORCE_TX_EN_MASK;
 }
 
 void XCVR_ForceTxWd(void)
 {
+    XCVR_WU_TRACE_REQUEST(gXcvrWuTraceWd_c);
     /* Manual force of TX Warmdown */
     XCVR_TSM->CTRL &= ~XCVR_TSM_CTRL_FORCE_TX_EN_MASK;
 }
@@ -1464,36 +2343,175 @@ void XCVR_ForceTxWd(void)
 void XCVR_WaitRxWu(void)
 {
     uint32_t end_of_wu =
-        (XCVR_TSM->END_OF_SEQ & XCVR_TSM_END_OF_SEQ_END_OF_RX_WU_MASK) >> XCVR_TSM_END_OF_SEQ_END_OF_RX_WU_SHIFT;
+        (XCVR_SHADOW_RD(TSM_END_OF_SEQ) & XCVR_TSM_END_OF_SEQ_END_OF_RX_WU_MASK) >>
+        XCVR_TSM_END_OF_SEQ_END_OF_RX_WU_SHIFT;
+    XCVR_WU_TRACE_BEGIN();
     while (((XCVR_MISC->XCVR_STATUS & XCVR_MISC_XCVR_STATUS_TSM_COUNT_MASK) >> XCVR_MISC_XCVR_STATUS_TSM_COUNT_SHIFT) !=
            end_of_wu)
     {
+        XCVR_WU_TRACE_POLL();
     }; /* Wait for TSM RX WU complete */
+    XCVR_WU_TRACE_END(gXcvrWuTraceRxWu_c);
 }
 
 void XCVR_WaitTxWu(void)
 {
     uint32_t end_of_wu =
-        (XCVR_TSM->END_OF_SEQ & XCVR_TSM_END_OF_SEQ_END_OF_TX_WU_MASK) >> XCVR_TSM_END_OF_SEQ_END_OF_TX_WU_SHIFT;
+        (XCVR_SHADOW_RD(TSM_END_OF_SEQ) & XCVR_TSM_END_OF_SEQ_END_OF_TX_WU_MASK) >>
+        XCVR_TSM_END_OF_SEQ_END_OF_TX_WU_SHIFT;
+    XCVR_WU_TRACE_BEGIN();
     while (((XCVR_MISC->XCVR_STATUS & XCVR_MISC_XCVR_STATUS_TSM_COUNT_MASK) >> XCVR_MISC_XCVR_STATUS_TSM_COUNT_SHIFT) !=
            end_of_wu)
     {
+        XCVR_WU_TRACE_POLL();
     }; /* Wait for TSM TX WU complete */
+    XCVR_WU_TRACE_END(gXcvrWuTraceTxWu_c);
 }
 
 void XCVR_WaitRxTxWd(void)
 {
+    XCVR_WU_TRACE_BEGIN();
 #if defined(NXP_RADIO_GEN) && (NXP_RADIO_GEN >= 400)
     while ((XCVR_MISC->XCVR_STATUS & XCVR_MISC_XCVR_STATUS_TSM_BUSY_MASK) != 0U)
     {
+        XCVR_WU_TRACE_POLL();
     }; /* Wait for TSM to be idle */
 #else
     while ((XCVR_MISC->XCVR_STATUS & XCVR_MISC_XCVR_STATUS_XCVR_BUSY_MASK) != 0U)
     {
+        XCVR_WU_TRACE_POLL();
     }; /* Wait for TSM to be idle */
 #endif
+    XCVR_WU_TRACE_END(gXcvrWuTraceWd_c);
+}
+
+#if (gXcvrWarmupTrace_d == 1)
+static uint32_t XCVR_WuTraceTime(void)
+{
+    return (wu_trace.timestamp_fptr != NULLPTR) ? wu_trace.timestamp_fptr() : 0U;
+}
+
+static void XCVR_WuTraceRequest(xcvr_wu_trace_mode_t mode)
+{
+    wu_trace.request_time[mode] = XCVR_WuTraceTime();
+    wu_trace.requested |= (uint8_t)(1U << (uint8_t)mode);
 }
 
+static void XCVR_WuTraceBegin(void)
+{
+    wu_trace.tsm_count = (uint8_t)((XCVR_MISC->XCVR_STATUS & XCVR_MISC_XCVR_STATUS_TSM_COUNT_MASK) >>
+                                   XCVR_MISC_XCVR_STATUS_TSM_COUNT_SHIFT);
+    wu_trace.polls      = 0U;
+    wu_trace.wait_start = XCVR_WuTraceTime();
+}
+
+static void XCVR_WuTraceEnd(xcvr_wu_trace_mode_t mode)
+{
+    uint32_t end                  = XCVR_WuTraceTime();
+    uint8_t mode_bit              = (uint8_t)(1U << (uint8_t)mode);
+    xcvr_wu_trace_entry_t *entry = &wu_trace.entries[wu_trace.next];
+
+    /* A forced sequence is timed from its request, a link layer triggered one from the start of the wait */
+    entry->timestamp = ((wu_trace.requested & mode_bit) != 0U) ? wu_trace.request_time[mode] : wu_trace.wait_start;
+    wu_trace.requested &= (uint8_t)~mode_bit;
+    entry->duration  = (wu_trace.timestamp_fptr != NULLPTR) ? (end - entry->timestamp) : wu_trace.polls;
+    entry->polls     = (wu_trace.polls > 0xFFFFU) ? 0xFFFFU : (uint16_t)wu_trace.polls;
+    entry->mode      = (uint8_t)mode;
+    entry->tsm_count = wu_trace.tsm_count;
+    if (mode == gXcvrWuTraceWd_c)
+    {
+        entry->lock_detect = 0U;
+        entry->freq_mhz    = 0U;
+    }
+    else
+    {
+        entry->lock_detect = XCVR_PLL_DIG->LOCK_DETECT;
+        entry->freq_mhz    = (uint16_t)((XCVR_GetFreqCached() + 500000UL) / 1000000UL);
+    }
+
+    wu_trace.next = ((wu_trace.next + 1U) < XCVR_WU_TRACE_SIZE) ? (wu_trace.next + 1U) : 0U;
+    if (wu_trace.count < XCVR_WU_TRACE_SIZE)
+    {
+        wu_trace.count++;
+    }
+}
+
+void XCVR_WuTraceInit(xcvr_timestamp_fptr timestamp_fptr)
+{
+    wu_trace.timestamp_fptr = timestamp_fptr;
+    wu_trace.next           = 0U;
+    wu_trace.count          = 0U;
+    wu_trace.requested      = 0U;
+}
+
+uint16_t XCVR_WuTraceRead(xcvr_wu_trace_entry_t *entries, uint16_t max_entries)
+{
+    uint16_t num = 0U;
+    uint16_t idx;
+
+    if (entries != NULLPTR)
+    {
+        num = (max_entries < wu_trace.count) ? max_entries : wu_trace.count;
+        /* Oldest entry first, it is the next one to be overwritten once the ring buffer is full */
+        idx = (wu_trace.count < XCVR_WU_TRACE_SIZE) ? 0U : wu_trace.next;
+        for (uint16_t i = 0U; i < num; i++)
+        {
+            entries[i] = wu_trace.entries[idx];
+            idx        = ((idx + 1U) < XCVR_WU_TRACE_SIZE) ? (idx + 1U) : 0U;
+        }
+    }
+
+    return num;
+}
+
+xcvrStatus_t XCVR_WuTraceGetStats(xcvr_wu_trace_mode_t mode, uint16_t freq_mhz, xcvr_wu_trace_stats_t *stats)
+{
+    xcvrStatus_t status = gXcvrSuccess_c;
+    const xcvr_wu_trace_entry_t *entry;
+    uint64_t sum = 0U;
+    uint32_t bin;
+
+    if ((stats == NULLPTR) || (mode >= gXcvrWuTraceNumModes_c))
+    {
+        status = gXcvrInvalidParameters_c;
+    }
+    else
+    {
+        stats->count = 0U;
+        stats->min   = 0xFFFFFFFFUL;
+        stats->avg   = 0U;
+        stats->max   = 0U;
+        for (bin = 0U; bin < XCVR_WU_TRACE_HIST_BINS; bin++)
+        {
+            stats->histogram[bin] = 0U;
+        }
+        for (uint16_t i = 0U; i < wu_trace.count; i++)
+        {
+            entry = &wu_trace.entries[i];
+            if ((entry->mode == (uint8_t)mode) && ((freq_mhz == 0U) || (entry->freq_mhz == freq_mhz)))
+            {
+                stats->count++;
+                sum += entry->duration;
+                stats->min = (entry->duration < stats->min) ? entry->duration : stats->min;
+                stats->max = (entry->duration > stats->max) ? entry->duration : stats->max;
+                bin        = entry->duration / XCVR_WU_TRACE_HIST_BIN_WIDTH;
+                stats->histogram[(bin < XCVR_WU_TRACE_HIST_BINS) ? bin : (XCVR_WU_TRACE_HIST_BINS - 1U)]++;
+            }
+        }
+        if (stats->count == 0U)
+        {
+            stats->min = 0U;
+        }
+        else
+        {
+            stats->avg = (uint32_t)(sum / stats->count);
+        }
+    }
+
+    return status;
+}
+#endif /* (gXcvrWarmupTrace_d == 1) */
+
 static void XCVR_clearDftfeatures(void)
 {
     /* Clear DFT_RAM_EN */
@@ -1862,11 +2880,11 @@ xcvrStatus_t XCVR_SetManAgc(uint8_t man_agc_idx)
     else
     {
         /* AGC must be enabled for the manual value to be applied */
-        XCVR_RX_DIG->CTRL0 |= XCVR_RX_DIG_CTRL0_RX_AGC_EN_MASK;
+        XCVR_SHADOW_SET(RX_DIG_CTRL0, XCVR_RX_DIG_CTRL0_RX_AGC_EN_MASK);
         /* Override AGC manual index */
-        XCVR_RX_DIG->AGC_OVRD &= ~(XCVR_RX_DIG_AGC_OVRD_AGC_GAIN_IDX_OVRD_MASK);
-        XCVR_RX_DIG->AGC_OVRD |=
-            (XCVR_RX_DIG_AGC_OVRD_AGC_GAIN_IDX_OVRD_EN_MASK | XCVR_RX_DIG_AGC_OVRD_AGC_GAIN_IDX_OVRD(man_agc_idx));
+        XCVR_SHADOW_CLR(RX_DIG_AGC_OVRD, XCVR_RX_DIG_AGC_OVRD_AGC_GAIN_IDX_OVRD_MASK);
+        XCVR_SHADOW_SET(RX_DIG_AGC_OVRD, XCVR_RX_DIG_AGC_OVRD_AGC_GAIN_IDX_OVRD_EN_MASK |
+                                         XCVR_RX_DIG_AGC_OVRD_AGC_GAIN_IDX_OVRD(man_agc_idx));
     }
 
 #else
@@ -1902,9 +2920,9 @@ void XCVR_ClearManAgc(void)
     /* Release a forced Manual AGC setting */
     /* Clear manual AGC and return to automatic */
     /* DCOC calibration only happens during RX initialization, so pulse the RX INIT signal manually */
-    XCVR_RX_DIG->CTRL0 |= XCVR_RX_DIG_CTRL0_RX_AGC_EN_MASK;
-    XCVR_RX_DIG->AGC_OVRD &=
-        ~(XCVR_RX_DIG_AGC_OVRD_AGC_GAIN_IDX_OVRD_EN_MASK | XCVR_RX_DIG_AGC_OVRD_AGC_GAIN_IDX_OVRD_MASK);
+    XCVR_SHADOW_SET(RX_DIG_CTRL0, XCVR_RX_DIG_CTRL0_RX_AGC_EN_MASK);
+    XCVR_SHADOW_CLR(RX_DIG_AGC_OVRD, XCVR_RX_DIG_AGC_OVRD_AGC_GAIN_IDX_OVRD_EN_MASK |
+                                     XCVR_RX_DIG_AGC_OVRD_AGC_GAIN_IDX_OVRD_MASK);
 #else
     /* Release a forced Manual AGC setting */
     /* Clear manual AGC and return to automatic */
@@ -2179,6 +3197,12 @@ void XCVR_FastPeriphReg_UpDownload_Go(PKT_RAM_BANK_SEL_T pkt_ram_sel, uint32_t o
     uint8_t up_or_down_load;
     uint32_t temp;
     up_or_down_load = (upload ? 0U : 1U); 
+    if (upload)
+    {
+        /* PKT RAM to registers transfer overwrites registers behind the shadow register cache */
+        XCVR_InvalidateShadowRegs();
+        XCVR_InvalidateRbmeConfig();
+    }
     temp = RADIO_CTRL_PACKET_RAM_TO_IPS_CTRL_PR2IPS_RAM_SEL((uint32_t)pkt_ram_sel) |
             RADIO_CTRL_PACKET_RAM_TO_IPS_CTRL_PR2IPS_ADDR_SRC(offset_in_pkt_ram) |
             RADIO_CTRL_PACKET_RAM_TO_IPS_CTRL_PR2IPS_REGS2PKT(up_or_down_load); 
@@ -2391,4 +3415,103 @@ bool XCVR_FastPeriph_CheckErrorComplete(void)
     return status_ok;  /* True means no error, False indicates an error occurred */
 }
 
+xcvrStatus_t XCVR_ModeBankLoad(xcvr_mode_bank_t *bank,
+                               PKT_RAM_BANK_SEL_T pkt_ram_sel,
+                               uint16_t offset_in_pkt_ram,
+                               const xcvr_config_t **xcvr_configs,
+                               uint8_t num_modes)
+{
+    xcvrStatus_t status = gXcvrSuccess_c;
+    uint32_t pkt_ram_count;
+    uint16_t offset = offset_in_pkt_ram;
+    uint16_t num_words;
+    uint8_t i;
+
+    pkt_ram_count = (pkt_ram_sel == TX_PKT_RAM_SEL) ? TX_PACKET_RAM_PACKET_RAM_COUNT : RX_PACKET_RAM_PACKET_RAM_COUNT;
+    if ((bank == NULLPTR) || (xcvr_configs == NULLPTR) || (num_modes == 0U) ||
+        (num_modes > XCVR_MODE_BANK_MAX_MODES) || ((pkt_ram_sel != TX_PKT_RAM_SEL) && (pkt_ram_sel != RX_PKT_RAM_SEL)) ||
+        ((uint32_t)offset_in_pkt_ram >= pkt_ram_count))
+    {
+        status = gXcvrInvalidParameters_c;
+    }
+    else
+    {
+        bank->num_modes   = 0U;
+        bank->pkt_ram_sel = pkt_ram_sel;
+        /* Lists are placed back to back, each one ends with its own all zeros descriptor */
+        for (i = 0U; (i < num_modes) && (status == gXcvrSuccess_c); i++)
+        {
+            status = XCVR_RadioGenModeBankEncode(xcvr_configs[i], GET_PKT_RAM_PTR(pkt_ram_sel, offset),
+                                                 (uint16_t)(pkt_ram_count - offset), &num_words);
+            if (status == gXcvrSuccess_c)
+            {
+                bank->config[i] = xcvr_configs[i];
+                bank->offset[i] = offset;
+                offset += num_words;
+            }
+        }
+        if (status == gXcvrSuccess_c)
+        {
+            bank->num_modes = num_modes;
+        }
+    }
+
+    return status;
+}
+
+xcvrStatus_t XCVR_ModeBankSwitch(const xcvr_mode_bank_t *bank,
+                                 uint8_t mode_idx,
+                                 const xcvr_coding_config_t **rbme_config)
+{
+    xcvrStatus_t status = gXcvrSuccess_c;
+    const xcvr_config_t *xcvr_config;
+
+    if ((bank == NULLPTR) || (mode_idx >= bank->num_modes) || (rbme_config == NULLPTR))
+    {
+        status = gXcvrInvalidParameters_c;
+    }
+    else
+    {
+        xcvr_config = bank->config[mode_idx];
+#if defined(gXcvrSaveRestoreCoexConfig_d)
+        XCVR_CoexistenceSaveRestoreTimings(0x1U); /* save coex related timings to be restored later */
+#endif
+
+        /* The whole register set is moved from PKT RAM by the hardware instead of by CPU register writes */
+        XCVR_FastPeriphReg_UpDownload_Go(bank->pkt_ram_sel, bank->offset[mode_idx], true);
+        if (!XCVR_FastPeriph_WaitComplete())
+        {
+            status = gXcvrConfigurationFailure_c;
+        }
+
+        /* Sets up RBME only */
+        if (status == gXcvrSuccess_c)
+        {
+            status = XCVR_RBME_Configure(rbme_config);
+        }
+
+#if defined(gXcvrSaveRestoreCoexConfig_d)
+        XCVR_CoexistenceSaveRestoreTimings(0x0U); /* restore  previously saved coex related timings */
+#endif
+
+        if (status == gXcvrSuccess_c)
+        {
+            current_xcvr_config.radio_mode    = xcvr_config->mode_data_rate_cfg->radio_mode;
+            current_xcvr_config.data_rate     = xcvr_config->mode_data_rate_cfg->data_rate;
+            current_xcvr_config.alt_data_rate = xcvr_config->mode_data_rate_cfg->alt_data_rate;
+            current_xcvr_config.coding_mode   = (*rbme_config)->coding_mode;
+            active_xcvr_config                = xcvr_config;
+            active_rbme_config                = *rbme_config;
+        }
+        else
+        {
+            /* Register state is unknown after a failed upload, next delta mode change must be a full setup */
+            active_xcvr_config = NULLPTR;
+            active_rbme_config = NULLPTR;
+        }
+    }
+
+    return status;
+}
+
 #endif /* defined(NXP_RADIO_GEN) && (NXP_RADIO_GEN >= 470) */
@@ -239,6 +239,58 @@ typedef struct
 #define TX_WD_TIME_TGT         (0x8U)       /*!< Mid point value for the TX warmdown time register */
 
 
+#ifndef gXcvrTableRegSetup_d
+#define gXcvrTableRegSetup_d \
+    (0) /*!< Set to 1 to program the radio registers from the register descriptor table instead of generated code */
+#endif
+
+#ifndef gXcvrShadowRegCache_d
+#define gXcvrShadowRegCache_d \
+    (0) /*!< Set to 1 to keep a write-through RAM copy of the radio config registers used by read-modify-write APIs */
+#endif
+
+#ifndef gXcvrRbmeSkipUnchanged_d
+#define gXcvrRbmeSkipUnchanged_d \
+    (0) /*!< Set to 1 to skip or delta-write the RBME setup when the coding config is the one already programmed */
+#endif
+
+#ifndef gXcvrWarmupTrace_d
+#define gXcvrWarmupTrace_d \
+    (0) /*!< Set to 1 to record the warmup and warmdown waits in a trace ring buffer, see ::XCVR_WuTraceInit() */
+#endif
+
+#ifndef XCVR_WU_TRACE_SIZE
+#define XCVR_WU_TRACE_SIZE (32U) /*!< Number of entries of the warmup trace ring buffer */
+#endif
+
+#ifndef XCVR_WU_TRACE_HIST_BINS
+#define XCVR_WU_TRACE_HIST_BINS (8U) /*!< Number of histogram bins of the warmup trace statistics */
+#endif
+
+#ifndef XCVR_WU_TRACE_HIST_BIN_WIDTH
+#define XCVR_WU_TRACE_HIST_BIN_WIDTH (16U) /*!< Duration range of one histogram bin, the last bin is open ended */
+#endif
+
+/* PLL hop table, see ::xcvr_pll_hop_table */
+#define XCVR_HOP_TABLE_MIN_FREQ_HZ (2360000000UL)       /*!< Frequency of the first hop table entry */
+#define XCVR_HOP_TABLE_STEP_HZ     (500000UL)           /*!< Frequency step between two hop table entries */
+#define XCVR_HOP_TABLE_NUM_ENTRIES (255U)               /*!< Hop table entries, 2360 MHz to 2487 MHz */
+#define XCVR_HOP_TABLE_DENOM       (0x08000000UL - 1UL) /*!< Low Port denominator shared by all hop table entries */
+#define XCVR_HOP_TABLE_INDEX(freq) \
+    ((uint8_t)(((freq) - XCVR_HOP_TABLE_MIN_FREQ_HZ) / XCVR_HOP_TABLE_STEP_HZ)) /*!< Hop table entry of a freq in Hz */
+
+#ifndef XCVR_HOP_SCHEDULE_MAX_HOPS
+#define XCVR_HOP_SCHEDULE_MAX_HOPS (80U) /*!< Number of hops one hop schedule can hold */
+#endif
+
+#ifndef XCVR_ED_SCAN_MAX_CHANNELS
+#define XCVR_ED_SCAN_MAX_CHANNELS (40U) /*!< Number of channels one energy detect scan can measure */
+#endif
+
+#ifndef XCVR_MODE_BANK_MAX_MODES
+#define XCVR_MODE_BANK_MAX_MODES (3U) /*!< Number of radio configurations one packet RAM mode bank can hold */
+#endif
+
 #ifndef XCVR_DAC_TRIM_RETRY_COUNT
 #define XCVR_DAC_TRIM_RETRY_COUNT   (1U)     /*!< Default retry count for DCOC DAC trim process to 1 */
 #endif
@@ -519,6 +571,60 @@ typedef struct
     uint32_t numerator;
 } xcvr_pllChannel_t;
 
+/*!
+ * @brief XCVR PLL hop table entry structure
+ * This structure is used to store the Low Port settings and coarse tune target that ::XCVR_OverrideTxFrequency()
+ * programs for one frequency. The denominator is ::XCVR_HOP_TABLE_DENOM for all entries.
+ */
+typedef struct
+{
+    uint32_t numerator;    /*!< Signed Low Port numerator, as written to LPM_SDM_CTRL2 */
+    uint16_t ctune_target; /*!< Coarse tune target in MHz */
+    uint8_t intpart;       /*!< Low Port integer */
+} xcvr_pll_hop_entry_t;
+
+/*!
+ * @brief XCVR PLL frequency solution structure
+ * This structure is used to store the Low Port settings found by ::XCVR_SolvePllFrequency() for a frequency, with the
+ * residual frequency error of the synthesized carrier.
+ */
+typedef struct
+{
+    uint32_t intpart;      /*!< Low Port integer */
+    uint32_t numerator;    /*!< Signed Low Port numerator, as written to LPM_SDM_CTRL2 */
+    uint32_t denominator;  /*!< Low Port denominator, as written to LPM_SDM_CTRL3 */
+    uint16_t ctune_target; /*!< Coarse tune target in MHz */
+    int32_t error_uhz;     /*!< Synthesized minus requested frequency in micro Hz, for an exact reference oscillator */
+} xcvr_pll_solution_t;
+
+/*!
+ * @brief XCVR hop schedule structure
+ * This structure is used to store a channel hop sequence prepared by ::XCVR_HopScheduleInit(), as the PLL CHAN_MAP
+ * register contents of each hop, and the position of ::XCVR_HopScheduleNext() in the sequence.
+ */
+typedef struct
+{
+    uint32_t chan_map[XCVR_HOP_SCHEDULE_MAX_HOPS]; /*!< CHAN_MAP contents of each hop */
+    uint32_t dwell_us;      /*!< Dwell time on each hop in microseconds, for the hop timer of the caller */
+    uint32_t last_chan_map; /*!< CHAN_MAP contents written by the last hop */
+    uint16_t num_hops;      /*!< Number of hops in the sequence */
+    uint16_t next_hop;      /*!< Hop set by the next ::XCVR_HopScheduleNext() call */
+    bool synced;            /*!< last_chan_map is the CHAN_MAP register contents */
+} xcvr_hop_schedule_t;
+
+/*!
+ * @brief XCVR energy detect scan structure
+ * This structure is used to return the results of ::XCVR_EdScan(), one entry per scanned channel in scan order. Times
+ * are in units of the timestamp callback given to the scan, and are 0 without timestamp callback.
+ */
+typedef struct
+{
+    int8_t ed_dbm[XCVR_ED_SCAN_MAX_CHANNELS];      /*!< Narrowband RSSI of each channel in dBm */
+    uint16_t chan_time[XCVR_ED_SCAN_MAX_CHANNELS]; /*!< Time from the warmup of each channel to its end of warmdown */
+    uint32_t total_time;                           /*!< Time of the whole scan, setup and restore included */
+    uint16_t num_channels;                         /*!< Number of scanned channels */
+} xcvr_ed_scan_t;
+
 /*!
  * @brief XCVR XTAL temp compensation configuration structure
  * This structure is used to store the table for temperature compensation of the XTAL trim.
@@ -543,6 +649,50 @@ typedef struct
  */
 typedef void (*panic_fptr)(uint32_t panic_id, uint32_t location, uint32_t extra1, uint32_t extra2);
 
+/*!
+ * @brief Timestamp callback function type
+ *
+ * The timestamp callback returns a free running time count of the system (e.g. a microsecond timer), its wrap around
+ * must be at 2^32. refer to #XCVR_WuTraceInit
+ */
+typedef uint32_t (*xcvr_timestamp_fptr)(void);
+
+/*! @brief Sequences recorded by the warmup trace. */
+typedef enum
+{
+    gXcvrWuTraceRxWu_c = 0U, /*!< RX warmup, ::XCVR_ForceRxWu() and ::XCVR_WaitRxWu() */
+    gXcvrWuTraceTxWu_c = 1U, /*!< TX warmup, ::XCVR_ForceTxWu() and ::XCVR_WaitTxWu() */
+    gXcvrWuTraceWd_c   = 2U, /*!< RX or TX warmdown, ::XCVR_ForceRxWd() or ::XCVR_ForceTxWd() and ::XCVR_WaitRxTxWd() */
+    gXcvrWuTraceNumModes_c   /*!< Number of sequences, not a valid sequence */
+} xcvr_wu_trace_mode_t;
+
+/*!
+ * @brief Warmup trace entry structure
+ * One warmup or warmdown wait. Durations are in timestamp callback units, or in wait loop iterations when no timestamp
+ * callback is registered. A wait that follows a forced request of the same sequence is timed from the request,
+ * otherwise from the start of the wait (link layer triggered sequences).
+ */
+typedef struct
+{
+    uint32_t timestamp;   /*!< Time of the request or of the start of the wait, 0 without timestamp callback */
+    uint32_t duration;    /*!< Time from timestamp to the end of the wait */
+    uint32_t lock_detect; /*!< PLL LOCK_DETECT register at the end of a warmup, 0 for warmdowns */
+    uint16_t polls;       /*!< Wait loop iterations, saturated */
+    uint16_t freq_mhz;    /*!< PLL frequency in MHz at the end of a warmup, 0 for warmdowns */
+    uint8_t mode;         /*!< Sequence, see ::xcvr_wu_trace_mode_t */
+    uint8_t tsm_count;    /*!< TSM_COUNT when the wait started */
+} xcvr_wu_trace_entry_t;
+
+/*! @brief Warmup trace statistics structure, see ::XCVR_WuTraceGetStats() */
+typedef struct
+{
+    uint32_t count;                                /*!< Number of matching entries */
+    uint32_t min;                                  /*!< Shortest duration, 0 when count is 0 */
+    uint32_t avg;                                  /*!< Average duration, rounded down, 0 when count is 0 */
+    uint32_t max;                                  /*!< Longest duration, 0 when count is 0 */
+    uint16_t histogram[XCVR_WU_TRACE_HIST_BINS]; /*!< Entries per duration range of XCVR_WU_TRACE_HIST_BIN_WIDTH */
+} xcvr_wu_trace_stats_t;
+
 /**
  * @brief 32-bit floating-point type definition.
  */
@@ -565,6 +715,21 @@ typedef double float64_t;
 #define GET_PKT_RAM_PTR(r, ofst) \
     (r == TX_PKT_RAM_SEL ? (&(TX_PACKET_RAM->PACKET_RAM[ofst])) : (&(RX_PACKET_RAM->PACKET_RAM[ofst])))
 
+#if defined(NXP_RADIO_GEN) && (NXP_RADIO_GEN >= 470)
+/*!
+ * @brief XCVR mode bank structure
+ * Set of radio configurations encoded as PR2IPS descriptor and data lists and parked in one packet RAM by
+ * ::XCVR_ModeBankLoad() so that a protocol switch is a single hardware upload (::XCVR_ModeBankSwitch()).
+ */
+typedef struct
+{
+    const xcvr_config_t *config[XCVR_MODE_BANK_MAX_MODES]; /*!< Configuration encoded in each slot */
+    uint16_t offset[XCVR_MODE_BANK_MAX_MODES]; /*!< Word offset in packet RAM of the descriptor list of each slot */
+    PKT_RAM_BANK_SEL_T pkt_ram_sel;            /*!< Packet RAM holding the bank */
+    uint8_t num_modes;                         /*!< Number of loaded slots */
+} xcvr_mode_bank_t;
+#endif /* defined(NXP_RADIO_GEN) && (NXP_RADIO_GEN >= 470) */
+
 /* These exported values only apply to Gen 3.5 and Gen 4.0 */
 #if defined(NXP_RADIO_GEN) && (NXP_RADIO_GEN <= 400)
 /* Expose TX_RX_ON_DELAY and SYNTH_DELAY for BLE LL to access for setting registers appropriately */
@@ -579,6 +744,64 @@ static inline void ASM_NOP(void)
     __asm("nop");
 };
 
+/*!
+ * @brief Radio configuration registers mirrored by the shadow register cache.
+ * TSM CTRL, OVRD0 and OVRD1 are not mirrored as the link layer and the hardware also write them.
+ */
+typedef enum
+{
+    XCVR_SHADOW_TSM_END_OF_SEQ = 0U,
+    XCVR_SHADOW_RX_DIG_CTRL0,
+    XCVR_SHADOW_RX_DIG_CTRL1,
+    XCVR_SHADOW_RX_DIG_AGC_OVRD,
+    XCVR_SHADOW_RX_DIG_RSSI_GLOBAL_CTRL,
+    XCVR_SHADOW_RX_DIG_RCCAL_CTRL1,
+    XCVR_SHADOW_PLL_DIG_HPM_CTRL,
+#if defined(NXP_RADIO_GEN) && (NXP_RADIO_GEN >= 470)
+    XCVR_SHADOW_MISC_IPS_FO_ADDR_1,
+    XCVR_SHADOW_MISC_IPS_FO_ADDR_2,
+#endif /* defined(NXP_RADIO_GEN) && (NXP_RADIO_GEN >= 470) */
+    XCVR_SHADOW_NUM_REGS /* Must stay below 32, validity is tracked in one word */
+} XCVR_SHADOW_REG_T;
+
+/* Hardware register behind each shadow entry. Only plain configuration registers (no status, trigger or self clearing
+ * bits) may be listed here. */
+#define XCVR_SHADOW_REG_TSM_END_OF_SEQ          (XCVR_TSM->END_OF_SEQ)
+#define XCVR_SHADOW_REG_RX_DIG_CTRL0            (XCVR_RX_DIG->CTRL0)
+#define XCVR_SHADOW_REG_RX_DIG_CTRL1            (XCVR_RX_DIG->CTRL1)
+#define XCVR_SHADOW_REG_RX_DIG_AGC_OVRD         (XCVR_RX_DIG->AGC_OVRD)
+#define XCVR_SHADOW_REG_RX_DIG_RSSI_GLOBAL_CTRL (XCVR_RX_DIG->RSSI_GLOBAL_CTRL)
+#define XCVR_SHADOW_REG_RX_DIG_RCCAL_CTRL1      (XCVR_RX_DIG->RCCAL_CTRL1)
+#define XCVR_SHADOW_REG_PLL_DIG_HPM_CTRL        (XCVR_PLL_DIG->HPM_CTRL)
+#if defined(NXP_RADIO_GEN) && (NXP_RADIO_GEN >= 470)
+#define XCVR_SHADOW_REG_MISC_IPS_FO_ADDR_1      (XCVR_MISC->IPS_FO_ADDR[1])
+#define XCVR_SHADOW_REG_MISC_IPS_FO_ADDR_2      (XCVR_MISC->IPS_FO_ADDR[2])
+#endif /* defined(NXP_RADIO_GEN) && (NXP_RADIO_GEN >= 470) */
+
+/* Register accessors for the entries above, the cache itself is only available on Gen 4.5 and later */
+#if defined(NXP_RADIO_GEN) && (NXP_RADIO_GEN >= 450) && (gXcvrShadowRegCache_d == 1)
+/* Shadow register read, only the first read after an invalidation goes to the bus */
+uint32_t XCVR_ShadowRead(XCVR_SHADOW_REG_T idx, volatile const uint32_t *reg);
+
+/* Shadow register write, always written through to the hardware */
+void XCVR_ShadowWrite(XCVR_SHADOW_REG_T idx, volatile uint32_t *reg, uint32_t value);
+
+#define XCVR_SHADOW_RD(name)         XCVR_ShadowRead(XCVR_SHADOW_##name, &XCVR_SHADOW_REG_##name)
+#define XCVR_SHADOW_WR(name, value)  XCVR_ShadowWrite(XCVR_SHADOW_##name, &XCVR_SHADOW_REG_##name, (value))
+#define XCVR_SHADOW_SET(name, mask)                                \
+    XCVR_ShadowWrite(XCVR_SHADOW_##name, &XCVR_SHADOW_REG_##name, \
+                     XCVR_ShadowRead(XCVR_SHADOW_##name, &XCVR_SHADOW_REG_##name) | (mask))
+#define XCVR_SHADOW_CLR(name, mask)                                \
+    XCVR_ShadowWrite(XCVR_SHADOW_##name, &XCVR_SHADOW_REG_##name, \
+                     XCVR_ShadowRead(XCVR_SHADOW_##name, &XCVR_SHADOW_REG_##name) & ~(mask))
+#else
+/* Cache disabled, plain register accesses */
+#define XCVR_SHADOW_RD(name)         (XCVR_SHADOW_REG_##name)
+#define XCVR_SHADOW_WR(name, value)  (XCVR_SHADOW_REG_##name = (value))
+#define XCVR_SHADOW_SET(name, mask)  (XCVR_SHADOW_REG_##name |= (mask))
+#define XCVR_SHADOW_CLR(name, mask)  (XCVR_SHADOW_REG_##name &= ~(mask))
+#endif /* defined(NXP_RADIO_GEN) && (NXP_RADIO_GEN >= 450) && (gXcvrShadowRegCache_d == 1) */
+
 
 /*******************************************************************************
  * API
@@ -658,6 +881,9 @@ xcvrStatus_t XCVR_Configure(const xcvr_config_t ** xcvr_config,
  *
  * @param[in] rbme  Pointer to a pointer to the RBME settings structure for coding, CRC, whitening setup.
  * @return Status of the call.
+ * @note With gXcvrRbmeSkipUnchanged_d set to 1 (gen 4.5 and later), passing the coding configuration already
+ * programmed, with unchanged content, only rewrites GEN4PHY->DMD_CTRL1 (also written by the radio register setup).
+ * Passing another configuration writes only the registers that differ from the programmed one.
  */
 xcvrStatus_t XCVR_RBME_Configure(const xcvr_coding_config_t ** rbme);
 
@@ -688,6 +914,97 @@ void XCVR_Reset(void);
  */
 xcvrStatus_t XCVR_ChangeMode(const xcvr_config_t **xcvr_config, const xcvr_coding_config_t **rbme_config);
 
+#if defined(NXP_RADIO_GEN) && (NXP_RADIO_GEN >= 450)
+/*!
+ * @brief Change the operating mode of the radio, programming only the registers that differ.
+ *
+ * This function changes the XCVR to a new radio operating mode by comparing the target configuration with the
+ * configuration programmed by the last ::XCVR_Init(), ::XCVR_InitNoDacTrim(), ::XCVR_ChangeMode() or
+ * ::XCVR_ChangeModeDelta() call and writing only the registers whose final value changes. If no configuration is
+ * active (first call or after ::XCVR_Reset() or ::XCVR_Deinit()) a full ::XCVR_ChangeMode() is performed.
+ *
+ * @param[in] xcvr_config  Pointer to a pointer to the complete XCVR settings structure.
+ * @param[in] rbme_config  Pointer to a pointer to the complete RBME settings structure.
+ * @return Status of the call.
+ * @note Registers altered at runtime outside of the configuration structures (e.g. channel, PA power or CRC overrides)
+ * are only rewritten if they differ between the two configurations. Use ::XCVR_ChangeMode() when such overrides must
+ * be cleared.
+ */
+xcvrStatus_t XCVR_ChangeModeDelta(const xcvr_config_t **xcvr_config, const xcvr_coding_config_t **rbme_config);
+
+/*!
+ * @brief Get the number of register writes avoided by delta mode changes.
+ *
+ * This function returns the running count of register writes skipped by ::XCVR_ChangeModeDelta() since startup or the
+ * last call to ::XCVR_ClearDeltaSkippedWrites().
+ *
+ * @return The number of skipped register writes.
+ */
+uint32_t XCVR_GetDeltaSkippedWrites(void);
+
+/*!
+ * @brief Clear the count of register writes avoided by delta mode changes.
+ *
+ * This function resets the running count returned by ::XCVR_GetDeltaSkippedWrites().
+ */
+void XCVR_ClearDeltaSkippedWrites(void);
+
+/*!
+ * @brief Invalidate the shadow register cache.
+ *
+ * This function drops all shadow copies so that the next access to each register reads the hardware again. The driver
+ * calls it on reset, deinit and on every full, delta, folded or mode bank register setup. It must also be called after
+ * any code outside of the XCVR driver (e.g. a link layer) writes one of the registers listed in XCVR_SHADOW_REG_T, or
+ * after the low level XCVR_RadioGenRegSetup*() functions are called directly. It has no effect when
+ * gXcvrShadowRegCache_d is 0.
+ */
+void XCVR_InvalidateShadowRegs(void);
+
+/*!
+ * @brief Get the number of register reads served from the shadow register cache.
+ *
+ * This function returns the running count of bus reads avoided by the shadow register cache since startup or the last
+ * call to ::XCVR_ClearShadowSavedReads(). It always returns 0 when gXcvrShadowRegCache_d is 0.
+ *
+ * @return The number of saved register reads.
+ */
+uint32_t XCVR_GetShadowSavedReads(void);
+
+/*!
+ * @brief Clear the count of register reads served from the shadow register cache.
+ *
+ * This function resets the running count returned by ::XCVR_GetShadowSavedReads().
+ */
+void XCVR_ClearShadowSavedReads(void);
+
+/*!
+ * @brief Forget the coding configuration programmed in the RBME block.
+ *
+ * With gXcvrRbmeSkipUnchanged_d set to 1, ::XCVR_RBME_Configure() remembers the coding configuration it programmed
+ * (pointer and content hash) to skip or delta-write the next RBME setup. This function makes the next setup a full
+ * one. The driver calls it on reset, deinit, ::XCVR_SetCRCWConfig() and packet RAM register uploads. It must also be
+ * called after any code outside of the XCVR driver writes the RBME registers. It has no effect when
+ * gXcvrRbmeSkipUnchanged_d is 0.
+ */
+void XCVR_InvalidateRbmeConfig(void);
+
+/*!
+ * @brief Change the operating mode of the radio using a folded configuration.
+ *
+ * This function changes the XCVR to a new radio operating mode by copying the pre-merged register values of a folded
+ * configuration instead of merging the common and mode dependent settings at runtime. The folded configurations of the
+ * supported modes, e.g. xcvr_gfsk_bt_0p5_h_0p5_1mbps_folded_config, are declared in nxp_xcvr_reg_images.h (generated
+ * by tools/xcvr_reg_image_gen.c). Calling ::XCVR_RadioStartup() followed by this function is a fast alternative to
+ * ::XCVR_InitNoDacTrim().
+ *
+ * @param[in] folded_config  Pointer to the folded XCVR configuration.
+ * @param[in] rbme_config  Pointer to a pointer to the complete RBME settings structure.
+ * @return Status of the call.
+ */
+xcvrStatus_t XCVR_ChangeModeFolded(const xcvr_folded_config_t *folded_config,
+                                   const xcvr_coding_config_t **rbme_config);
+#endif /* defined(NXP_RADIO_GEN) && (NXP_RADIO_GEN >= 450) */
+
 /*!
  * @brief Get the current configuration of the RBME CRC and Whitening.
  *
@@ -945,6 +1262,31 @@ int16_t XCVR_GetInstantRssi(void);
  */
 int16_t XCVR_GetRssiResult(void);
 
+#if defined(NXP_RADIO_GEN) && (NXP_RADIO_GEN >= 450)
+/*!
+ * @brief  Measure the energy on a list of channels.
+ *
+ * This function measures the narrowband RSSI of each channel in turn, as ::XCVR_OverrideChannel() followed by
+ * ::XCVR_GetInstantRssi() and a wait for the warmdown would, with the RSSI setup and restore done once for the whole
+ * scan. The CHAN_MAP override of the next channel is computed while the RSSI of the current channel integrates and is
+ * written once its warmdown is requested, so that the retune is programmed during the warmdown and the PLL locks to
+ * the next channel in the following warmup. All channels are checked against the band in use before the radio is
+ * started, and the PLL CHAN_MAP register is restored at the end of the scan.
+ *
+ * @param[in] channels  Pointer to the protocol specific channels to measure, see ::XCVR_OverrideChannel().
+ * @param[in] num_channels  Number of channels to measure, up to XCVR_ED_SCAN_MAX_CHANNELS.
+ * @param[in] timestamp_fptr  The timestamp callback timing the scan, or NULLPTR.
+ * @param[out] scan  Pointer to the scan results, RSSI values beyond the int8_t range are saturated.
+ * @return gXcvrInvalidParameters_c for a NULLPTR pointer, a number of channels out of range or a channel out of the
+ * band in use, gXcvrSuccess_c otherwise.
+ * @note The radio must be idle, the function forces the RX warmups and warmdowns as ::XCVR_GetInstantRssi() does.
+ */
+xcvrStatus_t XCVR_EdScan(const uint8_t *channels,
+                         uint16_t num_channels,
+                         xcvr_timestamp_fptr timestamp_fptr,
+                         xcvr_ed_scan_t *scan);
+#endif /* defined(NXP_RADIO_GEN) && (NXP_RADIO_GEN >= 450) */
+
 #if defined(RADIO_IS_GEN_3P5) /* Gen 4 and later radios don't include DAC trims */
 /*!
  * @brief  Performs the DCOC DAC trim process.
@@ -1061,12 +1403,129 @@ xcvrStatus_t XCVR_OverrideRxFrequency (uint32_t freq, int32_t offset_freq);
 xcvrStatus_t XCVR_OverrideTxFrequency (uint32_t freq);
 #endif /* defined(RADIO_IS_GEN_3P5)*/
 
+/*!
+ * @brief Prepares a hop schedule from a channel sequence.
+ *
+ * This function checks all channels of a hop sequence against the hardware channel map band in use and computes the
+ * PLL CHAN_MAP register contents of each hop once, so that ::XCVR_HopScheduleNext() has no check or read-modify-write
+ * left to do. No hop is set by this function.
+ *
+ * @param[out] schedule Pointer to the hop schedule to prepare.
+ * @param[in] channels Channel sequence, channel numbers as for ::XCVR_OverrideChannel().
+ * @param[in] num_hops Number of channels in the sequence, at most ::XCVR_HOP_SCHEDULE_MAX_HOPS.
+ * @param[in] dwell_us Dwell time on each hop in microseconds, kept in the schedule for the hop timer of the caller.
+ * @return Status of the call, gXcvrInvalidParameters_c if a channel is not valid (the schedule is then empty).
+ * @note The CHAN_MAP settings other than the channel override are captured by this function, so the band selection must
+ * not change while the schedule is in use.
+ */
+xcvrStatus_t XCVR_HopScheduleInit(xcvr_hop_schedule_t *schedule,
+                                  const uint8_t *channels,
+                                  uint16_t num_hops,
+                                  uint32_t dwell_us);
+
+/*!
+ * @brief Sets the next hop of a hop schedule.
+ *
+ * This function sets the channel of the next hop of the sequence, in constant time and with a single register write,
+ * none when the channel is the one of the previous hop. The sequence starts again from its first hop after its last.
+ *
+ * @param[in,out] schedule Pointer to the hop schedule.
+ * @return Status of the call, gXcvrInvalidConfiguration_c if the schedule is empty.
+ * @note The ::XCVR_ReleasePLLOverride() function must be called to release the PLL over-ride bits which are set by this
+ * function, as for ::XCVR_OverrideChannel(). ::XCVR_HopScheduleRewind() must be called before hopping again after any
+ * other PLL channel or frequency over-ride.
+ */
+xcvrStatus_t XCVR_HopScheduleNext(xcvr_hop_schedule_t *schedule);
+
+/*!
+ * @brief Restarts a hop schedule from its first hop.
+ *
+ * This function makes the next ::XCVR_HopScheduleNext() call set the first hop of the sequence, with a register write
+ * even if the channel did not change.
+ *
+ * @param[in,out] schedule Pointer to the hop schedule.
+ */
+void XCVR_HopScheduleRewind(xcvr_hop_schedule_t *schedule);
+
+/*!
+ * @brief Starts frequency hopping from the PLL hop table.
+ *
+ * This function prepares the PLL for ::XCVR_HopToIndex() and sets the frequency of the hop table entry index. The Low
+ * Port denominator, the manual low port control and the coarse tune override are set once here, along with the
+ * register contents the hops keep, so that each hop is a table lookup and three register writes.
+ *
+ * @param[in] index The hop table entry to start on, see ::XCVR_HOP_TABLE_INDEX.
+ * @return The status of the frequency over-ride.
+ * @note The ::XCVR_ReleasePLLOverride() function must be called to end hopping, as for the other PLL over-rides. The
+ * PLL_DIG LPM_SDM_CTRL1 and CTUNE_CTRL settings other than the channel are captured by this function, so it must be
+ * called again after anything else changes them.
+ */
+xcvrStatus_t XCVR_HopTableStart(uint8_t index);
+
+/*!
+ * @brief Sets the frequency of a PLL hop table entry.
+ *
+ * This function programs the integer, numerator and coarse tune target of the ::xcvr_pll_hop_table entry index. The
+ * resulting frequency is the same as ::XCVR_OverrideTxFrequency() of XCVR_HOP_TABLE_MIN_FREQ_HZ + index *
+ * XCVR_HOP_TABLE_STEP_HZ. Hopping at 1 MHz spacing uses the even entries.
+ *
+ * @param[in] index The hop table entry to set, see ::XCVR_HOP_TABLE_INDEX.
+ * @return The status of the frequency over-ride, gXcvrInvalidConfiguration_c if ::XCVR_HopTableStart() was not called.
+ */
+xcvrStatus_t XCVR_HopToIndex(uint8_t index);
+
+/*!
+ * @brief Finds the Low Port settings closest to a frequency.
+ *
+ * This function searches the integer, numerator and denominator that synthesize the frequency with the smallest error,
+ * where ::XCVR_OverrideTxFrequency() always uses the largest denominator and rounds the numerator. The fraction is the
+ * best rational approximation with a denominator of at most 0x07FFFFFF, found from the continued fraction expansion of
+ * the requested fraction. Whole Hz frequencies are always synthesized exactly (error_uhz is 0).
+ *
+ * @param[in] freq_millihz Target frequency in mHz, in the 2360 MHz to 2487 MHz range.
+ * @param[out] solution Pointer to the Low Port settings and residual error found.
+ * @return Status of the call.
+ */
+xcvrStatus_t XCVR_SolvePllFrequency(uint64_t freq_millihz, xcvr_pll_solution_t *solution);
+
+/*!
+ * @brief Finds the Low Port settings of all channels of a channel plan.
+ *
+ * This function calls ::XCVR_SolvePllFrequency() for the count channels start_millihz + i * spacing_millihz, so that
+ * the settings of a channel plan are computed once ahead of time and applied with ::XCVR_OverridePllSolution().
+ *
+ * @param[in] start_millihz Frequency of the first channel in mHz.
+ * @param[in] spacing_millihz Channel spacing in mHz.
+ * @param[in] count Number of channels.
+ * @param[out] solutions Array of count solutions, one per channel.
+ * @return Status of the call, gXcvrInvalidParameters_c with no solution computed if a channel is out of range.
+ */
+xcvrStatus_t XCVR_SolvePllPlan(uint64_t start_millihz,
+                               uint64_t spacing_millihz,
+                               uint32_t count,
+                               xcvr_pll_solution_t *solutions);
+
+/*!
+ * @brief Set the frequency of a PLL solution for RX and TX.
+ *
+ * This function programs the Low Port settings found by ::XCVR_SolvePllFrequency() or ::XCVR_SolvePllPlan(). It
+ * overrides the PLL frequency the same way as ::XCVR_OverrideTxFrequency().
+ *
+ * @param[in] solution Pointer to the Low Port settings to program.
+ * @return Status of the call.
+ * @note The ::XCVR_ReleasePLLOverride() function must be called to release the PLL over-ride bits which are set by this
+ * function. This must be done before any other PLL channel or frequency over-ride function is used OR before the link
+ * layer channel control is used.
+ */
+xcvrStatus_t XCVR_OverridePllSolution(const xcvr_pll_solution_t *solution);
+
 /*!
  * @brief Releases any PLL channel/frequency over-rides.
  *
  * This function releases any over-rides controlling the PLL frequency and returns the PLL to Link Layer control. It
  * releases the overrides set by
- * ::XCVR_OverrideChannel, ::XCVR_OverrideCustomChannel, ::XCVR_OverrideRxFrequency, or ::XCVR_OverrideTxFrequency.
+ * ::XCVR_OverrideChannel, ::XCVR_OverrideCustomChannel, ::XCVR_OverrideRxFrequency, ::XCVR_OverrideTxFrequency,
+ * ::XCVR_OverridePllSolution, ::XCVR_HopTableStart, or ::XCVR_HopScheduleNext.
  *
  * @note This function must be called in between any mix of ::XCVR_OverrideChannel, ::XCVR_OverrideCustomChannel,
  * ::XCVR_OverrideRxFrequency, ::XCVR_OverrideTxFrequency usages. It must also be called in between any of these
@@ -1095,6 +1554,16 @@ void XCVR_ReleasePLLOverride(void);
 #endif /* defined(RADIO_IS_GEN_3P5)*/
 uint32_t XCVR_GetFreq ( void );
 
+/*!
+ * @brief Reads the current frequency for RX and TX for the radio, reusing the last result when the PLL is unchanged.
+ *
+ * This function returns the same frequency as ::XCVR_GetFreq(). It still reads the PLL settings in use but only
+ * recomputes the frequency when they differ from the ones of its previous call.
+ *
+ * @return Current radio frequency setting in Hz.
+ */
+uint32_t XCVR_GetFreqCached(void);
+
 
 /*!
  * @brief Force receiver warmup.
@@ -1155,6 +1624,44 @@ void XCVR_WaitTxWu ( void );
  */
 void XCVR_WaitRxTxWd(void);
 
+#if (gXcvrWarmupTrace_d == 1)
+/*!
+ * @brief Start the warmup trace.
+ *
+ * This function empties the warmup trace ring buffer and registers the timestamp source. Once gXcvrWarmupTrace_d is set
+ * to 1, each ::XCVR_WaitRxWu(), ::XCVR_WaitTxWu() and ::XCVR_WaitRxTxWd() call records one entry, overwriting the
+ * oldest one when the ring buffer is full. The trace is not interrupt safe, the forced sequences and the waits must
+ * run in one context.
+ *
+ * @param[in] timestamp_fptr  The timestamp callback, or NULLPTR to time the waits in wait loop iterations.
+ */
+void XCVR_WuTraceInit(xcvr_timestamp_fptr timestamp_fptr);
+
+/*!
+ * @brief Read the warmup trace.
+ *
+ * This function copies the entries of the warmup trace ring buffer, oldest first, without removing them.
+ *
+ * @param[out] entries  Pointer to the array receiving the entries.
+ * @param[in] max_entries  Size of the entries array.
+ * @return The number of entries copied, at most XCVR_WU_TRACE_SIZE.
+ */
+uint16_t XCVR_WuTraceRead(xcvr_wu_trace_entry_t *entries, uint16_t max_entries);
+
+/*!
+ * @brief Get the statistics of the warmup trace.
+ *
+ * This function computes the minimum, average, maximum and histogram of the durations of the entries of the warmup
+ * trace ring buffer for one sequence, on one channel or on all of them.
+ *
+ * @param[in] mode  The sequence.
+ * @param[in] freq_mhz  The PLL frequency in MHz of the entries, 0 for all of them. Warmdown entries have frequency 0.
+ * @param[out] stats  Pointer to the statistics.
+ * @return gXcvrInvalidParameters_c for an invalid sequence or a NULLPTR stats, gXcvrSuccess_c otherwise.
+ */
+xcvrStatus_t XCVR_WuTraceGetStats(xcvr_wu_trace_mode_t mode, uint16_t freq_mhz, xcvr_wu_trace_stats_t *stats);
+#endif /* (gXcvrWarmupTrace_d == 1) */
+
 /*!
  * @brief Starts transmit with a TX pattern register data sequence.
  *
@@ -1527,6 +2034,45 @@ bool XCVR_FastPeriph_WaitComplete(void);
  */
 bool XCVR_FastPeriph_CheckErrorComplete(void);
 
+/*!
+ * @brief Function to park a set of radio configurations in packet RAM for hardware driven mode switching.
+ *
+ * This function encodes each configuration with ::XCVR_RadioGenModeBankEncode() into consecutive PR2IPS descriptor and
+ * data lists in the selected packet RAM, starting at the given offset, and records where each one starts.
+ *
+ * @param[out] bank  Pointer to the mode bank to be filled.
+ * @param[in] pkt_ram_sel  The bank of PKT RAM to use; Zero means use TX PKT_RAM; 1 means use RX PKT_RAM.
+ * @param[in] offset_in_pkt_ram  The 32bit word offset within the chosen PKT_RAM bank where the mode bank starts.
+ * @param[in] xcvr_configs  Array of pointers to the combined XCVR settings structures to be parked.
+ * @param[in] num_modes  Number of configurations in xcvr_configs, at most ::XCVR_MODE_BANK_MAX_MODES.
+ *
+ * @return The status of the load, ::gXcvrInvalidParameters_c if the configurations do not fit in the PKT RAM.
+ *
+ * @note The PKT RAM area used by the bank must be reserved for it for as long as the bank is in use; it must not be
+ * used for packets, RSM steps or RSM backup/restore.
+ */
+xcvrStatus_t XCVR_ModeBankLoad(xcvr_mode_bank_t *bank,
+                               PKT_RAM_BANK_SEL_T pkt_ram_sel,
+                               uint16_t offset_in_pkt_ram,
+                               const xcvr_config_t **xcvr_configs,
+                               uint8_t num_modes);
+
+/*!
+ * @brief Function to change the radio mode from a configuration parked in a mode bank.
+ *
+ * This function programs the radio registers of one mode bank slot with a single PR2IPS upload and waits for its
+ * completion, then sets up the RBME. It is equivalent to ::XCVR_ChangeMode() for the configuration of that slot.
+ *
+ * @param[in] bank  Pointer to the mode bank loaded by ::XCVR_ModeBankLoad().
+ * @param[in] mode_idx  Index of the slot to switch to.
+ * @param[in] rbme_config  Pointer to a pointer to the complete RBME settings structure.
+ *
+ * @return The status of the mode change, ::gXcvrConfigurationFailure_c if the upload reported an error.
+ */
+xcvrStatus_t XCVR_ModeBankSwitch(const xcvr_mode_bank_t *bank,
+                                 uint8_t mode_idx,
+                                 const xcvr_coding_config_t **rbme_config);
+
 #endif /* defined(NXP_RADIO_GEN) && (NXP_RADIO_GEN >= 470) */
 
 
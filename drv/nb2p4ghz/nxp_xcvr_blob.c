@@ -0,0 +1,97 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stddef.h>
+#include "fsl_common.h"
+#include "nxp2p4_xcvr.h"
+#include "nxp_xcvr_mode_config.h"
+#include "nxp_xcvr_blob.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/* Reflected CRC-32 (IEEE 802.3) polynomial of the blob payload check */
+#define XCVR_BLOB_CRC_POLY (0xEDB88320U)
+
+/* Build time check, the array size is negative when the condition does not hold */
+#define XCVR_BLOB_STATIC_ASSERT(cond, name) typedef char xcvr_blob_assert_##name[(cond) ? 1 : -1]
+
+/* Sections are raw images of the configuration structures, copied and loaded in place as whole words */
+XCVR_BLOB_STATIC_ASSERT((sizeof(xcvr_common_config_t) % sizeof(uint32_t)) == 0U, common_size);
+XCVR_BLOB_STATIC_ASSERT((sizeof(xcvr_mode_datarate_config_t) % sizeof(uint32_t)) == 0U, mode_datarate_size);
+XCVR_BLOB_STATIC_ASSERT((sizeof(xcvr_coding_config_t) % sizeof(uint32_t)) == 0U, coding_size);
+/* The enum fields checked by XCVR_RadioGenBlobLoad() are whole, aligned words of the image */
+XCVR_BLOB_STATIC_ASSERT(sizeof(radio_mode_t) == sizeof(uint32_t), radio_mode_size);
+XCVR_BLOB_STATIC_ASSERT(sizeof(data_rate_t) == sizeof(uint32_t), data_rate_size);
+XCVR_BLOB_STATIC_ASSERT(sizeof(coding_t) == sizeof(uint32_t), coding_mode_size);
+XCVR_BLOB_STATIC_ASSERT((offsetof(xcvr_mode_datarate_config_t, radio_mode) % sizeof(uint32_t)) == 0U,
+                        radio_mode_offset);
+XCVR_BLOB_STATIC_ASSERT((offsetof(xcvr_mode_datarate_config_t, data_rate) % sizeof(uint32_t)) == 0U,
+                        data_rate_offset);
+XCVR_BLOB_STATIC_ASSERT((offsetof(xcvr_mode_datarate_config_t, alt_data_rate) % sizeof(uint32_t)) == 0U,
+                        alt_data_rate_offset);
+XCVR_BLOB_STATIC_ASSERT((offsetof(xcvr_coding_config_t, coding_mode) % sizeof(uint32_t)) == 0U, coding_mode_offset);
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+uint32_t XCVR_BlobCrc(const uint32_t *words, uint32_t num_words)
+{
+    uint32_t crc = 0xFFFFFFFFU;
+    uint32_t i;
+    uint8_t bit;
+
+    /* Bitwise reflected CRC-32, one word is its four bytes in little-endian order */
+    for (i = 0U; i < num_words; i++)
+    {
+        crc ^= words[i];
+        for (bit = 0U; bit < 32U; bit++)
+        {
+            if ((crc & 0x1U) != 0U)
+            {
+                crc = (crc >> 1U) ^ XCVR_BLOB_CRC_POLY;
+            }
+            else
+            {
+                crc >>= 1U;
+            }
+        }
+    }
+
+    return ~crc;
+}
+
+uint32_t XCVR_BlobAddSection(uint32_t *blob,
+                             uint32_t word_idx,
+                             uint32_t max_words,
+                             XCVR_BLOB_SECT_T type,
+                             const void *cfg,
+                             uint32_t cfg_words)
+{
+    const uint32_t *src = (const uint32_t *)cfg;
+    uint32_t i;
+    uint32_t next_idx = word_idx;
+
+    /* An absent configuration adds nothing, one that does not fit makes the size overflow max_words */
+    if (src != NULLPTR)
+    {
+        if ((word_idx + 1U + cfg_words) > max_words)
+        {
+            next_idx = max_words + 1U;
+        }
+        else
+        {
+            blob[word_idx] = XCVR_BLOB_SECT_HDR(type, cfg_words);
+            for (i = 0U; i < cfg_words; i++)
+            {
+                blob[word_idx + 1U + i] = src[i];
+            }
+            next_idx = word_idx + 1U + cfg_words;
+        }
+    }
+
+    return next_idx;
+}
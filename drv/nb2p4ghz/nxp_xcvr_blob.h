@@ -0,0 +1,86 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef NXP_XCVR_BLOB_H
+/* clang-format off */
+#define NXP_XCVR_BLOB_H
+/* clang-format on */
+
+#include "fsl_device_registers.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/*
+ * Radio configuration blob format, see ::XCVR_RadioGenBlobLoad(). A section is a raw memory image of a configuration
+ * structure, not a serialized format: it has the byte order, enum size and structure layout of the build which encoded
+ * it. A blob is only loaded by a build of the same radio generation and reference clock (::XCVR_BLOB_TARGET) and with
+ * the same structure sizes, the layout assumptions are checked at build time in nxp_xcvr_blob.c.
+ */
+#define XCVR_BLOB_MAGIC         (0x42564358U) /*!< "XCVB" in little-endian byte order */
+#define XCVR_BLOB_VERSION_MAJOR (1U)          /*!< Incremented for changes an older loader cannot read */
+#define XCVR_BLOB_VERSION_MINOR (0U)          /*!< Incremented for compatible additions such as new section types */
+#define XCVR_BLOB_VERSION       ((XCVR_BLOB_VERSION_MAJOR << 16U) | XCVR_BLOB_VERSION_MINOR)
+/*! @brief Radio generation (bits 15:0) and reference clock (bit 16 set for 26MHz) the blob was generated for. */
+#define XCVR_BLOB_TARGET ((uint32_t)NXP_RADIO_GEN | ((uint32_t)RF_OSC_26MHZ << 16U))
+
+/* Blob header, word indexes */
+#define XCVR_BLOB_HDR_MAGIC     (0U) /* ::XCVR_BLOB_MAGIC */
+#define XCVR_BLOB_HDR_VERSION   (1U) /* ::XCVR_BLOB_VERSION */
+#define XCVR_BLOB_HDR_TARGET    (2U) /* ::XCVR_BLOB_TARGET */
+#define XCVR_BLOB_HDR_NUM_WORDS (3U) /* Size of the blob in words, header included */
+#define XCVR_BLOB_HDR_CRC       (4U) /* CRC-32 (IEEE 802.3) of the bytes following the header */
+#define XCVR_BLOB_HDR_WORDS     (5U)
+
+/* Section header, section type and size of the section payload in words */
+#define XCVR_BLOB_SECT_TYPE_MASK   (0xFF000000U)
+#define XCVR_BLOB_SECT_TYPE_SHIFT  (24U)
+#define XCVR_BLOB_SECT_WORDS_MASK  (0x0000FFFFU)
+#define XCVR_BLOB_SECT_WORDS_SHIFT (0U)
+#define XCVR_BLOB_SECT_HDR(type, words)                                             \
+    ((((uint32_t)(type) << XCVR_BLOB_SECT_TYPE_SHIFT) & XCVR_BLOB_SECT_TYPE_MASK) | \
+     (((uint32_t)(words) << XCVR_BLOB_SECT_WORDS_SHIFT) & XCVR_BLOB_SECT_WORDS_MASK))
+
+/*! @brief Section types of a radio configuration blob, each present at most once. Unknown types are skipped. */
+typedef enum
+{
+    XCVR_BLOB_SECT_COMMON        = 1U, /*!< ::xcvr_common_config_t */
+    XCVR_BLOB_SECT_MODE_DATARATE = 2U, /*!< ::xcvr_mode_datarate_config_t */
+    XCVR_BLOB_SECT_CODING        = 3U, /*!< ::xcvr_coding_config_t */
+} XCVR_BLOB_SECT_T;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+/*!
+ * @brief Computes the CRC of a blob payload.
+ *
+ * @param[in] words  Pointer to the payload.
+ * @param[in] num_words  Number of words of the payload.
+ * @return Reflected CRC-32 (IEEE 802.3) of the payload bytes, in memory order on a little-endian target.
+ */
+uint32_t XCVR_BlobCrc(const uint32_t *words, uint32_t num_words);
+
+/*!
+ * @brief Appends a section to a blob.
+ *
+ * @param[out] blob  Pointer to the blob.
+ * @param[in] word_idx  Word index of the section header, the returned index of the previous section.
+ * @param[in] max_words  Number of words available at blob.
+ * @param[in] type  Section type.
+ * @param[in] cfg  Pointer to the configuration structure copied as the section payload. May be NULLPTR.
+ * @param[in] cfg_words  Size of the configuration structure in words.
+ * @return Word index following the section, word_idx if cfg is NULLPTR, greater than max_words if it does not fit.
+ */
+uint32_t XCVR_BlobAddSection(uint32_t *blob,
+                             uint32_t word_idx,
+                             uint32_t max_words,
+                             XCVR_BLOB_SECT_T type,
+                             const void *cfg,
+                             uint32_t cfg_words);
+
+#endif /* NXP_XCVR_BLOB_H */
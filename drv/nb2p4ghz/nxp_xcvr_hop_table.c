@@ -0,0 +1,537 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/* Generated by tools/xcvr_hop_table_gen.c, do not edit */
+
+#include "nxp_xcvr_hop_table.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#if (XCVR_HOP_TABLE_MIN_FREQ_HZ != 2360000000UL) || (XCVR_HOP_TABLE_STEP_HZ != 500000UL) || \
+    (XCVR_HOP_TABLE_NUM_ENTRIES != 255U) || (XCVR_HOP_TABLE_DENOM != 0x07FFFFFFUL)
+#error "Hop table generated for another range, step or denominator"
+#endif
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+/* {numerator, ctune_target, intpart} */
+const xcvr_pll_hop_entry_t xcvr_pll_hop_table[XCVR_HOP_TABLE_NUM_ENTRIES] = {
+#if RF_OSC_26MHZ == 1
+    {0x0313B13BU, 2360U, 45U}, /* 2360.0 MHz */
+    {0x03276276U, 2360U, 45U}, /* 2360.5 MHz */
+    {0x033B13B1U, 2361U, 45U}, /* 2361.0 MHz */
+    {0x034EC4ECU, 2361U, 45U}, /* 2361.5 MHz */
+    {0x03627627U, 2362U, 45U}, /* 2362.0 MHz */
+    {0x03762762U, 2362U, 45U}, /* 2362.5 MHz */
+    {0x0389D89DU, 2363U, 45U}, /* 2363.0 MHz */
+    {0x039D89D8U, 2363U, 45U}, /* 2363.5 MHz */
+    {0x03B13B13U, 2364U, 45U}, /* 2364.0 MHz */
+    {0x03C4EC4EU, 2364U, 45U}, /* 2364.5 MHz */
+    {0x03D89D89U, 2365U, 45U}, /* 2365.0 MHz */
+    {0x03EC4EC4U, 2365U, 45U}, /* 2365.5 MHz */
+    {0x04000000U, 2366U, 45U}, /* 2366.0 MHz */
+    {0xFC13B13CU, 2366U, 46U}, /* 2366.5 MHz */
+    {0xFC276277U, 2367U, 46U}, /* 2367.0 MHz */
+    {0xFC3B13B2U, 2367U, 46U}, /* 2367.5 MHz */
+    {0xFC4EC4EDU, 2368U, 46U}, /* 2368.0 MHz */
+    {0xFC627628U, 2368U, 46U}, /* 2368.5 MHz */
+    {0xFC762763U, 2369U, 46U}, /* 2369.0 MHz */
+    {0xFC89D89EU, 2369U, 46U}, /* 2369.5 MHz */
+    {0xFC9D89D9U, 2370U, 46U}, /* 2370.0 MHz */
+    {0xFCB13B14U, 2370U, 46U}, /* 2370.5 MHz */
+    {0xFCC4EC4FU, 2371U, 46U}, /* 2371.0 MHz */
+    {0xFCD89D8AU, 2371U, 46U}, /* 2371.5 MHz */
+    {0xFCEC4EC5U, 2372U, 46U}, /* 2372.0 MHz */
+    {0xFD000000U, 2372U, 46U}, /* 2372.5 MHz */
+    {0xFD13B13BU, 2373U, 46U}, /* 2373.0 MHz */
+    {0xFD276277U, 2373U, 46U}, /* 2373.5 MHz */
+    {0xFD3B13B2U, 2374U, 46U}, /* 2374.0 MHz */
+    {0xFD4EC4EDU, 2374U, 46U}, /* 2374.5 MHz */
+    {0xFD627628U, 2375U, 46U}, /* 2375.0 MHz */
+    {0xFD762763U, 2375U, 46U}, /* 2375.5 MHz */
+    {0xFD89D89EU, 2376U, 46U}, /* 2376.0 MHz */
+    {0xFD9D89D9U, 2376U, 46U}, /* 2376.5 MHz */
+    {0xFDB13B14U, 2377U, 46U}, /* 2377.0 MHz */
+    {0xFDC4EC4FU, 2377U, 46U}, /* 2377.5 MHz */
+    {0xFDD89D8AU, 2378U, 46U}, /* 2378.0 MHz */
+    {0xFDEC4EC5U, 2378U, 46U}, /* 2378.5 MHz */
+    {0xFE000000U, 2379U, 46U}, /* 2379.0 MHz */
+    {0xFE13B13BU, 2379U, 46U}, /* 2379.5 MHz */
+    {0xFE276276U, 2380U, 46U}, /* 2380.0 MHz */
+    {0xFE3B13B1U, 2380U, 46U}, /* 2380.5 MHz */
+    {0xFE4EC4EDU, 2381U, 46U}, /* 2381.0 MHz */
+    {0xFE627628U, 2381U, 46U}, /* 2381.5 MHz */
+    {0xFE762763U, 2382U, 46U}, /* 2382.0 MHz */
+    {0xFE89D89EU, 2382U, 46U}, /* 2382.5 MHz */
+    {0xFE9D89D9U, 2383U, 46U}, /* 2383.0 MHz */
+    {0xFEB13B14U, 2383U, 46U}, /* 2383.5 MHz */
+    {0xFEC4EC4FU, 2384U, 46U}, /* 2384.0 MHz */
+    {0xFED89D8AU, 2384U, 46U}, /* 2384.5 MHz */
+    {0xFEEC4EC5U, 2385U, 46U}, /* 2385.0 MHz */
+    {0xFF000000U, 2385U, 46U}, /* 2385.5 MHz */
+    {0xFF13B13BU, 2386U, 46U}, /* 2386.0 MHz */
+    {0xFF276276U, 2386U, 46U}, /* 2386.5 MHz */
+    {0xFF3B13B1U, 2387U, 46U}, /* 2387.0 MHz */
+    {0xFF4EC4ECU, 2387U, 46U}, /* 2387.5 MHz */
+    {0xFF627627U, 2388U, 46U}, /* 2388.0 MHz */
+    {0xFF762763U, 2388U, 46U}, /* 2388.5 MHz */
+    {0xFF89D89EU, 2389U, 46U}, /* 2389.0 MHz */
+    {0xFF9D89D9U, 2389U, 46U}, /* 2389.5 MHz */
+    {0xFFB13B14U, 2390U, 46U}, /* 2390.0 MHz */
+    {0xFFC4EC4FU, 2390U, 46U}, /* 2390.5 MHz */
+    {0xFFD89D8AU, 2391U, 46U}, /* 2391.0 MHz */
+    {0xFFEC4EC5U, 2391U, 46U}, /* 2391.5 MHz */
+    {0x00000000U, 2392U, 46U}, /* 2392.0 MHz */
+    {0x0013B13BU, 2392U, 46U}, /* 2392.5 MHz */
+    {0x00276276U, 2393U, 46U}, /* 2393.0 MHz */
+    {0x003B13B1U, 2393U, 46U}, /* 2393.5 MHz */
+    {0x004EC4ECU, 2394U, 46U}, /* 2394.0 MHz */
+    {0x00627627U, 2394U, 46U}, /* 2394.5 MHz */
+    {0x00762762U, 2395U, 46U}, /* 2395.0 MHz */
+    {0x0089D89DU, 2395U, 46U}, /* 2395.5 MHz */
+    {0x009D89D9U, 2396U, 46U}, /* 2396.0 MHz */
+    {0x00B13B14U, 2396U, 46U}, /* 2396.5 MHz */
+    {0x00C4EC4FU, 2397U, 46U}, /* 2397.0 MHz */
+    {0x00D89D8AU, 2397U, 46U}, /* 2397.5 MHz */
+    {0x00EC4EC5U, 2398U, 46U}, /* 2398.0 MHz */
+    {0x01000000U, 2398U, 46U}, /* 2398.5 MHz */
+    {0x0113B13BU, 2399U, 46U}, /* 2399.0 MHz */
+    {0x01276276U, 2399U, 46U}, /* 2399.5 MHz */
+    {0x013B13B1U, 2400U, 46U}, /* 2400.0 MHz */
+    {0x014EC4ECU, 2400U, 46U}, /* 2400.5 MHz */
+    {0x01627627U, 2401U, 46U}, /* 2401.0 MHz */
+    {0x01762762U, 2401U, 46U}, /* 2401.5 MHz */
+    {0x0189D89DU, 2402U, 46U}, /* 2402.0 MHz */
+    {0x019D89D8U, 2402U, 46U}, /* 2402.5 MHz */
+    {0x01B13B13U, 2403U, 46U}, /* 2403.0 MHz */
+    {0x01C4EC4FU, 2403U, 46U}, /* 2403.5 MHz */
+    {0x01D89D8AU, 2404U, 46U}, /* 2404.0 MHz */
+    {0x01EC4EC5U, 2404U, 46U}, /* 2404.5 MHz */
+    {0x02000000U, 2405U, 46U}, /* 2405.0 MHz */
+    {0x0213B13BU, 2405U, 46U}, /* 2405.5 MHz */
+    {0x02276276U, 2406U, 46U}, /* 2406.0 MHz */
+    {0x023B13B1U, 2406U, 46U}, /* 2406.5 MHz */
+    {0x024EC4ECU, 2407U, 46U}, /* 2407.0 MHz */
+    {0x02627627U, 2407U, 46U}, /* 2407.5 MHz */
+    {0x02762762U, 2408U, 46U}, /* 2408.0 MHz */
+    {0x0289D89DU, 2408U, 46U}, /* 2408.5 MHz */
+    {0x029D89D8U, 2409U, 46U}, /* 2409.0 MHz */
+    {0x02B13B13U, 2409U, 46U}, /* 2409.5 MHz */
+    {0x02C4EC4EU, 2410U, 46U}, /* 2410.0 MHz */
+    {0x02D89D89U, 2410U, 46U}, /* 2410.5 MHz */
+    {0x02EC4EC5U, 2411U, 46U}, /* 2411.0 MHz */
+    {0x03000000U, 2411U, 46U}, /* 2411.5 MHz */
+    {0x0313B13BU, 2412U, 46U}, /* 2412.0 MHz */
+    {0x03276276U, 2412U, 46U}, /* 2412.5 MHz */
+    {0x033B13B1U, 2413U, 46U}, /* 2413.0 MHz */
+    {0x034EC4ECU, 2413U, 46U}, /* 2413.5 MHz */
+    {0x03627627U, 2414U, 46U}, /* 2414.0 MHz */
+    {0x03762762U, 2414U, 46U}, /* 2414.5 MHz */
+    {0x0389D89DU, 2415U, 46U}, /* 2415.0 MHz */
+    {0x039D89D8U, 2415U, 46U}, /* 2415.5 MHz */
+    {0x03B13B13U, 2416U, 46U}, /* 2416.0 MHz */
+    {0x03C4EC4EU, 2416U, 46U}, /* 2416.5 MHz */
+    {0x03D89D89U, 2417U, 46U}, /* 2417.0 MHz */
+    {0x03EC4EC4U, 2417U, 46U}, /* 2417.5 MHz */
+    {0x04000000U, 2418U, 46U}, /* 2418.0 MHz */
+    {0xFC13B13CU, 2418U, 47U}, /* 2418.5 MHz */
+    {0xFC276277U, 2419U, 47U}, /* 2419.0 MHz */
+    {0xFC3B13B2U, 2419U, 47U}, /* 2419.5 MHz */
+    {0xFC4EC4EDU, 2420U, 47U}, /* 2420.0 MHz */
+    {0xFC627628U, 2420U, 47U}, /* 2420.5 MHz */
+    {0xFC762763U, 2421U, 47U}, /* 2421.0 MHz */
+    {0xFC89D89EU, 2421U, 47U}, /* 2421.5 MHz */
+    {0xFC9D89D9U, 2422U, 47U}, /* 2422.0 MHz */
+    {0xFCB13B14U, 2422U, 47U}, /* 2422.5 MHz */
+    {0xFCC4EC4FU, 2423U, 47U}, /* 2423.0 MHz */
+    {0xFCD89D8AU, 2423U, 47U}, /* 2423.5 MHz */
+    {0xFCEC4EC5U, 2424U, 47U}, /* 2424.0 MHz */
+    {0xFD000000U, 2424U, 47U}, /* 2424.5 MHz */
+    {0xFD13B13BU, 2425U, 47U}, /* 2425.0 MHz */
+    {0xFD276277U, 2425U, 47U}, /* 2425.5 MHz */
+    {0xFD3B13B2U, 2426U, 47U}, /* 2426.0 MHz */
+    {0xFD4EC4EDU, 2426U, 47U}, /* 2426.5 MHz */
+    {0xFD627628U, 2427U, 47U}, /* 2427.0 MHz */
+    {0xFD762763U, 2427U, 47U}, /* 2427.5 MHz */
+    {0xFD89D89EU, 2428U, 47U}, /* 2428.0 MHz */
+    {0xFD9D89D9U, 2428U, 47U}, /* 2428.5 MHz */
+    {0xFDB13B14U, 2429U, 47U}, /* 2429.0 MHz */
+    {0xFDC4EC4FU, 2429U, 47U}, /* 2429.5 MHz */
+    {0xFDD89D8AU, 2430U, 47U}, /* 2430.0 MHz */
+    {0xFDEC4EC5U, 2430U, 47U}, /* 2430.5 MHz */
+    {0xFE000000U, 2431U, 47U}, /* 2431.0 MHz */
+    {0xFE13B13BU, 2431U, 47U}, /* 2431.5 MHz */
+    {0xFE276276U, 2432U, 47U}, /* 2432.0 MHz */
+    {0xFE3B13B1U, 2432U, 47U}, /* 2432.5 MHz */
+    {0xFE4EC4EDU, 2433U, 47U}, /* 2433.0 MHz */
+    {0xFE627628U, 2433U, 47U}, /* 2433.5 MHz */
+    {0xFE762763U, 2434U, 47U}, /* 2434.0 MHz */
+    {0xFE89D89EU, 2434U, 47U}, /* 2434.5 MHz */
+    {0xFE9D89D9U, 2435U, 47U}, /* 2435.0 MHz */
+    {0xFEB13B14U, 2435U, 47U}, /* 2435.5 MHz */
+    {0xFEC4EC4FU, 2436U, 47U}, /* 2436.0 MHz */
+    {0xFED89D8AU, 2436U, 47U}, /* 2436.5 MHz */
+    {0xFEEC4EC5U, 2437U, 47U}, /* 2437.0 MHz */
+    {0xFF000000U, 2437U, 47U}, /* 2437.5 MHz */
+    {0xFF13B13BU, 2438U, 47U}, /* 2438.0 MHz */
+    {0xFF276276U, 2438U, 47U}, /* 2438.5 MHz */
+    {0xFF3B13B1U, 2439U, 47U}, /* 2439.0 MHz */
+    {0xFF4EC4ECU, 2439U, 47U}, /* 2439.5 MHz */
+    {0xFF627627U, 2440U, 47U}, /* 2440.0 MHz */
+    {0xFF762763U, 2440U, 47U}, /* 2440.5 MHz */
+    {0xFF89D89EU, 2441U, 47U}, /* 2441.0 MHz */
+    {0xFF9D89D9U, 2441U, 47U}, /* 2441.5 MHz */
+    {0xFFB13B14U, 2442U, 47U}, /* 2442.0 MHz */
+    {0xFFC4EC4FU, 2442U, 47U}, /* 2442.5 MHz */
+    {0xFFD89D8AU, 2443U, 47U}, /* 2443.0 MHz */
+    {0xFFEC4EC5U, 2443U, 47U}, /* 2443.5 MHz */
+    {0x00000000U, 2444U, 47U}, /* 2444.0 MHz */
+    {0x0013B13BU, 2444U, 47U}, /* 2444.5 MHz */
+    {0x00276276U, 2445U, 47U}, /* 2445.0 MHz */
+    {0x003B13B1U, 2445U, 47U}, /* 2445.5 MHz */
+    {0x004EC4ECU, 2446U, 47U}, /* 2446.0 MHz */
+    {0x00627627U, 2446U, 47U}, /* 2446.5 MHz */
+    {0x00762762U, 2447U, 47U}, /* 2447.0 MHz */
+    {0x0089D89DU, 2447U, 47U}, /* 2447.5 MHz */
+    {0x009D89D9U, 2448U, 47U}, /* 2448.0 MHz */
+    {0x00B13B14U, 2448U, 47U}, /* 2448.5 MHz */
+    {0x00C4EC4FU, 2449U, 47U}, /* 2449.0 MHz */
+    {0x00D89D8AU, 2449U, 47U}, /* 2449.5 MHz */
+    {0x00EC4EC5U, 2450U, 47U}, /* 2450.0 MHz */
+    {0x01000000U, 2450U, 47U}, /* 2450.5 MHz */
+    {0x0113B13BU, 2451U, 47U}, /* 2451.0 MHz */
+    {0x01276276U, 2451U, 47U}, /* 2451.5 MHz */
+    {0x013B13B1U, 2452U, 47U}, /* 2452.0 MHz */
+    {0x014EC4ECU, 2452U, 47U}, /* 2452.5 MHz */
+    {0x01627627U, 2453U, 47U}, /* 2453.0 MHz */
+    {0x01762762U, 2453U, 47U}, /* 2453.5 MHz */
+    {0x0189D89DU, 2454U, 47U}, /* 2454.0 MHz */
+    {0x019D89D8U, 2454U, 47U}, /* 2454.5 MHz */
+    {0x01B13B13U, 2455U, 47U}, /* 2455.0 MHz */
+    {0x01C4EC4FU, 2455U, 47U}, /* 2455.5 MHz */
+    {0x01D89D8AU, 2456U, 47U}, /* 2456.0 MHz */
+    {0x01EC4EC5U, 2456U, 47U}, /* 2456.5 MHz */
+    {0x02000000U, 2457U, 47U}, /* 2457.0 MHz */
+    {0x0213B13BU, 2457U, 47U}, /* 2457.5 MHz */
+    {0x02276276U, 2458U, 47U}, /* 2458.0 MHz */
+    {0x023B13B1U, 2458U, 47U}, /* 2458.5 MHz */
+    {0x024EC4ECU, 2459U, 47U}, /* 2459.0 MHz */
+    {0x02627627U, 2459U, 47U}, /* 2459.5 MHz */
+    {0x02762762U, 2460U, 47U}, /* 2460.0 MHz */
+    {0x0289D89DU, 2460U, 47U}, /* 2460.5 MHz */
+    {0x029D89D8U, 2461U, 47U}, /* 2461.0 MHz */
+    {0x02B13B13U, 2461U, 47U}, /* 2461.5 MHz */
+    {0x02C4EC4EU, 2462U, 47U}, /* 2462.0 MHz */
+    {0x02D89D89U, 2462U, 47U}, /* 2462.5 MHz */
+    {0x02EC4EC5U, 2463U, 47U}, /* 2463.0 MHz */
+    {0x03000000U, 2463U, 47U}, /* 2463.5 MHz */
+    {0x0313B13BU, 2464U, 47U}, /* 2464.0 MHz */
+    {0x03276276U, 2464U, 47U}, /* 2464.5 MHz */
+    {0x033B13B1U, 2465U, 47U}, /* 2465.0 MHz */
+    {0x034EC4ECU, 2465U, 47U}, /* 2465.5 MHz */
+    {0x03627627U, 2466U, 47U}, /* 2466.0 MHz */
+    {0x03762762U, 2466U, 47U}, /* 2466.5 MHz */
+    {0x0389D89DU, 2467U, 47U}, /* 2467.0 MHz */
+    {0x039D89D8U, 2467U, 47U}, /* 2467.5 MHz */
+    {0x03B13B13U, 2468U, 47U}, /* 2468.0 MHz */
+    {0x03C4EC4EU, 2468U, 47U}, /* 2468.5 MHz */
+    {0x03D89D89U, 2469U, 47U}, /* 2469.0 MHz */
+    {0x03EC4EC4U, 2469U, 47U}, /* 2469.5 MHz */
+    {0x04000000U, 2470U, 47U}, /* 2470.0 MHz */
+    {0xFC13B13CU, 2470U, 48U}, /* 2470.5 MHz */
+    {0xFC276277U, 2471U, 48U}, /* 2471.0 MHz */
+    {0xFC3B13B2U, 2471U, 48U}, /* 2471.5 MHz */
+    {0xFC4EC4EDU, 2472U, 48U}, /* 2472.0 MHz */
+    {0xFC627628U, 2472U, 48U}, /* 2472.5 MHz */
+    {0xFC762763U, 2473U, 48U}, /* 2473.0 MHz */
+    {0xFC89D89EU, 2473U, 48U}, /* 2473.5 MHz */
+    {0xFC9D89D9U, 2474U, 48U}, /* 2474.0 MHz */
+    {0xFCB13B14U, 2474U, 48U}, /* 2474.5 MHz */
+    {0xFCC4EC4FU, 2475U, 48U}, /* 2475.0 MHz */
+    {0xFCD89D8AU, 2475U, 48U}, /* 2475.5 MHz */
+    {0xFCEC4EC5U, 2476U, 48U}, /* 2476.0 MHz */
+    {0xFD000000U, 2476U, 48U}, /* 2476.5 MHz */
+    {0xFD13B13BU, 2477U, 48U}, /* 2477.0 MHz */
+    {0xFD276277U, 2477U, 48U}, /* 2477.5 MHz */
+    {0xFD3B13B2U, 2478U, 48U}, /* 2478.0 MHz */
+    {0xFD4EC4EDU, 2478U, 48U}, /* 2478.5 MHz */
+    {0xFD627628U, 2479U, 48U}, /* 2479.0 MHz */
+    {0xFD762763U, 2479U, 48U}, /* 2479.5 MHz */
+    {0xFD89D89EU, 2480U, 48U}, /* 2480.0 MHz */
+    {0xFD9D89D9U, 2480U, 48U}, /* 2480.5 MHz */
+    {0xFDB13B14U, 2481U, 48U}, /* 2481.0 MHz */
+    {0xFDC4EC4FU, 2481U, 48U}, /* 2481.5 MHz */
+    {0xFDD89D8AU, 2482U, 48U}, /* 2482.0 MHz */
+    {0xFDEC4EC5U, 2482U, 48U}, /* 2482.5 MHz */
+    {0xFE000000U, 2483U, 48U}, /* 2483.0 MHz */
+    {0xFE13B13BU, 2483U, 48U}, /* 2483.5 MHz */
+    {0xFE276276U, 2484U, 48U}, /* 2484.0 MHz */
+    {0xFE3B13B1U, 2484U, 48U}, /* 2484.5 MHz */
+    {0xFE4EC4EDU, 2485U, 48U}, /* 2485.0 MHz */
+    {0xFE627628U, 2485U, 48U}, /* 2485.5 MHz */
+    {0xFE762763U, 2486U, 48U}, /* 2486.0 MHz */
+    {0xFE89D89EU, 2486U, 48U}, /* 2486.5 MHz */
+    {0xFE9D89D9U, 2487U, 48U}, /* 2487.0 MHz */
+#else
+    {0xFF000000U, 2360U, 37U}, /* 2360.0 MHz */
+    {0xFF100000U, 2360U, 37U}, /* 2360.5 MHz */
+    {0xFF200000U, 2361U, 37U}, /* 2361.0 MHz */
+    {0xFF300000U, 2361U, 37U}, /* 2361.5 MHz */
+    {0xFF400000U, 2362U, 37U}, /* 2362.0 MHz */
+    {0xFF500000U, 2362U, 37U}, /* 2362.5 MHz */
+    {0xFF600000U, 2363U, 37U}, /* 2363.0 MHz */
+    {0xFF700000U, 2363U, 37U}, /* 2363.5 MHz */
+    {0xFF800000U, 2364U, 37U}, /* 2364.0 MHz */
+    {0xFF900000U, 2364U, 37U}, /* 2364.5 MHz */
+    {0xFFA00000U, 2365U, 37U}, /* 2365.0 MHz */
+    {0xFFB00000U, 2365U, 37U}, /* 2365.5 MHz */
+    {0xFFC00000U, 2366U, 37U}, /* 2366.0 MHz */
+    {0xFFD00000U, 2366U, 37U}, /* 2366.5 MHz */
+    {0xFFE00000U, 2367U, 37U}, /* 2367.0 MHz */
+    {0xFFF00000U, 2367U, 37U}, /* 2367.5 MHz */
+    {0x00000000U, 2368U, 37U}, /* 2368.0 MHz */
+    {0x00100000U, 2368U, 37U}, /* 2368.5 MHz */
+    {0x00200000U, 2369U, 37U}, /* 2369.0 MHz */
+    {0x00300000U, 2369U, 37U}, /* 2369.5 MHz */
+    {0x00400000U, 2370U, 37U}, /* 2370.0 MHz */
+    {0x00500000U, 2370U, 37U}, /* 2370.5 MHz */
+    {0x00600000U, 2371U, 37U}, /* 2371.0 MHz */
+    {0x00700000U, 2371U, 37U}, /* 2371.5 MHz */
+    {0x00800000U, 2372U, 37U}, /* 2372.0 MHz */
+    {0x00900000U, 2372U, 37U}, /* 2372.5 MHz */
+    {0x00A00000U, 2373U, 37U}, /* 2373.0 MHz */
+    {0x00B00000U, 2373U, 37U}, /* 2373.5 MHz */
+    {0x00C00000U, 2374U, 37U}, /* 2374.0 MHz */
+    {0x00D00000U, 2374U, 37U}, /* 2374.5 MHz */
+    {0x00E00000U, 2375U, 37U}, /* 2375.0 MHz */
+    {0x00F00000U, 2375U, 37U}, /* 2375.5 MHz */
+    {0x01000000U, 2376U, 37U}, /* 2376.0 MHz */
+    {0x01100000U, 2376U, 37U}, /* 2376.5 MHz */
+    {0x01200000U, 2377U, 37U}, /* 2377.0 MHz */
+    {0x01300000U, 2377U, 37U}, /* 2377.5 MHz */
+    {0x01400000U, 2378U, 37U}, /* 2378.0 MHz */
+    {0x01500000U, 2378U, 37U}, /* 2378.5 MHz */
+    {0x01600000U, 2379U, 37U}, /* 2379.0 MHz */
+    {0x01700000U, 2379U, 37U}, /* 2379.5 MHz */
+    {0x01800000U, 2380U, 37U}, /* 2380.0 MHz */
+    {0x01900000U, 2380U, 37U}, /* 2380.5 MHz */
+    {0x01A00000U, 2381U, 37U}, /* 2381.0 MHz */
+    {0x01B00000U, 2381U, 37U}, /* 2381.5 MHz */
+    {0x01C00000U, 2382U, 37U}, /* 2382.0 MHz */
+    {0x01D00000U, 2382U, 37U}, /* 2382.5 MHz */
+    {0x01E00000U, 2383U, 37U}, /* 2383.0 MHz */
+    {0x01F00000U, 2383U, 37U}, /* 2383.5 MHz */
+    {0x02000000U, 2384U, 37U}, /* 2384.0 MHz */
+    {0x02100000U, 2384U, 37U}, /* 2384.5 MHz */
+    {0x02200000U, 2385U, 37U}, /* 2385.0 MHz */
+    {0x02300000U, 2385U, 37U}, /* 2385.5 MHz */
+    {0x02400000U, 2386U, 37U}, /* 2386.0 MHz */
+    {0x02500000U, 2386U, 37U}, /* 2386.5 MHz */
+    {0x02600000U, 2387U, 37U}, /* 2387.0 MHz */
+    {0x02700000U, 2387U, 37U}, /* 2387.5 MHz */
+    {0x02800000U, 2388U, 37U}, /* 2388.0 MHz */
+    {0x02900000U, 2388U, 37U}, /* 2388.5 MHz */
+    {0x02A00000U, 2389U, 37U}, /* 2389.0 MHz */
+    {0x02B00000U, 2389U, 37U}, /* 2389.5 MHz */
+    {0x02C00000U, 2390U, 37U}, /* 2390.0 MHz */
+    {0x02D00000U, 2390U, 37U}, /* 2390.5 MHz */
+    {0x02E00000U, 2391U, 37U}, /* 2391.0 MHz */
+    {0x02F00000U, 2391U, 37U}, /* 2391.5 MHz */
+    {0x03000000U, 2392U, 37U}, /* 2392.0 MHz */
+    {0x03100000U, 2392U, 37U}, /* 2392.5 MHz */
+    {0x03200000U, 2393U, 37U}, /* 2393.0 MHz */
+    {0x03300000U, 2393U, 37U}, /* 2393.5 MHz */
+    {0x03400000U, 2394U, 37U}, /* 2394.0 MHz */
+    {0x03500000U, 2394U, 37U}, /* 2394.5 MHz */
+    {0x03600000U, 2395U, 37U}, /* 2395.0 MHz */
+    {0x03700000U, 2395U, 37U}, /* 2395.5 MHz */
+    {0x03800000U, 2396U, 37U}, /* 2396.0 MHz */
+    {0x03900000U, 2396U, 37U}, /* 2396.5 MHz */
+    {0x03A00000U, 2397U, 37U}, /* 2397.0 MHz */
+    {0x03B00000U, 2397U, 37U}, /* 2397.5 MHz */
+    {0x03C00000U, 2398U, 37U}, /* 2398.0 MHz */
+    {0x03D00000U, 2398U, 37U}, /* 2398.5 MHz */
+    {0x03E00000U, 2399U, 37U}, /* 2399.0 MHz */
+    {0x03F00000U, 2399U, 37U}, /* 2399.5 MHz */
+    {0x04000000U, 2400U, 37U}, /* 2400.0 MHz */
+    {0xFC100000U, 2400U, 38U}, /* 2400.5 MHz */
+    {0xFC200000U, 2401U, 38U}, /* 2401.0 MHz */
+    {0xFC300000U, 2401U, 38U}, /* 2401.5 MHz */
+    {0xFC400000U, 2402U, 38U}, /* 2402.0 MHz */
+    {0xFC500000U, 2402U, 38U}, /* 2402.5 MHz */
+    {0xFC600000U, 2403U, 38U}, /* 2403.0 MHz */
+    {0xFC700000U, 2403U, 38U}, /* 2403.5 MHz */
+    {0xFC800000U, 2404U, 38U}, /* 2404.0 MHz */
+    {0xFC900000U, 2404U, 38U}, /* 2404.5 MHz */
+    {0xFCA00000U, 2405U, 38U}, /* 2405.0 MHz */
+    {0xFCB00000U, 2405U, 38U}, /* 2405.5 MHz */
+    {0xFCC00000U, 2406U, 38U}, /* 2406.0 MHz */
+    {0xFCD00000U, 2406U, 38U}, /* 2406.5 MHz */
+    {0xFCE00000U, 2407U, 38U}, /* 2407.0 MHz */
+    {0xFCF00000U, 2407U, 38U}, /* 2407.5 MHz */
+    {0xFD000000U, 2408U, 38U}, /* 2408.0 MHz */
+    {0xFD100000U, 2408U, 38U}, /* 2408.5 MHz */
+    {0xFD200000U, 2409U, 38U}, /* 2409.0 MHz */
+    {0xFD300000U, 2409U, 38U}, /* 2409.5 MHz */
+    {0xFD400000U, 2410U, 38U}, /* 2410.0 MHz */
+    {0xFD500000U, 2410U, 38U}, /* 2410.5 MHz */
+    {0xFD600000U, 2411U, 38U}, /* 2411.0 MHz */
+    {0xFD700000U, 2411U, 38U}, /* 2411.5 MHz */
+    {0xFD800000U, 2412U, 38U}, /* 2412.0 MHz */
+    {0xFD900000U, 2412U, 38U}, /* 2412.5 MHz */
+    {0xFDA00000U, 2413U, 38U}, /* 2413.0 MHz */
+    {0xFDB00000U, 2413U, 38U}, /* 2413.5 MHz */
+    {0xFDC00000U, 2414U, 38U}, /* 2414.0 MHz */
+    {0xFDD00000U, 2414U, 38U}, /* 2414.5 MHz */
+    {0xFDE00000U, 2415U, 38U}, /* 2415.0 MHz */
+    {0xFDF00000U, 2415U, 38U}, /* 2415.5 MHz */
+    {0xFE000000U, 2416U, 38U}, /* 2416.0 MHz */
+    {0xFE100000U, 2416U, 38U}, /* 2416.5 MHz */
+    {0xFE200000U, 2417U, 38U}, /* 2417.0 MHz */
+    {0xFE300000U, 2417U, 38U}, /* 2417.5 MHz */
+    {0xFE400000U, 2418U, 38U}, /* 2418.0 MHz */
+    {0xFE500000U, 2418U, 38U}, /* 2418.5 MHz */
+    {0xFE600000U, 2419U, 38U}, /* 2419.0 MHz */
+    {0xFE700000U, 2419U, 38U}, /* 2419.5 MHz */
+    {0xFE800000U, 2420U, 38U}, /* 2420.0 MHz */
+    {0xFE900000U, 2420U, 38U}, /* 2420.5 MHz */
+    {0xFEA00000U, 2421U, 38U}, /* 2421.0 MHz */
+    {0xFEB00000U, 2421U, 38U}, /* 2421.5 MHz */
+    {0xFEC00000U, 2422U, 38U}, /* 2422.0 MHz */
+    {0xFED00000U, 2422U, 38U}, /* 2422.5 MHz */
+    {0xFEE00000U, 2423U, 38U}, /* 2423.0 MHz */
+    {0xFEF00000U, 2423U, 38U}, /* 2423.5 MHz */
+    {0xFF000000U, 2424U, 38U}, /* 2424.0 MHz */
+    {0xFF100000U, 2424U, 38U}, /* 2424.5 MHz */
+    {0xFF200000U, 2425U, 38U}, /* 2425.0 MHz */
+    {0xFF300000U, 2425U, 38U}, /* 2425.5 MHz */
+    {0xFF400000U, 2426U, 38U}, /* 2426.0 MHz */
+    {0xFF500000U, 2426U, 38U}, /* 2426.5 MHz */
+    {0xFF600000U, 2427U, 38U}, /* 2427.0 MHz */
+    {0xFF700000U, 2427U, 38U}, /* 2427.5 MHz */
+    {0xFF800000U, 2428U, 38U}, /* 2428.0 MHz */
+    {0xFF900000U, 2428U, 38U}, /* 2428.5 MHz */
+    {0xFFA00000U, 2429U, 38U}, /* 2429.0 MHz */
+    {0xFFB00000U, 2429U, 38U}, /* 2429.5 MHz */
+    {0xFFC00000U, 2430U, 38U}, /* 2430.0 MHz */
+    {0xFFD00000U, 2430U, 38U}, /* 2430.5 MHz */
+    {0xFFE00000U, 2431U, 38U}, /* 2431.0 MHz */
+    {0xFFF00000U, 2431U, 38U}, /* 2431.5 MHz */
+    {0x00000000U, 2432U, 38U}, /* 2432.0 MHz */
+    {0x00100000U, 2432U, 38U}, /* 2432.5 MHz */
+    {0x00200000U, 2433U, 38U}, /* 2433.0 MHz */
+    {0x00300000U, 2433U, 38U}, /* 2433.5 MHz */
+    {0x00400000U, 2434U, 38U}, /* 2434.0 MHz */
+    {0x00500000U, 2434U, 38U}, /* 2434.5 MHz */
+    {0x00600000U, 2435U, 38U}, /* 2435.0 MHz */
+    {0x00700000U, 2435U, 38U}, /* 2435.5 MHz */
+    {0x00800000U, 2436U, 38U}, /* 2436.0 MHz */
+    {0x00900000U, 2436U, 38U}, /* 2436.5 MHz */
+    {0x00A00000U, 2437U, 38U}, /* 2437.0 MHz */
+    {0x00B00000U, 2437U, 38U}, /* 2437.5 MHz */
+    {0x00C00000U, 2438U, 38U}, /* 2438.0 MHz */
+    {0x00D00000U, 2438U, 38U}, /* 2438.5 MHz */
+    {0x00E00000U, 2439U, 38U}, /* 2439.0 MHz */
+    {0x00F00000U, 2439U, 38U}, /* 2439.5 MHz */
+    {0x01000000U, 2440U, 38U}, /* 2440.0 MHz */
+    {0x01100000U, 2440U, 38U}, /* 2440.5 MHz */
+    {0x01200000U, 2441U, 38U}, /* 2441.0 MHz */
+    {0x01300000U, 2441U, 38U}, /* 2441.5 MHz */
+    {0x01400000U, 2442U, 38U}, /* 2442.0 MHz */
+    {0x01500000U, 2442U, 38U}, /* 2442.5 MHz */
+    {0x01600000U, 2443U, 38U}, /* 2443.0 MHz */
+    {0x01700000U, 2443U, 38U}, /* 2443.5 MHz */
+    {0x01800000U, 2444U, 38U}, /* 2444.0 MHz */
+    {0x01900000U, 2444U, 38U}, /* 2444.5 MHz */
+    {0x01A00000U, 2445U, 38U}, /* 2445.0 MHz */
+    {0x01B00000U, 2445U, 38U}, /* 2445.5 MHz */
+    {0x01C00000U, 2446U, 38U}, /* 2446.0 MHz */
+    {0x01D00000U, 2446U, 38U}, /* 2446.5 MHz */
+    {0x01E00000U, 2447U, 38U}, /* 2447.0 MHz */
+    {0x01F00000U, 2447U, 38U}, /* 2447.5 MHz */
+    {0x02000000U, 2448U, 38U}, /* 2448.0 MHz */
+    {0x02100000U, 2448U, 38U}, /* 2448.5 MHz */
+    {0x02200000U, 2449U, 38U}, /* 2449.0 MHz */
+    {0x02300000U, 2449U, 38U}, /* 2449.5 MHz */
+    {0x02400000U, 2450U, 38U}, /* 2450.0 MHz */
+    {0x02500000U, 2450U, 38U}, /* 2450.5 MHz */
+    {0x02600000U, 2451U, 38U}, /* 2451.0 MHz */
+    {0x02700000U, 2451U, 38U}, /* 2451.5 MHz */
+    {0x02800000U, 2452U, 38U}, /* 2452.0 MHz */
+    {0x02900000U, 2452U, 38U}, /* 2452.5 MHz */
+    {0x02A00000U, 2453U, 38U}, /* 2453.0 MHz */
+    {0x02B00000U, 2453U, 38U}, /* 2453.5 MHz */
+    {0x02C00000U, 2454U, 38U}, /* 2454.0 MHz */
+    {0x02D00000U, 2454U, 38U}, /* 2454.5 MHz */
+    {0x02E00000U, 2455U, 38U}, /* 2455.0 MHz */
+    {0x02F00000U, 2455U, 38U}, /* 2455.5 MHz */
+    {0x03000000U, 2456U, 38U}, /* 2456.0 MHz */
+    {0x03100000U, 2456U, 38U}, /* 2456.5 MHz */
+    {0x03200000U, 2457U, 38U}, /* 2457.0 MHz */
+    {0x03300000U, 2457U, 38U}, /* 2457.5 MHz */
+    {0x03400000U, 2458U, 38U}, /* 2458.0 MHz */
+    {0x03500000U, 2458U, 38U}, /* 2458.5 MHz */
+    {0x03600000U, 2459U, 38U}, /* 2459.0 MHz */
+    {0x03700000U, 2459U, 38U}, /* 2459.5 MHz */
+    {0x03800000U, 2460U, 38U}, /* 2460.0 MHz */
+    {0x03900000U, 2460U, 38U}, /* 2460.5 MHz */
+    {0x03A00000U, 2461U, 38U}, /* 2461.0 MHz */
+    {0x03B00000U, 2461U, 38U}, /* 2461.5 MHz */
+    {0x03C00000U, 2462U, 38U}, /* 2462.0 MHz */
+    {0x03D00000U, 2462U, 38U}, /* 2462.5 MHz */
+    {0x03E00000U, 2463U, 38U}, /* 2463.0 MHz */
+    {0x03F00000U, 2463U, 38U}, /* 2463.5 MHz */
+    {0x04000000U, 2464U, 38U}, /* 2464.0 MHz */
+    {0xFC100000U, 2464U, 39U}, /* 2464.5 MHz */
+    {0xFC200000U, 2465U, 39U}, /* 2465.0 MHz */
+    {0xFC300000U, 2465U, 39U}, /* 2465.5 MHz */
+    {0xFC400000U, 2466U, 39U}, /* 2466.0 MHz */
+    {0xFC500000U, 2466U, 39U}, /* 2466.5 MHz */
+    {0xFC600000U, 2467U, 39U}, /* 2467.0 MHz */
+    {0xFC700000U, 2467U, 39U}, /* 2467.5 MHz */
+    {0xFC800000U, 2468U, 39U}, /* 2468.0 MHz */
+    {0xFC900000U, 2468U, 39U}, /* 2468.5 MHz */
+    {0xFCA00000U, 2469U, 39U}, /* 2469.0 MHz */
+    {0xFCB00000U, 2469U, 39U}, /* 2469.5 MHz */
+    {0xFCC00000U, 2470U, 39U}, /* 2470.0 MHz */
+    {0xFCD00000U, 2470U, 39U}, /* 2470.5 MHz */
+    {0xFCE00000U, 2471U, 39U}, /* 2471.0 MHz */
+    {0xFCF00000U, 2471U, 39U}, /* 2471.5 MHz */
+    {0xFD000000U, 2472U, 39U}, /* 2472.0 MHz */
+    {0xFD100000U, 2472U, 39U}, /* 2472.5 MHz */
+    {0xFD200000U, 2473U, 39U}, /* 2473.0 MHz */
+    {0xFD300000U, 2473U, 39U}, /* 2473.5 MHz */
+    {0xFD400000U, 2474U, 39U}, /* 2474.0 MHz */
+    {0xFD500000U, 2474U, 39U}, /* 2474.5 MHz */
+    {0xFD600000U, 2475U, 39U}, /* 2475.0 MHz */
+    {0xFD700000U, 2475U, 39U}, /* 2475.5 MHz */
+    {0xFD800000U, 2476U, 39U}, /* 2476.0 MHz */
+    {0xFD900000U, 2476U, 39U}, /* 2476.5 MHz */
+    {0xFDA00000U, 2477U, 39U}, /* 2477.0 MHz */
+    {0xFDB00000U, 2477U, 39U}, /* 2477.5 MHz */
+    {0xFDC00000U, 2478U, 39U}, /* 2478.0 MHz */
+    {0xFDD00000U, 2478U, 39U}, /* 2478.5 MHz */
+    {0xFDE00000U, 2479U, 39U}, /* 2479.0 MHz */
+    {0xFDF00000U, 2479U, 39U}, /* 2479.5 MHz */
+    {0xFE000000U, 2480U, 39U}, /* 2480.0 MHz */
+    {0xFE100000U, 2480U, 39U}, /* 2480.5 MHz */
+    {0xFE200000U, 2481U, 39U}, /* 2481.0 MHz */
+    {0xFE300000U, 2481U, 39U}, /* 2481.5 MHz */
+    {0xFE400000U, 2482U, 39U}, /* 2482.0 MHz */
+    {0xFE500000U, 2482U, 39U}, /* 2482.5 MHz */
+    {0xFE600000U, 2483U, 39U}, /* 2483.0 MHz */
+    {0xFE700000U, 2483U, 39U}, /* 2483.5 MHz */
+    {0xFE800000U, 2484U, 39U}, /* 2484.0 MHz */
+    {0xFE900000U, 2484U, 39U}, /* 2484.5 MHz */
+    {0xFEA00000U, 2485U, 39U}, /* 2485.0 MHz */
+    {0xFEB00000U, 2485U, 39U}, /* 2485.5 MHz */
+    {0xFEC00000U, 2486U, 39U}, /* 2486.0 MHz */
+    {0xFED00000U, 2486U, 39U}, /* 2486.5 MHz */
+    {0xFEE00000U, 2487U, 39U}, /* 2487.0 MHz */
+#endif /* RF_OSC_26MHZ == 1 */
+};
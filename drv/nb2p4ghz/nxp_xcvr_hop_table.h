@@ -0,0 +1,29 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef NXP_XCVR_HOP_TABLE_H
+/* clang-format off */
+#define NXP_XCVR_HOP_TABLE_H
+/* clang-format on */
+
+#include "nxp2p4_xcvr.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+/*! @brief PLL settings of the frequency override range, one entry every ::XCVR_HOP_TABLE_STEP_HZ from
+ * ::XCVR_HOP_TABLE_MIN_FREQ_HZ, for the RF_OSC_26MHZ reference (generated by tools/xcvr_hop_table_gen.c) */
+extern const xcvr_pll_hop_entry_t xcvr_pll_hop_table[XCVR_HOP_TABLE_NUM_ENTRIES];
+
+#endif /* NXP_XCVR_HOP_TABLE_H */
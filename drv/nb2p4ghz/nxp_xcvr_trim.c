@@ -1274,10 +1274,10 @@ xcvrTrimStatus_t IQMCCalInit(uint8_t generic_channel_num)
     xcvrTrimStatus_t trim_status = gXcvrTrimInvalidMode_c;
 
     /* Freeze AGC to max gain */
-    temp = XCVR_RX_DIG->AGC_OVRD;
+    temp = XCVR_SHADOW_RD(RX_DIG_AGC_OVRD);
     temp |= XCVR_RX_DIG_AGC_OVRD_AGC_GAIN_IDX_OVRD(11U) | XCVR_RX_DIG_AGC_OVRD_AGC_GAIN_IDX_OVRD_EN(1U) |
             XCVR_RX_DIG_AGC_OVRD_AGC_PHY_FREEZE_OVRD(1U) | XCVR_RX_DIG_AGC_OVRD_AGC_PHY_FREEZE_OVRD_EN(1U);
-    XCVR_RX_DIG->AGC_OVRD = temp;
+    XCVR_SHADOW_WR(RX_DIG_AGC_OVRD, temp);
 
     /*  Set band to GENERIC and use requested channel */
     stored_pll_band = XCVR_GetPLLBand();                      /* Save for later restore */
@@ -1348,7 +1348,7 @@ void IQMCRunTrials(xcvr_iqmc_trials_t *trials_data, uint8_t num_trials)
     }
 
     /* release AGC freeze */
-    XCVR_RX_DIG->AGC_OVRD = 0U;
+    XCVR_SHADOW_WR(RX_DIG_AGC_OVRD, 0U);
 }
 
 /* Use the captured results to calculate a trim and validate the trim results */
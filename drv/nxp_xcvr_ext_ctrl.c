@@ -134,9 +134,11 @@ xcvrStatus_t XCVR_CoexistenceInit(void)
 
     /* Read the END_OF_TX_WU and END_OF_RX_WU for XCVR */
     end_of_tx_wu =
-        (XCVR_TSM->END_OF_SEQ & XCVR_TSM_END_OF_SEQ_END_OF_TX_WU_MASK) >> XCVR_TSM_END_OF_SEQ_END_OF_TX_WU_SHIFT;
+        (XCVR_SHADOW_RD(TSM_END_OF_SEQ) & XCVR_TSM_END_OF_SEQ_END_OF_TX_WU_MASK) >>
+        XCVR_TSM_END_OF_SEQ_END_OF_TX_WU_SHIFT;
     end_of_rx_wu =
-        (XCVR_TSM->END_OF_SEQ & XCVR_TSM_END_OF_SEQ_END_OF_RX_WU_MASK) >> XCVR_TSM_END_OF_SEQ_END_OF_RX_WU_SHIFT;
+        (XCVR_SHADOW_RD(TSM_END_OF_SEQ) & XCVR_TSM_END_OF_SEQ_END_OF_RX_WU_MASK) >>
+        XCVR_TSM_END_OF_SEQ_END_OF_RX_WU_SHIFT;
 
     /*****************
      *  TX SEQUENCE  *
@@ -261,9 +263,11 @@ xcvrStatus_t XCVR_CoexistenceSetPriority(XCVR_COEX_PRIORITY_T rxPriority, XCVR_C
 
     /* Read the END_OF_TX_WU and END_OF_RX_WU for XCVR */
     end_of_tx_wu =
-        (XCVR_TSM->END_OF_SEQ & XCVR_TSM_END_OF_SEQ_END_OF_TX_WU_MASK) >> XCVR_TSM_END_OF_SEQ_END_OF_TX_WU_SHIFT;
+        (XCVR_SHADOW_RD(TSM_END_OF_SEQ) & XCVR_TSM_END_OF_SEQ_END_OF_TX_WU_MASK) >>
+        XCVR_TSM_END_OF_SEQ_END_OF_TX_WU_SHIFT;
     end_of_rx_wu =
-        (XCVR_TSM->END_OF_SEQ & XCVR_TSM_END_OF_SEQ_END_OF_RX_WU_MASK) >> XCVR_TSM_END_OF_SEQ_END_OF_RX_WU_SHIFT;
+        (XCVR_SHADOW_RD(TSM_END_OF_SEQ) & XCVR_TSM_END_OF_SEQ_END_OF_RX_WU_MASK) >>
+        XCVR_TSM_END_OF_SEQ_END_OF_RX_WU_SHIFT;
 
     /*****************
      *      RX       *
@@ -412,9 +416,9 @@ static bool XCVR_COEX_VerifyTimingAdvance(uint8_t tx_advance,
                                           uint8_t *tx_wu_time_ptr,
                                           uint8_t *rx_wu_time_ptr)
 {
-    uint8_t end_of_tx_wu = (uint8_t)((XCVR_TSM->END_OF_SEQ & XCVR_TSM_END_OF_SEQ_END_OF_TX_WU_MASK) >>
+    uint8_t end_of_tx_wu = (uint8_t)((XCVR_SHADOW_RD(TSM_END_OF_SEQ) & XCVR_TSM_END_OF_SEQ_END_OF_TX_WU_MASK) >>
                                      XCVR_TSM_END_OF_SEQ_END_OF_TX_WU_SHIFT);
-    uint8_t end_of_rx_wu = (uint8_t)((XCVR_TSM->END_OF_SEQ & XCVR_TSM_END_OF_SEQ_END_OF_RX_WU_MASK) >>
+    uint8_t end_of_rx_wu = (uint8_t)((XCVR_SHADOW_RD(TSM_END_OF_SEQ) & XCVR_TSM_END_OF_SEQ_END_OF_RX_WU_MASK) >>
                                      XCVR_TSM_END_OF_SEQ_END_OF_RX_WU_SHIFT);
     /* Return true if both TX and RX timings are <= their respective end_of_seq values */
     bool retval = ((tx_advance <= end_of_tx_wu) && (rx_advance <= end_of_rx_wu));
@@ -642,8 +646,8 @@ xcvrCoexStatus_t XCVR_COEX_RfActiveTsmInit(const coexRfActiveTsmConfig_t *config
             XCVR_TSM->CTRL |= XCVR_TSM_CTRL_RF_ACTIVE_EXTEND(config_ptr->rf_act_extend);
 #endif /* defined(NXP_RADIO_GEN) && (NXP_RADIO_GEN == 450) */
             /* Setup the TSM register for RF_ACTIVE */
-            uint32_t temp =
-                XCVR_TSM->END_OF_SEQ; /* Start from the END_OF_SEQ register since warmdowns (LO) are from there */
+            /* Start from the END_OF_SEQ register since warmdowns (LO) are from there */
+            uint32_t temp = XCVR_SHADOW_RD(TSM_END_OF_SEQ);
             temp &= ~(COMMON_TX_HI_MASK | COMMON_RX_HI_MASK); /* Zero out the warmup (HI) times */
             temp |=
                 COMMON_TX_HI(tx_wu_time) |
@@ -765,8 +769,8 @@ xcvrCoexStatus_t XCVR_COEX_RfStatusTsmInit(const coexRfStatusConfig_t *config_pt
                                            priority RX case */
 
             /* Setup the TSM register for RF_STATUS */
-            uint32_t temp =
-                XCVR_TSM->END_OF_SEQ;     /* Start from the END_OF_SEQ register since warmdowns (LO) are from there */
+            /* Start from the END_OF_SEQ register since warmdowns (LO) are from there */
+            uint32_t temp = XCVR_SHADOW_RD(TSM_END_OF_SEQ);
             temp &= ~(COMMON_TX_HI_MASK); /* Zero out the TX warmup (HI) time. RX never asserts the signal. */
             temp |= COMMON_TX_HI(tx_wu_time) | COMMON_RX_HI(0xFFU) |
                     COMMON_RX_LO(0xFFU); /* Insert the TX warmup time calculated during timing advance verification */
@@ -835,8 +839,8 @@ xcvrCoexStatus_t XCVR_COEX_RfPriorityTsmInit(const coexRfPriorityConfig_t *confi
             else
             {
                 /* Setup the TSM register for RF_PRIORITY */
-                uint32_t temp =
-                    XCVR_TSM->END_OF_SEQ; /* Start from the END_OF_SEQ register since warmdowns (LO) are from there */
+                /* Start from the END_OF_SEQ register since warmdowns (LO) are from there */
+                uint32_t temp = XCVR_SHADOW_RD(TSM_END_OF_SEQ);
                 temp |= COMMON_TX_HI(0xFFU) |
                         COMMON_RX_HI(0xFFU); /* Force the warmup times disabled, which defaults to LOW priority */
                 XCVR_TSM->RF_PRIORITY_TSM_REG = temp;
@@ -870,8 +874,8 @@ xcvrCoexStatus_t XCVR_COEX_SetPriority(XCVR_COEX_PRIORITY_T rxPriority, XCVR_COE
 
         if (coex_status == gXcvrCoexStatusSuccess)
         {
-            uint32_t temp =
-                XCVR_TSM->END_OF_SEQ; /* Start from the END_OF_SEQ register since warmdowns (LO) are from there */
+            /* Start from the END_OF_SEQ register since warmdowns (LO) are from there */
+            uint32_t temp = XCVR_SHADOW_RD(TSM_END_OF_SEQ);
             tx_wu_time = 0xFFU;
             rx_wu_time = 0xFFU;
             uint8_t rx_wd_time =
@@ -1083,7 +1087,8 @@ xcvrStatus_t XCVR_ExternalFadPaFemInit(xcvr_pa_fem_config_t *pa_fem_settings_ptr
             pa_fem_settings_ptr->pa_tx_wu);
 #endif
         wd_time = (uint8_t)(
-            ((XCVR_TSM->END_OF_SEQ & XCVR_TSM_END_OF_SEQ_END_OF_TX_WD_MASK) >> XCVR_TSM_END_OF_SEQ_END_OF_TX_WD_SHIFT) +
+            ((XCVR_SHADOW_RD(TSM_END_OF_SEQ) & XCVR_TSM_END_OF_SEQ_END_OF_TX_WD_MASK) >>
+             XCVR_TSM_END_OF_SEQ_END_OF_TX_WD_SHIFT) +
             pa_fem_settings_ptr->pa_tx_wd);
         /* The TX timing advance value must be strictly less than the difference between wd_time and wu_time due to TSM
          * counter restrictions. */
@@ -1098,10 +1103,12 @@ xcvrStatus_t XCVR_ExternalFadPaFemInit(xcvr_pa_fem_config_t *pa_fem_settings_ptr
         }
         /* RX timing calculations */
         wu_time = (uint8_t)(
-            ((XCVR_TSM->END_OF_SEQ & XCVR_TSM_END_OF_SEQ_END_OF_RX_WU_MASK) >> XCVR_TSM_END_OF_SEQ_END_OF_RX_WU_SHIFT) -
+            ((XCVR_SHADOW_RD(TSM_END_OF_SEQ) & XCVR_TSM_END_OF_SEQ_END_OF_RX_WU_MASK) >>
+             XCVR_TSM_END_OF_SEQ_END_OF_RX_WU_SHIFT) -
             pa_fem_settings_ptr->lna_rx_wu);
         wd_time = (uint8_t)(
-            ((XCVR_TSM->END_OF_SEQ & XCVR_TSM_END_OF_SEQ_END_OF_RX_WD_MASK) >> XCVR_TSM_END_OF_SEQ_END_OF_RX_WD_SHIFT) +
+            ((XCVR_SHADOW_RD(TSM_END_OF_SEQ) & XCVR_TSM_END_OF_SEQ_END_OF_RX_WD_MASK) >>
+             XCVR_TSM_END_OF_SEQ_END_OF_RX_WD_SHIFT) +
             pa_fem_settings_ptr->lna_rx_wd);
         /* The RX timing advance value must be strictly less than the difference between wd_time and wu_time due to TSM
          * counter restrictions. */
@@ -1212,13 +1219,16 @@ xcvrStatus_t XCVR_FadPaFemOnCoexInit(xcvr_pa_fem_config_t *test_settings,
             test_settings->pa_tx_wu);
 #endif /* defined(RADIO_IS_GEN_4P0) */
         tx_wd_time = (uint8_t)(
-            ((XCVR_TSM->END_OF_SEQ & XCVR_TSM_END_OF_SEQ_END_OF_TX_WD_MASK) >> XCVR_TSM_END_OF_SEQ_END_OF_TX_WD_SHIFT) +
+            ((XCVR_SHADOW_RD(TSM_END_OF_SEQ) & XCVR_TSM_END_OF_SEQ_END_OF_TX_WD_MASK) >>
+             XCVR_TSM_END_OF_SEQ_END_OF_TX_WD_SHIFT) +
             test_settings->pa_tx_wd);
         rx_wu_time = (uint8_t)(
-            ((XCVR_TSM->END_OF_SEQ & XCVR_TSM_END_OF_SEQ_END_OF_RX_WU_MASK) >> XCVR_TSM_END_OF_SEQ_END_OF_RX_WU_SHIFT) -
+            ((XCVR_SHADOW_RD(TSM_END_OF_SEQ) & XCVR_TSM_END_OF_SEQ_END_OF_RX_WU_MASK) >>
+             XCVR_TSM_END_OF_SEQ_END_OF_RX_WU_SHIFT) -
             test_settings->lna_rx_wu);
         rx_wd_time = (uint8_t)(
-            ((XCVR_TSM->END_OF_SEQ & XCVR_TSM_END_OF_SEQ_END_OF_RX_WD_MASK) >> XCVR_TSM_END_OF_SEQ_END_OF_RX_WD_SHIFT) +
+            ((XCVR_SHADOW_RD(TSM_END_OF_SEQ) & XCVR_TSM_END_OF_SEQ_END_OF_RX_WD_MASK) >>
+             XCVR_TSM_END_OF_SEQ_END_OF_RX_WD_SHIFT) +
             test_settings->lna_rx_wd);
         /* The TX & RX timing advance values must be strictly less than the difference between wd_time and wu_time due
          * to TSM counter restrictions. */
@@ -1475,7 +1485,7 @@ xcvrLclStatus_t XCVR_LCL_AntennaSwitchInit(lclRxTxMode_t mode, const lclAntennaS
             }
 #if defined(NXP_RADIO_GEN) && (NXP_RADIO_GEN >= 450)
             /* Use only mask capability from RX DIG since it properly supports averaging */
-            XCVR_RX_DIG->CTRL1 |= XCVR_RX_DIG_CTRL1_RX_IQ_PH_OUTPUT_COND_MASK;
+            XCVR_SHADOW_SET(RX_DIG_CTRL1, XCVR_RX_DIG_CTRL1_RX_IQ_PH_OUTPUT_COND_MASK);
 #endif /* #if defined(RADIO_IS_GEN_4P5) */
         }
     }
@@ -2520,7 +2530,7 @@ void XCVR_LCL_DeInit(void)
     XCVR_MISC->LCL_CFG0 &= ~XCVR_MISC_LCL_CFG0_LCL_EN_MASK;
 #if defined(NXP_RADIO_GEN) && (NXP_RADIO_GEN >= 450)
     /* Disable mask capability from RX DIG to allow independent IQ capture  */
-    XCVR_RX_DIG->CTRL1 &= ~(XCVR_RX_DIG_CTRL1_RX_IQ_PH_OUTPUT_COND_MASK);
+    XCVR_SHADOW_CLR(RX_DIG_CTRL1, XCVR_RX_DIG_CTRL1_RX_IQ_PH_OUTPUT_COND_MASK);
 #endif /* #if defined(RADIO_IS_GEN_4P5) */
 }
 
@@ -100,6 +100,16 @@ static struct
 
 xcvr_lcl_hpm_cal_interp_t hpm_cal_2442_data;
 
+/* Pre-calculated Fref^3 / freq^3 for all HADM channels 0..78 with Fref = 2442 MHz (channel 40), in Q15 format */
+static const uint16_t hpm_cal_cube_q15[RSM_HADM_MAX_CHAN_INDEX + 1U] = {
+    34432U, 34389U, 34347U, 34304U, 34261U, 34218U, 34176U, 34133U, 34091U, 34048U, 34006U, 33964U, 33922U,
+    33879U, 33837U, 33795U, 33753U, 33712U, 33670U, 33628U, 33586U, 33545U, 33503U, 33462U, 33421U, 33379U,
+    33338U, 33297U, 33256U, 33215U, 33174U, 33133U, 33092U, 33051U, 33011U, 32970U, 32930U, 32889U, 32849U,
+    32808U, 32768U, 32728U, 32688U, 32648U, 32608U, 32568U, 32528U, 32488U, 32448U, 32408U, 32369U, 32329U,
+    32290U, 32250U, 32211U, 32172U, 32132U, 32093U, 32054U, 32015U, 31976U, 31937U, 31898U, 31859U, 31821U,
+    31782U, 31743U, 31705U, 31666U, 31628U, 31589U, 31551U, 31513U, 31475U, 31437U, 31398U, 31361U, 31323U,
+    31285U};
+
 #if defined(NXP_RADIO_GEN) && (NXP_RADIO_GEN >= 470)
 /* TQI register settings for 1Mbps and 2Mbps rates */
 static xcvr_lcl_tqi_setting_tbl_t tqi_1mbps_settings = {
@@ -511,9 +521,9 @@ void XCVR_LCL_RsmPLLInit(XCVR_RSM_SQTE_RATE_T rate)
     /* this is not needed, as long as RSM_HPM_CAL = 1. For the dynamic selection: RSM_HPM_CAL = 0, HPM_DYNAMIC_SEL=1,
      * HPM_DYNAMIC_RX_PKT_TABLE=1, HPM_DYNAMIC_RX_TONE_TABLE=0  */
 #if defined(NXP_RADIO_GEN) && (NXP_RADIO_GEN >= 470) /* KW47 always uses HPM CAL from PKT RAM */
-        temp = XCVR_PLL_DIG->HPM_CTRL;
+        temp = XCVR_SHADOW_RD(PLL_DIG_HPM_CTRL);
     temp |= (XCVR_PLL_DIG_HPM_CTRL_HPM_DYNAMIC_RX_PKT_TABLE_MASK | XCVR_PLL_DIG_HPM_CTRL_HPM_DYNAMIC_SEL_MASK);
-        XCVR_PLL_DIG->HPM_CTRL = temp; 
+        XCVR_SHADOW_WR(PLL_DIG_HPM_CTRL, temp); 
 #endif /* defined(NXP_RADIO_GEN) && (NXP_RADIO_GEN >= 470) */
 
 #if(0) // disabled since this is overriden by IPS_FO by defaul ble config to use DRS feature.
@@ -645,7 +655,7 @@ xcvrLclStatus_t XCVR_LCL_RsmPLLBackup(rsm_reg_backup_t *reg_backup_ptr)
         
         /* PLL registers backup only - these registers need backup if corrupting PLL registers */
         reg_backup_ptr->XCVR_PLL_DIG_CHAN_MAP    = XCVR_PLL_DIG->CHAN_MAP;
-        reg_backup_ptr->XCVR_PLL_DIG_HPM_CTRL    = XCVR_PLL_DIG->HPM_CTRL;
+        reg_backup_ptr->XCVR_PLL_DIG_HPM_CTRL    = XCVR_SHADOW_RD(PLL_DIG_HPM_CTRL);
         reg_backup_ptr->XCVR_TX_DIG_GFSK_CTRL    = XCVR_TX_DIG->GFSK_CTRL;
         reg_backup_ptr->XCVR_PLL_DIG_LPM_CTRL    = XCVR_PLL_DIG->LPM_CTRL;
         reg_backup_ptr->XCVR_PLL_DIG_LPM_SDM_CTRL1 = XCVR_PLL_DIG->LPM_SDM_CTRL1;
@@ -726,7 +736,7 @@ xcvrLclStatus_t XCVR_LCL_RsmPLLRestore(const rsm_reg_backup_t *reg_backup_ptr)
         
         /* restore all changed registers from backup */
         XCVR_PLL_DIG->CHAN_MAP    = reg_backup_ptr->XCVR_PLL_DIG_CHAN_MAP;
-        XCVR_PLL_DIG->HPM_CTRL    = reg_backup_ptr->XCVR_PLL_DIG_HPM_CTRL;
+        XCVR_SHADOW_WR(PLL_DIG_HPM_CTRL, reg_backup_ptr->XCVR_PLL_DIG_HPM_CTRL);
         XCVR_TX_DIG->GFSK_CTRL    = reg_backup_ptr->XCVR_TX_DIG_GFSK_CTRL;
         XCVR_PLL_DIG->LPM_CTRL    = reg_backup_ptr->XCVR_PLL_DIG_LPM_CTRL;
         XCVR_PLL_DIG->LPM_SDM_CTRL1 = reg_backup_ptr->XCVR_PLL_DIG_LPM_SDM_CTRL1;
@@ -798,12 +808,13 @@ xcvrLclStatus_t XCVR_LCL_RsmInit(const xcvr_lcl_rsm_config_t *rsm_settings_ptr)
             if (rsm_settings_ptr->rtt_len == XCVR_RSM_SQTE_PN64)
             {
                 XCVR_2P4GHZ_PHY->RTT_CTRL |= GEN4PHY_RTT_CTRL_RTT_SEQ_LEN_MASK; /* Select 64 bit PN sequences */
-                XCVR_RX_DIG->CTRL1 &=
-                    ~(XCVR_RX_DIG_CTRL1_DIS_WB_NORM_AA_FOUND_MASK);             /* Must be cleared for 64 bit PNs */
+                /* Must be cleared for 64 bit PNs */
+                XCVR_SHADOW_CLR(RX_DIG_CTRL1, XCVR_RX_DIG_CTRL1_DIS_WB_NORM_AA_FOUND_MASK);
             }
             else
             {
-                XCVR_RX_DIG->CTRL1 |= XCVR_RX_DIG_CTRL1_DIS_WB_NORM_AA_FOUND_MASK; /* Must be set for 32 bit PNs */
+                /* Must be set for 32 bit PNs */
+                XCVR_SHADOW_SET(RX_DIG_CTRL1, XCVR_RX_DIG_CTRL1_DIS_WB_NORM_AA_FOUND_MASK);
             }
 #endif /* defined(SUPPORT_RSM_LONG_PN) && (SUPPORT_RSM_LONG_PN == 1) */
             /* the 1Mbps case is programmed in the normal settings configuration process */
@@ -837,14 +848,13 @@ xcvrLclStatus_t XCVR_LCL_RsmInit(const xcvr_lcl_rsm_config_t *rsm_settings_ptr)
         (void)status; /* Failure status won't affect the flow of the program, will just get passed as a return */
         if (do_hpm_cal)
         {
-            XCVR_PLL_DIG->HPM_CTRL |=
-                XCVR_PLL_DIG_HPM_CTRL_RX_HPM_CAL_EN_MASK; /* RSM is not providing the HPM CAL values so PLL must perform
-                                                             calibration. */
+            /* RSM is not providing the HPM CAL values so PLL must perform calibration. */
+            XCVR_SHADOW_SET(PLL_DIG_HPM_CTRL, XCVR_PLL_DIG_HPM_CTRL_RX_HPM_CAL_EN_MASK);
         }
         else
         {
-            XCVR_PLL_DIG->HPM_CTRL &= ~(XCVR_PLL_DIG_HPM_CTRL_RX_HPM_CAL_EN_MASK); /* RSM forces HPM CAL values so PLL
-                                                                                      does not perform calibration.  */
+            /* RSM forces HPM CAL values so PLL does not perform calibration.  */
+            XCVR_SHADOW_CLR(PLL_DIG_HPM_CTRL, XCVR_PLL_DIG_HPM_CTRL_RX_HPM_CAL_EN_MASK);
         }
 
 #if defined(NXP_RADIO_GEN) && (NXP_RADIO_GEN >= 470) /* KW47 Inline Phase Return */
@@ -985,7 +995,7 @@ xcvrLclStatus_t XCVR_LCL_RsmInit(const xcvr_lcl_rsm_config_t *rsm_settings_ptr)
         /* Setup RXDIG for ranging */
         /* ************** */
         /* If RCCAL is not performed, setup the CBPF override value */
-        temp = XCVR_RX_DIG->RCCAL_CTRL1;
+        temp = XCVR_SHADOW_RD(RX_DIG_RCCAL_CTRL1);
         if (!xcvr_lcl_rsm_generic_config.do_rxdig_rccal)
         {
             temp |= XCVR_RX_DIG_RCCAL_CTRL1_CBPF_CCODE_OVRD_EN_MASK; /* Enable override of CBPF value */
@@ -1004,7 +1014,7 @@ xcvrLclStatus_t XCVR_LCL_RsmInit(const xcvr_lcl_rsm_config_t *rsm_settings_ptr)
         {
             temp &= ~(XCVR_RX_DIG_RCCAL_CTRL1_CBPF_CCODE_OVRD_EN_MASK); /* Disable override of CBPF value */
         }
-        XCVR_RX_DIG->RCCAL_CTRL1 = temp;
+        XCVR_SHADOW_WR(RX_DIG_RCCAL_CTRL1, temp);
 
 #if defined(NXP_RADIO_GEN) && (NXP_RADIO_GEN >= 470) /* NADM only available on KW47 */
         /* NADM feature setup */
@@ -1037,14 +1047,14 @@ xcvrLclStatus_t XCVR_LCL_RsmInit(const xcvr_lcl_rsm_config_t *rsm_settings_ptr)
         if (rate_is_2mbps) /* Modify IF to avoid including DC in NADM processing */
         {
             /* Set IF to 1.7MHz */
-            XCVR_RX_DIG->CTRL0 &= ~(XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ_MASK);
-            XCVR_RX_DIG->CTRL0 |= (XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(56U));
+            XCVR_SHADOW_CLR(RX_DIG_CTRL0, XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ_MASK);
+            XCVR_SHADOW_SET(RX_DIG_CTRL0, XCVR_RX_DIG_CTRL0_DIG_MIXER_FREQ(56U));
         }
 #endif /* NADM_WORKAROUND_IF_1_7MHZ */
 
         /* Enable IPS FO for GFSK FDEV -> 0x400 for RX and 0x200 for TX for NADM 1Mbps correlation improvement */;
-        XCVR_MISC->IPS_FO_ADDR[1] |= XCVR_MISC_IPS_FO_ADDR_ENTRY_RX_MASK; /* FO data #1 override during RX */
-        XCVR_MISC->IPS_FO_ADDR[2] |= XCVR_MISC_IPS_FO_ADDR_ENTRY_TX_MASK; /* FO data #2 override during TX */
+        XCVR_SHADOW_SET(MISC_IPS_FO_ADDR_1, XCVR_MISC_IPS_FO_ADDR_ENTRY_RX_MASK); /* FO data #1 override during RX */
+        XCVR_SHADOW_SET(MISC_IPS_FO_ADDR_2, XCVR_MISC_IPS_FO_ADDR_ENTRY_TX_MASK); /* FO data #2 override during TX */
 
 #endif /* defined(NXP_RADIO_GEN) && (NXP_RADIO_GEN >= 470)  */
 
@@ -1064,7 +1074,7 @@ xcvrLclStatus_t XCVR_LCL_RsmInit(const xcvr_lcl_rsm_config_t *rsm_settings_ptr)
         temp |= XCVR_RX_DIG_DFT_CTRL_DFT_RSSI_OUT_SEL(4U) | XCVR_RX_DIG_DFT_CTRL_DFT_RSSI_MAG_OUT_SEL(7U) |
                 XCVR_RX_DIG_DFT_CTRL_DFT_RX_IQ_OUT_SEL(rsm_settings_ptr->iq_out_sel);
         XCVR_RX_DIG->DFT_CTRL = temp;
-        temp                  = XCVR_RX_DIG->CTRL1;
+        temp                  = XCVR_SHADOW_RD(RX_DIG_CTRL1);
         temp |= XCVR_RX_DIG_CTRL1_RX_IQ_PH_OUTPUT_COND_MASK;
         temp &= ~(XCVR_RX_DIG_CTRL1_RX_IQ_PH_AVG_WIN_MASK);
         /* Setup averager (in the same register) */
@@ -1076,7 +1086,7 @@ xcvrLclStatus_t XCVR_LCL_RsmInit(const xcvr_lcl_rsm_config_t *rsm_settings_ptr)
                     rsm_settings_ptr
                         ->pct_averaging_win); /* Setup according to input structure for second stage of averaging */
 #endif /* defined(NXP_RADIO_GEN) && (NXP_RADIO_GEN >= 470)  */
-        XCVR_RX_DIG->CTRL1 = temp;
+        XCVR_SHADOW_WR(RX_DIG_CTRL1, temp);
 
 #if defined(NXP_RADIO_GEN) && (NXP_RADIO_GEN >= 470)  
         temp = XCVR_RX_DIG->AGC_CTRL;
@@ -1336,7 +1346,7 @@ xcvrLclStatus_t XCVR_LCL_RsmInit(const xcvr_lcl_rsm_config_t *rsm_settings_ptr)
 void XCVR_LCL_RsmDeInit(void)
 {
     /* Disable mask capability from RX DIG to allow independent IQ capture  */
-    XCVR_RX_DIG->CTRL1 &= ~(XCVR_RX_DIG_CTRL1_RX_IQ_PH_OUTPUT_COND_MASK);
+    XCVR_SHADOW_CLR(RX_DIG_CTRL1, XCVR_RX_DIG_CTRL1_RX_IQ_PH_OUTPUT_COND_MASK);
 
     /* Restore Tx_dig */
     XCVR_TX_DIG->DATA_PADDING_CTRL   = xcvr_settings.tx_dig_data_padding_ctrl;
@@ -1633,7 +1643,7 @@ xcvrLclStatus_t XCVR_LCL_GetTsmTimings(xcvr_lcl_tsm_config_t *backup_tsm_timings
         /* Backup TSM timings before re-configuration for RSM */
         /* CTRL register value is not modified for RSM operation. */
         /* LPPS_CTRL register value is not modified for RSM operation. */
-        backup_tsm_timings->END_OF_SEQ = XCVR_TSM->END_OF_SEQ;
+        backup_tsm_timings->END_OF_SEQ = XCVR_SHADOW_RD(TSM_END_OF_SEQ);
         backup_tsm_timings->WU_LATENCY = XCVR_TSM->WU_LATENCY;
         backup_tsm_timings->RECYCLE_COUNT = XCVR_TSM->RECYCLE_COUNT;
         backup_tsm_timings->FAST_CTRL1 = XCVR_TSM->FAST_CTRL1;
@@ -1733,7 +1743,7 @@ xcvrLclStatus_t XCVR_LCL_ReprogramTsmTimings(const xcvr_lcl_tsm_config_t *new_ts
         /***********************************************/
         /* CTRL register value is not modified for RSM operation. */
         /* LPPS_CTRL register value is not modified for RSM operation. */
-        XCVR_TSM->END_OF_SEQ    = new_tsm_timings->END_OF_SEQ;
+        XCVR_SHADOW_WR(TSM_END_OF_SEQ, new_tsm_timings->END_OF_SEQ);
         XCVR_TSM->WU_LATENCY    = new_tsm_timings->WU_LATENCY;
         XCVR_TSM->RECYCLE_COUNT = new_tsm_timings->RECYCLE_COUNT;
         XCVR_TSM->FAST_CTRL1    = new_tsm_timings->FAST_CTRL1;
@@ -1865,8 +1875,8 @@ xcvrLclStatus_t XCVR_LCL_RsmRegBackup(rsm_reg_backup_t *reg_backup_ptr)
 #endif /* BACKUP_LCL_REGS */
 #if defined(NXP_RADIO_GEN) && (NXP_RADIO_GEN >= 470)
         /* IPS_FO_ADDR */
-        reg_backup_ptr->XCVR_MISC_IPS_FO_ADDR_1 = XCVR_MISC->IPS_FO_ADDR[1];
-        reg_backup_ptr->XCVR_MISC_IPS_FO_ADDR_2 = XCVR_MISC->IPS_FO_ADDR[2];
+        reg_backup_ptr->XCVR_MISC_IPS_FO_ADDR_1 = XCVR_SHADOW_RD(MISC_IPS_FO_ADDR_1);
+        reg_backup_ptr->XCVR_MISC_IPS_FO_ADDR_2 = XCVR_SHADOW_RD(MISC_IPS_FO_ADDR_2);
 //        reg_backup_ptr->XCVR_MISC_IPS_FO_ADDR_3 = XCVR_MISC->IPS_FO_ADDR[3];
 #endif
 
@@ -1893,9 +1903,9 @@ xcvrLclStatus_t XCVR_LCL_RsmRegBackup(rsm_reg_backup_t *reg_backup_ptr)
         status = XCVR_LCL_RsmPLLBackup(
             reg_backup_ptr); /* NULLPTR check in this routine should never fail since checked above */
         /* XCVR_RXDIG */
-        reg_backup_ptr->XCVR_RX_DIG_RCCAL_CTRL1 = XCVR_RX_DIG->RCCAL_CTRL1;
+        reg_backup_ptr->XCVR_RX_DIG_RCCAL_CTRL1 = XCVR_SHADOW_RD(RX_DIG_RCCAL_CTRL1);
         reg_backup_ptr->XCVR_RX_DIG_DFT_CTRL    = XCVR_RX_DIG->DFT_CTRL;
-        reg_backup_ptr->XCVR_RX_DIG_CTRL1       = XCVR_RX_DIG->CTRL1;
+        reg_backup_ptr->XCVR_RX_DIG_CTRL1       = XCVR_SHADOW_RD(RX_DIG_CTRL1);
 #if defined(NXP_RADIO_GEN) && (NXP_RADIO_GEN >= 470)
         reg_backup_ptr->XCVR_RX_DIG_AGC_CTRL = XCVR_RX_DIG->AGC_CTRL;
 #endif
@@ -1955,8 +1965,8 @@ xcvrLclStatus_t XCVR_LCL_RsmRegRestore(const rsm_reg_backup_t *reg_backup_ptr)
 
 #if defined(NXP_RADIO_GEN) && (NXP_RADIO_GEN >= 470)
         /* IPS_FO_ADDR */
-        XCVR_MISC->IPS_FO_ADDR[1] = reg_backup_ptr->XCVR_MISC_IPS_FO_ADDR_1;
-        XCVR_MISC->IPS_FO_ADDR[2] = reg_backup_ptr->XCVR_MISC_IPS_FO_ADDR_2;
+        XCVR_SHADOW_WR(MISC_IPS_FO_ADDR_1, reg_backup_ptr->XCVR_MISC_IPS_FO_ADDR_1);
+        XCVR_SHADOW_WR(MISC_IPS_FO_ADDR_2, reg_backup_ptr->XCVR_MISC_IPS_FO_ADDR_2);
 //        XCVR_MISC->IPS_FO_ADDR[3] = reg_backup_ptr->XCVR_MISC_IPS_FO_ADDR_3;
 #endif
 
@@ -1982,9 +1992,9 @@ xcvrLclStatus_t XCVR_LCL_RsmRegRestore(const rsm_reg_backup_t *reg_backup_ptr)
         status = XCVR_LCL_RsmPLLRestore(
             reg_backup_ptr); /* NULLPTR check in this routine should never fail since checked above */
         /* XCVR_RXDIG */
-        XCVR_RX_DIG->RCCAL_CTRL1 = reg_backup_ptr->XCVR_RX_DIG_RCCAL_CTRL1;
+        XCVR_SHADOW_WR(RX_DIG_RCCAL_CTRL1, reg_backup_ptr->XCVR_RX_DIG_RCCAL_CTRL1);
         XCVR_RX_DIG->DFT_CTRL    = reg_backup_ptr->XCVR_RX_DIG_DFT_CTRL;
-        XCVR_RX_DIG->CTRL1       = reg_backup_ptr->XCVR_RX_DIG_CTRL1;
+        XCVR_SHADOW_WR(RX_DIG_CTRL1, reg_backup_ptr->XCVR_RX_DIG_CTRL1);
 #if defined(NXP_RADIO_GEN) && (NXP_RADIO_GEN > 450)
         XCVR_RX_DIG->AGC_CTRL = reg_backup_ptr->XCVR_RX_DIG_AGC_CTRL;
 #endif
@@ -2551,237 +2561,403 @@ xcvrLclStatus_t XCVR_LCL_ConfigLclBlock(xcvr_lcl_rsm_config_t * rsm_settings_ptr
 
 
 #define HPM_CAL_IN_RX 0
-xcvrLclStatus_t XCVR_LCL_CalibratePll(const channel_num_t *hadm_chan_idx_list,
-                                      xcvr_lcl_pll_cal_data_t *cal_results,
-                                      uint16_t num_freqs,
-                                      bool update_curve_fit,
-                                      XCVR_RSM_SQTE_RATE_T rate)
+
+/* Storage for the PLL calibration settings and the registers it modifies, shared by the blocking and the event driven
+ * calibration */
+static struct
 {
-    xcvrLclStatus_t status = gXcvrLclStatusSuccess;
-    /* Error checking for NULL pointer and invalid sequence lengths */
-    if ((hadm_chan_idx_list == NULLPTR) || (cal_results == NULLPTR)  || (num_freqs == 0U))
+    const channel_num_t *chan_list;
+    xcvr_lcl_pll_cal_data_t *results;
+    pll_cal_callback user_callback;
+    void *userData;
+    uint32_t hpm_ctrl_restore;
+    uint32_t hpmcal_ctrl_restore;
+    uint32_t hpm_cal_time;
+#if (HPM_CAL_IN_RX)
+    uint32_t tsm_ovrd3_restore;
+    uint32_t tsm_timing29_restore;
+    uint32_t tsm_timing39_restore;
+    uint32_t tsm_timing40_restore;
+    uint32_t tsm_timing12_restore;
+    uint32_t tsm_timing33_restore;
+    uint32_t tsm_timing41_restore;
+    uint32_t tsm_timing47_restore;
+    uint32_t tsm_timing48_restore;
+    uint32_t tsm_timing49_restore;
+    uint32_t tsm_timing50_restore;
+    uint32_t tsm_timing32_restore;
+    uint32_t tsm_timing51_restore;
+    uint32_t tsm_timing21_restore;
+#else
+    uint32_t tsm_timing12_restore;
+#endif /* HPM_CAL_IN_RX */
+    xcvrLclStatus_t status;
+    XCVR_RSM_SQTE_RATE_T rate;
+    uint16_t num_freqs;
+    uint16_t next_freq;
+    channel_num_t chan_2442_num;
+    uint8_t hop_tbl_cfg_restore;
+    bool update_curve_fit;
+    bool busy;
+} pll_cal_ctx;
+
+/* Save the registers modified by the PLL calibration and configure the PLL and TSM for it */
+static void XCVR_LCL_PllCalSetup(const channel_num_t *hadm_chan_idx_list,
+                                 xcvr_lcl_pll_cal_data_t *cal_results,
+                                 uint16_t num_freqs,
+                                 bool update_curve_fit,
+                                 XCVR_RSM_SQTE_RATE_T rate)
+{
+    uint8_t i;
+
+    pll_cal_ctx.chan_list        = hadm_chan_idx_list;
+    pll_cal_ctx.results          = cal_results;
+    pll_cal_ctx.num_freqs        = num_freqs;
+    pll_cal_ctx.next_freq        = 0U;
+    pll_cal_ctx.update_curve_fit = update_curve_fit;
+    pll_cal_ctx.rate             = rate;
+    pll_cal_ctx.status           = gXcvrLclStatusSuccess;
+    pll_cal_ctx.hpm_cal_time     = 250U; /* init to an error value */
+
+    pll_cal_ctx.hop_tbl_cfg_restore =
+        (uint8_t)(((XCVR_PLL_DIG->CHAN_MAP & XCVR_PLL_DIG_CHAN_MAP_HOP_TBL_CFG_OVRD_MASK) >>
+                   XCVR_PLL_DIG_CHAN_MAP_HOP_TBL_CFG_OVRD_SHIFT)); /* used for later restore  */
+    XCVR_LCL_RsmPLLInit(rate);                                     /* Apply RSM PLL customizations */
+    if (rate == XCVR_RSM_RATE_2MBPS)
     {
-        status = gXcvrLclStatusInvalidArgs;
+        /* Force alternate data rate selection */
+        RADIO_CTRL->RF_CTRL |=
+            RADIO_CTRL_RF_CTRL_RIF_SEL_2MBPS_OVRD_EN_MASK | RADIO_CTRL_RF_CTRL_RIF_SEL_2MBPS_OVRD_MASK;
     }
-    else
-    {
-        uint8_t hop_tbl_cfg_restore;
-        hop_tbl_cfg_restore = (uint8_t)(((XCVR_PLL_DIG->CHAN_MAP & XCVR_PLL_DIG_CHAN_MAP_HOP_TBL_CFG_OVRD_MASK) >>
-                                         XCVR_PLL_DIG_CHAN_MAP_HOP_TBL_CFG_OVRD_SHIFT)); /* used for later restore  */
-        XCVR_LCL_RsmPLLInit(rate); /* Apply RSM PLL customizations */
-        if (rate == XCVR_RSM_RATE_2MBPS)
-        {
-            /* Force alternate data rate selection */
-            RADIO_CTRL->RF_CTRL |=
-                RADIO_CTRL_RF_CTRL_RIF_SEL_2MBPS_OVRD_EN_MASK | RADIO_CTRL_RF_CTRL_RIF_SEL_2MBPS_OVRD_MASK;
-        }
-        /* Loop through the list of frequencies and force warmup, grab the calibration data, and warmdown */
-        uint16_t i;
-        const channel_num_t *list_ptr        = hadm_chan_idx_list;
-        xcvr_lcl_pll_cal_data_t *results_ptr = cal_results;
-        uint32_t temp_hpm_ctrl               = XCVR_PLL_DIG->HPM_CTRL;
-        uint32_t temp_hpmcal_ctrl            = XCVR_PLL_DIG->HPMCAL_CTRL;
-        uint32_t temp_count;
-        uint32_t hpm_cal_time = 250U; /* init to an error value */
+    pll_cal_ctx.hpm_ctrl_restore    = XCVR_SHADOW_RD(PLL_DIG_HPM_CTRL);
+    pll_cal_ctx.hpmcal_ctrl_restore = XCVR_PLL_DIG->HPMCAL_CTRL;
 #if (HPM_CAL_IN_RX)
-        uint32_t tsm_ovrd3_restore    = XCVR_TSM->OVRD3;
-        uint32_t tsm_timing29_restore = XCVR_TSM->TIMING29;
-        uint32_t tsm_timing39_restore = XCVR_TSM->TIMING39;
-        uint32_t tsm_timing40_restore = XCVR_TSM->TIMING40;
-        uint32_t tsm_timing12_restore = XCVR_TSM->TIMING12;
-        uint32_t tsm_timing33_restore = XCVR_TSM->TIMING33;
-        uint32_t tsm_timing41_restore = XCVR_TSM->TIMING41;
-        uint32_t tsm_timing47_restore = XCVR_TSM->TIMING47;
-        uint32_t tsm_timing48_restore = XCVR_TSM->TIMING48;
-        uint32_t tsm_timing49_restore = XCVR_TSM->TIMING49;
-        uint32_t tsm_timing50_restore = XCVR_TSM->TIMING50;
-        uint32_t tsm_timing32_restore = XCVR_TSM->TIMING32;
-        uint32_t tsm_timing51_restore = XCVR_TSM->TIMING51;
-        uint32_t tsm_timing21_restore = XCVR_TSM->TIMING21;
+    pll_cal_ctx.tsm_ovrd3_restore    = XCVR_TSM->OVRD3;
+    pll_cal_ctx.tsm_timing29_restore = XCVR_TSM->TIMING29;
+    pll_cal_ctx.tsm_timing39_restore = XCVR_TSM->TIMING39;
+    pll_cal_ctx.tsm_timing40_restore = XCVR_TSM->TIMING40;
+    pll_cal_ctx.tsm_timing12_restore = XCVR_TSM->TIMING12;
+    pll_cal_ctx.tsm_timing33_restore = XCVR_TSM->TIMING33;
+    pll_cal_ctx.tsm_timing41_restore = XCVR_TSM->TIMING41;
+    pll_cal_ctx.tsm_timing47_restore = XCVR_TSM->TIMING47;
+    pll_cal_ctx.tsm_timing48_restore = XCVR_TSM->TIMING48;
+    pll_cal_ctx.tsm_timing49_restore = XCVR_TSM->TIMING49;
+    pll_cal_ctx.tsm_timing50_restore = XCVR_TSM->TIMING50;
+    pll_cal_ctx.tsm_timing32_restore = XCVR_TSM->TIMING32;
+    pll_cal_ctx.tsm_timing51_restore = XCVR_TSM->TIMING51;
+    pll_cal_ctx.tsm_timing21_restore = XCVR_TSM->TIMING21;
 #else
-        uint32_t tsm_timing12_restore = XCVR_TSM->TIMING12;
+    pll_cal_ctx.tsm_timing12_restore = XCVR_TSM->TIMING12;
 #endif /* HPM_CAL_IN_RX */
-        channel_num_t chan_2442_num;
-        if (update_curve_fit)
-        {
-            status = XCVR_LCL_MakeChanNumFromHadmIndex(
-                40U, &chan_2442_num); /* Convert to the frequency list format for comparison later */
-            /* Setup for calculation of effective frequency of calibration */
-            i = (uint8_t)((XCVR_PLL_DIG->HPM_CTRL & XCVR_PLL_DIG_HPM_CTRL_HPM_CAL_TIME_MASK) >>
-                          XCVR_PLL_DIG_HPM_CTRL_HPM_CAL_TIME_SHIFT);
-            switch (i)
-            {
-                case 0:
-                    hpm_cal_time = 25U;
-                    break;
-                case 1:
-                    hpm_cal_time = 50U;
-                    break;
-                case 2:
-                    hpm_cal_time = 100U;
-                    break;
-                default:
-                    hpm_cal_time = 250U; /* Error value */
-                    break;
-            }
+    if (update_curve_fit)
+    {
+        pll_cal_ctx.status = XCVR_LCL_MakeChanNumFromHadmIndex(
+            40U, &pll_cal_ctx.chan_2442_num); /* Convert to the frequency list format for comparison later */
+        /* Setup for calculation of effective frequency of calibration */
+        i = (uint8_t)((XCVR_SHADOW_RD(PLL_DIG_HPM_CTRL) & XCVR_PLL_DIG_HPM_CTRL_HPM_CAL_TIME_MASK) >>
+                      XCVR_PLL_DIG_HPM_CTRL_HPM_CAL_TIME_SHIFT);
+        switch (i)
+        {
+            case 0:
+                pll_cal_ctx.hpm_cal_time = 25U;
+                break;
+            case 1:
+                pll_cal_ctx.hpm_cal_time = 50U;
+                break;
+            case 2:
+                pll_cal_ctx.hpm_cal_time = 100U;
+                break;
+            default:
+                pll_cal_ctx.hpm_cal_time = 250U; /* Error value */
+                break;
         }
-        /* Set PLL to use HOP_TBL_CFG_OVRD for manual frequency control; OVRD_EN is asserted during manual calibration,
-         * RSM asserts this signal automatically during normal RSM usage */
-        XCVR_PLL_DIG->CHAN_MAP &= ~(XCVR_PLL_DIG_CHAN_MAP_HOP_TBL_CFG_OVRD_MASK);
-        XCVR_PLL_DIG->CHAN_MAP |=
-            XCVR_PLL_DIG_CHAN_MAP_HOP_TBL_CFG_OVRD_EN_MASK | XCVR_PLL_DIG_CHAN_MAP_HOP_TBL_CFG_OVRD(2U);
-        /* During calibration, HPM_CAL must always happen. CTUNE should be enabled by default so is not handled here */
-        XCVR_PLL_DIG->HPM_CTRL &= ~(XCVR_PLL_DIG_HPM_CTRL_RX_HPM_CAL_EN_MASK
+    }
+    /* Set PLL to use HOP_TBL_CFG_OVRD for manual frequency control; OVRD_EN is asserted during manual calibration,
+     * RSM asserts this signal automatically during normal RSM usage */
+    XCVR_PLL_DIG->CHAN_MAP &= ~(XCVR_PLL_DIG_CHAN_MAP_HOP_TBL_CFG_OVRD_MASK);
+    XCVR_PLL_DIG->CHAN_MAP |=
+        XCVR_PLL_DIG_CHAN_MAP_HOP_TBL_CFG_OVRD_EN_MASK | XCVR_PLL_DIG_CHAN_MAP_HOP_TBL_CFG_OVRD(2U);
+    /* During calibration, HPM_CAL must always happen. CTUNE should be enabled by default so is not handled here */
+    uint32_t hpm_ctrl_clr = XCVR_PLL_DIG_HPM_CTRL_RX_HPM_CAL_EN_MASK;
 #if defined(NXP_RADIO_GEN) && (NXP_RADIO_GEN >= 470) /* Only applies to KW47 */
-              | XCVR_PLL_DIG_HPM_CTRL_HPM_DYNAMIC_SEL_MASK
+    hpm_ctrl_clr |= XCVR_PLL_DIG_HPM_CTRL_HPM_DYNAMIC_SEL_MASK;
 #endif /* defined(NXP_RADIO_GEN) && (NXP_RADIO_GEN >= 470)  */
-                ); /* HPM cal is performed during warmup (not driven from RSM) */
-        XCVR_PLL_DIG->HPM_CTRL |=
-            XCVR_PLL_DIG_HPM_CTRL_RX_HPM_CAL_EN_MASK; /* HPM cal perfomed during RX (instead of just during TX) */
+    XCVR_SHADOW_CLR(PLL_DIG_HPM_CTRL, hpm_ctrl_clr); /* HPM cal is performed during warmup (not driven from RSM) */
+    /* HPM cal perfomed during RX (instead of just during TX) */
+    XCVR_SHADOW_SET(PLL_DIG_HPM_CTRL, XCVR_PLL_DIG_HPM_CTRL_RX_HPM_CAL_EN_MASK);
 #if (HPM_CAL_IN_RX)
-        /* Delay PLL loop closure until HPM CAL has time to complete */
-        XCVR_TSM->TIMING29 &=
-            ~(XCVR_TSM_TIMING29_SEQ_BG_PUP_IBG_TX_RX_HI_MASK | XCVR_TSM_TIMING29_SEQ_BG_PUP_IBG_TX_RX_LO_MASK);
-        XCVR_TSM->TIMING39 &= ~(XCVR_TSM_TIMING39_SEQ_XO_DIST_EN_CLK_ADCDAC_RX_HI_MASK);
-        XCVR_TSM->TIMING40 &= ~(XCVR_TSM_TIMING40_SEQ_DAC_PUP_RX_HI_MASK | XCVR_TSM_TIMING40_SEQ_DAC_PUP_RX_LO_MASK);
-        XCVR_TSM->TIMING12 &= ~(XCVR_TSM_TIMING12_SIGMA_DELTA_EN_RX_HI_MASK);
-        XCVR_TSM->TIMING33 &=
-            ~(XCVR_TSM_TIMING33_SEQ_PD_EN_FCAL_BIAS_RX_HI_MASK | XCVR_TSM_TIMING33_SEQ_PD_EN_FCAL_BIAS_RX_LO_MASK);
-        XCVR_TSM->TIMING41 &= ~(XCVR_TSM_TIMING41_SEQ_VCO_EN_HPM_RX_HI_MASK);
-        XCVR_TSM->TIMING47 &= ~(XCVR_TSM_TIMING47_SEQ_DIVN_PUP_RX_HI_MASK);
-        XCVR_TSM->TIMING48 &= ~(XCVR_TSM_TIMING48_SEQ_DIVN_CLOSEDLOOP_RX_HI_MASK);
-        XCVR_TSM->TIMING49 &= ~(XCVR_TSM_TIMING49_SEQ_PD_EN_PD_DRV_RX_HI_MASK);
-        XCVR_TSM->TIMING29 |=
-            XCVR_TSM_TIMING29_SEQ_BG_PUP_IBG_TX_RX_HI(0U) | XCVR_TSM_TIMING29_SEQ_BG_PUP_IBG_TX_RX_LO(89U);
-        XCVR_TSM->TIMING39 |= XCVR_TSM_TIMING39_SEQ_XO_DIST_EN_CLK_ADCDAC_RX_HI(17U);
-        XCVR_TSM->TIMING40 |= XCVR_TSM_TIMING40_SEQ_DAC_PUP_RX_HI(0U) | XCVR_TSM_TIMING40_SEQ_DAC_PUP_RX_LO(89U);
-        XCVR_TSM->TIMING12 |= XCVR_TSM_TIMING12_SIGMA_DELTA_EN_RX_HI(87U);
-        XCVR_TSM->TIMING33 |=
-            XCVR_TSM_TIMING33_SEQ_PD_EN_FCAL_BIAS_RX_HI(0x11U) | XCVR_TSM_TIMING33_SEQ_PD_EN_FCAL_BIAS_RX_LO(89U);
-        XCVR_TSM->TIMING41 |= XCVR_TSM_TIMING41_SEQ_VCO_EN_HPM_RX_HI(0x11U);
-        XCVR_TSM->TIMING47 |= XCVR_TSM_TIMING47_SEQ_DIVN_PUP_RX_HI(87U);
-        XCVR_TSM->TIMING48 |= XCVR_TSM_TIMING48_SEQ_DIVN_CLOSEDLOOP_RX_HI(89U);
-        XCVR_TSM->TIMING49 |= XCVR_TSM_TIMING49_SEQ_PD_EN_PD_DRV_RX_HI(89U);
-        /* New overrides to resolve RX to TX offset */
-        XCVR_TSM->TIMING50 &= ~(XCVR_TSM_TIMING50_SEQ_CBPF_EN_DCOC_RX_HI_MASK);
-        XCVR_TSM->TIMING50 |= XCVR_TSM_TIMING50_SEQ_CBPF_EN_DCOC_RX_HI(17U);
-        XCVR_TSM->TIMING32 &=
-            ~(XCVR_TSM_TIMING32_SEQ_RCCAL_PUP_RX_HI_MASK | XCVR_TSM_TIMING32_SEQ_RCCAL_PUP_RX_LO_MASK);
-        XCVR_TSM->TIMING32 |=
-            XCVR_TSM_TIMING32_SEQ_RCCAL_PUP_RX_HI(0xFFU) | XCVR_TSM_TIMING32_SEQ_RCCAL_PUP_RX_LO(0xFFU);
-        XCVR_TSM->TIMING51 &= ~(XCVR_TSM_TIMING51_SEQ_RX_GANG_PUP_RX_HI_MASK);
-        XCVR_TSM->TIMING51 |= XCVR_TSM_TIMING51_SEQ_RX_GANG_PUP_RX_HI(17U);
-        XCVR_TSM->TIMING21 &= ~(XCVR_TSM_TIMING21_SEQ_LDO_CAL_PUP_RX_LO_MASK);
-        XCVR_TSM->TIMING21 |= XCVR_TSM_TIMING21_SEQ_LDO_CAL_PUP_RX_LO(17U);
+    /* Delay PLL loop closure until HPM CAL has time to complete */
+    XCVR_TSM->TIMING29 &=
+        ~(XCVR_TSM_TIMING29_SEQ_BG_PUP_IBG_TX_RX_HI_MASK | XCVR_TSM_TIMING29_SEQ_BG_PUP_IBG_TX_RX_LO_MASK);
+    XCVR_TSM->TIMING39 &= ~(XCVR_TSM_TIMING39_SEQ_XO_DIST_EN_CLK_ADCDAC_RX_HI_MASK);
+    XCVR_TSM->TIMING40 &= ~(XCVR_TSM_TIMING40_SEQ_DAC_PUP_RX_HI_MASK | XCVR_TSM_TIMING40_SEQ_DAC_PUP_RX_LO_MASK);
+    XCVR_TSM->TIMING12 &= ~(XCVR_TSM_TIMING12_SIGMA_DELTA_EN_RX_HI_MASK);
+    XCVR_TSM->TIMING33 &=
+        ~(XCVR_TSM_TIMING33_SEQ_PD_EN_FCAL_BIAS_RX_HI_MASK | XCVR_TSM_TIMING33_SEQ_PD_EN_FCAL_BIAS_RX_LO_MASK);
+    XCVR_TSM->TIMING41 &= ~(XCVR_TSM_TIMING41_SEQ_VCO_EN_HPM_RX_HI_MASK);
+    XCVR_TSM->TIMING47 &= ~(XCVR_TSM_TIMING47_SEQ_DIVN_PUP_RX_HI_MASK);
+    XCVR_TSM->TIMING48 &= ~(XCVR_TSM_TIMING48_SEQ_DIVN_CLOSEDLOOP_RX_HI_MASK);
+    XCVR_TSM->TIMING49 &= ~(XCVR_TSM_TIMING49_SEQ_PD_EN_PD_DRV_RX_HI_MASK);
+    XCVR_TSM->TIMING29 |=
+        XCVR_TSM_TIMING29_SEQ_BG_PUP_IBG_TX_RX_HI(0U) | XCVR_TSM_TIMING29_SEQ_BG_PUP_IBG_TX_RX_LO(89U);
+    XCVR_TSM->TIMING39 |= XCVR_TSM_TIMING39_SEQ_XO_DIST_EN_CLK_ADCDAC_RX_HI(17U);
+    XCVR_TSM->TIMING40 |= XCVR_TSM_TIMING40_SEQ_DAC_PUP_RX_HI(0U) | XCVR_TSM_TIMING40_SEQ_DAC_PUP_RX_LO(89U);
+    XCVR_TSM->TIMING12 |= XCVR_TSM_TIMING12_SIGMA_DELTA_EN_RX_HI(87U);
+    XCVR_TSM->TIMING33 |=
+        XCVR_TSM_TIMING33_SEQ_PD_EN_FCAL_BIAS_RX_HI(0x11U) | XCVR_TSM_TIMING33_SEQ_PD_EN_FCAL_BIAS_RX_LO(89U);
+    XCVR_TSM->TIMING41 |= XCVR_TSM_TIMING41_SEQ_VCO_EN_HPM_RX_HI(0x11U);
+    XCVR_TSM->TIMING47 |= XCVR_TSM_TIMING47_SEQ_DIVN_PUP_RX_HI(87U);
+    XCVR_TSM->TIMING48 |= XCVR_TSM_TIMING48_SEQ_DIVN_CLOSEDLOOP_RX_HI(89U);
+    XCVR_TSM->TIMING49 |= XCVR_TSM_TIMING49_SEQ_PD_EN_PD_DRV_RX_HI(89U);
+    /* New overrides to resolve RX to TX offset */
+    XCVR_TSM->TIMING50 &= ~(XCVR_TSM_TIMING50_SEQ_CBPF_EN_DCOC_RX_HI_MASK);
+    XCVR_TSM->TIMING50 |= XCVR_TSM_TIMING50_SEQ_CBPF_EN_DCOC_RX_HI(17U);
+    XCVR_TSM->TIMING32 &= ~(XCVR_TSM_TIMING32_SEQ_RCCAL_PUP_RX_HI_MASK | XCVR_TSM_TIMING32_SEQ_RCCAL_PUP_RX_LO_MASK);
+    XCVR_TSM->TIMING32 |= XCVR_TSM_TIMING32_SEQ_RCCAL_PUP_RX_HI(0xFFU) | XCVR_TSM_TIMING32_SEQ_RCCAL_PUP_RX_LO(0xFFU);
+    XCVR_TSM->TIMING51 &= ~(XCVR_TSM_TIMING51_SEQ_RX_GANG_PUP_RX_HI_MASK);
+    XCVR_TSM->TIMING51 |= XCVR_TSM_TIMING51_SEQ_RX_GANG_PUP_RX_HI(17U);
+    XCVR_TSM->TIMING21 &= ~(XCVR_TSM_TIMING21_SEQ_LDO_CAL_PUP_RX_LO_MASK);
+    XCVR_TSM->TIMING21 |= XCVR_TSM_TIMING21_SEQ_LDO_CAL_PUP_RX_LO(17U);
 
 #else
-        XCVR_TSM->TIMING12 &= ~(XCVR_TSM_TIMING12_SIGMA_DELTA_EN_TX_HI_MASK);
-        XCVR_TSM->TIMING12 |= XCVR_TSM_TIMING12_SIGMA_DELTA_EN_TX_HI(87U);
-        XCVR_TSM->OVRD0 |= XCVR_TSM_OVRD0_TX_DIG_EN_OVRD_EN_MASK;
-        XCVR_TSM->OVRD0 &=
-            ~(XCVR_TSM_OVRD0_TX_DIG_EN_OVRD_MASK); /* Forces TX_DIG_EN to zero  so nothing will be transmitted */
+    XCVR_TSM->TIMING12 &= ~(XCVR_TSM_TIMING12_SIGMA_DELTA_EN_TX_HI_MASK);
+    XCVR_TSM->TIMING12 |= XCVR_TSM_TIMING12_SIGMA_DELTA_EN_TX_HI(87U);
+    XCVR_TSM->OVRD0 |= XCVR_TSM_OVRD0_TX_DIG_EN_OVRD_EN_MASK;
+    /* Forces TX_DIG_EN to zero  so nothing will be transmitted */
+    XCVR_TSM->OVRD0 &= ~(XCVR_TSM_OVRD0_TX_DIG_EN_OVRD_MASK);
 #endif /* HPM_CAL_IN_RX */
-        for (i = 0; i < num_freqs; i++)
-        {
-            /* Setup the desired frequency */
-            XCVR_PLL_DIG->CHAN_MAP &= ~(XCVR_PLL_DIG_CHAN_MAP_CHANNEL_NUM_OVRD_MASK);
-            XCVR_PLL_DIG->CHAN_MAP |= XCVR_PLL_DIG_CHAN_MAP_CHANNEL_NUM_OVRD(list_ptr[i]);
-            /* Warmup RX & wait for completion - takes ~100usec */
+}
+
+/* Tune the PLL to the next calibration frequency and start the warmup */
+static void XCVR_LCL_PllCalWarmup(void)
+{
+    /* Setup the desired frequency */
+    XCVR_PLL_DIG->CHAN_MAP &= ~(XCVR_PLL_DIG_CHAN_MAP_CHANNEL_NUM_OVRD_MASK);
+    XCVR_PLL_DIG->CHAN_MAP |= XCVR_PLL_DIG_CHAN_MAP_CHANNEL_NUM_OVRD(pll_cal_ctx.chan_list[pll_cal_ctx.next_freq]);
+    /* Warmup - takes ~100usec */
+#if (HPM_CAL_IN_RX)
+    XCVR_ForceRxWu();
+#else
+    XCVR_ForceTxWu();
+#endif /* HPM_CAL_IN_RX */
+}
+
+/* Check for the end of the warmup started by XCVR_LCL_PllCalWarmup(), without waiting */
+static bool XCVR_LCL_PllCalWarmupDone(void)
+{
+#if (HPM_CAL_IN_RX)
+    uint32_t end_of_wu = (XCVR_SHADOW_RD(TSM_END_OF_SEQ) & XCVR_TSM_END_OF_SEQ_END_OF_RX_WU_MASK) >>
+                         XCVR_TSM_END_OF_SEQ_END_OF_RX_WU_SHIFT;
+#else
+    uint32_t end_of_wu = (XCVR_SHADOW_RD(TSM_END_OF_SEQ) & XCVR_TSM_END_OF_SEQ_END_OF_TX_WU_MASK) >>
+                         XCVR_TSM_END_OF_SEQ_END_OF_TX_WU_SHIFT;
+#endif /* HPM_CAL_IN_RX */
+
+    return (((XCVR_MISC->XCVR_STATUS & XCVR_MISC_XCVR_STATUS_TSM_COUNT_MASK) >>
+             XCVR_MISC_XCVR_STATUS_TSM_COUNT_SHIFT) == end_of_wu);
+}
+
+/* Capture the calibration values of the current frequency once warmed up, then warmdown */
+static void XCVR_LCL_PllCalCapture(void)
+{
+    uint32_t temp_count;
+    xcvr_lcl_pll_cal_data_t *results_ptr = &pll_cal_ctx.results[pll_cal_ctx.next_freq];
+
 #if (HPM_CAL_IN_RX)
-            XCVR_ForceRxWu();
-            XCVR_WaitRxWu();
 #if (1)
-            temp_count = 300U;
+    temp_count = 300U;
 #else
-            temp_count = 10000U;
+    temp_count = 10000U;
 #endif
-            while (temp_count > 0U)
-            {
-                temp_count--;
-            }
-#else
-            XCVR_ForceTxWu();
-            XCVR_WaitTxWu();
+    while (temp_count > 0U)
+    {
+        temp_count--;
+    }
 #endif /* HPM_CAL_IN_RX */
-            /* Capture calibrated values & warmdown */
-            results_ptr[i].hpm_cal_val =
-                (uint16_t)((XCVR_PLL_DIG->HPMCAL_CTRL & XCVR_PLL_DIG_HPMCAL_CTRL_HPM_CAL_FACTOR_MASK) >>
-                           XCVR_PLL_DIG_HPMCAL_CTRL_HPM_CAL_FACTOR_SHIFT);
+    /* Capture calibrated values & warmdown */
+    results_ptr->hpm_cal_val = (uint16_t)((XCVR_PLL_DIG->HPMCAL_CTRL & XCVR_PLL_DIG_HPMCAL_CTRL_HPM_CAL_FACTOR_MASK) >>
+                                          XCVR_PLL_DIG_HPMCAL_CTRL_HPM_CAL_FACTOR_SHIFT);
 #if (defined(CTUNE_MANUAL_CAL) && (CTUNE_MANUAL_CAL == 1))
-            results_ptr[i].ctune_cal_val =
-                (uint8_t)((XCVR_PLL_DIG->CTUNE_RES & XCVR_PLL_DIG_CTUNE_RES_CTUNE_SELECTED_MASK) >>
-                          XCVR_PLL_DIG_CTUNE_RES_CTUNE_SELECTED_SHIFT);
+    results_ptr->ctune_cal_val = (uint8_t)((XCVR_PLL_DIG->CTUNE_RES & XCVR_PLL_DIG_CTUNE_RES_CTUNE_SELECTED_MASK) >>
+                                           XCVR_PLL_DIG_CTUNE_RES_CTUNE_SELECTED_SHIFT);
 #endif /* (defined(CTUNE_MANUAL_CAL) && (CTUNE_MANUAL_CAL == 1)) */
-            if (update_curve_fit &&
-                (list_ptr[i] ==
-                 chan_2442_num)) /* Only perform the curve fit update when needed and when the frequency is 2442MHz. */
-            {
-                /* calculation of effective frequency (in MHz) */
-                temp_count = ((XCVR_PLL_DIG->HPM_CAL1 & XCVR_PLL_DIG_HPM_CAL1_HPM_COUNT_1_MASK) >>
-                              XCVR_PLL_DIG_HPM_CAL1_HPM_COUNT_1_SHIFT);
-                temp_count += ((XCVR_PLL_DIG->HPM_CAL2 & XCVR_PLL_DIG_HPM_CAL2_HPM_COUNT_2_MASK) >>
-                               XCVR_PLL_DIG_HPM_CAL2_HPM_COUNT_2_SHIFT);
-                hpm_cal_2442_data.eff_cal_freq =
-                    (uint16_t)(temp_count / (4U * hpm_cal_time)); /* Frequency of the calibration in MHz*/
-                hpm_cal_2442_data.hpm_cal_factor_2442 = results_ptr[i].hpm_cal_val;
-            }
+    /* Only perform the curve fit update when needed and when the frequency is 2442MHz. */
+    if (pll_cal_ctx.update_curve_fit && (pll_cal_ctx.chan_list[pll_cal_ctx.next_freq] == pll_cal_ctx.chan_2442_num))
+    {
+        /* calculation of effective frequency (in MHz) */
+        temp_count = ((XCVR_PLL_DIG->HPM_CAL1 & XCVR_PLL_DIG_HPM_CAL1_HPM_COUNT_1_MASK) >>
+                      XCVR_PLL_DIG_HPM_CAL1_HPM_COUNT_1_SHIFT);
+        temp_count += ((XCVR_PLL_DIG->HPM_CAL2 & XCVR_PLL_DIG_HPM_CAL2_HPM_COUNT_2_MASK) >>
+                       XCVR_PLL_DIG_HPM_CAL2_HPM_COUNT_2_SHIFT);
+        hpm_cal_2442_data.eff_cal_freq =
+            (uint16_t)(temp_count / (4U * pll_cal_ctx.hpm_cal_time)); /* Frequency of the calibration in MHz*/
+        hpm_cal_2442_data.hpm_cal_factor_2442 = results_ptr->hpm_cal_val;
+    }
 #if (HPM_CAL_IN_RX)
-            XCVR_ForceRxWd();
+    XCVR_ForceRxWd();
 #else
-            XCVR_ForceTxWd();
-#endif      /* HPM_CAL_IN_RX */
-            /* Wait for completion of warmdown (until TSM goes to idle) */
-#if (1)
-            XCVR_WaitRxTxWd();
+    XCVR_ForceTxWd();
+#endif /* HPM_CAL_IN_RX */
+    /* Wait for completion of warmdown (until TSM goes to idle), only a few usec */
+    XCVR_WaitRxTxWd();
+    while (((XCVR_MISC->XCVR_STATUS & XCVR_MISC_XCVR_STATUS_TSM_COUNT_MASK) >> XCVR_MISC_XCVR_STATUS_TSM_COUNT_SHIFT) !=
+           0U)
+    {
+    }
+    pll_cal_ctx.next_freq++;
+}
+
+/* Restore the registers saved by XCVR_LCL_PllCalSetup() */
+static void XCVR_LCL_PllCalRestore(void)
+{
+    XCVR_PLL_DIG->CHAN_MAP &=
+        ~(XCVR_PLL_DIG_CHAN_MAP_CHANNEL_NUM_OVRD_MASK | /* Clear the channel number override, it appears to cause
+                                                           problems later... */
+          XCVR_PLL_DIG_CHAN_MAP_HOP_TBL_CFG_OVRD_EN_MASK |
+          XCVR_PLL_DIG_CHAN_MAP_HOP_TBL_CFG_OVRD_MASK); /* Release the override for HOP_TBL_CFG */
+    XCVR_PLL_DIG->CHAN_MAP |= XCVR_PLL_DIG_CHAN_MAP_HOP_TBL_CFG_OVRD(pll_cal_ctx.hop_tbl_cfg_restore);
+
+    /* Restore TSM timing or override values supporting HPM_CAL in RX operation */
+#if (HPM_CAL_IN_RX)
+    XCVR_TSM->OVRD3    = pll_cal_ctx.tsm_ovrd3_restore;
+    XCVR_TSM->TIMING29 = pll_cal_ctx.tsm_timing29_restore;
+    XCVR_TSM->TIMING39 = pll_cal_ctx.tsm_timing39_restore;
+    XCVR_TSM->TIMING40 = pll_cal_ctx.tsm_timing40_restore;
+    XCVR_TSM->TIMING12 = pll_cal_ctx.tsm_timing12_restore;
+    XCVR_TSM->TIMING33 = pll_cal_ctx.tsm_timing33_restore;
+    XCVR_TSM->TIMING41 = pll_cal_ctx.tsm_timing41_restore;
+    XCVR_TSM->TIMING47 = pll_cal_ctx.tsm_timing47_restore;
+    XCVR_TSM->TIMING48 = pll_cal_ctx.tsm_timing48_restore;
+    XCVR_TSM->TIMING49 = pll_cal_ctx.tsm_timing49_restore;
+    XCVR_TSM->TIMING50 = pll_cal_ctx.tsm_timing50_restore;
+    XCVR_TSM->TIMING32 = pll_cal_ctx.tsm_timing32_restore;
+    XCVR_TSM->TIMING51 = pll_cal_ctx.tsm_timing51_restore;
+    XCVR_TSM->TIMING21 = pll_cal_ctx.tsm_timing21_restore;
 #else
-            temp_count = 10000U;
-            while (temp_count > 0U)
+    XCVR_TSM->OVRD0 &= ~(XCVR_TSM_OVRD0_TX_DIG_EN_OVRD_EN_MASK);
+    XCVR_TSM->TIMING12 = pll_cal_ctx.tsm_timing12_restore;
+#endif /* HPM_CAL_IN_RX */
+    if (pll_cal_ctx.rate == XCVR_RSM_RATE_2MBPS)
+    {
+        /* Remove alternate data rate selection */
+        RADIO_CTRL->RF_CTRL &=
+            ~(RADIO_CTRL_RF_CTRL_RIF_SEL_2MBPS_OVRD_EN_MASK | RADIO_CTRL_RF_CTRL_RIF_SEL_2MBPS_OVRD_MASK);
+    }
+
+    /* Restore the setting for whether HPM_CAL happens in PLL or not */
+    XCVR_SHADOW_WR(PLL_DIG_HPM_CTRL, pll_cal_ctx.hpm_ctrl_restore);
+    XCVR_PLL_DIG->HPMCAL_CTRL = pll_cal_ctx.hpmcal_ctrl_restore;
+}
+
+xcvrLclStatus_t XCVR_LCL_CalibratePll(const channel_num_t *hadm_chan_idx_list,
+                                      xcvr_lcl_pll_cal_data_t *cal_results,
+                                      uint16_t num_freqs,
+                                      bool update_curve_fit,
+                                      XCVR_RSM_SQTE_RATE_T rate)
+{
+    xcvrLclStatus_t status = gXcvrLclStatusSuccess;
+    /* Error checking for NULL pointer and invalid sequence lengths, and for a calibration already in progress */
+    if ((hadm_chan_idx_list == NULLPTR) || (cal_results == NULLPTR) || (num_freqs == 0U) || pll_cal_ctx.busy)
+    {
+        status = gXcvrLclStatusInvalidArgs;
+    }
+    else
+    {
+        XCVR_LCL_PllCalSetup(hadm_chan_idx_list, cal_results, num_freqs, update_curve_fit, rate);
+        /* Loop through the list of frequencies and force warmup, grab the calibration data, and warmdown */
+        while (pll_cal_ctx.next_freq < num_freqs)
+        {
+            XCVR_LCL_PllCalWarmup();
+#if (HPM_CAL_IN_RX)
+            XCVR_WaitRxWu();
+#else
+            XCVR_WaitTxWu();
+#endif /* HPM_CAL_IN_RX */
+            XCVR_LCL_PllCalCapture();
+        }
+        XCVR_LCL_PllCalRestore();
+        status = pll_cal_ctx.status;
+    }
+
+    return status;
+}
+
+xcvrLclStatus_t XCVR_LCL_CalibratePllStart(const channel_num_t *hadm_chan_idx_list,
+                                           xcvr_lcl_pll_cal_data_t *cal_results,
+                                           uint16_t num_freqs,
+                                           bool update_curve_fit,
+                                           XCVR_RSM_SQTE_RATE_T rate,
+                                           const pll_cal_handler_t *user_handler)
+{
+    xcvrLclStatus_t status = gXcvrLclStatusSuccess;
+    /* Error checking for NULL pointer and invalid sequence lengths, and for a calibration already in progress */
+    if ((hadm_chan_idx_list == NULLPTR) || (cal_results == NULLPTR) || (num_freqs == 0U) ||
+        (user_handler == NULLPTR) || (user_handler->user_callback == NULLPTR) || pll_cal_ctx.busy)
+    {
+        status = gXcvrLclStatusInvalidArgs;
+    }
+    else
+    {
+        XCVR_LCL_PllCalSetup(hadm_chan_idx_list, cal_results, num_freqs, update_curve_fit, rate);
+        pll_cal_ctx.user_callback = user_handler->user_callback;
+        pll_cal_ctx.userData      = user_handler->userData;
+        pll_cal_ctx.busy          = true;
+        XCVR_LCL_PllCalWarmup();
+    }
+
+    return status;
+}
+
+xcvrLclStatus_t XCVR_LCL_CalibratePllProcess(void)
+{
+    xcvrLclStatus_t status = gXcvrLclStatusSuccess;
+
+    if (!pll_cal_ctx.busy)
+    {
+        status = gXcvrLclStatusFail;
+    }
+    else
+    {
+        /* An early event leaves the warmup running, the next event completes the step */
+        if (XCVR_LCL_PllCalWarmupDone())
+        {
+            XCVR_LCL_PllCalCapture();
+            if (pll_cal_ctx.next_freq < pll_cal_ctx.num_freqs)
             {
-                temp_count--;
+                XCVR_LCL_PllCalWarmup();
             }
-#endif
-            while (((XCVR_MISC->XCVR_STATUS & XCVR_MISC_XCVR_STATUS_TSM_COUNT_MASK) >>
-                    XCVR_MISC_XCVR_STATUS_TSM_COUNT_SHIFT) != 0U)
+            else
             {
+                XCVR_LCL_PllCalRestore();
+                pll_cal_ctx.busy = false;
+                pll_cal_ctx.user_callback(pll_cal_ctx.userData, pll_cal_ctx.status, pll_cal_ctx.next_freq);
             }
         }
-        XCVR_PLL_DIG->CHAN_MAP &=
-            ~(XCVR_PLL_DIG_CHAN_MAP_CHANNEL_NUM_OVRD_MASK | /* Clear the channel number override, it appears to cause
-                                                               problems later... */
-              XCVR_PLL_DIG_CHAN_MAP_HOP_TBL_CFG_OVRD_EN_MASK |
-              XCVR_PLL_DIG_CHAN_MAP_HOP_TBL_CFG_OVRD_MASK); /* Release the override for HOP_TBL_CFG */
-        XCVR_PLL_DIG->CHAN_MAP |= XCVR_PLL_DIG_CHAN_MAP_HOP_TBL_CFG_OVRD(hop_tbl_cfg_restore);
+    }
+
+    return status;
+}
+
+xcvrLclStatus_t XCVR_LCL_CalibratePllAbort(void)
+{
+    xcvrLclStatus_t status = gXcvrLclStatusSuccess;
 
-        /* Restore TSM timing or override values supporting HPM_CAL in RX operation */
+    if (!pll_cal_ctx.busy)
+    {
+        status = gXcvrLclStatusFail;
+    }
+    else
+    {
+        /* Stop the warmup in progress, its frequency has no calibration result */
 #if (HPM_CAL_IN_RX)
-        XCVR_TSM->OVRD3    = tsm_ovrd3_restore;
-        XCVR_TSM->TIMING29 = tsm_timing29_restore;
-        XCVR_TSM->TIMING39 = tsm_timing39_restore;
-        XCVR_TSM->TIMING40 = tsm_timing40_restore;
-        XCVR_TSM->TIMING12 = tsm_timing12_restore;
-        XCVR_TSM->TIMING33 = tsm_timing33_restore;
-        XCVR_TSM->TIMING41 = tsm_timing41_restore;
-        XCVR_TSM->TIMING47 = tsm_timing47_restore;
-        XCVR_TSM->TIMING48 = tsm_timing48_restore;
-        XCVR_TSM->TIMING49 = tsm_timing49_restore;
-        XCVR_TSM->TIMING50 = tsm_timing50_restore;
-        XCVR_TSM->TIMING32 = tsm_timing32_restore;
-        XCVR_TSM->TIMING51 = tsm_timing51_restore;
-        XCVR_TSM->TIMING21 = tsm_timing21_restore;
+        XCVR_ForceRxWd();
 #else
-        XCVR_TSM->OVRD0 &= ~(XCVR_TSM_OVRD0_TX_DIG_EN_OVRD_EN_MASK);
-        XCVR_TSM->TIMING12 = tsm_timing12_restore;
+        XCVR_ForceTxWd();
 #endif /* HPM_CAL_IN_RX */
-        if (rate == XCVR_RSM_RATE_2MBPS)
-        {
-            /* Remove alternate data rate selection */
-            RADIO_CTRL->RF_CTRL &=
-                ~(RADIO_CTRL_RF_CTRL_RIF_SEL_2MBPS_OVRD_EN_MASK | RADIO_CTRL_RF_CTRL_RIF_SEL_2MBPS_OVRD_MASK);
-        }
-
-        /* Restore the setting for whether HPM_CAL happens in PLL or not */
-        XCVR_PLL_DIG->HPM_CTRL    = temp_hpm_ctrl;
-        XCVR_PLL_DIG->HPMCAL_CTRL = temp_hpmcal_ctrl;
+        XCVR_WaitRxTxWd();
+        XCVR_LCL_PllCalRestore();
+        pll_cal_ctx.busy = false;
+        pll_cal_ctx.user_callback(pll_cal_ctx.userData, gXcvrLclStatusFail, pll_cal_ctx.next_freq);
     }
 
     return status;
@@ -2856,6 +3032,270 @@ xcvrLclStatus_t XCVR_LCL_InterpolatePllCal(const uint16_t *hadm_chan_idx_list,
     return status;
 }
 
+xcvrLclStatus_t XCVR_LCL_HpmCalBuildModel(const uint16_t *anchor_chan_list,
+                                         const xcvr_lcl_pll_cal_data_t *anchor_results,
+                                         uint8_t num_anchors,
+                                         xcvr_lcl_hpm_cal_model_t *model)
+{
+    xcvrLclStatus_t status = gXcvrLclStatusSuccess;
+    uint8_t i;
+    uint8_t j;
+    uint8_t chan;
+    uint32_t k_q15;
+    int64_t k_diff;
+    int64_t chan_diff;
+
+    if ((anchor_chan_list == NULLPTR) || (anchor_results == NULLPTR) || (model == NULLPTR) || (num_anchors == 0U) ||
+        (num_anchors > XCVR_LCL_HPM_CAL_MAX_ANCHORS))
+    {
+        status = gXcvrLclStatusInvalidArgs;
+    }
+    else
+    {
+        model->num_anchors = 0U;
+        /* Insert each anchor in channel order, scaled to 2442MHz with the Fref^3 / freq^3 law */
+        for (i = 0U; (i < num_anchors) && (status == gXcvrLclStatusSuccess); i++)
+        {
+            if (anchor_chan_list[i] > RSM_HADM_MAX_CHAN_INDEX)
+            {
+                status = gXcvrLclStatusInvalidArgs;
+            }
+            else
+            {
+                chan  = (uint8_t)anchor_chan_list[i];
+                k_q15 = (uint32_t)((((uint64_t)anchor_results[i].hpm_cal_val << 30U) +
+                                    ((uint64_t)hpm_cal_cube_q15[chan] >> 1U)) /
+                                   (uint64_t)hpm_cal_cube_q15[chan]);
+                for (j = model->num_anchors; (j > 0U) && (model->anchor_chan[j - 1U] > chan); j--)
+                {
+                    model->anchor_chan[j] = model->anchor_chan[j - 1U];
+                    model->k_q15[j]       = model->k_q15[j - 1U];
+                }
+                if ((j > 0U) && (model->anchor_chan[j - 1U] == chan))
+                {
+                    status = gXcvrLclStatusInvalidArgs; /* The same channel twice */
+                }
+                model->anchor_chan[j] = chan;
+                model->k_q15[j]       = k_q15;
+                model->num_anchors++;
+            }
+        }
+
+        if (status == gXcvrLclStatusSuccess)
+        {
+            /* Slope of each segment, the last anchor has none */
+            for (i = 0U; (i + 1U) < model->num_anchors; i++)
+            {
+                k_diff    = (int64_t)model->k_q15[i + 1U] - (int64_t)model->k_q15[i];
+                chan_diff = (int64_t)model->anchor_chan[i + 1U] - (int64_t)model->anchor_chan[i];
+                model->slope_q15[i] =
+                    (int32_t)((k_diff + ((k_diff < 0) ? -(chan_diff / 2) : (chan_diff / 2))) / chan_diff);
+            }
+            model->slope_q15[model->num_anchors - 1U] = 0;
+        }
+        else
+        {
+            model->num_anchors = 0U;
+        }
+    }
+
+    return status;
+}
+
+xcvrLclStatus_t XCVR_LCL_InterpolatePllCalModel(const uint16_t *hadm_chan_idx_list,
+                                                xcvr_lcl_pll_cal_data_t *cal_results,
+                                                uint16_t num_freqs,
+                                                const xcvr_lcl_hpm_cal_model_t *model)
+{
+    xcvrLclStatus_t status = gXcvrLclStatusSuccess;
+    uint16_t i;
+    uint16_t chan;
+    uint8_t seg;
+    uint8_t last;
+    int64_t k_q15;
+
+    if ((hadm_chan_idx_list == NULLPTR) || (cal_results == NULLPTR) || (model == NULLPTR) || (num_freqs == 0U) ||
+        (model->num_anchors == 0U) || (model->num_anchors > XCVR_LCL_HPM_CAL_MAX_ANCHORS))
+    {
+        status = gXcvrLclStatusInvalidArgs;
+    }
+    else
+    {
+        last = model->num_anchors - 1U;
+        for (i = 0U; (i < num_freqs) && (status == gXcvrLclStatusSuccess); i++)
+        {
+            chan = hadm_chan_idx_list[i];
+            if (chan > RSM_HADM_MAX_CHAN_INDEX)
+            {
+                status = gXcvrLclStatusInvalidArgs;
+            }
+            else
+            {
+                /* Outside of the anchors the nearest anchor is scaled as a single 2442MHz anchor would be */
+                if (chan <= model->anchor_chan[0])
+                {
+                    k_q15 = (int64_t)model->k_q15[0];
+                }
+                else if (chan >= model->anchor_chan[last])
+                {
+                    k_q15 = (int64_t)model->k_q15[last];
+                }
+                else
+                {
+                    for (seg = 0U; chan > model->anchor_chan[seg + 1U]; seg++)
+                    {
+                    }
+                    k_q15 = (int64_t)model->k_q15[seg] +
+                            ((int64_t)model->slope_q15[seg] * (int64_t)(chan - (uint16_t)model->anchor_chan[seg]));
+                }
+                k_q15 = (k_q15 < 0) ? 0 : k_q15;
+                cal_results[i].hpm_cal_val =
+                    (uint16_t)((((uint64_t)k_q15 * hpm_cal_cube_q15[chan]) + (1ULL << 29U)) >> 30U);
+            }
+        }
+    }
+
+    return status;
+}
+
+xcvrLclStatus_t XCVR_LCL_PllCalCacheInit(xcvr_lcl_pll_cal_cache_t *cache,
+                                         uint8_t max_temp_drift_degc,
+                                         uint16_t max_vdd_drift_mv)
+{
+    xcvrLclStatus_t status = gXcvrLclStatusSuccess;
+    uint16_t i;
+
+    if (cache == NULLPTR)
+    {
+        status = gXcvrLclStatusInvalidArgs;
+    }
+    else
+    {
+        for (i = 0U; i < XCVR_LCL_PLL_CAL_CACHE_WORDS; i++)
+        {
+            cache->valid[i] = 0U;
+        }
+        cache->max_temp_drift_degc = max_temp_drift_degc;
+        cache->max_vdd_drift_mv    = max_vdd_drift_mv;
+    }
+
+    return status;
+}
+
+xcvrLclStatus_t XCVR_LCL_PllCalCacheStore(xcvr_lcl_pll_cal_cache_t *cache,
+                                          const uint16_t *hadm_chan_idx_list,
+                                          const xcvr_lcl_pll_cal_data_t *cal_results,
+                                          uint16_t num_freqs,
+                                          const xcvr_lcl_pll_cal_cond_t *cond)
+{
+    xcvrLclStatus_t status = gXcvrLclStatusSuccess;
+    uint16_t chan;
+    uint16_t i;
+
+    if ((cache == NULLPTR) || (hadm_chan_idx_list == NULLPTR) || (cal_results == NULLPTR) || (cond == NULLPTR))
+    {
+        status = gXcvrLclStatusInvalidArgs;
+    }
+    else
+    {
+        /* Check the whole list first so that a bad channel leaves the cache unchanged */
+        for (i = 0U; i < num_freqs; i++)
+        {
+            if (hadm_chan_idx_list[i] > RSM_HADM_MAX_CHAN_INDEX)
+            {
+                status = gXcvrLclStatusInvalidArgs;
+            }
+        }
+        for (i = 0U; (i < num_freqs) && (status == gXcvrLclStatusSuccess); i++)
+        {
+            chan              = hadm_chan_idx_list[i];
+            cache->cal[chan]  = cal_results[i];
+            cache->cond[chan] = *cond;
+            cache->valid[chan >> 5U] |= (1UL << (chan & 0x1FU));
+        }
+    }
+
+    return status;
+}
+
+xcvrLclStatus_t XCVR_LCL_PllCalCacheLookup(const xcvr_lcl_pll_cal_cache_t *cache,
+                                           uint8_t hadm_chan_idx,
+                                           xcvr_lcl_pll_cal_data_t *cal_result)
+{
+    xcvrLclStatus_t status = gXcvrLclStatusSuccess;
+
+    if ((cache == NULLPTR) || (cal_result == NULLPTR) || (hadm_chan_idx > RSM_HADM_MAX_CHAN_INDEX))
+    {
+        status = gXcvrLclStatusInvalidArgs;
+    }
+    else if ((cache->valid[hadm_chan_idx >> 5U] & (1UL << (hadm_chan_idx & 0x1FU))) == 0U)
+    {
+        status = gXcvrLclStatusFail;
+    }
+    else
+    {
+        *cal_result = cache->cal[hadm_chan_idx];
+    }
+
+    return status;
+}
+
+uint16_t XCVR_LCL_PllCalCacheInvalidate(xcvr_lcl_pll_cal_cache_t *cache, const xcvr_lcl_pll_cal_cond_t *cond)
+{
+    uint16_t count = 0U;
+    uint16_t chan;
+    int32_t temp_drift;
+    int32_t vdd_drift;
+
+    if ((cache != NULLPTR) && (cond != NULLPTR))
+    {
+        for (chan = 0U; chan < XCVR_LCL_PLL_CAL_CACHE_SIZE; chan++)
+        {
+            if ((cache->valid[chan >> 5U] & (1UL << (chan & 0x1FU))) != 0U)
+            {
+                temp_drift = (int32_t)cond->temp_degc - (int32_t)cache->cond[chan].temp_degc;
+                vdd_drift  = (int32_t)cond->vdd_mv - (int32_t)cache->cond[chan].vdd_mv;
+                temp_drift = (temp_drift < 0) ? -temp_drift : temp_drift;
+                vdd_drift  = (vdd_drift < 0) ? -vdd_drift : vdd_drift;
+                if ((temp_drift > (int32_t)cache->max_temp_drift_degc) ||
+                    (vdd_drift > (int32_t)cache->max_vdd_drift_mv))
+                {
+                    cache->valid[chan >> 5U] &= ~(1UL << (chan & 0x1FU));
+                    count++;
+                }
+            }
+        }
+    }
+
+    return count;
+}
+
+uint16_t XCVR_LCL_PllCalCacheGetStale(const xcvr_lcl_pll_cal_cache_t *cache,
+                                      const uint16_t *hadm_chan_idx_list,
+                                      uint16_t num_freqs,
+                                      uint16_t *stale_list)
+{
+    uint16_t count = 0U;
+    uint16_t chan;
+    uint16_t i;
+
+    if ((cache != NULLPTR) && (hadm_chan_idx_list != NULLPTR) && (stale_list != NULLPTR))
+    {
+        for (i = 0U; i < num_freqs; i++)
+        {
+            chan = hadm_chan_idx_list[i];
+            /* An out of range channel has no entry: reported stale, then rejected by XCVR_LCL_PllCalCacheStore() */
+            if ((chan > RSM_HADM_MAX_CHAN_INDEX) || ((cache->valid[chan >> 5U] & (1UL << (chan & 0x1FU))) == 0U))
+            {
+                stale_list[count] = chan;
+                count++;
+            }
+        }
+    }
+
+    return count;
+}
+
 /* Storage for TSM and RF_CTRL registers to support splitting DCOC manual calibrate into two parts (optimizing CPU
  * instead of polling) */
 static uint32_t timing09_backup;
@@ -3297,7 +3737,7 @@ xcvrLclStatus_t XCVR_LCL_GetRsmStateTimings(XCVR_RSM_RXTX_MODE_T role, xcvr_lcl_
 
     /* Get WarmUp and WarmDown timings */
     /* Read TSM WU WD configuration [CONNRF-1076] */
-    uint32_t tsm_end_of_seq = XCVR_TSM->END_OF_SEQ;
+    uint32_t tsm_end_of_seq = XCVR_SHADOW_RD(TSM_END_OF_SEQ);
     uint8_t end_of_rx_wd =
         (uint8_t)((tsm_end_of_seq & XCVR_TSM_END_OF_SEQ_END_OF_RX_WD_MASK) >> XCVR_TSM_END_OF_SEQ_END_OF_RX_WD_SHIFT);
     uint8_t end_of_rx_wu =
@@ -3361,7 +3801,7 @@ xcvrLclStatus_t XCVR_LCL_GetRsmDmaConfig(xcvr_lcl_rsmdma_config_t *rsm_dma_confi
 {
     xcvrLclStatus_t status = gXcvrLclStatusSuccess;
 
-    uint32_t rx_dig_ctrl1 = XCVR_RX_DIG->CTRL1;
+    uint32_t rx_dig_ctrl1 = XCVR_SHADOW_RD(RX_DIG_CTRL1);
     uint32_t rsm_ctrl3    = XCVR_MISC->RSM_CTRL3;
 
     uint8_t rate =
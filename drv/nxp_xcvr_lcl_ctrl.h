@@ -446,6 +446,19 @@ typedef struct
                               other algorithms */
 } xcvr_lcl_hpm_cal_interp_t;
 
+#define XCVR_LCL_HPM_CAL_MAX_ANCHORS (8U) /*!< Maximum number of calibrated channels of a HPM CAL model */
+
+/*! @brief RSM HPM CAL piecewise model, built from several calibrated channels. */
+typedef struct
+{
+    uint32_t k_q15[XCVR_LCL_HPM_CAL_MAX_ANCHORS]; /*!< HPM_CAL_FACTOR of each anchor scaled to 2442MHz by
+                                                     freq^3 / Fref^3, in Q15 format */
+    int32_t slope_q15[XCVR_LCL_HPM_CAL_MAX_ANCHORS]; /*!< Change of k_q15 per channel up to the next anchor, in Q15
+                                                        format */
+    uint8_t anchor_chan[XCVR_LCL_HPM_CAL_MAX_ANCHORS]; /*!< HADM channel index of each anchor, in ascending order */
+    uint8_t num_anchors;                               /*!< Number of anchors of the model */
+} xcvr_lcl_hpm_cal_model_t;
+
 /* Bitfield access macros for the uint8_t elements in the xcvr_lcl_fstep_t structure */
 /*! @brief  RSM Step Format enumeration type. */
 typedef enum
@@ -565,6 +578,48 @@ typedef struct
 #endif                     /* (defined(CTUNE_MANUAL_CAL) && (CTUNE_MANUAL_CAL == 1)) */
 } xcvr_lcl_pll_cal_data_t;
 
+/*! @brief Define callback function pointer type for the end of an event driven PLL calibration.
+ *
+ * This callback function is called by XCVR_LCL_CalibratePllProcess() once the last frequency is calibrated, or by
+ * XCVR_LCL_CalibratePllAbort().
+ *
+ * @param userData Data available from callback.
+ * @param status gXcvrLclStatusSuccess if all frequencies were calibrated, gXcvrLclStatusFail if the calibration was
+ * aborted.
+ * @param num_done the number of frequencies, from the start of the list, with calibration results.
+ */
+typedef void (*pll_cal_callback)(void *userData, xcvrLclStatus_t status, uint16_t num_done);
+
+/*! @brief PLL calibration handler structure*/
+typedef struct
+{
+    pll_cal_callback user_callback; /*!< Callback function */
+    void *userData;                 /*!< User data available from callback */
+} pll_cal_handler_t;
+
+#define XCVR_LCL_PLL_CAL_CACHE_SIZE \
+    (RSM_HADM_MAX_CHAN_INDEX + 1U) /*!< One PLL calibration cache entry per HADM channel */
+#define XCVR_LCL_PLL_CAL_CACHE_WORDS \
+    ((XCVR_LCL_PLL_CAL_CACHE_SIZE + 31U) / 32U) /*!< Words of the PLL calibration cache valid bitmap */
+
+/*! @brief Operating conditions of a PLL calibration, as measured by the caller. */
+typedef struct
+{
+    int8_t temp_degc; /*!< Die temperature in deg C */
+    uint16_t vdd_mv;  /*!< Radio supply voltage in mV */
+} xcvr_lcl_pll_cal_cond_t;
+
+/*! @brief PLL calibration cache, holding the calibration values of each HADM channel with the conditions they were
+ * taken under. */
+typedef struct
+{
+    xcvr_lcl_pll_cal_data_t cal[XCVR_LCL_PLL_CAL_CACHE_SIZE]; /*!< Calibration values, indexed by HADM channel */
+    xcvr_lcl_pll_cal_cond_t cond[XCVR_LCL_PLL_CAL_CACHE_SIZE]; /*!< Conditions of the calibration values */
+    uint32_t valid[XCVR_LCL_PLL_CAL_CACHE_WORDS]; /*!< One bit per HADM channel, set when its entry is valid */
+    uint16_t max_vdd_drift_mv;   /*!< Supply drift from the calibration conditions that invalidates an entry */
+    uint8_t max_temp_drift_degc; /*!< Temperature drift from the calibration conditions that invalidates an entry */
+} xcvr_lcl_pll_cal_cache_t;
+
 /*! @brief Channel number type to specify frequency (according to the setting of the PLL's CHAN_MAP[HOP_TBL_CFG_OVRD]
  * bitfield). */
 typedef uint16_t channel_num_t;
@@ -1227,6 +1282,58 @@ xcvrLclStatus_t XCVR_LCL_CalibratePll(const channel_num_t *hadm_chan_idx_list,
                                       bool update_curve_fit,
                                       XCVR_RSM_SQTE_RATE_T rate);
 
+/*!
+ * @brief Function to start an event driven PLL calibration to capture CTUNE and HPM data for later use.
+ *
+ * This function performs the same calibration as ::XCVR_LCL_CalibratePll() without blocking the CPU during the
+ * warmups. It configures the PLL, tunes to the first frequency and forces a warmup, then returns. Each following step
+ * is run by ::XCVR_LCL_CalibratePllProcess() and the end of the calibration is reported through the callback.
+ *
+ * @param hadm_chan_idx_list the pointer to an array of frequencies to tune to and capture calibration values, in the
+ * format of ::XCVR_LCL_CalibratePll(). The array must remain valid until the callback is called.
+ * @param cal_results the pointer to an array of structures to store the calibration results in raw format. The array
+ * must remain valid until the callback is called.
+ * @param num_freqs the number of frequencies at which calibration should be performed.
+ * @param update_curve_fit selects for updating the curve fit data storage when the calibration frequency is 2442MHz.
+ * @param rate the data rate to be used in RSM operation.
+ * @param user_handler the callback to be called at the end of the calibration, and its user data.
+ *
+ * @return The status of the PLL calibration start, gXcvrLclStatusInvalidArgs if a calibration is already in progress.
+ *
+ * @note The link layer must not use the radio until the callback is called.
+ */
+xcvrLclStatus_t XCVR_LCL_CalibratePllStart(const channel_num_t *hadm_chan_idx_list,
+                                           xcvr_lcl_pll_cal_data_t *cal_results,
+                                           uint16_t num_freqs,
+                                           bool update_curve_fit,
+                                           XCVR_RSM_SQTE_RATE_T rate,
+                                           const pll_cal_handler_t *user_handler);
+
+/*!
+ * @brief Function to run the next step of an event driven PLL calibration.
+ *
+ * This function is intended to be called on the TSM end of warmup event, for instance from the link layer handler of
+ * a TSM interrupt timed at the end of TX warmup, or polled from the link layer scheduler. When the warmup of the
+ * current frequency is complete, it captures the calibration values, warms down and starts the warmup of the next
+ * frequency, or restores the PLL and TSM settings and calls the callback after the last frequency. Before the end of
+ * the warmup it returns without any change, so an early or spurious event is harmless.
+ *
+ * @return gXcvrLclStatusFail if no calibration is in progress, gXcvrLclStatusSuccess otherwise.
+ *
+ * @note The warmdown between two frequencies takes a few usec and is waited for in this function.
+ */
+xcvrLclStatus_t XCVR_LCL_CalibratePllProcess(void);
+
+/*!
+ * @brief Function to abort an event driven PLL calibration.
+ *
+ * This function warms down the radio, restores the PLL and TSM settings and calls the callback with the number of
+ * frequencies already calibrated.
+ *
+ * @return gXcvrLclStatusFail if no calibration is in progress, gXcvrLclStatusSuccess otherwise.
+ */
+xcvrLclStatus_t XCVR_LCL_CalibratePllAbort(void);
+
 /*!
  * @brief Function to calculate interpolated values for HPM CAL based on previously calculated equations for
  * approximations.
@@ -1255,6 +1362,139 @@ xcvrLclStatus_t XCVR_LCL_InterpolatePllCal(const uint16_t *hadm_chan_idx_list,
                                            const uint16_t num_freqs,
                                            const xcvr_lcl_hpm_cal_interp_t *hpm_cal_interp);
 
+/*!
+ * @brief Function to build a piecewise HPM CAL model from several calibrated channels.
+ *
+ * This function builds a per device model of HPM CAL values across the band from the values measured at a few anchor
+ * channels, for instance with ::XCVR_LCL_CalibratePll() at the band edges and center. Each anchor value is scaled to
+ * 2442MHz with the Fref^3 / freq^3 law of ::XCVR_LCL_InterpolatePllCal(), and the scaled values are interpolated
+ * linearly between anchors, so that the model corrects the deviation of the device from that law. With a single anchor
+ * the model matches the single 2442MHz anchor interpolation, with Q15 instead of Q7 precision.
+ *
+ * @param anchor_chan_list the pointer to an array of HADM channel index values of the anchors, in any order.
+ * @param anchor_results the pointer to an array of calibration results matching the anchor channel array.
+ * @param num_anchors the number of anchors, from 1 to ::XCVR_LCL_HPM_CAL_MAX_ANCHORS.
+ * @param model the pointer to the model to build.
+ *
+ * @return The status of the model build, gXcvrLclStatusInvalidArgs if a channel is out of range or appears twice.
+ *
+ */
+xcvrLclStatus_t XCVR_LCL_HpmCalBuildModel(const uint16_t *anchor_chan_list,
+                                         const xcvr_lcl_pll_cal_data_t *anchor_results,
+                                         uint8_t num_anchors,
+                                         xcvr_lcl_hpm_cal_model_t *model);
+
+/*!
+ * @brief Function to calculate HPM CAL values from a piecewise HPM CAL model.
+ *
+ * This function calculates HPM CAL values at a list of channels from a model built by ::XCVR_LCL_HpmCalBuildModel().
+ * Channels outside of the anchors use the nearest anchor. Each channel costs a search among the anchors and one
+ * multiplication, with no division.
+ *
+ * @param hadm_chan_idx_list the pointer to an array of HADM channel index values that correspond to the cal_results
+ * array. Values may be in any order.
+ * @param cal_results the pointer to an array of structures to store the interpolation results in raw format matching
+ * the frequency array.
+ * @param num_freqs the number of frequencies at which interpolation should be performed.
+ * @param model the HPM CAL model to interpolate from.
+ *
+ * @return The status of the interpolation process.
+ *
+ */
+xcvrLclStatus_t XCVR_LCL_InterpolatePllCalModel(const uint16_t *hadm_chan_idx_list,
+                                                xcvr_lcl_pll_cal_data_t *cal_results,
+                                                uint16_t num_freqs,
+                                                const xcvr_lcl_hpm_cal_model_t *model);
+
+/*!
+ * @brief Function to initialize a PLL calibration cache.
+ *
+ * This function empties the cache and sets the drift thresholds applied by ::XCVR_LCL_PllCalCacheInvalidate().
+ *
+ * @param cache the pointer to the cache to initialize.
+ * @param max_temp_drift_degc the temperature change, in deg C, beyond which a calibration value is stale.
+ * @param max_vdd_drift_mv the supply voltage change, in mV, beyond which a calibration value is stale.
+ *
+ * @return The status of the initialization.
+ *
+ */
+xcvrLclStatus_t XCVR_LCL_PllCalCacheInit(xcvr_lcl_pll_cal_cache_t *cache,
+                                         uint8_t max_temp_drift_degc,
+                                         uint16_t max_vdd_drift_mv);
+
+/*!
+ * @brief Function to store PLL calibration values in a PLL calibration cache.
+ *
+ * This function stores calibration values produced by ::XCVR_LCL_CalibratePll(), ::XCVR_LCL_CalibratePllStart() or
+ * ::XCVR_LCL_InterpolatePllCal() in the cache, marking them valid under the given conditions.
+ *
+ * @param cache the pointer to the cache.
+ * @param hadm_chan_idx_list the pointer to an array of HADM channel index values that correspond to the cal_results
+ * array.
+ * @param cal_results the pointer to an array of calibration results matching the channel array.
+ * @param num_freqs the number of channels to store.
+ * @param cond the conditions the calibration values were taken under.
+ *
+ * @return The status of the store, gXcvrLclStatusInvalidArgs if a channel index is out of range, in which case no
+ * entry is stored.
+ *
+ */
+xcvrLclStatus_t XCVR_LCL_PllCalCacheStore(xcvr_lcl_pll_cal_cache_t *cache,
+                                          const uint16_t *hadm_chan_idx_list,
+                                          const xcvr_lcl_pll_cal_data_t *cal_results,
+                                          uint16_t num_freqs,
+                                          const xcvr_lcl_pll_cal_cond_t *cond);
+
+/*!
+ * @brief Function to look up the PLL calibration values of one channel in a PLL calibration cache.
+ *
+ * This function reads the cache entry of a HADM channel in constant time.
+ *
+ * @param cache the pointer to the cache.
+ * @param hadm_chan_idx the HADM channel index, ranging from 0 to 78.
+ * @param cal_result the pointer to the location where the calibration values should be stored.
+ *
+ * @return gXcvrLclStatusSuccess if the entry is valid, gXcvrLclStatusFail if the channel must be calibrated first.
+ *
+ */
+xcvrLclStatus_t XCVR_LCL_PllCalCacheLookup(const xcvr_lcl_pll_cal_cache_t *cache,
+                                           uint8_t hadm_chan_idx,
+                                           xcvr_lcl_pll_cal_data_t *cal_result);
+
+/*!
+ * @brief Function to invalidate the entries of a PLL calibration cache taken under different conditions.
+ *
+ * This function invalidates each valid entry whose temperature or supply voltage differs from the current conditions
+ * by more than the thresholds of the cache. The other entries remain valid.
+ *
+ * @param cache the pointer to the cache.
+ * @param cond the current conditions.
+ *
+ * @return The number of entries invalidated.
+ *
+ */
+uint16_t XCVR_LCL_PllCalCacheInvalidate(xcvr_lcl_pll_cal_cache_t *cache, const xcvr_lcl_pll_cal_cond_t *cond);
+
+/*!
+ * @brief Function to list the channels missing from a PLL calibration cache.
+ *
+ * This function selects the channels of a list that have no valid cache entry, so that only these are calibrated
+ * again before being stored with ::XCVR_LCL_PllCalCacheStore().
+ *
+ * @param cache the pointer to the cache.
+ * @param hadm_chan_idx_list the pointer to an array of HADM channel index values needed by the procedure.
+ * @param num_freqs the number of channels in the list.
+ * @param stale_list the pointer to an array of at least num_freqs entries receiving the channels to calibrate, in the
+ * order of the list.
+ *
+ * @return The number of channels stored in stale_list, 0 when all channels are valid or on invalid arguments.
+ *
+ */
+uint16_t XCVR_LCL_PllCalCacheGetStale(const xcvr_lcl_pll_cal_cache_t *cache,
+                                      const uint16_t *hadm_chan_idx_list,
+                                      uint16_t num_freqs,
+                                      uint16_t *stale_list);
+
 /*!
  * @brief Function to trigger the start of a manual DCOC calibration prior to RSM operations.
  *
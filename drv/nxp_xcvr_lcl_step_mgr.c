@@ -10,11 +10,41 @@
 /*******************************************************************************
  * Definitions
  ******************************************************************************/
+#define XCVR_LCL_NUM_STEP_MODES (4U) /* Step formats 0..3 */
+#define XCVR_LCL_NUM_RTT_TYPES  (7U) /* RTT types 0..6 */
+#define XCVR_LCL_MAX_NUM_AP     (4U) /* Largest number of antenna paths */
+#define XCVR_LCL_RES_HDR_WORDS      (1U) /* Words of COM_RES_HDR_Type */
+#define XCVR_LCL_RES_RTT_BODY_WORDS (4U) /* Words of COM_MODE_013_RES_BODY_Type */
+#define XCVR_LCL_RES_MAX_IQ_WORDS   (5U) /* Words of IQ_RES_BODY_Type, one PCT_RESULT per antenna path plus one */
+
+/* Config size of a step for each RTT type: a header of hdr_sz words, plus the RTT payload when payload_mult is 1U */
+#define XCVR_LCL_CFG_SZ_ROW(hdr_sz, payload_mult) \
+    {(hdr_sz), (hdr_sz)+(2U*(payload_mult)), (hdr_sz)+(6U*(payload_mult)), (hdr_sz)+(2U*(payload_mult)), \
+     (hdr_sz)+(4U*(payload_mult)), (hdr_sz)+(6U*(payload_mult)), (hdr_sz)+(8U*(payload_mult))}
+/* Result size of a step for each number of antenna paths: res_sz words, plus one word per antenna path when ap_mult is 1U */
+#define XCVR_LCL_RES_SZ_ROW(res_sz, ap_mult) \
+    {(res_sz), (res_sz)+(1U*(ap_mult)), (res_sz)+(2U*(ap_mult)), (res_sz)+(3U*(ap_mult)), (res_sz)+(4U*(ap_mult))}
 
 /*******************************************************************************
  * Variables
  ******************************************************************************/
-const uint8_t rtt_payload_sizes[7] = {0U,2U,6U,2U,4U,6U,8U};
+const uint8_t rtt_payload_sizes[7] = XCVR_LCL_CFG_SZ_ROW(0U, 1U);
+/* Config sizes in words, indexed by step format then RTT type. Mode 0 and Mode 2 steps carry no RTT payload */
+static const uint8_t cfg_size_words_table[XCVR_LCL_NUM_STEP_MODES][XCVR_LCL_NUM_RTT_TYPES] =
+{
+    XCVR_LCL_CFG_SZ_ROW(5U, 0U), /* XCVR_RSM_STEP_FCS */
+    XCVR_LCL_CFG_SZ_ROW(5U, 1U), /* XCVR_RSM_STEP_PK_PK */
+    XCVR_LCL_CFG_SZ_ROW(3U, 0U), /* XCVR_RSM_STEP_TN_TN */
+    XCVR_LCL_CFG_SZ_ROW(5U, 1U), /* XCVR_RSM_STEP_PK_TN_TN_PK */
+};
+/* Result sizes in words (one result, not doubled for sniffer mode), indexed by step format then number of antenna paths */
+static const uint8_t res_size_words_table[XCVR_LCL_NUM_STEP_MODES][XCVR_LCL_MAX_NUM_AP+1U] =
+{
+    XCVR_LCL_RES_SZ_ROW(5U, 0U), /* XCVR_RSM_STEP_FCS */
+    XCVR_LCL_RES_SZ_ROW(5U, 0U), /* XCVR_RSM_STEP_PK_PK */
+    XCVR_LCL_RES_SZ_ROW(2U, 1U), /* XCVR_RSM_STEP_TN_TN: 1 word + num_ap + 1 word */
+    XCVR_LCL_RES_SZ_ROW(6U, 1U), /* XCVR_RSM_STEP_PK_TN_TN_PK: 5 words + num_ap + 1 word */
+};
 cs_subevent_info_t subevent_info;
 
 /* Circular buffer related static data - supports setup of buffer state and IRQ operation */
@@ -31,6 +61,7 @@ static uint32_t * result_pkt_ram_buffer;     /*!< Pointer to the result buffer i
 static uint16_t config_rollover_index;
 static uint16_t result_rollover_index;
 static bool in_sniffer_mode;                        /*!< track whether in sniffer mode to support proper results handling */
+static cs_result_index_t * attached_result_index = NULLPTR; /*!< Result index filled in as results are read, NULLPTR when none is attached */
 
 /* Visibility for debugging circular buffer operations */
 #define DEBUG_CIRCULAR_BUFF  (0)
@@ -52,7 +83,81 @@ static uint8_t results_remaining_end_val[MAX_IRQ_COUNT];
 /*******************************************************************************
  * Prototypes
  ******************************************************************************/
+static void XCVR_LCL_CopyToPktRam(volatile uint32_t * dst, const uint32_t * src, uint16_t num_words);
+static void XCVR_LCL_CopyFromPktRam(uint32_t * dst, volatile const uint32_t * src, uint16_t num_words);
+static xcvrLclStatus_t XCVR_LCL_SizeStepModes(XCVR_RSM_RTT_TYPE_T rtt_type, uint8_t num_ap, uint8_t * cfg_sz, uint8_t * res_sz);
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+/* Copy a contiguous run of words from system RAM to PKT RAM, four words per iteration. The PKT RAM side is volatile so that
+ * only 32 bit accesses are made: the compiler may not merge them into vector or memcpy() accesses. */
+static void XCVR_LCL_CopyToPktRam(volatile uint32_t * dst, const uint32_t * src, uint16_t num_words)
+{
+    volatile uint32_t * temp_dst = dst;
+    const uint32_t * temp_src = src;
+    uint16_t remaining = num_words;
 
+    while (remaining >= 4U)
+    {
+        temp_dst[0] = temp_src[0];
+        temp_dst[1] = temp_src[1];
+        temp_dst[2] = temp_src[2];
+        temp_dst[3] = temp_src[3];
+        temp_dst = &temp_dst[4];
+        temp_src = &temp_src[4];
+        remaining -= 4U;
+    }
+    while (remaining > 0U)
+    {
+        *temp_dst = *temp_src;
+        temp_dst++;
+        temp_src++;
+        remaining--;
+    }
+}
+
+/* Copy a contiguous run of words from PKT RAM to system RAM, with the same 32 bit only PKT RAM accesses */
+static void XCVR_LCL_CopyFromPktRam(uint32_t * dst, volatile const uint32_t * src, uint16_t num_words)
+{
+    uint32_t * temp_dst = dst;
+    volatile const uint32_t * temp_src = src;
+    uint16_t remaining = num_words;
+
+    while (remaining >= 4U)
+    {
+        temp_dst[0] = temp_src[0];
+        temp_dst[1] = temp_src[1];
+        temp_dst[2] = temp_src[2];
+        temp_dst[3] = temp_src[3];
+        temp_dst = &temp_dst[4];
+        temp_src = &temp_src[4];
+        remaining -= 4U;
+    }
+    while (remaining > 0U)
+    {
+        *temp_dst = *temp_src;
+        temp_dst++;
+        temp_src++;
+        remaining--;
+    }
+}
+
+/* Size every step format for a RTT type and number of antenna paths, so that sizing each step is an array lookup. */
+static xcvrLclStatus_t XCVR_LCL_SizeStepModes(XCVR_RSM_RTT_TYPE_T rtt_type, uint8_t num_ap, uint8_t * cfg_sz, uint8_t * res_sz)
+{
+    xcvrLclStatus_t status = gXcvrLclStatusSuccess;
+
+    for (uint8_t i = 0U; i < XCVR_LCL_NUM_STEP_MODES; i++)
+    {
+        if (XCVR_LCL_CalcConfigResult_Size((XCVR_RSM_FSTEP_TYPE_T)i, rtt_type, num_ap, &cfg_sz[i], &res_sz[i]) != gXcvrLclStatusSuccess)
+        {
+            status = gXcvrLclStatusInvalidArgs;
+        }
+    }
+
+    return status;
+}
 
 /*******************************************************************************
  * APIs
@@ -265,49 +370,18 @@ xcvrLclStatus_t XCVR_LCL_CalcConfigResult_Size(XCVR_RSM_FSTEP_TYPE_T step_format
     {
         status = gXcvrLclStatusInvalidArgs;
     }
-    /* Support disabling error checking for code which has been tested */
-#if defined(CHECK_FSTEP_ERRORS)
-    if (num_ap > 4U)
-    {
-        status = gXcvrLclStatusInvalidArgs;
-    }
-    if (step_format >= XCVR_RSM_STEP_ERROR) /* invalid step format */
-    {
-        status = gXcvrLclStatusInvalidArgs;
-    }
-    if (rtt_type >= XCVR_RSM_RTT_ERROR) /* invalid RTT type */
+    /* The range checks are always made since the inputs index the size tables */
+    else if (((uint8_t)step_format >= XCVR_LCL_NUM_STEP_MODES) || ((uint8_t)rtt_type >= XCVR_LCL_NUM_RTT_TYPES) || (num_ap > XCVR_LCL_MAX_NUM_AP))
     {
+        *config_size_words = 0U;
+        *result_size_words = 0U;
         status = gXcvrLclStatusInvalidArgs;
     }
-#endif /* defined(CHECK_FSTEP_ERRORS) */
-    if (status == gXcvrLclStatusSuccess)
+    else
     {
-        /* Calculate configuration and result sizes for combination of step type and RTT selection */
-        switch (step_format)
-        {
-            case XCVR_RSM_STEP_FCS:
-                *config_size_words = 5U;
-                *result_size_words = 5U;
-                break;
-            case XCVR_RSM_STEP_PK_PK:
-                *config_size_words = 5U+rtt_payload_sizes[rtt_type];
-                *result_size_words = 5U;
-                break;
-            case XCVR_RSM_STEP_TN_TN:
-                *config_size_words = 3U;
-                *result_size_words = 1U+num_ap+1U;
-                break;
-            case XCVR_RSM_STEP_PK_TN_TN_PK:
-                *config_size_words = 5U+rtt_payload_sizes[rtt_type];
-                *result_size_words = 5U+num_ap+1U;
-                break;
-            default:
-                *config_size_words = 0U;
-                *result_size_words = 0U;
-                status = gXcvrLclStatusInvalidArgs;
-                break;
-        }
-
+        /* Look up configuration and result sizes for combination of step type, RTT selection and antenna paths */
+        *config_size_words = cfg_size_words_table[(uint8_t)step_format][(uint8_t)rtt_type];
+        *result_size_words = res_size_words_table[(uint8_t)step_format][num_ap];
     }
     return status;
 }
@@ -347,15 +421,15 @@ xcvrLclStatus_t XCVR_LCL_ValidateSubeventInfo(cs_subevent_info_t * subevent_info
             uint16_t total_cfg_sz = 0U;
             uint16_t total_res_sz = 0U;
             uint8_t res_mult_factor = (subevent_info_ptr->is_sniffer_mode ? 2U : 1U); /* Multiplication factor for results size when in sniffer mode */
+            uint8_t cfg_sz_by_mode[XCVR_LCL_NUM_STEP_MODES];
+            uint8_t res_sz_by_mode[XCVR_LCL_NUM_STEP_MODES];
+            xcvrLclStatus_t size_status = XCVR_LCL_SizeStepModes(subevent_info_ptr->rtt_type, subevent_info_ptr->num_ap, cfg_sz_by_mode, res_sz_by_mode);
             for (i=0;i<(subevent_info_ptr->num_steps);i++)
             {
-                uint8_t cfg_sz;
-                uint8_t res_sz;
-                xcvrLclStatus_t temp_status = XCVR_LCL_CalcConfigResult_Size(*step_type_ptr, subevent_info_ptr->rtt_type, subevent_info_ptr->num_ap, &cfg_sz, &res_sz) ;
-                if (temp_status == gXcvrLclStatusSuccess)
+                if ((size_status == gXcvrLclStatusSuccess) && ((uint8_t)(*step_type_ptr) < XCVR_LCL_NUM_STEP_MODES))
                 {
-                    total_cfg_sz += cfg_sz;
-                    total_res_sz += (uint8_t)(res_sz*res_mult_factor);
+                    total_cfg_sz += cfg_sz_by_mode[(uint8_t)(*step_type_ptr)];
+                    total_res_sz += (uint8_t)(res_sz_by_mode[(uint8_t)(*step_type_ptr)]*res_mult_factor);
                 }
                 else
                 {
@@ -407,12 +481,19 @@ xcvrLclStatus_t XCVR_LCL_ProgramFstepRam(cs_subevent_info_t * subevent_info_ptr,
         uint16_t * phase_add_ptr = subevent_info_ptr->phase_add_list;        
         static COM_MODE_CFG_HDR_UNION_Type step_header; /* Used to assemble header structures for write to PKT RAM */
         COM_MODE_CFG_HDR_UNION_Type * step_hdr_ptr = &step_header;
+        uint8_t cfg_sz_by_mode[XCVR_LCL_NUM_STEP_MODES];
+        uint8_t res_sz_by_mode[XCVR_LCL_NUM_STEP_MODES];
+        /* Size each step format once, only the config size is needed */
+        xcvrLclStatus_t size_status = XCVR_LCL_SizeStepModes(subevent_info_ptr->rtt_type, subevent_info_ptr->num_ap, cfg_sz_by_mode, res_sz_by_mode);
         for (i=0;i<(subevent_info_ptr->num_steps);i++)
         {
                 uint8_t cfg_sz = 0U;
-                uint8_t res_sz = 0U;
-                /* Calculate the size of the config and result (only need the config now) */
-                xcvrLclStatus_t temp_status = XCVR_LCL_CalcConfigResult_Size(*step_type_ptr, subevent_info_ptr->rtt_type, subevent_info_ptr->num_ap, &cfg_sz, &res_sz) ;
+                xcvrLclStatus_t temp_status = gXcvrLclStatusInvalidArgs;
+                if ((size_status == gXcvrLclStatusSuccess) && ((uint8_t)(*step_type_ptr) < XCVR_LCL_NUM_STEP_MODES))
+                {
+                    cfg_sz = cfg_sz_by_mode[(uint8_t)(*step_type_ptr)];
+                    temp_status = gXcvrLclStatusSuccess;
+                }
                 if (temp_status == gXcvrLclStatusSuccess)
                 {
                     /* Fill out the configuration header & payload based on the step type */
@@ -551,6 +632,139 @@ xcvrLclStatus_t XCVR_LCL_ProgramFstepRam(cs_subevent_info_t * subevent_info_ptr,
     return status;
 }
 
+xcvrLclStatus_t XCVR_LCL_MakeSubeventTemplate(cs_subevent_info_t * subevent_info_ptr, uint32_t * image, uint16_t image_sz_words, cs_subevent_template_t * template_ptr)
+{
+    xcvrLclStatus_t status = gXcvrLclStatusSuccess;
+    /* Error checking for NULL pointer  */
+    if ((subevent_info_ptr == NULLPTR) || (image == NULLPTR) || (template_ptr == NULLPTR))
+    {
+        status = gXcvrLclStatusInvalidArgs;
+    }
+    else
+    {
+        uint8_t i;
+        uint8_t res_sz_by_mode[XCVR_LCL_NUM_STEP_MODES];
+        uint32_t total_words = 0U;
+        /* Size each step type once, the per step sizing is then a table lookup */
+        status = XCVR_LCL_SizeStepModes(subevent_info_ptr->rtt_type, subevent_info_ptr->num_ap, template_ptr->cfg_sz, res_sz_by_mode);
+        if (status == gXcvrLclStatusSuccess)
+        {
+            for (i=0U;i<(subevent_info_ptr->num_steps);i++)
+            {
+                if ((uint8_t)subevent_info_ptr->step_type[i] > (uint8_t)XCVR_RSM_STEP_PK_TN_TN_PK)
+                {
+                    status = gXcvrLclStatusInvalidArgs;
+                    break;
+                }
+                total_words += template_ptr->cfg_sz[(uint8_t)subevent_info_ptr->step_type[i]];
+            }
+        }
+        if ((status == gXcvrLclStatusSuccess) && (total_words > image_sz_words))
+        {
+            status = gXcvrLclStatusInvalidLength;
+        }
+        if (status == gXcvrLclStatusSuccess)
+        {
+            /* Build the complete image once, later subevents only patch the varying fields */
+            status = XCVR_LCL_ProgramFstepRam(subevent_info_ptr, NULLPTR, image);
+        }
+        if (status == gXcvrLclStatusSuccess)
+        {
+            template_ptr->image = image;
+            template_ptr->num_words = (uint16_t)total_words;
+            template_ptr->num_steps = subevent_info_ptr->num_steps;
+            template_ptr->rtt_type = subevent_info_ptr->rtt_type;
+            template_ptr->num_ap = subevent_info_ptr->num_ap;
+            template_ptr->phy_test_mode = subevent_info_ptr->phy_test_mode;
+        }
+    }
+
+    return status;
+}
+
+xcvrLclStatus_t XCVR_LCL_PatchSubeventTemplate(const cs_subevent_template_t * template_ptr, cs_subevent_info_t * subevent_info_ptr)
+{
+    xcvrLclStatus_t status = gXcvrLclStatusSuccess;
+    /* Error checking for NULL pointer and for a subevent that does not share the template layout */
+    if ((template_ptr == NULLPTR) || (subevent_info_ptr == NULLPTR) || (template_ptr->image == NULLPTR))
+    {
+        status = gXcvrLclStatusInvalidArgs;
+    }
+    else if ((subevent_info_ptr->num_steps != template_ptr->num_steps) ||
+             (subevent_info_ptr->rtt_type != template_ptr->rtt_type) ||
+             (subevent_info_ptr->num_ap != template_ptr->num_ap) ||
+             (subevent_info_ptr->phy_test_mode != template_ptr->phy_test_mode))
+    {
+        status = gXcvrLclStatusInvalidArgs;
+    }
+    else
+    {
+        /* Walk the image with the step offsets from the template, pointers advance exactly as in XCVR_LCL_ProgramFstepRam() */
+        uint8_t i;
+        uint16_t curr_addr = 0U;  /* Current word offset into the template image */
+        XCVR_RSM_FSTEP_TYPE_T * step_type_ptr = subevent_info_ptr->step_type;
+        uint32_t * aa_list_ptr = subevent_info_ptr->aa_list;
+        uint32_t * payload_list_init_ptr = subevent_info_ptr->payload_list_init;
+        uint32_t * payload_list_refl_ptr = subevent_info_ptr->payload_list_refl;
+        uint16_t * channel_list_ptr = subevent_info_ptr->channel_list;
+        uint16_t * hpm_cal_list_ptr = subevent_info_ptr->hpm_cal_list;
+        uint16_t * step_cfg_list_ptr = subevent_info_ptr->step_cfg_list;
+        uint16_t * step_cfo_ptr = subevent_info_ptr->cfo_list;
+        uint16_t * phase_add_ptr = subevent_info_ptr->phase_add_list;
+        for (i=0;i<(subevent_info_ptr->num_steps);i++)
+        {
+            volatile xcvr_lcl_mode_0_1_3_cfg_t * mode1_3_step_ptr = (volatile xcvr_lcl_mode_0_1_3_cfg_t *)&(template_ptr->image[curr_addr]);
+            uint16_t image_step_cfg = mode1_3_step_ptr->header.STEP_CFG;
+            uint16_t temp = (uint16_t)((image_step_cfg&COM_MODE_013_CFG_HDR_STEP_CFG_MODE_MASK)>>COM_MODE_013_CFG_HDR_STEP_CFG_MODE_SHIFT);
+            XCVR_RSM_FSTEP_TYPE_T image_step_type = (XCVR_RSM_FSTEP_TYPE_T)(temp);
+            temp = (uint16_t)((*step_cfg_list_ptr&COM_MODE_013_CFG_HDR_STEP_CFG_MODE_MASK)>>COM_MODE_013_CFG_HDR_STEP_CFG_MODE_SHIFT);
+            /* The step type sets the step size so it must match the image, the rest of the step configuration may change */
+            if ((*step_type_ptr != image_step_type) || ((XCVR_RSM_FSTEP_TYPE_T)(temp) != image_step_type))
+            {
+                status = gXcvrLclStatusInvalidArgs;
+                break;
+            }
+            uint8_t cfg_sz = template_ptr->cfg_sz[(uint8_t)image_step_type];
+            /* Every step type starts with the common header, written as the 3 words of COM_MODE_CFG_HDR_UNION_Type. CTUNE is not used */
+            /* The Mode 2 phase adder is taken without advancing as in XCVR_LCL_ProgramFstepRam() */
+            {
+                volatile uint32_t * header_words_ptr = &(template_ptr->image[curr_addr]);
+                uint16_t mapped_channel;
+                MAKE_MAPPED_CHAN_OVRD2((*channel_list_ptr), mapped_channel); /* Maps to proper format for RSM channels */
+                header_words_ptr[0] = (uint32_t)mapped_channel | ((uint32_t)(*step_cfg_list_ptr) << 16U);
+                header_words_ptr[1] = (uint32_t)(*step_cfo_ptr) | ((uint32_t)COM_MODE_013_CFG_HDR_HPM_CAL_FACTOR_HPM_CAL_FACTOR((*hpm_cal_list_ptr) >> 1U) << 16U);
+                header_words_ptr[2] = (uint32_t)COM_MODE_013_CFG_HDR_CTUNE_MANUAL_CTUNE_MANUAL(0U) | ((uint32_t)COM_MODE_013_CFG_HDR_PHASE_ADD_PHASE_ADD(*phase_add_ptr) << 16U);
+            }
+            if (image_step_type != XCVR_RSM_STEP_TN_TN)
+            {
+                /* Mode 0 has no payload words, Mode 1 & 3 have (cfg_sz-5) payload words split between initiator and reflector */
+                XCVR_LCL_MakeMode013_Payload(mode1_3_step_ptr, aa_list_ptr[0], aa_list_ptr[1], (cfg_sz-5U)>>1, payload_list_init_ptr, payload_list_refl_ptr);
+                if (!subevent_info_ptr->phy_test_mode) /* In PHY test mode we always use the first pair of AA so never increment */
+                {
+                    aa_list_ptr++;
+                    aa_list_ptr++;
+                }
+                else
+                {
+                    /* Because payload pointers are incremented inside the macro, we need to undo that increment when in test mode */
+                    payload_list_init_ptr -= ((cfg_sz-5U)>>1);
+                    payload_list_refl_ptr -= ((cfg_sz-5U)>>1);
+                }
+                phase_add_ptr++;
+            }
+            /* Common pointer updates that apply to all step types */
+            channel_list_ptr++;
+            step_cfo_ptr++;
+            hpm_cal_list_ptr++;
+            step_cfg_list_ptr++;
+            step_type_ptr++;
+            curr_addr += cfg_sz; /* Update the current offset into the template image */
+        }
+    }
+
+    return status;
+}
+
 xcvrLclStatus_t XCVR_LCL_InitCfgResPointers(cs_pkt_ram_config_info_t * pkt_ram_info_ptr)
 {
     xcvrLclStatus_t status = gXcvrLclStatusSuccess;
@@ -635,11 +849,12 @@ xcvrLclStatus_t XCVR_LCL_ResetCfgResPointers(void)
 xcvrLclStatus_t XCVR_LCL_LoadConfigSteps(uint32_t ** current_cfg_ptr)
 {
     xcvrLclStatus_t status = gXcvrLclStatusSuccess;
-    static uint32_t temp_cfg_val;
     /* Copy the step interval count number of steps from the current_cfg pointer into PKT RAM based on the current CONFIG write pointer */
     /* If fewer than step interval steps are remaining then copy that many instead */
-    uint8_t i,j;
+    /* The step headers are walked first and each contiguous run of PKT RAM (at most two unless the batch is larger than the buffer) is copied at once */
+    uint8_t i;
     uint32_t * temp_cur_cfg_ptr = *current_cfg_ptr; /* Local pointer copy */
+    uint32_t * segment_src_ptr = temp_cur_cfg_ptr; /* Start of the configs not copied yet */
     uint8_t count = step_irq_count;
     if (remaining_configs_to_load < step_irq_count)
     {
@@ -650,42 +865,42 @@ xcvrLclStatus_t XCVR_LCL_LoadConfigSteps(uint32_t ** current_cfg_ptr)
     /* Get configuration write pointer */
     uint32_t temp_config_ptr_reg = XCVR_MISC->RSM_CONFIG_PTR;
     uint16_t config_index = (uint16_t)((temp_config_ptr_reg&XCVR_MISC_RSM_CONFIG_PTR_RSM_CONFIG_WR_PTR_MASK)>>XCVR_MISC_RSM_CONFIG_PTR_RSM_CONFIG_WR_PTR_SHIFT);
+    uint16_t segment_index = config_index; /* PKT RAM index of the configs not copied yet */
     uint8_t config_page = (uint8_t)((temp_config_ptr_reg&XCVR_MISC_RSM_CONFIG_PTR_RSM_CONFIG_WR_PAGE_MASK)>>XCVR_MISC_RSM_CONFIG_PTR_RSM_CONFIG_WR_PAGE_SHIFT);
     assert(config_index < config_rollover_index);
     
     for (i=0U; i<count; i++)
     {
         /* Check for rollover - use max result size of *any* step to determine when to rollover (if the biggest step won't fit then rollover) */
-        if (cfg_step_length_words[3U] > (config_rollover_index-config_index)) // TODO: check rollover logic for off by 1 case 
+        if (cfg_step_length_words[3U] > (config_rollover_index-config_index)) /* A largest step that fits exactly is written, the exact fill check below rolls over after it */
         {
-            // reset PKT RAM pointer to base of buffer
+            /* Copy the run ending here then reset PKT RAM pointer to base of buffer */
+            XCVR_LCL_CopyToPktRam(&config_pkt_ram_buffer[segment_index], segment_src_ptr, (uint16_t)(temp_cur_cfg_ptr - segment_src_ptr));
+            segment_src_ptr = temp_cur_cfg_ptr;
             config_index = (uint16_t)((XCVR_MISC->RSM_CONFIG_BUFF&XCVR_MISC_RSM_CONFIG_BUFF_RSM_CONFIG_BASE_ADDR_MASK)>>XCVR_MISC_RSM_CONFIG_BUFF_RSM_CONFIG_BASE_ADDR_SHIFT);
+            segment_index = config_index;
             config_page = (~config_page)&0x1U;  /* invert only 1 bit */
         }
         /* Read step data (header) and calculate length in words */
         uint32_t step_data = (*temp_cur_cfg_ptr)>>16U; /* First word always includes STEP_CFG in upper 16 bits */
         uint8_t mode = (uint8_t)((step_data&COM_MODE_013_CFG_HDR_STEP_CFG_MODE_MASK)>>COM_MODE_013_CFG_HDR_STEP_CFG_MODE_SHIFT);
         uint8_t length = cfg_step_length_words[mode];
-        for (j=0U; j<length;j++)
-        {
-#if (0)
-            config_pkt_ram_buffer[config_index] = *temp_cur_cfg_ptr;
-#else
-            temp_cfg_val = *temp_cur_cfg_ptr;
-            config_pkt_ram_buffer[config_index] = temp_cfg_val;
-#endif
-            config_index++;
-            temp_cur_cfg_ptr++;
-        }
+        config_index += length;
+        temp_cur_cfg_ptr += length;
         remaining_configs_to_load--;
         /* Check for rollover - in the case of the configs just exactly filled the buffer */
         if (config_index == config_rollover_index)
         {
-            // reset PKT RAM pointer to base of buffer
-            config_index = ((XCVR_MISC->RSM_CONFIG_BUFF&XCVR_MISC_RSM_CONFIG_BUFF_RSM_CONFIG_BASE_ADDR_MASK)>>XCVR_MISC_RSM_CONFIG_BUFF_RSM_CONFIG_BASE_ADDR_SHIFT);
+            /* Copy the run ending here then reset PKT RAM pointer to base of buffer */
+            XCVR_LCL_CopyToPktRam(&config_pkt_ram_buffer[segment_index], segment_src_ptr, (uint16_t)(temp_cur_cfg_ptr - segment_src_ptr));
+            segment_src_ptr = temp_cur_cfg_ptr;
+            config_index = (uint16_t)((XCVR_MISC->RSM_CONFIG_BUFF&XCVR_MISC_RSM_CONFIG_BUFF_RSM_CONFIG_BASE_ADDR_MASK)>>XCVR_MISC_RSM_CONFIG_BUFF_RSM_CONFIG_BASE_ADDR_SHIFT);
+            segment_index = config_index;
             config_page = (~config_page)&0x1U;  /* invert only 1 bit */
         }
     }
+    /* Copy the last run */
+    XCVR_LCL_CopyToPktRam(&config_pkt_ram_buffer[segment_index], segment_src_ptr, (uint16_t)(temp_cur_cfg_ptr - segment_src_ptr));
     *current_cfg_ptr = temp_cur_cfg_ptr;  /* Update global pointer to the config system RAM storage */
     /* Update the configuration pointer register in RSM */
     temp_config_ptr_reg &= ~(XCVR_MISC_RSM_CONFIG_PTR_RSM_CONFIG_WR_PTR_MASK | XCVR_MISC_RSM_CONFIG_PTR_RSM_CONFIG_WR_PAGE_MASK);
@@ -701,7 +916,8 @@ xcvrLclStatus_t XCVR_LCL_ReadResultSteps(uint32_t ** current_res_ptr)
     xcvrLclStatus_t status = gXcvrLclStatusSuccess;
     /* Copy the step interval count number of results from PKT RAM to the current_cfg pointer based on the current RESULT read pointer */
     /* If fewer than step interval steps are remaining then copy that many instead */
-    uint8_t i,j;
+    /* The result headers are walked first and each contiguous run of PKT RAM (at most two unless the batch is larger than the buffer) is copied at once */
+    uint8_t i;
     uint32_t * temp_cur_res_ptr = *current_res_ptr; /* Local pointer copy */
     uint8_t count = step_irq_count;
     if (remaining_results_to_read < step_irq_count)
@@ -713,16 +929,20 @@ xcvrLclStatus_t XCVR_LCL_ReadResultSteps(uint32_t ** current_res_ptr)
     /* Get result read pointer */
     uint32_t temp_result_ptr_reg = XCVR_MISC->RSM_RESULT_PTR;
     uint16_t result_index =(uint16_t)((temp_result_ptr_reg&XCVR_MISC_RSM_RESULT_PTR_RSM_RESULT_RD_PTR_MASK)>>XCVR_MISC_RSM_RESULT_PTR_RSM_RESULT_RD_PTR_SHIFT);
+    uint16_t segment_index = result_index; /* PKT RAM index of the results not copied yet */
     uint8_t result_page = (uint8_t)((temp_result_ptr_reg&XCVR_MISC_RSM_RESULT_PTR_RSM_RESULT_RD_PAGE_MASK)>>XCVR_MISC_RSM_RESULT_PTR_RSM_RESULT_RD_PAGE_SHIFT);
     assert(result_index < result_rollover_index);
     
     for (i=0U; i<count; i++)
     {
         /* Check for rollover - use max result size of *any* step to determine when to rollover (if the biggest step won't fit then rollover) */
-        if (res_step_length_words[3U] > (result_rollover_index-result_index)) // TODO: check rollover logic for off by 1 case 
+        if (res_step_length_words[3U] > (result_rollover_index-result_index)) /* A largest step that fits exactly is written, the exact fill check below rolls over after it */
         {
-            // reset PKT RAM pointer to base of buffer
+            /* Copy the run ending here then reset PKT RAM pointer to base of buffer */
+            XCVR_LCL_CopyFromPktRam(temp_cur_res_ptr, &result_pkt_ram_buffer[segment_index], (uint16_t)(result_index-segment_index));
+            temp_cur_res_ptr += (uint16_t)(result_index-segment_index);
             result_index = (uint16_t)((XCVR_MISC->RSM_RESULT_BUFF&XCVR_MISC_RSM_RESULT_BUFF_RSM_RESULT_BASE_ADDR_MASK)>>XCVR_MISC_RSM_RESULT_BUFF_RSM_RESULT_BASE_ADDR_SHIFT);
+            segment_index = result_index;
             result_page = (result_page == 0U ? 1U : 0U); /* Single bit invert */
         }
         /* Read step data (header) and calculate length in words */
@@ -731,31 +951,34 @@ xcvrLclStatus_t XCVR_LCL_ReadResultSteps(uint32_t ** current_res_ptr)
 #if defined(DEBUG_CIRCULAR_BUFF) && (DEBUG_CIRCULAR_BUFF == 1)
         assert(length <21); /* make sure length is correct */
 #endif
-        for (j=0U; j<length;j++)
+        /* Index the step: its results start after the runs already copied and the part of this run before it */
+        if ((attached_result_index != NULLPTR) && (attached_result_index->num_steps < attached_result_index->max_steps))
         {
-            *temp_cur_res_ptr = result_pkt_ram_buffer[result_index];
-            result_index++;
-            temp_cur_res_ptr++;
+            attached_result_index->step_offset[attached_result_index->num_steps] = (uint16_t)((temp_cur_res_ptr - attached_result_index->results) + (result_index - segment_index));
+            attached_result_index->step_length[attached_result_index->num_steps] = length;
+            attached_result_index->num_steps++;
         }
+        result_index += length;
         /* In sniffer mode there is always another result of the exact same length */
         if (in_sniffer_mode)
         {
-            for (j=0U; j<length;j++)
-            {
-                *temp_cur_res_ptr = result_pkt_ram_buffer[result_index];
-                result_index++;
-                temp_cur_res_ptr++;
-            }
+            result_index += length;
         }
         remaining_results_to_read--;
         /* If last result chunk just filled the results buffer then must rollover to the start */
         if (result_index  == result_rollover_index)
         {
-            // reset PKT RAM pointer to base of buffer
+            /* Copy the run ending here then reset PKT RAM pointer to base of buffer */
+            XCVR_LCL_CopyFromPktRam(temp_cur_res_ptr, &result_pkt_ram_buffer[segment_index], (uint16_t)(result_index-segment_index));
+            temp_cur_res_ptr += (uint16_t)(result_index-segment_index);
             result_index = (uint16_t)((XCVR_MISC->RSM_RESULT_BUFF&XCVR_MISC_RSM_RESULT_BUFF_RSM_RESULT_BASE_ADDR_MASK)>>XCVR_MISC_RSM_RESULT_BUFF_RSM_RESULT_BASE_ADDR_SHIFT);
+            segment_index = result_index;
             result_page = (result_page == 0U ? 1U : 0U); /* Single bit invert */
         }
     }
+    /* Copy the last run */
+    XCVR_LCL_CopyFromPktRam(temp_cur_res_ptr, &result_pkt_ram_buffer[segment_index], (uint16_t)(result_index-segment_index));
+    temp_cur_res_ptr += (uint16_t)(result_index-segment_index);
     *current_res_ptr = temp_cur_res_ptr;  /* Update global pointer to the result system RAM storage */
     /* Update the result pointer register in RSM */
     temp_result_ptr_reg &= ~(XCVR_MISC_RSM_RESULT_PTR_RSM_RESULT_RD_PTR_MASK | XCVR_MISC_RSM_RESULT_PTR_RSM_RESULT_RD_PAGE_MASK);
@@ -765,6 +988,80 @@ xcvrLclStatus_t XCVR_LCL_ReadResultSteps(uint32_t ** current_res_ptr)
     return status;
 }
 
+xcvrLclStatus_t XCVR_LCL_AttachResultIndex(cs_result_index_t * index_ptr)
+{
+    xcvrLclStatus_t status = gXcvrLclStatusSuccess;
+    /* NULLPTR detaches the index, otherwise the storage and step types must be provided */
+    if ((index_ptr != NULLPTR) && ((index_ptr->step_offset == NULLPTR) || (index_ptr->step_length == NULLPTR) || (index_ptr->step_type == NULLPTR)))
+    {
+        status = gXcvrLclStatusInvalidArgs;
+    }
+    else
+    {
+        attached_result_index = index_ptr;
+    }
+
+    return status;
+}
+
+xcvrLclStatus_t XCVR_LCL_GetStepResults(const cs_result_index_t * index_ptr, uint8_t step, cs_step_results_t * results_ptr)
+{
+    xcvrLclStatus_t status = gXcvrLclStatusSuccess;
+    /* Error checking for NULL pointer and for a step not indexed yet */
+    if ((index_ptr == NULLPTR) || (results_ptr == NULLPTR) || (index_ptr->results == NULLPTR) || (step >= index_ptr->num_steps))
+    {
+        status = gXcvrLclStatusInvalidArgs;
+    }
+    else
+    {
+        XCVR_RSM_FSTEP_TYPE_T step_format = index_ptr->step_type[step];
+        uint8_t length = index_ptr->step_length[step];
+        uint8_t rtt_words = 0U; /* RTT body words of this step type */
+        uint8_t iq_words = 0U;  /* IQ body words, whatever remains of the result after the header and RTT body */
+        switch (step_format)
+        {
+            case XCVR_RSM_STEP_FCS:
+            case XCVR_RSM_STEP_PK_PK:
+                rtt_words = XCVR_LCL_RES_RTT_BODY_WORDS;
+                status = (length == (XCVR_LCL_RES_HDR_WORDS+rtt_words)) ? gXcvrLclStatusSuccess : gXcvrLclStatusInvalidLength;
+                break;
+            case XCVR_RSM_STEP_TN_TN:
+            case XCVR_RSM_STEP_PK_TN_TN_PK:
+                rtt_words = ((step_format == XCVR_RSM_STEP_TN_TN) ? 0U : XCVR_LCL_RES_RTT_BODY_WORDS);
+                if ((length > (XCVR_LCL_RES_HDR_WORDS+rtt_words)) && (length <= (XCVR_LCL_RES_HDR_WORDS+rtt_words+XCVR_LCL_RES_MAX_IQ_WORDS)))
+                {
+                    iq_words = length-XCVR_LCL_RES_HDR_WORDS-rtt_words;
+                }
+                else
+                {
+                    status = gXcvrLclStatusInvalidLength;
+                }
+                break;
+            default:
+                status = gXcvrLclStatusInvalidArgs;
+                break;
+        }
+        if (status == gXcvrLclStatusSuccess)
+        {
+            /* Cast the result structures onto the stream, in sniffer mode the second result immediately follows the first */
+            const uint32_t * result_ptr = &(index_ptr->results[index_ptr->step_offset[step]]);
+            results_ptr->step_format = step_format;
+            results_ptr->num_results = (index_ptr->is_sniffer_mode ? 2U : 1U);
+            for (uint8_t i = 0U; i < results_ptr->num_results; i++)
+            {
+                cs_step_result_view_t * view_ptr = &(results_ptr->result[i]);
+                view_ptr->header = (const COM_RES_HDR_Type *)result_ptr;
+                view_ptr->rtt_body = ((rtt_words != 0U) ? (const COM_MODE_013_RES_BODY_Type *)&result_ptr[XCVR_LCL_RES_HDR_WORDS] : NULLPTR);
+                view_ptr->iq_body = ((iq_words != 0U) ? (const IQ_RES_BODY_Type *)&result_ptr[XCVR_LCL_RES_HDR_WORDS+rtt_words] : NULLPTR);
+                view_ptr->num_iq_words = iq_words;
+                result_ptr = &result_ptr[length];
+            }
+        }
+    }
+
+    return status;
+}
+
 xcvrLclStatus_t XCVR_LCL_SetupInitialConfigs(uint8_t total_num_steps, uint32_t * config_in_ptr, uint32_t * results_out_ptr, XCVR_RSM_RTT_TYPE_T rtt_type, uint8_t num_ap, bool sniffer_mode)
 {
     uint8_t  status = (uint8_t)(gXcvrLclStatusSuccess);  /* Accumulate status in uint8_t variable for multiple steps */
@@ -775,9 +1072,9 @@ xcvrLclStatus_t XCVR_LCL_SetupInitialConfigs(uint8_t total_num_steps, uint32_t *
     remaining_results_to_read = total_num_steps; /* Decrements as results are read */
     
     /* Prep for routines to quickly calculate addresses based on step sizes */
+    status |= (uint8_t)(XCVR_LCL_SizeStepModes(rtt_type, num_ap, cfg_step_length_words, res_step_length_words));
     for (uint8_t i= 0U; i<4U; i++)
     {
-        status |= (uint8_t)(XCVR_LCL_CalcConfigResult_Size((XCVR_RSM_FSTEP_TYPE_T)i, rtt_type, num_ap, &cfg_step_length_words[i], &res_step_length_words[i]));
         if (sniffer_mode)
         {
             res_step_length_words[i] = res_step_length_words[i] * 2U; /* Twice as many results in each step in sniffer mode */
@@ -801,6 +1098,13 @@ xcvrLclStatus_t XCVR_LCL_SetupInitialConfigs(uint8_t total_num_steps, uint32_t *
     /* Load 2 buffers worth of configs (where each is ::step_irq_count in length) */
     curr_config_in_ptr = config_in_ptr;  /* place the pointer to the input buffer of all configs into static local */
     curr_result_out_ptr = results_out_ptr;   /* place the pointer to the output buffer of all results into static local */
+    if (attached_result_index != NULLPTR)
+    {
+        /* Restart the result index on the results of this subevent */
+        attached_result_index->results = results_out_ptr;
+        attached_result_index->num_steps = 0U;
+        attached_result_index->is_sniffer_mode = sniffer_mode;
+    }
     status |= (uint8_t)(XCVR_LCL_LoadConfigSteps(&curr_config_in_ptr));
     status |= (uint8_t)(XCVR_LCL_LoadConfigSteps(&curr_config_in_ptr));
 
@@ -133,6 +133,47 @@ typedef struct
                              the results are produced in sniffer mode) */
 } cs_pkt_ram_config_info_t;
 
+/*! @brief  CS subevent configuration template, the packed step configurations of a subevent and their layout. */
+typedef struct
+{
+    uint32_t *image;              /*!< Packed step configurations, in system RAM or PKT RAM. */
+    uint16_t num_words;           /*!< Size of the image in words. */
+    uint8_t num_steps;            /*!< Number of steps in the image. */
+    uint8_t cfg_sz[4];            /*!< Configuration size in words of each step type (Mode 0/1/2/3). */
+    XCVR_RSM_RTT_TYPE_T rtt_type; /*!< RTT type the image was built for. */
+    uint8_t num_ap;               /*!< Number of antenna paths the image was built for. */
+    bool phy_test_mode;           /*!< PHY test mode setting the image was built for. */
+} cs_subevent_template_t;
+
+/*! @brief  CS result index, the location of every step result in the result stream of a subevent. */
+typedef struct
+{
+    uint16_t *step_offset; /*!< Storage for max_steps entries: word offset of the results of each step in the stream. */
+    uint8_t *step_length;  /*!< Storage for max_steps entries: length in words of one result of each step. */
+    const XCVR_RSM_FSTEP_TYPE_T *step_type; /*!< List of step types of the subevent, as in ::cs_subevent_info_t. */
+    uint8_t max_steps;                      /*!< Number of entries of the storage. */
+    const uint32_t *results; /*!< Start of the result stream, set by ::XCVR_LCL_SetupInitialConfigs(). */
+    uint8_t num_steps;       /*!< Number of steps indexed so far. */
+    bool is_sniffer_mode;    /*!< True if each step has two results, set by ::XCVR_LCL_SetupInitialConfigs(). */
+} cs_result_index_t;
+
+/*! @brief  View of one step result in the result stream. It points into the stream, nothing is copied. */
+typedef struct
+{
+    const COM_RES_HDR_Type *header;             /*!< The result header. [Common result header used for all steps] */
+    const COM_MODE_013_RES_BODY_Type *rtt_body; /*!< The RTT result body for Mode 0, 1, & 3 steps, NULLPTR otherwise. */
+    const IQ_RES_BODY_Type *iq_body;            /*!< The IQ result body for Mode 2 & 3 steps, NULLPTR otherwise. */
+    uint8_t num_iq_words; /*!< Number of PCT_RESULT words in the IQ result body (number of antenna paths + 1). */
+} cs_step_result_view_t;
+
+/*! @brief  Results of one step. In sniffer mode the RSM produces two results per step and both are exposed. */
+typedef struct
+{
+    XCVR_RSM_FSTEP_TYPE_T step_format; /*!< The step type of the step. */
+    uint8_t num_results;               /*!< Number of results of the step, 2 in sniffer mode and 1 otherwise. */
+    cs_step_result_view_t result[2];   /*!< The results of the step, in the order the RSM produced them. */
+} cs_step_results_t;
+
 extern cs_subevent_info_t subevent_info;
 extern const uint8_t rtt_payload_sizes[7];
 
@@ -615,7 +656,8 @@ xcvrLclStatus_t XCVR_LCL_MakeMode2CfgHeader(xcvr_lcl_mode_2_cfg_t *cfg_entry,
      *
      * This function takes in information about a single Channel Sounding step and calculates the number of 32bit words
      * in both the config and the result steps. This information is used to update the PKT RAM index and determine when
-     * double buffers roll over.
+     * double buffers roll over. The sizes are looked up in constant tables covering every step format, RTT type and
+     * number of antenna paths, so the cost does not depend on the inputs.
      *
      * @param[in] step_format The format of the step.
      * @param[in] rtt_type The RTT type for the step (must be constant throughout an entire sequence).
@@ -623,7 +665,8 @@ xcvrLclStatus_t XCVR_LCL_MakeMode2CfgHeader(xcvr_lcl_mode_2_cfg_t *cfg_entry,
      * @param[out] config_size_words The number of 32bit words in the config for the step.
      * @param[out] result_size_words The number of 32bit words in the result for the step.
      *
-     * @return The status of the calculation (not the result but any error in input values).
+     * @return The status of the calculation (not the result but any error in input values). Out of range inputs
+     * always return gXcvrLclStatusInvalidArgs with both sizes set to zero.
      *
      * @note For a particular RTT Type and number of antenna paths combination, this routine can be called once for each
      * step_format (0, 1, 2, 3) and the results stored in arrays locally at the caller. This can optimize time when the
@@ -674,6 +717,44 @@ xcvrLclStatus_t XCVR_LCL_ProgramFstepRam(cs_subevent_info_t *subevent_info_ptr,
                                          cs_pkt_ram_config_info_t *pkt_ram_info_ptr,
                                          uint32_t *sys_ram_ptr);
 
+/*!
+ * @brief Function to build a configuration template for subevents that share their step layout.
+ *
+ * This function programs a complete subevent into the image buffer, as ::XCVR_LCL_ProgramFstepRam() does into system
+ * RAM, and records the layout of the steps. Later subevents with the same number of steps, step configurations, RTT
+ * type, number of antenna paths and PHY test mode setting are then programmed by ::XCVR_LCL_PatchSubeventTemplate(),
+ * which only rewrites the fields that vary between subevents.
+ *
+ * @param[in] subevent_info_ptr Pointer to the information describing a subevent (all steps).
+ * @param[out] image Pointer to the buffer for the packed step configurations (system RAM or PKT RAM).
+ * @param[in] image_sz_words The size of the image buffer in words.
+ * @param[out] template_ptr Pointer to the template to initialize.
+ *
+ * @return The status of the template build, gXcvrLclStatusInvalidLength if the subevent does not fit in the buffer.
+ *
+ */
+xcvrLclStatus_t XCVR_LCL_MakeSubeventTemplate(cs_subevent_info_t *subevent_info_ptr,
+                                              uint32_t *image,
+                                              uint16_t image_sz_words,
+                                              cs_subevent_template_t *template_ptr);
+
+/*!
+ * @brief Function to program a subevent into a configuration template.
+ *
+ * This function rewrites the channel, CFO, HPM CAL, phase adder, access address and payload fields of every step of
+ * the template image from the subevent information. The step configurations, sizes and offsets are kept from the
+ * template build, so the resulting image is the one ::XCVR_LCL_ProgramFstepRam() would produce for the subevent.
+ *
+ * @param[in] template_ptr Pointer to a template initialized by ::XCVR_LCL_MakeSubeventTemplate().
+ * @param[in] subevent_info_ptr Pointer to the information describing a subevent (all steps).
+ *
+ * @return The status of the programming process, gXcvrLclStatusInvalidArgs if the subevent does not have the layout of
+ * the template. The steps before the first mismatching one have then been rewritten.
+ *
+ */
+xcvrLclStatus_t XCVR_LCL_PatchSubeventTemplate(const cs_subevent_template_t *template_ptr,
+                                               cs_subevent_info_t *subevent_info_ptr);
+
 /*!
  * @brief Function to initialize the configuration and result pointers for hardware use.
  *
@@ -728,7 +809,8 @@ uint8_t XCVR_LCL_ReadStepCfg(COM_MODE_013_CFG_HDR_Type *header_ptr,
  * @brief Function to load configuration steps to PKT RAM (from system RAM) in double buffering use cases.
  *
  * This function copies previously generated configuration steps from system RAM to PKT RAM. It copies up to <step
- * count> number of steps and handles when there are fewer steps left in the sequence.
+ * count> number of steps and handles when there are fewer steps left in the sequence. The steps are copied by
+ * contiguous runs of PKT RAM, split only where the buffer rolls over.
  *
  * @return The status of the copy process.
  *
@@ -742,7 +824,8 @@ xcvrLclStatus_t XCVR_LCL_LoadConfigSteps(uint32_t **current_cfg_ptr);
  * @brief Function to read result steps from PKT RAM (to system RAM) in double buffering use cases.
  *
  * This function copies previously generated result steps from PKT RAM to system RAM. It copies up to <step count>
- * number of results and handles when there are fewer steps left in the sequence.
+ * number of results and handles when there are fewer steps left in the sequence. The results are copied by
+ * contiguous runs of PKT RAM, split only where the buffer rolls over.
  *
  * @param[in] current_cfg_ptr Pointer to a pointer to the location of the step configuration.
  * @return The status of the copy process.
@@ -753,6 +836,42 @@ xcvrLclStatus_t XCVR_LCL_LoadConfigSteps(uint32_t **current_cfg_ptr);
  */
 xcvrLclStatus_t XCVR_LCL_ReadResultSteps(uint32_t **current_res_ptr);
 
+/*!
+ * @brief Function to attach a result index to the double buffering result reads.
+ *
+ * While an index is attached, ::XCVR_LCL_ReadResultSteps() records the offset and length of each step result in it as
+ * the results are copied out of PKT RAM, from the result headers it reads anyway. ::XCVR_LCL_SetupInitialConfigs()
+ * restarts the index on the result stream of the subevent. Steps beyond max_steps are not indexed.
+ *
+ * @param[in] index_ptr Pointer to the index to attach, with its storage and step type list set. NULLPTR detaches the
+ * index.
+ *
+ * @return The status of the attach, gXcvrLclStatusInvalidArgs if the storage or the step type list is missing.
+ *
+ * @pre The index must be attached before ::XCVR_LCL_SetupInitialConfigs() is called for the subevent.
+ *
+ */
+xcvrLclStatus_t XCVR_LCL_AttachResultIndex(cs_result_index_t *index_ptr);
+
+/*!
+ * @brief Function to access the results of a step through a result index.
+ *
+ * This function locates the header, RTT body and IQ body of the results of any indexed step without parsing the result
+ * stream. Steps can be accessed in any order, iterating over the subevent is a loop from step 0 to num_steps - 1 of the
+ * index.
+ *
+ * @param[in] index_ptr Pointer to the result index.
+ * @param[in] step The step number in the subevent.
+ * @param[out] results_ptr Pointer to the location to store the views of the results of the step.
+ *
+ * @return The status of the access, gXcvrLclStatusInvalidArgs if the step is not indexed yet and
+ * gXcvrLclStatusInvalidLength if its RESULT_SIZE is too short for its step type.
+ *
+ */
+xcvrLclStatus_t XCVR_LCL_GetStepResults(const cs_result_index_t *index_ptr,
+                                        uint8_t step,
+                                        cs_step_results_t *results_ptr);
+
 /*!
  * @brief Function to perform checks on double buffering configuration info.
  *
@@ -0,0 +1,284 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Host generator for radio configuration blobs.
+ *
+ * Every compiled in configuration is copied with XCVR_RadioGenBlobEncode() into the versioned blob format loaded in
+ * place by XCVR_RadioGenBlobLoad():
+ *   - xcvr_<mode>_<rate>.bin holds the common and the mode and data rate configurations, ready for XCVR_Configure(),
+ *   - xcvr_<coding>.bin holds one coding configuration.
+ * Each file is read back from disk and loaded with XCVR_RadioGenBlobLoad(); the tool fails if a loaded configuration
+ * differs from the original structure or if a copy with a corrupted payload byte is accepted.
+ *
+ * Build it on the host against the device headers of the target and the configuration sources of the matching radio
+ * generation and reference clock (the blobs only load on that target), e.g. for KW47:
+ *
+ *   gcc -DNXP_RADIO_GEN=470 -DRF_OSC_26MHZ=0 -I<device headers> -Idrv -Idrv/nb2p4ghz \
+ *       -Idrv/nb2p4ghz/configs/gen47 tools/xcvr_blob_gen.c drv/nb2p4ghz/configs/gen47/nxp_xcvr_*.c \
+ *       drv/nb2p4ghz/nxp_xcvr_blob.c -o xcvr_blob_gen
+ *   ./xcvr_blob_gen <output folder>
+ *
+ * The payload words are copies of the configuration structures, so the host must lay them out like the target: 32-bit
+ * enums and a little-endian byte order. The loader rejects blobs whose section sizes do not match its own structures.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "nxp2p4_xcvr.h"
+#include "nxp_xcvr_coding_config.h"
+#include "nxp_xcvr_common_config.h"
+#include "nxp_xcvr_fsk_h_0p5_config.h"
+#include "nxp_xcvr_gfsk_bt_0p3_h_0p5_config.h"
+#include "nxp_xcvr_gfsk_bt_0p5_h_0p32_config.h"
+#include "nxp_xcvr_gfsk_bt_0p5_h_0p5_config.h"
+#include "nxp_xcvr_gfsk_bt_0p5_h_0p7_config.h"
+#include "nxp_xcvr_gfsk_bt_0p5_h_1p0_config.h"
+#include "nxp_xcvr_gfsk_bt_0p7_h_0p5_config.h"
+#include "nxp_xcvr_gfsk_bt_1p0_h_0p5_config.h"
+#include "nxp_xcvr_gfsk_bt_2p0_h_0p5_config.h"
+#include "nxp_xcvr_msk_config.h"
+#include "nxp_xcvr_oqpsk_802p15p4_config.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define GEN_PATH_MAX  (512U)
+#define GEN_MAX_WORDS (1024U)
+
+/* Configurations to convert, named after their xcvr_config_t or xcvr_coding_config_t without the _config suffix */
+#define GEN_CONFIG(name) {#name, &name##_full_config, NULL}
+#define GEN_CODING(name) {#name, NULL, &name##_config}
+
+typedef struct
+{
+    const char *name;
+    const xcvr_config_t *config;
+    const xcvr_coding_config_t *coding_cfg;
+} gen_config_t;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+static int gen_write(const char *path, const uint32_t *blob, uint32_t num_words);
+static int gen_read(const char *path, uint32_t *blob, uint32_t max_words, uint32_t *num_words);
+static int gen_check(const gen_config_t *cfg, uint32_t *blob, uint32_t num_words);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static const gen_config_t gen_configs[] = {
+    GEN_CONFIG(xcvr_fsk_h_0p5_1mbps),
+    GEN_CONFIG(xcvr_fsk_h_0p5_500kbps),
+    GEN_CONFIG(xcvr_fsk_h_0p5_250kbps),
+    GEN_CONFIG(xcvr_gfsk_bt_0p3_h_0p5_1mbps),
+    GEN_CONFIG(xcvr_gfsk_bt_0p3_h_0p5_500kbps),
+    GEN_CONFIG(xcvr_gfsk_bt_0p3_h_0p5_250kbps),
+    GEN_CONFIG(xcvr_gfsk_bt_0p5_h_0p32_1mbps),
+    GEN_CONFIG(xcvr_gfsk_bt_0p5_h_0p32_500kbps),
+    GEN_CONFIG(xcvr_gfsk_bt_0p5_h_0p32_250kbps),
+    GEN_CONFIG(xcvr_gfsk_bt_0p5_h_0p5_1mbps),
+    GEN_CONFIG(xcvr_gfsk_bt_0p5_h_0p5_500kbps),
+    GEN_CONFIG(xcvr_gfsk_bt_0p5_h_0p5_250kbps),
+    GEN_CONFIG(xcvr_gfsk_bt_0p5_h_0p7_1mbps),
+    GEN_CONFIG(xcvr_gfsk_bt_0p5_h_0p7_500kbps),
+    GEN_CONFIG(xcvr_gfsk_bt_0p5_h_0p7_250kbps),
+    GEN_CONFIG(xcvr_gfsk_bt_0p5_h_1p0_1mbps),
+    GEN_CONFIG(xcvr_gfsk_bt_0p5_h_1p0_500kbps),
+    GEN_CONFIG(xcvr_gfsk_bt_0p5_h_1p0_250kbps),
+    GEN_CONFIG(xcvr_gfsk_bt_0p7_h_0p5_1mbps),
+    GEN_CONFIG(xcvr_gfsk_bt_0p7_h_0p5_500kbps),
+    GEN_CONFIG(xcvr_gfsk_bt_0p7_h_0p5_250kbps),
+    GEN_CONFIG(xcvr_gfsk_bt_1p0_h_0p5_1mbps),
+    GEN_CONFIG(xcvr_gfsk_bt_2p0_h_0p5_1mbps),
+    GEN_CONFIG(xcvr_msk_1mbps),
+    GEN_CONFIG(xcvr_msk_500kbps),
+    GEN_CONFIG(xcvr_msk_250kbps),
+    GEN_CONFIG(xcvr_oqpsk_802p15p4_250kbps),
+    GEN_CODING(xcvr_ble_uncoded),
+    GEN_CODING(xcvr_ble_coded_s2),
+    GEN_CODING(xcvr_ble_coded_s8),
+    GEN_CODING(xcvr_ant_uncoded),
+};
+
+#define GEN_NUM_CONFIGS (sizeof(gen_configs) / sizeof(gen_configs[0]))
+
+/*******************************************************************************
+ * Code
+ *******************************************************************************/
+static int gen_write(const char *path, const uint32_t *blob, uint32_t num_words)
+{
+    FILE *f = fopen(path, "wb");
+    uint8_t bytes[4];
+    uint32_t i;
+    int status = 0;
+
+    if (f == NULL)
+    {
+        (void)fprintf(stderr, "cannot create %s\n", path);
+        status = 1;
+    }
+    else
+    {
+        /* Explicit little-endian byte order, whatever the host */
+        for (i = 0U; (i < num_words) && (status == 0); i++)
+        {
+            bytes[0] = (uint8_t)(blob[i]);
+            bytes[1] = (uint8_t)(blob[i] >> 8U);
+            bytes[2] = (uint8_t)(blob[i] >> 16U);
+            bytes[3] = (uint8_t)(blob[i] >> 24U);
+            if (fwrite(bytes, 1U, sizeof(bytes), f) != sizeof(bytes))
+            {
+                status = 1;
+            }
+        }
+        if ((fclose(f) != 0) || (status != 0))
+        {
+            (void)fprintf(stderr, "cannot write %s\n", path);
+            status = 1;
+        }
+    }
+
+    return status;
+}
+
+static int gen_read(const char *path, uint32_t *blob, uint32_t max_words, uint32_t *num_words)
+{
+    FILE *f = fopen(path, "rb");
+    uint8_t bytes[4];
+    uint32_t i = 0U;
+    int status = 0;
+
+    if (f == NULL)
+    {
+        (void)fprintf(stderr, "cannot open %s\n", path);
+        status = 1;
+    }
+    else
+    {
+        while ((i < max_words) && (fread(bytes, 1U, sizeof(bytes), f) == sizeof(bytes)))
+        {
+            blob[i] = (uint32_t)bytes[0] | ((uint32_t)bytes[1] << 8U) | ((uint32_t)bytes[2] << 16U) |
+                      ((uint32_t)bytes[3] << 24U);
+            i++;
+        }
+        (void)fclose(f);
+        *num_words = i;
+    }
+
+    return status;
+}
+
+static int gen_check(const gen_config_t *cfg, uint32_t *blob, uint32_t num_words)
+{
+    xcvr_blob_config_t loaded;
+    uint32_t last = num_words - 1U;
+    int status    = 0;
+
+    if (XCVR_RadioGenBlobLoad(blob, num_words, &loaded) != gXcvrSuccess_c)
+    {
+        (void)fprintf(stderr, "%s: blob does not load\n", cfg->name);
+        status = 1;
+    }
+    else if (cfg->config != NULL)
+    {
+        if ((loaded.coding_cfg != NULL) || (loaded.config.common_cfg == NULL) ||
+            (loaded.config.mode_data_rate_cfg == NULL) ||
+            (memcmp(loaded.config.common_cfg, cfg->config->common_cfg, sizeof(xcvr_common_config_t)) != 0) ||
+            (memcmp(loaded.config.mode_data_rate_cfg, cfg->config->mode_data_rate_cfg,
+                    sizeof(xcvr_mode_datarate_config_t)) != 0))
+        {
+            (void)fprintf(stderr, "%s: loaded configuration differs\n", cfg->name);
+            status = 1;
+        }
+    }
+    else
+    {
+        if ((loaded.config.common_cfg != NULL) || (loaded.config.mode_data_rate_cfg != NULL) ||
+            (loaded.coding_cfg == NULL) ||
+            (memcmp(loaded.coding_cfg, cfg->coding_cfg, sizeof(xcvr_coding_config_t)) != 0))
+        {
+            (void)fprintf(stderr, "%s: loaded configuration differs\n", cfg->name);
+            status = 1;
+        }
+    }
+
+    /* A corrupted payload must fail the CRC check, a truncated blob the size check */
+    blob[last] ^= 0x100U;
+    if (XCVR_RadioGenBlobLoad(blob, num_words, &loaded) == gXcvrSuccess_c)
+    {
+        (void)fprintf(stderr, "%s: corrupted blob accepted\n", cfg->name);
+        status = 1;
+    }
+    blob[last] ^= 0x100U;
+    if (XCVR_RadioGenBlobLoad(blob, last, &loaded) == gXcvrSuccess_c)
+    {
+        (void)fprintf(stderr, "%s: truncated blob accepted\n", cfg->name);
+        status = 1;
+    }
+
+    return status;
+}
+
+int main(int argc, char *argv[])
+{
+    static uint32_t blob[GEN_MAX_WORDS];
+    char path[GEN_PATH_MAX];
+    uint32_t num_words;
+    uint32_t read_words;
+    uint32_t i;
+    xcvrStatus_t encode_status;
+    int status = 0;
+
+    if (argc != 2)
+    {
+        (void)fprintf(stderr, "usage: %s <output folder>\n", argv[0]);
+        return 2;
+    }
+
+    (void)printf("%-36s %6s\n", "blob", "bytes");
+    for (i = 0U; i < GEN_NUM_CONFIGS; i++)
+    {
+        if (gen_configs[i].config != NULL)
+        {
+            encode_status = XCVR_RadioGenBlobEncode(gen_configs[i].config->common_cfg,
+                                                    gen_configs[i].config->mode_data_rate_cfg, NULL, blob,
+                                                    GEN_MAX_WORDS, &num_words);
+        }
+        else
+        {
+            encode_status =
+                XCVR_RadioGenBlobEncode(NULL, NULL, gen_configs[i].coding_cfg, blob, GEN_MAX_WORDS, &num_words);
+        }
+        (void)snprintf(path, sizeof(path), "%s/%s.bin", argv[1], gen_configs[i].name);
+        if (encode_status != gXcvrSuccess_c)
+        {
+            (void)fprintf(stderr, "%s: encode failed\n", gen_configs[i].name);
+            status = 1;
+        }
+        else if ((gen_write(path, blob, num_words) != 0) ||
+                 (gen_read(path, blob, GEN_MAX_WORDS, &read_words) != 0))
+        {
+            status = 1;
+        }
+        else if (read_words != num_words)
+        {
+            (void)fprintf(stderr, "%s: read back %u of %u words\n", path, (unsigned int)read_words,
+                          (unsigned int)num_words);
+            status = 1;
+        }
+        else
+        {
+            if (gen_check(&gen_configs[i], blob, num_words) != 0)
+            {
+                status = 1;
+            }
+            (void)printf("%-36s %6u\n", gen_configs[i].name, (unsigned int)(num_words * sizeof(uint32_t)));
+        }
+    }
+
+    return status;
+}
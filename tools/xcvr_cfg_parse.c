@@ -0,0 +1,524 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <glob.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include "xcvr_cfg_parse.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define CFG_PATH_MAX   (512U)
+#define CFG_LINE_MAX   (256U)
+#define CFG_LINE_WIDTH (120U)
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+static char *cfg_trim(char *line);
+static int cfg_parse_struct(const char *header, const char *type_name, char names[][CFG_NAME_MAX], uint32_t max_names,
+                            uint32_t *num_names);
+static int cfg_find_word(const cfg_layout_t *layout, const char *designator, uint32_t *word);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+/* The one level RF_OSC_26MHZ conditional of the generated configurations, the same in every configuration */
+static char cfg_cond_if[CFG_LINE_MAX];
+static char cfg_cond_endif[CFG_LINE_MAX];
+
+/*******************************************************************************
+ * Code
+ *******************************************************************************/
+char *cfg_read_file(const char *path)
+{
+    FILE *in = fopen(path, "rb");
+    char *buffer = NULL;
+    long size;
+
+    if (in != NULL)
+    {
+        if ((fseek(in, 0, SEEK_END) == 0) && ((size = ftell(in)) >= 0) && (fseek(in, 0, SEEK_SET) == 0))
+        {
+            buffer = malloc((size_t)size + 1U);
+            if ((buffer != NULL) && (fread(buffer, 1U, (size_t)size, in) == (size_t)size))
+            {
+                buffer[size] = '\0';
+            }
+            else
+            {
+                free(buffer);
+                buffer = NULL;
+            }
+        }
+        (void)fclose(in);
+    }
+    if (buffer == NULL)
+    {
+        (void)fprintf(stderr, "cannot read %s\n", path);
+    }
+
+    return buffer;
+}
+
+char *cfg_read_sources(const char *dir)
+{
+    char path[CFG_PATH_MAX];
+    glob_t sources_glob;
+    char *sources = NULL;
+    char *file;
+    size_t used = 0U;
+    uint32_t i;
+
+    (void)snprintf(path, sizeof(path), "%s/nxp_xcvr_*_config.c", dir);
+    if (glob(path, 0, NULL, &sources_glob) != 0)
+    {
+        (void)fprintf(stderr, "no configuration source in %s\n", dir);
+    }
+    else
+    {
+        for (i = 0U; i < sources_glob.gl_pathc; i++)
+        {
+            file = cfg_read_file(sources_glob.gl_pathv[i]);
+            if (file == NULL)
+            {
+                free(sources);
+                sources = NULL;
+                break;
+            }
+            sources = realloc(sources, used + strlen(file) + 1U);
+            (void)strcpy(&sources[used], file);
+            used += strlen(file);
+            free(file);
+        }
+        globfree(&sources_glob);
+    }
+
+    return sources;
+}
+
+static char *cfg_trim(char *line)
+{
+    size_t len;
+
+    while ((*line == ' ') || (*line == '\t'))
+    {
+        line++;
+    }
+    len = strlen(line);
+    while ((len > 0U) && ((line[len - 1U] == ' ') || (line[len - 1U] == '\t') || (line[len - 1U] == '\r')))
+    {
+        len--;
+    }
+    line[len] = '\0';
+
+    return line;
+}
+
+int cfg_append(cfg_text_t text, const char *line)
+{
+    size_t used = strlen(text);
+    int status  = 0;
+
+    if ((used + strlen(line) + 2U) > CFG_TEXT_MAX)
+    {
+        (void)fprintf(stderr, "initializer too long: %s\n", line);
+        status = 1;
+    }
+    else
+    {
+        if (used != 0U)
+        {
+            text[used] = '\n';
+            used++;
+        }
+        (void)strcpy(&text[used], line);
+    }
+
+    return status;
+}
+
+/* List the members of a structure definition, "type name;" or "type name[count];" per line */
+static int cfg_parse_struct(const char *header, const char *type_name, char names[][CFG_NAME_MAX], uint32_t max_names,
+                            uint32_t *num_names)
+{
+    char end_tag[CFG_NAME_MAX + 4U];
+    char line[CFG_LINE_MAX];
+    char type[CFG_NAME_MAX];
+    char name[CFG_NAME_MAX];
+    char sub[CFG_MAX_WORDS][CFG_NAME_MAX];
+    const char *end;
+    const char *start;
+    const char *next;
+    uint32_t num_sub;
+    uint32_t count;
+    uint32_t i;
+    uint32_t j;
+    size_t len;
+    int status = 0;
+
+    /* The members sit between the line opening the definition and the closing "} type_name;" */
+    (void)snprintf(end_tag, sizeof(end_tag), "} %s;", type_name);
+    end   = strstr(header, end_tag);
+    start = end;
+    while ((start != NULL) && (start > header) && (strncmp(start, "typedef struct", 14U) != 0))
+    {
+        start--;
+    }
+    if ((end == NULL) || (start == header))
+    {
+        (void)fprintf(stderr, "no definition of %s\n", type_name);
+        status = 1;
+    }
+
+    *num_names = 0U;
+    while ((status == 0) && (start < end))
+    {
+        next = strchr(start, '\n');
+        len  = (size_t)(next - start);
+        (void)snprintf(line, sizeof(line), "%.*s", (int)((len < CFG_LINE_MAX) ? len : (CFG_LINE_MAX - 1U)), start);
+        start = next + 1;
+        count = 0U;
+        if (sscanf(line, " %63s %63[a-z0-9_][%u];", type, name, &count) < 2)
+        {
+            continue;
+        }
+        if ((strcmp(type, "typedef") == 0) || (strncmp(type, "/*", 2U) == 0))
+        {
+            continue;
+        }
+        num_sub = 0U;
+        if (strcmp(type, "xcvr_demod_wave_t") == 0)
+        {
+            status = cfg_parse_struct(header, type, sub, CFG_MAX_WORDS, &num_sub);
+        }
+        else if ((strcmp(type, "uint32_t") != 0) && (strcmp(type, "radio_mode_t") != 0) &&
+                 (strcmp(type, "data_rate_t") != 0))
+        {
+            (void)fprintf(stderr, "unexpected member type %s in %s\n", type, type_name);
+            status = 1;
+        }
+        for (i = 0U; (status == 0) && (i < ((count == 0U) ? 1U : count)); i++)
+        {
+            for (j = 0U; (status == 0) && (j < ((num_sub == 0U) ? 1U : num_sub)); j++)
+            {
+                if (*num_names >= max_names)
+                {
+                    (void)fprintf(stderr, "%s has more words than expected\n", type_name);
+                    status = 1;
+                    break;
+                }
+                if (count == 0U)
+                {
+                    (void)snprintf(names[*num_names], CFG_NAME_MAX, ".%.31s%.24s", name, (num_sub == 0U) ? "" : sub[j]);
+                }
+                else
+                {
+                    (void)snprintf(names[*num_names], CFG_NAME_MAX, ".%.31s[%u]%.16s", name, (unsigned int)i,
+                                   (num_sub == 0U) ? "" : sub[j]);
+                }
+                (*num_names)++;
+            }
+        }
+    }
+
+    return status;
+}
+
+int cfg_parse_layout(const char *dir, const char *type_name, uint32_t num_words, cfg_layout_t *layout)
+{
+    char path[CFG_PATH_MAX];
+    char *header;
+    int status = 1;
+
+    (void)snprintf(path, sizeof(path), "%s/nxp_xcvr_mode_config.h", dir);
+    header = cfg_read_file(path);
+    if (header != NULL)
+    {
+        status = cfg_parse_struct(header, type_name, layout->names, CFG_MAX_WORDS, &layout->num_words);
+        if ((status == 0) && (layout->num_words != num_words))
+        {
+            (void)fprintf(stderr, "parsed %u words, %s has %u\n", (unsigned int)layout->num_words, type_name,
+                          (unsigned int)num_words);
+            status = 1;
+        }
+        free(header);
+    }
+
+    return status;
+}
+
+static int cfg_find_word(const cfg_layout_t *layout, const char *designator, uint32_t *word)
+{
+    char compact[CFG_NAME_MAX];
+    uint32_t len = 0U;
+    uint32_t i;
+    int status = 1;
+
+    /* Compare designators without white space */
+    for (i = 0U; (designator[i] != '\0') && (len < (CFG_NAME_MAX - 1U)); i++)
+    {
+        if ((designator[i] != ' ') && (designator[i] != '\t'))
+        {
+            compact[len] = designator[i];
+            len++;
+        }
+    }
+    compact[len] = '\0';
+    for (i = 0U; i < layout->num_words; i++)
+    {
+        if (strcmp(compact, layout->names[i]) == 0)
+        {
+            *word  = i;
+            status = 0;
+            break;
+        }
+    }
+    if (status != 0)
+    {
+        (void)fprintf(stderr, "unknown designator %s\n", designator);
+    }
+
+    return status;
+}
+
+int cfg_parse_init(const char *sources, const char *type_name, const char *var_name, const cfg_layout_t *layout,
+                   cfg_init_t *init)
+{
+    char pattern[CFG_LINE_MAX];
+    char line_buf[CFG_LINE_MAX];
+    const char *start;
+    const char *pos;
+    const char *next;
+    char *line;
+    char *expr;
+    char *text = NULL;
+    uint32_t variant;
+    uint32_t word;
+    uint32_t i;
+    bool active;
+    bool in_entry;
+    bool in_comment;
+    bool done;
+    size_t len;
+    int status = 0;
+
+    (void)snprintf(pattern, sizeof(pattern), "const %s %s = {", type_name, var_name);
+    start = strstr(sources, pattern);
+    if (start == NULL)
+    {
+        (void)fprintf(stderr, "no initializer for %s\n", var_name);
+        status = 1;
+    }
+    (void)memset(init, 0, sizeof(*init));
+
+    for (variant = 0U; (status == 0) && (variant < CFG_NUM_VARIANTS); variant++)
+    {
+        pos        = strchr(start, '\n');
+        active     = true;
+        in_entry   = false;
+        in_comment = false;
+        done       = false;
+        while ((status == 0) && !done && (pos != NULL))
+        {
+            pos++;
+            next = strchr(pos, '\n');
+            len  = (next != NULL) ? (size_t)(next - pos) : strlen(pos);
+            if (len >= CFG_LINE_MAX)
+            {
+                (void)fprintf(stderr, "line too long in %s\n", var_name);
+                status = 1;
+                break;
+            }
+            (void)memcpy(line_buf, pos, len);
+            line_buf[len] = '\0';
+            pos           = next;
+            line          = cfg_trim(line_buf);
+
+            /* Comments take whole lines, some of them several */
+            if (in_comment || (strncmp(line, "/*", 2U) == 0))
+            {
+                in_comment = (strstr(line, "*/") == NULL);
+                continue;
+            }
+            if (line[0] == '#')
+            {
+                /* Only the one level RF_OSC_26MHZ conditional of the generated configurations is expected */
+                if ((strncmp(line, "#if", 3U) == 0) && active &&
+                    ((cfg_cond_if[0] == '\0') || (strcmp(line, cfg_cond_if) == 0)))
+                {
+                    (void)snprintf(cfg_cond_if, sizeof(cfg_cond_if), "%s", line);
+                    active = (variant == CFG_VARIANT_26MHZ);
+                }
+                else if ((strncmp(line, "#else", 5U) == 0) && (cfg_cond_if[0] != '\0'))
+                {
+                    active = (variant == CFG_VARIANT_32MHZ);
+                }
+                else if (strncmp(line, "#endif", 6U) == 0)
+                {
+                    (void)snprintf(cfg_cond_endif, sizeof(cfg_cond_endif), "%s", line);
+                    active = true;
+                }
+                else
+                {
+                    (void)fprintf(stderr, "unexpected %s in %s\n", line, var_name);
+                    status = 1;
+                }
+                continue;
+            }
+            if (!active || (line[0] == '\0'))
+            {
+                continue;
+            }
+
+            if (!in_entry)
+            {
+                if (strcmp(line, "};") == 0)
+                {
+                    done = true;
+                    continue;
+                }
+                /* New entry, the expression may start on the next line */
+                expr = strchr(line, '=');
+                if ((line[0] != '.') || (expr == NULL))
+                {
+                    (void)fprintf(stderr, "unexpected line in %s: %s\n", var_name, line);
+                    status = 1;
+                    break;
+                }
+                *expr = '\0';
+                if (cfg_find_word(layout, cfg_trim(line), &word) != 0)
+                {
+                    status = 1;
+                    break;
+                }
+                text = init->text[variant][word];
+                if (text[0] != '\0')
+                {
+                    (void)fprintf(stderr, "%s assigned twice in %s\n", layout->names[word], var_name);
+                    status = 1;
+                    break;
+                }
+                in_entry = true;
+                line     = cfg_trim(expr + 1);
+                if (line[0] == '\0')
+                {
+                    continue;
+                }
+            }
+            status   = cfg_append(text, line);
+            in_entry = (line[strlen(line) - 1U] != ',');
+        }
+        if ((status == 0) && (!done || in_entry || !active))
+        {
+            (void)fprintf(stderr, "unterminated initializer for %s\n", var_name);
+            status = 1;
+        }
+    }
+
+    /* Words left out are zero */
+    for (variant = 0U; (status == 0) && (variant < CFG_NUM_VARIANTS); variant++)
+    {
+        for (i = 0U; i < layout->num_words; i++)
+        {
+            if (init->text[variant][i][0] == '\0')
+            {
+                (void)strcpy(init->text[variant][i], CFG_UNSET_TEXT);
+            }
+        }
+    }
+
+    return status;
+}
+
+int cfg_join_variants(cfg_text_t text, const char *const variants[CFG_NUM_VARIANTS])
+{
+    const char *lines[5];
+    uint32_t num_lines;
+    uint32_t i;
+    int status = 0;
+
+    text[0] = '\0';
+    if (strcmp(variants[CFG_VARIANT_32MHZ], variants[CFG_VARIANT_26MHZ]) == 0)
+    {
+        lines[0]  = variants[CFG_VARIANT_32MHZ];
+        num_lines = 1U;
+    }
+    else
+    {
+        /* The word depends on the reference clock, keep the conditional */
+        lines[0]  = cfg_cond_if;
+        lines[1]  = variants[CFG_VARIANT_26MHZ];
+        lines[2]  = "#else";
+        lines[3]  = variants[CFG_VARIANT_32MHZ];
+        lines[4]  = cfg_cond_endif;
+        num_lines = 5U;
+    }
+    for (i = 0U; (status == 0) && (i < num_lines); i++)
+    {
+        status = cfg_append(text, lines[i]);
+    }
+
+    return status;
+}
+
+void cfg_write_text(FILE *out, const char *text, uint32_t indent, const char *line_end)
+{
+    char line[CFG_TEXT_MAX];
+    const char *next;
+    char *rest;
+    char *split;
+    char *bar;
+    size_t len;
+    size_t room;
+    uint32_t line_indent;
+    bool continued = false;
+
+    while (text != NULL)
+    {
+        next = strchr(text, '\n');
+        len  = (next != NULL) ? (size_t)(next - text) : strlen(text);
+        (void)memcpy(line, text, len);
+        line[len] = '\0';
+        text      = (next != NULL) ? (next + 1) : NULL;
+        if (line[0] == '#')
+        {
+            (void)fprintf(out, "%s\n", line);
+            continued = false;
+            continue;
+        }
+        rest = line;
+        do
+        {
+            /* Lines made longer than CFG_LINE_WIDTH by the indentation are split after the last fitting " |" */
+            line_indent = continued ? (indent + 4U) : indent;
+            room        = CFG_LINE_WIDTH - line_indent - strlen(line_end);
+            split       = NULL;
+            bar         = strstr(rest, " | ");
+            while ((strlen(rest) > room) && (bar != NULL) && ((size_t)(bar - rest + 2) <= room))
+            {
+                split = bar + 2;
+                bar   = strstr(split, " | ");
+            }
+            if ((strlen(rest) > room) && (split != NULL))
+            {
+                *split = '\0';
+                (void)fprintf(out, "%*s%s%s\n", (int)line_indent, "", rest, line_end);
+                rest      = split + 1;
+                continued = true;
+            }
+            else
+            {
+                (void)fprintf(out, "%*s%s%s\n", (int)line_indent, "", rest,
+                              ((text != NULL) && (text[0] != '#')) ? line_end : "");
+                continued = (rest[strlen(rest) - 1U] != ',');
+                rest      = NULL;
+            }
+        } while (rest != NULL);
+    }
+}
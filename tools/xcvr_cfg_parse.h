@@ -0,0 +1,129 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Initializer parser of the host generators: splits the initializer of a radio configuration structure in the
+ * nxp_xcvr_<mode>_config.c sources into the initializer text of every word, so that the generated tables copy the
+ * initializers (RF_OSC_26MHZ conditionals included) instead of values taken from the device headers the generator is
+ * built against. Built with xcvr_mode_delta_gen and xcvr_reg_image_gen, see tools/CMakeLists.txt.
+ */
+
+#ifndef XCVR_CFG_PARSE_H
+/* clang-format off */
+#define XCVR_CFG_PARSE_H
+/* clang-format on */
+
+#include <stdint.h>
+#include <stdio.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define CFG_MAX_WORDS  (256U)  /* Words of the largest configuration structure */
+#define CFG_NAME_MAX   (64U)   /* Longest designator of a word */
+#define CFG_TEXT_MAX   (2048U) /* Longest initializer text of a word */
+#define CFG_UNSET_TEXT "0U,"   /* Initializer text of a word left out of an initializer */
+
+/* Reference clock branches of an initializer, the #else branch is the 32MHz one */
+#define CFG_VARIANT_32MHZ (0U)
+#define CFG_VARIANT_26MHZ (1U)
+#define CFG_NUM_VARIANTS  (2U)
+
+/* Initializer text of one word: trimmed source lines separated by '\n', preprocessor lines included */
+typedef char cfg_text_t[CFG_TEXT_MAX];
+
+/*! @brief Words of a configuration structure, named after their designator, enumerations are one word each */
+typedef struct
+{
+    char names[CFG_MAX_WORDS][CFG_NAME_MAX];
+    uint32_t num_words;
+} cfg_layout_t;
+
+/*! @brief Initializer texts of every word of one configuration, for each reference clock branch */
+typedef struct
+{
+    cfg_text_t text[CFG_NUM_VARIANTS][CFG_MAX_WORDS];
+} cfg_init_t;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+/*!
+ * @brief Reads a whole file.
+ *
+ * @param[in] path  Path of the file.
+ * @return Pointer to the zero terminated contents to be freed by the caller, NULL (reported on stderr) on error.
+ */
+char *cfg_read_file(const char *path);
+
+/*!
+ * @brief Reads the configuration sources of a configs folder.
+ *
+ * @param[in] dir  Path of the configs folder of a radio generation.
+ * @return Pointer to the concatenated nxp_xcvr_*_config.c files to be freed by the caller, NULL on error.
+ */
+char *cfg_read_sources(const char *dir);
+
+/*!
+ * @brief Names the words of a configuration structure defined in nxp_xcvr_mode_config.h.
+ *
+ * @param[in] dir  Path of the configs folder of a radio generation.
+ * @param[in] type_name  Name of the structure type, e.g. "xcvr_mode_datarate_config_t".
+ * @param[in] num_words  Expected number of words of the structure.
+ * @param[out] layout  Pointer to the layout to be filled.
+ * @return 0 on success, 1 (reported on stderr) if the definition cannot be parsed or has another number of words.
+ */
+int cfg_parse_layout(const char *dir, const char *type_name, uint32_t num_words, cfg_layout_t *layout);
+
+/*!
+ * @brief Splits the initializer of a configuration into the initializer text of every word.
+ *
+ * The initializer is read twice, once keeping the RF_OSC_26MHZ conditional branches and once the #else branches, each
+ * read being a list of ".designator = expr," entries which may span several lines. Words left out get
+ * ::CFG_UNSET_TEXT.
+ *
+ * @param[in] sources  Pointer to the configuration sources, see ::cfg_read_sources().
+ * @param[in] type_name  Name of the structure type of the configuration.
+ * @param[in] var_name  Name of the configuration.
+ * @param[in] layout  Pointer to the layout of the structure type.
+ * @param[out] init  Pointer to the initializer texts to be filled.
+ * @return 0 on success, 1 (reported on stderr) if the initializer cannot be parsed.
+ */
+int cfg_parse_init(const char *sources, const char *type_name, const char *var_name, const cfg_layout_t *layout,
+                   cfg_init_t *init);
+
+/*!
+ * @brief Appends a line to an initializer text.
+ *
+ * @param[in,out] text  Initializer text.
+ * @param[in] line  Line to append.
+ * @return 0 on success, 1 (reported on stderr) if the text gets too long.
+ */
+int cfg_append(cfg_text_t text, const char *line);
+
+/*!
+ * @brief Joins the initializer texts of the two reference clock branches of a word.
+ *
+ * @param[out] text  Initializer text, the common text or both texts under the RF_OSC_26MHZ conditional of the sources.
+ * @param[in] variants  Initializer texts of the word, indexed by ::CFG_VARIANT_32MHZ and ::CFG_VARIANT_26MHZ.
+ * @return 0 on success, 1 (reported on stderr) if the text gets too long.
+ */
+int cfg_join_variants(cfg_text_t text, const char *const variants[CFG_NUM_VARIANTS]);
+
+/*!
+ * @brief Writes an initializer text as array or structure elements, continuation lines are indented once more.
+ *
+ * Lines which the indentation makes longer than 120 columns are split after an OR operator.
+ *
+ * @param[in] out  Output file.
+ * @param[in] text  Initializer text.
+ * @param[in] indent  Indentation of the elements in spaces, preprocessor lines are not indented.
+ * @param[in] line_end  Appended to every line continued by the next one (not a preprocessor line), " \\" for the
+ *                      body of a macro, else "".
+ */
+void cfg_write_text(FILE *out, const char *text, uint32_t indent, const char *line_end);
+
+#endif /* XCVR_CFG_PARSE_H */
@@ -0,0 +1,253 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Host check and benchmark of the CS subevent configuration templates (x86-64 Linux, KW47 and later with a 32MHz
+ * RF_OSC).
+ *
+ * For every RTT type, a subevent of BENCH_NUM_STEPS steps of pseudo random types is built into a template with
+ * XCVR_LCL_MakeSubeventTemplate(), with and without PHY test mode. BENCH_NUM_SUBEVENTS later subevents keep the step
+ * types and change the channels, access addresses, payloads, CFO, HPM CAL, phase adders and the non mode bits of the
+ * step configurations. Each one is patched into the template with XCVR_LCL_PatchSubeventTemplate(), and the image must
+ * be the one XCVR_LCL_ProgramFstepRam() builds in system RAM for the same subevent. A subevent with one step of another
+ * type, or with another mode in one step configuration, must be rejected. Both ways of programming a subevent are then
+ * timed, the best of BENCH_NUM_RUNS runs is kept.
+ *
+ * The step configurations are written to system RAM only, so no register file is needed. Build it on the host against
+ * the device headers of the target:
+ *
+ *   gcc -O2 -DNXP_RADIO_GEN=470 -DRF_OSC_26MHZ=0 -I<device headers> -Idrv -Idrv/nb2p4ghz \
+ *       -Idrv/nb2p4ghz/configs/gen47 tools/xcvr_cs_template_bench.c \
+ *       drv/{dbg_ram_capture,mathfp,nxp_xcvr_ext_ctrl,nxp_xcvr_lcl_ctrl,nxp_xcvr_lcl_step_mgr,rfmc_ctrl}.c \
+ *       drv/nb2p4ghz/{nxp2p4_xcvr,nxp_xcvr_blob,nxp_xcvr_hop_table,nxp_xcvr_trim}.c \
+ *       drv/nb2p4ghz/configs/gen47/nxp_xcvr_*.c -lm -o xcvr_cs_template_bench
+ *   ./xcvr_cs_template_bench
+ *
+ * The report has one JSON object per RTT type and PHY test mode setting, for instance:
+ *   {"rtt_type":6,"phy_test_mode":0,"num_steps":255,"num_words":2273,"mismatches":0,"rejects":2,
+ *    "ns_program":2750,"ns_patch":1480}
+ * The exit status is non zero if a patched image differs from the programmed one or a bad layout is accepted.
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "nxp_xcvr_lcl_step_mgr.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define BENCH_NUM_STEPS     (255U)
+#define BENCH_NUM_SUBEVENTS (8U)
+#define BENCH_NUM_RUNS      (2000U)
+#define BENCH_NUM_AP        (4U)
+#define BENCH_MAX_WORDS     (BENCH_NUM_STEPS * 13U) /* Largest step is 5 words plus 8 words of payload */
+#define BENCH_MAX_PAYLOAD   (BENCH_NUM_STEPS * 4U)  /* Up to 4 words per role and step */
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+static uint64_t bench_time_ns(void);
+static uint32_t bench_rand(void);
+static void bench_fill(uint32_t seed, bool keep_types);
+static uint32_t bench_check(const cs_subevent_template_t *template_ptr, uint32_t *num_rejects);
+static void bench_time(const cs_subevent_template_t *template_ptr, uint64_t *ns_program, uint64_t *ns_patch);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static XCVR_RSM_FSTEP_TYPE_T bench_step_type[BENCH_NUM_STEPS];
+static uint32_t bench_aa[BENCH_NUM_STEPS * 2U];
+static uint32_t bench_payload_init[BENCH_MAX_PAYLOAD];
+static uint32_t bench_payload_refl[BENCH_MAX_PAYLOAD];
+static uint16_t bench_channel[BENCH_NUM_STEPS];
+static uint16_t bench_cfo[BENCH_NUM_STEPS];
+static uint16_t bench_phase_add[BENCH_NUM_STEPS];
+static uint16_t bench_hpm_cal[BENCH_NUM_STEPS];
+static uint16_t bench_step_cfg[BENCH_NUM_STEPS];
+static cs_subevent_info_t bench_subevent = {
+    .step_type         = bench_step_type,
+    .aa_list           = bench_aa,
+    .payload_list_init = bench_payload_init,
+    .payload_list_refl = bench_payload_refl,
+    .channel_list      = bench_channel,
+    .cfo_list          = bench_cfo,
+    .phase_add_list    = bench_phase_add,
+    .hpm_cal_list      = bench_hpm_cal,
+    .step_cfg_list     = bench_step_cfg,
+    .num_ap            = BENCH_NUM_AP,
+};
+
+static uint32_t bench_template_image[BENCH_MAX_WORDS];
+static uint32_t bench_program_image[BENCH_MAX_WORDS];
+static uint32_t bench_seed;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+static uint64_t bench_time_ns(void)
+{
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((uint64_t)now.tv_sec * 1000000000ULL) + (uint64_t)now.tv_nsec;
+}
+
+static uint32_t bench_rand(void)
+{
+    bench_seed = (bench_seed * 1103515245U) + 12345U;
+
+    return bench_seed >> 8;
+}
+
+/* Draw the varying fields of a subevent, and the step types too unless keep_types is set */
+static void bench_fill(uint32_t seed, bool keep_types)
+{
+    uint16_t i;
+
+    bench_seed = seed;
+    for (i = 0U; i < BENCH_NUM_STEPS; i++)
+    {
+        if (!keep_types)
+        {
+            bench_step_type[i] = (XCVR_RSM_FSTEP_TYPE_T)(bench_rand() & 0x3U);
+        }
+        bench_channel[i]   = (uint16_t)(bench_rand() % 79U);
+        bench_cfo[i]       = (uint16_t)bench_rand();
+        bench_phase_add[i] = (uint16_t)(bench_rand() & 0x3U);
+        bench_hpm_cal[i]   = (uint16_t)(bench_rand() & 0x1FFFU);
+        bench_step_cfg[i]  = XCVR_LCL_MakeStepCfg(bench_step_type[i], (XCVR_RSM_T_PM_FM_SEL_T)(bench_rand() & 0x1U),
+                                                 (uint8_t)(bench_rand() % 24U), (uint8_t)(bench_rand() & 0x1U), 0U,
+                                                 (uint8_t)(bench_rand() & 0x1U));
+        bench_aa[2U * i]   = bench_rand() ^ (bench_rand() << 16);
+        bench_aa[(2U * i) + 1U] = bench_rand() ^ (bench_rand() << 16);
+    }
+    for (i = 0U; i < BENCH_MAX_PAYLOAD; i++)
+    {
+        bench_payload_init[i] = bench_rand() ^ (bench_rand() << 16);
+        bench_payload_refl[i] = bench_rand() ^ (bench_rand() << 16);
+    }
+}
+
+/* Patch later subevents into the template and compare with a full build, then check bad layouts are rejected */
+static uint32_t bench_check(const cs_subevent_template_t *template_ptr, uint32_t *num_rejects)
+{
+    uint32_t mismatches = 0U;
+    uint32_t n;
+    uint16_t step;
+
+    *num_rejects = 0U;
+    for (n = 1U; n <= BENCH_NUM_SUBEVENTS; n++)
+    {
+        bench_fill(1000U + n, true);
+        (void)memset(bench_program_image, 0, sizeof(bench_program_image));
+        if ((XCVR_LCL_ProgramFstepRam(&bench_subevent, NULLPTR, bench_program_image) != gXcvrLclStatusSuccess) ||
+            (XCVR_LCL_PatchSubeventTemplate(template_ptr, &bench_subevent) != gXcvrLclStatusSuccess) ||
+            (memcmp(bench_program_image, template_ptr->image, template_ptr->num_words * sizeof(uint32_t)) != 0))
+        {
+            mismatches++;
+        }
+    }
+
+    /* One step of another type */
+    step                  = (uint16_t)(bench_rand() % BENCH_NUM_STEPS);
+    bench_step_type[step] = (XCVR_RSM_FSTEP_TYPE_T)(((uint8_t)bench_step_type[step] + 1U) & 0x3U);
+    if (XCVR_LCL_PatchSubeventTemplate(template_ptr, &bench_subevent) == gXcvrLclStatusInvalidArgs)
+    {
+        (*num_rejects)++;
+    }
+    bench_step_type[step] = (XCVR_RSM_FSTEP_TYPE_T)(((uint8_t)bench_step_type[step] + 3U) & 0x3U);
+
+    /* One step configuration with another mode */
+    bench_step_cfg[step] ^= (uint16_t)COM_MODE_013_CFG_HDR_STEP_CFG_MODE(1U);
+    if (XCVR_LCL_PatchSubeventTemplate(template_ptr, &bench_subevent) == gXcvrLclStatusInvalidArgs)
+    {
+        (*num_rejects)++;
+    }
+    bench_step_cfg[step] ^= (uint16_t)COM_MODE_013_CFG_HDR_STEP_CFG_MODE(1U);
+
+    return mismatches;
+}
+
+static void bench_time(const cs_subevent_template_t *template_ptr, uint64_t *ns_program, uint64_t *ns_patch)
+{
+    uint32_t run;
+    uint64_t start;
+    uint64_t elapsed;
+
+    *ns_program = UINT64_MAX;
+    *ns_patch   = UINT64_MAX;
+    for (run = 0U; run < BENCH_NUM_RUNS; run++)
+    {
+        start = bench_time_ns();
+        (void)XCVR_LCL_ProgramFstepRam(&bench_subevent, NULLPTR, bench_program_image);
+        elapsed = bench_time_ns() - start;
+        if (elapsed < *ns_program)
+        {
+            *ns_program = elapsed;
+        }
+        start = bench_time_ns();
+        (void)XCVR_LCL_PatchSubeventTemplate(template_ptr, &bench_subevent);
+        elapsed = bench_time_ns() - start;
+        if (elapsed < *ns_patch)
+        {
+            *ns_patch = elapsed;
+        }
+    }
+}
+
+int main(void)
+{
+    cs_subevent_template_t template_info;
+    uint32_t failures = 0U;
+    uint32_t mismatches;
+    uint32_t num_rejects;
+    uint64_t ns_program;
+    uint64_t ns_patch;
+    uint8_t rtt;
+    uint8_t test_mode;
+
+    for (rtt = 0U; rtt < (uint8_t)XCVR_RSM_RTT_ERROR; rtt++)
+    {
+        for (test_mode = 0U; test_mode < 2U; test_mode++)
+        {
+            bench_subevent.num_steps     = BENCH_NUM_STEPS;
+            bench_subevent.rtt_type      = (XCVR_RSM_RTT_TYPE_T)rtt;
+            bench_subevent.phy_test_mode = (test_mode != 0U);
+            bench_fill(rtt + 1U, false);
+            if (XCVR_LCL_MakeSubeventTemplate(&bench_subevent, bench_template_image, BENCH_MAX_WORDS,
+                                              &template_info) != gXcvrLclStatusSuccess)
+            {
+                (void)printf("{\"rtt_type\":%u,\"phy_test_mode\":%u,\"error\":\"template\"}\n", rtt, test_mode);
+                failures++;
+                continue;
+            }
+            mismatches = bench_check(&template_info, &num_rejects);
+            bench_time(&template_info, &ns_program, &ns_patch);
+            if ((mismatches != 0U) || (num_rejects != 2U))
+            {
+                failures++;
+            }
+            (void)printf(
+                "{\"rtt_type\":%u,\"phy_test_mode\":%u,\"num_steps\":%u,\"num_words\":%u,\"mismatches\":%u,"
+                "\"rejects\":%u,\"ns_program\":%llu,\"ns_patch\":%llu}\n",
+                rtt, test_mode, template_info.num_steps, template_info.num_words, mismatches, num_rejects,
+                (unsigned long long)ns_program, (unsigned long long)ns_patch);
+        }
+    }
+
+    /* A subevent that does not fit in the image buffer */
+    if (XCVR_LCL_MakeSubeventTemplate(&bench_subevent, bench_template_image, template_info.num_words - 1U,
+                                      &template_info) != gXcvrLclStatusInvalidLength)
+    {
+        failures++;
+    }
+    (void)printf("{\"failures\":%u}\n", failures);
+
+    return (failures == 0U) ? 0 : 1;
+}
@@ -0,0 +1,338 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Host exercise of the energy detect scan (x86-64 Linux).
+ *
+ * The driver sources run on the host against a stand-in register file: the pages of the radio peripherals used by
+ * the scan are mapped at their device address. A thread simulates, at one step per microsecond:
+ *   - the TSM: a FORCE_RX_EN bit set in the TSM CTRL register starts a warmup of SIM_END_OF_RX_WU counts, with
+ *     TSM_BUSY set, and clearing it starts a warmdown of SIM_WD_COUNTS counts. The PLL CHAN_MAP channel is sampled
+ *     when the warmup starts and must not change until the warmdown is requested,
+ *   - the narrowband RSSI: once the warmup is complete, setting NB_RSSI_AA_MATCH_OVRD with NB_RSSI_AA_MATCH_OVRD_EN in
+ *     RSSI_GLOBAL_CTRL starts a measurement of SIM_RSSI_COUNTS counts, after which NB_RSSI_RES0 holds RSSI_RDY_NB and
+ *     the energy of the sampled channel. RSSI_RDY_NB is cleared by the next warmup.
+ * The tool measures the 40 BLE channels with XCVR_EdScan() and channel by channel with XCVR_OverrideChannel(),
+ * XCVR_GetInstantRssi() and XCVR_WaitRxTxWd(). It checks that each result is the energy of its channel, that no
+ * channel changed while the receiver was on, that the scan restores the registers it uses, and that a channel out of
+ * the band fails the scan before any warmup. Times are in simulated microseconds, counted by the thread.
+ *
+ * Build it on the host for one radio generation (450 or 470) against the device headers of the target:
+ *
+ *   gcc -O2 -pthread -DNXP_RADIO_GEN=470 -DRF_OSC_26MHZ=0 -I<device headers> -Idrv -Idrv/nb2p4ghz \
+ *       -Idrv/nb2p4ghz/configs/gen47 tools/xcvr_ed_scan_sim.c tools/xcvr_host_map.c \
+ *       drv/{dbg_ram_capture,mathfp,nxp_xcvr_ext_ctrl,nxp_xcvr_lcl_ctrl,nxp_xcvr_lcl_step_mgr,rfmc_ctrl}.c \
+ *       drv/nb2p4ghz/{nxp2p4_xcvr,nxp_xcvr_blob,nxp_xcvr_hop_table,nxp_xcvr_trim}.c \
+ *       drv/nb2p4ghz/configs/gen47/nxp_xcvr_*.c -lm -o xcvr_ed_scan_sim
+ *   ./xcvr_ed_scan_sim
+ *
+ * The report has one JSON object per scan method, for instance:
+ *   {"method":"XCVR_EdScan","channels":40,"errors":0,"us_per_chan":68,"min_chan_us":67,"max_chan_us":70}
+ * The exit status is non zero if any check fails.
+ */
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <sys/mman.h>
+#include <time.h>
+#include "nxp2p4_xcvr.h"
+#include "xcvr_host_map.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define SIM_END_OF_RX_WU (40U) /* TSM counts of a RX warmup */
+#define SIM_WD_COUNTS (8U)     /* TSM counts of a warmdown */
+#define SIM_RSSI_COUNTS (16U)  /* Counts of a narrowband RSSI measurement */
+#define SIM_NUM_CHANNELS (40U) /* BLE channels */
+#define SIM_BAD_CHANNEL (40U)  /* First channel out of the BLE band */
+#define SIM_SENTINEL (0xA5A5A5A5UL)
+#define SIM_NUM_PERIPHS (5U)
+#define SIM_REG(reg) (*(volatile uint32_t *)(uintptr_t)&(reg)) /* Write access to read only registers */
+
+typedef enum
+{
+    SIM_IDLE = 0,
+    SIM_WARMUP,
+    SIM_WARMDOWN
+} sim_state_t;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+static uint32_t sim_time_us(void);
+static uint32_t sim_now(void);
+static uint8_t sim_chan_map_channel(void);
+static int16_t sim_energy(uint8_t channel);
+static void *sim_radio(void *arg);
+static uint32_t sim_check(const char *method, const uint8_t *channels, const xcvr_ed_scan_t *scan);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static const host_periph_t sim_periphs[SIM_NUM_PERIPHS] = {
+    HOST_PERIPH(XCVR_TSM),
+    HOST_PERIPH(XCVR_MISC),
+    HOST_PERIPH(XCVR_PLL_DIG),
+    HOST_PERIPH(XCVR_RX_DIG),
+    HOST_PERIPH(XCVR_2P4GHZ_PHY),
+};
+static host_map_t sim_regs; /* Pages of the stand-in register file */
+
+static volatile uint32_t sim_ticks      = 0U; /* Simulated microseconds */
+static volatile uint32_t sim_warmups    = 0U; /* Warmups started */
+static volatile uint32_t sim_retunes    = 0U; /* CHAN_MAP changes while the receiver was on */
+static volatile bool sim_stop           = false;
+static uint8_t sim_channels[SIM_NUM_CHANNELS + 1U];
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+static uint32_t sim_time_us(void)
+{
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (uint32_t)(((uint64_t)now.tv_sec * 1000000ULL) + ((uint64_t)now.tv_nsec / 1000U));
+}
+
+/* Timestamp callback of the scan */
+static uint32_t sim_now(void)
+{
+    return sim_ticks;
+}
+
+static uint8_t sim_chan_map_channel(void)
+{
+    return (uint8_t)((XCVR_PLL_DIG->CHAN_MAP & XCVR_PLL_DIG_CHAN_MAP_CHANNEL_NUM_OVRD_MASK) >>
+                     XCVR_PLL_DIG_CHAN_MAP_CHANNEL_NUM_OVRD_SHIFT);
+}
+
+/* Energy of a channel in dBm, the last BLE channel is beyond the int8_t range of the scan results */
+static int16_t sim_energy(uint8_t channel)
+{
+    return (channel == (SIM_NUM_CHANNELS - 1U)) ? -150 : (int16_t)(-100 + (int16_t)((channel * 7U) % 61U));
+}
+
+static void *sim_radio(void *arg)
+{
+    sim_state_t state = SIM_IDLE;
+    uint32_t count    = 0U;
+    uint32_t rssi     = 0U; /* Counts left of the RSSI measurement in progress */
+    uint32_t end      = 0U;
+    uint32_t chan_map = 0U;
+    uint8_t channel   = 0U;
+    uint32_t forced;
+    uint32_t map;
+    uint32_t ctrl;
+    uint32_t tick;
+
+    (void)arg;
+    tick = sim_time_us();
+    while (!sim_stop)
+    {
+        /* One step per microsecond at most */
+        while (sim_time_us() == tick)
+        {
+        }
+        tick = sim_time_us();
+        sim_ticks++;
+
+        /* The map is sampled first, a write right after the receiver is released is not a retune */
+        map    = XCVR_PLL_DIG->CHAN_MAP;
+        forced = XCVR_TSM->CTRL & XCVR_TSM_CTRL_FORCE_RX_EN_MASK;
+        switch (state)
+        {
+            case SIM_IDLE:
+                if (forced != 0U)
+                {
+                    chan_map = XCVR_PLL_DIG->CHAN_MAP;
+                    channel  = sim_chan_map_channel();
+                    SIM_REG(XCVR_RX_DIG->NB_RSSI_RES0) = 0U;
+                    count                              = 0U;
+                    end                                = SIM_END_OF_RX_WU;
+                    rssi                               = 0U;
+                    sim_warmups++;
+                    state = SIM_WARMUP;
+                }
+                break;
+            case SIM_WARMUP:
+                sim_retunes += ((forced != 0U) && (map != chan_map)) ? 1U : 0U;
+                chan_map = map;
+                ctrl     = XCVR_RX_DIG->RSSI_GLOBAL_CTRL;
+                if (forced == 0U)
+                {
+                    end   = count + SIM_WD_COUNTS;
+                    state = SIM_WARMDOWN;
+                }
+                else if (count < end)
+                {
+                    count++;
+                }
+                else if (rssi > 0U)
+                {
+                    rssi--;
+                    if (rssi == 0U)
+                    {
+                        SIM_REG(XCVR_RX_DIG->NB_RSSI_RES0) =
+                            XCVR_RX_DIG_NB_RSSI_RES0_RSSI_RDY_NB_MASK |
+                            (((uint32_t)(int32_t)sim_energy(channel) << XCVR_RX_DIG_NB_RSSI_RES0_RSSI_NB_SHIFT) &
+                             XCVR_RX_DIG_NB_RSSI_RES0_RSSI_NB_MASK);
+                    }
+                }
+                else if (((ctrl & XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_RSSI_AA_MATCH_OVRD_EN_MASK) != 0U) &&
+                         ((ctrl & XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_RSSI_AA_MATCH_OVRD_MASK) != 0U) &&
+                         ((XCVR_RX_DIG->NB_RSSI_RES0 & XCVR_RX_DIG_NB_RSSI_RES0_RSSI_RDY_NB_MASK) == 0U))
+                {
+                    rssi = SIM_RSSI_COUNTS;
+                }
+                else
+                {
+                    /* Receiver on, no measurement */
+                }
+                break;
+            case SIM_WARMDOWN:
+            default:
+                count++;
+                if (count == end)
+                {
+                    count = 0U;
+                    state = SIM_IDLE;
+                }
+                break;
+        }
+
+        SIM_REG(XCVR_MISC->XCVR_STATUS) =
+            ((count << XCVR_MISC_XCVR_STATUS_TSM_COUNT_SHIFT) & XCVR_MISC_XCVR_STATUS_TSM_COUNT_MASK) |
+            ((state != SIM_IDLE) ? XCVR_MISC_XCVR_STATUS_TSM_BUSY_MASK : 0U);
+    }
+
+    return NULL;
+}
+
+static uint32_t sim_check(const char *method, const uint8_t *channels, const xcvr_ed_scan_t *scan)
+{
+    uint32_t errors = 0U;
+    uint32_t total  = 0U;
+    uint32_t min    = 0xFFFFFFFFU;
+    uint32_t max    = 0U;
+    int16_t expected;
+
+    for (uint32_t i = 0U; i < scan->num_channels; i++)
+    {
+        expected = sim_energy(channels[i]);
+        expected = (expected < -128) ? -128 : expected;
+        if (scan->ed_dbm[i] != expected)
+        {
+            (void)fprintf(stderr, "%s: channel %u measured %d dBm instead of %d dBm\n", method,
+                          (unsigned int)channels[i], (int)scan->ed_dbm[i], (int)expected);
+            errors++;
+        }
+        /* A channel takes at least its warmup, measurement and warmdown */
+        if (scan->chan_time[i] < (SIM_END_OF_RX_WU + SIM_RSSI_COUNTS + SIM_WD_COUNTS))
+        {
+            (void)fprintf(stderr, "%s: channel %u took %u us only\n", method, (unsigned int)channels[i],
+                          (unsigned int)scan->chan_time[i]);
+            errors++;
+        }
+        total += scan->chan_time[i];
+        min = (scan->chan_time[i] < min) ? scan->chan_time[i] : min;
+        max = (scan->chan_time[i] > max) ? scan->chan_time[i] : max;
+    }
+
+    (void)printf(
+        "{\"method\":\"%s\",\"channels\":%u,\"errors\":%u,\"us_per_chan\":%u,\"min_chan_us\":%u,\"max_chan_us\":%u}\n",
+        method, (unsigned int)scan->num_channels, (unsigned int)errors, (unsigned int)(total / scan->num_channels),
+        (unsigned int)min, (unsigned int)max);
+
+    return errors;
+}
+
+int main(void)
+{
+    pthread_t radio_thread;
+    xcvr_ed_scan_t scan;
+    xcvr_ed_scan_t reference;
+    uint32_t errors = 0U;
+    uint32_t start;
+    uint32_t warmups;
+    int16_t rssi;
+
+    if ((host_map(&sim_regs, sim_periphs, SIM_NUM_PERIPHS, PROT_READ | PROT_WRITE) != 0) ||
+        (pthread_create(&radio_thread, NULL, sim_radio, NULL) != 0))
+    {
+        return 1;
+    }
+    XCVR_TSM->END_OF_SEQ = XCVR_TSM_END_OF_SEQ_END_OF_RX_WU(SIM_END_OF_RX_WU);
+    for (uint32_t i = 0U; i <= SIM_NUM_CHANNELS; i++)
+    {
+        sim_channels[i] = (uint8_t)i;
+    }
+
+    /* Channel by channel reference */
+    for (uint32_t i = 0U; i < SIM_NUM_CHANNELS; i++)
+    {
+        start = sim_now();
+        errors += (XCVR_OverrideChannel(sim_channels[i]) != gXcvrSuccess_c) ? 1U : 0U;
+        rssi                = XCVR_GetInstantRssi();
+        reference.ed_dbm[i] = (int8_t)((rssi < -128) ? -128 : rssi);
+        XCVR_WaitRxTxWd();
+        reference.chan_time[i] = (uint16_t)(sim_now() - start);
+    }
+    reference.num_channels = SIM_NUM_CHANNELS;
+    XCVR_ReleasePLLOverride();
+
+    /* Scan, the registers it uses hold sentinels that must be restored */
+    XCVR_2P4GHZ_PHY->FSK_CFG0    = SIM_SENTINEL;
+    XCVR_2P4GHZ_PHY->FSK_PD_CFG2 = SIM_SENTINEL;
+    XCVR_RX_DIG->RSSI_GLOBAL_CTRL &= ~(XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_RSSI_AA_MATCH_OVRD_MASK |
+                                       XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_RSSI_AA_MATCH_OVRD_EN_MASK |
+                                       XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_CONT_MEAS_OVRD_EN_MASK |
+                                       XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_CONT_MEAS_OVRD_MASK);
+    XCVR_PLL_DIG->CHAN_MAP = 0U;
+    sim_retunes            = 0U;
+    errors += (XCVR_EdScan(sim_channels, SIM_NUM_CHANNELS, sim_now, &scan) != gXcvrSuccess_c) ? 1U : 0U;
+    if ((XCVR_2P4GHZ_PHY->FSK_CFG0 != SIM_SENTINEL) || (XCVR_2P4GHZ_PHY->FSK_PD_CFG2 != SIM_SENTINEL) ||
+        ((XCVR_RX_DIG->RSSI_GLOBAL_CTRL & (XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_RSSI_AA_MATCH_OVRD_MASK |
+                                           XCVR_RX_DIG_RSSI_GLOBAL_CTRL_NB_RSSI_AA_MATCH_OVRD_EN_MASK)) != 0U) ||
+        (XCVR_PLL_DIG->CHAN_MAP != 0U))
+    {
+        (void)fprintf(stderr, "XCVR_EdScan: registers not restored\n");
+        errors++;
+    }
+    if (sim_retunes != 0U)
+    {
+        (void)fprintf(stderr, "XCVR_EdScan: %u channel changes while the receiver was on\n",
+                      (unsigned int)sim_retunes);
+        errors++;
+    }
+    if (scan.total_time < scan.chan_time[0] * SIM_NUM_CHANNELS / 2U)
+    {
+        (void)fprintf(stderr, "XCVR_EdScan: total time %u us too short\n", (unsigned int)scan.total_time);
+        errors++;
+    }
+
+    errors += sim_check("channel_by_channel", sim_channels, &reference);
+    errors += sim_check("XCVR_EdScan", sim_channels, &scan);
+
+    /* A channel out of the band fails the whole scan before any warmup */
+    warmups = sim_warmups;
+    if ((XCVR_EdScan(&sim_channels[1], SIM_NUM_CHANNELS, sim_now, &scan) != gXcvrInvalidParameters_c) ||
+        (XCVR_EdScan(sim_channels, 0U, sim_now, &scan) != gXcvrInvalidParameters_c) ||
+        (XCVR_EdScan(sim_channels, SIM_NUM_CHANNELS, sim_now, NULLPTR) != gXcvrInvalidParameters_c) ||
+        (sim_warmups != warmups) || (sim_channels[SIM_NUM_CHANNELS] != SIM_BAD_CHANNEL))
+    {
+        (void)fprintf(stderr, "XCVR_EdScan: invalid parameters not rejected\n");
+        errors++;
+    }
+
+    sim_stop = true;
+    (void)pthread_join(radio_thread, NULL);
+
+    return (errors == 0U) ? 0 : 1;
+}
@@ -0,0 +1,142 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Host generator for the PLL hop table.
+ *
+ * For every frequency from XCVR_HOP_TABLE_MIN_FREQ_HZ up to 2487 MHz in XCVR_HOP_TABLE_STEP_HZ steps this tool
+ * computes the Low Port integer, numerator and coarse tune target that XCVR_OverrideTxFrequency() programs, for both
+ * the 26 MHz and the 32 MHz reference oscillator, and emits them as one const xcvr_pll_hop_entry_t table per reference
+ * selected by RF_OSC_26MHZ. XCVR_HopToIndex() then only has to index the table.
+ *
+ * The values only depend on the reference oscillator, so the tool needs no device headers:
+ *
+ *   gcc tools/xcvr_hop_table_gen.c -lm -o xcvr_hop_table_gen
+ *   ./xcvr_hop_table_gen drv/nb2p4ghz
+ *
+ * The generated nxp_xcvr_hop_table.c must be regenerated whenever the hop table range, step or denominator changes.
+ */
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define GEN_FILE_NAME "nxp_xcvr_hop_table"
+#define GEN_PATH_MAX  (512U)
+
+/* Must match the XCVR_HOP_TABLE_* definitions of nxp2p4_xcvr.h */
+#define GEN_MIN_FREQ_HZ (2360000000UL)
+#define GEN_STEP_HZ     (500000UL)
+#define GEN_NUM_ENTRIES (255U)
+#define GEN_DENOM       (0x08000000UL - 1UL)
+
+typedef struct
+{
+    uint32_t numerator;
+    uint16_t ctune_target;
+    uint8_t intpart;
+} gen_entry_t;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+static void gen_entry(uint32_t ref_osc, uint32_t freq, gen_entry_t *entry);
+static void gen_write_table(FILE *out, uint32_t ref_osc);
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+/* Low Port settings of one frequency, computed as the floating point reference of XCVR_OverrideTxFrequency() did */
+static void gen_entry(uint32_t ref_osc, uint32_t freq, gen_entry_t *entry)
+{
+    const double sdm_lsb         = (double)ref_osc / (((double)GEN_DENOM) / 2.0F);
+    double real_int_and_fraction = (double)freq / ((double)ref_osc * 2.0F);
+    uint32_t integer_to_use      = (uint32_t)trunc(real_int_and_fraction);
+    double integer_in_lsb;
+    double requested_in_lsb;
+
+    if ((real_int_and_fraction - (double)integer_to_use) > 0.5F)
+    {
+        integer_to_use++;
+    }
+
+    integer_in_lsb   = ((double)integer_to_use * (double)ref_osc * 2.0F) / sdm_lsb;
+    requested_in_lsb = integer_in_lsb + ((((real_int_and_fraction - (double)integer_to_use) * (double)ref_osc * 2.0F)) /
+                                         sdm_lsb);
+
+    entry->intpart      = (uint8_t)integer_to_use;
+    entry->numerator    = (uint32_t)(int32_t)round(requested_in_lsb - integer_in_lsb);
+    entry->ctune_target = (uint16_t)(freq / 1000000UL);
+}
+
+static void gen_write_table(FILE *out, uint32_t ref_osc)
+{
+    gen_entry_t entry;
+    uint32_t freq;
+    uint32_t i;
+
+    for (i = 0U; i < GEN_NUM_ENTRIES; i++)
+    {
+        freq = GEN_MIN_FREQ_HZ + (i * GEN_STEP_HZ);
+        gen_entry(ref_osc, freq, &entry);
+        (void)fprintf(out, "    {0x%08XU, %uU, %uU}, /* %u.%u MHz */\n", entry.numerator, entry.ctune_target,
+                      entry.intpart, (unsigned int)(freq / 1000000UL), (unsigned int)((freq % 1000000UL) / 100000UL));
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    char path[GEN_PATH_MAX];
+    FILE *out;
+    int status = 0;
+
+    if (argc != 2)
+    {
+        (void)fprintf(stderr, "usage: %s <output folder>\n", argv[0]);
+        status = 1;
+    }
+    else
+    {
+        (void)snprintf(path, sizeof(path), "%s/" GEN_FILE_NAME ".c", argv[1]);
+        out = fopen(path, "w");
+        if (out == NULL)
+        {
+            (void)fprintf(stderr, "cannot open %s\n", path);
+            status = 1;
+        }
+        else
+        {
+            (void)fprintf(out,
+                          "/*\n * Copyright 2024 NXP\n *\n * SPDX-License-Identifier: BSD-3-Clause\n */\n\n"
+                          "/* Generated by tools/xcvr_hop_table_gen.c, do not edit */\n\n"
+                          "#include \"" GEN_FILE_NAME ".h\"\n\n"
+                          "/*******************************************************************************\n"
+                          " * Definitions\n"
+                          " ******************************************************************************/\n"
+                          "#if (XCVR_HOP_TABLE_MIN_FREQ_HZ != %luUL) || (XCVR_HOP_TABLE_STEP_HZ != %luUL) || \\\n"
+                          "    (XCVR_HOP_TABLE_NUM_ENTRIES != %uU) || (XCVR_HOP_TABLE_DENOM != 0x%08lXUL)\n"
+                          "#error \"Hop table generated for another range, step or denominator\"\n"
+                          "#endif\n\n"
+                          "/*******************************************************************************\n"
+                          " * Variables\n"
+                          " ******************************************************************************/\n"
+                          "/* {numerator, ctune_target, intpart} */\n"
+                          "const xcvr_pll_hop_entry_t xcvr_pll_hop_table[XCVR_HOP_TABLE_NUM_ENTRIES] = {\n"
+                          "#if RF_OSC_26MHZ == 1\n",
+                          GEN_MIN_FREQ_HZ, GEN_STEP_HZ, GEN_NUM_ENTRIES, GEN_DENOM);
+            gen_write_table(out, 26000000UL);
+            (void)fprintf(out, "#else\n");
+            gen_write_table(out, 32000000UL);
+            (void)fprintf(out, "#endif /* RF_OSC_26MHZ == 1 */\n};\n");
+            (void)fclose(out);
+        }
+    }
+
+    return status;
+}
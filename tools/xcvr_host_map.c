@@ -0,0 +1,85 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include "xcvr_host_map.h"
+
+#if !defined(__linux__)
+#error "The register file stand-in relies on Linux fixed address mappings"
+#endif
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+int host_map(host_map_t *map, const host_periph_t *periphs, uint32_t num_periphs, int prot)
+{
+    uint32_t i;
+    uintptr_t page;
+    void *mapped;
+    int status = 0;
+
+    map->page_size = (uintptr_t)sysconf(_SC_PAGESIZE);
+    map->num_pages = 0U;
+    for (i = 0U; (i < num_periphs) && (status == 0); i++)
+    {
+        page = periphs[i].base & ~(map->page_size - 1U);
+        while ((page < (periphs[i].base + periphs[i].size)) && (status == 0))
+        {
+            if (!host_map_has_page(map, page))
+            {
+                mapped = (map->num_pages < HOST_MAX_PAGES) ?
+                             mmap((void *)page, map->page_size, prot,
+                                  MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0) :
+                             MAP_FAILED;
+                if (mapped != (void *)page)
+                {
+                    /* An older kernel ignores MAP_FIXED_NOREPLACE and may map the page elsewhere */
+                    if (mapped != MAP_FAILED)
+                    {
+                        (void)munmap(mapped, map->page_size);
+                    }
+                    (void)fprintf(stderr, "%s: cannot map 0x%lx on the host\n", periphs[i].name,
+                                  (unsigned long)page);
+                    status = 1;
+                }
+                else
+                {
+                    map->pages[map->num_pages] = page;
+                    map->num_pages++;
+                }
+            }
+            page += map->page_size;
+        }
+    }
+
+    return status;
+}
+
+bool host_map_has_page(const host_map_t *map, uintptr_t page)
+{
+    uint32_t i;
+    bool found = false;
+
+    for (i = 0U; (i < map->num_pages) && !found; i++)
+    {
+        found = (map->pages[i] == page);
+    }
+
+    return found;
+}
+
+void host_map_protect(const host_map_t *map, int prot)
+{
+    uint32_t i;
+
+    for (i = 0U; i < map->num_pages; i++)
+    {
+        (void)mprotect((void *)map->pages[i], map->page_size, prot);
+    }
+}
@@ -0,0 +1,80 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Stand-in register file of the host tools (x86-64 Linux): the pages of the radio peripherals of the device headers
+ * are backed by anonymous host memory mapped at their device address, so that the driver sources run unchanged.
+ * Built with each host tool that accesses registers, see tools/CMakeLists.txt.
+ */
+
+#ifndef XCVR_HOST_MAP_H
+/* clang-format off */
+#define XCVR_HOST_MAP_H
+/* clang-format on */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define HOST_MAX_PAGES (512U) /* Pages of a stand-in register file */
+
+/* Peripheral of the stand-in, as the driver addresses it. Aliases of one peripheral share its pages. */
+#define HOST_PERIPH(p) {#p, (uintptr_t)(p), sizeof(*(p))}
+
+/*! @brief Register block of a peripheral */
+typedef struct
+{
+    const char *name;
+    uintptr_t base;
+    size_t size;
+} host_periph_t;
+
+/*! @brief Pages of a stand-in register file, each mapped once */
+typedef struct
+{
+    uintptr_t page_size;
+    uintptr_t pages[HOST_MAX_PAGES];
+    uint32_t num_pages;
+} host_map_t;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+/*!
+ * @brief Maps the pages of the peripherals at their device address.
+ *
+ * The pages are zero filled and mapped with the prot access rights, a page shared by several peripherals is mapped
+ * once. A page that cannot be mapped at its device address is reported on stderr.
+ *
+ * @param[out] map  Pointer to the pages of the register file.
+ * @param[in] periphs  Pointer to the peripherals.
+ * @param[in] num_periphs  Number of peripherals.
+ * @param[in] prot  Access rights of the pages, PROT_READ | PROT_WRITE or PROT_NONE to trap every access.
+ * @return 0 on success, 1 if a page cannot be mapped.
+ */
+int host_map(host_map_t *map, const host_periph_t *periphs, uint32_t num_periphs, int prot);
+
+/*!
+ * @brief Checks whether a page belongs to the register file, safe in a signal handler.
+ *
+ * @param[in] map  Pointer to the pages of the register file.
+ * @param[in] page  Page address.
+ * @return true if the page is mapped by ::host_map().
+ */
+bool host_map_has_page(const host_map_t *map, uintptr_t page);
+
+/*!
+ * @brief Changes the access rights of every page of the register file.
+ *
+ * @param[in] map  Pointer to the pages of the register file.
+ * @param[in] prot  Access rights of the pages.
+ */
+void host_map_protect(const host_map_t *map, int prot);
+
+#endif /* XCVR_HOST_MAP_H */
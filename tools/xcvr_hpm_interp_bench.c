@@ -0,0 +1,210 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Host benchmark of the HPM CAL interpolation.
+ *
+ * For a few synthetic device profiles, whose HPM_CAL_FACTOR follows the Fref^3 / freq^3 law with a linear and a
+ * quadratic deviation across the band, this tool compares the error over the 79 HADM channels of:
+ *   - XCVR_LCL_InterpolatePllCal(), scaling the 2442MHz calibration with the Q7 table,
+ *   - XCVR_LCL_InterpolatePllCalModel() on models built by XCVR_LCL_HpmCalBuildModel() from 1, 3 and 5 anchors.
+ * The anchors are the rounded factors of the profile, as a calibration would read them. The interpolation does not
+ * access the radio registers, so the driver runs on the host as is, and the time per channel of each method is
+ * measured too.
+ *
+ * Build it on the host for one radio generation against the device headers of the target:
+ *
+ *   gcc -O2 -DNXP_RADIO_GEN=470 -DRF_OSC_26MHZ=0 -I<device headers> -Idrv -Idrv/nb2p4ghz \
+ *       -Idrv/nb2p4ghz/configs/gen47 tools/xcvr_hpm_interp_bench.c \
+ *       drv/{dbg_ram_capture,mathfp,nxp_xcvr_ext_ctrl,nxp_xcvr_lcl_ctrl,nxp_xcvr_lcl_step_mgr,rfmc_ctrl}.c \
+ *       drv/nb2p4ghz/{nxp2p4_xcvr,nxp_xcvr_blob,nxp_xcvr_hop_table,nxp_xcvr_trim}.c \
+ *       drv/nb2p4ghz/configs/gen47/nxp_xcvr_*.c -lm -o xcvr_hpm_interp_bench
+ *   ./xcvr_hpm_interp_bench
+ *
+ * The report has one JSON object per profile and method, errors are in HPM_CAL_FACTOR LSB, for instance:
+ *   {"profile":"tilt","method":"model_3","anchors":3,"max_err":1,"mean_err_milli":310,"ns_per_chan":3}
+ * The exit status is non zero if a model is not exact at its anchors, or if the 3 anchor model has a larger maximum
+ * error than the Q7 table on any profile.
+ */
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "nxp2p4_xcvr.h"
+#include "nxp_xcvr_lcl_ctrl.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define BENCH_NUM_CHANS (RSM_HADM_MAX_CHAN_INDEX + 1U)
+#define BENCH_FACTOR_2442 (2000.0) /* HPM_CAL_FACTOR at 2442MHz of every profile */
+#define BENCH_TIMING_RUNS (20000U) /* Interpolations of the whole band per time measurement */
+#define BENCH_NUM_METHODS (4U)
+
+typedef struct
+{
+    const char *name;
+    double tilt; /* Relative deviation at the band edges, opposite signs */
+    double bow;  /* Relative deviation at both band edges */
+} bench_profile_t;
+
+typedef struct
+{
+    const char *name;
+    uint8_t num_anchors; /* 0 for the Q7 table */
+    uint16_t anchors[5];
+} bench_method_t;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+static double bench_true_factor(const bench_profile_t *profile, uint16_t chan);
+static xcvrLclStatus_t bench_interpolate(const bench_method_t *method, const xcvr_lcl_hpm_cal_model_t *model);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static const bench_profile_t bench_profiles[] = {
+    {"ideal", 0.0, 0.0},
+    {"tilt", 0.02, 0.0},
+    {"bow", 0.0, 0.015},
+    {"mixed", -0.015, 0.01},
+};
+
+static const bench_method_t bench_methods[BENCH_NUM_METHODS] = {
+    {"table_q7", 0U, {0U}},
+    {"model_1", 1U, {40U}},
+    {"model_3", 3U, {0U, 40U, 78U}},
+    {"model_5", 5U, {0U, 20U, 40U, 58U, 78U}},
+};
+
+static uint16_t bench_chans[BENCH_NUM_CHANS];
+static xcvr_lcl_pll_cal_data_t bench_results[BENCH_NUM_CHANS];
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+static double bench_true_factor(const bench_profile_t *profile, uint16_t chan)
+{
+    double freq = (double)(BLE_MIN_FREQ + chan);
+    double x    = (freq - 2442.0) / 40.0; /* -1 to 1 across the band */
+
+    return BENCH_FACTOR_2442 * pow(2442.0 / freq, 3.0) * (1.0 + (profile->tilt * x) + (profile->bow * x * x));
+}
+
+static xcvrLclStatus_t bench_interpolate(const bench_method_t *method, const xcvr_lcl_hpm_cal_model_t *model)
+{
+    xcvrLclStatus_t status;
+
+    if (method->num_anchors == 0U)
+    {
+        status = XCVR_LCL_InterpolatePllCal(bench_chans, bench_results, BENCH_NUM_CHANS, &hpm_cal_2442_data);
+    }
+    else
+    {
+        status = XCVR_LCL_InterpolatePllCalModel(bench_chans, bench_results, BENCH_NUM_CHANS, model);
+    }
+
+    return status;
+}
+
+int main(void)
+{
+    const bench_profile_t *profile;
+    const bench_method_t *method;
+    xcvr_lcl_hpm_cal_model_t model;
+    xcvr_lcl_pll_cal_data_t anchor_results[5];
+    xcvrLclStatus_t status = gXcvrLclStatusSuccess;
+    struct timespec start;
+    struct timespec end;
+    uint64_t elapsed;
+    uint32_t max_err[BENCH_NUM_METHODS];
+    uint64_t sum_err;
+    uint32_t err;
+    uint32_t p;
+    uint32_t m;
+    uint32_t i;
+    bool bad = false;
+
+    for (i = 0U; i < BENCH_NUM_CHANS; i++)
+    {
+        bench_chans[i] = (uint16_t)i;
+    }
+
+    for (p = 0U; (p < (sizeof(bench_profiles) / sizeof(bench_profiles[0]))) && (status == gXcvrLclStatusSuccess); p++)
+    {
+        profile = &bench_profiles[p];
+        hpm_cal_2442_data.hpm_cal_factor_2442 = (uint16_t)lround(bench_true_factor(profile, 40U));
+
+        for (m = 0U; (m < BENCH_NUM_METHODS) && (status == gXcvrLclStatusSuccess); m++)
+        {
+            method = &bench_methods[m];
+            for (i = 0U; i < method->num_anchors; i++)
+            {
+                anchor_results[i].hpm_cal_val = (uint16_t)lround(bench_true_factor(profile, method->anchors[i]));
+            }
+            if (method->num_anchors > 0U)
+            {
+                status = XCVR_LCL_HpmCalBuildModel(method->anchors, anchor_results, method->num_anchors, &model);
+            }
+
+            if (status == gXcvrLclStatusSuccess)
+            {
+                (void)clock_gettime(CLOCK_MONOTONIC, &start);
+                for (i = 0U; (i < BENCH_TIMING_RUNS) && (status == gXcvrLclStatusSuccess); i++)
+                {
+                    status = bench_interpolate(method, &model);
+                }
+                (void)clock_gettime(CLOCK_MONOTONIC, &end);
+                elapsed = ((uint64_t)(end.tv_sec - start.tv_sec) * 1000000000ULL) + (uint64_t)end.tv_nsec -
+                          (uint64_t)start.tv_nsec;
+            }
+
+            if (status == gXcvrLclStatusSuccess)
+            {
+                max_err[m] = 0U;
+                sum_err    = 0U;
+                for (i = 0U; i < BENCH_NUM_CHANS; i++)
+                {
+                    err = (uint32_t)labs(lround(bench_true_factor(profile, (uint16_t)i)) -
+                                         (long)bench_results[i].hpm_cal_val);
+                    max_err[m] = (err > max_err[m]) ? err : max_err[m];
+                    sum_err += err;
+                }
+                for (i = 0U; i < method->num_anchors; i++)
+                {
+                    if (bench_results[method->anchors[i]].hpm_cal_val != anchor_results[i].hpm_cal_val)
+                    {
+                        (void)fprintf(stderr, "%s: %s not exact at channel %u\n", profile->name, method->name,
+                                      (unsigned int)method->anchors[i]);
+                        bad = true;
+                    }
+                }
+                (void)printf(
+                    "{\"profile\":\"%s\",\"method\":\"%s\",\"anchors\":%u,\"max_err\":%u,\"mean_err_milli\":%llu,"
+                    "\"ns_per_chan\":%llu}\n",
+                    profile->name, method->name, (unsigned int)((method->num_anchors == 0U) ? 1U : method->num_anchors),
+                    (unsigned int)max_err[m], (unsigned long long)((sum_err * 1000U) / BENCH_NUM_CHANS),
+                    (unsigned long long)(elapsed / ((uint64_t)BENCH_TIMING_RUNS * BENCH_NUM_CHANS)));
+            }
+        }
+
+        if ((status == gXcvrLclStatusSuccess) && (max_err[2] > max_err[0]))
+        {
+            (void)fprintf(stderr, "%s: the 3 anchor model is worse than the Q7 table\n", profile->name);
+            bad = true;
+        }
+    }
+
+    if (status != gXcvrLclStatusSuccess)
+    {
+        (void)fprintf(stderr, "HPM CAL interpolation failed with %d\n", (int)status);
+    }
+
+    return ((status != gXcvrLclStatusSuccess) || bad) ? 1 : 0;
+}
@@ -0,0 +1,583 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Host exercise of the RSM step manager circular buffers (x86-64 Linux, KW47 and later with a 32MHz RF_OSC).
+ *
+ * The step manager sources run on the host against a stand-in register file: the XCVR_MISC page and both packet RAMs
+ * are mapped at their device address. A simple RSM model executes the steps between step interrupts: it reads each
+ * configuration from the config buffer at its own read index, checks it against the sequence in system RAM, and
+ * writes one result (two in sniffer mode) of the size XCVR_LCL_CalcConfigResult_Size() gives for the step into the
+ * result buffer. Both indexes roll over with the rule of the step manager, a step never straddles the end of a buffer.
+ *
+ * Each scenario is run with the driver (XCVR_LCL_SetupInitialConfigs() then XCVR_LCL_HandleIrqStepEos() on every
+ * step interrupt) and with a reference copy of the former word by word transfer. The RSM_CONFIG_PTR and
+ * RSM_RESULT_PTR registers and the content of the config buffer must match after every interrupt, and the results
+ * gathered in system RAM must be the ones the RSM model wrote. The time spent in the interrupt handler is measured
+ * too, as the minimum over SIM_TIMING_RUNS runs.
+ *
+ * The timing is a host figure only. The reference accesses the packet RAM as plain memory, which the compiler may
+ * merge into wider accesses, while the driver makes the 32 bit accesses the packet RAM needs. The run copy of the
+ * driver comes out ahead on batches of several steps and behind with one step per interrupt (tones_irq1), where the
+ * bookkeeping of the runs is not paid back.
+ *
+ * Build it on the host against the device headers of the target:
+ *
+ *   gcc -O2 -DNXP_RADIO_GEN=470 -DRF_OSC_26MHZ=0 -I<device headers> -Idrv -Idrv/nb2p4ghz \
+ *       -Idrv/nb2p4ghz/configs/gen47 tools/xcvr_lcl_ring_sim.c tools/xcvr_host_map.c \
+ *       drv/{dbg_ram_capture,mathfp,nxp_xcvr_ext_ctrl,nxp_xcvr_lcl_ctrl,nxp_xcvr_lcl_step_mgr,rfmc_ctrl}.c \
+ *       drv/nb2p4ghz/{nxp2p4_xcvr,nxp_xcvr_blob,nxp_xcvr_hop_table,nxp_xcvr_trim}.c \
+ *       drv/nb2p4ghz/configs/gen47/nxp_xcvr_*.c -lm -o xcvr_lcl_ring_sim
+ *   ./xcvr_lcl_ring_sim
+ *
+ * The report has one JSON object per scenario and transfer, for instance:
+ *   {"scenario":"mixed_ap4","method":"burst","steps":160,"irqs":20,"cfg_wraps":5,"res_wraps":6,"errors":0,
+ *    "ns_per_irq":99}
+ * The exit status is non zero if any check fails.
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <sys/mman.h>
+#include <time.h>
+#include "nxp_xcvr_lcl_step_mgr.h"
+#include "xcvr_host_map.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define SIM_MAX_STEPS (255U)
+#define SIM_MAX_WORDS (SIM_MAX_STEPS * 2U * 16U) /* Largest sequence of configs or results, in words */
+#define SIM_MAX_IRQS (SIM_MAX_STEPS + 2U)
+#define SIM_TIMING_RUNS (200U)
+#define SIM_FILL (0xDEADBEEFUL) /* Packet RAM content before a run */
+#define SIM_NUM_PERIPHS (3U)
+
+typedef enum
+{
+    SIM_BURST = 0, /* XCVR_LCL_HandleIrqStepEos() */
+    SIM_WORD,      /* Reference word by word transfer */
+    SIM_NUM_METHODS
+} sim_method_t;
+
+typedef struct
+{
+    const char *name;
+    XCVR_RSM_RTT_TYPE_T rtt_type;
+    uint8_t num_ap;
+    bool sniffer;
+    uint8_t num_steps;
+    uint8_t irq_step_count;
+    uint16_t config_base;
+    uint16_t config_depth;
+    uint16_t result_base;
+    uint16_t result_depth;
+    PKT_RAM_BANK_SEL_T config_bank;
+    PKT_RAM_BANK_SEL_T result_bank;
+    uint8_t mode_mask; /* Step modes drawn from the pseudo random sequence are masked with it */
+} sim_scenario_t;
+
+/* Register and buffer state after one step interrupt */
+typedef struct
+{
+    uint32_t config_ptr;
+    uint32_t result_ptr;
+    uint32_t config_sum;
+} sim_snapshot_t;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+static uint64_t sim_time_ns(void);
+static uint32_t sim_result_word(uint8_t step, uint8_t copy, uint8_t word, uint8_t length);
+static void sim_build(const sim_scenario_t *scenario);
+static uint32_t *sim_pkt_ram(PKT_RAM_BANK_SEL_T bank);
+static uint32_t sim_rsm_execute(const sim_scenario_t *scenario, uint8_t num_steps);
+static uint32_t sim_config_sum(const sim_scenario_t *scenario);
+static void ref_setup(const sim_scenario_t *scenario);
+static void ref_load_config_steps(uint32_t **current_cfg_ptr);
+static void ref_read_result_steps(uint32_t **current_res_ptr);
+static uint32_t sim_run(const sim_scenario_t *scenario, sim_method_t method, uint64_t *irq_ns, uint32_t *num_irqs);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static const sim_scenario_t sim_scenarios[] = {
+    {"mixed_ap4", XCVR_RSM_RTT_128BIT_RANDOM, 4U, false, 160U, 8U, 0U, 230U, 0U, 160U, TX_PKT_RAM_SEL, RX_PKT_RAM_SEL,
+     0x3U},
+    {"mixed_sniffer", XCVR_RSM_RTT_32BIT_SOUNDING, 2U, true, 150U, 6U, 40U, 100U, 300U, 200U, RX_PKT_RAM_SEL,
+     RX_PKT_RAM_SEL, 0x3U},
+    {"mode3_exact_fill", XCVR_RSM_RTT_64BIT_RANDOM, 1U, false, 120U, 4U, 16U, 99U, 200U, 98U, TX_PKT_RAM_SEL,
+     TX_PKT_RAM_SEL, 0x3U},
+    {"tones_irq1", XCVR_RSM_RTT_NO_PAYLOAD, 4U, false, 90U, 1U, 0U, 40U, 0U, 50U, TX_PKT_RAM_SEL, RX_PKT_RAM_SEL,
+     0x2U},
+    {"tones_irq16", XCVR_RSM_RTT_96BIT_RANDOM, 3U, false, 255U, 16U, 100U, 300U, 0U, 400U, RX_PKT_RAM_SEL,
+     TX_PKT_RAM_SEL, 0x2U},
+};
+
+static const host_periph_t sim_periphs[SIM_NUM_PERIPHS] = {
+    HOST_PERIPH(XCVR_MISC),
+    {"TX_PACKET_RAM", (uintptr_t)TX_PACKET_RAM_BASE, TX_PACKET_RAM_PACKET_RAM_COUNT * sizeof(uint32_t)},
+    {"RX_PACKET_RAM", (uintptr_t)RX_PACKET_RAM_BASE, RX_PACKET_RAM_PACKET_RAM_COUNT * sizeof(uint32_t)},
+};
+static host_map_t sim_regs; /* Pages of the stand-in register file */
+
+static uint32_t sim_configs[SIM_MAX_WORDS];
+static uint32_t sim_config_offsets[SIM_MAX_STEPS];
+static uint32_t sim_expected[SIM_MAX_WORDS];
+static uint32_t sim_results[SIM_MAX_WORDS];
+static uint8_t sim_modes[SIM_MAX_STEPS];
+static uint8_t sim_cfg_len[4];
+static uint8_t sim_res_len[4]; /* One result, not doubled in sniffer mode */
+static uint32_t sim_expected_words;
+static sim_snapshot_t sim_snapshots[SIM_MAX_IRQS];
+
+/* RSM model */
+static uint16_t rsm_config_index;
+static uint16_t rsm_result_index;
+static uint8_t rsm_step;
+static uint32_t rsm_cfg_wraps;
+static uint32_t rsm_res_wraps;
+
+/* Reference transfer, the former step manager loops on their own copy of its state */
+static uint8_t ref_step_irq_count;
+static uint8_t ref_remaining_configs_to_load;
+static uint8_t ref_remaining_results_to_read;
+static uint8_t ref_cfg_step_length_words[4];
+static uint8_t ref_res_step_length_words[4];
+static uint32_t *ref_config_pkt_ram_buffer;
+static uint32_t *ref_result_pkt_ram_buffer;
+static uint16_t ref_config_rollover_index;
+static uint16_t ref_result_rollover_index;
+static bool ref_in_sniffer_mode;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+static uint64_t sim_time_ns(void)
+{
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((uint64_t)now.tv_sec * 1000000000ULL) + (uint64_t)now.tv_nsec;
+}
+
+/* Result word of a step, the first word of each result is its header with RESULT_SIZE in the second byte */
+static uint32_t sim_result_word(uint8_t step, uint8_t copy, uint8_t word, uint8_t length)
+{
+    uint32_t value = 0x50000000UL | ((uint32_t)step << 16U) | ((uint32_t)copy << 12U) | word;
+
+    if (word == 0U)
+    {
+        value = ((uint32_t)step << 16U) | ((uint32_t)copy << 12U) |
+                ((uint32_t)COM_RES_HDR_SIZE_AGC_IDX_RESULT_SIZE(length) << 8U);
+    }
+
+    return value;
+}
+
+/* Builds the config sequence and the expected results of a scenario */
+static void sim_build(const sim_scenario_t *scenario)
+{
+    uint32_t seed = 12345U;
+    uint32_t offset = 0U;
+    uint8_t length;
+
+    for (uint8_t mode = 0U; mode < 4U; mode++)
+    {
+        (void)XCVR_LCL_CalcConfigResult_Size((XCVR_RSM_FSTEP_TYPE_T)mode, scenario->rtt_type, scenario->num_ap,
+                                             &sim_cfg_len[mode], &sim_res_len[mode]);
+    }
+
+    sim_expected_words = 0U;
+    for (uint8_t step = 0U; step < scenario->num_steps; step++)
+    {
+        seed = (seed * 1103515245U) + 12345U;
+        sim_modes[step] = (uint8_t)((seed >> 16U) & scenario->mode_mask);
+        if ((scenario->mode_mask == 0x3U) && (scenario->config_depth % sim_cfg_len[3]) == 0U)
+        {
+            sim_modes[step] = 3U; /* Every step fills the buffer by the largest size, the buffer fills exactly */
+        }
+        sim_config_offsets[step] = offset;
+        length = sim_cfg_len[sim_modes[step]];
+        sim_configs[offset] = ((uint32_t)COM_MODE_013_CFG_HDR_STEP_CFG_MODE(sim_modes[step]) << 16U) | step;
+        for (uint8_t word = 1U; word < length; word++)
+        {
+            sim_configs[offset + word] = 0xC0000000UL | ((uint32_t)step << 8U) | word;
+        }
+        offset += length;
+
+        length = sim_res_len[sim_modes[step]];
+        for (uint8_t copy = 0U; copy < (scenario->sniffer ? 2U : 1U); copy++)
+        {
+            for (uint8_t word = 0U; word < length; word++)
+            {
+                sim_expected[sim_expected_words] = sim_result_word(step, copy, word, length);
+                sim_expected_words++;
+            }
+        }
+    }
+}
+
+static uint32_t *sim_pkt_ram(PKT_RAM_BANK_SEL_T bank)
+{
+    return (bank == TX_PKT_RAM_SEL) ? (uint32_t *)(uintptr_t)TX_PACKET_RAM_BASE :
+                                      (uint32_t *)(uintptr_t)RX_PACKET_RAM_BASE;
+}
+
+/* RSM model, executes steps from the config buffer into the result buffer and returns the number of errors */
+static uint32_t sim_rsm_execute(const sim_scenario_t *scenario, uint8_t num_steps)
+{
+    uint32_t *config_ram = sim_pkt_ram(scenario->config_bank);
+    uint32_t *result_ram = sim_pkt_ram(scenario->result_bank);
+    uint16_t config_end  = scenario->config_base + scenario->config_depth;
+    uint16_t result_end  = scenario->result_base + scenario->result_depth;
+    uint8_t copies       = scenario->sniffer ? 2U : 1U;
+    uint32_t errors      = 0U;
+    uint8_t mode;
+    uint8_t length;
+
+    for (uint8_t i = 0U; (i < num_steps) && (rsm_step < scenario->num_steps); i++)
+    {
+        if (sim_cfg_len[3] > (config_end - rsm_config_index))
+        {
+            rsm_config_index = scenario->config_base;
+            rsm_cfg_wraps++;
+        }
+        mode   = sim_modes[rsm_step];
+        length = sim_cfg_len[mode];
+        for (uint8_t word = 0U; word < length; word++)
+        {
+            if (config_ram[rsm_config_index + word] != sim_configs[sim_config_offsets[rsm_step] + word])
+            {
+                errors++;
+            }
+        }
+        rsm_config_index += length;
+        if (rsm_config_index == config_end)
+        {
+            rsm_config_index = scenario->config_base;
+            rsm_cfg_wraps++;
+        }
+
+        if ((sim_res_len[3] * copies) > (result_end - rsm_result_index))
+        {
+            rsm_result_index = scenario->result_base;
+            rsm_res_wraps++;
+        }
+        length = sim_res_len[mode];
+        for (uint8_t copy = 0U; copy < copies; copy++)
+        {
+            for (uint8_t word = 0U; word < length; word++)
+            {
+                result_ram[rsm_result_index] = sim_result_word(rsm_step, copy, word, length);
+                rsm_result_index++;
+            }
+        }
+        if (rsm_result_index == result_end)
+        {
+            rsm_result_index = scenario->result_base;
+            rsm_res_wraps++;
+        }
+        rsm_step++;
+    }
+
+    return errors;
+}
+
+static uint32_t sim_config_sum(const sim_scenario_t *scenario)
+{
+    const uint32_t *config_ram = sim_pkt_ram(scenario->config_bank);
+    uint32_t sum = 0U;
+
+    for (uint16_t i = scenario->config_base; i < (scenario->config_base + scenario->config_depth); i++)
+    {
+        sum = (sum * 31U) + config_ram[i];
+    }
+
+    return sum;
+}
+
+static void ref_setup(const sim_scenario_t *scenario)
+{
+    ref_step_irq_count            = scenario->irq_step_count;
+    ref_remaining_configs_to_load = scenario->num_steps;
+    ref_remaining_results_to_read = scenario->num_steps;
+    ref_config_rollover_index     = scenario->config_base + scenario->config_depth;
+    ref_result_rollover_index     = scenario->result_base + scenario->result_depth;
+    ref_in_sniffer_mode           = scenario->sniffer;
+    ref_config_pkt_ram_buffer     = sim_pkt_ram(scenario->config_bank);
+    ref_result_pkt_ram_buffer     = sim_pkt_ram(scenario->result_bank);
+    for (uint8_t i = 0U; i < 4U; i++)
+    {
+        ref_cfg_step_length_words[i] = sim_cfg_len[i];
+        ref_res_step_length_words[i] = sim_res_len[i] * (scenario->sniffer ? 2U : 1U);
+    }
+}
+
+static void ref_load_config_steps(uint32_t **current_cfg_ptr)
+{
+    static uint32_t temp_cfg_val;
+    uint8_t i, j;
+    uint32_t *temp_cur_cfg_ptr = *current_cfg_ptr;
+    uint8_t count = ref_step_irq_count;
+    if (ref_remaining_configs_to_load < ref_step_irq_count)
+    {
+        count = ref_remaining_configs_to_load;
+    }
+
+    uint32_t temp_config_ptr_reg = XCVR_MISC->RSM_CONFIG_PTR;
+    uint16_t config_index        = (uint16_t)((temp_config_ptr_reg & XCVR_MISC_RSM_CONFIG_PTR_RSM_CONFIG_WR_PTR_MASK) >>
+                                       XCVR_MISC_RSM_CONFIG_PTR_RSM_CONFIG_WR_PTR_SHIFT);
+    uint8_t config_page          = (uint8_t)((temp_config_ptr_reg & XCVR_MISC_RSM_CONFIG_PTR_RSM_CONFIG_WR_PAGE_MASK) >>
+                                    XCVR_MISC_RSM_CONFIG_PTR_RSM_CONFIG_WR_PAGE_SHIFT);
+
+    for (i = 0U; i < count; i++)
+    {
+        if (ref_cfg_step_length_words[3U] > (ref_config_rollover_index - config_index))
+        {
+            config_index = (uint16_t)((XCVR_MISC->RSM_CONFIG_BUFF &
+                                       XCVR_MISC_RSM_CONFIG_BUFF_RSM_CONFIG_BASE_ADDR_MASK) >>
+                                      XCVR_MISC_RSM_CONFIG_BUFF_RSM_CONFIG_BASE_ADDR_SHIFT);
+            config_page  = (~config_page) & 0x1U;
+        }
+        uint32_t step_data = (*temp_cur_cfg_ptr) >> 16U;
+        uint8_t mode       = (uint8_t)((step_data & COM_MODE_013_CFG_HDR_STEP_CFG_MODE_MASK) >>
+                                 COM_MODE_013_CFG_HDR_STEP_CFG_MODE_SHIFT);
+        uint8_t length     = ref_cfg_step_length_words[mode];
+        for (j = 0U; j < length; j++)
+        {
+            temp_cfg_val                            = *temp_cur_cfg_ptr;
+            ref_config_pkt_ram_buffer[config_index] = temp_cfg_val;
+            config_index++;
+            temp_cur_cfg_ptr++;
+        }
+        ref_remaining_configs_to_load--;
+        if (config_index == ref_config_rollover_index)
+        {
+            config_index = (uint16_t)((XCVR_MISC->RSM_CONFIG_BUFF &
+                                       XCVR_MISC_RSM_CONFIG_BUFF_RSM_CONFIG_BASE_ADDR_MASK) >>
+                                      XCVR_MISC_RSM_CONFIG_BUFF_RSM_CONFIG_BASE_ADDR_SHIFT);
+            config_page  = (~config_page) & 0x1U;
+        }
+    }
+    *current_cfg_ptr = temp_cur_cfg_ptr;
+    temp_config_ptr_reg &=
+        ~(XCVR_MISC_RSM_CONFIG_PTR_RSM_CONFIG_WR_PTR_MASK | XCVR_MISC_RSM_CONFIG_PTR_RSM_CONFIG_WR_PAGE_MASK);
+    temp_config_ptr_reg |= XCVR_MISC_RSM_CONFIG_PTR_RSM_CONFIG_WR_PTR(config_index) |
+                           XCVR_MISC_RSM_CONFIG_PTR_RSM_CONFIG_WR_PAGE(config_page);
+    XCVR_MISC->RSM_CONFIG_PTR = temp_config_ptr_reg;
+}
+
+static void ref_read_result_steps(uint32_t **current_res_ptr)
+{
+    uint8_t i, j;
+    uint32_t *temp_cur_res_ptr = *current_res_ptr;
+    uint8_t count              = ref_step_irq_count;
+    if (ref_remaining_results_to_read < ref_step_irq_count)
+    {
+        count = ref_remaining_results_to_read;
+    }
+
+    uint32_t temp_result_ptr_reg = XCVR_MISC->RSM_RESULT_PTR;
+    uint16_t result_index        = (uint16_t)((temp_result_ptr_reg & XCVR_MISC_RSM_RESULT_PTR_RSM_RESULT_RD_PTR_MASK) >>
+                                       XCVR_MISC_RSM_RESULT_PTR_RSM_RESULT_RD_PTR_SHIFT);
+    uint8_t result_page          = (uint8_t)((temp_result_ptr_reg & XCVR_MISC_RSM_RESULT_PTR_RSM_RESULT_RD_PAGE_MASK) >>
+                                    XCVR_MISC_RSM_RESULT_PTR_RSM_RESULT_RD_PAGE_SHIFT);
+
+    for (i = 0U; i < count; i++)
+    {
+        if (ref_res_step_length_words[3U] > (ref_result_rollover_index - result_index))
+        {
+            result_index = (uint16_t)((XCVR_MISC->RSM_RESULT_BUFF &
+                                       XCVR_MISC_RSM_RESULT_BUFF_RSM_RESULT_BASE_ADDR_MASK) >>
+                                      XCVR_MISC_RSM_RESULT_BUFF_RSM_RESULT_BASE_ADDR_SHIFT);
+            result_page  = (result_page == 0U ? 1U : 0U);
+        }
+        uint32_t step_data = (ref_result_pkt_ram_buffer[result_index]) >> 8U;
+        uint8_t length     = (uint8_t)((step_data & COM_RES_HDR_SIZE_AGC_IDX_RESULT_SIZE_MASK) >>
+                                   COM_RES_HDR_SIZE_AGC_IDX_RESULT_SIZE_SHIFT);
+        for (j = 0U; j < length; j++)
+        {
+            *temp_cur_res_ptr = ref_result_pkt_ram_buffer[result_index];
+            result_index++;
+            temp_cur_res_ptr++;
+        }
+        if (ref_in_sniffer_mode)
+        {
+            for (j = 0U; j < length; j++)
+            {
+                *temp_cur_res_ptr = ref_result_pkt_ram_buffer[result_index];
+                result_index++;
+                temp_cur_res_ptr++;
+            }
+        }
+        ref_remaining_results_to_read--;
+        if (result_index == ref_result_rollover_index)
+        {
+            result_index = (uint16_t)((XCVR_MISC->RSM_RESULT_BUFF &
+                                       XCVR_MISC_RSM_RESULT_BUFF_RSM_RESULT_BASE_ADDR_MASK) >>
+                                      XCVR_MISC_RSM_RESULT_BUFF_RSM_RESULT_BASE_ADDR_SHIFT);
+            result_page  = (result_page == 0U ? 1U : 0U);
+        }
+    }
+    *current_res_ptr = temp_cur_res_ptr;
+    temp_result_ptr_reg &=
+        ~(XCVR_MISC_RSM_RESULT_PTR_RSM_RESULT_RD_PTR_MASK | XCVR_MISC_RSM_RESULT_PTR_RSM_RESULT_RD_PAGE_MASK);
+    temp_result_ptr_reg |= XCVR_MISC_RSM_RESULT_PTR_RSM_RESULT_RD_PTR(result_index) |
+                           XCVR_MISC_RSM_RESULT_PTR_RSM_RESULT_RD_PAGE(result_page);
+    XCVR_MISC->RSM_RESULT_PTR = temp_result_ptr_reg;
+}
+
+/* Runs a scenario with one transfer, returns the number of errors and the time spent in the step interrupts */
+static uint32_t sim_run(const sim_scenario_t *scenario, sim_method_t method, uint64_t *irq_ns, uint32_t *num_irqs)
+{
+    cs_pkt_ram_config_info_t info = {
+        .config_pkt_ram_bank   = scenario->config_bank,
+        .result_pkt_ram_bank   = scenario->result_bank,
+        .config_base_addr_word = scenario->config_base,
+        .result_base_addr_word = scenario->result_base,
+        .config_depth_word     = scenario->config_depth,
+        .result_depth_word     = scenario->result_depth,
+        .interrupt_step_count  = scenario->irq_step_count,
+        .is_sniffer_mode       = scenario->sniffer,
+    };
+    uint32_t *config_ptr  = sim_configs;
+    uint32_t *result_ptr  = sim_results;
+    uint32_t errors       = 0U;
+    uint32_t irq          = 0U;
+    uint32_t config_sum;
+    uint64_t start;
+    xcvrLclStatus_t status;
+
+    for (uint32_t i = 0U; i < TX_PACKET_RAM_PACKET_RAM_COUNT; i++)
+    {
+        sim_pkt_ram(TX_PKT_RAM_SEL)[i] = SIM_FILL;
+    }
+    for (uint32_t i = 0U; i < RX_PACKET_RAM_PACKET_RAM_COUNT; i++)
+    {
+        sim_pkt_ram(RX_PKT_RAM_SEL)[i] = SIM_FILL;
+    }
+    for (uint32_t i = 0U; i < SIM_MAX_WORDS; i++)
+    {
+        sim_results[i] = 0U;
+    }
+    XCVR_MISC->RSM_CONFIG_PTR = 0U;
+    XCVR_MISC->RSM_RESULT_PTR = 0U;
+    rsm_config_index          = scenario->config_base;
+    rsm_result_index          = scenario->result_base;
+    rsm_step                  = 0U;
+    rsm_cfg_wraps             = 0U;
+    rsm_res_wraps             = 0U;
+    *irq_ns                   = 0U;
+
+    status = XCVR_LCL_InitCfgResPointers(&info);
+    if (method == SIM_BURST)
+    {
+        status |= XCVR_LCL_SetupInitialConfigs(scenario->num_steps, sim_configs, sim_results, scenario->rtt_type,
+                                               scenario->num_ap, scenario->sniffer);
+    }
+    else
+    {
+        ref_setup(scenario);
+        ref_load_config_steps(&config_ptr);
+        ref_load_config_steps(&config_ptr);
+    }
+    if (status != gXcvrLclStatusSuccess)
+    {
+        (void)fprintf(stderr, "%s: setup failed with %d\n", scenario->name, (int)status);
+        errors++;
+    }
+
+    while ((errors == 0U) && (rsm_step < scenario->num_steps) && (irq < SIM_MAX_IRQS))
+    {
+        errors += sim_rsm_execute(scenario, scenario->irq_step_count);
+        start = sim_time_ns();
+        if (method == SIM_BURST)
+        {
+            errors += (XCVR_LCL_HandleIrqStepEos(0) == gXcvrLclStatusSuccess) ? 0U : 1U;
+        }
+        else
+        {
+            ref_load_config_steps(&config_ptr);
+            ref_read_result_steps(&result_ptr);
+        }
+        *irq_ns += sim_time_ns() - start;
+
+        config_sum = sim_config_sum(scenario);
+        if (method == SIM_BURST)
+        {
+            sim_snapshots[irq].config_ptr = XCVR_MISC->RSM_CONFIG_PTR;
+            sim_snapshots[irq].result_ptr = XCVR_MISC->RSM_RESULT_PTR;
+            sim_snapshots[irq].config_sum = config_sum;
+        }
+        else if ((sim_snapshots[irq].config_ptr != XCVR_MISC->RSM_CONFIG_PTR) ||
+                 (sim_snapshots[irq].result_ptr != XCVR_MISC->RSM_RESULT_PTR) ||
+                 (sim_snapshots[irq].config_sum != config_sum))
+        {
+            (void)fprintf(stderr, "%s: state after interrupt %u differs from the word by word transfer\n",
+                          scenario->name, (unsigned int)irq);
+            errors++;
+        }
+        else
+        {
+            /* Same state as the burst transfer */
+        }
+        irq++;
+    }
+    *num_irqs = irq;
+
+    for (uint32_t i = 0U; i < sim_expected_words; i++)
+    {
+        errors += (sim_results[i] != sim_expected[i]) ? 1U : 0U;
+    }
+    errors += (sim_results[sim_expected_words] != 0U) ? 1U : 0U;
+
+    return errors;
+}
+
+int main(void)
+{
+    const sim_scenario_t *scenario;
+    uint64_t best_ns[SIM_NUM_METHODS];
+    uint64_t irq_ns;
+    uint32_t num_irqs = 0U;
+    uint32_t errors;
+    uint32_t total_errors = 0U;
+    static const char *const method_names[SIM_NUM_METHODS] = {"burst", "word"};
+
+    if (host_map(&sim_regs, sim_periphs, SIM_NUM_PERIPHS, PROT_READ | PROT_WRITE) != 0)
+    {
+        return 1;
+    }
+
+    for (uint32_t s = 0U; s < (sizeof(sim_scenarios) / sizeof(sim_scenarios[0])); s++)
+    {
+        scenario = &sim_scenarios[s];
+        sim_build(scenario);
+        for (uint32_t m = 0U; m < (uint32_t)SIM_NUM_METHODS; m++)
+        {
+            best_ns[m] = UINT64_MAX;
+            errors     = 0U;
+            for (uint32_t run = 0U; (run < SIM_TIMING_RUNS) && (errors == 0U); run++)
+            {
+                /* The word by word runs are checked against the state the burst run left in the snapshots */
+                errors = sim_run(scenario, (sim_method_t)m, &irq_ns, &num_irqs);
+                best_ns[m] = (irq_ns < best_ns[m]) ? irq_ns : best_ns[m];
+            }
+            total_errors += errors;
+            (void)printf(
+                "{\"scenario\":\"%s\",\"method\":\"%s\",\"steps\":%u,\"irqs\":%u,\"cfg_wraps\":%u,\"res_wraps\":%u,"
+                "\"errors\":%u,\"ns_per_irq\":%llu}\n",
+                scenario->name, method_names[m], (unsigned int)scenario->num_steps, (unsigned int)num_irqs,
+                (unsigned int)rsm_cfg_wraps, (unsigned int)rsm_res_wraps, (unsigned int)errors,
+                (unsigned long long)(best_ns[m] / ((num_irqs == 0U) ? 1U : num_irqs)));
+        }
+    }
+
+    return (total_errors != 0U) ? 1 : 0;
+}
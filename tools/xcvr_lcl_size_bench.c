@@ -0,0 +1,296 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Host check and microbenchmark of the CS step size lookup (x86-64 Linux, KW47 and later with a 32MHz RF_OSC).
+ *
+ * XCVR_LCL_CalcConfigResult_Size() is compared, over every step format, RTT type and number of antenna paths and
+ * beyond their ranges, with a reference copy of the former switch based sizing. Valid inputs must give the same
+ * sizes and invalid ones must be rejected. Both are then timed on BENCH_NUM_CALLS pseudo random steps of valid
+ * inputs, as the former per step calls of XCVR_LCL_ValidateSubeventInfo() and XCVR_LCL_ProgramFstepRam() made
+ * them. The reference is kept out of line so that both pay a call. The sizing of a 127 step subevent by
+ * XCVR_LCL_ValidateSubeventInfo(), which now sizes each step format once and looks the steps up, is timed against
+ * the former loop calling the reference for every step. The best of BENCH_NUM_RUNS runs is kept.
+ *
+ * On the host a single table lookup costs about as much as the switch, slightly more at -O2, since the call and the
+ * range checks dominate. The gain is in ns_validate: the step formats are sized once instead of once per step.
+ *
+ * No register is accessed. Build it on the host against the device headers of the target:
+ *
+ *   gcc -O2 -DNXP_RADIO_GEN=470 -DRF_OSC_26MHZ=0 -I<device headers> -Idrv -Idrv/nb2p4ghz \
+ *       -Idrv/nb2p4ghz/configs/gen47 tools/xcvr_lcl_size_bench.c \
+ *       drv/{dbg_ram_capture,mathfp,nxp_xcvr_ext_ctrl,nxp_xcvr_lcl_ctrl,nxp_xcvr_lcl_step_mgr,rfmc_ctrl}.c \
+ *       drv/nb2p4ghz/{nxp2p4_xcvr,nxp_xcvr_blob,nxp_xcvr_hop_table,nxp_xcvr_trim}.c \
+ *       drv/nb2p4ghz/configs/gen47/nxp_xcvr_*.c -lm -o xcvr_lcl_size_bench
+ *   ./xcvr_lcl_size_bench
+ *
+ * The report is one JSON object, times are in ns, for instance:
+ *   {"checked":240,"mismatches":0,"calls":4096,"ns_switch":8542,"ns_table":8819,"ns_validate_ref":314,
+ *    "ns_validate":127}
+ * The exit status is non zero on a mismatch.
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <time.h>
+#include "nxp_xcvr_lcl_step_mgr.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define BENCH_NUM_CALLS (4096U)
+#define BENCH_NUM_RUNS  (2000U)
+#define BENCH_NUM_STEPS (127U) /* Largest subevent XCVR_LCL_ValidateSubeventInfo() accepts */
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+static uint64_t bench_time_ns(void);
+static uint32_t bench_rand(void);
+static xcvrLclStatus_t ref_calc_size(XCVR_RSM_FSTEP_TYPE_T step_format,
+                                     XCVR_RSM_RTT_TYPE_T rtt_type,
+                                     uint8_t num_ap,
+                                     uint8_t *config_size_words,
+                                     uint8_t *result_size_words) __attribute__((noinline));
+static uint32_t bench_check(uint32_t *num_checked);
+static xcvrLclStatus_t ref_validate_sizes(const cs_subevent_info_t *subevent_info_ptr,
+                                          uint16_t cfg_buffer_sz_words,
+                                          uint16_t res_buffer_sz_words) __attribute__((noinline));
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static XCVR_RSM_FSTEP_TYPE_T bench_step_type[BENCH_NUM_CALLS];
+static XCVR_RSM_RTT_TYPE_T bench_rtt_type[BENCH_NUM_CALLS];
+static uint8_t bench_num_ap[BENCH_NUM_CALLS];
+static uint32_t bench_seed = 1U;
+static volatile uint32_t bench_sink;
+
+static uint32_t bench_words[BENCH_NUM_STEPS * 2U];
+static uint16_t bench_halfwords[BENCH_NUM_STEPS];
+static cs_subevent_info_t bench_subevent = {
+    .step_type         = bench_step_type,
+    .aa_list           = bench_words,
+    .payload_list_init = bench_words,
+    .payload_list_refl = bench_words,
+    .channel_list      = bench_halfwords,
+    .cfo_list          = bench_halfwords,
+    .phase_add_list    = bench_halfwords,
+    .hpm_cal_list      = bench_halfwords,
+    .step_cfg_list     = bench_halfwords,
+    .num_steps         = BENCH_NUM_STEPS,
+    .rtt_type          = XCVR_RSM_RTT_128BIT_RANDOM,
+    .num_ap            = 4U,
+};
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+static uint64_t bench_time_ns(void)
+{
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((uint64_t)now.tv_sec * 1000000000ULL) + (uint64_t)now.tv_nsec;
+}
+
+static uint32_t bench_rand(void)
+{
+    bench_seed = (bench_seed * 1103515245U) + 12345U;
+
+    return bench_seed >> 8;
+}
+
+/* Former sizing of XCVR_LCL_CalcConfigResult_Size(), built without CHECK_FSTEP_ERRORS */
+static xcvrLclStatus_t ref_calc_size(XCVR_RSM_FSTEP_TYPE_T step_format,
+                                     XCVR_RSM_RTT_TYPE_T rtt_type,
+                                     uint8_t num_ap,
+                                     uint8_t *config_size_words,
+                                     uint8_t *result_size_words)
+{
+    xcvrLclStatus_t status = gXcvrLclStatusSuccess;
+
+    switch (step_format)
+    {
+        case XCVR_RSM_STEP_FCS:
+            *config_size_words = 5U;
+            *result_size_words = 5U;
+            break;
+        case XCVR_RSM_STEP_PK_PK:
+            *config_size_words = 5U + rtt_payload_sizes[rtt_type];
+            *result_size_words = 5U;
+            break;
+        case XCVR_RSM_STEP_TN_TN:
+            *config_size_words = 3U;
+            *result_size_words = 1U + num_ap + 1U;
+            break;
+        case XCVR_RSM_STEP_PK_TN_TN_PK:
+            *config_size_words = 5U + rtt_payload_sizes[rtt_type];
+            *result_size_words = 5U + num_ap + 1U;
+            break;
+        default:
+            *config_size_words = 0U;
+            *result_size_words = 0U;
+            status             = gXcvrLclStatusInvalidArgs;
+            break;
+    }
+
+    return status;
+}
+
+/* Sizing loop of the former XCVR_LCL_ValidateSubeventInfo(), one reference call per step */
+static xcvrLclStatus_t ref_validate_sizes(const cs_subevent_info_t *subevent_info_ptr,
+                                          uint16_t cfg_buffer_sz_words,
+                                          uint16_t res_buffer_sz_words)
+{
+    xcvrLclStatus_t status = gXcvrLclStatusSuccess;
+    uint16_t total_cfg_sz  = 0U;
+    uint16_t total_res_sz  = 0U;
+    uint8_t cfg_sz;
+    uint8_t res_sz;
+    uint8_t i;
+
+    for (i = 0U; i < subevent_info_ptr->num_steps; i++)
+    {
+        if (ref_calc_size(subevent_info_ptr->step_type[i], subevent_info_ptr->rtt_type, subevent_info_ptr->num_ap,
+                          &cfg_sz, &res_sz) != gXcvrLclStatusSuccess)
+        {
+            status = gXcvrLclStatusFail;
+            break;
+        }
+        total_cfg_sz += cfg_sz;
+        total_res_sz += res_sz;
+    }
+    if ((status == gXcvrLclStatusSuccess) &&
+        ((total_cfg_sz > cfg_buffer_sz_words) || (total_res_sz > res_buffer_sz_words)))
+    {
+        status = gXcvrLclStatusInvalidLength;
+    }
+
+    return status;
+}
+
+/* Every input in range must size as the reference, every input out of range must be rejected */
+static uint32_t bench_check(uint32_t *num_checked)
+{
+    uint32_t mismatches = 0U;
+    uint8_t mode;
+    uint8_t rtt;
+    uint8_t num_ap;
+    uint8_t cfg_sz;
+    uint8_t res_sz;
+    uint8_t ref_cfg_sz;
+    uint8_t ref_res_sz;
+    xcvrLclStatus_t status;
+    bool valid;
+
+    *num_checked = 0U;
+    for (mode = 0U; mode <= 4U; mode++)
+    {
+        for (rtt = 0U; rtt <= (uint8_t)XCVR_RSM_RTT_ERROR; rtt++)
+        {
+            for (num_ap = 0U; num_ap <= 5U; num_ap++)
+            {
+                valid  = (mode < 4U) && (rtt < (uint8_t)XCVR_RSM_RTT_ERROR) && (num_ap <= 4U);
+                status = XCVR_LCL_CalcConfigResult_Size((XCVR_RSM_FSTEP_TYPE_T)mode, (XCVR_RSM_RTT_TYPE_T)rtt, num_ap,
+                                                        &cfg_sz, &res_sz);
+                if (valid)
+                {
+                    (void)ref_calc_size((XCVR_RSM_FSTEP_TYPE_T)mode, (XCVR_RSM_RTT_TYPE_T)rtt, num_ap, &ref_cfg_sz,
+                                        &ref_res_sz);
+                    if ((status != gXcvrLclStatusSuccess) || (cfg_sz != ref_cfg_sz) || (res_sz != ref_res_sz))
+                    {
+                        mismatches++;
+                    }
+                }
+                else if ((status != gXcvrLclStatusInvalidArgs) || (cfg_sz != 0U) || (res_sz != 0U))
+                {
+                    mismatches++;
+                }
+                (*num_checked)++;
+            }
+        }
+    }
+
+    return mismatches;
+}
+
+int main(void)
+{
+    uint32_t num_checked;
+    uint32_t mismatches;
+    uint32_t run;
+    uint32_t i;
+    uint32_t sum;
+    uint8_t cfg_sz;
+    uint8_t res_sz;
+    uint64_t start;
+    uint64_t elapsed;
+    uint64_t ns_switch   = UINT64_MAX;
+    uint64_t ns_table    = UINT64_MAX;
+    uint64_t ns_validate_ref = UINT64_MAX;
+    uint64_t ns_validate     = UINT64_MAX;
+
+    mismatches = bench_check(&num_checked);
+
+    for (i = 0U; i < BENCH_NUM_CALLS; i++)
+    {
+        bench_step_type[i] = (XCVR_RSM_FSTEP_TYPE_T)(bench_rand() & 0x3U);
+        bench_rtt_type[i]  = (XCVR_RSM_RTT_TYPE_T)(bench_rand() % (uint32_t)XCVR_RSM_RTT_ERROR);
+        bench_num_ap[i]    = (uint8_t)((bench_rand() & 0x3U) + 1U);
+    }
+
+    for (run = 0U; run < BENCH_NUM_RUNS; run++)
+    {
+        sum   = 0U;
+        start = bench_time_ns();
+        for (i = 0U; i < BENCH_NUM_CALLS; i++)
+        {
+            (void)ref_calc_size(bench_step_type[i], bench_rtt_type[i], bench_num_ap[i], &cfg_sz, &res_sz);
+            sum += (uint32_t)cfg_sz + (uint32_t)res_sz;
+        }
+        elapsed    = bench_time_ns() - start;
+        bench_sink = sum;
+        ns_switch  = (elapsed < ns_switch) ? elapsed : ns_switch;
+
+        sum   = 0U;
+        start = bench_time_ns();
+        for (i = 0U; i < BENCH_NUM_CALLS; i++)
+        {
+            (void)XCVR_LCL_CalcConfigResult_Size(bench_step_type[i], bench_rtt_type[i], bench_num_ap[i], &cfg_sz,
+                                                 &res_sz);
+            sum += (uint32_t)cfg_sz + (uint32_t)res_sz;
+        }
+        elapsed    = bench_time_ns() - start;
+        bench_sink = sum;
+        ns_table   = (elapsed < ns_table) ? elapsed : ns_table;
+
+        start           = bench_time_ns();
+        bench_sink      = (uint32_t)ref_validate_sizes(&bench_subevent, 0xFFFFU, 0xFFFFU);
+        elapsed         = bench_time_ns() - start;
+        ns_validate_ref = (elapsed < ns_validate_ref) ? elapsed : ns_validate_ref;
+
+        start       = bench_time_ns();
+        bench_sink  = (uint32_t)XCVR_LCL_ValidateSubeventInfo(&bench_subevent, 0xFFFFU, 0xFFFFU);
+        elapsed     = bench_time_ns() - start;
+        ns_validate = (elapsed < ns_validate) ? elapsed : ns_validate;
+    }
+
+    if (XCVR_LCL_ValidateSubeventInfo(&bench_subevent, 0xFFFFU, 0xFFFFU) !=
+        ref_validate_sizes(&bench_subevent, 0xFFFFU, 0xFFFFU))
+    {
+        mismatches++;
+    }
+
+    (void)printf(
+        "{\"checked\":%u,\"mismatches\":%u,\"calls\":%u,\"ns_switch\":%llu,\"ns_table\":%llu,"
+        "\"ns_validate_ref\":%llu,\"ns_validate\":%llu}\n",
+        num_checked, mismatches, BENCH_NUM_CALLS, (unsigned long long)ns_switch, (unsigned long long)ns_table,
+        (unsigned long long)ns_validate_ref, (unsigned long long)ns_validate);
+
+    return (mismatches == 0U) ? 0 : 1;
+}
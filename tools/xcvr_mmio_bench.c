@@ -0,0 +1,809 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Host MMIO cost benchmark of the radio driver (x86-64 Linux).
+ *
+ * The driver sources run on the host against a stand-in register file: the pages of every radio peripheral of the
+ * device headers are mapped at their device address with no access rights, so that every register load or store
+ * traps. The trap handler opens the page, counts the access and single steps the instruction before closing the page
+ * again. For each public API call and each radio configuration the tool counts:
+ *   - reads and writes: register loads and stores,
+ *   - rmw: writes to the register read by the previous access (read-modify-write sequences),
+ *   - polls and poll_iters: registers read again by the same instruction with no register write in between, and the
+ *     number of these repeated reads.
+ * No hardware sits behind the stand-in, so a status bit never changes by itself. A polled register still read after
+ * BENCH_POLL_LIMIT repeats is released by presenting it with all ones, all zeros and then every byte value repeated
+ * in the four bytes, one pattern per read. Once the poll goes on to read another register the pattern is kept, so
+ * that polls testing several registers are released one register after the other. A register that none of these
+ * patterns releases is reported as a stuck poll and the call is abandoned. Polling counts therefore measure the polls
+ * issued by the driver, not the time the hardware takes to complete them.
+ * The calls that do not poll the hardware are also timed with the register file pages open, over BENCH_TIMING_CALLS
+ * calls, and ns is their host latency per call: the cost of the computation and of plain memory accesses. ns is 0 for
+ * the other calls.
+ *
+ * Build it on the host for one radio generation (450 or 470) against the device headers of the target, with -O0 so
+ * that every register access of the source is one load or store instruction:
+ *
+ *   gcc -O0 -DNXP_RADIO_GEN=470 -DRF_OSC_26MHZ=0 -I<device headers> -Idrv -Idrv/nb2p4ghz \
+ *       -Idrv/nb2p4ghz/configs/gen47 tools/xcvr_mmio_bench.c tools/xcvr_host_map.c \
+ *       drv/{dbg_ram_capture,mathfp,nxp_xcvr_ext_ctrl,nxp_xcvr_lcl_ctrl,nxp_xcvr_lcl_step_mgr,rfmc_ctrl}.c \
+ *       drv/nb2p4ghz/{nxp2p4_xcvr,nxp_xcvr_blob,nxp_xcvr_hop_table,nxp_xcvr_trim}.c \
+ *       drv/nb2p4ghz/configs/gen47/nxp_xcvr_*.c -lm -o xcvr_mmio_bench
+ *   ./xcvr_mmio_bench > mmio_gen47.json
+ *   ./xcvr_mmio_bench mmio_gen47.json
+ *
+ * The report has one JSON object per line and per measured call, for instance:
+ *   {"gen":470,"api":"XCVR_Init","config":"msk_1mbps","status":0,"reads":1,"writes":2,"rmw":0,"polls":0,
+ *    "poll_iters":0,"stuck":0,"ns":0}
+ * XCVR_Init() starts from a reset register file, XCVR_ChangeMode() switches to the configuration from the
+ * gfsk_bt_0p5_h_0p5_1mbps one and XCVR_OverrideChannel() follows XCVR_Init() of the configuration. XCVR_LCL_RsmInit(),
+ * XCVR_OverrideTxFrequency() and XCVR_HopToIndex() are measured once, on the gfsk_bt_0p5_h_0p5_1mbps configuration.
+ * The last two set the same frequency, the hop following XCVR_HopTableStart() on the first hop table entry, so that
+ * they compare a hop computed at runtime with a hop from the table. XCVR_HopScheduleNext() is measured on the second
+ * hop of a BLE channel sequence prepared by XCVR_HopScheduleInit(). XCVR_LCL_CalibratePll() calibrates a short
+ * channel list after XCVR_LCL_RsmInit() and XCVR_LCL_CalibratePllProcess() runs one step of the same calibration
+ * started by XCVR_LCL_CalibratePllStart(), once the first warmup is complete. XCVR_EdScan() measures a list of BLE
+ * channels, and XCVR_GetInstantRssi() the same list one channel at a time with XCVR_OverrideChannel(),
+ * XCVR_GetInstantRssi() and XCVR_WaitRxTxWd() calls.
+ *
+ * When a previous report is given, the calls are compared with it and the exit status is non zero if any call reads,
+ * writes or polls more than it did, if a call is missing from the report or if a poll is stuck. The exit status is
+ * also non zero if a hop of XCVR_HopScheduleNext() does not leave the PLL CHAN_MAP register as XCVR_OverrideChannel()
+ * of the same channel does.
+ */
+
+#define _GNU_SOURCE
+#include <setjmp.h>
+#include <signal.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <time.h>
+#include <ucontext.h>
+#include "nxp2p4_xcvr.h"
+#include "nxp_xcvr_lcl_ctrl.h"
+#include "nxp_xcvr_coding_config.h"
+#include "nxp_xcvr_common_config.h"
+#include "nxp_xcvr_fsk_h_0p5_config.h"
+#include "nxp_xcvr_gfsk_bt_0p3_h_0p5_config.h"
+#include "nxp_xcvr_gfsk_bt_0p5_h_0p32_config.h"
+#include "nxp_xcvr_gfsk_bt_0p5_h_0p5_config.h"
+#include "nxp_xcvr_gfsk_bt_0p5_h_0p7_config.h"
+#include "nxp_xcvr_gfsk_bt_0p5_h_1p0_config.h"
+#include "nxp_xcvr_gfsk_bt_0p7_h_0p5_config.h"
+#include "nxp_xcvr_gfsk_bt_1p0_h_0p5_config.h"
+#include "nxp_xcvr_gfsk_bt_2p0_h_0p5_config.h"
+#include "nxp_xcvr_msk_config.h"
+#include "nxp_xcvr_oqpsk_802p15p4_config.h"
+#include "xcvr_host_map.h"
+
+#if !defined(__linux__) || !defined(__x86_64__)
+#error "The register file stand-in relies on x86-64 Linux page faults and single stepping"
+#endif
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define BENCH_MAX_OPEN (4U)       /* Register file pages accessed by a single instruction */
+#define BENCH_MAX_READS (8U)      /* Register reads followed since the last register write, for the poll detection */
+#define BENCH_POLL_LIMIT (8U)     /* Repeats of a polled read before the stand-in presents release patterns */
+#define BENCH_NUM_PATTERNS (258U) /* All ones, all zeros and the 256 repeated byte values */
+#define BENCH_EFLAGS_TF (0x100)   /* x86 trap flag, single step */
+#define BENCH_PF_WRITE (0x2)      /* Page fault error code bit set for a write access */
+#define BENCH_MAX_LINES (512U)    /* Lines of a previous report */
+#define BENCH_LINE_LEN (256U)     /* Characters of a report line */
+#define BENCH_REF_CONFIG (9U)     /* gfsk_bt_0p5_h_0p5_1mbps, the BLE configuration, in bench_configs */
+#define BENCH_CHANNEL (12U)       /* Channel of the XCVR_OverrideChannel() measurements */
+#define BENCH_HOP_FREQ (2426000000UL) /* Frequency of the XCVR_OverrideTxFrequency() and XCVR_HopToIndex() calls */
+#define BENCH_TIMING_CALLS (100000U)  /* Calls of a host latency measurement */
+#define BENCH_NUM_HOPS (20U)          /* Hops of the XCVR_HopScheduleNext() sequence */
+#define BENCH_DWELL_US (625U)         /* Dwell time of the XCVR_HopScheduleNext() sequence */
+#define BENCH_NUM_CAL_CHANNELS (4U)   /* Channels of the PLL calibration */
+#define BENCH_NUM_SCAN_CHANNELS (8U)  /* Channels of the energy detect scans */
+
+/* Reads of a poll with no register write before it is reported as stuck, whatever the polled registers */
+#define BENCH_MAX_POLL_READS (BENCH_MAX_READS * (BENCH_POLL_LIMIT + BENCH_NUM_PATTERNS) * 4U)
+
+/* Configurations to measure, named after their xcvr_config_t without the xcvr_ prefix and _full_config suffix */
+#define BENCH_CONFIG(name) {#name, &xcvr_##name##_full_config}
+
+typedef enum
+{
+    BENCH_API_INIT = 0,
+    BENCH_API_CHANGE_MODE,
+    BENCH_API_OVERRIDE_CHANNEL,
+    BENCH_API_RSM_INIT,
+    BENCH_API_OVERRIDE_TX_FREQ,
+    BENCH_API_HOP,
+    BENCH_API_HOP_SCHEDULE,
+    BENCH_API_CALIBRATE_PLL,
+    BENCH_API_CALIBRATE_PLL_PROCESS,
+    BENCH_API_INSTANT_RSSI_SCAN,
+    BENCH_API_ED_SCAN,
+    BENCH_NUM_APIS
+} bench_api_t;
+
+typedef struct
+{
+    const char *name;
+    const xcvr_config_t *config;
+} bench_config_t;
+
+typedef struct
+{
+    uintptr_t pc;     /* Instruction reading the register */
+    uintptr_t addr;   /* Register read */
+    uint32_t order;   /* Order of the first read since the last register write */
+    uint32_t repeats; /* Reads repeated by the instruction */
+    bool frozen;      /* Poll condition met, the register keeps its last pattern */
+} bench_read_t;
+
+typedef struct
+{
+    uint32_t reads;
+    uint32_t writes;
+    uint32_t rmw;
+    uint32_t polls;
+    uint32_t poll_iters;
+    uint32_t stuck;
+} bench_counts_t;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+static void bench_read(uintptr_t pc, uintptr_t addr);
+static void bench_segv(int sig, siginfo_t *info, void *context);
+static void bench_trap(int sig, siginfo_t *info, void *context);
+static void bench_reset_regs(void);
+static int bench_call(bench_api_t api, const xcvr_config_t *config);
+static int bench_measure(bench_api_t api, const xcvr_config_t *config, bench_counts_t *counts);
+static uint32_t bench_time(bench_api_t api, const xcvr_config_t *config);
+static int bench_compare(const char *line, const char *key);
+static int bench_check_hop_schedule(void);
+static void bench_cal_done(void *userData, xcvrLclStatus_t status, uint16_t num_done);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static const host_periph_t bench_periphs[] = {
+#ifdef XCVR_TSM
+    HOST_PERIPH(XCVR_TSM),
+#endif
+#ifdef XCVR_PLL_DIG
+    HOST_PERIPH(XCVR_PLL_DIG),
+#endif
+#ifdef XCVR_TX_DIG
+    HOST_PERIPH(XCVR_TX_DIG),
+#endif
+#ifdef XCVR_RX_DIG
+    HOST_PERIPH(XCVR_RX_DIG),
+#endif
+#ifdef XCVR_MISC
+    HOST_PERIPH(XCVR_MISC),
+#endif
+#ifdef XCVR_ANALOG
+    HOST_PERIPH(XCVR_ANALOG),
+#endif
+#ifdef XCVR_2P4GHZ_PHY
+    HOST_PERIPH(XCVR_2P4GHZ_PHY),
+#endif
+#ifdef GEN4PHY
+    HOST_PERIPH(GEN4PHY),
+#endif
+#ifdef RBME
+    HOST_PERIPH(RBME),
+#endif
+#ifdef RADIO_CTRL
+    HOST_PERIPH(RADIO_CTRL),
+#endif
+#ifdef RFMC
+    HOST_PERIPH(RFMC),
+#endif
+#ifdef RSIM
+    HOST_PERIPH(RSIM),
+#endif
+#ifdef SIM
+    HOST_PERIPH(SIM),
+#endif
+#ifdef CIU2
+    HOST_PERIPH(CIU2),
+#endif
+#ifdef BTLE_RF
+    HOST_PERIPH(BTLE_RF),
+#endif
+#ifdef GENFSK
+    HOST_PERIPH(GENFSK),
+#endif
+#ifdef ZLL
+    HOST_PERIPH(ZLL),
+#endif
+#ifdef TX_PACKET_RAM
+    HOST_PERIPH(TX_PACKET_RAM),
+#endif
+#ifdef RX_PACKET_RAM
+    HOST_PERIPH(RX_PACKET_RAM),
+#endif
+};
+
+#define BENCH_NUM_PERIPHS (sizeof(bench_periphs) / sizeof(bench_periphs[0]))
+
+static const bench_config_t bench_configs[] = {
+    BENCH_CONFIG(fsk_h_0p5_1mbps),
+    BENCH_CONFIG(fsk_h_0p5_500kbps),
+    BENCH_CONFIG(fsk_h_0p5_250kbps),
+    BENCH_CONFIG(gfsk_bt_0p3_h_0p5_1mbps),
+    BENCH_CONFIG(gfsk_bt_0p3_h_0p5_500kbps),
+    BENCH_CONFIG(gfsk_bt_0p3_h_0p5_250kbps),
+    BENCH_CONFIG(gfsk_bt_0p5_h_0p32_1mbps),
+    BENCH_CONFIG(gfsk_bt_0p5_h_0p32_500kbps),
+    BENCH_CONFIG(gfsk_bt_0p5_h_0p32_250kbps),
+    BENCH_CONFIG(gfsk_bt_0p5_h_0p5_1mbps),
+    BENCH_CONFIG(gfsk_bt_0p5_h_0p5_500kbps),
+    BENCH_CONFIG(gfsk_bt_0p5_h_0p5_250kbps),
+    BENCH_CONFIG(gfsk_bt_0p5_h_0p7_1mbps),
+    BENCH_CONFIG(gfsk_bt_0p5_h_0p7_500kbps),
+    BENCH_CONFIG(gfsk_bt_0p5_h_0p7_250kbps),
+    BENCH_CONFIG(gfsk_bt_0p5_h_1p0_1mbps),
+    BENCH_CONFIG(gfsk_bt_0p5_h_1p0_500kbps),
+    BENCH_CONFIG(gfsk_bt_0p5_h_1p0_250kbps),
+    BENCH_CONFIG(gfsk_bt_0p7_h_0p5_1mbps),
+    BENCH_CONFIG(gfsk_bt_0p7_h_0p5_500kbps),
+    BENCH_CONFIG(gfsk_bt_0p7_h_0p5_250kbps),
+    BENCH_CONFIG(gfsk_bt_1p0_h_0p5_1mbps),
+    BENCH_CONFIG(gfsk_bt_2p0_h_0p5_1mbps),
+    BENCH_CONFIG(msk_1mbps),
+    BENCH_CONFIG(msk_500kbps),
+    BENCH_CONFIG(msk_250kbps),
+    BENCH_CONFIG(oqpsk_802p15p4_250kbps),
+};
+
+#define BENCH_NUM_CONFIGS (sizeof(bench_configs) / sizeof(bench_configs[0]))
+
+static const char *const bench_api_names[BENCH_NUM_APIS] = {
+    "XCVR_Init",
+    "XCVR_ChangeMode",
+    "XCVR_OverrideChannel",
+    "XCVR_LCL_RsmInit",
+    "XCVR_OverrideTxFrequency",
+    "XCVR_HopToIndex",
+    "XCVR_HopScheduleNext",
+    "XCVR_LCL_CalibratePll",
+    "XCVR_LCL_CalibratePllProcess",
+    "XCVR_GetInstantRssi",
+    "XCVR_EdScan",
+};
+
+/* Calls with no hardware poll, that can be timed on the open register file */
+static const bool bench_api_timed[BENCH_NUM_APIS] = {
+    [BENCH_API_OVERRIDE_CHANNEL] = true,
+    [BENCH_API_OVERRIDE_TX_FREQ] = true,
+    [BENCH_API_HOP]              = true,
+    [BENCH_API_HOP_SCHEDULE]     = true,
+};
+
+/* BLE channels, with a repeated channel that needs no register write */
+static const uint8_t bench_hop_channels[BENCH_NUM_HOPS] = {0U,  7U,  14U, 21U, 28U, 35U, 3U,  10U, 10U, 17U,
+                                                           24U, 31U, 38U, 6U,  13U, 20U, 27U, 34U, 2U,  39U};
+static xcvr_hop_schedule_t bench_hop_schedule;
+
+/* Channel Sounding channels, including the 2442MHz one of the curve fit */
+static const channel_num_t bench_cal_channels[BENCH_NUM_CAL_CHANNELS] = {0U, 20U, 40U, 78U};
+static xcvr_lcl_pll_cal_data_t bench_cal_results[BENCH_NUM_CAL_CHANNELS];
+static const pll_cal_handler_t bench_cal_handler = {bench_cal_done, NULL};
+
+/* BLE channels of the energy detect scans */
+static const uint8_t bench_scan_channels[BENCH_NUM_SCAN_CHANNELS] = {0U, 5U, 10U, 15U, 20U, 25U, 30U, 35U};
+static xcvr_ed_scan_t bench_scan;
+
+/* SQTE settings within the limits of both radio generations */
+static const xcvr_lcl_rsm_config_t bench_rsm_config = {
+    .op_mode       = XCVR_RSM_SQTE_MODE,
+    .num_steps     = 4U,
+    .t_fc          = 80U,
+    .t_ip1         = 80U,
+    .t_ip2         = 80U,
+    .t_pm0         = 40U,
+    .trig_sel      = XCVR_RSM_TRIG_SW,
+    .num_ant_path  = 1U,
+    .rate          = XCVR_RSM_RATE_1MBPS,
+    .averaging_win = XCVR_RSM_AVG_WIN_DISABLED,
+    .iq_out_sel    = XCVR_RSM_IQ_OUT_DIS,
+    .role          = XCVR_RSM_RX_MODE,
+};
+
+static host_map_t bench_regs; /* Pages of the stand-in register file */
+static uintptr_t bench_open[BENCH_MAX_OPEN]; /* Pages opened for the instruction being single stepped */
+static uint32_t bench_num_open = 0U;
+
+static volatile bench_counts_t bench_counts;
+static uintptr_t bench_last_addr     = 0U;   /* Register of the previous access */
+static bool bench_last_write         = true; /* The previous access is a write */
+static bench_read_t bench_reads[BENCH_MAX_READS]; /* Reads since the last register write */
+static uint32_t bench_num_reads      = 0U;
+static uint32_t bench_next_read      = 0U;   /* Order of the next first read */
+static uint32_t bench_poll_reads     = 0U;   /* Reads since the last register write */
+static bench_read_t *bench_prev_read = NULL; /* Entry of the previous read */
+static sigjmp_buf bench_abort;
+
+static char bench_lines[BENCH_MAX_LINES][BENCH_LINE_LEN]; /* Previous report */
+static uint32_t bench_num_lines = 0U;
+
+/*******************************************************************************
+ * Code
+ *******************************************************************************/
+static void bench_close_pages(void)
+{
+    while (bench_num_open > 0U)
+    {
+        bench_num_open--;
+        (void)mprotect((void *)bench_open[bench_num_open], bench_regs.page_size, PROT_NONE);
+    }
+}
+
+static void bench_read(uintptr_t pc, uintptr_t addr)
+{
+    bench_read_t *entry = NULL;
+    uint32_t pattern;
+    uint32_t i;
+
+    bench_counts.reads++;
+    bench_poll_reads++;
+    for (i = 0U; (i < bench_num_reads) && (entry == NULL); i++)
+    {
+        if ((bench_reads[i].pc == pc) && (bench_reads[i].addr == addr))
+        {
+            entry = &bench_reads[i];
+        }
+    }
+
+    if ((bench_prev_read != NULL) && (bench_prev_read->repeats > 0U) &&
+        ((entry == NULL) || (entry->order > bench_prev_read->order)))
+    {
+        /* The poll went on to a later read, the previous register now meets the poll condition */
+        bench_prev_read->frozen = true;
+    }
+
+    if (entry == NULL)
+    {
+        if (bench_num_reads < BENCH_MAX_READS)
+        {
+            entry = &bench_reads[bench_num_reads];
+            bench_num_reads++;
+        }
+        else
+        {
+            entry = &bench_reads[bench_next_read % BENCH_MAX_READS]; /* Replaces the oldest read */
+        }
+        entry->pc      = pc;
+        entry->addr    = addr;
+        entry->order   = bench_next_read;
+        entry->repeats = 0U;
+        entry->frozen  = false;
+        bench_next_read++;
+    }
+    else
+    {
+        if (entry->repeats == 0U)
+        {
+            bench_counts.polls++;
+        }
+        entry->repeats++;
+        bench_counts.poll_iters++;
+        if ((!entry->frozen && (entry->repeats >= (BENCH_POLL_LIMIT + BENCH_NUM_PATTERNS))) ||
+            (bench_poll_reads > BENCH_MAX_POLL_READS))
+        {
+            bench_counts.stuck++;
+            bench_close_pages();
+            siglongjmp(bench_abort, 1);
+        }
+        else if (!entry->frozen && (entry->repeats >= BENCH_POLL_LIMIT))
+        {
+            /* All ones, all zeros then each byte value in the four bytes of the register */
+            pattern = entry->repeats - BENCH_POLL_LIMIT;
+            *(volatile uint32_t *)addr =
+                (pattern == 0U) ? 0xFFFFFFFFU : ((pattern == 1U) ? 0U : ((pattern - 2U) * 0x01010101U));
+        }
+        else
+        {
+            /* Not polled long enough, or the register already meets the poll condition */
+        }
+    }
+    bench_prev_read = entry;
+}
+
+static void bench_segv(int sig, siginfo_t *info, void *context)
+{
+    ucontext_t *uc = (ucontext_t *)context;
+    uintptr_t addr = (uintptr_t)info->si_addr & ~(uintptr_t)3U;
+    uintptr_t page = addr & ~(bench_regs.page_size - 1U);
+    bool is_write  = ((uc->uc_mcontext.gregs[REG_ERR] & BENCH_PF_WRITE) != 0);
+
+    if (!host_map_has_page(&bench_regs, page) || (bench_num_open >= BENCH_MAX_OPEN))
+    {
+        /* Not a register access, the fault is genuine */
+        (void)signal(sig, SIG_DFL);
+    }
+    else
+    {
+        (void)mprotect((void *)page, bench_regs.page_size, PROT_READ | PROT_WRITE);
+        bench_open[bench_num_open] = page;
+        bench_num_open++;
+
+        if (is_write)
+        {
+            bench_counts.writes++;
+            if ((addr == bench_last_addr) && !bench_last_write)
+            {
+                bench_counts.rmw++;
+            }
+            /* A write starts a new poll */
+            bench_num_reads  = 0U;
+            bench_next_read  = 0U;
+            bench_poll_reads = 0U;
+            bench_prev_read  = NULL;
+        }
+        else
+        {
+            bench_read((uintptr_t)uc->uc_mcontext.gregs[REG_RIP], addr);
+        }
+        bench_last_addr  = addr;
+        bench_last_write = is_write;
+
+        uc->uc_mcontext.gregs[REG_EFL] |= BENCH_EFLAGS_TF;
+    }
+}
+
+static void bench_trap(int sig, siginfo_t *info, void *context)
+{
+    ucontext_t *uc = (ucontext_t *)context;
+
+    (void)sig;
+    (void)info;
+    bench_close_pages();
+    uc->uc_mcontext.gregs[REG_EFL] &= ~BENCH_EFLAGS_TF;
+}
+
+static void bench_reset_regs(void)
+{
+    uint32_t i;
+
+    host_map_protect(&bench_regs, PROT_READ | PROT_WRITE);
+    for (i = 0U; i < bench_regs.num_pages; i++)
+    {
+        (void)memset((void *)bench_regs.pages[i], 0, bench_regs.page_size);
+    }
+    host_map_protect(&bench_regs, PROT_NONE);
+}
+
+static int bench_call(bench_api_t api, const xcvr_config_t *config)
+{
+    const xcvr_coding_config_t *coding_config = &xcvr_ble_uncoded_config;
+    uint32_t i;
+    int status;
+
+    switch (api)
+    {
+        case BENCH_API_INIT:
+            status = (int)XCVR_Init(&config, &coding_config);
+            break;
+        case BENCH_API_CHANGE_MODE:
+            status = (int)XCVR_ChangeMode(&config, &coding_config);
+            break;
+        case BENCH_API_OVERRIDE_CHANNEL:
+            status = (int)XCVR_OverrideChannel(BENCH_CHANNEL);
+            break;
+        case BENCH_API_OVERRIDE_TX_FREQ:
+            status = (int)XCVR_OverrideTxFrequency(BENCH_HOP_FREQ);
+            break;
+        case BENCH_API_HOP:
+            status = (int)XCVR_HopToIndex(XCVR_HOP_TABLE_INDEX(BENCH_HOP_FREQ));
+            break;
+        case BENCH_API_HOP_SCHEDULE:
+            status = (int)XCVR_HopScheduleNext(&bench_hop_schedule);
+            break;
+        case BENCH_API_CALIBRATE_PLL:
+            status = (int)XCVR_LCL_CalibratePll(bench_cal_channels, bench_cal_results, BENCH_NUM_CAL_CHANNELS, true,
+                                                XCVR_RSM_RATE_1MBPS);
+            break;
+        case BENCH_API_CALIBRATE_PLL_PROCESS:
+            status = (int)XCVR_LCL_CalibratePllProcess();
+            break;
+        case BENCH_API_INSTANT_RSSI_SCAN:
+            /* The channel by channel scan replaced by XCVR_EdScan() */
+            status = 0;
+            for (i = 0U; i < BENCH_NUM_SCAN_CHANNELS; i++)
+            {
+                status |= (int)XCVR_OverrideChannel(bench_scan_channels[i]);
+                bench_scan.ed_dbm[i] = (int8_t)XCVR_GetInstantRssi();
+                XCVR_WaitRxTxWd();
+            }
+            break;
+        case BENCH_API_ED_SCAN:
+            status = (int)XCVR_EdScan(bench_scan_channels, BENCH_NUM_SCAN_CHANNELS, NULLPTR, &bench_scan);
+            break;
+        default:
+            status = (int)XCVR_LCL_RsmInit(&bench_rsm_config);
+            break;
+    }
+
+    return status;
+}
+
+static int bench_measure(bench_api_t api, const xcvr_config_t *config, bench_counts_t *counts)
+{
+    const xcvr_config_t *ref_config           = bench_configs[BENCH_REF_CONFIG].config;
+    const xcvr_coding_config_t *coding_config = &xcvr_ble_uncoded_config;
+    volatile int status                        = 0;
+
+    if (sigsetjmp(bench_abort, 1) == 0)
+    {
+        /* Starting state of the measured call, not counted */
+        XCVR_Deinit();
+        bench_reset_regs();
+        if (api != BENCH_API_INIT)
+        {
+            status = (int)XCVR_Init((api == BENCH_API_OVERRIDE_CHANNEL) ? &config : &ref_config, &coding_config);
+        }
+        if (api == BENCH_API_HOP)
+        {
+            status = (int)XCVR_HopTableStart(0U);
+        }
+        if (api == BENCH_API_HOP_SCHEDULE)
+        {
+            status = (int)XCVR_HopScheduleInit(&bench_hop_schedule, bench_hop_channels, BENCH_NUM_HOPS, BENCH_DWELL_US);
+            status |= (int)XCVR_HopScheduleNext(&bench_hop_schedule);
+        }
+        if ((api == BENCH_API_CALIBRATE_PLL) || (api == BENCH_API_CALIBRATE_PLL_PROCESS))
+        {
+            (void)XCVR_LCL_CalibratePllAbort(); /* From an abandoned measurement */
+            status |= (int)XCVR_LCL_RsmInit(&bench_rsm_config);
+        }
+        if (api == BENCH_API_CALIBRATE_PLL_PROCESS)
+        {
+            status |= (int)XCVR_LCL_CalibratePllStart(bench_cal_channels, bench_cal_results, BENCH_NUM_CAL_CHANNELS,
+                                                      true, XCVR_RSM_RATE_1MBPS, &bench_cal_handler);
+            /* End of the TX warmup */
+            XCVR_MISC->XCVR_STATUS = (((XCVR_TSM->END_OF_SEQ & XCVR_TSM_END_OF_SEQ_END_OF_TX_WU_MASK) >>
+                                       XCVR_TSM_END_OF_SEQ_END_OF_TX_WU_SHIFT)
+                                      << XCVR_MISC_XCVR_STATUS_TSM_COUNT_SHIFT) &
+                                     XCVR_MISC_XCVR_STATUS_TSM_COUNT_MASK;
+        }
+
+        (void)memset((void *)&bench_counts, 0, sizeof(bench_counts));
+        bench_last_addr  = 0U;
+        bench_last_write = true;
+        bench_num_reads  = 0U;
+        bench_next_read  = 0U;
+        bench_poll_reads = 0U;
+        bench_prev_read  = NULL;
+        status = bench_call(api, config);
+    }
+    (void)memcpy(counts, (const void *)&bench_counts, sizeof(*counts));
+
+    return status;
+}
+
+/* Host latency per call, from the state left by bench_measure() */
+static uint32_t bench_time(bench_api_t api, const xcvr_config_t *config)
+{
+    struct timespec start;
+    struct timespec end;
+    uint64_t elapsed = 0U;
+    uint32_t i;
+
+    if (bench_api_timed[api])
+    {
+        host_map_protect(&bench_regs, PROT_READ | PROT_WRITE);
+        (void)clock_gettime(CLOCK_MONOTONIC, &start);
+        for (i = 0U; i < BENCH_TIMING_CALLS; i++)
+        {
+            (void)bench_call(api, config);
+        }
+        (void)clock_gettime(CLOCK_MONOTONIC, &end);
+        host_map_protect(&bench_regs, PROT_NONE);
+        elapsed = ((uint64_t)(end.tv_sec - start.tv_sec) * 1000000000ULL) + (uint64_t)end.tv_nsec -
+                  (uint64_t)start.tv_nsec;
+    }
+
+    return (uint32_t)(elapsed / BENCH_TIMING_CALLS);
+}
+
+static int bench_compare(const char *line, const char *key)
+{
+    bench_counts_t now;
+    bench_counts_t before;
+    size_t key_len = strlen(key);
+    uint32_t i;
+    int status = 0;
+    int dummy;
+
+    for (i = 0U; (i < bench_num_lines) && (strncmp(bench_lines[i], key, key_len) != 0); i++)
+    {
+    }
+    if (i == bench_num_lines)
+    {
+        (void)fprintf(stderr, "not in the previous report: %s\n", key);
+        status = 1;
+    }
+    else if ((sscanf(line + key_len, "\"status\":%d,\"reads\":%u,\"writes\":%u,\"rmw\":%u,\"polls\":%u", &dummy,
+                     &now.reads, &now.writes, &now.rmw, &now.polls) != 5) ||
+             (sscanf(bench_lines[i] + key_len, "\"status\":%d,\"reads\":%u,\"writes\":%u,\"rmw\":%u,\"polls\":%u",
+                     &dummy, &before.reads, &before.writes, &before.rmw, &before.polls) != 5))
+    {
+        (void)fprintf(stderr, "unreadable previous report line: %s\n", bench_lines[i]);
+        status = 1;
+    }
+    else if ((now.reads > before.reads) || (now.writes > before.writes) || (now.polls > before.polls))
+    {
+        (void)fprintf(stderr, "regression: %s reads %u -> %u, writes %u -> %u, polls %u -> %u\n", key, before.reads,
+                      now.reads, before.writes, now.writes, before.polls, now.polls);
+        status = 1;
+    }
+    else
+    {
+        /* No more register traffic than before */
+    }
+
+    return status;
+}
+
+static void bench_cal_done(void *userData, xcvrLclStatus_t status, uint16_t num_done)
+{
+    (void)userData;
+    (void)status;
+    (void)num_done;
+}
+
+/* Every hop of the schedule must leave CHAN_MAP as XCVR_OverrideChannel() does, register accesses are not counted */
+static int bench_check_hop_schedule(void)
+{
+    const xcvr_config_t *ref_config           = bench_configs[BENCH_REF_CONFIG].config;
+    const xcvr_coding_config_t *coding_config = &xcvr_ble_uncoded_config;
+    const uint8_t bad_channels[2]             = {0U, 40U};
+    volatile int status                       = 1;
+    uint32_t hop_chan_map;
+    uint32_t i;
+
+    if (sigsetjmp(bench_abort, 1) == 0)
+    {
+        XCVR_Deinit();
+        bench_reset_regs();
+        status = (int)XCVR_Init(&ref_config, &coding_config);
+        status |= (int)XCVR_HopScheduleInit(&bench_hop_schedule, bench_hop_channels, BENCH_NUM_HOPS, BENCH_DWELL_US);
+        for (i = 0U; (i < (2U * BENCH_NUM_HOPS)) && (status == 0); i++)
+        {
+            status       = (int)XCVR_HopScheduleNext(&bench_hop_schedule);
+            hop_chan_map = XCVR_PLL_DIG->CHAN_MAP;
+            status |= (int)XCVR_OverrideChannel(bench_hop_channels[i % BENCH_NUM_HOPS]);
+            if ((status == 0) && (hop_chan_map != XCVR_PLL_DIG->CHAN_MAP))
+            {
+                (void)fprintf(stderr, "XCVR_HopScheduleNext: CHAN_MAP 0x%08x instead of 0x%08x on hop %u\n",
+                              hop_chan_map, XCVR_PLL_DIG->CHAN_MAP, i);
+                status = 1;
+            }
+        }
+
+        /* A sequence with an invalid channel is rejected and leaves an empty schedule */
+        if ((status == 0) && ((XCVR_HopScheduleInit(&bench_hop_schedule, bad_channels, 2U, BENCH_DWELL_US) !=
+                               gXcvrInvalidParameters_c) ||
+                              (XCVR_HopScheduleNext(&bench_hop_schedule) != gXcvrInvalidConfiguration_c)))
+        {
+            (void)fprintf(stderr, "XCVR_HopScheduleInit: invalid channel accepted\n");
+            status = 1;
+        }
+    }
+    else
+    {
+        (void)fprintf(stderr, "XCVR_HopScheduleNext: stuck poll\n");
+    }
+
+    return status;
+}
+
+static int bench_report(bench_api_t api, uint32_t config_idx)
+{
+    bench_counts_t counts;
+    char key[BENCH_LINE_LEN];
+    char line[BENCH_LINE_LEN];
+    uint32_t ns;
+    int key_len;
+    int line_len;
+    int call_status;
+    int status = 0;
+
+    call_status = bench_measure(api, bench_configs[config_idx].config, &counts);
+    ns          = (counts.stuck == 0U) ? bench_time(api, bench_configs[config_idx].config) : 0U;
+
+    key_len = snprintf(key, sizeof(key), "{\"gen\":%u,\"api\":\"%s\",\"config\":\"%s\",", (unsigned int)NXP_RADIO_GEN,
+                       bench_api_names[api], bench_configs[config_idx].name);
+    line_len = snprintf(line, sizeof(line),
+                        "%s\"status\":%d,\"reads\":%u,\"writes\":%u,\"rmw\":%u,\"polls\":%u,\"poll_iters\":%u,"
+                        "\"stuck\":%u,\"ns\":%u}",
+                        key, call_status, counts.reads, counts.writes, counts.rmw, counts.polls, counts.poll_iters,
+                        counts.stuck, ns);
+    /* A truncated line could neither be compared with the previous report nor be read back by the next run */
+    if ((key_len < 0) || ((size_t)key_len >= sizeof(key)) || (line_len < 0) || ((size_t)line_len >= sizeof(line)))
+    {
+        (void)fprintf(stderr, "report line longer than %u characters: %s\n", BENCH_LINE_LEN - 1U, key);
+        status = 1;
+    }
+    else
+    {
+        (void)printf("%s\n", line);
+        if (counts.stuck != 0U)
+        {
+            (void)fprintf(stderr, "stuck poll: %s\n", key);
+            status = 1;
+        }
+        if ((bench_num_lines > 0U) && (bench_compare(line, key) != 0))
+        {
+            status = 1;
+        }
+    }
+
+    return status;
+}
+
+int main(int argc, char *argv[])
+{
+    struct sigaction action;
+    FILE *previous;
+    uint32_t i;
+    int status = 0;
+
+    if (argc > 1)
+    {
+        previous = fopen(argv[1], "r");
+        if (previous == NULL)
+        {
+            (void)fprintf(stderr, "cannot open %s\n", argv[1]);
+            status = 1;
+        }
+        else
+        {
+            while ((bench_num_lines < BENCH_MAX_LINES) &&
+                   (fgets(bench_lines[bench_num_lines], (int)BENCH_LINE_LEN, previous) != NULL))
+            {
+                bench_num_lines++;
+            }
+            (void)fclose(previous);
+        }
+    }
+
+    (void)memset(&action, 0, sizeof(action));
+    action.sa_flags     = SA_SIGINFO | SA_NODEFER;
+    action.sa_sigaction = bench_segv;
+    (void)sigaction(SIGSEGV, &action, NULL);
+    action.sa_sigaction = bench_trap;
+    (void)sigaction(SIGTRAP, &action, NULL);
+
+    if ((status == 0) && (host_map(&bench_regs, bench_periphs, BENCH_NUM_PERIPHS, PROT_NONE) == 0))
+    {
+        for (i = 0U; i < BENCH_NUM_CONFIGS; i++)
+        {
+            status |= bench_report(BENCH_API_INIT, i);
+            status |= bench_report(BENCH_API_CHANGE_MODE, i);
+            status |= bench_report(BENCH_API_OVERRIDE_CHANNEL, i);
+        }
+        status |= bench_report(BENCH_API_RSM_INIT, BENCH_REF_CONFIG);
+        status |= bench_report(BENCH_API_OVERRIDE_TX_FREQ, BENCH_REF_CONFIG);
+        status |= bench_report(BENCH_API_HOP, BENCH_REF_CONFIG);
+        status |= bench_report(BENCH_API_HOP_SCHEDULE, BENCH_REF_CONFIG);
+        status |= bench_report(BENCH_API_CALIBRATE_PLL, BENCH_REF_CONFIG);
+        status |= bench_report(BENCH_API_CALIBRATE_PLL_PROCESS, BENCH_REF_CONFIG);
+        status |= bench_report(BENCH_API_INSTANT_RSSI_SCAN, BENCH_REF_CONFIG);
+        status |= bench_report(BENCH_API_ED_SCAN, BENCH_REF_CONFIG);
+        status |= (bench_check_hop_schedule() != 0) ? 1 : 0;
+    }
+    else
+    {
+        status = 1;
+    }
+
+    return status;
+}
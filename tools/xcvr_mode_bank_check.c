@@ -0,0 +1,197 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Host encoder and validator for packet RAM mode banks (KW47 and later).
+ *
+ * Every mode and data rate configuration is encoded with XCVR_RadioGenModeBankEncode() exactly as
+ * XCVR_ModeBankLoad() places it in packet RAM, then checked with XCVR_RadioGenModeBankValidate(). The validator itself
+ * is exercised with corrupted copies of each list, which it must reject. The tool reports the packet RAM footprint of
+ * each configuration so the content of a mode bank (XCVR_MODE_BANK_MAX_MODES) can be sized against the PKT RAM left
+ * free by the application.
+ *
+ * Build it on the host against the device headers of the target and the gen47 configuration sources:
+ *
+ *   gcc -DNXP_RADIO_GEN=470 -DRF_OSC_26MHZ=0 -I<device headers> -Idrv -Idrv/nb2p4ghz \
+ *       -Idrv/nb2p4ghz/configs/gen47 tools/xcvr_mode_bank_check.c drv/nb2p4ghz/configs/gen47/nxp_xcvr_*.c \
+ *       drv/nb2p4ghz/nxp_xcvr_blob.c -o xcvr_mode_bank_check
+ *   ./xcvr_mode_bank_check
+ *
+ * The exit status is non zero if any list fails to encode or validate, or if a corrupted list is accepted.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "nxp2p4_xcvr.h"
+#include "nxp_xcvr_common_config.h"
+#include "nxp_xcvr_fsk_h_0p5_config.h"
+#include "nxp_xcvr_gfsk_bt_0p3_h_0p5_config.h"
+#include "nxp_xcvr_gfsk_bt_0p5_h_0p32_config.h"
+#include "nxp_xcvr_gfsk_bt_0p5_h_0p5_config.h"
+#include "nxp_xcvr_gfsk_bt_0p5_h_0p7_config.h"
+#include "nxp_xcvr_gfsk_bt_0p5_h_1p0_config.h"
+#include "nxp_xcvr_gfsk_bt_0p7_h_0p5_config.h"
+#include "nxp_xcvr_gfsk_bt_1p0_h_0p5_config.h"
+#include "nxp_xcvr_gfsk_bt_2p0_h_0p5_config.h"
+#include "nxp_xcvr_msk_config.h"
+#include "nxp_xcvr_oqpsk_802p15p4_config.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/* Worst case list size: one descriptor and one value per register plus the terminating descriptor */
+#define CHK_MAX_WORDS ((2U * XCVR_REG_IMAGE_NUM_REGS) + 1U)
+
+/* Configurations to check, named after their xcvr_config_t without the _full_config suffix */
+#define CHK_CONFIG(name) {#name, &name##_full_config}
+
+typedef struct
+{
+    const char *name;
+    const xcvr_config_t *config;
+} chk_config_t;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+static int chk_corrupted(const char *name, const uint32_t *blob, uint16_t num_words);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static const chk_config_t chk_configs[] = {
+    CHK_CONFIG(xcvr_fsk_h_0p5_1mbps),
+    CHK_CONFIG(xcvr_fsk_h_0p5_500kbps),
+    CHK_CONFIG(xcvr_fsk_h_0p5_250kbps),
+    CHK_CONFIG(xcvr_gfsk_bt_0p3_h_0p5_1mbps),
+    CHK_CONFIG(xcvr_gfsk_bt_0p3_h_0p5_500kbps),
+    CHK_CONFIG(xcvr_gfsk_bt_0p3_h_0p5_250kbps),
+    CHK_CONFIG(xcvr_gfsk_bt_0p5_h_0p32_1mbps),
+    CHK_CONFIG(xcvr_gfsk_bt_0p5_h_0p32_500kbps),
+    CHK_CONFIG(xcvr_gfsk_bt_0p5_h_0p32_250kbps),
+    CHK_CONFIG(xcvr_gfsk_bt_0p5_h_0p5_1mbps),
+    CHK_CONFIG(xcvr_gfsk_bt_0p5_h_0p5_500kbps),
+    CHK_CONFIG(xcvr_gfsk_bt_0p5_h_0p5_250kbps),
+    CHK_CONFIG(xcvr_gfsk_bt_0p5_h_0p7_1mbps),
+    CHK_CONFIG(xcvr_gfsk_bt_0p5_h_0p7_500kbps),
+    CHK_CONFIG(xcvr_gfsk_bt_0p5_h_0p7_250kbps),
+    CHK_CONFIG(xcvr_gfsk_bt_0p5_h_1p0_1mbps),
+    CHK_CONFIG(xcvr_gfsk_bt_0p5_h_1p0_500kbps),
+    CHK_CONFIG(xcvr_gfsk_bt_0p5_h_1p0_250kbps),
+    CHK_CONFIG(xcvr_gfsk_bt_0p7_h_0p5_1mbps),
+    CHK_CONFIG(xcvr_gfsk_bt_0p7_h_0p5_500kbps),
+    CHK_CONFIG(xcvr_gfsk_bt_0p7_h_0p5_250kbps),
+    CHK_CONFIG(xcvr_gfsk_bt_1p0_h_0p5_1mbps),
+    CHK_CONFIG(xcvr_gfsk_bt_2p0_h_0p5_1mbps),
+    CHK_CONFIG(xcvr_msk_1mbps),
+    CHK_CONFIG(xcvr_msk_500kbps),
+    CHK_CONFIG(xcvr_msk_250kbps),
+    CHK_CONFIG(xcvr_oqpsk_802p15p4_250kbps),
+};
+
+#define CHK_NUM_CONFIGS (sizeof(chk_configs) / sizeof(chk_configs[0]))
+
+/*******************************************************************************
+ * Code
+ *******************************************************************************/
+static int chk_corrupted(const char *name, const uint32_t *blob, uint16_t num_words)
+{
+    uint32_t copy[CHK_MAX_WORDS + 1U];
+    uint16_t last     = 0U;
+    uint16_t word_idx = 0U;
+    int status = 0;
+
+    /* Locate the last descriptor before the terminating one */
+    while (blob[word_idx] != 0U)
+    {
+        last = word_idx;
+        word_idx += (uint16_t)(((blob[word_idx] & PR2IPS_COUNT_MASK) >> PR2IPS_COUNT_SHIFT) + 1U);
+    }
+
+    /* Missing terminating descriptor */
+    if (XCVR_RadioGenModeBankValidate(blob, (uint16_t)(num_words - 1U)) == gXcvrSuccess_c)
+    {
+        (void)fprintf(stderr, "%s: truncated list accepted\n", name);
+        status = 1;
+    }
+
+    /* Trailing words after the terminating descriptor */
+    (void)memcpy(copy, blob, num_words * sizeof(uint32_t));
+    copy[num_words] = 0U;
+    if (XCVR_RadioGenModeBankValidate(copy, (uint16_t)(num_words + 1U)) == gXcvrSuccess_c)
+    {
+        (void)fprintf(stderr, "%s: trailing words accepted\n", name);
+        status = 1;
+    }
+
+    /* Reserved transfer type */
+    (void)memcpy(copy, blob, num_words * sizeof(uint32_t));
+    copy[0] |= PR2IPS_TYPE_MASK;
+    if (XCVR_RadioGenModeBankValidate(copy, num_words) == gXcvrSuccess_c)
+    {
+        (void)fprintf(stderr, "%s: reserved transfer type accepted\n", name);
+        status = 1;
+    }
+
+    /* Burst running over the terminating descriptor */
+    (void)memcpy(copy, blob, num_words * sizeof(uint32_t));
+    copy[last] += PR2IPS_COUNT(1U);
+    if (((blob[last] & PR2IPS_COUNT_MASK) != PR2IPS_COUNT_MASK) &&
+        (XCVR_RadioGenModeBankValidate(copy, num_words) == gXcvrSuccess_c))
+    {
+        (void)fprintf(stderr, "%s: overlong burst accepted\n", name);
+        status = 1;
+    }
+
+    /* Register outside of the radio register setup */
+    (void)memcpy(copy, blob, num_words * sizeof(uint32_t));
+    copy[0] = (copy[0] & ~PR2IPS_ADDR_MASK) | PR2IPS_ADDR(PR2IPS_ADDR_MASK & ~0x3U);
+    if (XCVR_RadioGenModeBankValidate(copy, num_words) == gXcvrSuccess_c)
+    {
+        (void)fprintf(stderr, "%s: foreign register accepted\n", name);
+        status = 1;
+    }
+
+    return status;
+}
+
+int main(void)
+{
+    uint32_t blob[CHK_MAX_WORDS];
+    uint16_t num_words;
+    uint32_t i;
+    int status = 0;
+
+    (void)printf("%-36s %6s\n", "configuration", "words");
+    for (i = 0U; i < CHK_NUM_CONFIGS; i++)
+    {
+        num_words = 0U;
+        if (XCVR_RadioGenModeBankEncode(chk_configs[i].config, blob, (uint16_t)CHK_MAX_WORDS, &num_words) !=
+            gXcvrSuccess_c)
+        {
+            (void)fprintf(stderr, "%s: encode failed\n", chk_configs[i].name);
+            status = 1;
+        }
+        else if (XCVR_RadioGenModeBankValidate(blob, num_words) != gXcvrSuccess_c)
+        {
+            (void)fprintf(stderr, "%s: encoded list is invalid\n", chk_configs[i].name);
+            status = 1;
+        }
+        else
+        {
+            if (chk_corrupted(chk_configs[i].name, blob, num_words) != 0)
+            {
+                status = 1;
+            }
+            (void)printf("%-36s %6u\n", chk_configs[i].name, (unsigned int)num_words);
+        }
+    }
+
+    (void)printf("PKT RAM words: TX %u, RX %u\n", (unsigned int)TX_PACKET_RAM_PACKET_RAM_COUNT,
+                 (unsigned int)RX_PACKET_RAM_PACKET_RAM_COUNT);
+
+    return status;
+}
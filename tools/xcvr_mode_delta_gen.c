@@ -0,0 +1,411 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Host generator for sparse (base plus delta) mode and data rate configurations.
+ *
+ * The mode and data rate configurations of a radio generation are nearly identical. This tool computes a shared base
+ * configuration (the most common initializer of every word over all configurations) and emits one
+ * xcvr_mode_delta_config_t per configuration holding only the words which differ from that base.
+ *
+ * The comparison is done on the initializers of the nxp_xcvr_<mode>_config.c sources (see xcvr_cfg_parse.h), not on
+ * their values, and the initializers are copied as they are (RF_OSC_26MHZ conditionals included) into the generated
+ * tables. The output is therefore the same whatever device headers the tool is built against, and it holds the
+ * register values of the headers it is compiled with. Two initializers written differently but with the same value
+ * are kept as a delta, which only costs flash.
+ *
+ * Before writing anything, every sparse configuration is rebuilt from the values of the linked configurations,
+ * expanded with XCVR_RadioGenModeDeltaExpand() and compared against the original structure; the tool fails if any of
+ * them does not match, which also catches a word layout not matching the parsed structure definition.
+ *
+ * Build it on the host against the device headers of the target and the configuration sources of the matching radio
+ * generation, then run it on that generation's configs folder, e.g. for KW47:
+ *
+ *   gcc -DNXP_RADIO_GEN=470 -DRF_OSC_26MHZ=0 -I<device headers> -Idrv -Idrv/nb2p4ghz \
+ *       -Idrv/nb2p4ghz/configs/gen47 tools/xcvr_mode_delta_gen.c tools/xcvr_cfg_parse.c \
+ *       drv/nb2p4ghz/configs/gen47/nxp_xcvr_*.c drv/nb2p4ghz/nxp_xcvr_blob.c -o xcvr_mode_delta_gen
+ *   ./xcvr_mode_delta_gen drv/nb2p4ghz/configs/gen47
+ *
+ * The generated nxp_xcvr_mode_deltas.c/.h must be regenerated whenever a configuration file changes. Applications
+ * using only the sparse configurations no longer link the full xcvr_<mode>_<rate>_config structures. The report has
+ * one JSON object per configuration and a total, for instance:
+ *   {"config":"xcvr_msk_1mbps","num_deltas":36,"bytes":212,"full_bytes":412}
+ *   {"num_configs":27,"base_bytes":412,"bytes":6046,"full_bytes":11124}
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "nxp2p4_xcvr.h"
+#include "nxp_xcvr_common_config.h"
+#include "nxp_xcvr_fsk_h_0p5_config.h"
+#include "nxp_xcvr_gfsk_bt_0p3_h_0p5_config.h"
+#include "nxp_xcvr_gfsk_bt_0p5_h_0p32_config.h"
+#include "nxp_xcvr_gfsk_bt_0p5_h_0p5_config.h"
+#include "nxp_xcvr_gfsk_bt_0p5_h_0p7_config.h"
+#include "nxp_xcvr_gfsk_bt_0p5_h_1p0_config.h"
+#include "nxp_xcvr_gfsk_bt_0p7_h_0p5_config.h"
+#include "nxp_xcvr_gfsk_bt_1p0_h_0p5_config.h"
+#include "nxp_xcvr_gfsk_bt_2p0_h_0p5_config.h"
+#include "nxp_xcvr_msk_config.h"
+#include "nxp_xcvr_oqpsk_802p15p4_config.h"
+#include "xcvr_cfg_parse.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define GEN_FILE_NAME  "nxp_xcvr_mode_deltas"
+#define GEN_BASE_NAME  "xcvr_mode_delta_base_words"
+#define GEN_PATH_MAX   (512U)
+#define GEN_NUM_WORDS  ((uint32_t)XCVR_MODE_DELTA_NUM_WORDS)
+#define GEN_MAX_CONFIG (32U)
+
+/* Configurations to encode, named after their xcvr_mode_datarate_config_t without the _config suffix */
+#define GEN_CONFIG(name) {#name, &name##_config}
+
+typedef struct
+{
+    const char *name;
+    const xcvr_mode_datarate_config_t *config;
+} gen_config_t;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+static int gen_parse_config(const char *sources, uint32_t cfg);
+static uint32_t gen_word(const xcvr_mode_datarate_config_t *config, uint32_t word_idx);
+static void gen_build_base(void);
+static void gen_build_deltas(void);
+static int gen_verify(void);
+static int gen_write_header(FILE *out);
+static int gen_write_source(FILE *out);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static const gen_config_t gen_configs[] = {
+    GEN_CONFIG(xcvr_fsk_h_0p5_1mbps),
+    GEN_CONFIG(xcvr_fsk_h_0p5_500kbps),
+    GEN_CONFIG(xcvr_fsk_h_0p5_250kbps),
+    GEN_CONFIG(xcvr_gfsk_bt_0p3_h_0p5_1mbps),
+    GEN_CONFIG(xcvr_gfsk_bt_0p3_h_0p5_500kbps),
+    GEN_CONFIG(xcvr_gfsk_bt_0p3_h_0p5_250kbps),
+    GEN_CONFIG(xcvr_gfsk_bt_0p5_h_0p32_1mbps),
+    GEN_CONFIG(xcvr_gfsk_bt_0p5_h_0p32_500kbps),
+    GEN_CONFIG(xcvr_gfsk_bt_0p5_h_0p32_250kbps),
+    GEN_CONFIG(xcvr_gfsk_bt_0p5_h_0p5_1mbps),
+    GEN_CONFIG(xcvr_gfsk_bt_0p5_h_0p5_500kbps),
+    GEN_CONFIG(xcvr_gfsk_bt_0p5_h_0p5_250kbps),
+    GEN_CONFIG(xcvr_gfsk_bt_0p5_h_0p7_1mbps),
+    GEN_CONFIG(xcvr_gfsk_bt_0p5_h_0p7_500kbps),
+    GEN_CONFIG(xcvr_gfsk_bt_0p5_h_0p7_250kbps),
+    GEN_CONFIG(xcvr_gfsk_bt_0p5_h_1p0_1mbps),
+    GEN_CONFIG(xcvr_gfsk_bt_0p5_h_1p0_500kbps),
+    GEN_CONFIG(xcvr_gfsk_bt_0p5_h_1p0_250kbps),
+    GEN_CONFIG(xcvr_gfsk_bt_0p7_h_0p5_1mbps),
+    GEN_CONFIG(xcvr_gfsk_bt_0p7_h_0p5_500kbps),
+    GEN_CONFIG(xcvr_gfsk_bt_0p7_h_0p5_250kbps),
+    GEN_CONFIG(xcvr_gfsk_bt_1p0_h_0p5_1mbps),
+    GEN_CONFIG(xcvr_gfsk_bt_2p0_h_0p5_1mbps),
+    GEN_CONFIG(xcvr_msk_1mbps),
+    GEN_CONFIG(xcvr_msk_500kbps),
+    GEN_CONFIG(xcvr_msk_250kbps),
+    GEN_CONFIG(xcvr_oqpsk_802p15p4_250kbps),
+};
+
+#define GEN_NUM_CONFIGS (sizeof(gen_configs) / sizeof(gen_configs[0]))
+
+static cfg_layout_t gen_layout; /* Words of xcvr_mode_datarate_config_t */
+static cfg_init_t gen_init;     /* Initializer texts of the configuration being parsed */
+static cfg_text_t gen_text[GEN_MAX_CONFIG][XCVR_MODE_DELTA_NUM_WORDS];
+static uint32_t gen_base_cfg[XCVR_MODE_DELTA_NUM_WORDS];
+static uint32_t gen_base[XCVR_MODE_DELTA_NUM_WORDS];
+static uint8_t gen_delta_idx[GEN_MAX_CONFIG][XCVR_MODE_DELTA_NUM_WORDS];
+static uint32_t gen_delta_val[GEN_MAX_CONFIG][XCVR_MODE_DELTA_NUM_WORDS];
+static uint16_t gen_num_deltas[GEN_MAX_CONFIG];
+
+/*******************************************************************************
+ * Code
+ *******************************************************************************/
+/* Initializer text of every word of a configuration, words depending on the reference clock keep the conditional */
+static int gen_parse_config(const char *sources, uint32_t cfg)
+{
+    char var_name[GEN_PATH_MAX];
+    const char *variants[CFG_NUM_VARIANTS];
+    uint32_t i;
+    int status;
+
+    (void)snprintf(var_name, sizeof(var_name), "%s_config", gen_configs[cfg].name);
+    status = cfg_parse_init(sources, "xcvr_mode_datarate_config_t", var_name, &gen_layout, &gen_init);
+    for (i = 0U; (status == 0) && (i < GEN_NUM_WORDS); i++)
+    {
+        variants[CFG_VARIANT_32MHZ] = gen_init.text[CFG_VARIANT_32MHZ][i];
+        variants[CFG_VARIANT_26MHZ] = gen_init.text[CFG_VARIANT_26MHZ][i];
+        status                      = cfg_join_variants(gen_text[cfg][i], variants);
+    }
+
+    return status;
+}
+
+static uint32_t gen_word(const xcvr_mode_datarate_config_t *config, uint32_t word_idx)
+{
+    uint32_t value;
+
+    (void)memcpy(&value, (const uint8_t *)config + (word_idx * sizeof(uint32_t)), sizeof(value));
+
+    return value;
+}
+
+static void gen_build_base(void)
+{
+    uint32_t word;
+    uint32_t i;
+    uint32_t j;
+    uint32_t count;
+    uint32_t best_count;
+
+    /* The base takes the most common initializer of every word, which minimizes the total number of deltas */
+    for (word = 0U; word < GEN_NUM_WORDS; word++)
+    {
+        best_count = 0U;
+        for (i = 0U; i < GEN_NUM_CONFIGS; i++)
+        {
+            count = 0U;
+            for (j = 0U; j < GEN_NUM_CONFIGS; j++)
+            {
+                if (strcmp(gen_text[j][word], gen_text[i][word]) == 0)
+                {
+                    count++;
+                }
+            }
+            if (count > best_count)
+            {
+                best_count         = count;
+                gen_base_cfg[word] = i;
+                gen_base[word]     = gen_word(gen_configs[i].config, word);
+            }
+        }
+    }
+}
+
+static void gen_build_deltas(void)
+{
+    uint32_t word;
+    uint32_t i;
+
+    for (i = 0U; i < GEN_NUM_CONFIGS; i++)
+    {
+        gen_num_deltas[i] = 0U;
+        for (word = 0U; word < GEN_NUM_WORDS; word++)
+        {
+            if (strcmp(gen_text[i][word], gen_text[gen_base_cfg[word]][word]) != 0)
+            {
+                gen_delta_idx[i][gen_num_deltas[i]] = (uint8_t)word;
+                gen_delta_val[i][gen_num_deltas[i]] = gen_word(gen_configs[i].config, word);
+                gen_num_deltas[i]++;
+            }
+        }
+    }
+}
+
+static int gen_verify(void)
+{
+    xcvr_mode_datarate_config_t expanded;
+    xcvr_mode_delta_config_t delta_config;
+    uint32_t i;
+    int status = 0;
+
+    /* Words with the same initializer must have the same value, else the parsed layout is wrong */
+    for (i = 0U; i < GEN_NUM_CONFIGS; i++)
+    {
+        delta_config.base_words = &gen_base[0];
+        delta_config.delta_idx  = &gen_delta_idx[i][0];
+        delta_config.delta_val  = &gen_delta_val[i][0];
+        delta_config.num_deltas = gen_num_deltas[i];
+        (void)memset(&expanded, 0xA5, sizeof(expanded));
+        if ((XCVR_RadioGenModeDeltaExpand(&delta_config, &expanded) != gXcvrSuccess_c) ||
+            (memcmp(&expanded, gen_configs[i].config, sizeof(expanded)) != 0))
+        {
+            (void)fprintf(stderr, "expanded %s does not match the original configuration\n", gen_configs[i].name);
+            status = 1;
+        }
+    }
+
+    return status;
+}
+
+static int gen_write_header(FILE *out)
+{
+    uint32_t i;
+
+    (void)fprintf(out, "/*\n * Copyright 2024 NXP\n *\n * SPDX-License-Identifier: BSD-3-Clause\n */\n\n");
+    (void)fprintf(out, "/* Generated by tools/xcvr_mode_delta_gen.c, do not edit */\n\n");
+    (void)fprintf(out, "#ifndef NXP_XCVR_MODE_DELTAS_H\n/* clang-format off */\n#define NXP_XCVR_MODE_DELTAS_H\n");
+    (void)fprintf(out, "/* clang-format on */\n\n#include \"nxp2p4_xcvr.h\"\n\n");
+    (void)fprintf(out, "extern const uint32_t " GEN_BASE_NAME "[XCVR_MODE_DELTA_NUM_WORDS];\n\n");
+    for (i = 0U; i < GEN_NUM_CONFIGS; i++)
+    {
+        (void)fprintf(out, "extern const xcvr_mode_delta_config_t %s_delta_config;\n", gen_configs[i].name);
+    }
+    (void)fprintf(out, "\n#endif /* NXP_XCVR_MODE_DELTAS_H */\n");
+
+    return ferror(out);
+}
+
+static int gen_write_source(FILE *out)
+{
+    uint32_t i;
+    uint32_t j;
+    uint32_t word;
+
+    (void)fprintf(out, "/*\n * Copyright 2024 NXP\n *\n * SPDX-License-Identifier: BSD-3-Clause\n */\n\n");
+    (void)fprintf(out, "/* Generated by tools/xcvr_mode_delta_gen.c, do not edit */\n\n");
+    (void)fprintf(out, "#include \"" GEN_FILE_NAME ".h\"\n\n");
+    (void)fprintf(out, "/* clang-format off */\n");
+
+    (void)fprintf(out, "const uint32_t " GEN_BASE_NAME "[XCVR_MODE_DELTA_NUM_WORDS] = {\n");
+    for (word = 0U; word < GEN_NUM_WORDS; word++)
+    {
+        (void)fprintf(out, "    /* %u: %s */\n", (unsigned int)word, gen_layout.names[word]);
+        cfg_write_text(out, gen_text[gen_base_cfg[word]][word], 4U, "");
+    }
+    (void)fprintf(out, "};\n");
+
+    for (i = 0U; i < GEN_NUM_CONFIGS; i++)
+    {
+        (void)fprintf(out, "\n");
+        if (gen_num_deltas[i] != 0U)
+        {
+            (void)fprintf(out, "static const uint8_t %s_delta_idx[] = {\n", gen_configs[i].name);
+            for (j = 0U; j < gen_num_deltas[i]; j++)
+            {
+                (void)fprintf(out, "%s%3u,%s", ((j % 16U) == 0U) ? "    " : " ", (unsigned int)gen_delta_idx[i][j],
+                              (((j % 16U) == 15U) || (j == (gen_num_deltas[i] - 1U))) ? "\n" : "");
+            }
+            (void)fprintf(out, "};\n");
+            (void)fprintf(out, "static const uint32_t %s_delta_val[] = {\n", gen_configs[i].name);
+            for (j = 0U; j < gen_num_deltas[i]; j++)
+            {
+                word = gen_delta_idx[i][j];
+                (void)fprintf(out, "    /* %u: %s */\n", (unsigned int)word, gen_layout.names[word]);
+                cfg_write_text(out, gen_text[i][word], 4U, "");
+            }
+            (void)fprintf(out, "};\n");
+        }
+        (void)fprintf(out, "const xcvr_mode_delta_config_t %s_delta_config = {\n", gen_configs[i].name);
+        (void)fprintf(out, "    .base_words = &" GEN_BASE_NAME "[0],\n");
+        if (gen_num_deltas[i] != 0U)
+        {
+            (void)fprintf(out, "    .delta_idx  = &%s_delta_idx[0],\n", gen_configs[i].name);
+            (void)fprintf(out, "    .delta_val  = &%s_delta_val[0],\n", gen_configs[i].name);
+        }
+        else
+        {
+            (void)fprintf(out, "    .delta_idx  = NULLPTR,\n    .delta_val  = NULLPTR,\n");
+        }
+        (void)fprintf(out, "    .num_deltas = %uU,\n};\n", (unsigned int)gen_num_deltas[i]);
+    }
+    (void)fprintf(out, "/* clang-format on */\n");
+
+    return ferror(out);
+}
+
+int main(int argc, char **argv)
+{
+    char path[GEN_PATH_MAX];
+    const char *dir = (argc > 1) ? argv[1] : ".";
+    char *sources   = NULL;
+    FILE *out;
+    uint32_t i;
+    uint32_t size;
+    uint32_t base_size;
+    uint32_t packed_size;
+    uint32_t full_size;
+    int status = 0;
+
+    /* Word indexes are stored on 8 bits */
+    if ((GEN_NUM_WORDS > 256U) || (GEN_NUM_CONFIGS > GEN_MAX_CONFIG))
+    {
+        (void)fprintf(stderr, "configuration does not fit the sparse encoding\n");
+        status = 1;
+    }
+
+    if (status == 0)
+    {
+        status = cfg_parse_layout(dir, "xcvr_mode_datarate_config_t", GEN_NUM_WORDS, &gen_layout);
+    }
+
+    /* All the mode configuration sources of the folder, concatenated */
+    if (status == 0)
+    {
+        sources = cfg_read_sources(dir);
+        status  = (sources == NULL) ? 1 : 0;
+    }
+
+    for (i = 0U; (status == 0) && (i < GEN_NUM_CONFIGS); i++)
+    {
+        status = gen_parse_config(sources, i);
+    }
+    free(sources);
+
+    if (status == 0)
+    {
+        gen_build_base();
+        gen_build_deltas();
+        status = gen_verify();
+    }
+
+    if (status == 0)
+    {
+        (void)snprintf(path, sizeof(path), "%s/%s.h", dir, GEN_FILE_NAME);
+        out = fopen(path, "w");
+        if ((out == NULL) || (gen_write_header(out) != 0))
+        {
+            (void)fprintf(stderr, "failed to write %s\n", path);
+            status = 1;
+        }
+        if (out != NULL)
+        {
+            (void)fclose(out);
+        }
+    }
+
+    if (status == 0)
+    {
+        (void)snprintf(path, sizeof(path), "%s/%s.c", dir, GEN_FILE_NAME);
+        out = fopen(path, "w");
+        if ((out == NULL) || (gen_write_source(out) != 0))
+        {
+            (void)fprintf(stderr, "failed to write %s\n", path);
+            status = 1;
+        }
+        if (out != NULL)
+        {
+            (void)fclose(out);
+        }
+    }
+
+    if (status == 0)
+    {
+        /* Flash estimate: base words, then index byte and value word per delta plus the descriptor per configuration */
+        base_size   = GEN_NUM_WORDS * (uint32_t)sizeof(uint32_t);
+        full_size   = (uint32_t)sizeof(xcvr_mode_datarate_config_t);
+        packed_size = base_size;
+        for (i = 0U; i < GEN_NUM_CONFIGS; i++)
+        {
+            size = ((uint32_t)gen_num_deltas[i] * (uint32_t)(sizeof(uint8_t) + sizeof(uint32_t))) +
+                   (uint32_t)sizeof(xcvr_mode_delta_config_t);
+            packed_size += size;
+            (void)printf("{\"config\":\"%s\",\"num_deltas\":%u,\"bytes\":%u,\"full_bytes\":%u}\n", gen_configs[i].name,
+                         (unsigned int)gen_num_deltas[i], (unsigned int)size, (unsigned int)full_size);
+        }
+        (void)printf("{\"num_configs\":%u,\"base_bytes\":%u,\"bytes\":%u,\"full_bytes\":%u}\n",
+                     (unsigned int)GEN_NUM_CONFIGS, (unsigned int)base_size, (unsigned int)packed_size,
+                     (unsigned int)(GEN_NUM_CONFIGS * full_size));
+    }
+
+    return status;
+}
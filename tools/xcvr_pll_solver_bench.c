@@ -0,0 +1,172 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Host benchmark of the PLL frequency solver.
+ *
+ * For a channel plan covering the 2360 MHz to 2487 MHz band with a given spacing, this tool compares the residual
+ * frequency error of XCVR_SolvePllPlan() with the one of the fixed maximum denominator and nearest numerator used by
+ * XCVR_OverrideTxFrequency(), checks every solution against an exact recomputation of the synthesized frequency and
+ * measures the solver throughput. The solver does not access the radio registers, so the driver runs on the host as is.
+ *
+ * Build it on the host for one radio generation and reference oscillator against the device headers of the target:
+ *
+ *   gcc -O2 -DNXP_RADIO_GEN=470 -DRF_OSC_26MHZ=0 -I<device headers> -Idrv -Idrv/nb2p4ghz \
+ *       -Idrv/nb2p4ghz/configs/gen47 tools/xcvr_pll_solver_bench.c \
+ *       drv/{dbg_ram_capture,mathfp,nxp_xcvr_ext_ctrl,nxp_xcvr_lcl_ctrl,nxp_xcvr_lcl_step_mgr,rfmc_ctrl}.c \
+ *       drv/nb2p4ghz/{nxp2p4_xcvr,nxp_xcvr_blob,nxp_xcvr_hop_table,nxp_xcvr_trim}.c \
+ *       drv/nb2p4ghz/configs/gen47/nxp_xcvr_*.c -lm -o xcvr_pll_solver_bench
+ *   ./xcvr_pll_solver_bench [spacing in mHz]
+ *
+ * The default spacing of 999983 mHz (a prime number of mHz close to 1 kHz) gives targets with all kinds of mHz
+ * fractions. The report is one JSON object, errors are in micro Hz, for instance:
+ *   {"ref_osc":32000000,"targets":127001,"base_exact":20,"base_max_err":238,"base_mean_err":119,"exact":127001,
+ *    "max_err":0,"mean_err":0,"bad":0,"solutions_per_s":2000000}
+ * The exit status is non zero if a solution does not synthesize the frequency with the error it reports.
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "nxp2p4_xcvr.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#if RF_OSC_26MHZ == 1
+#define BENCH_REF_OSC_HZ (26000000ULL)
+#else
+#define BENCH_REF_OSC_HZ (32000000ULL)
+#endif /* RF_OSC_26MHZ == 1 */
+#define BENCH_MAX_DENOM (0x08000000ULL - 1ULL) /* Denominator of XCVR_OverrideTxFrequency() */
+#define BENCH_MIN_FREQ (2360000000000ULL)     /* mHz */
+#define BENCH_MAX_FREQ (2487000000000ULL)     /* mHz */
+#define BENCH_DEFAULT_SPACING (999983ULL)     /* mHz */
+#define BENCH_CHUNK (4096U)                   /* Solutions per XCVR_SolvePllPlan() call */
+
+typedef struct
+{
+    uint64_t exact;
+    uint64_t max_err;
+    uint64_t sum_err;
+} bench_stats_t;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+static int64_t bench_base_error(uint64_t freq);
+static int64_t bench_solution_error(uint64_t freq, const xcvr_pll_solution_t *solution);
+static void bench_add(bench_stats_t *stats, int64_t error);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static xcvr_pll_solution_t bench_solutions[BENCH_CHUNK];
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+/* Error in uHz of the largest denominator with the nearest numerator */
+static int64_t bench_base_error(uint64_t freq)
+{
+    const uint64_t scale = 2ULL * BENCH_REF_OSC_HZ * 1000ULL;
+    uint64_t remainder   = freq % scale;
+    uint64_t offset      = (remainder > (scale / 2U)) ? (scale - remainder) : remainder;
+    uint64_t num         = ((offset * BENCH_MAX_DENOM) + (scale / 2U)) / scale;
+    __int128 error       = ((__int128)num * scale) - ((__int128)offset * BENCH_MAX_DENOM); /* mHz * denominator */
+
+    return (int64_t)((error * 1000) / (__int128)BENCH_MAX_DENOM);
+}
+
+/* Exact error in uHz of a solution, truncated */
+static int64_t bench_solution_error(uint64_t freq, const xcvr_pll_solution_t *solution)
+{
+    const uint64_t scale = 2ULL * BENCH_REF_OSC_HZ * 1000ULL;
+    __int128 synth       = (((__int128)solution->intpart * solution->denominator) + (int32_t)solution->numerator) *
+                     (__int128)scale; /* mHz * denominator */
+    __int128 error = synth - ((__int128)freq * solution->denominator);
+
+    return (int64_t)((error * 1000) / (__int128)solution->denominator);
+}
+
+static void bench_add(bench_stats_t *stats, int64_t error)
+{
+    uint64_t abs_err = (uint64_t)((error < 0) ? -error : error);
+
+    stats->exact += (abs_err == 0U) ? 1U : 0U;
+    stats->max_err = (abs_err > stats->max_err) ? abs_err : stats->max_err;
+    stats->sum_err += abs_err;
+}
+
+int main(int argc, char *argv[])
+{
+    uint64_t spacing = (argc > 1) ? strtoull(argv[1], NULL, 0) : BENCH_DEFAULT_SPACING;
+    uint64_t targets;
+    uint64_t freq;
+    uint64_t done;
+    uint64_t elapsed = 0U;
+    uint32_t count;
+    uint32_t i;
+    int64_t error;
+    uint64_t bad = 0U;
+    bench_stats_t base;
+    bench_stats_t solver;
+    struct timespec start;
+    struct timespec end;
+    xcvrStatus_t status = gXcvrSuccess_c;
+
+    base    = (bench_stats_t){0U, 0U, 0U};
+    solver  = (bench_stats_t){0U, 0U, 0U};
+    spacing = (spacing == 0U) ? BENCH_DEFAULT_SPACING : spacing;
+    targets = ((BENCH_MAX_FREQ - BENCH_MIN_FREQ) / spacing) + 1U;
+
+    for (done = 0U; (done < targets) && (status == gXcvrSuccess_c); done += count)
+    {
+        count = ((targets - done) < BENCH_CHUNK) ? (uint32_t)(targets - done) : BENCH_CHUNK;
+        freq  = BENCH_MIN_FREQ + (done * spacing);
+
+        (void)clock_gettime(CLOCK_MONOTONIC, &start);
+        status = XCVR_SolvePllPlan(freq, spacing, count, bench_solutions);
+        (void)clock_gettime(CLOCK_MONOTONIC, &end);
+        elapsed += ((uint64_t)(end.tv_sec - start.tv_sec) * 1000000000ULL) + (uint64_t)end.tv_nsec -
+                   (uint64_t)start.tv_nsec;
+
+        for (i = 0U; (i < count) && (status == gXcvrSuccess_c); i++)
+        {
+            bench_add(&base, bench_base_error(freq));
+            error = bench_solution_error(freq, &bench_solutions[i]);
+            bench_add(&solver, error);
+            /* The reported error is rounded, the exact one truncated */
+            if ((bench_solutions[i].denominator > BENCH_MAX_DENOM) ||
+                (llabs(error - (int64_t)bench_solutions[i].error_uhz) > 1) ||
+                ((uint64_t)llabs(error) > (uint64_t)llabs(bench_base_error(freq))))
+            {
+                (void)fprintf(stderr, "bad solution for %llu mHz\n", (unsigned long long)freq);
+                bad++;
+            }
+            freq += spacing;
+        }
+    }
+
+    if (status != gXcvrSuccess_c)
+    {
+        (void)fprintf(stderr, "XCVR_SolvePllPlan() failed with %d\n", (int)status);
+    }
+    else
+    {
+        (void)printf(
+            "{\"ref_osc\":%llu,\"targets\":%llu,\"base_exact\":%llu,\"base_max_err\":%llu,\"base_mean_err\":%llu,"
+            "\"exact\":%llu,\"max_err\":%llu,\"mean_err\":%llu,\"bad\":%llu,\"solutions_per_s\":%llu}\n",
+            BENCH_REF_OSC_HZ, (unsigned long long)targets, (unsigned long long)base.exact,
+            (unsigned long long)base.max_err, (unsigned long long)(base.sum_err / targets),
+            (unsigned long long)solver.exact, (unsigned long long)solver.max_err,
+            (unsigned long long)(solver.sum_err / targets), (unsigned long long)bad,
+            (unsigned long long)((targets * 1000000000ULL) / ((elapsed == 0U) ? 1U : elapsed)));
+    }
+
+    return ((status != gXcvrSuccess_c) || (bad != 0U)) ? 1 : 0;
+}
@@ -0,0 +1,537 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Host generator for folded (pre-merged) radio register images.
+ *
+ * For every supported mode/data rate configuration this tool merges the common and mode dependent settings the same
+ * way as XCVR_RadioGenRegSetup() and emits one const xcvr_folded_config_t per configuration, so that
+ * XCVR_ChangeModeFolded() only has to copy the values from flash.
+ *
+ * The register values are not written as numbers: the initializer of each register is the initializer of its
+ * xcvr_common_config_t field OR-ed with the initializer of its xcvr_mode_datarate_config_t field, both copied from the
+ * nxp_xcvr_<mode>_config.c sources (see xcvr_cfg_parse.h), RF_OSC_26MHZ conditionals included. The output is
+ * therefore the same whatever device headers the tool is built against. Before writing anything, the tool checks on
+ * the values of the linked configurations that registers with the same initializer over all configurations have the
+ * same value, which catches a word layout not matching the parsed structure definitions.
+ *
+ * Build it on the host against the device headers of the target and the configuration sources of the matching radio
+ * generation, then run it on that generation's configs folder, e.g. for KW47:
+ *
+ *   gcc -DNXP_RADIO_GEN=470 -DRF_OSC_26MHZ=0 -I<device headers> -Idrv -Idrv/nb2p4ghz \
+ *       -Idrv/nb2p4ghz/configs/gen47 tools/xcvr_reg_image_gen.c tools/xcvr_cfg_parse.c \
+ *       drv/nb2p4ghz/configs/gen47/nxp_xcvr_*.c drv/nb2p4ghz/nxp_xcvr_blob.c -o xcvr_reg_image_gen
+ *   ./xcvr_reg_image_gen drv/nb2p4ghz/configs/gen47
+ *
+ * The generated nxp_xcvr_reg_images.c/.h must be regenerated whenever a configuration file or the register descriptor
+ * table changes, the xcvr_generate_configs target of tools/CMakeLists.txt runs the generators of the configs folder.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "nxp2p4_xcvr.h"
+#include "nxp_xcvr_common_config.h"
+#include "nxp_xcvr_fsk_h_0p5_config.h"
+#include "nxp_xcvr_gfsk_bt_0p3_h_0p5_config.h"
+#include "nxp_xcvr_gfsk_bt_0p5_h_0p32_config.h"
+#include "nxp_xcvr_gfsk_bt_0p5_h_0p5_config.h"
+#include "nxp_xcvr_gfsk_bt_0p5_h_0p7_config.h"
+#include "nxp_xcvr_gfsk_bt_0p5_h_1p0_config.h"
+#include "nxp_xcvr_gfsk_bt_0p7_h_0p5_config.h"
+#include "nxp_xcvr_gfsk_bt_1p0_h_0p5_config.h"
+#include "nxp_xcvr_gfsk_bt_2p0_h_0p5_config.h"
+#include "nxp_xcvr_msk_config.h"
+#include "nxp_xcvr_oqpsk_802p15p4_config.h"
+#include "xcvr_cfg_parse.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define GEN_FILE_NAME    "nxp_xcvr_reg_images"
+#define GEN_PATH_MAX     (512U)
+#define GEN_REG_NAME_MAX (64U)
+#define GEN_MAX_CONFIG   (32U)
+#define GEN_MACRO_PREFIX "XCVR_FOLDED_"
+#define GEN_NUM_REGS     ((uint32_t)XCVR_REG_IMAGE_NUM_REGS)
+#define GEN_COMMON_WORDS ((uint32_t)(sizeof(xcvr_common_config_t) / sizeof(uint32_t)))
+#define GEN_MODE_WORDS   ((uint32_t)(sizeof(xcvr_mode_datarate_config_t) / sizeof(uint32_t)))
+
+/* Configurations to fold, named after their xcvr_config_t without the _full_config suffix */
+#define GEN_CONFIG(name) {#name, &name##_full_config}
+
+typedef struct
+{
+    const char *name;
+    const xcvr_config_t *config;
+} gen_config_t;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+static uint32_t gen_field_value(const void *cfg, uint16_t ofst);
+static int gen_parse_reg_names(const char *sources);
+static int gen_build_common_macros(void);
+static int gen_fold_variant(uint32_t reg, uint32_t variant, cfg_text_t text);
+static int gen_fold_config(const char *sources, uint32_t cfg);
+static int gen_verify(void);
+static int gen_write_header(FILE *out);
+static int gen_write_source(FILE *out);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static const gen_config_t gen_configs[] = {
+    GEN_CONFIG(xcvr_fsk_h_0p5_1mbps),
+    GEN_CONFIG(xcvr_fsk_h_0p5_500kbps),
+    GEN_CONFIG(xcvr_fsk_h_0p5_250kbps),
+    GEN_CONFIG(xcvr_gfsk_bt_0p3_h_0p5_1mbps),
+    GEN_CONFIG(xcvr_gfsk_bt_0p3_h_0p5_500kbps),
+    GEN_CONFIG(xcvr_gfsk_bt_0p3_h_0p5_250kbps),
+    GEN_CONFIG(xcvr_gfsk_bt_0p5_h_0p32_1mbps),
+    GEN_CONFIG(xcvr_gfsk_bt_0p5_h_0p32_500kbps),
+    GEN_CONFIG(xcvr_gfsk_bt_0p5_h_0p32_250kbps),
+    GEN_CONFIG(xcvr_gfsk_bt_0p5_h_0p5_1mbps),
+    GEN_CONFIG(xcvr_gfsk_bt_0p5_h_0p5_500kbps),
+    GEN_CONFIG(xcvr_gfsk_bt_0p5_h_0p5_250kbps),
+    GEN_CONFIG(xcvr_gfsk_bt_0p5_h_0p7_1mbps),
+    GEN_CONFIG(xcvr_gfsk_bt_0p5_h_0p7_500kbps),
+    GEN_CONFIG(xcvr_gfsk_bt_0p5_h_0p7_250kbps),
+    GEN_CONFIG(xcvr_gfsk_bt_0p5_h_1p0_1mbps),
+    GEN_CONFIG(xcvr_gfsk_bt_0p5_h_1p0_500kbps),
+    GEN_CONFIG(xcvr_gfsk_bt_0p5_h_1p0_250kbps),
+    GEN_CONFIG(xcvr_gfsk_bt_0p7_h_0p5_1mbps),
+    GEN_CONFIG(xcvr_gfsk_bt_0p7_h_0p5_500kbps),
+    GEN_CONFIG(xcvr_gfsk_bt_0p7_h_0p5_250kbps),
+    GEN_CONFIG(xcvr_gfsk_bt_1p0_h_0p5_1mbps),
+    GEN_CONFIG(xcvr_gfsk_bt_2p0_h_0p5_1mbps),
+    GEN_CONFIG(xcvr_msk_1mbps),
+    GEN_CONFIG(xcvr_msk_500kbps),
+    GEN_CONFIG(xcvr_msk_250kbps),
+    GEN_CONFIG(xcvr_oqpsk_802p15p4_250kbps),
+};
+
+#define GEN_NUM_CONFIGS (sizeof(gen_configs) / sizeof(gen_configs[0]))
+
+/* Headers declaring the configurations, included by the generated source */
+static const char *const gen_headers[] = {
+    "nxp_xcvr_fsk_h_0p5_config.h",
+    "nxp_xcvr_gfsk_bt_0p3_h_0p5_config.h",
+    "nxp_xcvr_gfsk_bt_0p5_h_0p32_config.h",
+    "nxp_xcvr_gfsk_bt_0p5_h_0p5_config.h",
+    "nxp_xcvr_gfsk_bt_0p5_h_0p7_config.h",
+    "nxp_xcvr_gfsk_bt_0p5_h_1p0_config.h",
+    "nxp_xcvr_gfsk_bt_0p7_h_0p5_config.h",
+    "nxp_xcvr_gfsk_bt_1p0_h_0p5_config.h",
+    "nxp_xcvr_gfsk_bt_2p0_h_0p5_config.h",
+    "nxp_xcvr_msk_config.h",
+    "nxp_xcvr_oqpsk_802p15p4_config.h",
+};
+
+#define GEN_NUM_HEADERS (sizeof(gen_headers) / sizeof(gen_headers[0]))
+
+static cfg_layout_t gen_common_layout; /* Words of xcvr_common_config_t */
+static cfg_layout_t gen_mode_layout;   /* Words of xcvr_mode_datarate_config_t */
+static cfg_init_t gen_common_init;     /* Initializer texts of xcvr_common_config */
+static cfg_init_t gen_mode_init;       /* Initializer texts of the configuration being folded */
+static char gen_reg_name[XCVR_REG_IMAGE_NUM_REGS][GEN_REG_NAME_MAX];
+static char gen_common_macro[CFG_MAX_WORDS][GEN_REG_NAME_MAX]; /* Macro of each used common word, "" if unused */
+static cfg_text_t gen_common_text[CFG_MAX_WORDS];               /* Definition of the macro of each used common word */
+static cfg_text_t gen_text[GEN_MAX_CONFIG][XCVR_REG_IMAGE_NUM_REGS];
+
+/*******************************************************************************
+ * Code
+ *******************************************************************************/
+static uint32_t gen_field_value(const void *cfg, uint16_t ofst)
+{
+    uint32_t value = 0U;
+
+    if (ofst != XCVR_REG_NO_FIELD)
+    {
+        (void)memcpy(&value, (const uint8_t *)cfg + ofst, sizeof(value));
+    }
+
+    return value;
+}
+
+/* Name every register after its entry of xcvr_reg_desc_table, "{&GEN4PHY->DMD_CTRL0, ...}" names GEN4PHY->DMD_CTRL0 */
+static int gen_parse_reg_names(const char *sources)
+{
+    const char *pos = strstr(sources, "const xcvr_reg_desc_t xcvr_reg_desc_table[XCVR_REG_IMAGE_NUM_REGS] = {");
+    const char *end = (pos != NULL) ? strstr(pos, "\n};") : NULL;
+    const char *comma;
+    uint32_t num_regs = 0U;
+    int status        = 0;
+
+    while ((pos != NULL) && (end != NULL) && (status == 0))
+    {
+        pos = strstr(pos, "{&");
+        if ((pos == NULL) || (pos > end))
+        {
+            break;
+        }
+        pos += 2;
+        comma = strchr(pos, ',');
+        if ((num_regs >= GEN_NUM_REGS) || (comma == NULL) || ((size_t)(comma - pos) >= GEN_REG_NAME_MAX))
+        {
+            status = 1;
+        }
+        else
+        {
+            (void)snprintf(gen_reg_name[num_regs], GEN_REG_NAME_MAX, "%.*s", (int)(comma - pos), pos);
+            num_regs++;
+        }
+    }
+    if ((status != 0) || (num_regs != GEN_NUM_REGS))
+    {
+        (void)fprintf(stderr, "cannot parse xcvr_reg_desc_table, %u of %u registers\n", (unsigned int)num_regs,
+                      (unsigned int)GEN_NUM_REGS);
+        status = 1;
+    }
+
+    return status;
+}
+
+/*
+ * The common settings are the same in every folded configuration, so the initializer of each common word is written
+ * once, as the XCVR_FOLDED_<word> macro the folded configurations OR with their mode dependent initializer.
+ */
+static int gen_build_common_macros(void)
+{
+    cfg_text_t variant_text[CFG_NUM_VARIANTS];
+    const char *variants[CFG_NUM_VARIANTS];
+    char define[GEN_REG_NAME_MAX + 16U];
+    const char *name;
+    uint32_t reg;
+    uint32_t word;
+    uint32_t variant;
+    uint32_t i;
+    size_t len;
+    int status = 0;
+
+    for (reg = 0U; (status == 0) && (reg < GEN_NUM_REGS); reg++)
+    {
+        if (xcvr_reg_desc_table[reg].common_ofst == XCVR_REG_NO_FIELD)
+        {
+            continue;
+        }
+        word = xcvr_reg_desc_table[reg].common_ofst / sizeof(uint32_t);
+        if ((gen_common_macro[word][0] != '\0') ||
+            ((strcmp(gen_common_init.text[CFG_VARIANT_32MHZ][word], CFG_UNSET_TEXT) == 0) &&
+             (strcmp(gen_common_init.text[CFG_VARIANT_26MHZ][word], CFG_UNSET_TEXT) == 0)))
+        {
+            continue;
+        }
+
+        /* XCVR_FOLDED_ followed by the upper case designator, .ldo_0 gives XCVR_FOLDED_LDO_0 */
+        name = &gen_common_layout.names[word][1];
+        len  = strlen(GEN_MACRO_PREFIX);
+        (void)strcpy(gen_common_macro[word], GEN_MACRO_PREFIX);
+        for (i = 0U; (name[i] != '\0') && ((len + 1U) < GEN_REG_NAME_MAX); i++)
+        {
+            gen_common_macro[word][len] =
+                ((name[i] >= 'a') && (name[i] <= 'z')) ? (char)(name[i] - 'a' + 'A') :
+                                                         (((name[i] >= '0') && (name[i] <= '9')) ? name[i] : '_');
+            len++;
+        }
+        gen_common_macro[word][len] = '\0';
+
+        /* #define line, then the initializer without its ',' and between parentheses */
+        (void)snprintf(define, sizeof(define), "#define %s \\", gen_common_macro[word]);
+        for (variant = 0U; (status == 0) && (variant < CFG_NUM_VARIANTS); variant++)
+        {
+            variant_text[variant][0] = '\0';
+            len                      = strlen(gen_common_init.text[variant][word]);
+            status                   = cfg_append(variant_text[variant], define);
+            if ((status == 0) && ((strlen(variant_text[variant]) + len + 2U) < CFG_TEXT_MAX))
+            {
+                (void)strcat(variant_text[variant], "\n(");
+                (void)strcat(variant_text[variant], gen_common_init.text[variant][word]);
+                (void)strcpy(&variant_text[variant][strlen(variant_text[variant]) - 1U], ")");
+            }
+            else
+            {
+                (void)fprintf(stderr, "initializer too long: %s\n", gen_common_macro[word]);
+                status = 1;
+            }
+            variants[variant] = variant_text[variant];
+        }
+        if (status == 0)
+        {
+            status = cfg_join_variants(gen_common_text[word], variants);
+        }
+    }
+
+    return status;
+}
+
+/* Initializer text of a register for one reference clock branch: common macro | mode dependent field */
+static int gen_fold_variant(uint32_t reg, uint32_t variant, cfg_text_t text)
+{
+    const xcvr_reg_desc_t *desc = &xcvr_reg_desc_table[reg];
+    char common[GEN_REG_NAME_MAX + 1U];
+    const char *fields[2];
+    uint32_t num_fields = 0U;
+    uint32_t i;
+    size_t len;
+    int status = 0;
+
+    if ((desc->common_ofst != XCVR_REG_NO_FIELD) &&
+        (gen_common_macro[desc->common_ofst / sizeof(uint32_t)][0] != '\0'))
+    {
+        (void)snprintf(common, sizeof(common), "%s,", gen_common_macro[desc->common_ofst / sizeof(uint32_t)]);
+        fields[num_fields] = common;
+        num_fields++;
+    }
+    if ((desc->mode_ofst != XCVR_REG_NO_FIELD) &&
+        (strcmp(gen_mode_init.text[variant][desc->mode_ofst / sizeof(uint32_t)], CFG_UNSET_TEXT) != 0))
+    {
+        fields[num_fields] = gen_mode_init.text[variant][desc->mode_ofst / sizeof(uint32_t)];
+        num_fields++;
+    }
+
+    (void)strcpy(text, CFG_UNSET_TEXT);
+    for (i = 0U; (status == 0) && (i < num_fields); i++)
+    {
+        /* The fields are OR-ed field macros, an operator binding looser than | would change the value */
+        if ((strchr(fields[i], '?') != NULL) || (strstr(fields[i], "&&") != NULL) || (strstr(fields[i], "||") != NULL))
+        {
+            (void)fprintf(stderr, "cannot merge the initializer of %s: %s\n", gen_reg_name[reg], fields[i]);
+            status = 1;
+            break;
+        }
+        len = strlen(text);
+        if ((len + strlen(fields[i]) + 2U) >= CFG_TEXT_MAX)
+        {
+            (void)fprintf(stderr, "initializer too long: %s\n", gen_reg_name[reg]);
+            status = 1;
+        }
+        else if (i == 0U)
+        {
+            (void)strcpy(text, fields[i]);
+        }
+        else
+        {
+            /* The ',' ending the common macro becomes the | continued by the mode dependent field */
+            (void)strcpy(&text[len - 1U], " | ");
+            (void)strcat(text, fields[i]);
+        }
+    }
+
+    return status;
+}
+
+static int gen_fold_config(const char *sources, uint32_t cfg)
+{
+    char var_name[GEN_PATH_MAX];
+    cfg_text_t variant_text[CFG_NUM_VARIANTS];
+    const char *variants[CFG_NUM_VARIANTS];
+    uint32_t reg;
+    uint32_t variant;
+    int status;
+
+    (void)snprintf(var_name, sizeof(var_name), "%s_config", gen_configs[cfg].name);
+    status = cfg_parse_init(sources, "xcvr_mode_datarate_config_t", var_name, &gen_mode_layout, &gen_mode_init);
+    for (reg = 0U; (status == 0) && (reg < GEN_NUM_REGS); reg++)
+    {
+        for (variant = 0U; (status == 0) && (variant < CFG_NUM_VARIANTS); variant++)
+        {
+            status            = gen_fold_variant(reg, variant, variant_text[variant]);
+            variants[variant] = variant_text[variant];
+        }
+        if (status == 0)
+        {
+            status = cfg_join_variants(gen_text[cfg][reg], variants);
+        }
+    }
+
+    return status;
+}
+
+static int gen_verify(void)
+{
+    uint32_t i;
+    uint32_t j;
+    uint32_t reg;
+    uint32_t value_i;
+    uint32_t value_j;
+    const xcvr_config_t *config_i;
+    const xcvr_config_t *config_j;
+    int status = 0;
+
+    /* Registers with the same initializer must have the same value, else the parsed layout is wrong */
+    for (reg = 0U; reg < GEN_NUM_REGS; reg++)
+    {
+        for (i = 0U; i < GEN_NUM_CONFIGS; i++)
+        {
+            config_i = gen_configs[i].config;
+            value_i  = gen_field_value(config_i->common_cfg, xcvr_reg_desc_table[reg].common_ofst) |
+                      gen_field_value(config_i->mode_data_rate_cfg, xcvr_reg_desc_table[reg].mode_ofst);
+            for (j = i + 1U; j < GEN_NUM_CONFIGS; j++)
+            {
+                config_j = gen_configs[j].config;
+                value_j  = gen_field_value(config_j->common_cfg, xcvr_reg_desc_table[reg].common_ofst) |
+                          gen_field_value(config_j->mode_data_rate_cfg, xcvr_reg_desc_table[reg].mode_ofst);
+                if ((strcmp(gen_text[i][reg], gen_text[j][reg]) == 0) && (value_i != value_j))
+                {
+                    (void)fprintf(stderr, "%s: same initializer but different values in %s and %s\n",
+                                  gen_reg_name[reg], gen_configs[i].name, gen_configs[j].name);
+                    status = 1;
+                }
+            }
+        }
+    }
+
+    return status;
+}
+
+static int gen_write_header(FILE *out)
+{
+    uint32_t i;
+
+    (void)fprintf(out, "/*\n * Copyright 2024 NXP\n *\n * SPDX-License-Identifier: BSD-3-Clause\n */\n\n");
+    (void)fprintf(out, "/* Generated by tools/xcvr_reg_image_gen.c, do not edit */\n\n");
+    (void)fprintf(out, "#ifndef NXP_XCVR_REG_IMAGES_H\n/* clang-format off */\n#define NXP_XCVR_REG_IMAGES_H\n");
+    (void)fprintf(out, "/* clang-format on */\n\n#include \"nxp2p4_xcvr.h\"\n\n");
+    for (i = 0U; i < GEN_NUM_CONFIGS; i++)
+    {
+        (void)fprintf(out, "extern const xcvr_folded_config_t %s_folded_config;\n", gen_configs[i].name);
+    }
+    (void)fprintf(out, "\n#endif /* NXP_XCVR_REG_IMAGES_H */\n");
+
+    return ferror(out);
+}
+
+static int gen_write_source(FILE *out)
+{
+    uint32_t i;
+    uint32_t reg;
+    uint32_t word;
+
+    (void)fprintf(out, "/*\n * Copyright 2024 NXP\n *\n * SPDX-License-Identifier: BSD-3-Clause\n */\n\n");
+    (void)fprintf(out, "/* Generated by tools/xcvr_reg_image_gen.c, do not edit */\n\n");
+    (void)fprintf(out, "#include \"" GEN_FILE_NAME ".h\"\n");
+    for (i = 0U; i < GEN_NUM_HEADERS; i++)
+    {
+        (void)fprintf(out, "#include \"%s\"\n", gen_headers[i]);
+    }
+    (void)fprintf(out, "\n/* clang-format off */\n");
+    (void)fprintf(out, "/* Common settings of the registers, from xcvr_common_config */\n");
+    for (reg = 0U; reg < GEN_NUM_REGS; reg++)
+    {
+        word = xcvr_reg_desc_table[reg].common_ofst / sizeof(uint32_t);
+        if ((xcvr_reg_desc_table[reg].common_ofst != XCVR_REG_NO_FIELD) && (gen_common_macro[word][0] != '\0'))
+        {
+            (void)fprintf(out, "/* %s */\n", gen_reg_name[reg]);
+            cfg_write_text(out, gen_common_text[word], 4U, " \\");
+        }
+    }
+    for (i = 0U; i < GEN_NUM_CONFIGS; i++)
+    {
+        (void)fprintf(out, "\nconst xcvr_folded_config_t %s_folded_config = {\n", gen_configs[i].name);
+        (void)fprintf(out, "    .config     = &%s_full_config,\n", gen_configs[i].name);
+        (void)fprintf(out, "    .reg_values = {\n");
+        for (reg = 0U; reg < GEN_NUM_REGS; reg++)
+        {
+            (void)fprintf(out, "        /* %u: %s */\n", (unsigned int)reg, gen_reg_name[reg]);
+            cfg_write_text(out, gen_text[i][reg], 8U, "");
+        }
+        (void)fprintf(out, "    },\n};\n");
+    }
+    (void)fprintf(out, "/* clang-format on */\n");
+
+    return ferror(out);
+}
+
+int main(int argc, char **argv)
+{
+    char path[GEN_PATH_MAX];
+    const char *dir = (argc > 1) ? argv[1] : ".";
+    char *sources   = NULL;
+    FILE *out;
+    uint32_t i;
+    int status = 0;
+
+    if (GEN_NUM_CONFIGS > GEN_MAX_CONFIG)
+    {
+        (void)fprintf(stderr, "too many configurations\n");
+        status = 1;
+    }
+
+    if (status == 0)
+    {
+        status = cfg_parse_layout(dir, "xcvr_common_config_t", GEN_COMMON_WORDS, &gen_common_layout) |
+                 cfg_parse_layout(dir, "xcvr_mode_datarate_config_t", GEN_MODE_WORDS, &gen_mode_layout);
+    }
+
+    /* All the configuration sources of the folder, concatenated, register descriptor table included */
+    if (status == 0)
+    {
+        sources = cfg_read_sources(dir);
+        status  = (sources == NULL) ? 1 : 0;
+    }
+    if (status == 0)
+    {
+        status = gen_parse_reg_names(sources);
+    }
+    if (status == 0)
+    {
+        status = cfg_parse_init(sources, "xcvr_common_config_t", "xcvr_common_config", &gen_common_layout,
+                                &gen_common_init);
+    }
+    if (status == 0)
+    {
+        status = gen_build_common_macros();
+    }
+    for (i = 0U; (status == 0) && (i < GEN_NUM_CONFIGS); i++)
+    {
+        status = gen_fold_config(sources, i);
+    }
+    free(sources);
+
+    if (status == 0)
+    {
+        status = gen_verify();
+    }
+
+    if (status == 0)
+    {
+        (void)snprintf(path, sizeof(path), "%s/%s.h", dir, GEN_FILE_NAME);
+        out = fopen(path, "w");
+        if ((out == NULL) || (gen_write_header(out) != 0))
+        {
+            (void)fprintf(stderr, "failed to write %s\n", path);
+            status = 1;
+        }
+        if (out != NULL)
+        {
+            (void)fclose(out);
+        }
+    }
+
+    if (status == 0)
+    {
+        (void)snprintf(path, sizeof(path), "%s/%s.c", dir, GEN_FILE_NAME);
+        out = fopen(path, "w");
+        if ((out == NULL) || (gen_write_source(out) != 0))
+        {
+            (void)fprintf(stderr, "failed to write %s\n", path);
+            status = 1;
+        }
+        if (out != NULL)
+        {
+            (void)fclose(out);
+        }
+    }
+
+    if (status == 0)
+    {
+        (void)printf("folded %u configurations of %u registers into %s\n", (unsigned int)GEN_NUM_CONFIGS,
+                     (unsigned int)GEN_NUM_REGS, dir);
+    }
+
+    return status;
+}
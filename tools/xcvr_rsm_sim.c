@@ -0,0 +1,560 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Host RSM model for the step manager double buffering (x86-64 Linux, KW47 and later with a 32MHz RF_OSC).
+ *
+ * The step manager sources run on the host against a stand-in register file: the XCVR_MISC page and both packet RAMs
+ * are mapped at their device address. The model plays the RSM side of the circular buffers set up by
+ * XCVR_LCL_InitCfgResPointers():
+ *   - it reads each step configuration at its own config read index and page, and checks that the step is loaded,
+ *     from the RSM_CONFIG_WR_PTR and RSM_CONFIG_WR_PAGE the driver left in RSM_CONFIG_PTR, and that it is the step of
+ *     the sequence built in system RAM. A step that is not loaded yet is a config underrun,
+ *   - it writes one result (two in sniffer mode) per step at its own result write index and page, of the size
+ *     XCVR_LCL_CalcConfigResult_Size() gives for the step type, with that size in the RESULT_SIZE field of the
+ *     header. Writing over a result the driver has not read yet, from RSM_RESULT_RD_PTR and RSM_RESULT_RD_PAGE in
+ *     RSM_RESULT_PTR, is a result overrun,
+ *   - it raises a STEP event every interrupt_step_count steps and an EOS event after the last step. The events are
+ *     served by XCVR_LCL_HandleIrqStepEos() once the RSM has run SIM_ISR_LATENCY more steps, as an interrupt
+ *     latency, while the RSM keeps running.
+ * Both sides roll a buffer over when the largest step of the subevent does not fit before its end, or when a step
+ * ends exactly at the end, and the page bit toggles on every rollover. The results gathered in system RAM must be the
+ * ones the model wrote. A result index is attached to each run, and every step looked up through it must give the
+ * header, RTT body and IQ body of its results (both of them in sniffer mode) in system RAM.
+ *
+ * Each subevent has SIM_NUM_STEPS steps of pseudo random types. It is run for every RTT type, 1 to 4 antenna paths,
+ * with and without sniffer mode, and 1, 4, 8 and 16 steps per interrupt. For each combination, the tool runs every
+ * depth of the config buffer, then of the result buffer, up to SIM_LARGE_DEPTH words. It reports the smallest depth
+ * that works and the safe depth, from which every larger one works: because of the words left unused before a
+ * rollover, a depth a little above the smallest working one can fail. The safe depths must not exceed
+ * (2 * interrupt_step_count + 1) largest config steps, two batches ahead of the RSM and the words left before a
+ * rollover, and (interrupt_step_count + 1) largest result steps. The time spent in the interrupt handler is measured
+ * with large buffers.
+ *
+ * Build it on the host against the device headers of the target, as the xcvr_rsm_sim target of tools/CMakeLists.txt
+ * does:
+ *
+ *   gcc -O2 -DNXP_RADIO_GEN=470 -DRF_OSC_26MHZ=0 -I<device headers> -Idrv -Idrv/nb2p4ghz \
+ *       -Idrv/nb2p4ghz/configs/gen47 tools/xcvr_rsm_sim.c tools/xcvr_host_map.c \
+ *       drv/{dbg_ram_capture,mathfp,nxp_xcvr_ext_ctrl,nxp_xcvr_lcl_ctrl,nxp_xcvr_lcl_step_mgr,rfmc_ctrl}.c \
+ *       drv/nb2p4ghz/{nxp2p4_xcvr,nxp_xcvr_blob,nxp_xcvr_hop_table,nxp_xcvr_trim}.c \
+ *       drv/nb2p4ghz/configs/gen47/nxp_xcvr_*.c -lm -o xcvr_rsm_sim
+ *   ./xcvr_rsm_sim
+ *
+ * The report has one JSON object per combination, depths are in words, for instance:
+ *   {"rtt_type":6,"num_ap":4,"sniffer":0,"irq_steps":8,"cfg_max":13,"res_max":10,"min_cfg_depth":221,
+ *    "min_res_depth":130,"irqs":32,"ns_per_irq":120,"ns_per_step":15}
+ * and a last object with the number of combinations and failures. The exit status is non zero if a subevent fails
+ * with large buffers, if a safe depth exceeds its bound, or if the model misses the config
+ * underrun of interrupts served after the RSM has run through the next batch.
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <sys/mman.h>
+#include <time.h>
+#include "nxp_xcvr_lcl_step_mgr.h"
+#include "xcvr_host_map.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define SIM_NUM_STEPS (255U)   /* Steps per subevent, the largest count XCVR_LCL_SetupInitialConfigs() takes */
+#define SIM_ISR_LATENCY (0U)   /* Steps run by the RSM between an event and its interrupt handler */
+#define SIM_LARGE_DEPTH (600U) /* Buffer depth of the timed runs, below the size of both packet RAMs */
+#define SIM_TIMING_RUNS (20U)
+#define SIM_MAX_WORDS (SIM_NUM_STEPS * 2U * 16U) /* Largest sequence of configs or results, in words */
+#define SIM_MAX_EVENTS (SIM_NUM_STEPS + 1U)
+#define SIM_FILL (0xDEADBEEFUL) /* Packet RAM content before a run */
+#define SIM_NUM_PERIPHS (3U)
+#define SIM_NUM_AP_MAX (4U)
+#define SIM_NUM_IRQ_STEPS (4U)
+
+/* Events of the model, passed to XCVR_LCL_HandleIrqStepEos() as status bits */
+#define SIM_EVENT_STEP (0x1)
+#define SIM_EVENT_EOS (0x2)
+
+/* Errors of a run, as bits */
+#define SIM_ERR_SETUP (0x01U)
+#define SIM_ERR_CFG_UNDERRUN (0x02U)
+#define SIM_ERR_CFG_CONTENT (0x04U)
+#define SIM_ERR_RES_OVERRUN (0x08U)
+#define SIM_ERR_RES_CONTENT (0x10U)
+#define SIM_ERR_HANDLER (0x20U)
+#define SIM_ERR_INDEX (0x40U)
+
+typedef struct
+{
+    XCVR_RSM_RTT_TYPE_T rtt_type;
+    uint8_t num_ap;
+    bool sniffer;
+    uint8_t irq_steps;
+    uint8_t latency;
+    uint16_t config_depth;
+    uint16_t result_depth;
+} sim_params_t;
+
+/* RSM side of the buffers */
+typedef struct
+{
+    uint16_t config_index;
+    uint16_t result_index;
+    uint8_t config_page;
+    uint8_t result_page;
+    uint16_t step;
+    uint32_t errors;
+} sim_rsm_t;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+static uint64_t sim_time_ns(void);
+static uint32_t sim_result_word(uint16_t step, uint8_t copy, uint8_t word, uint8_t length);
+static void sim_build(XCVR_RSM_RTT_TYPE_T rtt_type, uint8_t num_ap, bool sniffer);
+static bool sim_loaded(const sim_rsm_t *rsm, uint8_t length);
+static bool sim_free(const sim_rsm_t *rsm, uint16_t length);
+static void sim_rsm_step(const sim_params_t *params, sim_rsm_t *rsm);
+static uint32_t sim_check_index(const sim_params_t *params);
+static uint32_t sim_run(const sim_params_t *params, uint64_t *irq_ns, uint32_t *num_irqs);
+static uint16_t sim_depths(sim_params_t *params, uint16_t *depth, uint16_t start, uint16_t *safe_depth);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static const host_periph_t sim_periphs[SIM_NUM_PERIPHS] = {
+    HOST_PERIPH(XCVR_MISC),
+    {"TX_PACKET_RAM", (uintptr_t)TX_PACKET_RAM_BASE, TX_PACKET_RAM_PACKET_RAM_COUNT * sizeof(uint32_t)},
+    {"RX_PACKET_RAM", (uintptr_t)RX_PACKET_RAM_BASE, RX_PACKET_RAM_PACKET_RAM_COUNT * sizeof(uint32_t)},
+};
+static host_map_t sim_regs; /* Pages of the stand-in register file */
+
+static const uint8_t sim_irq_steps[SIM_NUM_IRQ_STEPS] = {1U, 4U, 8U, 16U};
+
+static uint32_t sim_configs[SIM_MAX_WORDS];
+static uint32_t sim_config_offsets[SIM_NUM_STEPS];
+static uint32_t sim_expected[SIM_MAX_WORDS];
+static uint32_t sim_results[SIM_MAX_WORDS + 1U];
+static uint8_t sim_modes[SIM_NUM_STEPS];
+static XCVR_RSM_FSTEP_TYPE_T sim_step_types[SIM_NUM_STEPS];
+static uint16_t sim_index_offsets[SIM_NUM_STEPS];
+static uint8_t sim_index_lengths[SIM_NUM_STEPS];
+static cs_result_index_t sim_index = {
+    .step_offset = sim_index_offsets,
+    .step_length = sim_index_lengths,
+    .step_type   = sim_step_types,
+    .max_steps   = SIM_NUM_STEPS,
+};
+static uint8_t sim_cfg_len[4];
+static uint8_t sim_res_len[4]; /* One result, not doubled in sniffer mode */
+static uint8_t sim_cfg_max;
+static uint8_t sim_res_max; /* Results of one step, doubled in sniffer mode */
+static uint32_t sim_expected_words;
+static uint16_t sim_config_base;
+static uint16_t sim_config_end;
+static uint16_t sim_result_base;
+static uint16_t sim_result_end;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+static uint64_t sim_time_ns(void)
+{
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((uint64_t)now.tv_sec * 1000000000ULL) + (uint64_t)now.tv_nsec;
+}
+
+/* Result word of a step, the first word of each result is its header with RESULT_SIZE in the second byte */
+static uint32_t sim_result_word(uint16_t step, uint8_t copy, uint8_t word, uint8_t length)
+{
+    uint32_t value = 0x50000000UL | ((uint32_t)step << 16U) | ((uint32_t)copy << 12U) | word;
+
+    if (word == 0U)
+    {
+        value = ((uint32_t)step << 16U) | ((uint32_t)copy << 12U) |
+                ((uint32_t)COM_RES_HDR_SIZE_AGC_IDX_RESULT_SIZE(length) << 8U);
+    }
+
+    return value;
+}
+
+/* Builds the config sequence of a subevent and its expected results */
+static void sim_build(XCVR_RSM_RTT_TYPE_T rtt_type, uint8_t num_ap, bool sniffer)
+{
+    uint32_t seed   = 2024U;
+    uint32_t offset = 0U;
+    uint8_t length;
+
+    for (uint8_t mode = 0U; mode < 4U; mode++)
+    {
+        (void)XCVR_LCL_CalcConfigResult_Size((XCVR_RSM_FSTEP_TYPE_T)mode, rtt_type, num_ap, &sim_cfg_len[mode],
+                                             &sim_res_len[mode]);
+    }
+    /* The step manager rolls over on the sizes of the mode 3 step */
+    sim_cfg_max = sim_cfg_len[3];
+    sim_res_max = sim_res_len[3] * (sniffer ? 2U : 1U);
+
+    sim_expected_words = 0U;
+    for (uint16_t step = 0U; step < SIM_NUM_STEPS; step++)
+    {
+        seed            = (seed * 1103515245U) + 12345U;
+        sim_modes[step] = (uint8_t)((seed >> 16U) & 0x3U);
+        sim_step_types[step]     = (XCVR_RSM_FSTEP_TYPE_T)sim_modes[step];
+        sim_config_offsets[step] = offset;
+        length                   = sim_cfg_len[sim_modes[step]];
+        sim_configs[offset]      = ((uint32_t)COM_MODE_013_CFG_HDR_STEP_CFG_MODE(sim_modes[step]) << 16U) | step;
+        for (uint8_t word = 1U; word < length; word++)
+        {
+            sim_configs[offset + word] = 0xC0000000UL | ((uint32_t)step << 8U) | word;
+        }
+        offset += length;
+
+        length = sim_res_len[sim_modes[step]];
+        for (uint8_t copy = 0U; copy < (sniffer ? 2U : 1U); copy++)
+        {
+            for (uint8_t word = 0U; word < length; word++)
+            {
+                sim_expected[sim_expected_words] = sim_result_word(step, copy, word, length);
+                sim_expected_words++;
+            }
+        }
+    }
+}
+
+/* True if the step at the RSM config index is completely written by the driver */
+static bool sim_loaded(const sim_rsm_t *rsm, uint8_t length)
+{
+    uint32_t reg      = XCVR_MISC->RSM_CONFIG_PTR;
+    uint16_t wr_index = (uint16_t)((reg & XCVR_MISC_RSM_CONFIG_PTR_RSM_CONFIG_WR_PTR_MASK) >>
+                                   XCVR_MISC_RSM_CONFIG_PTR_RSM_CONFIG_WR_PTR_SHIFT);
+    uint8_t wr_page   = (uint8_t)((reg & XCVR_MISC_RSM_CONFIG_PTR_RSM_CONFIG_WR_PAGE_MASK) >>
+                                XCVR_MISC_RSM_CONFIG_PTR_RSM_CONFIG_WR_PAGE_SHIFT);
+
+    /* On the same page the driver is ahead in the buffer, on the other page it is one lap ahead */
+    return (wr_page != rsm->config_page) || ((rsm->config_index + length) <= wr_index);
+}
+
+/* True if the result words at the RSM result index have been read by the driver */
+static bool sim_free(const sim_rsm_t *rsm, uint16_t length)
+{
+    uint32_t reg      = XCVR_MISC->RSM_RESULT_PTR;
+    uint16_t rd_index = (uint16_t)((reg & XCVR_MISC_RSM_RESULT_PTR_RSM_RESULT_RD_PTR_MASK) >>
+                                   XCVR_MISC_RSM_RESULT_PTR_RSM_RESULT_RD_PTR_SHIFT);
+    uint8_t rd_page   = (uint8_t)((reg & XCVR_MISC_RSM_RESULT_PTR_RSM_RESULT_RD_PAGE_MASK) >>
+                                XCVR_MISC_RSM_RESULT_PTR_RSM_RESULT_RD_PAGE_SHIFT);
+
+    /* On the same page the driver has read everything before the RSM, on the other page it is one lap behind */
+    return (rd_page == rsm->result_page) || ((rsm->result_index + length) <= rd_index);
+}
+
+/* Runs one step of the RSM */
+static void sim_rsm_step(const sim_params_t *params, sim_rsm_t *rsm)
+{
+    const uint32_t *config_ram = (const uint32_t *)(uintptr_t)TX_PACKET_RAM_BASE;
+    uint32_t *result_ram       = (uint32_t *)(uintptr_t)RX_PACKET_RAM_BASE;
+    uint8_t mode               = sim_modes[rsm->step];
+    uint8_t copies             = params->sniffer ? 2U : 1U;
+    uint8_t length;
+
+    if (sim_cfg_max > (sim_config_end - rsm->config_index))
+    {
+        rsm->config_index = sim_config_base;
+        rsm->config_page ^= 1U;
+    }
+    length = sim_cfg_len[mode];
+    if (!sim_loaded(rsm, length))
+    {
+        rsm->errors |= SIM_ERR_CFG_UNDERRUN;
+    }
+    for (uint8_t word = 0U; word < length; word++)
+    {
+        if (config_ram[rsm->config_index + word] != sim_configs[sim_config_offsets[rsm->step] + word])
+        {
+            rsm->errors |= SIM_ERR_CFG_CONTENT;
+        }
+    }
+    rsm->config_index += length;
+    if (rsm->config_index == sim_config_end)
+    {
+        rsm->config_index = sim_config_base;
+        rsm->config_page ^= 1U;
+    }
+
+    if (sim_res_max > (sim_result_end - rsm->result_index))
+    {
+        rsm->result_index = sim_result_base;
+        rsm->result_page ^= 1U;
+    }
+    length = sim_res_len[mode];
+    if (!sim_free(rsm, (uint16_t)length * copies))
+    {
+        rsm->errors |= SIM_ERR_RES_OVERRUN;
+    }
+    for (uint8_t copy = 0U; copy < copies; copy++)
+    {
+        for (uint8_t word = 0U; word < length; word++)
+        {
+            result_ram[rsm->result_index] = sim_result_word(rsm->step, copy, word, length);
+            rsm->result_index++;
+        }
+    }
+    if (rsm->result_index == sim_result_end)
+    {
+        rsm->result_index = sim_result_base;
+        rsm->result_page ^= 1U;
+    }
+    rsm->step++;
+}
+
+/* Every step of the result index must point at its results in sim_results, split by its step type */
+static uint32_t sim_check_index(const sim_params_t *params)
+{
+    cs_step_results_t step_results;
+    uint32_t offset = 0U;
+    uint32_t errors = 0U;
+    uint8_t rtt_words;
+    uint8_t iq_words;
+    uint8_t length;
+
+    errors |= (sim_index.num_steps != SIM_NUM_STEPS) ? SIM_ERR_INDEX : 0U;
+    errors |= (XCVR_LCL_GetStepResults(&sim_index, (uint8_t)sim_index.num_steps, &step_results) !=
+               gXcvrLclStatusInvalidArgs) ?
+                  SIM_ERR_INDEX :
+                  0U;
+    for (uint16_t step = 0U; (errors == 0U) && (step < SIM_NUM_STEPS); step++)
+    {
+        length    = sim_res_len[sim_modes[step]];
+        rtt_words = (sim_modes[step] == 2U) ? 0U : 4U;
+        iq_words  = (sim_modes[step] >= 2U) ? (params->num_ap + 1U) : 0U;
+        if ((XCVR_LCL_GetStepResults(&sim_index, (uint8_t)step, &step_results) != gXcvrLclStatusSuccess) ||
+            (step_results.step_format != sim_step_types[step]) ||
+            (step_results.num_results != (params->sniffer ? 2U : 1U)))
+        {
+            errors |= SIM_ERR_INDEX;
+        }
+        for (uint8_t copy = 0U; (errors == 0U) && (copy < step_results.num_results); copy++)
+        {
+            const cs_step_result_view_t *view = &step_results.result[copy];
+            if (((const uint32_t *)view->header != &sim_results[offset]) || (view->num_iq_words != iq_words) ||
+                ((rtt_words != 0U) && (view->rtt_body->NADM_ERROR_RSSI != sim_result_word(step, copy, 1U, length))) ||
+                ((rtt_words == 0U) && (view->rtt_body != NULLPTR)) ||
+                ((iq_words != 0U) &&
+                 (view->iq_body->PCT_RESULT[iq_words - 1U] != sim_result_word(step, copy, length - 1U, length))) ||
+                ((iq_words == 0U) && (view->iq_body != NULLPTR)))
+            {
+                errors |= SIM_ERR_INDEX;
+            }
+            offset += length;
+        }
+    }
+
+    return errors;
+}
+
+/* Runs a subevent, returns its error bits and the time spent in the interrupt handler */
+static uint32_t sim_run(const sim_params_t *params, uint64_t *irq_ns, uint32_t *num_irqs)
+{
+    cs_pkt_ram_config_info_t info = {
+        .config_pkt_ram_bank   = TX_PKT_RAM_SEL,
+        .result_pkt_ram_bank   = RX_PKT_RAM_SEL,
+        .config_base_addr_word = 0U,
+        .result_base_addr_word = 0U,
+        .config_depth_word     = params->config_depth,
+        .result_depth_word     = params->result_depth,
+        .interrupt_step_count  = params->irq_steps,
+        .is_sniffer_mode       = params->sniffer,
+    };
+    sim_rsm_t rsm               = {0U};
+    uint16_t events[SIM_MAX_EVENTS]; /* RSM step count at which each event is served */
+    int32_t event_bits[SIM_MAX_EVENTS];
+    uint16_t num_events = 0U;
+    uint16_t next_event = 0U;
+    uint64_t start;
+
+    for (uint32_t i = 0U; i < TX_PACKET_RAM_PACKET_RAM_COUNT; i++)
+    {
+        ((uint32_t *)(uintptr_t)TX_PACKET_RAM_BASE)[i] = SIM_FILL;
+    }
+    for (uint32_t i = 0U; i < RX_PACKET_RAM_PACKET_RAM_COUNT; i++)
+    {
+        ((uint32_t *)(uintptr_t)RX_PACKET_RAM_BASE)[i] = SIM_FILL;
+    }
+    for (uint32_t i = 0U; i <= sim_expected_words; i++)
+    {
+        sim_results[i] = 0U;
+    }
+    XCVR_MISC->RSM_CONFIG_PTR = 0U;
+    XCVR_MISC->RSM_RESULT_PTR = 0U;
+    sim_config_base           = info.config_base_addr_word;
+    sim_config_end            = info.config_base_addr_word + info.config_depth_word;
+    sim_result_base           = info.result_base_addr_word;
+    sim_result_end            = info.result_base_addr_word + info.result_depth_word;
+    *irq_ns                   = 0U;
+
+    if ((XCVR_LCL_InitCfgResPointers(&info) != gXcvrLclStatusSuccess) ||
+        (XCVR_LCL_AttachResultIndex(&sim_index) != gXcvrLclStatusSuccess) ||
+        (XCVR_LCL_SetupInitialConfigs(SIM_NUM_STEPS, sim_configs, sim_results, params->rtt_type, params->num_ap,
+                                      params->sniffer) != gXcvrLclStatusSuccess))
+    {
+        rsm.errors |= SIM_ERR_SETUP;
+    }
+
+    while ((rsm.errors == 0U) && (next_event < num_events || rsm.step < SIM_NUM_STEPS))
+    {
+        if (rsm.step < SIM_NUM_STEPS)
+        {
+            sim_rsm_step(params, &rsm);
+            if (((rsm.step % params->irq_steps) == 0U) || (rsm.step == SIM_NUM_STEPS))
+            {
+                events[num_events]     = rsm.step + params->latency;
+                event_bits[num_events] = ((rsm.step % params->irq_steps) == 0U) ? SIM_EVENT_STEP : 0;
+                event_bits[num_events] |= (rsm.step == SIM_NUM_STEPS) ? SIM_EVENT_EOS : 0;
+                num_events++;
+            }
+        }
+        /* Serve the events due, all of them once the RSM is done */
+        while ((rsm.errors == 0U) && (next_event < num_events) &&
+               ((events[next_event] <= rsm.step) || (rsm.step == SIM_NUM_STEPS)))
+        {
+            start = sim_time_ns();
+            if (XCVR_LCL_HandleIrqStepEos(event_bits[next_event]) != gXcvrLclStatusSuccess)
+            {
+                rsm.errors |= SIM_ERR_HANDLER;
+            }
+            *irq_ns += sim_time_ns() - start;
+            next_event++;
+        }
+    }
+    *num_irqs = next_event;
+
+    for (uint32_t i = 0U; (rsm.errors == 0U) && (i < sim_expected_words); i++)
+    {
+        rsm.errors |= (sim_results[i] != sim_expected[i]) ? SIM_ERR_RES_CONTENT : 0U;
+    }
+    rsm.errors |= ((rsm.errors == 0U) && (sim_results[sim_expected_words] != 0U)) ? SIM_ERR_RES_CONTENT : 0U;
+    rsm.errors |= (rsm.errors == 0U) ? sim_check_index(params) : 0U;
+
+    return rsm.errors;
+}
+
+/*
+ * Runs the subevent with every depth of one buffer from start to SIM_LARGE_DEPTH, the other one being large. Returns
+ * the smallest working depth and, in safe_depth, the depth from which every larger one works too.
+ */
+static uint16_t sim_depths(sim_params_t *params, uint16_t *depth, uint16_t start, uint16_t *safe_depth)
+{
+    uint16_t min_depth = 0U;
+    uint64_t irq_ns;
+    uint32_t num_irqs;
+
+    *safe_depth = start;
+    for (*depth = start; *depth <= SIM_LARGE_DEPTH; (*depth)++)
+    {
+        if (sim_run(params, &irq_ns, &num_irqs) == 0U)
+        {
+            min_depth = (min_depth == 0U) ? *depth : min_depth;
+        }
+        else
+        {
+            *safe_depth = *depth + 1U;
+        }
+    }
+    *depth = SIM_LARGE_DEPTH;
+
+    return min_depth;
+}
+
+int main(void)
+{
+    sim_params_t params;
+    uint64_t irq_ns;
+    uint64_t best_ns;
+    uint32_t num_irqs;
+    uint32_t timed_irqs;
+    uint32_t errors;
+    uint16_t safe_cfg;
+    uint16_t safe_res;
+    uint16_t bound_cfg;
+    uint16_t bound_res;
+    uint32_t combinations = 0U;
+    uint32_t failures     = 0U;
+    uint16_t min_cfg;
+    uint16_t min_res;
+
+    if (host_map(&sim_regs, sim_periphs, SIM_NUM_PERIPHS, PROT_READ | PROT_WRITE) != 0)
+    {
+        return 1;
+    }
+
+    for (uint8_t rtt = 0U; rtt < (uint8_t)XCVR_RSM_RTT_ERROR; rtt++)
+    {
+        for (uint8_t num_ap = 1U; num_ap <= SIM_NUM_AP_MAX; num_ap++)
+        {
+            for (uint8_t sniffer = 0U; sniffer < 2U; sniffer++)
+            {
+                sim_build((XCVR_RSM_RTT_TYPE_T)rtt, num_ap, sniffer != 0U);
+                for (uint8_t i = 0U; i < SIM_NUM_IRQ_STEPS; i++)
+                {
+                    params.rtt_type     = (XCVR_RSM_RTT_TYPE_T)rtt;
+                    params.num_ap       = num_ap;
+                    params.sniffer      = (sniffer != 0U);
+                    params.irq_steps    = sim_irq_steps[i];
+                    params.latency      = SIM_ISR_LATENCY;
+                    params.config_depth = SIM_LARGE_DEPTH;
+                    params.result_depth = SIM_LARGE_DEPTH;
+
+                    best_ns    = UINT64_MAX;
+                    errors     = 0U;
+                    timed_irqs = 0U;
+                    for (uint32_t run = 0U; (run < SIM_TIMING_RUNS) && (errors == 0U); run++)
+                    {
+                        errors  = sim_run(&params, &irq_ns, &timed_irqs);
+                        best_ns = (irq_ns < best_ns) ? irq_ns : best_ns;
+                    }
+
+                    min_cfg = sim_depths(&params, &params.config_depth, sim_cfg_max, &safe_cfg);
+                    min_res = sim_depths(&params, &params.result_depth, sim_res_max, &safe_res);
+                    /* Two batches of configs are ahead of the RSM, one batch of results behind it */
+                    bound_cfg = (uint16_t)(((2U * params.irq_steps) + 1U) * sim_cfg_max);
+                    bound_res = (uint16_t)((params.irq_steps + 1U) * sim_res_max);
+
+                    /* An interrupt served after the RSM is past the next batch must starve it of configs */
+                    params.latency = params.irq_steps + 1U;
+                    errors |= ((sim_run(&params, &irq_ns, &num_irqs) & SIM_ERR_CFG_UNDERRUN) == 0U) ?
+                                  SIM_ERR_CFG_UNDERRUN :
+                                  0U;
+
+                    combinations++;
+                    if ((errors != 0U) || (min_cfg == 0U) || (min_res == 0U) || (safe_cfg > bound_cfg) ||
+                        (safe_res > bound_res))
+                    {
+                        (void)fprintf(stderr,
+                                      "rtt_type %u num_ap %u sniffer %u irq_steps %u: errors 0x%x, safe depths %u and "
+                                      "%u for bounds %u and %u\n",
+                                      (unsigned int)rtt, (unsigned int)num_ap, (unsigned int)sniffer,
+                                      (unsigned int)params.irq_steps, (unsigned int)errors, (unsigned int)safe_cfg,
+                                      (unsigned int)safe_res, (unsigned int)bound_cfg, (unsigned int)bound_res);
+                        failures++;
+                    }
+                    (void)printf(
+                        "{\"rtt_type\":%u,\"num_ap\":%u,\"sniffer\":%u,\"irq_steps\":%u,\"cfg_max\":%u,\"res_max\":%u,"
+                        "\"min_cfg_depth\":%u,\"safe_cfg_depth\":%u,\"min_res_depth\":%u,\"safe_res_depth\":%u,"
+                        "\"irqs\":%u,\"ns_per_irq\":%llu,\"ns_per_step\":%llu}\n",
+                        (unsigned int)rtt, (unsigned int)num_ap, (unsigned int)sniffer, (unsigned int)params.irq_steps,
+                        (unsigned int)sim_cfg_max, (unsigned int)sim_res_max, (unsigned int)min_cfg,
+                        (unsigned int)safe_cfg, (unsigned int)min_res, (unsigned int)safe_res, (unsigned int)timed_irqs,
+                        (unsigned long long)(best_ns / ((timed_irqs == 0U) ? 1U : timed_irqs)),
+                        (unsigned long long)(best_ns / SIM_NUM_STEPS));
+                }
+            }
+        }
+    }
+    (void)printf("{\"combinations\":%u,\"failures\":%u}\n", (unsigned int)combinations, (unsigned int)failures);
+
+    return (failures != 0U) ? 1 : 0;
+}
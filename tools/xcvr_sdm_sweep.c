@@ -0,0 +1,153 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Host sweep of the frequency override Low Port settings (x86-64 Linux).
+ *
+ * The driver sources run on the host against a stand-in register file: the pages of the PLL_DIG and TSM peripherals
+ * of the device headers are mapped at their device address. For every whole Hz frequency from SWEEP_MIN_FREQ_HZ to
+ * SWEEP_MAX_FREQ_HZ, XCVR_OverrideTxFrequency() programs the PLL and the LPM_SDM_CTRL1, LPM_SDM_CTRL2 and LPM_SDM_CTRL3
+ * registers are compared with the values of the float64_t computation XCVR_OverrideTxFrequency() used before the
+ * integer XCVR_CalcLowPortSdm(), kept here as the reference.
+ *
+ * The reference clock is a build option of the driver, so build and run the tool once with RF_OSC_26MHZ=1 and once
+ * with RF_OSC_26MHZ=0 against the device headers of the target:
+ *
+ *   gcc -O2 -DNXP_RADIO_GEN=470 -DRF_OSC_26MHZ=0 -I<device headers> -Idrv -Idrv/nb2p4ghz \
+ *       -Idrv/nb2p4ghz/configs/gen47 tools/xcvr_sdm_sweep.c tools/xcvr_host_map.c \
+ *       drv/{dbg_ram_capture,mathfp,nxp_xcvr_ext_ctrl,nxp_xcvr_lcl_ctrl,nxp_xcvr_lcl_step_mgr,rfmc_ctrl}.c \
+ *       drv/nb2p4ghz/{nxp2p4_xcvr,nxp_xcvr_blob,nxp_xcvr_hop_table,nxp_xcvr_trim}.c \
+ *       drv/nb2p4ghz/configs/gen47/nxp_xcvr_*.c -lm -o xcvr_sdm_sweep
+ *   ./xcvr_sdm_sweep
+ *
+ * The report is one JSON object, preceded by one line per mismatching frequency (at most SWEEP_MAX_REPORTED), e.g.:
+ *   {"ref_osc_hz":32000000,"first_hz":2360000000,"last_hz":2487000000,"freqs":127000001,"mismatches":0}
+ * The exit status is non zero if a register differs from the reference for any frequency.
+ */
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <sys/mman.h>
+#include "nxp2p4_xcvr.h"
+#include "xcvr_host_map.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define SWEEP_MIN_FREQ_HZ  (2360000000UL)
+#define SWEEP_MAX_FREQ_HZ  (2487000000UL)
+#define SWEEP_MAX_REPORTED (16U)
+#define SWEEP_NUM_PERIPHS  (2U)
+
+#if RF_OSC_26MHZ == 1
+#define SWEEP_REF_OSC_HZ (26000000UL)
+#else
+#define SWEEP_REF_OSC_HZ (32000000UL)
+#endif /* RF_OSC_26MHZ == 1 */
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+static void sweep_reference(uint32_t ref_osc, uint32_t freq, uint32_t ctrl1_init, uint32_t regs[3]);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static const host_periph_t sweep_periphs[SWEEP_NUM_PERIPHS] = {
+    HOST_PERIPH(XCVR_PLL_DIG),
+    HOST_PERIPH(XCVR_TSM),
+};
+static host_map_t sweep_regs; /* Pages of the stand-in register file */
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+/*
+ * LPM_SDM_CTRL1, LPM_SDM_CTRL2 and LPM_SDM_CTRL3 as programmed by the float64_t version of XCVR_OverrideTxFrequency(),
+ * for a LPM_SDM_CTRL1 value of ctrl1_init before the override. The computation is kept as it was.
+ */
+static void sweep_reference(uint32_t ref_osc, uint32_t freq, uint32_t ctrl1_init, uint32_t regs[3])
+{
+    const uint32_t denominator = 0x08000000UL - 1UL;
+    const float64_t sdm_lsb    = (float64_t)ref_osc / (((float64_t)denominator) / 2.0F);
+    float64_t integer_used_in_Hz, integer_used_in_LSB, numerator_fraction, numerator_in_Hz, numerator_in_LSB,
+        numerator_unrounded, real_int_and_fraction, real_fraction, requested_freq_in_LSB;
+    uint32_t integer_truncated, integer_to_use;
+    int32_t numerator_rounded;
+
+    real_int_and_fraction = (float64_t)freq / ((float64_t)ref_osc * 2.0F);
+    integer_truncated     = (uint32_t)trunc(real_int_and_fraction);
+    real_fraction         = real_int_and_fraction - (float64_t)integer_truncated;
+
+    if (real_fraction > 0.5F)
+    {
+        integer_to_use = integer_truncated + 1U;
+    }
+    else
+    {
+        integer_to_use = integer_truncated;
+    }
+
+    numerator_fraction = real_int_and_fraction - (float64_t)integer_to_use; /* Fractional portion of numerator */
+
+    integer_used_in_Hz  = (float64_t)integer_to_use * (float64_t)ref_osc * 2.0F;
+    integer_used_in_LSB = integer_used_in_Hz / sdm_lsb;
+
+    numerator_in_Hz  = numerator_fraction * (float64_t)ref_osc * 2.0F;
+    numerator_in_LSB = numerator_in_Hz / sdm_lsb;
+
+    requested_freq_in_LSB = integer_used_in_LSB + numerator_in_LSB;
+    numerator_unrounded   = (requested_freq_in_LSB - integer_used_in_LSB);
+    numerator_rounded     = (int32_t)round(numerator_unrounded);
+
+    regs[0] = (ctrl1_init & ~XCVR_PLL_DIG_LPM_SDM_CTRL1_LPM_INTG_MASK) |
+              XCVR_PLL_DIG_LPM_SDM_CTRL1_LPM_INTG(integer_to_use) | XCVR_PLL_DIG_LPM_SDM_CTRL1_SDM_MAP_DISABLE_MASK;
+    regs[1] = (uint32_t)numerator_rounded;
+    regs[2] = denominator;
+}
+
+int main(void)
+{
+    uint32_t expected[3];
+    uint32_t ctrl1_init;
+    uint32_t freq;
+    uint32_t mismatches = 0U;
+    int status          = 1;
+
+    if (host_map(&sweep_regs, sweep_periphs, SWEEP_NUM_PERIPHS, PROT_READ | PROT_WRITE) == 0)
+    {
+        for (freq = SWEEP_MIN_FREQ_HZ; freq <= SWEEP_MAX_FREQ_HZ; freq++)
+        {
+            /* Vary the other LPM_SDM_CTRL1 bits, the override must keep them */
+            ctrl1_init                  = freq * 0x9E3779B9U;
+            XCVR_PLL_DIG->LPM_SDM_CTRL1 = ctrl1_init;
+            XCVR_PLL_DIG->LPM_SDM_CTRL2 = 0U;
+            XCVR_PLL_DIG->LPM_SDM_CTRL3 = 0U;
+            sweep_reference(SWEEP_REF_OSC_HZ, freq, ctrl1_init, expected);
+            if ((XCVR_OverrideTxFrequency(freq) != gXcvrSuccess_c) || (XCVR_PLL_DIG->LPM_SDM_CTRL1 != expected[0]) ||
+                (XCVR_PLL_DIG->LPM_SDM_CTRL2 != expected[1]) || (XCVR_PLL_DIG->LPM_SDM_CTRL3 != expected[2]))
+            {
+                if (mismatches < SWEEP_MAX_REPORTED)
+                {
+                    (void)printf("{\"freq_hz\":%lu,\"ctrl1\":[%lu,%lu],\"ctrl2\":[%ld,%ld],\"ctrl3\":[%lu,%lu]}\n",
+                                 (unsigned long)freq, (unsigned long)XCVR_PLL_DIG->LPM_SDM_CTRL1,
+                                 (unsigned long)expected[0], (long)(int32_t)XCVR_PLL_DIG->LPM_SDM_CTRL2,
+                                 (long)(int32_t)expected[1], (unsigned long)XCVR_PLL_DIG->LPM_SDM_CTRL3,
+                                 (unsigned long)expected[2]);
+                }
+                mismatches++;
+            }
+        }
+        (void)printf(
+            "{\"ref_osc_hz\":%lu,\"first_hz\":%lu,\"last_hz\":%lu,\"freqs\":%lu,\"mismatches\":%lu}\n",
+            (unsigned long)SWEEP_REF_OSC_HZ, (unsigned long)SWEEP_MIN_FREQ_HZ, (unsigned long)SWEEP_MAX_FREQ_HZ,
+            (unsigned long)(SWEEP_MAX_FREQ_HZ - SWEEP_MIN_FREQ_HZ + 1UL), (unsigned long)mismatches);
+        status = (mismatches == 0U) ? 0 : 1;
+    }
+
+    return status;
+}
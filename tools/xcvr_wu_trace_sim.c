@@ -0,0 +1,348 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Host exercise of the warmup trace (x86-64 Linux).
+ *
+ * The driver sources, built with gXcvrWarmupTrace_d set to 1, run on the host against a stand-in register file: the
+ * pages of the TSM, MISC and PLL_DIG peripherals of the device headers are mapped at their device address. A thread
+ * simulates the TSM counter at one count per microsecond:
+ *   - a FORCE_TX_EN or FORCE_RX_EN bit set in the TSM CTRL register starts a warmup, TSM_BUSY is set and TSM_COUNT
+ *     counts up to the END_OF_TX_WU or END_OF_RX_WU value of the END_OF_SEQ register, pausing one count early for a
+ *     PLL lock time that grows with the frequency. The PLL LOCK_DETECT register is then set to a value tagged with
+ *     the frequency,
+ *   - clearing the force bit starts a warmdown of SIM_WD_COUNTS counts, after which TSM_COUNT and TSM_BUSY are cleared.
+ * The tool then runs forced TX and RX warmups and warmdowns on a few frequencies, more than XCVR_WU_TRACE_SIZE of them,
+ * and checks the trace content and statistics against the simulation, first with a microsecond timestamp callback and
+ * then without timestamp callback.
+ *
+ * Build it on the host for one radio generation (450 or 470) against the device headers of the target:
+ *
+ *   gcc -O2 -pthread -DgXcvrWarmupTrace_d=1 -DNXP_RADIO_GEN=470 -DRF_OSC_26MHZ=0 -I<device headers> -Idrv \
+ *       -Idrv/nb2p4ghz -Idrv/nb2p4ghz/configs/gen47 tools/xcvr_wu_trace_sim.c tools/xcvr_host_map.c \
+ *       drv/{dbg_ram_capture,mathfp,nxp_xcvr_ext_ctrl,nxp_xcvr_lcl_ctrl,nxp_xcvr_lcl_step_mgr,rfmc_ctrl}.c \
+ *       drv/nb2p4ghz/{nxp2p4_xcvr,nxp_xcvr_blob,nxp_xcvr_hop_table,nxp_xcvr_trim}.c \
+ *       drv/nb2p4ghz/configs/gen47/nxp_xcvr_*.c -lm -o xcvr_wu_trace_sim
+ *   ./xcvr_wu_trace_sim
+ *
+ * The report has one JSON object per sequence and frequency, durations are in microseconds, for instance:
+ *   {"mode":"tx_wu","freq_mhz":2480,"count":4,"min":146,"avg":151,"max":160,"hist":[0,0,0,0,0,0,0,4]}
+ * The exit status is non zero if an entry or a statistic does not match the simulated sequences.
+ */
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <sys/mman.h>
+#include <time.h>
+#include "nxp2p4_xcvr.h"
+#include "xcvr_host_map.h"
+
+#if (gXcvrWarmupTrace_d != 1)
+#error "Build with -DgXcvrWarmupTrace_d=1"
+#endif
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define SIM_END_OF_TX_WU (80U)      /* TSM counts of a TX warmup */
+#define SIM_END_OF_RX_WU (96U)      /* TSM counts of a RX warmup */
+#define SIM_WD_COUNTS (8U)          /* TSM counts of a warmdown */
+#define SIM_LOCK_TAG (0x5A000000UL) /* LOCK_DETECT value at lock, ored with the frequency in MHz */
+#define SIM_ROUNDS (6U)             /* Warmups of each sequence on each frequency */
+#define SIM_UNTIMED_SEQS (4U)       /* Warmups run without timestamp callback */
+#define SIM_NUM_FREQS (4U)
+#define SIM_NUM_PERIPHS (3U)
+#define SIM_REG(reg) (*(volatile uint32_t *)(uintptr_t)&(reg)) /* Write access to read only registers */
+
+typedef enum
+{
+    SIM_IDLE = 0,
+    SIM_WARMUP,
+    SIM_WARMDOWN
+} sim_state_t;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+static uint32_t sim_time_us(void);
+static uint32_t sim_lock_counts(uint16_t freq_mhz);
+static void *sim_tsm(void *arg);
+static void sim_sequence(xcvr_wu_trace_mode_t mode, uint16_t freq_mhz);
+static bool sim_check_entry(const xcvr_wu_trace_entry_t *entry, xcvr_wu_trace_mode_t mode, uint16_t freq_mhz,
+                            bool timed);
+static bool sim_check_stats(xcvr_wu_trace_mode_t mode, uint16_t freq_mhz, uint32_t expected_count);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static const host_periph_t sim_periphs[SIM_NUM_PERIPHS] = {
+    HOST_PERIPH(XCVR_TSM),
+    HOST_PERIPH(XCVR_MISC),
+    HOST_PERIPH(XCVR_PLL_DIG),
+};
+static host_map_t sim_regs; /* Pages of the stand-in register file */
+
+static const uint16_t sim_freqs[SIM_NUM_FREQS] = {2402U, 2426U, 2440U, 2480U};
+static const char *const sim_mode_names[gXcvrWuTraceNumModes_c] = {"rx_wu", "tx_wu", "wd"};
+
+static volatile uint16_t sim_freq_mhz; /* Frequency programmed in the PLL, sets the simulated lock time */
+static volatile bool sim_stop = false;
+static xcvr_wu_trace_entry_t sim_entries[XCVR_WU_TRACE_SIZE];
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+static uint32_t sim_time_us(void)
+{
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (uint32_t)(((uint64_t)now.tv_sec * 1000000ULL) + ((uint64_t)now.tv_nsec / 1000U));
+}
+
+/* Counts the TSM pauses before the end of a warmup for the PLL to lock */
+static uint32_t sim_lock_counts(uint16_t freq_mhz)
+{
+    return ((uint32_t)freq_mhz - 2400U) / 2U;
+}
+
+static void *sim_tsm(void *arg)
+{
+    sim_state_t state = SIM_IDLE;
+    uint32_t count    = 0U;
+    uint32_t end      = 0U;
+    uint32_t lock     = 0U;
+    uint32_t forced;
+    uint32_t tick;
+
+    (void)arg;
+    tick = sim_time_us();
+    while (!sim_stop)
+    {
+        /* One count per microsecond at most, each count starts in a later microsecond than the previous one */
+        while (sim_time_us() == tick)
+        {
+        }
+        tick = sim_time_us();
+
+        forced = XCVR_TSM->CTRL & (XCVR_TSM_CTRL_FORCE_TX_EN_MASK | XCVR_TSM_CTRL_FORCE_RX_EN_MASK);
+        switch (state)
+        {
+            case SIM_IDLE:
+                if (forced != 0U)
+                {
+                    end   = ((forced & XCVR_TSM_CTRL_FORCE_TX_EN_MASK) != 0U) ?
+                                ((XCVR_TSM->END_OF_SEQ & XCVR_TSM_END_OF_SEQ_END_OF_TX_WU_MASK) >>
+                                 XCVR_TSM_END_OF_SEQ_END_OF_TX_WU_SHIFT) :
+                                ((XCVR_TSM->END_OF_SEQ & XCVR_TSM_END_OF_SEQ_END_OF_RX_WU_MASK) >>
+                                 XCVR_TSM_END_OF_SEQ_END_OF_RX_WU_SHIFT);
+                    lock  = sim_lock_counts(sim_freq_mhz);
+                    count = 0U;
+                    state = SIM_WARMUP;
+                }
+                break;
+            case SIM_WARMUP:
+                if (forced == 0U)
+                {
+                    end   = count + SIM_WD_COUNTS;
+                    state = SIM_WARMDOWN;
+                }
+                else if ((count + 1U) == end)
+                {
+                    if (lock > 0U)
+                    {
+                        lock--;
+                    }
+                    else
+                    {
+                        SIM_REG(XCVR_PLL_DIG->LOCK_DETECT) = SIM_LOCK_TAG | sim_freq_mhz;
+                        count++;
+                    }
+                }
+                else if (count < end)
+                {
+                    count++;
+                }
+                else
+                {
+                    /* Warmup complete, hold until the force bit is cleared */
+                }
+                break;
+            case SIM_WARMDOWN:
+            default:
+                count++;
+                if (count == end)
+                {
+                    count = 0U;
+                    state = SIM_IDLE;
+                }
+                break;
+        }
+
+        SIM_REG(XCVR_MISC->XCVR_STATUS) =
+            ((count << XCVR_MISC_XCVR_STATUS_TSM_COUNT_SHIFT) & XCVR_MISC_XCVR_STATUS_TSM_COUNT_MASK) |
+            ((state != SIM_IDLE) ? XCVR_MISC_XCVR_STATUS_TSM_BUSY_MASK : 0U);
+    }
+
+    return NULL;
+}
+
+static void sim_sequence(xcvr_wu_trace_mode_t mode, uint16_t freq_mhz)
+{
+    (void)XCVR_OverrideTxFrequency((uint32_t)freq_mhz * 1000000UL);
+    sim_freq_mhz = freq_mhz;
+    if (mode == gXcvrWuTraceTxWu_c)
+    {
+        XCVR_ForceTxWu();
+        XCVR_WaitTxWu();
+        XCVR_ForceTxWd();
+    }
+    else
+    {
+        XCVR_ForceRxWu();
+        XCVR_WaitRxWu();
+        XCVR_ForceRxWd();
+    }
+    XCVR_WaitRxTxWd();
+}
+
+static bool sim_check_entry(const xcvr_wu_trace_entry_t *entry, xcvr_wu_trace_mode_t mode, uint16_t freq_mhz,
+                            bool timed)
+{
+    uint32_t end_of_wu = (mode == gXcvrWuTraceTxWu_c) ? SIM_END_OF_TX_WU : SIM_END_OF_RX_WU;
+    bool ok;
+
+    if (mode == gXcvrWuTraceWd_c)
+    {
+        ok = (entry->freq_mhz == 0U) && (entry->lock_detect == 0U);
+    }
+    else
+    {
+        /* Each count takes at least one microsecond */
+        ok = (entry->freq_mhz == freq_mhz) && (entry->lock_detect == (SIM_LOCK_TAG | freq_mhz)) &&
+             (entry->tsm_count < end_of_wu) &&
+             ((!timed) || (entry->duration >= (end_of_wu + sim_lock_counts(freq_mhz))));
+    }
+    ok = ok && (entry->mode == (uint8_t)mode) && (entry->polls > 0U);
+    /* Untimed durations are the wait loop iterations, of which polls is the saturated copy */
+    ok = ok && (timed ? (entry->duration > 0U) :
+                        ((entry->timestamp == 0U) &&
+                         ((entry->duration == entry->polls) ||
+                          ((entry->polls == 0xFFFFU) && (entry->duration > 0xFFFFU)))));
+
+    return ok;
+}
+
+static bool sim_check_stats(xcvr_wu_trace_mode_t mode, uint16_t freq_mhz, uint32_t expected_count)
+{
+    xcvr_wu_trace_stats_t stats;
+    uint32_t hist_count = 0U;
+    bool ok             = (XCVR_WuTraceGetStats(mode, freq_mhz, &stats) == gXcvrSuccess_c);
+
+    (void)printf("{\"mode\":\"%s\",\"freq_mhz\":%u,\"count\":%u,\"min\":%u,\"avg\":%u,\"max\":%u,\"hist\":[",
+                 sim_mode_names[mode], (unsigned int)freq_mhz, (unsigned int)stats.count, (unsigned int)stats.min,
+                 (unsigned int)stats.avg, (unsigned int)stats.max);
+    for (uint32_t i = 0U; i < XCVR_WU_TRACE_HIST_BINS; i++)
+    {
+        hist_count += stats.histogram[i];
+        (void)printf("%s%u", (i == 0U) ? "" : ",", (unsigned int)stats.histogram[i]);
+    }
+    (void)printf("]}\n");
+
+    ok = ok && (stats.count == expected_count) && (hist_count == stats.count) && (stats.min <= stats.avg) &&
+         (stats.avg <= stats.max);
+    if ((mode != gXcvrWuTraceWd_c) && (freq_mhz != 0U))
+    {
+        ok = ok && (stats.min >= ((mode == gXcvrWuTraceTxWu_c) ? SIM_END_OF_TX_WU : SIM_END_OF_RX_WU) +
+                                     sim_lock_counts(freq_mhz));
+    }
+    if (!ok)
+    {
+        (void)fprintf(stderr, "bad %s statistics at %u MHz\n", sim_mode_names[mode], (unsigned int)freq_mhz);
+    }
+
+    return ok;
+}
+
+int main(void)
+{
+    pthread_t tsm_thread;
+    xcvr_wu_trace_stats_t stats;
+    xcvr_wu_trace_mode_t mode;
+    uint32_t total = 2U * SIM_ROUNDS * SIM_NUM_FREQS * 2U; /* Warmups and warmdowns */
+    uint32_t first = total - XCVR_WU_TRACE_SIZE;           /* Index of the oldest recorded entry */
+    uint32_t seq;
+    uint16_t num;
+    bool ok = true;
+
+    if ((host_map(&sim_regs, sim_periphs, SIM_NUM_PERIPHS, PROT_READ | PROT_WRITE) != 0) ||
+        (pthread_create(&tsm_thread, NULL, sim_tsm, NULL) != 0))
+    {
+        return 1;
+    }
+    XCVR_TSM->END_OF_SEQ = XCVR_TSM_END_OF_SEQ_END_OF_TX_WU(SIM_END_OF_TX_WU) |
+                           XCVR_TSM_END_OF_SEQ_END_OF_RX_WU(SIM_END_OF_RX_WU);
+
+    /* Timed sequences, TX and RX on each frequency in turn, each followed by its warmdown */
+    XCVR_WuTraceInit(sim_time_us);
+    for (seq = 0U; seq < (total / 2U); seq++)
+    {
+        sim_sequence(((seq & 1U) != 0U) ? gXcvrWuTraceRxWu_c : gXcvrWuTraceTxWu_c,
+                     sim_freqs[(seq / 2U) % SIM_NUM_FREQS]);
+    }
+
+    num = XCVR_WuTraceRead(sim_entries, XCVR_WU_TRACE_SIZE);
+    ok  = (num == XCVR_WU_TRACE_SIZE) && (XCVR_WuTraceRead(NULL, XCVR_WU_TRACE_SIZE) == 0U);
+    for (uint32_t i = 0U; (i < num) && ok; i++)
+    {
+        seq  = (first + i) / 2U;
+        mode = (((first + i) & 1U) != 0U) ? gXcvrWuTraceWd_c :
+                                            (((seq & 1U) != 0U) ? gXcvrWuTraceRxWu_c : gXcvrWuTraceTxWu_c);
+        ok   = sim_check_entry(&sim_entries[i], mode, sim_freqs[(seq / 2U) % SIM_NUM_FREQS], true) &&
+             ((i == 0U) || ((int32_t)(sim_entries[i].timestamp - sim_entries[i - 1U].timestamp) >= 0));
+        if (!ok)
+        {
+            (void)fprintf(stderr, "bad entry %u\n", (unsigned int)i);
+        }
+    }
+
+    /* The ring buffer holds the last XCVR_WU_TRACE_SIZE / 2 sequences, spread evenly over TX, RX and the frequencies */
+    for (uint32_t f = 0U; f < SIM_NUM_FREQS; f++)
+    {
+        ok = sim_check_stats(gXcvrWuTraceTxWu_c, sim_freqs[f], XCVR_WU_TRACE_SIZE / (4U * SIM_NUM_FREQS)) && ok;
+        ok = sim_check_stats(gXcvrWuTraceRxWu_c, sim_freqs[f], XCVR_WU_TRACE_SIZE / (4U * SIM_NUM_FREQS)) && ok;
+    }
+    ok = sim_check_stats(gXcvrWuTraceTxWu_c, 0U, XCVR_WU_TRACE_SIZE / 4U) && ok;
+    ok = sim_check_stats(gXcvrWuTraceRxWu_c, 0U, XCVR_WU_TRACE_SIZE / 4U) && ok;
+    ok = sim_check_stats(gXcvrWuTraceWd_c, 0U, XCVR_WU_TRACE_SIZE / 2U) && ok;
+    ok = ok && (XCVR_WuTraceGetStats(gXcvrWuTraceNumModes_c, 0U, &stats) == gXcvrInvalidParameters_c) &&
+         (XCVR_WuTraceGetStats(gXcvrWuTraceTxWu_c, 0U, NULL) == gXcvrInvalidParameters_c);
+
+    /* Sequences timed in wait loop iterations */
+    XCVR_WuTraceInit(NULLPTR);
+    for (seq = 0U; seq < SIM_UNTIMED_SEQS; seq++)
+    {
+        sim_sequence(gXcvrWuTraceTxWu_c, sim_freqs[0]);
+    }
+    num = XCVR_WuTraceRead(sim_entries, XCVR_WU_TRACE_SIZE);
+    ok  = ok && (num == (2U * SIM_UNTIMED_SEQS));
+    for (uint32_t i = 0U; (i < num) && ok; i++)
+    {
+        ok = sim_check_entry(&sim_entries[i], ((i & 1U) != 0U) ? gXcvrWuTraceWd_c : gXcvrWuTraceTxWu_c, sim_freqs[0],
+                             false);
+        if (!ok)
+        {
+            (void)fprintf(stderr, "bad untimed entry %u\n", (unsigned int)i);
+        }
+    }
+
+    sim_stop = true;
+    (void)pthread_join(tsm_thread, NULL);
+
+    return ok ? 0 : 1;
+}